@@ -1,25 +1,99 @@
 // swift-tools-version:5.6
 import PackageDescription
+import Foundation
+
+/// The instruction set level `CSIMDX` is compiled for, selected by setting the
+/// `SIMDX_ISA` environment variable, e.g. `SIMDX_ISA=x86-64-v3 swift build`.
+///
+/// As `CSIMDX` is mostly inlined into `SIMDX` and its clients, the flags are
+/// passed to the Clang importer of the Swift targets as well. Without a level,
+/// macOS builds for the host and all other platforms for the compiler default.
+enum InstructionSetLevel: String {
+  /// The executing host, not suited for distribution
+  case native = "native"
+  /// SSE4.2, SSSE3 and POPCNT; about any x86 CPU since 2009
+  case x86_64_v2 = "x86-64-v2"
+  /// AVX2, FMA, BMI2 and F16C; Intel Haswell and AMD Excavator onwards
+  case x86_64_v3 = "x86-64-v3"
+  /// AVX-512 F, BW, CD, DQ and VL; Intel Skylake-X and AMD Zen 4 onwards
+  case x86_64_v4 = "x86-64-v4"
+  /// Armv8.2-A with half-precision arithmetic and dot product extensions
+  case armv8_2_a = "armv8.2-a"
+  /// Tiers that time the code paths a host would not take otherwise, see
+  /// `Scripts/benchmark-matrix.sh`; not meant for distribution.
+  case sse2 = "sse2"
+  case sse4_1 = "sse4.1"
+  case avx = "avx"
+  case avx2 = "avx2"
+  /// The generic compiler vectors of targets without SSE2 or Neon
+  case generic = "generic"
+  /// The plain C fallback of every storage
+  case scalar = "scalar"
+
+  var compilerFlags: [String] {
+    switch self {
+    case .native: return ["-march=native"]
+    case .x86_64_v2, .x86_64_v3, .x86_64_v4: return ["-march=\(rawValue)"]
+    case .armv8_2_a: return ["-march=armv8.2-a+fp16+dotprod"]
+    case .sse2: return ["-march=x86-64"]
+    case .sse4_1: return ["-march=x86-64", "-msse4.1"]
+    case .avx: return ["-march=x86-64", "-mavx"]
+    case .avx2: return ["-march=x86-64", "-mavx2", "-mfma"]
+    case .generic: return ["-DCSIMDX_FORCE_EXT_VECTOR"]
+    case .scalar: return ["-DCSIMDX_FORCE_SCALAR"]
+    }
+  }
+
+  var cSettings: [CSetting] {
+    [
+      .unsafeFlags(compilerFlags),
+      .define("CSIMDX_ISA_LEVEL", to: "\"\(rawValue)\""),
+    ]
+  }
+
+  var swiftSettings: [SwiftSetting] {
+    [.unsafeFlags((compilerFlags + ["-DCSIMDX_ISA_LEVEL=\"\(rawValue)\""]).flatMap { ["-Xcc", $0] })]
+  }
+}
+
+let isaLevel: InstructionSetLevel? = ProcessInfo.processInfo.environment["SIMDX_ISA"].map { name in
+  guard let level = InstructionSetLevel(rawValue: name) else {
+    fatalError("Unknown SIMDX_ISA '\(name)', expected one of native, x86-64-v2, x86-64-v3, x86-64-v4, armv8.2-a, sse2, sse4.1, avx, avx2, generic, scalar")
+  }
+  return level
+}
+
+/// The settings of the C targets, which inline the CSIMDX functions.
+let cSettings: [CSetting] = isaLevel?.cSettings ?? [
+  .unsafeFlags(["-march=native"], .when(platforms: [.macOS])),
+  .unsafeFlags([/*"-march=armv8-a+sve", /*"-msve-vector-bits=256"*/*/], .when(platforms: [.tvOS])),
+]
 
 let package = Package(
   name: "SIMDX",
   products: [
     .library(name: "SIMDX", targets: ["SIMDX"]),
+    .executable(name: "simdx-report", targets: ["simdx-report"]),
+    .executable(name: "simdx-benchmark", targets: ["simdx-benchmark"]),
+    .executable(name: "simdx-cycles", targets: ["simdx-cycles"]),
+    .executable(name: "simdx-fuzz", targets: ["simdx-fuzz"]),
   ],
   dependencies: [
 //    .package(url: "https://github.com/apple/swift-numerics", from: "1.0.0"),
     .package(path: "../swift-numerics")
   ],
   targets: [
-    .target(name: "CSIMDX", cSettings: [
-      .unsafeFlags(["-march=native"], .when(platforms: [.macOS])),
-      .unsafeFlags([/*"-march=armv8-a+sve", /*"-msve-vector-bits=256"*/*/], .when(platforms: [.tvOS])),
-    ]),
+    .target(name: "CSIMDX", cSettings: cSettings),
     .target(name: "SIMDX", dependencies: [
       .product(name: "RealModule", package: "swift-numerics"),
       .byName(name: "CSIMDX"),
-    ]),
-    .testTarget(name: "CSIMDXTests", dependencies: ["CSIMDX"]),
-    .testTarget(name: "SIMDXTests", dependencies: ["SIMDX"]),
+    ], swiftSettings: isaLevel?.swiftSettings),
+    .executableTarget(name: "simdx-report", dependencies: ["SIMDX"], swiftSettings: isaLevel?.swiftSettings),
+    .executableTarget(name: "simdx-benchmark", dependencies: ["SIMDX", "CSIMDX"], swiftSettings: isaLevel?.swiftSettings),
+    .executableTarget(name: "simdx-cycles", dependencies: ["CSIMDX"], cSettings: cSettings),
+    .executableTarget(name: "simdx-fuzz", dependencies: ["CSIMDX"], cSettings: cSettings),
+    .testTarget(name: "CSIMDXTests", dependencies: ["CSIMDX"], swiftSettings: isaLevel?.swiftSettings),
+    .testTarget(name: "SIMDXTests", dependencies: ["SIMDX"], swiftSettings: isaLevel?.swiftSettings),
+    .testTarget(name: "CodegenTests", exclude: ["Inputs"]),
   ]
 )
@@ -0,0 +1,65 @@
+#!/bin/bash
+# Copyright 2022 Markus Winter
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Builds and runs `simdx-benchmark` once per backend tier on this host, and
+# prints a table comparing the tiers, so that the fallback paths a regular
+# build never takes are timed as well. Results go to `.build/matrix`.
+#
+# Usage: Scripts/benchmark-matrix.sh [tier ...] [-- simdx-benchmark arguments]
+#   Tiers are `SIMDX_ISA` values and default to scalar, generic and every x86
+#   tier up to what the host supports, or scalar, generic and the default
+#   build on Arm. The first tier is the baseline of the table.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+tiers=()
+while [[ $# -gt 0 && "$1" != "--" ]]; do
+  tiers+=("$1")
+  shift
+done
+[[ "${1:-}" == "--" ]] && shift
+
+if [[ ${#tiers[@]} -eq 0 ]]; then
+  case "$(uname -m)" in
+    x86_64|amd64)
+      tiers=(scalar generic sse2)
+      cpu_flags="$(grep -m1 '^flags' /proc/cpuinfo 2>/dev/null || sysctl -n machdep.cpu.features machdep.cpu.leaf7_features 2>/dev/null || true)"
+      cpu_flags="$(tr '[:upper:]' '[:lower:]' <<< "$cpu_flags" | tr '.' '_' | sed 's/avx1_0/avx/')"
+      for tier in sse4_1 avx avx2; do
+        [[ " $cpu_flags " == *" $tier "* ]] && tiers+=("${tier/_/.}")
+      done
+      ;;
+    arm64|aarch64) tiers=(scalar generic default) ;;
+    *) tiers=(scalar generic default) ;;
+  esac
+fi
+
+mkdir -p .build/matrix
+reports=()
+for tier in "${tiers[@]}"; do
+  echo "== Benchmarking $tier" >&2
+  if [[ "$tier" == "default" ]]; then
+    env -u SIMDX_ISA swift build -c release --build-path ".build/matrix/$tier" --product simdx-benchmark >&2
+  else
+    SIMDX_ISA="$tier" swift build -c release --build-path ".build/matrix/$tier" --product simdx-benchmark >&2
+  fi
+  ".build/matrix/$tier/release/simdx-benchmark" --format json --output ".build/matrix/$tier.json" "$@"
+  reports+=(".build/matrix/$tier.json")
+done
+
+".build/matrix/${tiers[0]}/release/simdx-benchmark" --compare "${reports[@]}" --output .build/matrix/comparison.md
+cat .build/matrix/comparison.md
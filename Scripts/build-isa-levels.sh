@@ -0,0 +1,44 @@
+#!/bin/bash
+# Copyright 2022 Markus Winter
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Builds the package once per instruction set level into `.build/isa/<level>`,
+# so that each level can be shipped as a separate artifact.
+#
+# Usage: Scripts/build-isa-levels.sh [level ...] [-- swift build arguments]
+#   Levels default to those matching the host architecture.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+levels=()
+while [[ $# -gt 0 && "$1" != "--" ]]; do
+  levels+=("$1")
+  shift
+done
+[[ "${1:-}" == "--" ]] && shift
+
+if [[ ${#levels[@]} -eq 0 ]]; then
+  case "$(uname -m)" in
+    x86_64|amd64) levels=(x86-64-v2 x86-64-v3 x86-64-v4) ;;
+    arm64|aarch64) levels=(armv8.2-a) ;;
+    *) echo "No instruction set levels known for $(uname -m)" >&2; exit 1 ;;
+  esac
+fi
+
+for level in "${levels[@]}"; do
+  echo "== Building for $level"
+  SIMDX_ISA="$level" swift build -c release --build-path ".build/isa/$level" "$@"
+done
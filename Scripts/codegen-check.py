@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+# Copyright 2022 Markus Winter
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compiles the codegen test inputs with optimizations and checks the
+assembly against the FileCheck-style patterns in their comments.
+
+    Scripts/codegen-check.py [input ...]
+
+Without inputs, runs every file in Tests/CodegenTests/Inputs. Each input
+declares how it is compiled for an architecture, and which check prefixes
+apply to the assembly:
+
+    // RUN: x86_64: -msse4.1 | CHECK,X86,SSE41
+    // RUN: arm64: | CHECK,ARM64
+
+C inputs are compiled with $CC (clang, or cc) against the CSIMDX headers,
+Swift inputs with swiftc against a release build of SIMDX. A `// XFAIL:` line
+marks an input as expected to fail, so a fix has to remove it.
+
+Supported directives, for each prefix P:
+
+    P-LABEL: <pattern>   Starts a block at the (unique) matching line
+    P: <pattern>         Matches a line after the previous match in the block
+    P-NOT: <pattern>     Matches no line between the surrounding matches
+    P-NEXT: <pattern>    Matches the line right after the previous match
+
+Patterns are literal substrings, with `{{regex}}` for regular expressions.
+"""
+
+import os
+import platform
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INPUTS = os.path.join(ROOT, 'Tests', 'CodegenTests', 'Inputs')
+INCLUDE = os.path.join(ROOT, 'Sources', 'CSIMDX', 'include')
+
+
+class CheckFailure(Exception):
+    pass
+
+
+# MARK: - Patterns
+
+def compile_pattern(pattern):
+    parts = re.split(r'\{\{(.*?)\}\}', pattern.strip())
+    return re.compile(''.join(re.escape(part) if index % 2 == 0 else '(?:%s)' % part
+                              for index, part in enumerate(parts)))
+
+
+def parse_checks(source, prefixes):
+    """Returns the (kind, pattern, text, line) of all directives of `prefixes`."""
+    alternatives = '|'.join(re.escape(prefix) for prefix in prefixes)
+    directive = re.compile(r'//\s*(%s)(-LABEL|-NOT|-NEXT)?:(.*)$' % alternatives)
+    checks = []
+    for number, line in enumerate(source.splitlines(), 1):
+        match = directive.search(line)
+        if match:
+            kind = (match.group(2) or '-CHECK')[1:]
+            checks.append((kind, compile_pattern(match.group(3)), match.group(3).strip(), number))
+    return checks
+
+
+# MARK: - Checking
+
+def check_block(lines, begin, end, checks):
+    """Applies the non-label `checks` in order to `lines[begin:end]`."""
+    position = begin
+    previous = None
+    pending_not = []
+    for kind, pattern, text, number in checks:
+        if kind == 'NOT':
+            pending_not.append((pattern, text, number))
+            continue
+        if kind == 'NEXT':
+            if previous is None:
+                raise CheckFailure('line %d: NEXT without a previous match: %s' % (number, text))
+            candidates = range(previous + 1, min(previous + 2, end))
+        else:
+            candidates = range(position, end)
+        found = next((index for index in candidates if pattern.search(lines[index])), None)
+        if found is None:
+            raise CheckFailure('line %d: no match for "%s" after line %d of the output:\n  %s'
+                               % (number, text, position + 1, '\n  '.join(lines[position:min(end, position + 12)])))
+        for not_pattern, not_text, not_number in pending_not:
+            for index in range(position, found):
+                if not_pattern.search(lines[index]):
+                    raise CheckFailure('line %d: unexpected "%s" in output line %d: %s'
+                                       % (not_number, not_text, index + 1, lines[index].strip()))
+        pending_not = []
+        previous = found
+        position = found + 1
+    for not_pattern, not_text, not_number in pending_not:
+        for index in range(position, end):
+            if not_pattern.search(lines[index]):
+                raise CheckFailure('line %d: unexpected "%s" in output line %d: %s'
+                                   % (not_number, not_text, index + 1, lines[index].strip()))
+
+
+def check(output, checks):
+    lines = output.splitlines()
+    labels = []
+    for check_index, (kind, pattern, text, number) in enumerate(checks):
+        if kind != 'LABEL':
+            continue
+        start = labels[-1][1] + 1 if labels else 0
+        found = next((index for index in range(start, len(lines)) if pattern.search(lines[index])), None)
+        if found is None:
+            raise CheckFailure('line %d: no match for label "%s"' % (number, text))
+        labels.append((check_index, found))
+    if not labels:
+        check_block(lines, 0, len(lines), checks)
+        return
+    head = checks[:labels[0][0]]
+    if head:
+        check_block(lines, 0, labels[0][1], head)
+    for index, (check_index, line) in enumerate(labels):
+        following = labels[index + 1] if index + 1 < len(labels) else (len(checks), len(lines))
+        check_block(lines, line + 1, following[1], checks[check_index + 1:following[0]])
+
+
+# MARK: - Compilation
+
+def host_architecture():
+    machine = platform.machine().lower()
+    return {'amd64': 'x86_64', 'aarch64': 'arm64'}.get(machine, machine)
+
+
+def c_compiler():
+    """Returns the command of the C compiler, e.g. `CC="clang -target
+    aarch64-linux-gnu"` split into its arguments."""
+    compiler = os.environ.get('CC') or shutil.which('clang') or shutil.which('cc')
+    if not compiler:
+        raise CheckFailure('no C compiler found, set $CC')
+    return shlex.split(compiler)
+
+
+_swift_flags = None
+
+
+def swift_flags():
+    """Builds SIMDX in release, apart from the regular build directory, and
+    returns the flags to import it."""
+    global _swift_flags
+    if _swift_flags is None:
+        build = ['swift', 'build', '-c', 'release', '--package-path', ROOT,
+                 '--build-path', os.path.join(ROOT, '.build', 'codegen')]
+        subprocess.run(build + ['--target', 'SIMDX'], check=True, stdout=sys.stderr)
+        binaries = subprocess.run(build + ['--show-bin-path'], check=True,
+                                  capture_output=True, text=True).stdout.strip()
+        _swift_flags = ['-I', binaries, '-I', os.path.join(binaries, 'Modules'), '-I', INCLUDE]
+        for directory, _, files in os.walk(binaries):
+            if 'module.modulemap' in files:
+                _swift_flags += ['-Xcc', '-fmodule-map-file=' + os.path.join(directory, 'module.modulemap')]
+    return _swift_flags
+
+
+def compile_input(path, flags):
+    if path.endswith('.swift'):
+        command = ['swiftc', '-O', '-parse-as-library', '-emit-assembly', '-module-name', 'Codegen',
+                   '-o', '-', path] + swift_flags() + flags
+    else:
+        command = c_compiler() + ['-O2', '-S', '-o', '-', '-fno-asynchronous-unwind-tables',
+                                  '-I', INCLUDE, path] + flags
+    try:
+        result = subprocess.run(command, capture_output=True, text=True)
+    except OSError as error:
+        raise CheckFailure('compilation failed: %s\n%s' % (' '.join(command), error))
+    if result.returncode != 0:
+        raise CheckFailure('compilation failed: %s\n%s' % (' '.join(command), result.stderr))
+    return result.stdout
+
+
+def run(path):
+    """Returns whether the input at `path` behaves as expected."""
+    source = open(path).read()
+    name = os.path.relpath(path, ROOT)
+    expect_failure = re.search(r'//\s*XFAIL:', source) is not None
+    runs = re.findall(r'//\s*RUN:\s*([\w-]+):(.*?)\|(.*)$', source, re.M)
+    architecture = host_architecture()
+    runs = [(flags.split(), prefixes.strip().split(',')) for arch, flags, prefixes in runs
+            if arch in (architecture, 'any')]
+    if not runs:
+        print('UNSUPPORTED: %s (no RUN line for %s)' % (name, architecture))
+        return True
+    for flags, prefixes in runs:
+        configuration = '%s [%s]' % (name, ' '.join(flags) or 'default')
+        try:
+            check(compile_input(path, flags), parse_checks(source, prefixes))
+        except CheckFailure as failure:
+            if expect_failure:
+                print('XFAIL: %s' % configuration)
+                continue
+            print('FAIL: %s\n  %s' % (configuration, str(failure).replace('\n', '\n  ')))
+            return False
+        if expect_failure:
+            print('XPASS: %s (remove the XFAIL line)' % configuration)
+            return False
+        print('PASS: %s' % configuration)
+    return True
+
+
+def main(arguments):
+    paths = arguments or sorted(os.path.join(INPUTS, name) for name in os.listdir(INPUTS)
+                                if name.endswith(('.c', '.swift')))
+    if not all([run(path) for path in paths]):
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,64 @@
+#!/bin/bash
+# Copyright 2022 Markus Winter
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Builds and runs `simdx-fuzz` once per backend tier on this host, comparing
+# every CSIMDX function of the tier against the plain C fallback. Exits with
+# a non-zero status if any tier has a mismatch.
+#
+# Usage: Scripts/fuzz-backends.sh [tier ...] [-- simdx-fuzz arguments]
+#   Tiers are `SIMDX_ISA` values and default to generic and every x86 tier up
+#   to what the host supports, or generic and the default build on Arm.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+tiers=()
+while [[ $# -gt 0 && "$1" != "--" ]]; do
+  tiers+=("$1")
+  shift
+done
+[[ "${1:-}" == "--" ]] && shift
+
+if [[ ${#tiers[@]} -eq 0 ]]; then
+  case "$(uname -m)" in
+    x86_64|amd64)
+      tiers=(generic sse2)
+      cpu_flags="$(grep -m1 '^flags' /proc/cpuinfo 2>/dev/null || sysctl -n machdep.cpu.features machdep.cpu.leaf7_features 2>/dev/null || true)"
+      cpu_flags="$(tr '[:upper:]' '[:lower:]' <<< "$cpu_flags" | tr '.' '_' | sed 's/avx1_0/avx/')"
+      for tier in sse4_1 avx avx2; do
+        [[ " $cpu_flags " == *" $tier "* ]] && tiers+=("${tier/_/.}")
+      done
+      ;;
+    arm64|aarch64) tiers=(generic default) ;;
+    *) tiers=(generic default) ;;
+  esac
+fi
+
+failed=()
+for tier in "${tiers[@]}"; do
+  echo "== Fuzzing $tier" >&2
+  if [[ "$tier" == "default" ]]; then
+    env -u SIMDX_ISA swift build -c release --build-path ".build/fuzz/$tier" --product simdx-fuzz >&2
+  else
+    SIMDX_ISA="$tier" swift build -c release --build-path ".build/fuzz/$tier" --product simdx-fuzz >&2
+  fi
+  ".build/fuzz/$tier/release/simdx-fuzz" "$@" || failed+=("$tier")
+done
+
+if [[ ${#failed[@]} -gt 0 ]]; then
+  echo "Mismatches in: ${failed[*]}" >&2
+  exit 1
+fi
@@ -0,0 +1,209 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CDispatchKernels.h"
+
+#include <stddef.h>
+
+#if CSIMDX_DISPATCH_X86
+  #include <cpuid.h>
+#elif defined(__linux__) && defined(__aarch64__)
+  #include <sys/auxv.h>
+  #include <asm/hwcap.h>
+#elif defined(__linux__) && defined(__ARM_NEON)
+  #include <sys/auxv.h>
+  #include <asm/hwcap.h>
+#elif defined(__APPLE__) && defined(__aarch64__)
+  #include <sys/sysctl.h>
+#endif
+
+#pragma mark - Detection
+
+#if CSIMDX_DISPATCH_X86
+/// Returns the extended control register 0, i.e. the register states the
+/// operating system saves on context switches. Must only be called if OSXSAVE.
+static uint64_t CSIMDXReadXCR0(void)
+{
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+}
+#endif
+
+#if defined(__APPLE__) && defined(__aarch64__)
+static int CSIMDXSysctlFlag(const char* name)
+{
+  int value = 0;
+  size_t size = sizeof(value);
+  return sysctlbyname(name, &value, &size, NULL, 0) == 0 && value != 0;
+}
+#endif
+
+static unsigned int CSIMDXCPUFeaturesProbe(void)
+{
+  unsigned int features = CSIMDXCPUFeatureNone;
+#if CSIMDX_DISPATCH_X86
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return features;
+  if (edx & bit_SSE2) features |= CSIMDXCPUFeatureSSE2;
+  if (ecx & bit_SSE3) features |= CSIMDXCPUFeatureSSE3;
+  if (ecx & bit_SSSE3) features |= CSIMDXCPUFeatureSSSE3;
+  if (ecx & bit_SSE4_1) features |= CSIMDXCPUFeatureSSE4_1;
+
+  // AVX and AVX-512 registers are only usable if the OS saves their state
+  const int osxsave = (ecx & bit_OSXSAVE) != 0;
+  const uint64_t xcr0 = osxsave ? CSIMDXReadXCR0() : 0;
+  const int ymmState = (xcr0 & 0x06) == 0x06;
+  const int zmmState = (xcr0 & 0xE6) == 0xE6;
+  if (!ymmState) return features;
+  if (ecx & bit_AVX) features |= CSIMDXCPUFeatureAVX;
+  if (ecx & bit_FMA) features |= CSIMDXCPUFeatureFMA;
+
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return features;
+  if (ebx & bit_AVX2) features |= CSIMDXCPUFeatureAVX2;
+  if (!zmmState) return features;
+  if (ebx & bit_AVX512F) features |= CSIMDXCPUFeatureAVX512F;
+  if (ebx & bit_AVX512VL) features |= CSIMDXCPUFeatureAVX512VL;
+  if (ebx & bit_AVX512CD) features |= CSIMDXCPUFeatureAVX512CD;
+  if (ecx & bit_AVX512VPOPCNTDQ) features |= CSIMDXCPUFeatureAVX512VPOPCNTDQ;
+#elif defined(__linux__) && defined(__aarch64__)
+  const unsigned long hwcap = getauxval(AT_HWCAP);
+  if (hwcap & HWCAP_ASIMD) features |= CSIMDXCPUFeatureNEON;
+  if (hwcap & HWCAP_ASIMDHP) features |= CSIMDXCPUFeatureNEONFP16;
+  if (hwcap & HWCAP_ASIMDDP) features |= CSIMDXCPUFeatureNEONDotProd;
+  if (hwcap & HWCAP_SVE) features |= CSIMDXCPUFeatureSVE;
+#elif defined(__linux__) && defined(__ARM_NEON)
+  if (getauxval(AT_HWCAP) & HWCAP_NEON) features |= CSIMDXCPUFeatureNEON;
+#elif defined(__APPLE__) && defined(__aarch64__)
+  features |= CSIMDXCPUFeatureNEON;
+  if (CSIMDXSysctlFlag("hw.optional.arm.FEAT_FP16")) features |= CSIMDXCPUFeatureNEONFP16;
+  if (CSIMDXSysctlFlag("hw.optional.arm.FEAT_DotProd")) features |= CSIMDXCPUFeatureNEONDotProd;
+#elif defined(__ARM_NEON)
+  features |= CSIMDXCPUFeatureNEON;
+#endif
+  return features;
+}
+
+/// The probed features, with the sign bit set if not probed yet
+static unsigned int CSIMDXCPUFeaturesCache = ~0u;
+
+unsigned int CSIMDXCPUFeatures(void)
+{
+  unsigned int features = __atomic_load_n(&CSIMDXCPUFeaturesCache, __ATOMIC_RELAXED);
+  if (features == ~0u) {
+    // Concurrent probes store identical values, so a race is harmless
+    features = CSIMDXCPUFeaturesProbe();
+    __atomic_store_n(&CSIMDXCPUFeaturesCache, features, __ATOMIC_RELAXED);
+  }
+  return features;
+}
+
+CSIMDXDispatchLevel CSIMDXDispatchLevelSupported(void)
+{
+  const unsigned int features = CSIMDXCPUFeatures();
+#if CSIMDX_DISPATCH_X86
+  if (features & CSIMDXCPUFeatureAVX512F) return CSIMDXDispatchLevelAVX512;
+  const unsigned int avx2 = CSIMDXCPUFeatureAVX2 | CSIMDXCPUFeatureFMA;
+  if ((features & avx2) == avx2) return CSIMDXDispatchLevelAVX2;
+  if (features & CSIMDXCPUFeatureSSE4_1) return CSIMDXDispatchLevelSSE4_1;
+  if (features & CSIMDXCPUFeatureSSE2) return CSIMDXDispatchLevelSSE2;
+#elif CSIMDX_DISPATCH_NEON
+  if (features & CSIMDXCPUFeatureNEON) return CSIMDXDispatchLevelNEON;
+#endif
+  return CSIMDXDispatchLevelGeneric;
+}
+
+#pragma mark - Dispatch
+
+/// Returns the kernels of the most capable level that is not above `level`
+/// and supported by the executing CPU.
+static const CSIMDXKernelTable* CSIMDXKernelTableForLevel(CSIMDXDispatchLevel level)
+{
+  const CSIMDXDispatchLevel supported = CSIMDXDispatchLevelSupported();
+  if (level > supported) level = supported;
+#if CSIMDX_DISPATCH_X86
+  if (level >= CSIMDXDispatchLevelAVX512) return &CSIMDXKernelTableAVX512;
+  if (level >= CSIMDXDispatchLevelAVX2) return &CSIMDXKernelTableAVX2;
+  if (level >= CSIMDXDispatchLevelSSE4_1) return &CSIMDXKernelTableSSE4_1;
+  if (level >= CSIMDXDispatchLevelSSE2) return &CSIMDXKernelTableSSE2;
+#elif CSIMDX_DISPATCH_NEON
+  if (level >= CSIMDXDispatchLevelNEON) return &CSIMDXKernelTableNEON;
+#endif
+  return &CSIMDXKernelTableGeneric;
+}
+
+/// The bound kernels, or null until the first kernel call or startup
+static const CSIMDXKernelTable* CSIMDXKernelTableCurrent = NULL;
+
+static const CSIMDXKernelTable* CSIMDXKernels(void)
+{
+  const CSIMDXKernelTable* kernels = __atomic_load_n(&CSIMDXKernelTableCurrent, __ATOMIC_ACQUIRE);
+  if (__builtin_expect(kernels == NULL, 0)) {
+    kernels = CSIMDXKernelTableForLevel(CSIMDXDispatchLevelSupported());
+    __atomic_store_n(&CSIMDXKernelTableCurrent, kernels, __ATOMIC_RELEASE);
+  }
+  return kernels;
+}
+
+/// Probes the CPU and binds the kernels once when the library is loaded
+__attribute__((constructor))
+static void CSIMDXDispatchInitialize(void)
+{
+  (void)CSIMDXKernels();
+}
+
+CSIMDXDispatchLevel CSIMDXDispatchLevelCurrent(void)
+{
+  return CSIMDXKernels()->level;
+}
+
+CSIMDXDispatchLevel CSIMDXDispatchLevelSet(CSIMDXDispatchLevel level)
+{
+  const CSIMDXKernelTable* kernels = CSIMDXKernelTableForLevel(level);
+  __atomic_store_n(&CSIMDXKernelTableCurrent, kernels, __ATOMIC_RELEASE);
+  return kernels->level;
+}
+
+#pragma mark - Bulk Kernels
+
+void CSIMDXBufferAddFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  CSIMDXKernels()->addFloat32(lhs, rhs, result, count);
+}
+
+void CSIMDXBufferMultiplyFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  CSIMDXKernels()->multiplyFloat32(lhs, rhs, result, count);
+}
+
+void CSIMDXBufferMultiplyAddFloat32(const float* lhs, const float* rhs, const float* addend,
+                                    float* result, long count)
+{
+  CSIMDXKernels()->multiplyAddFloat32(lhs, rhs, addend, result, count);
+}
+
+float CSIMDXBufferSumFloat32(const float* buffer, long count)
+{
+  return CSIMDXKernels()->sumFloat32(buffer, count);
+}
+
+float CSIMDXBufferDotFloat32(const float* lhs, const float* rhs, long count)
+{
+  return CSIMDXKernels()->dotFloat32(lhs, rhs, count);
+}
+
+void CSIMDXBufferMultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count)
+{
+  CSIMDXKernels()->multiplyUInt32(lhs, rhs, result, count);
+}
@@ -0,0 +1,75 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CDispatchKernels.h"
+
+// The generic kernels are plain loops, left to the auto-vectorizer of the
+// compiler for whatever instruction set the library is compiled for.
+
+static void CSIMDXGenericAddFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  for (long index = 0; index < count; ++index) {
+    result[index] = lhs[index] + rhs[index];
+  }
+}
+
+static void CSIMDXGenericMultiplyFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  for (long index = 0; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+static void CSIMDXGenericMultiplyAddFloat32(const float* lhs, const float* rhs, const float* addend,
+                                            float* result, long count)
+{
+  for (long index = 0; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index] + addend[index];
+  }
+}
+
+static float CSIMDXGenericSumFloat32(const float* buffer, long count)
+{
+  float sum = 0.f;
+  for (long index = 0; index < count; ++index) {
+    sum += buffer[index];
+  }
+  return sum;
+}
+
+static float CSIMDXGenericDotFloat32(const float* lhs, const float* rhs, long count)
+{
+  float sum = 0.f;
+  for (long index = 0; index < count; ++index) {
+    sum += lhs[index] * rhs[index];
+  }
+  return sum;
+}
+
+static void CSIMDXGenericMultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count)
+{
+  for (long index = 0; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+const CSIMDXKernelTable CSIMDXKernelTableGeneric = {
+  CSIMDXDispatchLevelGeneric,
+  CSIMDXGenericAddFloat32,
+  CSIMDXGenericMultiplyFloat32,
+  CSIMDXGenericMultiplyAddFloat32,
+  CSIMDXGenericSumFloat32,
+  CSIMDXGenericDotFloat32,
+  CSIMDXGenericMultiplyUInt32,
+};
@@ -0,0 +1,49 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "CDispatch/CDispatch.h"
+
+/// Marks a function to be compiled for given target, independent of the
+/// instruction set the translation unit is compiled for.
+#define CSIMDX_TARGET(features) __attribute__((target(features)))
+
+#if defined(__x86_64__) || defined(__i386__)
+  #define CSIMDX_DISPATCH_X86 1
+#elif defined(__ARM_NEON)
+  #define CSIMDX_DISPATCH_NEON 1
+#endif
+
+/// The implementations of all bulk kernels of a single dispatch level.
+typedef struct CSIMDXKernelTable_t {
+  CSIMDXDispatchLevel level;
+  void (*addFloat32)(const float*, const float*, float*, long);
+  void (*multiplyFloat32)(const float*, const float*, float*, long);
+  void (*multiplyAddFloat32)(const float*, const float*, const float*, float*, long);
+  float (*sumFloat32)(const float*, long);
+  float (*dotFloat32)(const float*, const float*, long);
+  void (*multiplyUInt32)(const uint32_t*, const uint32_t*, uint32_t*, long);
+} CSIMDXKernelTable;
+
+extern const CSIMDXKernelTable CSIMDXKernelTableGeneric;
+
+#if CSIMDX_DISPATCH_X86
+extern const CSIMDXKernelTable CSIMDXKernelTableSSE2;
+extern const CSIMDXKernelTable CSIMDXKernelTableSSE4_1;
+extern const CSIMDXKernelTable CSIMDXKernelTableAVX2;
+extern const CSIMDXKernelTable CSIMDXKernelTableAVX512;
+#elif CSIMDX_DISPATCH_NEON
+extern const CSIMDXKernelTable CSIMDXKernelTableNEON;
+#endif
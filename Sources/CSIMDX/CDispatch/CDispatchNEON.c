@@ -0,0 +1,124 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CDispatchKernels.h"
+
+#if CSIMDX_DISPATCH_NEON
+
+#include <arm_neon.h>
+
+// Advanced SIMD is part of the baseline of every aarch64 and armv7 NEON build,
+// so these kernels do not need a target of their own.
+
+static float CSIMDXNEONHorizontalSum(const float32x4_t operand)
+{
+#ifdef __aarch64__
+  return vaddvq_f32(operand);
+#else
+  float32x2_t sum = vadd_f32(vget_low_f32(operand), vget_high_f32(operand));
+  return vget_lane_f32(vpadd_f32(sum, sum), 0);
+#endif
+}
+
+static void CSIMDXNEONAddFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(result + index, vaddq_f32(vld1q_f32(lhs + index), vld1q_f32(rhs + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] + rhs[index];
+  }
+}
+
+static void CSIMDXNEONMultiplyFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(result + index, vmulq_f32(vld1q_f32(lhs + index), vld1q_f32(rhs + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+static void CSIMDXNEONMultiplyAddFloat32(const float* lhs, const float* rhs, const float* addend,
+                                         float* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+#ifdef __aarch64__
+    float32x4_t sum = vfmaq_f32(vld1q_f32(addend + index), vld1q_f32(lhs + index), vld1q_f32(rhs + index));
+#else
+    float32x4_t sum = vmlaq_f32(vld1q_f32(addend + index), vld1q_f32(lhs + index), vld1q_f32(rhs + index));
+#endif
+    vst1q_f32(result + index, sum);
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index] + addend[index];
+  }
+}
+
+static float CSIMDXNEONSumFloat32(const float* buffer, long count)
+{
+  float32x4_t sum0 = vdupq_n_f32(0.f), sum1 = vdupq_n_f32(0.f);
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    sum0 = vaddq_f32(sum0, vld1q_f32(buffer + index));
+    sum1 = vaddq_f32(sum1, vld1q_f32(buffer + index + 4));
+  }
+  float sum = CSIMDXNEONHorizontalSum(vaddq_f32(sum0, sum1));
+  for (; index < count; ++index) {
+    sum += buffer[index];
+  }
+  return sum;
+}
+
+static float CSIMDXNEONDotFloat32(const float* lhs, const float* rhs, long count)
+{
+  float32x4_t sum0 = vdupq_n_f32(0.f), sum1 = vdupq_n_f32(0.f);
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    sum0 = vmlaq_f32(sum0, vld1q_f32(lhs + index), vld1q_f32(rhs + index));
+    sum1 = vmlaq_f32(sum1, vld1q_f32(lhs + index + 4), vld1q_f32(rhs + index + 4));
+  }
+  float sum = CSIMDXNEONHorizontalSum(vaddq_f32(sum0, sum1));
+  for (; index < count; ++index) {
+    sum += lhs[index] * rhs[index];
+  }
+  return sum;
+}
+
+static void CSIMDXNEONMultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_u32(result + index, vmulq_u32(vld1q_u32(lhs + index), vld1q_u32(rhs + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+const CSIMDXKernelTable CSIMDXKernelTableNEON = {
+  CSIMDXDispatchLevelNEON,
+  CSIMDXNEONAddFloat32,
+  CSIMDXNEONMultiplyFloat32,
+  CSIMDXNEONMultiplyAddFloat32,
+  CSIMDXNEONSumFloat32,
+  CSIMDXNEONDotFloat32,
+  CSIMDXNEONMultiplyUInt32,
+};
+
+#endif // CSIMDX_DISPATCH_NEON
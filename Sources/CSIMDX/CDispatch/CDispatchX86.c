@@ -0,0 +1,361 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CDispatchKernels.h"
+
+#if CSIMDX_DISPATCH_X86
+
+#include <immintrin.h>
+
+// Each kernel is compiled for its own target, independent of the flags the
+// library is compiled with, and must only be called if the CPU supports it.
+
+#pragma mark - SSE2
+
+CSIMDX_TARGET("sse2")
+static float CSIMDXSSE2HorizontalSum(const __m128 operand)
+{
+  __m128 sum = _mm_add_ps(operand, _mm_movehl_ps(operand, operand));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+  return _mm_cvtss_f32(sum);
+}
+
+CSIMDX_TARGET("sse2")
+static void CSIMDXSSE2AddFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    _mm_storeu_ps(result + index, _mm_add_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] + rhs[index];
+  }
+}
+
+CSIMDX_TARGET("sse2")
+static void CSIMDXSSE2MultiplyFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    _mm_storeu_ps(result + index, _mm_mul_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+CSIMDX_TARGET("sse2")
+static void CSIMDXSSE2MultiplyAddFloat32(const float* lhs, const float* rhs, const float* addend,
+                                         float* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 product = _mm_mul_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index));
+    _mm_storeu_ps(result + index, _mm_add_ps(product, _mm_loadu_ps(addend + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index] + addend[index];
+  }
+}
+
+CSIMDX_TARGET("sse2")
+static float CSIMDXSSE2SumFloat32(const float* buffer, long count)
+{
+  __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps();
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    sum0 = _mm_add_ps(sum0, _mm_loadu_ps(buffer + index));
+    sum1 = _mm_add_ps(sum1, _mm_loadu_ps(buffer + index + 4));
+  }
+  float sum = CSIMDXSSE2HorizontalSum(_mm_add_ps(sum0, sum1));
+  for (; index < count; ++index) {
+    sum += buffer[index];
+  }
+  return sum;
+}
+
+CSIMDX_TARGET("sse2")
+static float CSIMDXSSE2DotFloat32(const float* lhs, const float* rhs, long count)
+{
+  __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps();
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)));
+    sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(lhs + index + 4), _mm_loadu_ps(rhs + index + 4)));
+  }
+  float sum = CSIMDXSSE2HorizontalSum(_mm_add_ps(sum0, sum1));
+  for (; index < count; ++index) {
+    sum += lhs[index] * rhs[index];
+  }
+  return sum;
+}
+
+CSIMDX_TARGET("sse2")
+static void CSIMDXSSE2MultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128i left = _mm_loadu_si128((const __m128i*)(lhs + index));
+    __m128i right = _mm_loadu_si128((const __m128i*)(rhs + index));
+    // No 32-bit multiply low prior to SSE4.1, multiply even and odd lanes to 64-bit
+    __m128i even = _mm_mul_epu32(left, right);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(left, 32), _mm_srli_epi64(right, 32));
+    __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                         _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    _mm_storeu_si128((__m128i*)(result + index), product);
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+const CSIMDXKernelTable CSIMDXKernelTableSSE2 = {
+  CSIMDXDispatchLevelSSE2,
+  CSIMDXSSE2AddFloat32,
+  CSIMDXSSE2MultiplyFloat32,
+  CSIMDXSSE2MultiplyAddFloat32,
+  CSIMDXSSE2SumFloat32,
+  CSIMDXSSE2DotFloat32,
+  CSIMDXSSE2MultiplyUInt32,
+};
+
+#pragma mark - SSE4.1
+
+CSIMDX_TARGET("sse4.1")
+static void CSIMDXSSE4_1MultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128i left = _mm_loadu_si128((const __m128i*)(lhs + index));
+    __m128i right = _mm_loadu_si128((const __m128i*)(rhs + index));
+    _mm_storeu_si128((__m128i*)(result + index), _mm_mullo_epi32(left, right));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+/// SSE4.1 adds nothing to the floating point kernels over SSE2
+const CSIMDXKernelTable CSIMDXKernelTableSSE4_1 = {
+  CSIMDXDispatchLevelSSE4_1,
+  CSIMDXSSE2AddFloat32,
+  CSIMDXSSE2MultiplyFloat32,
+  CSIMDXSSE2MultiplyAddFloat32,
+  CSIMDXSSE2SumFloat32,
+  CSIMDXSSE2DotFloat32,
+  CSIMDXSSE4_1MultiplyUInt32,
+};
+
+#pragma mark - AVX2
+
+CSIMDX_TARGET("avx2,fma")
+static float CSIMDXAVX2HorizontalSum(const __m256 operand)
+{
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(operand), _mm256_extractf128_ps(operand, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+  return _mm_cvtss_f32(sum);
+}
+
+CSIMDX_TARGET("avx2,fma")
+static void CSIMDXAVX2AddFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    _mm256_storeu_ps(result + index, _mm256_add_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] + rhs[index];
+  }
+}
+
+CSIMDX_TARGET("avx2,fma")
+static void CSIMDXAVX2MultiplyFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    _mm256_storeu_ps(result + index, _mm256_mul_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index)));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+CSIMDX_TARGET("avx2,fma")
+static void CSIMDXAVX2MultiplyAddFloat32(const float* lhs, const float* rhs, const float* addend,
+                                         float* result, long count)
+{
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    __m256 sum = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index),
+                                 _mm256_loadu_ps(addend + index));
+    _mm256_storeu_ps(result + index, sum);
+  }
+  for (; index < count; ++index) {
+    result[index] = __builtin_fmaf(lhs[index], rhs[index], addend[index]);
+  }
+}
+
+CSIMDX_TARGET("avx2,fma")
+static float CSIMDXAVX2SumFloat32(const float* buffer, long count)
+{
+  __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps();
+  long index = 0;
+  for (; index + 16 <= count; index += 16) {
+    sum0 = _mm256_add_ps(sum0, _mm256_loadu_ps(buffer + index));
+    sum1 = _mm256_add_ps(sum1, _mm256_loadu_ps(buffer + index + 8));
+  }
+  float sum = CSIMDXAVX2HorizontalSum(_mm256_add_ps(sum0, sum1));
+  for (; index < count; ++index) {
+    sum += buffer[index];
+  }
+  return sum;
+}
+
+CSIMDX_TARGET("avx2,fma")
+static float CSIMDXAVX2DotFloat32(const float* lhs, const float* rhs, long count)
+{
+  __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps();
+  long index = 0;
+  for (; index + 16 <= count; index += 16) {
+    sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index), sum0);
+    sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + index + 8), _mm256_loadu_ps(rhs + index + 8), sum1);
+  }
+  float sum = CSIMDXAVX2HorizontalSum(_mm256_add_ps(sum0, sum1));
+  for (; index < count; ++index) {
+    sum += lhs[index] * rhs[index];
+  }
+  return sum;
+}
+
+CSIMDX_TARGET("avx2,fma")
+static void CSIMDXAVX2MultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count)
+{
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    __m256i left = _mm256_loadu_si256((const __m256i*)(lhs + index));
+    __m256i right = _mm256_loadu_si256((const __m256i*)(rhs + index));
+    _mm256_storeu_si256((__m256i*)(result + index), _mm256_mullo_epi32(left, right));
+  }
+  for (; index < count; ++index) {
+    result[index] = lhs[index] * rhs[index];
+  }
+}
+
+const CSIMDXKernelTable CSIMDXKernelTableAVX2 = {
+  CSIMDXDispatchLevelAVX2,
+  CSIMDXAVX2AddFloat32,
+  CSIMDXAVX2MultiplyFloat32,
+  CSIMDXAVX2MultiplyAddFloat32,
+  CSIMDXAVX2SumFloat32,
+  CSIMDXAVX2DotFloat32,
+  CSIMDXAVX2MultiplyUInt32,
+};
+
+#pragma mark - AVX-512
+
+// The tail of each buffer is handled by masked loads and stores, which do
+// not fault on masked out elements.
+
+CSIMDX_TARGET("avx512f")
+static __mmask16 CSIMDXAVX512TailMask(long remaining)
+{
+  return remaining >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << remaining) - 1);
+}
+
+CSIMDX_TARGET("avx512f")
+static void CSIMDXAVX512AddFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  for (long index = 0; index < count; index += 16) {
+    __mmask16 mask = CSIMDXAVX512TailMask(count - index);
+    __m512 sum = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, lhs + index), _mm512_maskz_loadu_ps(mask, rhs + index));
+    _mm512_mask_storeu_ps(result + index, mask, sum);
+  }
+}
+
+CSIMDX_TARGET("avx512f")
+static void CSIMDXAVX512MultiplyFloat32(const float* lhs, const float* rhs, float* result, long count)
+{
+  for (long index = 0; index < count; index += 16) {
+    __mmask16 mask = CSIMDXAVX512TailMask(count - index);
+    __m512 product = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, lhs + index), _mm512_maskz_loadu_ps(mask, rhs + index));
+    _mm512_mask_storeu_ps(result + index, mask, product);
+  }
+}
+
+CSIMDX_TARGET("avx512f")
+static void CSIMDXAVX512MultiplyAddFloat32(const float* lhs, const float* rhs, const float* addend,
+                                           float* result, long count)
+{
+  for (long index = 0; index < count; index += 16) {
+    __mmask16 mask = CSIMDXAVX512TailMask(count - index);
+    __m512 sum = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, lhs + index), _mm512_maskz_loadu_ps(mask, rhs + index),
+                                 _mm512_maskz_loadu_ps(mask, addend + index));
+    _mm512_mask_storeu_ps(result + index, mask, sum);
+  }
+}
+
+CSIMDX_TARGET("avx512f")
+static float CSIMDXAVX512SumFloat32(const float* buffer, long count)
+{
+  __m512 sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps();
+  long index = 0;
+  for (; index + 32 <= count; index += 32) {
+    sum0 = _mm512_add_ps(sum0, _mm512_loadu_ps(buffer + index));
+    sum1 = _mm512_add_ps(sum1, _mm512_loadu_ps(buffer + index + 16));
+  }
+  for (; index < count; index += 16) {
+    sum0 = _mm512_add_ps(sum0, _mm512_maskz_loadu_ps(CSIMDXAVX512TailMask(count - index), buffer + index));
+  }
+  return _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+}
+
+CSIMDX_TARGET("avx512f")
+static float CSIMDXAVX512DotFloat32(const float* lhs, const float* rhs, long count)
+{
+  __m512 sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps();
+  long index = 0;
+  for (; index + 32 <= count; index += 32) {
+    sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + index), _mm512_loadu_ps(rhs + index), sum0);
+    sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + index + 16), _mm512_loadu_ps(rhs + index + 16), sum1);
+  }
+  for (; index < count; index += 16) {
+    __mmask16 mask = CSIMDXAVX512TailMask(count - index);
+    sum0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, lhs + index), _mm512_maskz_loadu_ps(mask, rhs + index), sum0);
+  }
+  return _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+}
+
+CSIMDX_TARGET("avx512f")
+static void CSIMDXAVX512MultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count)
+{
+  for (long index = 0; index < count; index += 16) {
+    __mmask16 mask = CSIMDXAVX512TailMask(count - index);
+    __m512i product = _mm512_mullo_epi32(_mm512_maskz_loadu_epi32(mask, lhs + index),
+                                         _mm512_maskz_loadu_epi32(mask, rhs + index));
+    _mm512_mask_storeu_epi32(result + index, mask, product);
+  }
+}
+
+const CSIMDXKernelTable CSIMDXKernelTableAVX512 = {
+  CSIMDXDispatchLevelAVX512,
+  CSIMDXAVX512AddFloat32,
+  CSIMDXAVX512MultiplyFloat32,
+  CSIMDXAVX512MultiplyAddFloat32,
+  CSIMDXAVX512SumFloat32,
+  CSIMDXAVX512DotFloat32,
+  CSIMDXAVX512MultiplyUInt32,
+};
+
+#endif // CSIMDX_DISPATCH_X86
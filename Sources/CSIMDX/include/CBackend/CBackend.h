@@ -0,0 +1,202 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "../CDispatch/CDispatch.h"
+
+#pragma mark - Type def
+
+/// How a storage type is represented by the compiled code path.
+typedef enum CSIMDXStorageKind_t {
+  /// A single register of the targeted instruction set, e.g. `__m128` or `float32x4_t`
+  CSIMDXStorageKindNativeRegister = 0,
+  /// Two storages of half the length, e.g. two `CFloat64x2` for `CFloat64x4` without AVX
+  CSIMDXStorageKindEmulatedPair   = 1,
+  /// A generic compiler vector, lowered to whatever the target provides
+  CSIMDXStorageKindGenericVector  = 2,
+  /// A plain C array, processed element by element
+  CSIMDXStorageKindScalarFallback = 3,
+} CSIMDXStorageKind;
+
+/// The storage types whose representation depends on the compiled code path.
+typedef enum CSIMDXStorageType_t {
+  CSIMDXStorageTypeFloat32x2 = 0,
+  CSIMDXStorageTypeFloat32x3,
+  CSIMDXStorageTypeFloat32x4,
+  CSIMDXStorageTypeFloat32x8,
+  CSIMDXStorageTypeFloat32x16,
+  CSIMDXStorageTypeFloat64x2,
+  CSIMDXStorageTypeFloat64x3,
+  CSIMDXStorageTypeFloat64x4,
+  CSIMDXStorageTypeFloat64x8,
+  CSIMDXStorageTypeInt32x2,
+  CSIMDXStorageTypeInt32x3,
+  CSIMDXStorageTypeInt32x4,
+  CSIMDXStorageTypeInt32x8,
+  CSIMDXStorageTypeInt32x16,
+  CSIMDXStorageTypeUInt32x2,
+  CSIMDXStorageTypeUInt32x3,
+  CSIMDXStorageTypeUInt32x4,
+  CSIMDXStorageTypeUInt32x8,
+  CSIMDXStorageTypeUInt32x16,
+  CSIMDXStorageTypeCount,
+} CSIMDXStorageType;
+
+#pragma mark - Introspection
+
+/// Returns the instruction set extensions the storages have been compiled for.
+///
+/// Being inlined, the result reflects the compiler flags of the caller, i.e. of
+/// the very code that operates on the storages, and not of the CSIMDX module.
+/// Compare to `CSIMDXCPUFeatures()` to find extensions the build leaves unused.
+/// @return A combination of `CSIMDXCPUFeature` values
+FORCE_INLINE(unsigned int) CSIMDXActiveFeatures(void)
+{
+  unsigned int features = CSIMDXCPUFeatureNone;
+#if CSIMDX_ARM_NEON
+  features |= CSIMDXCPUFeatureNEON;
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+  features |= CSIMDXCPUFeatureNEONFP16;
+#endif
+#if defined(__ARM_FEATURE_DOTPROD)
+  features |= CSIMDXCPUFeatureNEONDotProd;
+#endif
+#endif
+#if CSIMDX_ARM_SVE
+  features |= CSIMDXCPUFeatureSVE;
+#endif
+#if CSIMDX_X86_SSE2
+  features |= CSIMDXCPUFeatureSSE2;
+#endif
+#if CSIMDX_X86_SSE3
+  features |= CSIMDXCPUFeatureSSE3;
+#endif
+#if CSIMDX_X86_SSSE3
+  features |= CSIMDXCPUFeatureSSSE3;
+#endif
+#if CSIMDX_X86_SSE4_1
+  features |= CSIMDXCPUFeatureSSE4_1;
+#endif
+#if CSIMDX_X86_AVX
+  features |= CSIMDXCPUFeatureAVX;
+#if defined(__AVX512F__)
+  features |= CSIMDXCPUFeatureAVX512F;
+#endif
+#if defined(__AVX512VL__)
+  features |= CSIMDXCPUFeatureAVX512VL;
+#endif
+#endif
+#if CSIMDX_X86_AVX2
+  features |= CSIMDXCPUFeatureAVX2;
+#endif
+#if CSIMDX_X86_FMA
+  features |= CSIMDXCPUFeatureFMA;
+#endif
+#if CSIMDX_X86_AVX512_CD
+  features |= CSIMDXCPUFeatureAVX512CD;
+#endif
+#if CSIMDX_X86_AVX512_VPOPCNTDQ
+  features |= CSIMDXCPUFeatureAVX512VPOPCNTDQ;
+#endif
+  return features;
+}
+
+/// Returns how given storage `type` is represented by the compiled code path.
+/// Mirrors the storage type definitions, with the same caveat as
+/// `CSIMDXActiveFeatures()` regarding the compiler flags of the caller.
+FORCE_INLINE(CSIMDXStorageKind) CSIMDXStorageKindOf(const CSIMDXStorageType type)
+{
+#if CSIMDX_ARM_NEON
+  switch (type) {
+    case CSIMDXStorageTypeFloat64x2:
+#if CSIMDX_ARM_NEON_AARCH64
+      return CSIMDXStorageKindNativeRegister;
+#else
+      return CSIMDXStorageKindScalarFallback;
+#endif
+    case CSIMDXStorageTypeFloat64x3:
+    case CSIMDXStorageTypeFloat64x4:
+    case CSIMDXStorageTypeFloat64x8:
+#if CSIMDX_ARM_NEON_AARCH64
+      return CSIMDXStorageKindEmulatedPair;
+#else
+      return CSIMDXStorageKindScalarFallback;
+#endif
+    case CSIMDXStorageTypeFloat32x8:
+    case CSIMDXStorageTypeFloat32x16:
+    case CSIMDXStorageTypeInt32x8:
+    case CSIMDXStorageTypeInt32x16:
+    case CSIMDXStorageTypeUInt32x8:
+    case CSIMDXStorageTypeUInt32x16:
+      return CSIMDXStorageKindEmulatedPair;
+    default:
+      return CSIMDXStorageKindNativeRegister;
+  }
+#elif CSIMDX_X86_SSE2
+  switch (type) {
+    case CSIMDXStorageTypeFloat32x8:
+    case CSIMDXStorageTypeFloat64x3:
+    case CSIMDXStorageTypeFloat64x4:
+#if CSIMDX_X86_AVX
+      return CSIMDXStorageKindNativeRegister;
+#else
+      return CSIMDXStorageKindEmulatedPair;
+#endif
+    case CSIMDXStorageTypeInt32x8:
+    case CSIMDXStorageTypeUInt32x8:
+#if CSIMDX_X86_AVX2
+      return CSIMDXStorageKindNativeRegister;
+#else
+      return CSIMDXStorageKindEmulatedPair;
+#endif
+    case CSIMDXStorageTypeFloat32x16:
+    case CSIMDXStorageTypeFloat64x8:
+    case CSIMDXStorageTypeInt32x16:
+    case CSIMDXStorageTypeUInt32x16:
+#if CSIMDX_X86_AVX512_F
+      return CSIMDXStorageKindNativeRegister;
+#else
+      return CSIMDXStorageKindEmulatedPair;
+#endif
+    default:
+      return CSIMDXStorageKindNativeRegister;
+  }
+#elif CSIMDX_X86_MMX
+  switch (type) {
+    case CSIMDXStorageTypeInt32x2:
+    case CSIMDXStorageTypeUInt32x2:
+      return CSIMDXStorageKindNativeRegister;
+    default:
+      return CSIMDXStorageKindScalarFallback;
+  }
+#elif CSIMDX_EXT_VECTOR
+  (void)type;
+  return CSIMDXStorageKindGenericVector;
+#else
+  (void)type;
+  return CSIMDXStorageKindScalarFallback;
+#endif
+}
+
+/// Returns the instruction set level selected through `SIMDX_ISA` when the
+/// caller was compiled, e.g. `"x86-64-v3"`, or `NULL` for the default flags.
+FORCE_INLINE(const char*) CSIMDXActiveISALevel(void)
+{
+#ifdef CSIMDX_ISA_LEVEL
+  return CSIMDX_ISA_LEVEL;
+#else
+  return (const char*)0;
+#endif
+}
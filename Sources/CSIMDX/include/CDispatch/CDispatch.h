@@ -0,0 +1,108 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#pragma mark - Type def
+
+/// A set of instruction set extensions, as found on the executing CPU.
+typedef enum CSIMDXCPUFeature_t {
+  CSIMDXCPUFeatureNone        = 0,
+  CSIMDXCPUFeatureSSE2        = 1 << 0,
+  CSIMDXCPUFeatureSSE3        = 1 << 1,
+  CSIMDXCPUFeatureSSSE3       = 1 << 2,
+  CSIMDXCPUFeatureSSE4_1      = 1 << 3,
+  CSIMDXCPUFeatureAVX         = 1 << 4,
+  CSIMDXCPUFeatureAVX2        = 1 << 5,
+  CSIMDXCPUFeatureFMA         = 1 << 6,
+  CSIMDXCPUFeatureAVX512F     = 1 << 7,
+  CSIMDXCPUFeatureAVX512VL    = 1 << 8,
+  CSIMDXCPUFeatureAVX512CD    = 1 << 9,
+  CSIMDXCPUFeatureAVX512VPOPCNTDQ = 1 << 10,
+  CSIMDXCPUFeatureNEON        = 1 << 16,
+  CSIMDXCPUFeatureNEONFP16    = 1 << 17,
+  CSIMDXCPUFeatureNEONDotProd = 1 << 18,
+  CSIMDXCPUFeatureSVE         = 1 << 19,
+} CSIMDXCPUFeature;
+
+/// The implementations the bulk kernels can be dispatched to, ordered from
+/// the least to the most capable one on each architecture.
+typedef enum CSIMDXDispatchLevel_t {
+  /// Plain C, vectorized by the compiler for the baseline of the build
+  CSIMDXDispatchLevelGeneric = 0,
+  /// 128-bit SSE2
+  CSIMDXDispatchLevelSSE2    = 1,
+  /// 128-bit SSE4.1
+  CSIMDXDispatchLevelSSE4_1  = 2,
+  /// 256-bit AVX2 and FMA
+  CSIMDXDispatchLevelAVX2    = 3,
+  /// 512-bit AVX-512 Foundation
+  CSIMDXDispatchLevelAVX512  = 4,
+  /// 128-bit Advanced SIMD (NEON)
+  CSIMDXDispatchLevelNEON    = 16,
+} CSIMDXDispatchLevel;
+
+#pragma mark - Detection
+
+/// Returns the instruction set extensions supported by the executing CPU and
+/// operating system. The CPU is probed once, later calls return a cached set.
+/// @return A combination of `CSIMDXCPUFeature` values
+unsigned int CSIMDXCPUFeatures(void);
+
+/// Returns the most capable dispatch level supported by the executing CPU.
+CSIMDXDispatchLevel CSIMDXDispatchLevelSupported(void);
+
+#pragma mark - Dispatch
+
+/// Returns the dispatch level the bulk kernels are currently bound to.
+///
+/// The kernels are bound to `CSIMDXDispatchLevelSupported()` at startup,
+/// regardless of the instruction set the library was compiled for.
+CSIMDXDispatchLevel CSIMDXDispatchLevelCurrent(void);
+
+/// Binds the bulk kernels to given `level`, or to the most capable supported
+/// level below it if the executing CPU does not support `level`. Meant for
+/// testing and benchmarking; must not be called concurrently to any kernel.
+/// @return The level the kernels have been bound to
+CSIMDXDispatchLevel CSIMDXDispatchLevelSet(CSIMDXDispatchLevel level);
+
+#pragma mark - Bulk Kernels
+
+/// Adds `count` elements of `lhs` and `rhs` and stores them into `result`.
+/// @note `result` may alias `lhs` and/or `rhs`, but must not partially overlap.
+void CSIMDXBufferAddFloat32(const float* lhs, const float* rhs, float* result, long count);
+
+/// Multiplies `count` elements of `lhs` and `rhs` and stores them into `result`.
+/// @note `result` may alias `lhs` and/or `rhs`, but must not partially overlap.
+void CSIMDXBufferMultiplyFloat32(const float* lhs, const float* rhs, float* result, long count);
+
+/// Multiplies `count` elements of `lhs` and `rhs`, adds `addend` and stores
+/// them into `result`. The AVX2 and AVX-512 levels compute a fused
+/// multiply-add, hence results may differ in the last place across levels.
+void CSIMDXBufferMultiplyAddFloat32(const float* lhs, const float* rhs, const float* addend,
+                                    float* result, long count);
+
+/// Returns the sum of `count` elements of `buffer`. The order of additions
+/// depends on the dispatch level, hence results may differ in rounding.
+float CSIMDXBufferSumFloat32(const float* buffer, long count);
+
+/// Returns the dot product of `count` elements of `lhs` and `rhs`. The order of
+/// additions depends on the dispatch level, hence results may differ in rounding.
+float CSIMDXBufferDotFloat32(const float* lhs, const float* rhs, long count);
+
+/// Multiplies `count` elements of `lhs` and `rhs`, wrapping on overflow, and
+/// stores the lower 32 bits of each product into `result`.
+void CSIMDXBufferMultiplyUInt32(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, long count);
@@ -17,9 +17,12 @@
 #include "CFloat32x2.h"
 #include "CFloat32x3.h"
 #include "CFloat32x4.h"
+#include "CFloat32x8.h"
+#include "CFloat32x16.h"
 #include "CFloat64x2.h"
 #include "CFloat64x3.h"
 #include "CFloat64x4.h"
+#include "CFloat64x8.h"
 
 #pragma mark - CFloat32x2 <-> CFloat64x2
 
@@ -33,6 +36,8 @@ FORCE_INLINE(CFloat32x2) CFloat32x2FromCFloat64x2(CFloat64x2 operand)
   return vcvt_f32_f64(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_cvtpd_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_convertvector(operand, CFloat32x2);
 #else
   return CFloat32x2Make((double)CFloat64x2GetElement(operand, 0),
                         (double)CFloat64x2GetElement(operand, 1));
@@ -49,6 +54,8 @@ FORCE_INLINE(CFloat64x2) CFloat64x2FromCFloat32x2(CFloat32x2 operand)
   return vcvt_f64_f32(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_cvtps_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_convertvector(operand, CFloat64x2);
 #else
   return CFloat64x2Make((double)CFloat32x2GetElement(operand, 0),
                         (double)CFloat32x2GetElement(operand, 1));
@@ -0,0 +1,615 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit floating point element
+#define Float32 float
+
+/// The 16 x 32-bit floating point storage, a single register where the
+/// target has 512-bit registers and two CFloat32x8 otherwise
+#if CSIMDX_X86_AVX512_F
+typedef __m512 CFloat32x16;
+#elif CSIMDX_EXT_VECTOR
+typedef Float32 CFloat32x16 CSIMDX_EXT_VECTOR_TYPE(Float32, 16);
+#else
+typedef struct CFloat32x16_t {
+  CFloat32x8 lo, hi;
+} CFloat32x16;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(Float32)
+CFloat32x16GetElement(const CFloat32x16 storage, const int index)
+{
+#if CSIMDX_X86_AVX512_F
+  return ((Float32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  union { CFloat32x16 storage; Float32 rawValue[16]; } Union;
+  Union.storage = storage;
+  return Union.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CFloat32x16SetElement(CFloat32x16* storage, const int index, const Float32 value)
+{
+#if CSIMDX_X86_AVX512_F
+  ((Float32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  union { CFloat32x16* storage; Float32* rawValue; } Union;
+  Union.storage = storage;
+  Union.rawValue[index] = value;
+#endif
+}
+
+#pragma mark Lanes
+
+/// Returns the lower half of `storage`.
+/// @return `(CFloat32x8){ storage[0], ..., storage[7] }`
+FORCE_INLINE(CFloat32x8) CFloat32x16GetLow(const CFloat32x16 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castps512_ps256(storage);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 0, 1, 2, 3, 4, 5, 6, 7);
+#else
+  return storage.lo;
+#endif
+}
+
+/// Returns the upper half of `storage`.
+/// @return `(CFloat32x8){ storage[8], ..., storage[15] }`
+FORCE_INLINE(CFloat32x8) CFloat32x16GetHigh(const CFloat32x16 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(storage), 1));
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 8, 9, 10, 11, 12, 13, 14, 15);
+#else
+  return storage.hi;
+#endif
+}
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat32x16GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float32)
+CFloat32x16ExtractLane(const CFloat32x16 storage, const int lane)
+{
+#if CSIMDX_X86_AVX512_F
+  if (__builtin_constant_p(lane)) {
+    return lane < 8 ? CFloat32x8ExtractLane(CFloat32x16GetLow(storage), lane)
+                    : CFloat32x8ExtractLane(CFloat32x16GetHigh(storage), lane - 8);
+  }
+  return CFloat32x16GetElement(storage, lane);
+#elif CSIMDX_EXT_VECTOR
+  return storage[lane];
+#else
+  return lane < 8 ? CFloat32x8ExtractLane(storage.lo, lane) : CFloat32x8ExtractLane(storage.hi, lane - 8);
+#endif
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat32x16SetElement`, the element is inserted within the register on targets
+/// with 512-bit registers, by a move under the mask of `lane`, and a
+/// compile-time constant `lane` is inserted within the register otherwise.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16InsertLane(const CFloat32x16 storage, const int lane, const Float32 value)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mask_mov_ps(storage, (__mmask16)(1 << lane), _mm512_set1_ps(value));
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x16 result = storage;
+  result[lane] = value;
+  return result;
+#else
+  CFloat32x16 result = storage;
+  if (lane < 8) result.lo = CFloat32x8InsertLane(storage.lo, lane, value);
+  else result.hi = CFloat32x8InsertLane(storage.hi, lane - 8, value);
+  return result;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Loads 16 x Float32 values from unaligned memory.
+/// @return `(CFloat32x16){ pointer[0], pointer[1], ..., pointer[15] }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16MakeLoad(const Float32* pointer)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_loadu_ps(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x16 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8MakeLoad(pointer);
+  result.hi = CFloat32x8MakeLoad(&pointer[8]);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CFloat32x16){ value, value, ..., value }`
+FORCE_INLINE(CFloat32x16) CFloat32x16MakeRepeatingElement(const Float32 value)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_set1_ps(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x16){ value, value, value, value, value, value, value, value, value, value, value, value, value, value, value, value };
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8MakeRepeatingElement(value);
+  result.hi = CFloat32x8MakeRepeatingElement(value);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0.f).
+/// @return `(CFloat32x16){ 0.f, 0.f, ..., 0.f }`
+FORCE_INLINE(CFloat32x16) CFloat32x16MakeZero(void)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_setzero_ps();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x16){ 0.f };
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8MakeZero();
+  result.hi = CFloat32x8MakeZero();
+  return result;
+#endif
+}
+
+#pragma mark - Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && ... && lhs[15] == rhs[15]`
+FORCE_INLINE(bool)
+CFloat32x16Equal(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_OQ) == 0xFFFF;
+#elif CSIMDX_EXT_VECTOR
+  return CFloat32x8Equal(CFloat32x16GetLow(lhs), CFloat32x16GetLow(rhs)) &&
+         CFloat32x8Equal(CFloat32x16GetHigh(lhs), CFloat32x16GetHigh(rhs));
+#else
+  return CFloat32x8Equal(lhs.lo, rhs.lo) && CFloat32x8Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat32x16){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat32x16) CFloat32x16Canonicalize(const CFloat32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return _mm512_mask_add_ps(_mm512_set1_ps(__builtin_nanf("")),
+                            _mm512_cmp_ps_mask(operand, operand, _CMP_ORD_Q),
+                            operand, _mm512_setzero_ps());
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat32x16)(((__typeof__(ordered))(operand + 0.f) & ordered) |
+                       ((__typeof__(ordered))CFloat32x16MakeRepeatingElement(__builtin_nanf("")) & ~ordered));
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Canonicalize(operand.lo);
+  result.hi = CFloat32x8Canonicalize(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return
+///   (CFloat32x16){
+///     lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x16)
+CFloat32x16Minimum(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_min_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Minimum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8Minimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return
+///   (CFloat32x16){
+///     lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x16)
+CFloat32x16Maximum(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_max_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Maximum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8Maximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x16){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x16)
+CFloat32x16IEEEMinimum(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  __m512i lhsFirst = _mm512_castps_si512(_mm512_min_ps(lhs, rhs));
+  __m512i rhsFirst = _mm512_castps_si512(_mm512_min_ps(rhs, lhs));
+  return _mm512_castsi512_ps(_mm512_or_si512(lhsFirst, rhsFirst));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8IEEEMinimum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8IEEEMinimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x16){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x16)
+CFloat32x16IEEEMaximum(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  __m512i lhsFirst = _mm512_castps_si512(_mm512_max_ps(lhs, rhs));
+  __m512i rhsFirst = _mm512_castps_si512(_mm512_max_ps(rhs, lhs));
+  return _mm512_mask_add_ps(_mm512_castsi512_ps(_mm512_and_si512(lhsFirst, rhsFirst)),
+                            _mm512_cmp_ps_mask(lhs, rhs, _CMP_UNORD_Q), lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8IEEEMaximum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8IEEEMaximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Returns the negated storage (element-wise).
+/// @return `(CFloat32x16){ -(operand[0]), -(operand[1]), ..., -(operand[15]) }`
+FORCE_INLINE(CFloat32x16) CFloat32x16Negate(const CFloat32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(operand), _mm512_set1_epi32((int)0x80000000)));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Negate(operand.lo);
+  result.hi = CFloat32x8Negate(operand.hi);
+  return result;
+#endif
+}
+
+/// Returns the absolute storage (element-wise).
+/// @return `(CFloat32x16){ abs(operand[0]), abs(operand[1]), ..., abs(operand[15]) }`
+FORCE_INLINE(CFloat32x16) CFloat32x16Magnitude(const CFloat32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_ps(_mm512_andnot_epi32(_mm512_set1_epi32((int)0x80000000), _mm512_castps_si512(operand)));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x16)((__typeof__(operand < operand))operand & 0x7FFFFFFF);
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Magnitude(operand.lo);
+  result.hi = CFloat32x8Magnitude(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CFloat32x16){ lhs[0] + rhs[0], ..., lhs[15] + rhs[15] }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16Add(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_add_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Add(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8Add(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CFloat32x16){ lhs[0] - rhs[0], ..., lhs[15] - rhs[15] }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16Subtract(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sub_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Subtract(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8Subtract(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise).
+/// @return `(CFloat32x16){ lhs[0] * rhs[0], ..., lhs[15] * rhs[15] }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16Multiply(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mul_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Multiply(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8Multiply(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Divides two storages (element-wise).
+/// @return `(CFloat32x16){ lhs[0] / rhs[0], ..., lhs[15] / rhs[15] }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16Divide(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_div_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Divide(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8Divide(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Calculates the square root (element-wise).
+/// @return `(CFloat32x16){ sqrt(operand[0]), ..., sqrt(operand[15]) }`
+FORCE_INLINE(CFloat32x16) CFloat32x16SquareRoot(const CFloat32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sqrt_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x16 result;
+  for (int index = 0; index < 16; index++) result[index] = __builtin_sqrtf(operand[index]);
+  return result;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8SquareRoot(operand.lo);
+  result.hi = CFloat32x8SquareRoot(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return `(CFloat32x16){ lhs[0] * rhs[0] + addend[0], ..., lhs[15] * rhs[15] + addend[15] }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16MultiplyAdd(const CFloat32x16 lhs,
+                       const CFloat32x16 rhs,
+                       const CFloat32x16 addend)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_fmadd_ps(lhs, rhs, addend);
+#elif CSIMDX_EXT_VECTOR
+  return CFloat32x16Add(CFloat32x16Multiply(lhs, rhs), addend);
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8MultiplyAdd(lhs.lo, rhs.lo, addend.lo);
+  result.hi = CFloat32x8MultiplyAdd(lhs.hi, rhs.hi, addend.hi);
+  return result;
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return `(CFloat32x16){ lhs[0] + rhs, ..., lhs[15] + rhs }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16AddElement(const CFloat32x16 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_add_ps(lhs, _mm512_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8AddElement(lhs.lo, rhs);
+  result.hi = CFloat32x8AddElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return `(CFloat32x16){ lhs[0] - rhs, ..., lhs[15] - rhs }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16SubtractElement(const CFloat32x16 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sub_ps(lhs, _mm512_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8SubtractElement(lhs.lo, rhs);
+  result.hi = CFloat32x8SubtractElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return `(CFloat32x16){ lhs[0] * rhs, ..., lhs[15] * rhs }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16MultiplyElement(const CFloat32x16 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mul_ps(lhs, _mm512_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8MultiplyElement(lhs.lo, rhs);
+  result.hi = CFloat32x8MultiplyElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return `(CFloat32x16){ lhs[0] / rhs, ..., lhs[15] / rhs }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16DivideElement(const CFloat32x16 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_div_ps(lhs, _mm512_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8DivideElement(lhs.lo, rhs);
+  result.hi = CFloat32x8DivideElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return `(CFloat32x16){ lhs[0] * rhs + addend[0], ..., lhs[15] * rhs + addend[15] }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16MultiplyElementAdd(const CFloat32x16 lhs,
+                              const Float32 rhs,
+                              const CFloat32x16 addend)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_fmadd_ps(lhs, _mm512_set1_ps(rhs), addend);
+#elif CSIMDX_EXT_VECTOR
+  return CFloat32x16Add(CFloat32x16MultiplyElement(lhs, rhs), addend);
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8MultiplyElementAdd(lhs.lo, rhs, addend.lo);
+  result.hi = CFloat32x8MultiplyElementAdd(lhs.hi, rhs, addend.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Reduction
+
+// Like those of `CFloat32x8`, the reductions fold the upper half of the storage
+// onto the lower one until a single element is left, in the same order on
+// every target.
+
+/// Returns the sum of all elements, as `CFloat32x8ReduceAdd` of the
+/// sum of both halves.
+/// @return `CFloat32x8ReduceAdd(CFloat32x8Add(low half, high half))`
+FORCE_INLINE(Float32) CFloat32x16ReduceAdd(const CFloat32x16 operand)
+{
+  return CFloat32x8ReduceAdd(CFloat32x8Add(CFloat32x16GetLow(operand), CFloat32x16GetHigh(operand)));
+}
+
+/// Returns the least of all elements, as `CFloat32x8ReduceMinimum` of the
+/// minimum of both halves. Whether a NaN
+/// element is returned thus depends on its lane.
+/// @return `CFloat32x8ReduceMinimum(CFloat32x8Minimum(low half, high half))`
+FORCE_INLINE(Float32) CFloat32x16ReduceMinimum(const CFloat32x16 operand)
+{
+  return CFloat32x8ReduceMinimum(CFloat32x8Minimum(CFloat32x16GetLow(operand), CFloat32x16GetHigh(operand)));
+}
+
+/// Returns the greatest of all elements, as `CFloat32x8ReduceMaximum` of the
+/// maximum of both halves. Whether a NaN
+/// element is returned thus depends on its lane.
+/// @return `CFloat32x8ReduceMaximum(CFloat32x8Maximum(low half, high half))`
+FORCE_INLINE(Float32) CFloat32x16ReduceMaximum(const CFloat32x16 operand)
+{
+  return CFloat32x8ReduceMaximum(CFloat32x8Maximum(CFloat32x16GetLow(operand), CFloat32x16GetHigh(operand)));
+}
+
+#undef Float32
@@ -24,6 +24,8 @@
 typedef float32x2_t CFloat32x2;
 #elif CSIMDX_X86_SSE2
 typedef __m128 CFloat32x2; // Most significant 64-bits are unused.
+#elif CSIMDX_EXT_VECTOR
+typedef Float32 CFloat32x2 CSIMDX_EXT_VECTOR_TYPE(Float32, 2);
 #else
 typedef struct CFloat32x2_t {
   Float32 rawValue[2];
@@ -39,6 +41,8 @@ CFloat32x2GetElement(const CFloat32x2 storage, const int index)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2
   return ((Float32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   return storage.rawValue[index];
 #endif
@@ -51,11 +55,66 @@ CFloat32x2SetElement(CFloat32x2* storage, const int index, const Float32 value)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2
   ((Float32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   (storage->rawValue)[index] = value;
 #endif
 }
 
+#pragma mark Lanes
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat32x2GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float32)
+CFloat32x2ExtractLane(const CFloat32x2 storage, const int lane)
+{
+#if CSIMDX_ARM_NEON
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vget_lane_f32(storage, 0);
+    case 1: return vget_lane_f32(storage, 1);
+  }
+#elif CSIMDX_X86_SSE2
+  // Shuffle into the lowest lane, as `_mm_extract_ps` moves to a general purpose register
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_cvtss_f32(storage);
+    case 1: return _mm_cvtss_f32(_mm_shuffle_ps(storage, storage, _MM_SHUFFLE(1, 1, 1, 1)));
+  }
+#endif
+  return CFloat32x2GetElement(storage, lane);
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat32x2SetElement`, a compile-time constant `lane` is inserted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2InsertLane(const CFloat32x2 storage, const int lane, const Float32 value)
+{
+#if CSIMDX_ARM_NEON
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vset_lane_f32(value, storage, 0);
+    case 1: return vset_lane_f32(value, storage, 1);
+  }
+#elif CSIMDX_X86_SSE4_1
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_move_ss(storage, _mm_set_ss(value));
+    case 1: return _mm_insert_ps(storage, _mm_set_ss(value), 0x10);
+  }
+#elif CSIMDX_X86_SSE2
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_move_ss(storage, _mm_set_ss(value));
+    case 1: return _mm_shuffle_ps(_mm_shuffle_ps(_mm_set_ss(value), storage, _MM_SHUFFLE(0, 0, 0, 0)),
+                                  storage, _MM_SHUFFLE(3, 2, 0, 2));
+  }
+#endif
+  CFloat32x2 result = storage;
+  CFloat32x2SetElement(&result, lane, value);
+  return result;
+}
+
 #pragma mark - Initialisation
 
 /// Initializes a storage to given elements. Least- to most-significant bits.
@@ -76,9 +135,11 @@ FORCE_INLINE(CFloat32x2) CFloat32x2MakeLoad(const Float32* pointer)
 #if CSIMDX_ARM_NEON
   return vld1_f32(pointer);
 #elif CSIMDX_X86_SSE2
-  CFloat32x2 result = _mm_loadu_ps(pointer);
-  CFloat32x2SetElement(&result, 2, 0.f); // The last 64 bits ...
-  CFloat32x2SetElement(&result, 3, 0.f); // ... are unused, but zero.
+  // A single 64-bit load, that zeroes the unused upper half
+  return _mm_castpd_ps(_mm_load_sd((const double*)pointer));
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x2 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
   return result;
 #else
   return CFloat32x2Make(pointer[0], pointer[1]);
@@ -96,6 +157,8 @@ FORCE_INLINE(CFloat32x2) CFloat32x2MakeRepeatingElement(const Float32 value)
   CFloat32x2SetElement(&result, 2, 0.f); // The last 64 bits ...
   CFloat32x2SetElement(&result, 3, 0.f); // ... are unused, but zero.
   return result;
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x2){ value, value };
 #else
   return CFloat32x2Make(value, value);
 #endif
@@ -109,11 +172,67 @@ FORCE_INLINE(CFloat32x2) CFloat32x2MakeZero(void)
   return vdup_n_f32(0.f);
 #elif CSIMDX_X86_SSE2
   return _mm_setzero_ps();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x2){ 0.f };
 #else
   return CFloat32x2Make(0.f, 0.f);
 #endif
 }
 
+#pragma mark - Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1]`
+FORCE_INLINE(bool)
+CFloat32x2Equal(const CFloat32x2 lhs, const CFloat32x2 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminv_u32(vceq_f32(lhs, rhs)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x2_t mask = vceq_f32(lhs, rhs);
+  return vget_lane_u32(vpmin_u32(mask, mask), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  // The two most significant elements are unused, ignore their signs
+  return (_mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs)) & 0x3) == 0x3;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1]) != 0;
+#else
+  return CFloat32x2GetElement(lhs, 0) == CFloat32x2GetElement(rhs, 0)
+      && CFloat32x2GetElement(lhs, 1) == CFloat32x2GetElement(rhs, 1);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat32x2){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat32x2) CFloat32x2Canonicalize(const CFloat32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return vbsl_f32(vceq_f32(operand, operand),
+                  vadd_f32(operand, vdup_n_f32(0.f)),
+                  vdup_n_f32(__builtin_nanf("")));
+#elif CSIMDX_X86_SSE2
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  __m128 ordered = _mm_cmpord_ps(operand, operand);
+  return _mm_or_ps(_mm_and_ps(ordered, _mm_add_ps(operand, _mm_setzero_ps())),
+                   _mm_andnot_ps(ordered, _mm_set1_ps(__builtin_nanf(""))));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat32x2)(((__typeof__(ordered))(operand + 0.f) & ordered) |
+                      ((__typeof__(ordered))CFloat32x2MakeRepeatingElement(__builtin_nanf("")) & ~ordered));
+#else
+  Float32 element0 = CFloat32x2GetElement(operand, 0);
+  Float32 element1 = CFloat32x2GetElement(operand, 1);
+  return CFloat32x2Make(element0 != element0 ? __builtin_nanf("") : element0 + 0.f,
+                        element1 != element1 ? __builtin_nanf("") : element1 + 0.f);
+#endif
+}
+
 #pragma mark - Minimum & Maximum
 
 /// Performs element-by-element comparison of both storages and returns
@@ -130,6 +249,9 @@ CFloat32x2Minimum(const CFloat32x2 lhs, const CFloat32x2 rhs)
   return vmin_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_min_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
@@ -154,6 +276,9 @@ CFloat32x2Maximum(const CFloat32x2 lhs, const CFloat32x2 rhs)
   return vmax_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_max_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
@@ -164,6 +289,73 @@ CFloat32x2Maximum(const CFloat32x2 lhs, const CFloat32x2 rhs)
 #endif
 }
 
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x2){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1]
+///   }
+FORCE_INLINE(CFloat32x2)
+CFloat32x2IEEEMinimum(const CFloat32x2 lhs, const CFloat32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vmin_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  return _mm_or_ps(_mm_min_ps(lhs, rhs), _mm_min_ps(rhs, lhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  // A NaN element is selected from lhs, or else from rhs as it is not ordered
+  Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
+  Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
+  Float32 lhs1 = CFloat32x2GetElement(lhs, 1);
+  Float32 rhs1 = CFloat32x2GetElement(rhs, 1);
+  return CFloat32x2Make(lhs0 != lhs0 || lhs0 < rhs0 || (lhs0 == rhs0 && __builtin_signbit(lhs0)) ? lhs0 : rhs0,
+                        lhs1 != lhs1 || lhs1 < rhs1 || (lhs1 == rhs1 && __builtin_signbit(lhs1)) ? lhs1 : rhs1);
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x2){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1]
+///   }
+FORCE_INLINE(CFloat32x2)
+CFloat32x2IEEEMaximum(const CFloat32x2 lhs, const CFloat32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vmax_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  return _mm_or_ps(_mm_and_ps(_mm_max_ps(lhs, rhs), _mm_max_ps(rhs, lhs)),
+                   _mm_cmpunord_ps(lhs, rhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  // A NaN element is selected from lhs, or else from rhs as it is not ordered
+  Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
+  Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
+  Float32 lhs1 = CFloat32x2GetElement(lhs, 1);
+  Float32 rhs1 = CFloat32x2GetElement(rhs, 1);
+  return CFloat32x2Make(lhs0 != lhs0 || lhs0 > rhs0 || (lhs0 == rhs0 && !__builtin_signbit(lhs0)) ? lhs0 : rhs0,
+                        lhs1 != lhs1 || lhs1 > rhs1 || (lhs1 == rhs1 && !__builtin_signbit(lhs1)) ? lhs1 : rhs1);
+#endif
+}
+
 #pragma mark - Arithmetics
 
 /// Returns the negated storage (element-wise).
@@ -173,7 +365,10 @@ FORCE_INLINE(CFloat32x2) CFloat32x2Negate(const CFloat32x2 operand)
 #if CSIMDX_ARM_NEON
   return vneg_f32(operand);
 #elif CSIMDX_X86_SSE2
-  return _mm_sub_ps(CFloat32x2MakeZero(), operand);
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm_xor_ps(operand, _mm_set1_ps(-0.f));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
 #else
   return CFloat32x2Make(-CFloat32x2GetElement(operand, 0),
                         -CFloat32x2GetElement(operand, 1));
@@ -191,6 +386,8 @@ FORCE_INLINE(CFloat32x2) CFloat32x2Magnitude(const CFloat32x2 operand)
   union { __m128 operand; __m128i signs; } Signed;
   Signed.signs = _mm_setr_epi32(SIGN_BIT, SIGN_BIT, SIGN_BIT, SIGN_BIT);
   return _mm_and_ps(operand, Signed.operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x2)((__typeof__(operand < operand))operand & 0x7FFFFFFF);
 #else
   return CFloat32x2Make(__builtin_fabsf(CFloat32x2GetElement(operand, 0)),
                         __builtin_fabsf(CFloat32x2GetElement(operand, 1)));
@@ -208,6 +405,8 @@ CFloat32x2Add(const CFloat32x2 lhs, const CFloat32x2 rhs)
   return vadd_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_add_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
@@ -226,6 +425,8 @@ CFloat32x2Subtract(const CFloat32x2 lhs, const CFloat32x2 rhs)
   return vsub_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_sub_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
@@ -246,6 +447,8 @@ CFloat32x2Multiply(const CFloat32x2 lhs, const CFloat32x2 rhs)
   return vmul_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_mul_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
@@ -267,6 +470,8 @@ FORCE_INLINE(CFloat32x2) CFloat32x2Divide(const CFloat32x2 lhs, CFloat32x2 rhs)
   CFloat32x2SetElement(&rhs, 2, 1.f);
   CFloat32x2SetElement(&rhs, 3, 1.f);
   return _mm_div_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
 #else
   Float32 lhs0 = CFloat32x2GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x2GetElement(rhs, 0);
@@ -285,6 +490,8 @@ FORCE_INLINE(CFloat32x2) CFloat32x2SquareRoot(const CFloat32x2 operand)
   return vsqrt_f32(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_sqrt_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x2){ __builtin_sqrtf(operand[0]), __builtin_sqrtf(operand[1]) };
 #else
   return CFloat32x2Make(__builtin_sqrtf(CFloat32x2GetElement(operand, 0)),
                         __builtin_sqrtf(CFloat32x2GetElement(operand, 1)));
@@ -292,4 +499,112 @@ FORCE_INLINE(CFloat32x2) CFloat32x2SquareRoot(const CFloat32x2 operand)
   return result;
 }
 
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return `(CFloat32x2){ lhs[0] * rhs[0] + addend[0], lhs[1] * rhs[1] + addend[1] }`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2MultiplyAdd(const CFloat32x2 lhs,
+                      const CFloat32x2 rhs,
+                      const CFloat32x2 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfma_f32(addend, lhs, rhs);
+#elif CSIMDX_ARM_NEON
+  return vmla_f32(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_ps(lhs, rhs, addend);
+#else
+  return CFloat32x2Add(CFloat32x2Multiply(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return `(CFloat32x2){ lhs[0] + rhs, lhs[1] + rhs }`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2AddElement(const CFloat32x2 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vadd_f32(lhs, vdup_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_add_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  return CFloat32x2Add(lhs, CFloat32x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return `(CFloat32x2){ lhs[0] - rhs, lhs[1] - rhs }`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2SubtractElement(const CFloat32x2 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vsub_f32(lhs, vdup_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_sub_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  return CFloat32x2Subtract(lhs, CFloat32x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return `(CFloat32x2){ lhs[0] * rhs, lhs[1] * rhs }`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2MultiplyElement(const CFloat32x2 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vmul_n_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  return _mm_mul_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  return CFloat32x2Multiply(lhs, CFloat32x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return `(CFloat32x2){ lhs[0] / rhs, lhs[1] / rhs }`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2DivideElement(const CFloat32x2 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vdiv_f32(lhs, vdup_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_div_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  return CFloat32x2Divide(lhs, CFloat32x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return `(CFloat32x2){ lhs[0] * rhs + addend[0], lhs[1] * rhs + addend[1] }`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2MultiplyElementAdd(const CFloat32x2 lhs,
+                             const Float32 rhs,
+                             const CFloat32x2 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfma_n_f32(addend, lhs, rhs);
+#elif CSIMDX_ARM_NEON
+  return vmla_n_f32(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_ps(lhs, _mm_set1_ps(rhs), addend);
+#else
+  return CFloat32x2Add(CFloat32x2MultiplyElement(lhs, rhs), addend);
+#endif
+}
+
 #undef Float32
@@ -24,6 +24,8 @@
 typedef float32x4_t CFloat32x3; // Most significant 32 bits are unused (zero)
 #elif CSIMDX_X86_SSE2
 typedef __m128 CFloat32x3;      // Most significant 32 bits are unused (zero)
+#elif CSIMDX_EXT_VECTOR
+typedef Float32 CFloat32x3 CSIMDX_EXT_VECTOR_TYPE(Float32, 4);  // Most significant 32 bits are unused (zero)
 #else
 typedef struct CFloat32x3_t {
   Float32 rawValue[4];          // Most significant 32 bits are unused (zero)
@@ -39,6 +41,8 @@ CFloat32x3GetElement(const CFloat32x3 storage, const int index)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2
   return ((Float32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   return storage.rawValue[index];
 #endif
@@ -51,11 +55,72 @@ CFloat32x3SetElement(CFloat32x3* storage, const int index, const Float32 value)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2
   ((Float32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   (storage->rawValue)[index] = value;
 #endif
 }
 
+#pragma mark Lanes
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat32x3GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float32)
+CFloat32x3ExtractLane(const CFloat32x3 storage, const int lane)
+{
+#if CSIMDX_ARM_NEON
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vgetq_lane_f32(storage, 0);
+    case 1: return vgetq_lane_f32(storage, 1);
+    case 2: return vgetq_lane_f32(storage, 2);
+  }
+#elif CSIMDX_X86_SSE2
+  // Shuffle into the lowest lane, as `_mm_extract_ps` moves to a general purpose register
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_cvtss_f32(storage);
+    case 1: return _mm_cvtss_f32(_mm_shuffle_ps(storage, storage, _MM_SHUFFLE(1, 1, 1, 1)));
+    case 2: return _mm_cvtss_f32(_mm_movehl_ps(storage, storage));
+  }
+#endif
+  return CFloat32x3GetElement(storage, lane);
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat32x3SetElement`, a compile-time constant `lane` is inserted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3InsertLane(const CFloat32x3 storage, const int lane, const Float32 value)
+{
+#if CSIMDX_ARM_NEON
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vsetq_lane_f32(value, storage, 0);
+    case 1: return vsetq_lane_f32(value, storage, 1);
+    case 2: return vsetq_lane_f32(value, storage, 2);
+  }
+#elif CSIMDX_X86_SSE4_1
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_move_ss(storage, _mm_set_ss(value));
+    case 1: return _mm_insert_ps(storage, _mm_set_ss(value), 0x10);
+    case 2: return _mm_insert_ps(storage, _mm_set_ss(value), 0x20);
+  }
+#elif CSIMDX_X86_SSE2
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_move_ss(storage, _mm_set_ss(value));
+    case 1: return _mm_shuffle_ps(_mm_shuffle_ps(_mm_set_ss(value), storage, _MM_SHUFFLE(0, 0, 0, 0)),
+                                  storage, _MM_SHUFFLE(3, 2, 0, 2));
+    case 2: return _mm_shuffle_ps(storage, _mm_shuffle_ps(_mm_set_ss(value), storage, _MM_SHUFFLE(3, 3, 0, 0)),
+                                  _MM_SHUFFLE(2, 0, 1, 0));
+  }
+#endif
+  CFloat32x3 result = storage;
+  CFloat32x3SetElement(&result, lane, value);
+  return result;
+}
+
 #pragma mark - Initialisation
 
 /// Initializes a storage to given elements. Least- to most-significant bits.
@@ -70,18 +135,16 @@ CFloat32x3Make(Float32 element0, Float32 element1, Float32 element2)
 #endif
 }
 
-/// Loads 2 x Float32 values from unaligned memory.
+/// Loads 3 x Float32 values from unaligned memory, without reading beyond them.
 /// @return `(CFloat32x3){ pointer[0], pointer[1], pointer[2] }`
 FORCE_INLINE(CFloat32x3) CFloat32x3MakeLoad(const Float32* pointer)
 {
 #if CSIMDX_ARM_NEON
-  CFloat32x3 result = vld1q_f32(pointer);
-  CFloat32x3SetElement(&result, 3, 0.f);
-  return result;
+  return vcombine_f32(vld1_f32(pointer), vld1_lane_f32(pointer + 2, vdup_n_f32(0.f), 0));
 #elif CSIMDX_X86_SSE2
-  CFloat32x3 result = _mm_loadu_ps(pointer);
-  CFloat32x3SetElement(&result, 3, 0.f);
-  return result;
+  return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((const double*)pointer)), _mm_load_ss(pointer + 2));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x3){ pointer[0], pointer[1], pointer[2], 0.f };
 #else
   return CFloat32x3Make(pointer[0], pointer[1], pointer[2]);
 #endif
@@ -99,6 +162,8 @@ FORCE_INLINE(CFloat32x3) CFloat32x3MakeRepeatingElement(const Float32 value)
   CFloat32x3 result = _mm_set1_ps(value);
   CFloat32x3SetElement(&result, 3, 0.f);
   return result;
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x3){ value, value, value, 0.f };
 #else
   return (CFloat32x3){ value, value, value, 0.f };
 #endif
@@ -112,11 +177,73 @@ FORCE_INLINE(CFloat32x3) CFloat32x3MakeZero(void)
   return vdupq_n_f32(0.f);
 #elif CSIMDX_X86_SSE2
   return _mm_setzero_ps();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x3){ 0.f };
 #else
   return (CFloat32x3){ 0.f, 0.f, 0.f, 0.f };
 #endif
 }
 
+#pragma mark - Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2]`
+FORCE_INLINE(bool)
+CFloat32x3Equal(const CFloat32x3 lhs, const CFloat32x3 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  // The most significant element is unused, take it as equal
+  return vminvq_u32(vsetq_lane_u32(~0u, vceqq_f32(lhs, rhs), 3)) != 0;
+#elif CSIMDX_ARM_NEON
+  // The most significant element is unused, take it as equal
+  uint32x4_t mask = vsetq_lane_u32(~0u, vceqq_f32(lhs, rhs), 3);
+  uint32x2_t half = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+  return vget_lane_u32(vpmin_u32(half, half), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  // The most significant element is unused, ignore its sign
+  return (_mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs)) & 0x7) == 0x7;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2]) != 0;
+#else
+  return CFloat32x3GetElement(lhs, 0) == CFloat32x3GetElement(rhs, 0)
+      && CFloat32x3GetElement(lhs, 1) == CFloat32x3GetElement(rhs, 1)
+      && CFloat32x3GetElement(lhs, 2) == CFloat32x3GetElement(rhs, 2);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat32x3){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat32x3) CFloat32x3Canonicalize(const CFloat32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return vbslq_f32(vceqq_f32(operand, operand),
+                   vaddq_f32(operand, vdupq_n_f32(0.f)),
+                   vdupq_n_f32(__builtin_nanf("")));
+#elif CSIMDX_X86_SSE2
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  __m128 ordered = _mm_cmpord_ps(operand, operand);
+  return _mm_or_ps(_mm_and_ps(ordered, _mm_add_ps(operand, _mm_setzero_ps())),
+                   _mm_andnot_ps(ordered, _mm_set1_ps(__builtin_nanf(""))));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat32x3)(((__typeof__(ordered))(operand + 0.f) & ordered) |
+                      ((__typeof__(ordered))CFloat32x3MakeRepeatingElement(__builtin_nanf("")) & ~ordered));
+#else
+  Float32 element0 = CFloat32x3GetElement(operand, 0);
+  Float32 element1 = CFloat32x3GetElement(operand, 1);
+  Float32 element2 = CFloat32x3GetElement(operand, 2);
+  return CFloat32x3Make(element0 != element0 ? __builtin_nanf("") : element0 + 0.f,
+                        element1 != element1 ? __builtin_nanf("") : element1 + 0.f,
+                        element2 != element2 ? __builtin_nanf("") : element2 + 0.f);
+#endif
+}
+
 #pragma mark - Minimum & Maximum
 
 /// Performs element-by-element comparison of both storages and returns
@@ -134,6 +261,9 @@ CFloat32x3Minimum(const CFloat32x3 lhs, const CFloat32x3 rhs)
   return vminq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_min_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat32x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
@@ -162,6 +292,9 @@ CFloat32x3Maximum(const CFloat32x3 lhs, const CFloat32x3 rhs)
   return vmaxq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_max_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat32x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
@@ -175,6 +308,81 @@ CFloat32x3Maximum(const CFloat32x3 lhs, const CFloat32x3 rhs)
 #endif
 }
 
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x3){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x3)
+CFloat32x3IEEEMinimum(const CFloat32x3 lhs, const CFloat32x3 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vminq_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  return _mm_or_ps(_mm_min_ps(lhs, rhs), _mm_min_ps(rhs, lhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat32x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  // A NaN element is selected from lhs, or else from rhs as it is not ordered
+  Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
+  Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
+  Float32 lhs1 = CFloat32x3GetElement(lhs, 1);
+  Float32 rhs1 = CFloat32x3GetElement(rhs, 1);
+  Float32 lhs2 = CFloat32x3GetElement(lhs, 2);
+  Float32 rhs2 = CFloat32x3GetElement(rhs, 2);
+  return CFloat32x3Make(lhs0 != lhs0 || lhs0 < rhs0 || (lhs0 == rhs0 && __builtin_signbit(lhs0)) ? lhs0 : rhs0,
+                        lhs1 != lhs1 || lhs1 < rhs1 || (lhs1 == rhs1 && __builtin_signbit(lhs1)) ? lhs1 : rhs1,
+                        lhs2 != lhs2 || lhs2 < rhs2 || (lhs2 == rhs2 && __builtin_signbit(lhs2)) ? lhs2 : rhs2);
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x3){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x3)
+CFloat32x3IEEEMaximum(const CFloat32x3 lhs, const CFloat32x3 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vmaxq_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  return _mm_or_ps(_mm_and_ps(_mm_max_ps(lhs, rhs), _mm_max_ps(rhs, lhs)),
+                   _mm_cmpunord_ps(lhs, rhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat32x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  // A NaN element is selected from lhs, or else from rhs as it is not ordered
+  Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
+  Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
+  Float32 lhs1 = CFloat32x3GetElement(lhs, 1);
+  Float32 rhs1 = CFloat32x3GetElement(rhs, 1);
+  Float32 lhs2 = CFloat32x3GetElement(lhs, 2);
+  Float32 rhs2 = CFloat32x3GetElement(rhs, 2);
+  return CFloat32x3Make(lhs0 != lhs0 || lhs0 > rhs0 || (lhs0 == rhs0 && !__builtin_signbit(lhs0)) ? lhs0 : rhs0,
+                        lhs1 != lhs1 || lhs1 > rhs1 || (lhs1 == rhs1 && !__builtin_signbit(lhs1)) ? lhs1 : rhs1,
+                        lhs2 != lhs2 || lhs2 > rhs2 || (lhs2 == rhs2 && !__builtin_signbit(lhs2)) ? lhs2 : rhs2);
+#endif
+}
+
 #pragma mark - Arithmetics
 
 /// Returns the negated storage (element-wise).
@@ -184,7 +392,10 @@ FORCE_INLINE(CFloat32x3) CFloat32x3Negate(const CFloat32x3 operand)
 #if CSIMDX_ARM_NEON
   return vnegq_f32(operand);
 #elif CSIMDX_X86_SSE2
-  return _mm_sub_ps(CFloat32x3MakeZero(), operand);
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm_xor_ps(operand, _mm_set1_ps(-0.f));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
 #else
   return CFloat32x3Make(-CFloat32x3GetElement(operand, 0),
                         -CFloat32x3GetElement(operand, 1),
@@ -203,6 +414,8 @@ FORCE_INLINE(CFloat32x3) CFloat32x3Magnitude(const CFloat32x3 operand)
   union { __m128 operand; __m128i signs; } Signed;
   Signed.signs = _mm_setr_epi32(SIGN_BIT, SIGN_BIT, SIGN_BIT, SIGN_BIT);
   return _mm_and_ps(operand, Signed.operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x3)((__typeof__(operand < operand))operand & 0x7FFFFFFF);
 #else
   return CFloat32x3Make(__builtin_fabsf(CFloat32x3GetElement(operand, 0)),
                         __builtin_fabsf(CFloat32x3GetElement(operand, 1)),
@@ -221,6 +434,8 @@ CFloat32x3Add(const CFloat32x3 lhs, const CFloat32x3 rhs)
   return vaddq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_add_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
@@ -241,6 +456,8 @@ CFloat32x3Subtract(const CFloat32x3 lhs, const CFloat32x3 rhs)
   return vsubq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_sub_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
@@ -263,6 +480,8 @@ CFloat32x3Multiply(const CFloat32x3 lhs, const CFloat32x3 rhs)
   return vmulq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_mul_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
@@ -288,6 +507,11 @@ FORCE_INLINE(CFloat32x3) CFloat32x3Divide(const CFloat32x3 lhs, CFloat32x3 rhs)
   // to avoid a division by zero, but 1 instead
   CFloat32x3SetElement(&rhs, 3, 1.f);
   return _mm_div_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Prepare the unused bits of the rhs value,
+  // to avoid a division by zero, but 1 instead
+  rhs[3] = 1;
+  return lhs / rhs;
 #else
   Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
   Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
@@ -307,6 +531,8 @@ FORCE_INLINE(CFloat32x3) CFloat32x3SquareRoot(const CFloat32x3 operand)
   return vsqrtq_f32(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_sqrt_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x3){ __builtin_sqrtf(operand[0]), __builtin_sqrtf(operand[1]), __builtin_sqrtf(operand[2]), 0.f };
 #else
   return CFloat32x3Make(__builtin_sqrtf(CFloat32x3GetElement(operand, 0)),
                         __builtin_sqrtf(CFloat32x3GetElement(operand, 1)),
@@ -314,4 +540,251 @@ FORCE_INLINE(CFloat32x3) CFloat32x3SquareRoot(const CFloat32x3 operand)
 #endif
 }
 
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return `(CFloat32x3){ lhs[0] * rhs[0] + addend[0], lhs[1] * rhs[1] + addend[1], lhs[2] * rhs[2] + addend[2] }`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3MultiplyAdd(const CFloat32x3 lhs,
+                      const CFloat32x3 rhs,
+                      const CFloat32x3 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfmaq_f32(addend, lhs, rhs);
+#elif CSIMDX_ARM_NEON
+  return vmlaq_f32(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_ps(lhs, rhs, addend);
+#else
+  return CFloat32x3Add(CFloat32x3Multiply(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return `(CFloat32x3){ lhs[0] + rhs, lhs[1] + rhs, lhs[2] + rhs }`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3AddElement(const CFloat32x3 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vaddq_f32(lhs, vdupq_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_add_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  return CFloat32x3Add(lhs, CFloat32x3MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return `(CFloat32x3){ lhs[0] - rhs, lhs[1] - rhs, lhs[2] - rhs }`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3SubtractElement(const CFloat32x3 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vsubq_f32(lhs, vdupq_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_sub_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  return CFloat32x3Subtract(lhs, CFloat32x3MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return `(CFloat32x3){ lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs }`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3MultiplyElement(const CFloat32x3 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vmulq_n_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  return _mm_mul_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  return CFloat32x3Multiply(lhs, CFloat32x3MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return `(CFloat32x3){ lhs[0] / rhs, lhs[1] / rhs, lhs[2] / rhs }`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3DivideElement(const CFloat32x3 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vdivq_f32(lhs, vdupq_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_div_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  return CFloat32x3Divide(lhs, CFloat32x3MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return `(CFloat32x3){ lhs[0] * rhs + addend[0], lhs[1] * rhs + addend[1], lhs[2] * rhs + addend[2] }`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3MultiplyElementAdd(const CFloat32x3 lhs,
+                             const Float32 rhs,
+                             const CFloat32x3 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfmaq_n_f32(addend, lhs, rhs);
+#elif CSIMDX_ARM_NEON
+  return vmlaq_n_f32(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_ps(lhs, _mm_set1_ps(rhs), addend);
+#else
+  return CFloat32x3Add(CFloat32x3MultiplyElement(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark - Geometry
+
+/// Calculates the dot product of both storages, ignoring the unused lane.
+/// @return `lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2]`
+FORCE_INLINE(Float32) CFloat32x3Dot(const CFloat32x3 lhs, const CFloat32x3 rhs)
+{
+#if CSIMDX_ARM_NEON
+  float32x4_t product = vmulq_f32(lhs, rhs);
+  float32x2_t sum = vpadd_f32(vget_low_f32(product), vget_low_f32(product));
+  return vget_lane_f32(vadd_f32(sum, vget_high_f32(product)), 0);
+#elif CSIMDX_X86_SSE4_1
+  return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0x71));
+#elif CSIMDX_X86_SSE2
+  __m128 product = _mm_mul_ps(lhs, rhs);
+  __m128 sum = _mm_add_ss(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1)));
+  return _mm_cvtss_f32(_mm_add_ss(sum, _mm_movehl_ps(product, product)));
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x3 product = lhs * rhs;
+  return product[0] + product[1] + product[2];
+#else
+  return CFloat32x3GetElement(lhs, 0) * CFloat32x3GetElement(rhs, 0)
+       + CFloat32x3GetElement(lhs, 1) * CFloat32x3GetElement(rhs, 1)
+       + CFloat32x3GetElement(lhs, 2) * CFloat32x3GetElement(rhs, 2);
+#endif
+}
+
+/// Calculates the cross product of both storages.
+/// @return
+///   (CFloat32x3){
+///     lhs[1] * rhs[2] - lhs[2] * rhs[1],
+///     lhs[2] * rhs[0] - lhs[0] * rhs[2],
+///     lhs[0] * rhs[1] - lhs[1] * rhs[0]
+///   }
+FORCE_INLINE(CFloat32x3)
+CFloat32x3Cross(const CFloat32x3 lhs, const CFloat32x3 rhs)
+{
+#if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2 || CSIMDX_EXT_VECTOR
+  // cross(a, b) is computed as (a * b.yzx - a.yzx * b).yzx, which keeps
+  // the unused lane zero as long as it is zero in either of the operands.
+  #if CSIMDX_ARM_NEON || CSIMDX_EXT_VECTOR
+    #define CFloat32x3ShuffleYZX(operand) __builtin_shufflevector(operand, operand, 1, 2, 0, 3)
+  #else
+    #define CFloat32x3ShuffleYZX(operand) _mm_shuffle_ps(operand, operand, _MM_SHUFFLE(3, 0, 2, 1))
+  #endif
+  CFloat32x3 result = CFloat32x3Subtract(
+    CFloat32x3Multiply(lhs, CFloat32x3ShuffleYZX(rhs)),
+    CFloat32x3Multiply(CFloat32x3ShuffleYZX(lhs), rhs)
+  );
+  return CFloat32x3ShuffleYZX(result);
+  #undef CFloat32x3ShuffleYZX
+#else
+  Float32 lhs0 = CFloat32x3GetElement(lhs, 0);
+  Float32 rhs0 = CFloat32x3GetElement(rhs, 0);
+  Float32 lhs1 = CFloat32x3GetElement(lhs, 1);
+  Float32 rhs1 = CFloat32x3GetElement(rhs, 1);
+  Float32 lhs2 = CFloat32x3GetElement(lhs, 2);
+  Float32 rhs2 = CFloat32x3GetElement(rhs, 2);
+  return CFloat32x3Make(lhs1 * rhs2 - lhs2 * rhs1,
+                        lhs2 * rhs0 - lhs0 * rhs2,
+                        lhs0 * rhs1 - lhs1 * rhs0);
+#endif
+}
+
+/// Calculates the squared length of the storage, interpreted as a vector.
+/// @return `operand[0] * operand[0] + operand[1] * operand[1] + operand[2] * operand[2]`
+FORCE_INLINE(Float32) CFloat32x3LengthSquared(const CFloat32x3 operand)
+{
+  return CFloat32x3Dot(operand, operand);
+}
+
+/// Calculates the length of the storage, interpreted as a vector.
+/// @return `sqrt(CFloat32x3LengthSquared(operand))`
+FORCE_INLINE(Float32) CFloat32x3Length(const CFloat32x3 operand)
+{
+  return __builtin_sqrtf(CFloat32x3Dot(operand, operand));
+}
+
+/// Calculates the distance between both storages, interpreted as points.
+/// @return `CFloat32x3Length(lhs - rhs)`
+FORCE_INLINE(Float32)
+CFloat32x3Distance(const CFloat32x3 lhs, const CFloat32x3 rhs)
+{
+  return CFloat32x3Length(CFloat32x3Subtract(lhs, rhs));
+}
+
+/// Scales the storage to unit length. A zero length storage results in
+/// non-finite elements.
+/// @return `operand / CFloat32x3Length(operand)`
+FORCE_INLINE(CFloat32x3) CFloat32x3Normalize(const CFloat32x3 operand)
+{
+  // The reciprocal is broadcast to the used lanes only, keeping the unused lane zero
+  Float32 reciprocal = 1.f / CFloat32x3Length(operand);
+  return CFloat32x3Multiply(operand, CFloat32x3MakeRepeatingElement(reciprocal));
+}
+
+/// Scales the storage to approximately unit length, trading precision
+/// (about 22 bits) for the latency of the square root and the division.
+/// @return `operand * rsqrt(CFloat32x3LengthSquared(operand))`
+FORCE_INLINE(CFloat32x3) CFloat32x3FastNormalize(const CFloat32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  float32x2_t lengthSquared = vdup_n_f32(CFloat32x3Dot(operand, operand));
+  float32x2_t estimate = vrsqrte_f32(lengthSquared);
+  estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(lengthSquared, estimate), estimate));
+  estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(lengthSquared, estimate), estimate));
+  Float32 reciprocal = vget_lane_f32(estimate, 0);
+#elif CSIMDX_X86_SSE2
+  // One Newton-Raphson step: estimate * (1.5 - 0.5 * lengthSquared * estimate^2)
+  __m128 lengthSquared = _mm_set_ss(CFloat32x3Dot(operand, operand));
+  __m128 estimate = _mm_rsqrt_ss(lengthSquared);
+  __m128 halfLengthSquared = _mm_mul_ss(lengthSquared, _mm_set_ss(0.5f));
+  __m128 square = _mm_mul_ss(estimate, estimate);
+  estimate = _mm_mul_ss(estimate, _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(halfLengthSquared, square)));
+  Float32 reciprocal = _mm_cvtss_f32(estimate);
+#else
+  Float32 reciprocal = 1.f / __builtin_sqrtf(CFloat32x3Dot(operand, operand));
+#endif
+  return CFloat32x3Multiply(operand, CFloat32x3MakeRepeatingElement(reciprocal));
+}
+
+/// Reflects the `incident` direction off the surface with given `normal`.
+/// The `normal` is expected to be of unit length.
+/// @return `incident - 2 * CFloat32x3Dot(incident, normal) * normal`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3Reflect(const CFloat32x3 incident, const CFloat32x3 normal)
+{
+  Float32 scale = 2.f * CFloat32x3Dot(incident, normal);
+  return CFloat32x3Subtract(incident, CFloat32x3Multiply(normal, CFloat32x3MakeRepeatingElement(scale)));
+}
+
+/// Projects the storage `operand` onto the direction of `target`.
+/// @return `CFloat32x3Dot(operand, target) / CFloat32x3Dot(target, target) * target`
+FORCE_INLINE(CFloat32x3)
+CFloat32x3Project(const CFloat32x3 operand, const CFloat32x3 target)
+{
+  Float32 scale = CFloat32x3Dot(operand, target) / CFloat32x3Dot(target, target);
+  return CFloat32x3Multiply(target, CFloat32x3MakeRepeatingElement(scale));
+}
+
 #undef Float32
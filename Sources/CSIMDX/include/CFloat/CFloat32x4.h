@@ -24,6 +24,8 @@
 typedef float32x4_t CFloat32x4;
 #elif CSIMDX_X86_SSE2
 typedef __m128 CFloat32x4;
+#elif CSIMDX_EXT_VECTOR
+typedef Float32 CFloat32x4 CSIMDX_EXT_VECTOR_TYPE(Float32, 4);
 #else
 typedef struct CFloat32x4_t {
   CFloat32x2 lo, hi;
@@ -39,6 +41,8 @@ CFloat32x4GetElement(const CFloat32x4 storage, const int index)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_AVX
   return ((Float32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   union { CFloat32x4 storage; Float32 rawValue[4]; } Union;
   Union.storage = storage;
@@ -53,6 +57,8 @@ CFloat32x4SetElement(CFloat32x4* storage, const int index, const Float32 value)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_AVX
   ((Float32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   union { CFloat32x4* storage; Float32* rawValue; } Union;
   Union.storage = storage;
@@ -60,6 +66,71 @@ CFloat32x4SetElement(CFloat32x4* storage, const int index, const Float32 value)
 #endif
 }
 
+#pragma mark Lanes
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat32x4GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float32)
+CFloat32x4ExtractLane(const CFloat32x4 storage, const int lane)
+{
+#if CSIMDX_ARM_NEON
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vgetq_lane_f32(storage, 0);
+    case 1: return vgetq_lane_f32(storage, 1);
+    case 2: return vgetq_lane_f32(storage, 2);
+    case 3: return vgetq_lane_f32(storage, 3);
+  }
+#elif CSIMDX_X86_SSE2
+  // Shuffle into the lowest lane, as `_mm_extract_ps` moves to a general purpose register
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_cvtss_f32(storage);
+    case 1: return _mm_cvtss_f32(_mm_shuffle_ps(storage, storage, _MM_SHUFFLE(1, 1, 1, 1)));
+    case 2: return _mm_cvtss_f32(_mm_movehl_ps(storage, storage));
+    case 3: return _mm_cvtss_f32(_mm_shuffle_ps(storage, storage, _MM_SHUFFLE(3, 3, 3, 3)));
+  }
+#endif
+  return CFloat32x4GetElement(storage, lane);
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat32x4SetElement`, a compile-time constant `lane` is inserted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat32x4)
+CFloat32x4InsertLane(const CFloat32x4 storage, const int lane, const Float32 value)
+{
+#if CSIMDX_ARM_NEON
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vsetq_lane_f32(value, storage, 0);
+    case 1: return vsetq_lane_f32(value, storage, 1);
+    case 2: return vsetq_lane_f32(value, storage, 2);
+    case 3: return vsetq_lane_f32(value, storage, 3);
+  }
+#elif CSIMDX_X86_SSE4_1
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_move_ss(storage, _mm_set_ss(value));
+    case 1: return _mm_insert_ps(storage, _mm_set_ss(value), 0x10);
+    case 2: return _mm_insert_ps(storage, _mm_set_ss(value), 0x20);
+    case 3: return _mm_insert_ps(storage, _mm_set_ss(value), 0x30);
+  }
+#elif CSIMDX_X86_SSE2
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_move_ss(storage, _mm_set_ss(value));
+    case 1: return _mm_shuffle_ps(_mm_shuffle_ps(_mm_set_ss(value), storage, _MM_SHUFFLE(0, 0, 0, 0)),
+                                  storage, _MM_SHUFFLE(3, 2, 0, 2));
+    case 2: return _mm_shuffle_ps(storage, _mm_shuffle_ps(_mm_set_ss(value), storage, _MM_SHUFFLE(3, 3, 0, 0)),
+                                  _MM_SHUFFLE(2, 0, 1, 0));
+    case 3: return _mm_shuffle_ps(storage, _mm_shuffle_ps(_mm_set_ss(value), storage, _MM_SHUFFLE(2, 2, 0, 0)),
+                                  _MM_SHUFFLE(0, 2, 1, 0));
+  }
+#endif
+  CFloat32x4 result = storage;
+  CFloat32x4SetElement(&result, lane, value);
+  return result;
+}
+
 #pragma mark - Initialisation
 
 /// Initializes a storage to given elements. Least- to most-significant bits.
@@ -83,6 +154,10 @@ FORCE_INLINE(CFloat32x4) CFloat32x4MakeLoad(const Float32* pointer)
   return vld1q_f32(pointer);
 #elif CSIMDX_X86_SSE2
   return _mm_loadu_ps(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x4 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
 #else
   return (CFloat32x4) {
     CFloat32x2MakeLoad(pointer),
@@ -99,6 +174,8 @@ FORCE_INLINE(CFloat32x4) CFloat32x4MakeRepeatingElement(const Float32 value)
   return vdupq_n_f32(value);
 #elif CSIMDX_X86_SSE2
   return _mm_set1_ps(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4){ value, value, value, value };
 #else
   return (CFloat32x4) {
     CFloat32x2MakeRepeatingElement(value),
@@ -115,6 +192,8 @@ FORCE_INLINE(CFloat32x4) CFloat32x4MakeZero(void)
   return vdupq_n_f32(0.f);
 #elif CSIMDX_X86_SSE2
   return _mm_setzero_ps();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4){ 0.f };
 #else
   return (CFloat32x4) {
     CFloat32x2MakeRepeatingElement(0.f),
@@ -123,6 +202,56 @@ FORCE_INLINE(CFloat32x4) CFloat32x4MakeZero(void)
 #endif
 }
 
+#pragma mark Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3]`
+FORCE_INLINE(bool)
+CFloat32x4Equal(const CFloat32x4 lhs, const CFloat32x4 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminvq_u32(vceqq_f32(lhs, rhs)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x4_t mask = vceqq_f32(lhs, rhs);
+  uint32x2_t half = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+  return vget_lane_u32(vpmin_u32(half, half), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  return _mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs)) == 0xF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2] & mask[3]) != 0;
+#else
+  return CFloat32x2Equal(lhs.lo, rhs.lo) && CFloat32x2Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat32x4){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat32x4) CFloat32x4Canonicalize(const CFloat32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return vbslq_f32(vceqq_f32(operand, operand),
+                   vaddq_f32(operand, vdupq_n_f32(0.f)),
+                   vdupq_n_f32(__builtin_nanf("")));
+#elif CSIMDX_X86_SSE2
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  __m128 ordered = _mm_cmpord_ps(operand, operand);
+  return _mm_or_ps(_mm_and_ps(ordered, _mm_add_ps(operand, _mm_setzero_ps())),
+                   _mm_andnot_ps(ordered, _mm_set1_ps(__builtin_nanf(""))));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat32x4)(((__typeof__(ordered))(operand + 0.f) & ordered) |
+                      ((__typeof__(ordered))CFloat32x4MakeRepeatingElement(__builtin_nanf("")) & ~ordered));
+#else
+  return (CFloat32x4) { CFloat32x2Canonicalize(operand.lo), CFloat32x2Canonicalize(operand.hi) };
+#endif
+}
+
 #pragma mark Minimum & Maximum
 
 /// Performs element-by-element comparison of both storages and returns
@@ -140,6 +269,9 @@ CFloat32x4Minimum(const CFloat32x4 lhs, const CFloat32x4 rhs)
   return vminq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_min_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   return (CFloat32x4) {
     CFloat32x2Minimum(lhs.lo, rhs.lo),
@@ -163,6 +295,9 @@ CFloat32x4Maximum(const CFloat32x4 lhs, const CFloat32x4 rhs)
   return vmaxq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_max_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   return (CFloat32x4) {
     CFloat32x2Maximum(lhs.lo, rhs.lo),
@@ -171,6 +306,69 @@ CFloat32x4Maximum(const CFloat32x4 lhs, const CFloat32x4 rhs)
 #endif
 }
 
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x4){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4IEEEMinimum(const CFloat32x4 lhs, const CFloat32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vminq_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  return _mm_or_ps(_mm_min_ps(lhs, rhs), _mm_min_ps(rhs, lhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  return (CFloat32x4) {
+    CFloat32x2IEEEMinimum(lhs.lo, rhs.lo),
+    CFloat32x2IEEEMinimum(lhs.hi, rhs.hi)
+  };
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x4){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4IEEEMaximum(const CFloat32x4 lhs, const CFloat32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vmaxq_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  return _mm_or_ps(_mm_and_ps(_mm_max_ps(lhs, rhs), _mm_max_ps(rhs, lhs)),
+                   _mm_cmpunord_ps(lhs, rhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  return (CFloat32x4) {
+    CFloat32x2IEEEMaximum(lhs.lo, rhs.lo),
+    CFloat32x2IEEEMaximum(lhs.hi, rhs.hi)
+  };
+#endif
+}
+
 #pragma mark - Arithmetics
 
 /// Returns the negated storage (element-wise).
@@ -180,7 +378,10 @@ FORCE_INLINE(CFloat32x4) CFloat32x4Negate(const CFloat32x4 operand)
 #if CSIMDX_ARM_NEON
   return vnegq_f32(operand);
 #elif CSIMDX_X86_SSE2
-  return _mm_sub_ps(CFloat32x4MakeZero(), operand);
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm_xor_ps(operand, _mm_set1_ps(-0.f));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
 #else
   return (CFloat32x4) {
     CFloat32x2Negate(operand.lo),
@@ -200,6 +401,8 @@ FORCE_INLINE(CFloat32x4) CFloat32x4Magnitude(const CFloat32x4 operand)
   union { __m128 operand; __m128i signs; } Signed;
   Signed.signs = _mm_setr_epi32(SIGN_BIT, SIGN_BIT, SIGN_BIT, SIGN_BIT);
   return _mm_and_ps(operand, Signed.operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4)((__typeof__(operand < operand))operand & 0x7FFFFFFF);
 #else
   return (CFloat32x4) {
     CFloat32x2Magnitude(operand.lo),
@@ -224,6 +427,8 @@ CFloat32x4Add(const CFloat32x4 lhs, const CFloat32x4 rhs)
   return vaddq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_add_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   return (CFloat32x4) {
     CFloat32x2Add(lhs.lo, rhs.lo),
@@ -246,6 +451,8 @@ CFloat32x4Subtract(const CFloat32x4 lhs, const CFloat32x4 rhs)
   return vsubq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_sub_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   return (CFloat32x4) {
     CFloat32x2Subtract(lhs.lo, rhs.lo),
@@ -270,6 +477,8 @@ CFloat32x4Multiply(const CFloat32x4 lhs, const CFloat32x4 rhs)
   return vmulq_f32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_mul_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   return (CFloat32x4) {
     CFloat32x2Multiply(lhs.lo, rhs.lo),
@@ -300,6 +509,8 @@ CFloat32x4Divide(const CFloat32x4 lhs, const CFloat32x4 rhs)
     CFloat32x4GetElement(lhs, 2) / CFloat32x4GetElement(rhs, 2),
     CFloat32x4GetElement(lhs, 3) / CFloat32x4GetElement(rhs, 3)
   );
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
 #else
   return (CFloat32x4) {
     CFloat32x2Divide(lhs.lo, rhs.lo),
@@ -329,6 +540,8 @@ FORCE_INLINE(CFloat32x4) CFloat32x4SquareRoot(const CFloat32x4 operand)
     __builtin_sqrtf(CFloat32x4GetElement(operand, 2)),
     __builtin_sqrtf(CFloat32x4GetElement(operand, 3))
   );
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4){ __builtin_sqrtf(operand[0]), __builtin_sqrtf(operand[1]), __builtin_sqrtf(operand[2]), __builtin_sqrtf(operand[3]) };
 #else
   return (CFloat32x4) {
     CFloat32x2SquareRoot(operand.lo),
@@ -337,4 +550,160 @@ FORCE_INLINE(CFloat32x4) CFloat32x4SquareRoot(const CFloat32x4 operand)
 #endif
 }
 
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return
+///   (CFloat32x4){
+///     lhs[0] * rhs[0] + addend[0],
+///     lhs[1] * rhs[1] + addend[1],
+///     lhs[2] * rhs[2] + addend[2],
+///     lhs[3] * rhs[3] + addend[3]
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4MultiplyAdd(const CFloat32x4 lhs,
+                      const CFloat32x4 rhs,
+                      const CFloat32x4 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfmaq_f32(addend, lhs, rhs);
+#elif CSIMDX_ARM_NEON
+  return vmlaq_f32(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_ps(lhs, rhs, addend);
+#else
+  return CFloat32x4Add(CFloat32x4Multiply(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return
+///   (CFloat32x4){
+///     lhs[0] + rhs,
+///     lhs[1] + rhs,
+///     lhs[2] + rhs,
+///     lhs[3] + rhs
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4AddElement(const CFloat32x4 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vaddq_f32(lhs, vdupq_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_add_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  return (CFloat32x4) {
+    CFloat32x2AddElement(lhs.lo, rhs),
+    CFloat32x2AddElement(lhs.hi, rhs)
+  };
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return
+///   (CFloat32x4){
+///     lhs[0] - rhs,
+///     lhs[1] - rhs,
+///     lhs[2] - rhs,
+///     lhs[3] - rhs
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4SubtractElement(const CFloat32x4 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vsubq_f32(lhs, vdupq_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_sub_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  return (CFloat32x4) {
+    CFloat32x2SubtractElement(lhs.lo, rhs),
+    CFloat32x2SubtractElement(lhs.hi, rhs)
+  };
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return
+///   (CFloat32x4){
+///     lhs[0] * rhs,
+///     lhs[1] * rhs,
+///     lhs[2] * rhs,
+///     lhs[3] * rhs
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4MultiplyElement(const CFloat32x4 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vmulq_n_f32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  return _mm_mul_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  return (CFloat32x4) {
+    CFloat32x2MultiplyElement(lhs.lo, rhs),
+    CFloat32x2MultiplyElement(lhs.hi, rhs)
+  };
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return
+///   (CFloat32x4){
+///     lhs[0] / rhs,
+///     lhs[1] / rhs,
+///     lhs[2] / rhs,
+///     lhs[3] / rhs
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4DivideElement(const CFloat32x4 lhs, const Float32 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vdivq_f32(lhs, vdupq_n_f32(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_div_ps(lhs, _mm_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  return (CFloat32x4) {
+    CFloat32x2DivideElement(lhs.lo, rhs),
+    CFloat32x2DivideElement(lhs.hi, rhs)
+  };
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return
+///   (CFloat32x4){
+///     lhs[0] * rhs + addend[0],
+///     lhs[1] * rhs + addend[1],
+///     lhs[2] * rhs + addend[2],
+///     lhs[3] * rhs + addend[3]
+///   }
+FORCE_INLINE(CFloat32x4)
+CFloat32x4MultiplyElementAdd(const CFloat32x4 lhs,
+                             const Float32 rhs,
+                             const CFloat32x4 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfmaq_n_f32(addend, lhs, rhs);
+#elif CSIMDX_ARM_NEON
+  return vmlaq_n_f32(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_ps(lhs, _mm_set1_ps(rhs), addend);
+#else
+  return CFloat32x4Add(CFloat32x4MultiplyElement(lhs, rhs), addend);
+#endif
+}
+
 #undef Float32
@@ -0,0 +1,689 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit floating point element
+#define Float32 float
+
+/// The 8 x 32-bit floating point storage, a single register where the target
+/// has 256-bit registers and two 128-bit registers otherwise
+#if CSIMDX_X86_AVX
+typedef __m256 CFloat32x8;
+#elif CSIMDX_EXT_VECTOR
+typedef Float32 CFloat32x8 CSIMDX_EXT_VECTOR_TYPE(Float32, 8);
+#else
+typedef struct CFloat32x8_t {
+  CFloat32x4 lo, hi;
+} CFloat32x8;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(Float32)
+CFloat32x8GetElement(const CFloat32x8 storage, const int index)
+{
+#if CSIMDX_X86_AVX
+  return ((Float32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  union { CFloat32x8 storage; Float32 rawValue[8]; } Union;
+  Union.storage = storage;
+  return Union.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CFloat32x8SetElement(CFloat32x8* storage, const int index, const Float32 value)
+{
+#if CSIMDX_X86_AVX
+  ((Float32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  union { CFloat32x8* storage; Float32* rawValue; } Union;
+  Union.storage = storage;
+  Union.rawValue[index] = value;
+#endif
+}
+
+#pragma mark Lanes
+
+/// Returns the lower half of `storage`.
+/// @return `(CFloat32x4){ storage[0], ..., storage[3] }`
+FORCE_INLINE(CFloat32x4) CFloat32x8GetLow(const CFloat32x8 storage)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_castps256_ps128(storage);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 0, 1, 2, 3);
+#else
+  return storage.lo;
+#endif
+}
+
+/// Returns the upper half of `storage`.
+/// @return `(CFloat32x4){ storage[4], ..., storage[7] }`
+FORCE_INLINE(CFloat32x4) CFloat32x8GetHigh(const CFloat32x8 storage)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_extractf128_ps(storage, 1);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 4, 5, 6, 7);
+#else
+  return storage.hi;
+#endif
+}
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat32x8GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float32)
+CFloat32x8ExtractLane(const CFloat32x8 storage, const int lane)
+{
+#if CSIMDX_X86_AVX
+  if (__builtin_constant_p(lane)) {
+    return lane < 4 ? CFloat32x4ExtractLane(CFloat32x8GetLow(storage), lane)
+                    : CFloat32x4ExtractLane(CFloat32x8GetHigh(storage), lane - 4);
+  }
+  return CFloat32x8GetElement(storage, lane);
+#elif CSIMDX_EXT_VECTOR
+  return storage[lane];
+#else
+  return lane < 4 ? CFloat32x4ExtractLane(storage.lo, lane) : CFloat32x4ExtractLane(storage.hi, lane - 4);
+#endif
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat32x8SetElement`, a compile-time constant `lane` is inserted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8InsertLane(const CFloat32x8 storage, const int lane, const Float32 value)
+{
+#if CSIMDX_X86_AVX
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x01);
+    case 1: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x02);
+    case 2: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x04);
+    case 3: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x08);
+    case 4: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x10);
+    case 5: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x20);
+    case 6: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x40);
+    case 7: return _mm256_blend_ps(storage, _mm256_set1_ps(value), 0x80);
+  }
+  CFloat32x8 result = storage;
+  CFloat32x8SetElement(&result, lane, value);
+  return result;
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x8 result = storage;
+  result[lane] = value;
+  return result;
+#else
+  CFloat32x8 result = storage;
+  if (lane < 4) result.lo = CFloat32x4InsertLane(storage.lo, lane, value);
+  else result.hi = CFloat32x4InsertLane(storage.hi, lane - 4, value);
+  return result;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Initializes a storage to given elements. Least- to most-significant bits.
+/// @return `(CFloat32x8){ element0, element1, ..., element7 }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Make(Float32 element0, Float32 element1, Float32 element2, Float32 element3,
+               Float32 element4, Float32 element5, Float32 element6, Float32 element7)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_setr_ps(element0, element1, element2, element3,
+                        element4, element5, element6, element7);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8){ element0, element1, element2, element3,
+                       element4, element5, element6, element7 };
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Make(element0, element1, element2, element3);
+  result.hi = CFloat32x4Make(element4, element5, element6, element7);
+  return result;
+#endif
+}
+
+/// Loads 8 x Float32 values from unaligned memory.
+/// @return `(CFloat32x8){ pointer[0], pointer[1], ..., pointer[7] }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8MakeLoad(const Float32* pointer)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_loadu_ps(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x8 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4MakeLoad(pointer);
+  result.hi = CFloat32x4MakeLoad(&pointer[4]);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CFloat32x8){ value, value, ..., value }`
+FORCE_INLINE(CFloat32x8) CFloat32x8MakeRepeatingElement(const Float32 value)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_set1_ps(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8){ value, value, value, value, value, value, value, value };
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4MakeRepeatingElement(value);
+  result.hi = CFloat32x4MakeRepeatingElement(value);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0.f).
+/// @return `(CFloat32x8){ 0.f, 0.f, ..., 0.f }`
+FORCE_INLINE(CFloat32x8) CFloat32x8MakeZero(void)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_setzero_ps();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8){ 0.f };
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4MakeZero();
+  result.hi = CFloat32x4MakeZero();
+  return result;
+#endif
+}
+
+#pragma mark - Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && ... && lhs[7] == rhs[7]`
+FORCE_INLINE(bool)
+CFloat32x8Equal(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ)) == 0xFF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2] & mask[3] & mask[4] & mask[5] & mask[6] & mask[7]) != 0;
+#else
+  return CFloat32x4Equal(lhs.lo, rhs.lo) && CFloat32x4Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat32x8){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat32x8) CFloat32x8Canonicalize(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return _mm256_blendv_ps(_mm256_set1_ps(__builtin_nanf("")),
+                          _mm256_add_ps(operand, _mm256_setzero_ps()),
+                          _mm256_cmp_ps(operand, operand, _CMP_ORD_Q));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat32x8)(((__typeof__(ordered))(operand + 0.f) & ordered) |
+                      ((__typeof__(ordered))CFloat32x8MakeRepeatingElement(__builtin_nanf("")) & ~ordered));
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Canonicalize(operand.lo);
+  result.hi = CFloat32x4Canonicalize(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return
+///   (CFloat32x8){
+///     lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Minimum(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_min_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Minimum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4Minimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return
+///   (CFloat32x8){
+///     lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Maximum(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_max_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Maximum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4Maximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x8){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x8)
+CFloat32x8IEEEMinimum(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  return _mm256_or_ps(_mm256_min_ps(lhs, rhs), _mm256_min_ps(rhs, lhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4IEEEMinimum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4IEEEMinimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat32x8){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat32x8)
+CFloat32x8IEEEMaximum(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  return _mm256_or_ps(_mm256_and_ps(_mm256_max_ps(lhs, rhs), _mm256_max_ps(rhs, lhs)),
+                      _mm256_cmp_ps(lhs, rhs, _CMP_UNORD_Q));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4IEEEMaximum(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4IEEEMaximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Returns the negated storage (element-wise).
+/// @return `(CFloat32x8){ -(operand[0]), -(operand[1]), ..., -(operand[7]) }`
+FORCE_INLINE(CFloat32x8) CFloat32x8Negate(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm256_xor_ps(operand, _mm256_set1_ps(-0.f));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Negate(operand.lo);
+  result.hi = CFloat32x4Negate(operand.hi);
+  return result;
+#endif
+}
+
+/// Returns the absolute storage (element-wise).
+/// @return `(CFloat32x8){ abs(operand[0]), abs(operand[1]), ..., abs(operand[7]) }`
+FORCE_INLINE(CFloat32x8) CFloat32x8Magnitude(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_andnot_ps(_mm256_set1_ps(-0.f), operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8)((__typeof__(operand < operand))operand & 0x7FFFFFFF);
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Magnitude(operand.lo);
+  result.hi = CFloat32x4Magnitude(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CFloat32x8){ lhs[0] + rhs[0], ..., lhs[7] + rhs[7] }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Add(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_add_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Add(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4Add(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CFloat32x8){ lhs[0] - rhs[0], ..., lhs[7] - rhs[7] }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Subtract(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_sub_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Subtract(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4Subtract(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise).
+/// @return `(CFloat32x8){ lhs[0] * rhs[0], ..., lhs[7] * rhs[7] }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Multiply(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_mul_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Multiply(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4Multiply(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Divides two storages (element-wise).
+/// @return `(CFloat32x8){ lhs[0] / rhs[0], ..., lhs[7] / rhs[7] }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Divide(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_div_ps(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Divide(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4Divide(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Calculates the square root (element-wise).
+/// @return `(CFloat32x8){ sqrt(operand[0]), ..., sqrt(operand[7]) }`
+FORCE_INLINE(CFloat32x8) CFloat32x8SquareRoot(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_sqrt_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  CFloat32x8 result;
+  for (int index = 0; index < 8; index++) result[index] = __builtin_sqrtf(operand[index]);
+  return result;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4SquareRoot(operand.lo);
+  result.hi = CFloat32x4SquareRoot(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return `(CFloat32x8){ lhs[0] * rhs[0] + addend[0], ..., lhs[7] * rhs[7] + addend[7] }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8MultiplyAdd(const CFloat32x8 lhs,
+                      const CFloat32x8 rhs,
+                      const CFloat32x8 addend)
+{
+#if CSIMDX_X86_FMA
+  return _mm256_fmadd_ps(lhs, rhs, addend);
+#elif CSIMDX_X86_AVX || CSIMDX_EXT_VECTOR
+  return CFloat32x8Add(CFloat32x8Multiply(lhs, rhs), addend);
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4MultiplyAdd(lhs.lo, rhs.lo, addend.lo);
+  result.hi = CFloat32x4MultiplyAdd(lhs.hi, rhs.hi, addend.hi);
+  return result;
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return `(CFloat32x8){ lhs[0] + rhs, ..., lhs[7] + rhs }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8AddElement(const CFloat32x8 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_add_ps(lhs, _mm256_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4AddElement(lhs.lo, rhs);
+  result.hi = CFloat32x4AddElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return `(CFloat32x8){ lhs[0] - rhs, ..., lhs[7] - rhs }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8SubtractElement(const CFloat32x8 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_sub_ps(lhs, _mm256_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4SubtractElement(lhs.lo, rhs);
+  result.hi = CFloat32x4SubtractElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return `(CFloat32x8){ lhs[0] * rhs, ..., lhs[7] * rhs }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8MultiplyElement(const CFloat32x8 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_mul_ps(lhs, _mm256_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4MultiplyElement(lhs.lo, rhs);
+  result.hi = CFloat32x4MultiplyElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return `(CFloat32x8){ lhs[0] / rhs, ..., lhs[7] / rhs }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8DivideElement(const CFloat32x8 lhs, const Float32 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_div_ps(lhs, _mm256_set1_ps(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4DivideElement(lhs.lo, rhs);
+  result.hi = CFloat32x4DivideElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return `(CFloat32x8){ lhs[0] * rhs + addend[0], ..., lhs[7] * rhs + addend[7] }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8MultiplyElementAdd(const CFloat32x8 lhs,
+                             const Float32 rhs,
+                             const CFloat32x8 addend)
+{
+#if CSIMDX_X86_FMA
+  return _mm256_fmadd_ps(lhs, _mm256_set1_ps(rhs), addend);
+#elif CSIMDX_X86_AVX || CSIMDX_EXT_VECTOR
+  return CFloat32x8Add(CFloat32x8MultiplyElement(lhs, rhs), addend);
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4MultiplyElementAdd(lhs.lo, rhs, addend.lo);
+  result.hi = CFloat32x4MultiplyElementAdd(lhs.hi, rhs, addend.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Reduction
+
+// All reductions combine the elements in the same order on every target, by
+// folding the upper half of the storage onto the lower one until a single
+// element is left, so that their results do not depend on the target.
+
+/// Returns the sum of all elements, adding the upper half onto the lower
+/// half until a single element is left.
+/// @return `((operand[0] + operand[4]) + (operand[2] + operand[6])) + ((operand[1] + operand[5]) + (operand[3] + operand[7]))`
+FORCE_INLINE(Float32) CFloat32x8ReduceAdd(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  __m128 half = _mm_add_ps(CFloat32x8GetLow(operand), CFloat32x8GetHigh(operand));
+  half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+  return _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1))));
+#elif CSIMDX_EXT_VECTOR
+  return ((operand[0] + operand[4]) + (operand[2] + operand[6])) +
+         ((operand[1] + operand[5]) + (operand[3] + operand[7]));
+#else
+  CFloat32x4 half = CFloat32x4Add(operand.lo, operand.hi);
+  return (CFloat32x4GetElement(half, 0) + CFloat32x4GetElement(half, 2)) +
+         (CFloat32x4GetElement(half, 1) + CFloat32x4GetElement(half, 3));
+#endif
+}
+
+/// Returns the least of all elements, folding the upper half onto the lower
+/// half with `CFloat32x8Minimum` until a single element is left. Whether a NaN
+/// element is returned thus depends on its lane.
+/// @return `min(min(min(operand[0], operand[4]), min(operand[2], operand[6])), min(min(operand[1], operand[5]), min(operand[3], operand[7])))`
+FORCE_INLINE(Float32) CFloat32x8ReduceMinimum(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  __m128 half = _mm_min_ps(CFloat32x8GetLow(operand), CFloat32x8GetHigh(operand));
+  half = _mm_min_ps(half, _mm_movehl_ps(half, half));
+  return _mm_cvtss_f32(_mm_min_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1))));
+#else
+  #if CSIMDX_EXT_VECTOR
+  Float32 half0 = operand[0] < operand[4] ? operand[0] : operand[4];
+  Float32 half1 = operand[1] < operand[5] ? operand[1] : operand[5];
+  Float32 half2 = operand[2] < operand[6] ? operand[2] : operand[6];
+  Float32 half3 = operand[3] < operand[7] ? operand[3] : operand[7];
+  #else
+  CFloat32x4 half = CFloat32x4Minimum(operand.lo, operand.hi);
+  Float32 half0 = CFloat32x4GetElement(half, 0), half1 = CFloat32x4GetElement(half, 1);
+  Float32 half2 = CFloat32x4GetElement(half, 2), half3 = CFloat32x4GetElement(half, 3);
+  #endif
+  Float32 lhs = half0 < half2 ? half0 : half2;
+  Float32 rhs = half1 < half3 ? half1 : half3;
+  return lhs < rhs ? lhs : rhs;
+#endif
+}
+
+/// Returns the greatest of all elements, folding the upper half onto the lower
+/// half with `CFloat32x8Maximum` until a single element is left. Whether a NaN
+/// element is returned thus depends on its lane.
+/// @return `max(max(max(operand[0], operand[4]), max(operand[2], operand[6])), max(max(operand[1], operand[5]), max(operand[3], operand[7])))`
+FORCE_INLINE(Float32) CFloat32x8ReduceMaximum(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  __m128 half = _mm_max_ps(CFloat32x8GetLow(operand), CFloat32x8GetHigh(operand));
+  half = _mm_max_ps(half, _mm_movehl_ps(half, half));
+  return _mm_cvtss_f32(_mm_max_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1))));
+#else
+  #if CSIMDX_EXT_VECTOR
+  Float32 half0 = operand[0] > operand[4] ? operand[0] : operand[4];
+  Float32 half1 = operand[1] > operand[5] ? operand[1] : operand[5];
+  Float32 half2 = operand[2] > operand[6] ? operand[2] : operand[6];
+  Float32 half3 = operand[3] > operand[7] ? operand[3] : operand[7];
+  #else
+  CFloat32x4 half = CFloat32x4Maximum(operand.lo, operand.hi);
+  Float32 half0 = CFloat32x4GetElement(half, 0), half1 = CFloat32x4GetElement(half, 1);
+  Float32 half2 = CFloat32x4GetElement(half, 2), half3 = CFloat32x4GetElement(half, 3);
+  #endif
+  Float32 lhs = half0 > half2 ? half0 : half2;
+  Float32 rhs = half1 > half3 ? half1 : half3;
+  return lhs > rhs ? lhs : rhs;
+#endif
+}
+
+#undef Float32
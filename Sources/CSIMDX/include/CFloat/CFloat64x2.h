@@ -24,6 +24,8 @@
 typedef float64x2_t CFloat64x2;
 #elif CSIMDX_X86_SSE2
 typedef __m128d CFloat64x2;
+#elif CSIMDX_EXT_VECTOR
+typedef Float64 CFloat64x2 CSIMDX_EXT_VECTOR_TYPE(Float64, 2);
 #else
 typedef union CFloat64x2_t {
   Float64 rawValue[2];
@@ -39,6 +41,8 @@ CFloat64x2GetElement(const CFloat64x2 storage, const int index)
 {
 #if CSIMDX_ARM_NEON_AARCH64 || CSIMDX_X86_SSE2
   return ((Float64*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   return storage.rawValue[index];
 #endif
@@ -51,11 +55,59 @@ CFloat64x2SetElement(CFloat64x2* storage, const int index, const Float64 value)
 {
 #if CSIMDX_ARM_NEON_AARCH64 || CSIMDX_X86_SSE2
   ((Float64*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   (storage->rawValue)[index] = value;
 #endif
 }
 
+#pragma mark Lanes
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat64x2GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float64)
+CFloat64x2ExtractLane(const CFloat64x2 storage, const int lane)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vgetq_lane_f64(storage, 0);
+    case 1: return vgetq_lane_f64(storage, 1);
+  }
+#elif CSIMDX_X86_SSE2
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_cvtsd_f64(storage);
+    case 1: return _mm_cvtsd_f64(_mm_unpackhi_pd(storage, storage));
+  }
+#endif
+  return CFloat64x2GetElement(storage, lane);
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat64x2SetElement`, a compile-time constant `lane` is inserted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat64x2)
+CFloat64x2InsertLane(const CFloat64x2 storage, const int lane, const Float64 value)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return vsetq_lane_f64(value, storage, 0);
+    case 1: return vsetq_lane_f64(value, storage, 1);
+  }
+#elif CSIMDX_X86_SSE2
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_move_sd(storage, _mm_set_sd(value));
+    case 1: return _mm_unpacklo_pd(storage, _mm_set_sd(value));
+  }
+#endif
+  CFloat64x2 result = storage;
+  CFloat64x2SetElement(&result, lane, value);
+  return result;
+}
+
 #pragma mark - Initialisation
 
 /// Initializes a storage to given elements. Least- to most-significant bits.
@@ -77,6 +129,10 @@ FORCE_INLINE(CFloat64x2) CFloat64x2MakeLoad(const Float64* pointer)
   return vld1q_f64(pointer);
 #elif CSIMDX_X86_SSE2
   return _mm_loadu_pd(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x2 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
 #else
   return (CFloat64x2){ pointer[0], pointer[1] };
 #endif
@@ -91,6 +147,8 @@ FORCE_INLINE(CFloat64x2) CFloat64x2MakeRepeatingElement(const Float64 value)
   return vdupq_n_f64(value);
 #elif CSIMDX_X86_SSE2
   return _mm_set1_pd(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x2){ value, value };
 #else
   return (CFloat64x2){ value, value };
 #endif
@@ -104,11 +162,63 @@ FORCE_INLINE(CFloat64x2) CFloat64x2MakeZero(void)
   return vdupq_n_f64(0.0);
 #elif CSIMDX_X86_SSE2
   return _mm_setzero_pd();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x2){ 0.0 };
 #else
   return (CFloat64x2){ 0.0, 0.0 };
 #endif
 }
 
+#pragma mark Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1]`
+FORCE_INLINE(bool)
+CFloat64x2Equal(const CFloat64x2 lhs, const CFloat64x2 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminvq_u32(vreinterpretq_u32_u64(vceqq_f64(lhs, rhs))) != 0;
+#elif CSIMDX_X86_SSE2
+  return _mm_movemask_pd(_mm_cmpeq_pd(lhs, rhs)) == 0x3;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1]) != 0;
+#else
+  return CFloat64x2GetElement(lhs, 0) == CFloat64x2GetElement(rhs, 0)
+      && CFloat64x2GetElement(lhs, 1) == CFloat64x2GetElement(rhs, 1);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat64x2){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat64x2) CFloat64x2Canonicalize(const CFloat64x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return vbslq_f64(vceqq_f64(operand, operand),
+                   vaddq_f64(operand, vdupq_n_f64(0.0)),
+                   vdupq_n_f64(__builtin_nan("")));
+#elif CSIMDX_X86_SSE2
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  __m128d ordered = _mm_cmpord_pd(operand, operand);
+  return _mm_or_pd(_mm_and_pd(ordered, _mm_add_pd(operand, _mm_setzero_pd())),
+                   _mm_andnot_pd(ordered, _mm_set1_pd(__builtin_nan(""))));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat64x2)(((__typeof__(ordered))(operand + 0.0) & ordered) |
+                      ((__typeof__(ordered))CFloat64x2MakeRepeatingElement(__builtin_nan("")) & ~ordered));
+#else
+  Float64 element0 = CFloat64x2GetElement(operand, 0);
+  Float64 element1 = CFloat64x2GetElement(operand, 1);
+  return CFloat64x2Make(element0 != element0 ? __builtin_nan("") : element0 + 0.0,
+                        element1 != element1 ? __builtin_nan("") : element1 + 0.0);
+#endif
+}
+
 #pragma mark Minimum & Maximum
 
 /// Performs element-by-element comparison of both storages and
@@ -125,6 +235,9 @@ CFloat64x2Minimum(const CFloat64x2 lhs, const CFloat64x2 rhs)
   return vminq_f64(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_min_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat64x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
   Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
@@ -150,6 +263,9 @@ CFloat64x2Maximum(const CFloat64x2 lhs, const CFloat64x2 rhs)
   return vmaxq_f64(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_max_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat64x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
   Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
@@ -160,6 +276,73 @@ CFloat64x2Maximum(const CFloat64x2 lhs, const CFloat64x2 rhs)
 #endif
 }
 
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x2){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1]
+///   }
+FORCE_INLINE(CFloat64x2)
+CFloat64x2IEEEMinimum(const CFloat64x2 lhs, const CFloat64x2 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vminq_f64(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  return _mm_or_pd(_mm_min_pd(lhs, rhs), _mm_min_pd(rhs, lhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat64x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  // A NaN element is selected from lhs, or else from rhs as it is not ordered
+  Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
+  Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
+  Float64 lhs1 = CFloat64x2GetElement(lhs, 1);
+  Float64 rhs1 = CFloat64x2GetElement(rhs, 1);
+  return CFloat64x2Make(lhs0 != lhs0 || lhs0 < rhs0 || (lhs0 == rhs0 && __builtin_signbit(lhs0)) ? lhs0 : rhs0,
+                        lhs1 != lhs1 || lhs1 < rhs1 || (lhs1 == rhs1 && __builtin_signbit(lhs1)) ? lhs1 : rhs1);
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x2){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1]
+///   }
+FORCE_INLINE(CFloat64x2)
+CFloat64x2IEEEMaximum(const CFloat64x2 lhs, const CFloat64x2 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  // The instruction itself propagates NaN and orders -0.0 before +0.0
+  return vmaxq_f64(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  return _mm_or_pd(_mm_and_pd(_mm_max_pd(lhs, rhs), _mm_max_pd(rhs, lhs)),
+                   _mm_cmpunord_pd(lhs, rhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat64x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  // A NaN element is selected from lhs, or else from rhs as it is not ordered
+  Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
+  Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
+  Float64 lhs1 = CFloat64x2GetElement(lhs, 1);
+  Float64 rhs1 = CFloat64x2GetElement(rhs, 1);
+  return CFloat64x2Make(lhs0 != lhs0 || lhs0 > rhs0 || (lhs0 == rhs0 && !__builtin_signbit(lhs0)) ? lhs0 : rhs0,
+                        lhs1 != lhs1 || lhs1 > rhs1 || (lhs1 == rhs1 && !__builtin_signbit(lhs1)) ? lhs1 : rhs1);
+#endif
+}
+
 #pragma mark - Arithmetics
 
 /// Returns the negated storage (element-wise).
@@ -170,7 +353,10 @@ CFloat64x2Negate(const CFloat64x2 operand)
 #if CSIMDX_ARM_NEON_AARCH64
   return vnegq_f64(operand);
 #elif CSIMDX_X86_SSE2
-  return _mm_sub_pd(CFloat64x2MakeZero(), operand);
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm_xor_pd(operand, _mm_set1_pd(-0.0));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
 #else
   return CFloat64x2Make(-CFloat64x2GetElement(operand, 0),
                         -CFloat64x2GetElement(operand, 1));
@@ -189,6 +375,8 @@ CFloat64x2Magnitude(const CFloat64x2 operand)
   union { __m128d operand; __m128i signs; } Signed;
   Signed.signs = _mm_setr_epi64(SIGN_BIT, SIGN_BIT);
   return _mm_and_ps(operand, Signed.operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x2)((__typeof__(operand < operand))operand & 0x7FFFFFFFFFFFFFFF);
 #else
   return CFloat64x2Make(__builtin_fabs(CFloat64x2GetElement(operand, 0)),
                         __builtin_fabs(CFloat64x2GetElement(operand, 1)));
@@ -206,6 +394,8 @@ CFloat64x2Add(const CFloat64x2 lhs, const CFloat64x2 rhs)
   return vaddq_f64(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_add_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
   Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
@@ -224,6 +414,8 @@ CFloat64x2Subtract(const CFloat64x2 lhs, const CFloat64x2 rhs)
   return vsubq_f64(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_sub_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
   Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
@@ -244,6 +436,8 @@ CFloat64x2Multiply(const CFloat64x2 lhs, const CFloat64x2 rhs)
   return vmulq_f64(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_mul_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
   Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
@@ -262,6 +456,8 @@ CFloat64x2Divide(const CFloat64x2 lhs, const CFloat64x2 rhs)
   return vdivq_f64(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_div_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
 #else
   Float64 lhs0 = CFloat64x2GetElement(lhs, 0);
   Float64 rhs0 = CFloat64x2GetElement(rhs, 0);
@@ -279,10 +475,116 @@ FORCE_INLINE(CFloat64x2) CFloat64x2SquareRoot(const CFloat64x2 operand)
   return vsqrtq_f64(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_sqrt_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x2){ __builtin_sqrt(operand[0]), __builtin_sqrt(operand[1]) };
 #else
   return CFloat64x2Make(__builtin_sqrt(CFloat64x2GetElement(operand, 0)),
                         __builtin_sqrt(CFloat64x2GetElement(operand, 1)));
 #endif
 }
 
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return `(CFloat64x2){ lhs[0] * rhs[0] + addend[0], lhs[1] * rhs[1] + addend[1] }`
+FORCE_INLINE(CFloat64x2)
+CFloat64x2MultiplyAdd(const CFloat64x2 lhs,
+                      const CFloat64x2 rhs,
+                      const CFloat64x2 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfmaq_f64(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_pd(lhs, rhs, addend);
+#else
+  return CFloat64x2Add(CFloat64x2Multiply(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return `(CFloat64x2){ lhs[0] + rhs, lhs[1] + rhs }`
+FORCE_INLINE(CFloat64x2)
+CFloat64x2AddElement(const CFloat64x2 lhs, const Float64 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vaddq_f64(lhs, vdupq_n_f64(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_add_pd(lhs, _mm_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  return CFloat64x2Add(lhs, CFloat64x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return `(CFloat64x2){ lhs[0] - rhs, lhs[1] - rhs }`
+FORCE_INLINE(CFloat64x2)
+CFloat64x2SubtractElement(const CFloat64x2 lhs, const Float64 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vsubq_f64(lhs, vdupq_n_f64(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_sub_pd(lhs, _mm_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  return CFloat64x2Subtract(lhs, CFloat64x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return `(CFloat64x2){ lhs[0] * rhs, lhs[1] * rhs }`
+FORCE_INLINE(CFloat64x2)
+CFloat64x2MultiplyElement(const CFloat64x2 lhs, const Float64 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vmulq_n_f64(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  return _mm_mul_pd(lhs, _mm_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  return CFloat64x2Multiply(lhs, CFloat64x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return `(CFloat64x2){ lhs[0] / rhs, lhs[1] / rhs }`
+FORCE_INLINE(CFloat64x2)
+CFloat64x2DivideElement(const CFloat64x2 lhs, const Float64 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vdivq_f64(lhs, vdupq_n_f64(rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_div_pd(lhs, _mm_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  return CFloat64x2Divide(lhs, CFloat64x2MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return `(CFloat64x2){ lhs[0] * rhs + addend[0], lhs[1] * rhs + addend[1] }`
+FORCE_INLINE(CFloat64x2)
+CFloat64x2MultiplyElementAdd(const CFloat64x2 lhs,
+                             const Float64 rhs,
+                             const CFloat64x2 addend)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vfmaq_n_f64(addend, lhs, rhs);
+#elif CSIMDX_X86_FMA
+  return _mm_fmadd_pd(lhs, _mm_set1_pd(rhs), addend);
+#else
+  return CFloat64x2Add(CFloat64x2MultiplyElement(lhs, rhs), addend);
+#endif
+}
+
 #undef Float64
@@ -25,6 +25,8 @@
 /// with its most significant 64 bits unused (zero) for all types.
 #if CSIMDX_X86_AVX
 typedef __m256d CFloat64x3;
+#elif CSIMDX_EXT_VECTOR
+typedef Float64 CFloat64x3 CSIMDX_EXT_VECTOR_TYPE(Float64, 4);  // Most significant 64 bits are unused (zero)
 #else
 typedef struct CFloat64x3_t {
   CFloat64x2 lo, hi;
@@ -40,6 +42,8 @@ CFloat64x3GetElement(const CFloat64x3 storage, const int index)
 {
 #if CSIMDX_X86_AVX
   return ((Float64*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   union { CFloat64x3 storage; Float64 rawValue[4]; } Union;
   Union.storage = storage;
@@ -54,6 +58,8 @@ CFloat64x3SetElement(CFloat64x3* storage, const int index, const Float64 value)
 {
 #if CSIMDX_X86_AVX
   ((Float64*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   union { CFloat64x3* storage; Float64* rawValue; } Union;
   Union.storage = storage;
@@ -61,6 +67,57 @@ CFloat64x3SetElement(CFloat64x3* storage, const int index, const Float64 value)
 #endif
 }
 
+#pragma mark Lanes
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat64x3GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float64)
+CFloat64x3ExtractLane(const CFloat64x3 storage, const int lane)
+{
+#if CSIMDX_X86_AVX
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_cvtsd_f64(_mm256_castpd256_pd128(storage));
+    case 1: return _mm_cvtsd_f64(_mm_unpackhi_pd(_mm256_castpd256_pd128(storage), _mm256_castpd256_pd128(storage)));
+    case 2: return _mm_cvtsd_f64(_mm256_extractf128_pd(storage, 1));
+  }
+  return CFloat64x3GetElement(storage, lane);
+#elif CSIMDX_EXT_VECTOR
+  return storage[lane];
+#else
+  return lane < 2 ? CFloat64x2ExtractLane(storage.lo, lane) : CFloat64x2ExtractLane(storage.hi, lane - 2);
+#endif
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat64x3SetElement`, a compile-time constant `lane` is inserted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3InsertLane(const CFloat64x3 storage, const int lane, const Float64 value)
+{
+#if CSIMDX_X86_AVX
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm256_blend_pd(storage, _mm256_set1_pd(value), 0x1);
+    case 1: return _mm256_blend_pd(storage, _mm256_set1_pd(value), 0x2);
+    case 2: return _mm256_blend_pd(storage, _mm256_set1_pd(value), 0x4);
+  }
+  CFloat64x3 result = storage;
+  CFloat64x3SetElement(&result, lane, value);
+  return result;
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x3 result = storage;
+  result[lane] = value;
+  return result;
+#else
+  CFloat64x3 result = storage;
+  if (lane < 2) result.lo = CFloat64x2InsertLane(storage.lo, lane, value);
+  else result.hi = CFloat64x2InsertLane(storage.hi, lane - 2, value);
+  return result;
+#endif
+}
+
 #pragma mark - Initialisation
 
 /// Initializes a storage to given elements. Least- to most-significant bits.
@@ -70,6 +127,8 @@ CFloat64x3Make(Float64 element0, Float64 element1, Float64 element2)
 {
 #if CSIMDX_X86_AVX
   return _mm256_setr_pd(element0, element1, element2, 0.0);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x3){ element0, element1, element2, 0.0 };
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Make(element0, element1);
@@ -78,15 +137,16 @@ CFloat64x3Make(Float64 element0, Float64 element1, Float64 element2)
 #endif
 }
 
-/// Loads 2 x Float32 values from unaligned memory.
+/// Loads 3 x Float64 values from unaligned memory, without reading beyond them.
 /// @return `(CFloat64x3){ pointer[0], pointer[1], pointer[2] }`
 FORCE_INLINE(CFloat64x3)
-CFloat64x3MakeLoad(Float64* pointer)
+CFloat64x3MakeLoad(const Float64* pointer)
 {
   CFloat64x3 result;
 #if CSIMDX_X86_AVX
-  result = _mm256_loadu_pd(pointer);
-  CFloat64x3SetElement(&result, 3, 0.0);
+  result = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(pointer)), _mm_load_sd(pointer + 2), 1);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x3){ pointer[0], pointer[1], pointer[2], 0.0 };
 #else
   result.lo = CFloat64x2MakeLoad(pointer);
   result.hi = CFloat64x2Make(pointer[2], 0.0);
@@ -102,6 +162,8 @@ FORCE_INLINE(CFloat64x3) CFloat64x3MakeRepeatingElement(const Float64 value)
 #if CSIMDX_X86_AVX
   result = _mm256_set1_pd(value);
   CFloat64x3SetElement(&result, 3, 0.0);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x3){ value, value, value, 0.0 };
 #else
   result.lo = CFloat64x2MakeRepeatingElement(value);
   result.hi = CFloat64x2Make(value, 0.0);
@@ -115,6 +177,8 @@ FORCE_INLINE(CFloat64x3) CFloat64x3MakeZero(void)
 {
 #if CSIMDX_X86_AVX
   return _mm256_setzero_pd();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x3){ 0.0 };
 #else
   const CFloat64x2 zero = CFloat64x2MakeZero();
   CFloat64x3 result;
@@ -124,6 +188,51 @@ FORCE_INLINE(CFloat64x3) CFloat64x3MakeZero(void)
 #endif
 }
 
+#pragma mark - Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2]`
+FORCE_INLINE(bool)
+CFloat64x3Equal(const CFloat64x3 lhs, const CFloat64x3 rhs)
+{
+#if CSIMDX_X86_AVX
+  // The most significant element is unused, ignore its sign
+  return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)) & 0x7) == 0x7;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2]) != 0;
+#else
+  // Compare only the lower of the high values, the last lane is unused.
+  return CFloat64x2Equal(lhs.lo, rhs.lo)
+      && CFloat64x2GetElement(lhs.hi, 0) == CFloat64x2GetElement(rhs.hi, 0);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat64x3){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat64x3) CFloat64x3Canonicalize(const CFloat64x3 operand)
+{
+#if CSIMDX_X86_AVX
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return _mm256_blendv_pd(_mm256_set1_pd(__builtin_nan("")),
+                          _mm256_add_pd(operand, _mm256_setzero_pd()),
+                          _mm256_cmp_pd(operand, operand, _CMP_ORD_Q));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat64x3)(((__typeof__(ordered))(operand + 0.0) & ordered) |
+                      ((__typeof__(ordered))CFloat64x3MakeRepeatingElement(__builtin_nan("")) & ~ordered));
+#else
+  CFloat64x3 result;
+  result.lo = CFloat64x2Canonicalize(operand.lo);
+  result.hi = CFloat64x2Canonicalize(operand.hi);
+  return result;
+#endif
+}
+
 #pragma mark - Minimum & Maximum
 
 /// Performs element-by-element comparison of both storages and returns
@@ -139,6 +248,9 @@ CFloat64x3Minimum(const CFloat64x3 lhs, const CFloat64x3 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_min_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat64x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Minimum(lhs.lo, rhs.lo);
@@ -160,6 +272,9 @@ CFloat64x3Maximum(const CFloat64x3 lhs, const CFloat64x3 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_max_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat64x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Maximum(lhs.lo, rhs.lo);
@@ -168,6 +283,63 @@ CFloat64x3Maximum(const CFloat64x3 lhs, const CFloat64x3 rhs)
 #endif
 }
 
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x3){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x3)
+CFloat64x3IEEEMinimum(const CFloat64x3 lhs, const CFloat64x3 rhs)
+{
+#if CSIMDX_X86_AVX
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  return _mm256_or_pd(_mm256_min_pd(lhs, rhs), _mm256_min_pd(rhs, lhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat64x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x3 result;
+  result.lo = CFloat64x2IEEEMinimum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x2IEEEMinimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x3){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x3)
+CFloat64x3IEEEMaximum(const CFloat64x3 lhs, const CFloat64x3 rhs)
+{
+#if CSIMDX_X86_AVX
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  return _mm256_or_pd(_mm256_and_pd(_mm256_max_pd(lhs, rhs), _mm256_max_pd(rhs, lhs)),
+                      _mm256_cmp_pd(lhs, rhs, _CMP_UNORD_Q));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat64x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x3 result;
+  result.lo = CFloat64x2IEEEMaximum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x2IEEEMaximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
 #pragma mark - Arithmetics
 
 /// Returns the negated storage (element-wise).
@@ -175,7 +347,10 @@ CFloat64x3Maximum(const CFloat64x3 lhs, const CFloat64x3 rhs)
 FORCE_INLINE(CFloat64x3) CFloat64x3Negate(const CFloat64x3 operand)
 {
 #if CSIMDX_X86_AVX
-  return _mm256_sub_pd(CFloat64x3MakeZero(), operand);
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm256_xor_pd(operand, _mm256_set1_pd(-0.0));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Negate(operand.lo);
@@ -194,6 +369,8 @@ FORCE_INLINE(CFloat64x3) CFloat64x3Magnitude(const CFloat64x3 operand)
   union { __m256d operand; __m256i signs; } Signed;
   Signed.signs = _mm256_setr_epi64x(SIGN_BIT, SIGN_BIT, SIGN_BIT, SIGN_BIT);
   return _mm256_and_pd(operand, Signed.operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x3)((__typeof__(operand < operand))operand & 0x7FFFFFFFFFFFFFFF);
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Magnitude(operand.lo);
@@ -211,6 +388,8 @@ CFloat64x3Add(const CFloat64x3 lhs, const CFloat64x3 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_add_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Add(lhs.lo, rhs.lo);
@@ -226,6 +405,8 @@ CFloat64x3Subtract(const CFloat64x3 lhs, const CFloat64x3 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_sub_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Subtract(lhs.lo, rhs.lo);
@@ -243,6 +424,8 @@ CFloat64x3Multiply(const CFloat64x3 lhs, const CFloat64x3 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_mul_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Multiply(lhs.lo, rhs.lo);
@@ -260,6 +443,11 @@ FORCE_INLINE(CFloat64x3) CFloat64x3Divide(const CFloat64x3 lhs, CFloat64x3 rhs)
   // to avoid a division by zero, but 1 instead
   CFloat64x3SetElement(&rhs, 3, 1.0);
   return _mm256_div_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Prepare the unused bits of the rhs value,
+  // to avoid a division by zero, but 1 instead
+  rhs[3] = 1;
+  return lhs / rhs;
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2Divide(lhs.lo, rhs.lo);
@@ -274,6 +462,8 @@ FORCE_INLINE(CFloat64x3) CFloat64x3SquareRoot(const CFloat64x3 operand)
 {
 #if CSIMDX_X86_AVX
   return _mm256_sqrt_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x3){ __builtin_sqrt(operand[0]), __builtin_sqrt(operand[1]), __builtin_sqrt(operand[2]), 0.0 };
 #else
   CFloat64x3 result;
   result.lo = CFloat64x2SquareRoot(operand.lo);
@@ -282,4 +472,260 @@ FORCE_INLINE(CFloat64x3) CFloat64x3SquareRoot(const CFloat64x3 operand)
 #endif
 }
 
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return `(CFloat64x3){ lhs[0] * rhs[0] + addend[0], lhs[1] * rhs[1] + addend[1], lhs[2] * rhs[2] + addend[2] }`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3MultiplyAdd(const CFloat64x3 lhs,
+                      const CFloat64x3 rhs,
+                      const CFloat64x3 addend)
+{
+#if CSIMDX_X86_FMA
+  return _mm256_fmadd_pd(lhs, rhs, addend);
+#else
+  return CFloat64x3Add(CFloat64x3Multiply(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return `(CFloat64x3){ lhs[0] + rhs, lhs[1] + rhs, lhs[2] + rhs }`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3AddElement(const CFloat64x3 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_add_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat64x3 result;
+  result.lo = CFloat64x2AddElement(lhs.lo, rhs);
+  result.hi = CFloat64x2AddElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return `(CFloat64x3){ lhs[0] - rhs, lhs[1] - rhs, lhs[2] - rhs }`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3SubtractElement(const CFloat64x3 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_sub_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat64x3 result;
+  result.lo = CFloat64x2SubtractElement(lhs.lo, rhs);
+  result.hi = CFloat64x2SubtractElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return `(CFloat64x3){ lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs }`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3MultiplyElement(const CFloat64x3 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_mul_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat64x3 result;
+  result.lo = CFloat64x2MultiplyElement(lhs.lo, rhs);
+  result.hi = CFloat64x2MultiplyElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return `(CFloat64x3){ lhs[0] / rhs, lhs[1] / rhs, lhs[2] / rhs }`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3DivideElement(const CFloat64x3 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_div_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat64x3 result;
+  result.lo = CFloat64x2DivideElement(lhs.lo, rhs);
+  result.hi = CFloat64x2DivideElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return `(CFloat64x3){ lhs[0] * rhs + addend[0], lhs[1] * rhs + addend[1], lhs[2] * rhs + addend[2] }`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3MultiplyElementAdd(const CFloat64x3 lhs,
+                             const Float64 rhs,
+                             const CFloat64x3 addend)
+{
+#if CSIMDX_X86_FMA
+  return _mm256_fmadd_pd(lhs, _mm256_set1_pd(rhs), addend);
+#else
+  return CFloat64x3Add(CFloat64x3MultiplyElement(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark - Geometry
+
+/// Calculates the dot product of both storages, ignoring the unused lane.
+/// @return `lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2]`
+FORCE_INLINE(Float64) CFloat64x3Dot(const CFloat64x3 lhs, const CFloat64x3 rhs)
+{
+#if CSIMDX_X86_AVX
+  __m256d product = _mm256_mul_pd(lhs, rhs);
+  __m128d low = _mm256_castpd256_pd128(product);
+  __m128d sum = _mm_add_sd(low, _mm_unpackhi_pd(low, low));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm256_extractf128_pd(product, 1)));
+#elif CSIMDX_X86_SSE2
+  __m128d low = _mm_mul_pd(lhs.lo, rhs.lo);
+  __m128d sum = _mm_add_sd(low, _mm_unpackhi_pd(low, low));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_mul_sd(lhs.hi, rhs.hi)));
+#elif CSIMDX_ARM_NEON_AARCH64
+  return vaddvq_f64(vmulq_f64(lhs.lo, rhs.lo))
+       + vgetq_lane_f64(lhs.hi, 0) * vgetq_lane_f64(rhs.hi, 0);
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x3 product = lhs * rhs;
+  return product[0] + product[1] + product[2];
+#else
+  return CFloat64x3GetElement(lhs, 0) * CFloat64x3GetElement(rhs, 0)
+       + CFloat64x3GetElement(lhs, 1) * CFloat64x3GetElement(rhs, 1)
+       + CFloat64x3GetElement(lhs, 2) * CFloat64x3GetElement(rhs, 2);
+#endif
+}
+
+/// Calculates the cross product of both storages.
+/// @return
+///   (CFloat64x3){
+///     lhs[1] * rhs[2] - lhs[2] * rhs[1],
+///     lhs[2] * rhs[0] - lhs[0] * rhs[2],
+///     lhs[0] * rhs[1] - lhs[1] * rhs[0]
+///   }
+FORCE_INLINE(CFloat64x3)
+CFloat64x3Cross(const CFloat64x3 lhs, const CFloat64x3 rhs)
+{
+#if CSIMDX_X86_SSE2 || CSIMDX_EXT_VECTOR
+  // cross(a, b) is computed as (a * b.yzx - a.yzx * b).yzx, which keeps
+  // the unused lane zero as long as it is zero in either of the operands.
+  #if CSIMDX_X86_AVX2
+    #define CFloat64x3ShuffleYZX(operand) _mm256_permute4x64_pd(operand, _MM_SHUFFLE(3, 0, 2, 1))
+  #elif CSIMDX_X86_AVX
+    #define CFloat64x3ShuffleYZX(operand) _mm256_insertf128_pd(                                    \
+      _mm256_castpd128_pd256(_mm_shuffle_pd(_mm256_castpd256_pd128(operand),                        \
+                                            _mm256_extractf128_pd(operand, 1), 1)),                \
+      _mm_shuffle_pd(_mm256_castpd256_pd128(operand), _mm256_extractf128_pd(operand, 1), 2), 1)
+  #elif CSIMDX_EXT_VECTOR
+    #define CFloat64x3ShuffleYZX(operand) __builtin_shufflevector(operand, operand, 1, 2, 0, 3)
+  #else
+    #define CFloat64x3ShuffleYZX(operand) ((CFloat64x3){                                           \
+      _mm_shuffle_pd((operand).lo, (operand).hi, 1), _mm_shuffle_pd((operand).lo, (operand).hi, 2) \
+    })
+  #endif
+  CFloat64x3 result = CFloat64x3Subtract(
+    CFloat64x3Multiply(lhs, CFloat64x3ShuffleYZX(rhs)),
+    CFloat64x3Multiply(CFloat64x3ShuffleYZX(lhs), rhs)
+  );
+  return CFloat64x3ShuffleYZX(result);
+  #undef CFloat64x3ShuffleYZX
+#else
+  Float64 lhs0 = CFloat64x3GetElement(lhs, 0);
+  Float64 rhs0 = CFloat64x3GetElement(rhs, 0);
+  Float64 lhs1 = CFloat64x3GetElement(lhs, 1);
+  Float64 rhs1 = CFloat64x3GetElement(rhs, 1);
+  Float64 lhs2 = CFloat64x3GetElement(lhs, 2);
+  Float64 rhs2 = CFloat64x3GetElement(rhs, 2);
+  return CFloat64x3Make(lhs1 * rhs2 - lhs2 * rhs1,
+                        lhs2 * rhs0 - lhs0 * rhs2,
+                        lhs0 * rhs1 - lhs1 * rhs0);
+#endif
+}
+
+/// Calculates the squared length of the storage, interpreted as a vector.
+/// @return `operand[0] * operand[0] + operand[1] * operand[1] + operand[2] * operand[2]`
+FORCE_INLINE(Float64) CFloat64x3LengthSquared(const CFloat64x3 operand)
+{
+  return CFloat64x3Dot(operand, operand);
+}
+
+/// Calculates the length of the storage, interpreted as a vector.
+/// @return `sqrt(CFloat64x3LengthSquared(operand))`
+FORCE_INLINE(Float64) CFloat64x3Length(const CFloat64x3 operand)
+{
+  return __builtin_sqrt(CFloat64x3Dot(operand, operand));
+}
+
+/// Calculates the distance between both storages, interpreted as points.
+/// @return `CFloat64x3Length(lhs - rhs)`
+FORCE_INLINE(Float64)
+CFloat64x3Distance(const CFloat64x3 lhs, const CFloat64x3 rhs)
+{
+  return CFloat64x3Length(CFloat64x3Subtract(lhs, rhs));
+}
+
+/// Scales the storage to unit length. A zero length storage results in
+/// non-finite elements.
+/// @return `operand / CFloat64x3Length(operand)`
+FORCE_INLINE(CFloat64x3) CFloat64x3Normalize(const CFloat64x3 operand)
+{
+  // The reciprocal is broadcast to the used lanes only, keeping the unused lane zero
+  Float64 reciprocal = 1.0 / CFloat64x3Length(operand);
+  return CFloat64x3Multiply(operand, CFloat64x3MakeRepeatingElement(reciprocal));
+}
+
+/// Scales the storage to approximately unit length, trading precision
+/// (about 46 bits) for the latency of the square root and the division.
+/// Non-finite or subnormal single precision lengths fall back to `Normalize`.
+/// @return `operand * rsqrt(CFloat64x3LengthSquared(operand))`
+FORCE_INLINE(CFloat64x3) CFloat64x3FastNormalize(const CFloat64x3 operand)
+{
+  Float64 lengthSquared = CFloat64x3Dot(operand, operand);
+#if CSIMDX_ARM_NEON_AARCH64
+  Float64 reciprocal = vrsqrted_f64(lengthSquared);
+  reciprocal *= vrsqrtsd_f64(lengthSquared * reciprocal, reciprocal);
+  reciprocal *= vrsqrtsd_f64(lengthSquared * reciprocal, reciprocal);
+  reciprocal *= vrsqrtsd_f64(lengthSquared * reciprocal, reciprocal);
+#elif CSIMDX_X86_SSE2
+  // There is no double precision estimate, so start off the single precision
+  // estimate and refine it with two Newton-Raphson steps in double precision
+  if (!(lengthSquared >= 1e-37 && lengthSquared <= 1e37)) {
+    return CFloat64x3Normalize(operand);
+  }
+  Float64 reciprocal = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss((float)lengthSquared)));
+  reciprocal *= 1.5 - 0.5 * lengthSquared * reciprocal * reciprocal;
+  reciprocal *= 1.5 - 0.5 * lengthSquared * reciprocal * reciprocal;
+#else
+  Float64 reciprocal = 1.0 / __builtin_sqrt(lengthSquared);
+#endif
+  return CFloat64x3Multiply(operand, CFloat64x3MakeRepeatingElement(reciprocal));
+}
+
+/// Reflects the `incident` direction off the surface with given `normal`.
+/// The `normal` is expected to be of unit length.
+/// @return `incident - 2 * CFloat64x3Dot(incident, normal) * normal`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3Reflect(const CFloat64x3 incident, const CFloat64x3 normal)
+{
+  Float64 scale = 2.0 * CFloat64x3Dot(incident, normal);
+  return CFloat64x3Subtract(incident, CFloat64x3Multiply(normal, CFloat64x3MakeRepeatingElement(scale)));
+}
+
+/// Projects the storage `operand` onto the direction of `target`.
+/// @return `CFloat64x3Dot(operand, target) / CFloat64x3Dot(target, target) * target`
+FORCE_INLINE(CFloat64x3)
+CFloat64x3Project(const CFloat64x3 operand, const CFloat64x3 target)
+{
+  Float64 scale = CFloat64x3Dot(operand, target) / CFloat64x3Dot(target, target);
+  return CFloat64x3Multiply(target, CFloat64x3MakeRepeatingElement(scale));
+}
+
 #undef Float64
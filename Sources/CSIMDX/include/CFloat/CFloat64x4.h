@@ -22,6 +22,8 @@
 /// The 4 x 64-bit floating point storage
 #if CSIMDX_X86_AVX
 typedef __m256d CFloat64x4;
+#elif CSIMDX_EXT_VECTOR
+typedef Float64 CFloat64x4 CSIMDX_EXT_VECTOR_TYPE(Float64, 4);
 #else
 typedef struct CFloat64x4_t {
   CFloat64x2 lo, hi;
@@ -37,6 +39,8 @@ CFloat64x4GetElement(const CFloat64x4 storage, const int index)
 {
 #if CSIMDX_X86_AVX
   return ((Float64*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   union { CFloat64x4 storage; Float64 rawValue[4]; } Union;
   Union.storage = storage;
@@ -51,6 +55,8 @@ CFloat64x4SetElement(CFloat64x4* storage, const int index, const Float64 value)
 {
 #if CSIMDX_X86_AVX
   ((Float64*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   union { CFloat64x4* storage; Float64* rawValue; } Union;
   Union.storage = storage;
@@ -58,6 +64,59 @@ CFloat64x4SetElement(CFloat64x4* storage, const int index, const Float64 value)
 #endif
 }
 
+#pragma mark Lanes
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat64x4GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float64)
+CFloat64x4ExtractLane(const CFloat64x4 storage, const int lane)
+{
+#if CSIMDX_X86_AVX
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm_cvtsd_f64(_mm256_castpd256_pd128(storage));
+    case 1: return _mm_cvtsd_f64(_mm_unpackhi_pd(_mm256_castpd256_pd128(storage), _mm256_castpd256_pd128(storage)));
+    case 2: return _mm_cvtsd_f64(_mm256_extractf128_pd(storage, 1));
+    case 3: return _mm_cvtsd_f64(_mm_unpackhi_pd(_mm256_extractf128_pd(storage, 1), _mm256_extractf128_pd(storage, 1)));
+  }
+  return CFloat64x4GetElement(storage, lane);
+#elif CSIMDX_EXT_VECTOR
+  return storage[lane];
+#else
+  return lane < 2 ? CFloat64x2ExtractLane(storage.lo, lane) : CFloat64x2ExtractLane(storage.hi, lane - 2);
+#endif
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat64x4SetElement`, a compile-time constant `lane` is inserted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat64x4)
+CFloat64x4InsertLane(const CFloat64x4 storage, const int lane, const Float64 value)
+{
+#if CSIMDX_X86_AVX
+  if (__builtin_constant_p(lane)) switch (lane) {
+    case 0: return _mm256_blend_pd(storage, _mm256_set1_pd(value), 0x1);
+    case 1: return _mm256_blend_pd(storage, _mm256_set1_pd(value), 0x2);
+    case 2: return _mm256_blend_pd(storage, _mm256_set1_pd(value), 0x4);
+    case 3: return _mm256_blend_pd(storage, _mm256_set1_pd(value), 0x8);
+  }
+  CFloat64x4 result = storage;
+  CFloat64x4SetElement(&result, lane, value);
+  return result;
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x4 result = storage;
+  result[lane] = value;
+  return result;
+#else
+  CFloat64x4 result = storage;
+  if (lane < 2) result.lo = CFloat64x2InsertLane(storage.lo, lane, value);
+  else result.hi = CFloat64x2InsertLane(storage.hi, lane - 2, value);
+  return result;
+#endif
+}
+
 #pragma mark - Initialisation
 
 /// Initializes a storage to given elements. Least- to most-significant bits.
@@ -80,10 +139,14 @@ CFloat64x4Make(Float64 element0, Float64 element1,
 /// Loads 2 x Float32 values from unaligned memory.
 /// @return `(CFloat64x4){ pointer[0], pointer[1], pointer[2] }`
 FORCE_INLINE(CFloat64x4)
-CFloat64x4MakeLoad(Float64* pointer)
+CFloat64x4MakeLoad(const Float64* pointer)
 {
 #if CSIMDX_X86_AVX
   return _mm256_loadu_pd(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x4 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2MakeLoad(pointer);
@@ -98,6 +161,8 @@ FORCE_INLINE(CFloat64x4) CFloat64x4MakeRepeatingElement(const Float64 value)
 {
 #if CSIMDX_X86_AVX
   return _mm256_set1_pd(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x4){ value, value, value, value };
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2MakeRepeatingElement(value);
@@ -112,6 +177,8 @@ FORCE_INLINE(CFloat64x4) CFloat64x4MakeZero(void)
 {
 #if CSIMDX_X86_AVX
   return _mm256_setzero_pd();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x4){ 0.0 };
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2MakeZero();
@@ -120,6 +187,48 @@ FORCE_INLINE(CFloat64x4) CFloat64x4MakeZero(void)
 #endif
 }
 
+#pragma mark - Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3]`
+FORCE_INLINE(bool)
+CFloat64x4Equal(const CFloat64x4 lhs, const CFloat64x4 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)) == 0xF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2] & mask[3]) != 0;
+#else
+  return CFloat64x2Equal(lhs.lo, rhs.lo) && CFloat64x2Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat64x4){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat64x4) CFloat64x4Canonicalize(const CFloat64x4 operand)
+{
+#if CSIMDX_X86_AVX
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return _mm256_blendv_pd(_mm256_set1_pd(__builtin_nan("")),
+                          _mm256_add_pd(operand, _mm256_setzero_pd()),
+                          _mm256_cmp_pd(operand, operand, _CMP_ORD_Q));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat64x4)(((__typeof__(ordered))(operand + 0.0) & ordered) |
+                      ((__typeof__(ordered))CFloat64x4MakeRepeatingElement(__builtin_nan("")) & ~ordered));
+#else
+  CFloat64x4 result;
+  result.lo = CFloat64x2Canonicalize(operand.lo);
+  result.hi = CFloat64x2Canonicalize(operand.hi);
+  return result;
+#endif
+}
+
 #pragma mark - Minimum & Maximum
 
 /// Performs element-by-element comparison of both storages and returns
@@ -135,6 +244,9 @@ CFloat64x4Minimum(const CFloat64x4 lhs, const CFloat64x4 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_min_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat64x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Minimum(lhs.lo, rhs.lo);
@@ -156,6 +268,9 @@ CFloat64x4Maximum(const CFloat64x4 lhs, const CFloat64x4 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_max_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat64x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Maximum(lhs.lo, rhs.lo);
@@ -164,6 +279,63 @@ CFloat64x4Maximum(const CFloat64x4 lhs, const CFloat64x4 rhs)
 #endif
 }
 
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x4){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4IEEEMinimum(const CFloat64x4 lhs, const CFloat64x4 rhs)
+{
+#if CSIMDX_X86_AVX
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  return _mm256_or_pd(_mm256_min_pd(lhs, rhs), _mm256_min_pd(rhs, lhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat64x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x4 result;
+  result.lo = CFloat64x2IEEEMinimum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x2IEEEMinimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x4){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4IEEEMaximum(const CFloat64x4 lhs, const CFloat64x4 rhs)
+{
+#if CSIMDX_X86_AVX
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  return _mm256_or_pd(_mm256_and_pd(_mm256_max_pd(lhs, rhs), _mm256_max_pd(rhs, lhs)),
+                      _mm256_cmp_pd(lhs, rhs, _CMP_UNORD_Q));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat64x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x4 result;
+  result.lo = CFloat64x2IEEEMaximum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x2IEEEMaximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
 #pragma mark - Arithmetics
 
 /// Returns the negated storage (element-wise).
@@ -171,7 +343,10 @@ CFloat64x4Maximum(const CFloat64x4 lhs, const CFloat64x4 rhs)
 FORCE_INLINE(CFloat64x4) CFloat64x4Negate(const CFloat64x4 operand)
 {
 #if CSIMDX_X86_AVX
-  return _mm256_sub_pd(CFloat64x4MakeZero(), operand);
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm256_xor_pd(operand, _mm256_set1_pd(-0.0));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Negate(operand.lo);
@@ -189,6 +364,8 @@ FORCE_INLINE(CFloat64x4) CFloat64x4Magnitude(const CFloat64x4 operand)
   union { __m256d operand; __m256i signs; } Signed;
   Signed.signs = _mm256_setr_epi64x(SIGN_BIT, SIGN_BIT, SIGN_BIT, SIGN_BIT);
   return _mm256_and_pd(operand, Signed.operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x4)((__typeof__(operand < operand))operand & 0x7FFFFFFFFFFFFFFF);
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Magnitude(operand.lo);
@@ -206,6 +383,8 @@ CFloat64x4Add(const CFloat64x4 lhs, const CFloat64x4 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_add_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Add(lhs.lo, rhs.lo);
@@ -221,6 +400,8 @@ CFloat64x4Subtract(const CFloat64x4 lhs, const CFloat64x4 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_sub_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Subtract(lhs.lo, rhs.lo);
@@ -238,6 +419,8 @@ CFloat64x4Multiply(const CFloat64x4 lhs, const CFloat64x4 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_mul_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Multiply(lhs.lo, rhs.lo);
@@ -252,6 +435,8 @@ FORCE_INLINE(CFloat64x4) CFloat64x4Divide(const CFloat64x4 lhs, CFloat64x4 rhs)
 {
 #if CSIMDX_X86_AVX
   return _mm256_div_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2Divide(lhs.lo, rhs.lo);
@@ -266,6 +451,8 @@ FORCE_INLINE(CFloat64x4) CFloat64x4SquareRoot(const CFloat64x4 operand)
 {
 #if CSIMDX_X86_AVX
   return _mm256_sqrt_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x4){ __builtin_sqrt(operand[0]), __builtin_sqrt(operand[1]), __builtin_sqrt(operand[2]), __builtin_sqrt(operand[3]) };
 #else
   CFloat64x4 result;
   result.lo = CFloat64x2SquareRoot(operand.lo);
@@ -274,4 +461,144 @@ FORCE_INLINE(CFloat64x4) CFloat64x4SquareRoot(const CFloat64x4 operand)
 #endif
 }
 
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return
+///   (CFloat64x4){
+///     lhs[0] * rhs[0] + addend[0],
+///     lhs[1] * rhs[1] + addend[1],
+///     lhs[2] * rhs[2] + addend[2],
+///     lhs[3] * rhs[3] + addend[3]
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4MultiplyAdd(const CFloat64x4 lhs,
+                      const CFloat64x4 rhs,
+                      const CFloat64x4 addend)
+{
+#if CSIMDX_X86_FMA
+  return _mm256_fmadd_pd(lhs, rhs, addend);
+#else
+  return CFloat64x4Add(CFloat64x4Multiply(lhs, rhs), addend);
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return
+///   (CFloat64x4){
+///     lhs[0] + rhs,
+///     lhs[1] + rhs,
+///     lhs[2] + rhs,
+///     lhs[3] + rhs
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4AddElement(const CFloat64x4 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_add_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat64x4 result;
+  result.lo = CFloat64x2AddElement(lhs.lo, rhs);
+  result.hi = CFloat64x2AddElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return
+///   (CFloat64x4){
+///     lhs[0] - rhs,
+///     lhs[1] - rhs,
+///     lhs[2] - rhs,
+///     lhs[3] - rhs
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4SubtractElement(const CFloat64x4 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_sub_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat64x4 result;
+  result.lo = CFloat64x2SubtractElement(lhs.lo, rhs);
+  result.hi = CFloat64x2SubtractElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return
+///   (CFloat64x4){
+///     lhs[0] * rhs,
+///     lhs[1] * rhs,
+///     lhs[2] * rhs,
+///     lhs[3] * rhs
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4MultiplyElement(const CFloat64x4 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_mul_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat64x4 result;
+  result.lo = CFloat64x2MultiplyElement(lhs.lo, rhs);
+  result.hi = CFloat64x2MultiplyElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return
+///   (CFloat64x4){
+///     lhs[0] / rhs,
+///     lhs[1] / rhs,
+///     lhs[2] / rhs,
+///     lhs[3] / rhs
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4DivideElement(const CFloat64x4 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_div_pd(lhs, _mm256_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat64x4 result;
+  result.lo = CFloat64x2DivideElement(lhs.lo, rhs);
+  result.hi = CFloat64x2DivideElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return
+///   (CFloat64x4){
+///     lhs[0] * rhs + addend[0],
+///     lhs[1] * rhs + addend[1],
+///     lhs[2] * rhs + addend[2],
+///     lhs[3] * rhs + addend[3]
+///   }
+FORCE_INLINE(CFloat64x4)
+CFloat64x4MultiplyElementAdd(const CFloat64x4 lhs,
+                             const Float64 rhs,
+                             const CFloat64x4 addend)
+{
+#if CSIMDX_X86_FMA
+  return _mm256_fmadd_pd(lhs, _mm256_set1_pd(rhs), addend);
+#else
+  return CFloat64x4Add(CFloat64x4MultiplyElement(lhs, rhs), addend);
+#endif
+}
+
 #undef Float64
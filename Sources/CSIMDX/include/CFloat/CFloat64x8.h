@@ -0,0 +1,682 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 64-bit floating point element
+#define Float64 double
+
+/// The 8 x 64-bit floating point storage, a single register where the
+/// target has 512-bit registers and two CFloat64x4 otherwise
+#if CSIMDX_X86_AVX512_F
+typedef __m512d CFloat64x8;
+#elif CSIMDX_EXT_VECTOR
+typedef Float64 CFloat64x8 CSIMDX_EXT_VECTOR_TYPE(Float64, 8);
+#else
+typedef struct CFloat64x8_t {
+  CFloat64x4 lo, hi;
+} CFloat64x8;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(Float64)
+CFloat64x8GetElement(const CFloat64x8 storage, const int index)
+{
+#if CSIMDX_X86_AVX512_F
+  return ((Float64*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  union { CFloat64x8 storage; Float64 rawValue[8]; } Union;
+  Union.storage = storage;
+  return Union.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CFloat64x8SetElement(CFloat64x8* storage, const int index, const Float64 value)
+{
+#if CSIMDX_X86_AVX512_F
+  ((Float64*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  union { CFloat64x8* storage; Float64* rawValue; } Union;
+  Union.storage = storage;
+  Union.rawValue[index] = value;
+#endif
+}
+
+#pragma mark Lanes
+
+/// Returns the lower half of `storage`.
+/// @return `(CFloat64x4){ storage[0], ..., storage[3] }`
+FORCE_INLINE(CFloat64x4) CFloat64x8GetLow(const CFloat64x8 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castpd512_pd256(storage);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 0, 1, 2, 3);
+#else
+  return storage.lo;
+#endif
+}
+
+/// Returns the upper half of `storage`.
+/// @return `(CFloat64x4){ storage[4], ..., storage[7] }`
+FORCE_INLINE(CFloat64x4) CFloat64x8GetHigh(const CFloat64x8 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_extractf64x4_pd(storage, 1);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 4, 5, 6, 7);
+#else
+  return storage.hi;
+#endif
+}
+
+/// Returns the element at `lane` of `storage` (`storage[lane]`). Unlike
+/// `CFloat64x8GetElement`, a compile-time constant `lane` is extracted within the
+/// register, rather than by spilling the storage to memory.
+/// @return `storage[lane]`
+FORCE_INLINE(Float64)
+CFloat64x8ExtractLane(const CFloat64x8 storage, const int lane)
+{
+#if CSIMDX_X86_AVX512_F
+  if (__builtin_constant_p(lane)) {
+    return lane < 4 ? CFloat64x4ExtractLane(CFloat64x8GetLow(storage), lane)
+                    : CFloat64x4ExtractLane(CFloat64x8GetHigh(storage), lane - 4);
+  }
+  return CFloat64x8GetElement(storage, lane);
+#elif CSIMDX_EXT_VECTOR
+  return storage[lane];
+#else
+  return lane < 4 ? CFloat64x4ExtractLane(storage.lo, lane) : CFloat64x4ExtractLane(storage.hi, lane - 4);
+#endif
+}
+
+/// Returns `storage` with the element at `lane` replaced by `value`. Unlike
+/// `CFloat64x8SetElement`, the element is inserted within the register on targets
+/// with 512-bit registers, by a move under the mask of `lane`, and a
+/// compile-time constant `lane` is inserted within the register otherwise.
+/// @return `(storage[lane] = value, storage)`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8InsertLane(const CFloat64x8 storage, const int lane, const Float64 value)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mask_mov_pd(storage, (__mmask8)(1 << lane), _mm512_set1_pd(value));
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x8 result = storage;
+  result[lane] = value;
+  return result;
+#else
+  CFloat64x8 result = storage;
+  if (lane < 4) result.lo = CFloat64x4InsertLane(storage.lo, lane, value);
+  else result.hi = CFloat64x4InsertLane(storage.hi, lane - 4, value);
+  return result;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Initializes a storage to given elements. Least- to most-significant bits.
+/// @return `(CFloat64x8){ element0, element1, ..., element7 }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Make(Float64 element0, Float64 element1, Float64 element2, Float64 element3,
+               Float64 element4, Float64 element5, Float64 element6, Float64 element7)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_setr_pd(element0, element1, element2, element3,
+                        element4, element5, element6, element7);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x8){ element0, element1, element2, element3,
+                       element4, element5, element6, element7 };
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Make(element0, element1, element2, element3);
+  result.hi = CFloat64x4Make(element4, element5, element6, element7);
+  return result;
+#endif
+}
+
+/// Loads 8 x Float64 values from unaligned memory.
+/// @return `(CFloat64x8){ pointer[0], pointer[1], ..., pointer[7] }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8MakeLoad(const Float64* pointer)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_loadu_pd(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x8 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4MakeLoad(pointer);
+  result.hi = CFloat64x4MakeLoad(&pointer[4]);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CFloat64x8){ value, value, ..., value }`
+FORCE_INLINE(CFloat64x8) CFloat64x8MakeRepeatingElement(const Float64 value)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_set1_pd(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x8){ value, value, value, value, value, value, value, value };
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4MakeRepeatingElement(value);
+  result.hi = CFloat64x4MakeRepeatingElement(value);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0.0).
+/// @return `(CFloat64x8){ 0.0, 0.0, ..., 0.0 }`
+FORCE_INLINE(CFloat64x8) CFloat64x8MakeZero(void)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_setzero_pd();
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x8){ 0.0 };
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4MakeZero();
+  result.hi = CFloat64x4MakeZero();
+  return result;
+#endif
+}
+
+#pragma mark - Comparison
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison. As for the
+/// elements, a NaN is unequal to anything and -0.0 is equal to +0.0.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && ... && lhs[7] == rhs[7]`
+FORCE_INLINE(bool)
+CFloat64x8Equal(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_cmp_pd_mask(lhs, rhs, _CMP_EQ_OQ) == 0xFF;
+#elif CSIMDX_EXT_VECTOR
+  return CFloat64x4Equal(CFloat64x8GetLow(lhs), CFloat64x8GetLow(rhs)) &&
+         CFloat64x4Equal(CFloat64x8GetHigh(lhs), CFloat64x8GetHigh(rhs));
+#else
+  return CFloat64x4Equal(lhs.lo, rhs.lo) && CFloat64x4Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+/// Returns the storage with -0.0 replaced by +0.0 and every NaN replaced by
+/// the same quiet NaN, so that storages that compare equal have equal bits,
+/// e.g. to hash them.
+/// @return `(CFloat64x8){ isnan(operand[0]) ? NAN : operand[0] + 0.0, ... }`
+FORCE_INLINE(CFloat64x8) CFloat64x8Canonicalize(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  // Adding +0.0 turns -0.0 into +0.0 and leaves any other number as it is
+  return _mm512_mask_add_pd(_mm512_set1_pd(__builtin_nan("")),
+                            _mm512_cmp_pd_mask(operand, operand, _CMP_ORD_Q),
+                            operand, _mm512_setzero_pd());
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(operand == operand) ordered = operand == operand;
+  return (CFloat64x8)(((__typeof__(ordered))(operand + 0.0) & ordered) |
+                      ((__typeof__(ordered))CFloat64x8MakeRepeatingElement(__builtin_nan("")) & ~ordered));
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Canonicalize(operand.lo);
+  result.hi = CFloat64x4Canonicalize(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return
+///   (CFloat64x8){
+///     lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Minimum(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_min_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CFloat64x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Minimum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4Minimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return
+///   (CFloat64x8){
+///     lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Maximum(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_max_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CFloat64x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Maximum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4Maximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result, as the IEEE 754-2019 `minimum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x8){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] < rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x8)
+CFloat64x8IEEEMinimum(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise OR is NaN or -0.0 in these lanes
+  __m512i lhsFirst = _mm512_castpd_si512(_mm512_min_pd(lhs, rhs));
+  __m512i rhsFirst = _mm512_castpd_si512(_mm512_min_pd(rhs, lhs));
+  return _mm512_castsi512_pd(_mm512_or_si512(lhsFirst, rhsFirst));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs < rhs) mask = (lhs != lhs) | (lhs < rhs) | ((lhs == rhs) & sign);
+  return (CFloat64x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4IEEEMinimum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4IEEEMinimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result, as the IEEE 754-2019 `maximum`
+/// operation: a NaN element results in NaN, and -0.0 is less than +0.0.
+/// @return
+///   (CFloat64x8){
+///     isnan(lhs[0]) || isnan(rhs[0]) ? NaN : lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     isnan(lhs[1]) || isnan(rhs[1]) ? NaN : lhs[1] > rhs[1] ? lhs[1] : rhs[1],
+///     ...
+///   }
+FORCE_INLINE(CFloat64x8)
+CFloat64x8IEEEMaximum(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  // Either order returns the second operand for a NaN or a pair of zeros, so that
+  // their bitwise AND is +0.0 in these lanes, which are set to NaN if unordered
+  __m512i lhsFirst = _mm512_castpd_si512(_mm512_max_pd(lhs, rhs));
+  __m512i rhsFirst = _mm512_castpd_si512(_mm512_max_pd(rhs, lhs));
+  return _mm512_mask_add_pd(_mm512_castsi512_pd(_mm512_and_si512(lhsFirst, rhsFirst)),
+                            _mm512_cmp_pd_mask(lhs, rhs, _CMP_UNORD_Q), lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) sign = (__typeof__(lhs < rhs))lhs < 0;
+  __typeof__(lhs > rhs) mask = (lhs != lhs) | (lhs > rhs) | ((lhs == rhs) & ~sign);
+  return (CFloat64x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4IEEEMaximum(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4IEEEMaximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Returns the negated storage (element-wise).
+/// @return `(CFloat64x8){ -(operand[0]), -(operand[1]), ..., -(operand[7]) }`
+FORCE_INLINE(CFloat64x8) CFloat64x8Negate(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  // Flips the sign bit, as subtracting from zero would turn 0 into +0 rather than -0
+  return _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(operand), _mm512_set1_epi64((long long)0x8000000000000000)));
+#elif CSIMDX_EXT_VECTOR
+  return -operand;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Negate(operand.lo);
+  result.hi = CFloat64x4Negate(operand.hi);
+  return result;
+#endif
+}
+
+/// Returns the absolute storage (element-wise).
+/// @return `(CFloat64x8){ abs(operand[0]), abs(operand[1]), ..., abs(operand[7]) }`
+FORCE_INLINE(CFloat64x8) CFloat64x8Magnitude(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_pd(_mm512_andnot_epi64(_mm512_set1_epi64((long long)0x8000000000000000), _mm512_castpd_si512(operand)));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x8)((__typeof__(operand < operand))operand & 0x7FFFFFFFFFFFFFFF);
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Magnitude(operand.lo);
+  result.hi = CFloat64x4Magnitude(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CFloat64x8){ lhs[0] + rhs[0], ..., lhs[7] + rhs[7] }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Add(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_add_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Add(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4Add(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CFloat64x8){ lhs[0] - rhs[0], ..., lhs[7] - rhs[7] }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Subtract(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sub_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Subtract(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4Subtract(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise).
+/// @return `(CFloat64x8){ lhs[0] * rhs[0], ..., lhs[7] * rhs[7] }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Multiply(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mul_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Multiply(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4Multiply(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Divides two storages (element-wise).
+/// @return `(CFloat64x8){ lhs[0] / rhs[0], ..., lhs[7] / rhs[7] }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Divide(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_div_pd(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4Divide(lhs.lo, rhs.lo);
+  result.hi = CFloat64x4Divide(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Calculates the square root (element-wise).
+/// @return `(CFloat64x8){ sqrt(operand[0]), ..., sqrt(operand[7]) }`
+FORCE_INLINE(CFloat64x8) CFloat64x8SquareRoot(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sqrt_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  CFloat64x8 result;
+  for (int index = 0; index < 8; index++) result[index] = __builtin_sqrt(operand[index]);
+  return result;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4SquareRoot(operand.lo);
+  result.hi = CFloat64x4SquareRoot(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Fused
+
+/// Multiplies two storages and adds the result to `addend` (element-wise).
+/// Uses a fused multiply-add instruction if the target provides one, and a
+/// multiplication followed by an addition otherwise.
+/// @return `(CFloat64x8){ lhs[0] * rhs[0] + addend[0], ..., lhs[7] * rhs[7] + addend[7] }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8MultiplyAdd(const CFloat64x8 lhs,
+                      const CFloat64x8 rhs,
+                      const CFloat64x8 addend)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_fmadd_pd(lhs, rhs, addend);
+#elif CSIMDX_EXT_VECTOR
+  return CFloat64x8Add(CFloat64x8Multiply(lhs, rhs), addend);
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4MultiplyAdd(lhs.lo, rhs.lo, addend.lo);
+  result.hi = CFloat64x4MultiplyAdd(lhs.hi, rhs.hi, addend.hi);
+  return result;
+#endif
+}
+
+#pragma mark Scalar
+
+/// Adds `rhs` to each element of a storage.
+/// @return `(CFloat64x8){ lhs[0] + rhs, ..., lhs[7] + rhs }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8AddElement(const CFloat64x8 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_add_pd(lhs, _mm512_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4AddElement(lhs.lo, rhs);
+  result.hi = CFloat64x4AddElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Subtracts `rhs` from each element of a storage.
+/// @return `(CFloat64x8){ lhs[0] - rhs, ..., lhs[7] - rhs }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8SubtractElement(const CFloat64x8 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sub_pd(lhs, _mm512_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4SubtractElement(lhs.lo, rhs);
+  result.hi = CFloat64x4SubtractElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs`.
+/// @return `(CFloat64x8){ lhs[0] * rhs, ..., lhs[7] * rhs }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8MultiplyElement(const CFloat64x8 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mul_pd(lhs, _mm512_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4MultiplyElement(lhs.lo, rhs);
+  result.hi = CFloat64x4MultiplyElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Divides each element of a storage by `rhs`.
+/// @return `(CFloat64x8){ lhs[0] / rhs, ..., lhs[7] / rhs }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8DivideElement(const CFloat64x8 lhs, const Float64 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_div_pd(lhs, _mm512_set1_pd(rhs));
+#elif CSIMDX_EXT_VECTOR
+  return lhs / rhs;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4DivideElement(lhs.lo, rhs);
+  result.hi = CFloat64x4DivideElement(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Multiplies each element of a storage by `rhs` and adds the result to
+/// `addend` (element-wise). Uses a fused multiply-add instruction if the
+/// target provides one, and a multiplication followed by an addition otherwise.
+/// @return `(CFloat64x8){ lhs[0] * rhs + addend[0], ..., lhs[7] * rhs + addend[7] }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8MultiplyElementAdd(const CFloat64x8 lhs,
+                             const Float64 rhs,
+                             const CFloat64x8 addend)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_fmadd_pd(lhs, _mm512_set1_pd(rhs), addend);
+#elif CSIMDX_EXT_VECTOR
+  return CFloat64x8Add(CFloat64x8MultiplyElement(lhs, rhs), addend);
+#else
+  CFloat64x8 result;
+  result.lo = CFloat64x4MultiplyElementAdd(lhs.lo, rhs, addend.lo);
+  result.hi = CFloat64x4MultiplyElementAdd(lhs.hi, rhs, addend.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Reduction
+
+// All reductions combine the elements in the same order on every target, by
+// folding the upper half of the storage onto the lower one until a single
+// element is left, so that their results do not depend on the target.
+
+/// Returns the sum of all elements, adding the upper half onto the lower
+/// half until a single element is left.
+/// @return `((operand[0] + operand[4]) + (operand[2] + operand[6])) + ((operand[1] + operand[5]) + (operand[3] + operand[7]))`
+FORCE_INLINE(Float64) CFloat64x8ReduceAdd(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  __m256d half = _mm256_add_pd(CFloat64x8GetLow(operand), CFloat64x8GetHigh(operand));
+  __m128d quarter = _mm_add_pd(_mm256_castpd256_pd128(half), _mm256_extractf128_pd(half, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(quarter, _mm_unpackhi_pd(quarter, quarter)));
+#elif CSIMDX_EXT_VECTOR
+  return ((operand[0] + operand[4]) + (operand[2] + operand[6])) +
+         ((operand[1] + operand[5]) + (operand[3] + operand[7]));
+#else
+  CFloat64x4 half = CFloat64x4Add(operand.lo, operand.hi);
+  return (CFloat64x4GetElement(half, 0) + CFloat64x4GetElement(half, 2)) +
+         (CFloat64x4GetElement(half, 1) + CFloat64x4GetElement(half, 3));
+#endif
+}
+
+/// Returns the least of all elements, folding the upper half onto the lower
+/// half with `CFloat64x8Minimum` until a single element is left. Whether a NaN
+/// element is returned thus depends on its lane.
+/// @return `min(min(min(operand[0], operand[4]), min(operand[2], operand[6])), min(min(operand[1], operand[5]), min(operand[3], operand[7])))`
+FORCE_INLINE(Float64) CFloat64x8ReduceMinimum(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  __m256d half = _mm256_min_pd(CFloat64x8GetLow(operand), CFloat64x8GetHigh(operand));
+  __m128d quarter = _mm_min_pd(_mm256_castpd256_pd128(half), _mm256_extractf128_pd(half, 1));
+  return _mm_cvtsd_f64(_mm_min_sd(quarter, _mm_unpackhi_pd(quarter, quarter)));
+#else
+  #if CSIMDX_EXT_VECTOR
+  Float64 half0 = operand[0] < operand[4] ? operand[0] : operand[4];
+  Float64 half1 = operand[1] < operand[5] ? operand[1] : operand[5];
+  Float64 half2 = operand[2] < operand[6] ? operand[2] : operand[6];
+  Float64 half3 = operand[3] < operand[7] ? operand[3] : operand[7];
+  #else
+  CFloat64x4 half = CFloat64x4Minimum(operand.lo, operand.hi);
+  Float64 half0 = CFloat64x4GetElement(half, 0), half1 = CFloat64x4GetElement(half, 1);
+  Float64 half2 = CFloat64x4GetElement(half, 2), half3 = CFloat64x4GetElement(half, 3);
+  #endif
+  Float64 lhs = half0 < half2 ? half0 : half2;
+  Float64 rhs = half1 < half3 ? half1 : half3;
+  return lhs < rhs ? lhs : rhs;
+#endif
+}
+
+/// Returns the greatest of all elements, folding the upper half onto the lower
+/// half with `CFloat64x8Maximum` until a single element is left. Whether a NaN
+/// element is returned thus depends on its lane.
+/// @return `max(max(max(operand[0], operand[4]), max(operand[2], operand[6])), max(max(operand[1], operand[5]), max(operand[3], operand[7])))`
+FORCE_INLINE(Float64) CFloat64x8ReduceMaximum(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  __m256d half = _mm256_max_pd(CFloat64x8GetLow(operand), CFloat64x8GetHigh(operand));
+  __m128d quarter = _mm_max_pd(_mm256_castpd256_pd128(half), _mm256_extractf128_pd(half, 1));
+  return _mm_cvtsd_f64(_mm_max_sd(quarter, _mm_unpackhi_pd(quarter, quarter)));
+#else
+  #if CSIMDX_EXT_VECTOR
+  Float64 half0 = operand[0] > operand[4] ? operand[0] : operand[4];
+  Float64 half1 = operand[1] > operand[5] ? operand[1] : operand[5];
+  Float64 half2 = operand[2] > operand[6] ? operand[2] : operand[6];
+  Float64 half3 = operand[3] > operand[7] ? operand[3] : operand[7];
+  #else
+  CFloat64x4 half = CFloat64x4Maximum(operand.lo, operand.hi);
+  Float64 half0 = CFloat64x4GetElement(half, 0), half1 = CFloat64x4GetElement(half, 1);
+  Float64 half2 = CFloat64x4GetElement(half, 2), half3 = CFloat64x4GetElement(half, 3);
+  #endif
+  Float64 lhs = half0 > half2 ? half0 : half2;
+  Float64 rhs = half1 > half3 ? half1 : half3;
+  return lhs > rhs ? lhs : rhs;
+#endif
+}
+
+#undef Float64
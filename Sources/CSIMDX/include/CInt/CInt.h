@@ -16,3 +16,6 @@
 
 #include "CInt32x2.h"
 #include "CInt32x3.h"
+#include "CInt32x4.h"
+#include "CInt32x8.h"
+#include "CInt32x16.h"
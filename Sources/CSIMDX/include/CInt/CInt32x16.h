@@ -0,0 +1,555 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit signed integer element
+#define Int32 int32_t
+
+/// The 16 x 32-bit signed integer storage, a single register where the target
+/// has 512-bit integer registers and two CInt32x8 otherwise
+#if CSIMDX_X86_AVX512_F
+typedef __m512i CInt32x16;
+#elif CSIMDX_EXT_VECTOR
+typedef Int32 CInt32x16 CSIMDX_EXT_VECTOR_TYPE(Int32, 16);
+#else
+typedef struct CInt32x16_t {
+  CInt32x8 lo, hi;
+} CInt32x16;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(Int32)
+CInt32x16GetElement(const CInt32x16 storage, const int index)
+{
+#if CSIMDX_X86_AVX512_F
+  return ((Int32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  union { CInt32x16 storage; Int32 rawValue[16]; } Union;
+  Union.storage = storage;
+  return Union.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CInt32x16SetElement(CInt32x16* storage, const int index, const Int32 value)
+{
+#if CSIMDX_X86_AVX512_F
+  ((Int32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  union { CInt32x16* storage; Int32* rawValue; } Union;
+  Union.storage = storage;
+  Union.rawValue[index] = value;
+#endif
+}
+
+#pragma mark Lanes
+
+/// Returns the lower half of `storage`.
+/// @return `(CInt32x8){ storage[0], ..., storage[7] }`
+FORCE_INLINE(CInt32x8) CInt32x16GetLow(const CInt32x16 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_si256(storage);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 0, 1, 2, 3, 4, 5, 6, 7);
+#else
+  return storage.lo;
+#endif
+}
+
+/// Returns the upper half of `storage`.
+/// @return `(CInt32x8){ storage[8], ..., storage[15] }`
+FORCE_INLINE(CInt32x8) CInt32x16GetHigh(const CInt32x16 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_extracti64x4_epi64(storage, 1);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 8, 9, 10, 11, 12, 13, 14, 15);
+#else
+  return storage.hi;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Loads 16 x Int32 values from unaligned memory.
+/// @return `(CInt32x16){ pointer[0], pointer[1], ..., pointer[15] }`
+FORCE_INLINE(CInt32x16)
+CInt32x16MakeLoad(const Int32* pointer)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_loadu_si512(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CInt32x16 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8MakeLoad(pointer);
+  result.hi = CInt32x8MakeLoad(&pointer[8]);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CInt32x16){ value, value, ..., value }`
+FORCE_INLINE(CInt32x16) CInt32x16MakeRepeatingElement(const Int32 value)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_set1_epi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16){ value, value, value, value, value, value, value, value, value, value, value, value, value, value, value, value };
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8MakeRepeatingElement(value);
+  result.hi = CInt32x8MakeRepeatingElement(value);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0).
+/// @return `(CInt32x16){ 0, 0, ..., 0 }`
+FORCE_INLINE(CInt32x16) CInt32x16MakeZero(void)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_setzero_si512();
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16){ 0 };
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8MakeZero();
+  result.hi = CInt32x8MakeZero();
+  return result;
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return `(CInt32x16){ lhs[0] < rhs[0] ? lhs[0] : rhs[0], ..., lhs[15] < rhs[15] ? lhs[15] : rhs[15] }`
+FORCE_INLINE(CInt32x16)
+CInt32x16Minimum(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_min_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CInt32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8Minimum(lhs.lo, rhs.lo);
+  result.hi = CInt32x8Minimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return `(CInt32x16){ lhs[0] > rhs[0] ? lhs[0] : rhs[0], ..., lhs[15] > rhs[15] ? lhs[15] : rhs[15] }`
+FORCE_INLINE(CInt32x16)
+CInt32x16Maximum(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_max_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CInt32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8Maximum(lhs.lo, rhs.lo);
+  result.hi = CInt32x8Maximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
+/// @return `(CInt32x16){ lhs[0] == rhs[0], lhs[1] == rhs[1], ..., lhs[15] == rhs[15] }`
+FORCE_INLINE(CInt32x16)
+CInt32x16CompareElementWise(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmpeq_epi32_mask(lhs, rhs), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs == rhs);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8CompareElementWise(lhs.lo, rhs.lo);
+  result.hi = CInt32x8CompareElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && ... && lhs[15] == rhs[15]`
+FORCE_INLINE(bool)
+CInt32x16Equal(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_cmpeq_epi32_mask(lhs, rhs) == 0xFFFF;
+#elif CSIMDX_EXT_VECTOR
+  return CInt32x8Equal(CInt32x16GetLow(lhs), CInt32x16GetLow(rhs)) && CInt32x8Equal(CInt32x16GetHigh(lhs), CInt32x16GetHigh(rhs));
+#else
+  return CInt32x8Equal(lhs.lo, rhs.lo) && CInt32x8Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+/// Returns the negated storage (element-wise).
+/// @return `(CInt32x16){ -(operand[0]), -(operand[1]), ..., -(operand[15]) }`
+FORCE_INLINE(CInt32x16) CInt32x16Negate(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sub_epi32(_mm512_setzero_si512(), operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(-(CUInt32x16)operand);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8Negate(operand.lo);
+  result.hi = CInt32x8Negate(operand.hi);
+  return result;
+#endif
+}
+
+/// Returns the absolute storage (element-wise).
+/// @return `(CUInt32x16){ abs(operand[0]), abs(operand[1]), ..., abs(operand[15]) }`
+FORCE_INLINE(CUInt32x16)
+CInt32x16Magnitude(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_abs_epi32(operand);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x16 sign = (CUInt32x16)(operand >> 31);
+  return ((CUInt32x16)operand ^ sign) - sign;
+#else
+  CUInt32x16 result;
+  result.lo = CInt32x8Magnitude(operand.lo);
+  result.hi = CInt32x8Magnitude(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CInt32x16){ lhs[0] + rhs[0], lhs[1] + rhs[1], ..., lhs[15] + rhs[15] }`
+FORCE_INLINE(CInt32x16)
+CInt32x16Add(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_add_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8Add(lhs.lo, rhs.lo);
+  result.hi = CInt32x8Add(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CInt32x16){ lhs[0] - rhs[0], lhs[1] - rhs[1], ..., lhs[15] - rhs[15] }`
+FORCE_INLINE(CInt32x16)
+CInt32x16Subtract(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sub_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8Subtract(lhs.lo, rhs.lo);
+  result.hi = CInt32x8Subtract(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise), wrapping around on overflow.
+/// @return `(CInt32x16){ lhs[0] * rhs[0], lhs[1] * rhs[1], ..., lhs[15] * rhs[15] }`
+FORCE_INLINE(CInt32x16)
+CInt32x16Multiply(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mullo_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)((CUInt32x16)lhs * (CUInt32x16)rhs);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8Multiply(lhs.lo, rhs.lo);
+  result.hi = CInt32x8Multiply(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Bitwise
+
+/// Bitwise Not
+FORCE_INLINE(CInt32x16) CInt32x16BitwiseNot(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_xor_si512(operand, _mm512_set1_epi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8BitwiseNot(operand.lo);
+  result.hi = CInt32x8BitwiseNot(operand.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And
+FORCE_INLINE(CInt32x16)
+CInt32x16BitwiseAnd(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_and_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8BitwiseAnd(lhs.lo, rhs.lo);
+  result.hi = CInt32x8BitwiseAnd(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And Not
+FORCE_INLINE(CInt32x16)
+CInt32x16BitwiseAndNot(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_andnot_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8BitwiseAndNot(lhs.lo, rhs.lo);
+  result.hi = CInt32x8BitwiseAndNot(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Or
+FORCE_INLINE(CInt32x16)
+CInt32x16BitwiseOr(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_or_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8BitwiseOr(lhs.lo, rhs.lo);
+  result.hi = CInt32x8BitwiseOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Exclusive Or
+FORCE_INLINE(CInt32x16)
+CInt32x16BitwiseExclusiveOr(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_xor_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8BitwiseExclusiveOr(lhs.lo, rhs.lo);
+  result.hi = CInt32x8BitwiseExclusiveOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Shifting
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero, as does a negative count, which is taken as an unsigned one.
+FORCE_INLINE(CInt32x16)
+CInt32x16ShiftLeftElementWise(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sllv_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x16 count = (CUInt32x16)rhs;
+  return (CInt32x16)(((CUInt32x16)lhs << (count & 31)) & (CUInt32x16)(count < 32));
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8ShiftLeftElementWise(lhs.lo, rhs.lo);
+  result.hi = CInt32x8ShiftLeftElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits of rhs.
+FORCE_INLINE(CInt32x16)
+CInt32x16ShiftLeft(const CInt32x16 lhs, const Int32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_slli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (uint32_t)rhs < 32 ? (CInt32x16)((CUInt32x16)lhs << rhs) : (CInt32x16){ 0 };
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8ShiftLeft(lhs.lo, rhs);
+  result.hi = CInt32x8ShiftLeft(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with the sign bit, as does a negative count, which is
+/// taken as an unsigned one.
+FORCE_INLINE(CInt32x16)
+CInt32x16ShiftRightElementWise(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_srav_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  CUInt32x16 count = (CUInt32x16)rhs;
+  return lhs >> (CInt32x16)(((count & 31) | (CUInt32x16)(count > 31)) & 31);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8ShiftRightElementWise(lhs.lo, rhs.lo);
+  result.hi = CInt32x8ShiftRightElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
+FORCE_INLINE(CInt32x16)
+CInt32x16ShiftRight(const CInt32x16 lhs, const Int32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_srai_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs >> (Int32)((uint32_t)rhs < 32 ? rhs : 31);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8ShiftRight(lhs.lo, rhs);
+  result.hi = CInt32x8ShiftRight(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CInt32x16){ popcount(operand[0]), popcount(operand[1]), ..., popcount(operand[15]) }`
+FORCE_INLINE(CInt32x16) CInt32x16PopulationCount(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return CUInt32x16PopulationCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)CUInt32x16PopulationCount((CUInt32x16)operand);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8PopulationCount(operand.lo);
+  result.hi = CInt32x8PopulationCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CInt32x16){ clz(operand[0]), clz(operand[1]), ..., clz(operand[15]) }`
+FORCE_INLINE(CInt32x16) CInt32x16LeadingZeroBitCount(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return CUInt32x16LeadingZeroBitCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)CUInt32x16LeadingZeroBitCount((CUInt32x16)operand);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8LeadingZeroBitCount(operand.lo);
+  result.hi = CInt32x8LeadingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CInt32x16){ ctz(operand[0]), ctz(operand[1]), ..., ctz(operand[15]) }`
+FORCE_INLINE(CInt32x16) CInt32x16TrailingZeroBitCount(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return CUInt32x16TrailingZeroBitCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)CUInt32x16TrailingZeroBitCount((CUInt32x16)operand);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8TrailingZeroBitCount(operand.lo);
+  result.hi = CInt32x8TrailingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CInt32x16){ bswap(operand[0]), bswap(operand[1]), ..., bswap(operand[15]) }`
+FORCE_INLINE(CInt32x16) CInt32x16ByteSwap(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return CUInt32x16ByteSwap(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)CUInt32x16ByteSwap((CUInt32x16)operand);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8ByteSwap(operand.lo);
+  result.hi = CInt32x8ByteSwap(operand.hi);
+  return result;
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CInt32x16){ bitreverse(operand[0]), bitreverse(operand[1]), ..., bitreverse(operand[15]) }`
+FORCE_INLINE(CInt32x16) CInt32x16BitReverse(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return CUInt32x16BitReverse(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)CUInt32x16BitReverse((CUInt32x16)operand);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8BitReverse(operand.lo);
+  result.hi = CInt32x8BitReverse(operand.hi);
+  return result;
+#endif
+}
+
+#undef Int32
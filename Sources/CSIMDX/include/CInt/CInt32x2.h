@@ -24,6 +24,8 @@
 typedef int32x2_t CInt32x2;
 #elif CSIMDX_X86_MMX
 typedef __m64 CInt32x2;
+#elif CSIMDX_EXT_VECTOR
+typedef Int32 CInt32x2 CSIMDX_EXT_VECTOR_TYPE(Int32, 2);
 #else
 typedef struct CInt32x2_t {
   Int32 rawValue[2];
@@ -39,6 +41,8 @@ CInt32x2GetElement(const CInt32x2 storage, const int index)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   return ((Int32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   return storage.rawValue[index];
 #endif
@@ -51,6 +55,8 @@ CInt32x2SetElement(CInt32x2* storage, const int index, const Int32 value)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   ((Int32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   (storage->rawValue)[index] = value;
 #endif
@@ -77,6 +83,10 @@ CInt32x2MakeLoad(const Int32* pointer)
 {
 #if CSIMDX_ARM_NEON
   return vld1_s32(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CInt32x2 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
 #else
   return CInt32x2Make(pointer[0], pointer[1]);
 #endif
@@ -91,6 +101,8 @@ CInt32x2MakeRepeatingElement(const Int32 value)
   return vdup_n_s32(value);
 #elif CSIMDX_X86_MMX
   return _mm_set1_pi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2){ value, value };
 #else
   return CInt32x2Make(value, value);
 #endif
@@ -104,6 +116,8 @@ FORCE_INLINE(CInt32x2) CInt32x2MakeZero(void)
   return vdup_n_s32(0);
 #elif CSIMDX_X86_MMX
   return _mm_setzero_si64();
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2){ 0 };
 #else
   return CInt32x2MakeRepeatingElement(0);
 #endif
@@ -128,6 +142,9 @@ CInt32x2Minimum(const CInt32x2 lhs, const CInt32x2 rhs)
   // So promote both to __m128i, run `min`, and move back to __m64.
   return _mm_movepi64_pi64(_mm_min_epi32(_mm_movpi64_epi64(lhs),
                                          _mm_movpi64_epi64(rhs)));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CInt32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Int32 lhs0 = CInt32x2GetElement(lhs, 0);
   Int32 rhs0 = CInt32x2GetElement(rhs, 0);
@@ -155,6 +172,9 @@ CInt32x2Maximum(const CInt32x2 lhs, const CInt32x2 rhs)
   // So promote both to __m128i, run `max`, and move back to __m64.
   return _mm_movepi64_pi64(_mm_max_epi32(_mm_movpi64_epi64(lhs),
                                          _mm_movpi64_epi64(rhs)));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CInt32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Int32 lhs0 = CInt32x2GetElement(lhs, 0);
   Int32 rhs0 = CInt32x2GetElement(rhs, 0);
@@ -167,7 +187,8 @@ CInt32x2Maximum(const CInt32x2 lhs, const CInt32x2 rhs)
 
 #pragma mark - Arithmetics
 
-/// Returns the negated storage (element-wise).
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
 /// @return `(CInt32x2){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
 FORCE_INLINE(CInt32x2)
 CInt32x2CompareElementWise(const CInt32x2 lhs, const CInt32x2 rhs)
@@ -176,12 +197,37 @@ CInt32x2CompareElementWise(const CInt32x2 lhs, const CInt32x2 rhs)
   return vceq_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_cmpeq_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs == rhs);
 #else
   Int32 lhs0 = CInt32x2GetElement(lhs, 0);
   Int32 rhs0 = CInt32x2GetElement(rhs, 0);
   Int32 lhs1 = CInt32x2GetElement(lhs, 1);
   Int32 rhs1 = CInt32x2GetElement(rhs, 1);
-  return CInt32x2Make(lhs0 == rhs0, lhs1 == rhs1);
+  return CInt32x2Make(-(Int32)(lhs0 == rhs0),
+                      -(Int32)(lhs1 == rhs1));
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1]`
+FORCE_INLINE(bool)
+CInt32x2Equal(const CInt32x2 lhs, const CInt32x2 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminv_u32(vceq_s32(lhs, rhs)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x2_t mask = vceq_s32(lhs, rhs);
+  return vget_lane_u32(vpmin_u32(mask, mask), 0) != 0;
+#elif CSIMDX_X86_MMX
+  return _mm_cvtm64_si64(_mm_cmpeq_pi32(lhs, rhs)) == -1;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1]) != 0;
+#else
+  return CInt32x2GetElement(lhs, 0) == CInt32x2GetElement(rhs, 0)
+      && CInt32x2GetElement(lhs, 1) == CInt32x2GetElement(rhs, 1);
 #endif
 }
 
@@ -193,6 +239,8 @@ FORCE_INLINE(CInt32x2) CInt32x2Negate(const CInt32x2 operand)
   return vneg_s32(operand);
 #elif CSIMDX_X86_MMX
   return _mm_sub_pi32(CInt32x2MakeZero(), operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(-(CUInt32x2)operand);
 #else
   return CInt32x2Make(-CInt32x2GetElement(operand, 0),
                       -CInt32x2GetElement(operand, 1));
@@ -207,9 +255,12 @@ FORCE_INLINE(CUInt32x2) CInt32x2Magnitude(const CInt32x2 operand)
   return vreinterpret_u32_s32(vabs_s32(operand));
 #elif CSIMDX_X86_SSE3 // MMX has no `abs` function for __m64, but SSE3 does
   return _mm_abs_pi32(operand);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 sign = (CUInt32x2)(operand >> 31);
+  return ((CUInt32x2)operand ^ sign) - sign;
 #else
-  return CInt32x2Make(__builtin_abs(CInt32x2GetElement(operand, 0)),
-                      __builtin_abs(CInt32x2GetElement(operand, 1)));
+  return CUInt32x2Make(__builtin_abs(CInt32x2GetElement(operand, 0)),
+                       __builtin_abs(CInt32x2GetElement(operand, 1)));
 #endif
 }
 
@@ -224,6 +275,8 @@ CInt32x2Add(const CInt32x2 lhs, const CInt32x2 rhs)
   return vadd_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_add_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)((CUInt32x2)lhs + (CUInt32x2)rhs);
 #else
   Int32 lhs0 = CInt32x2GetElement(lhs, 0);
   Int32 rhs0 = CInt32x2GetElement(rhs, 0);
@@ -242,6 +295,8 @@ CInt32x2Subtract(const CInt32x2 lhs, const CInt32x2 rhs)
   return vsub_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_sub_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)((CUInt32x2)lhs - (CUInt32x2)rhs);
 #else
   Int32 lhs0 = CInt32x2GetElement(lhs, 0);
   Int32 rhs0 = CInt32x2GetElement(rhs, 0);
@@ -260,6 +315,8 @@ CInt32x2Multiply(const CInt32x2 lhs, const CInt32x2 rhs)
 {
 #if CSIMDX_ARM_NEON
   return vmul_s32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)((CUInt32x2)lhs * (CUInt32x2)rhs);
 #else
   Int32 lhs0 = CInt32x2GetElement(lhs, 0);
   Int32 rhs0 = CInt32x2GetElement(rhs, 0);
@@ -278,6 +335,8 @@ FORCE_INLINE(CInt32x2) CInt32x2BitwiseNot(const CInt32x2 operand)
   return vmvn_s32(operand);
 #elif CSIMDX_X86_MMX
   return _mm_xor_si64(operand, CInt32x2MakeRepeatingElement(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
 #else
   return CInt32x2Make(~CInt32x2GetElement(operand, 0),
                       ~CInt32x2GetElement(operand, 1));
@@ -292,6 +351,8 @@ CInt32x2BitwiseAnd(const CInt32x2 lhs, const CInt32x2 rhs)
   return vand_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_and_si64(rhs, lhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
 #else
   return CInt32x2Make(CInt32x2GetElement(lhs, 0) & CInt32x2GetElement(rhs, 0),
                       CInt32x2GetElement(lhs, 1) & CInt32x2GetElement(rhs, 1));
@@ -304,6 +365,8 @@ CInt32x2BitwiseAndNot(const CInt32x2 lhs, const CInt32x2 rhs)
 {
 #if CSIMDX_X86_MMX
   return _mm_andnot_si64(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
 #else
   return CInt32x2BitwiseAnd(CInt32x2BitwiseNot(lhs), rhs);
 #endif
@@ -317,6 +380,8 @@ CInt32x2BitwiseOr(const CInt32x2 lhs, const CInt32x2 rhs)
   return vorr_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_or_si64(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
 #else
   return CInt32x2Make(CInt32x2GetElement(lhs, 0) | CInt32x2GetElement(rhs, 0),
                       CInt32x2GetElement(lhs, 1) | CInt32x2GetElement(rhs, 1));
@@ -331,6 +396,8 @@ CInt32x2BitwiseExclusiveOr(const CInt32x2 lhs, const CInt32x2 rhs)
   return veor_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_xor_si64(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
 #else
   return CInt32x2Make(CInt32x2GetElement(lhs, 0) ^ CInt32x2GetElement(rhs, 0),
                       CInt32x2GetElement(lhs, 1) ^ CInt32x2GetElement(rhs, 1));
@@ -340,15 +407,31 @@ CInt32x2BitwiseExclusiveOr(const CInt32x2 lhs, const CInt32x2 rhs)
 #pragma mark Shifting
 
 /// Left-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero, as does a negative count, which is taken as an unsigned one.
 FORCE_INLINE(CInt32x2)
 CInt32x2ShiftLeftElementWise(const CInt32x2 lhs, const CInt32x2 rhs)
 {
 #if CSIMDX_ARM_NEON
-  return vshl_s32(lhs, rhs);
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshl_s32(lhs, vreinterpret_s32_u32(vmin_u32(vreinterpret_u32_s32(rhs), vdup_n_u32(32))));
+#elif CSIMDX_X86_MMX
+  // Shifts the whole storage by the count of each lane, then picks each lane
+  // from its own shift. Counts are read from all 64 bits of the count operand.
+  const __m64 zero = _mm_setzero_si64();
+  __m64 shifted0 = _mm_sll_pi32(lhs, _mm_unpacklo_pi32(rhs, zero));
+  __m64 shifted1 = _mm_sll_pi32(lhs, _mm_unpackhi_pi32(rhs, zero));
+  return _mm_unpacklo_pi32(shifted0, _mm_srli_si64(shifted1, 32));
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x2 count = (CUInt32x2)rhs;
+  return (CInt32x2)(((CUInt32x2)lhs << (count & 31)) & (CUInt32x2)(count < 32));
 #else
-  return CInt32x2Make(CInt32x2GetElement(lhs, 0) << CInt32x2GetElement(rhs, 0),
-                      CInt32x2GetElement(lhs, 1) << CInt32x2GetElement(rhs, 1));
+  // Shifting by the element width or more is undefined, clear those lanes
+  uint32_t count0 = (uint32_t)CInt32x2GetElement(rhs, 0);
+  uint32_t count1 = (uint32_t)CInt32x2GetElement(rhs, 1);
+  return CInt32x2Make(count0 < 32 ? (Int32)((uint32_t)CInt32x2GetElement(lhs, 0) << count0) : 0,
+                      count1 < 32 ? (Int32)((uint32_t)CInt32x2GetElement(lhs, 1) << count1) : 0);
 #endif
 }
 
@@ -359,34 +442,154 @@ CInt32x2ShiftLeft(const CInt32x2 lhs, const Int32 rhs)
 {
 #if CSIMDX_X86_MMX
   return _mm_slli_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (uint32_t)rhs < 32 ? (CInt32x2)((CUInt32x2)lhs << rhs) : (CInt32x2){ 0 };
 #else
   return CInt32x2ShiftLeftElementWise(lhs, CInt32x2MakeRepeatingElement(rhs));
 #endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with the sign bit, as does a negative count, which is
+/// taken as an unsigned one.
 FORCE_INLINE(CInt32x2)
 CInt32x2ShiftRightElementWise(const CInt32x2 lhs, const CInt32x2 rhs)
 {
 #if CSIMDX_ARM_NEON
-  return CInt32x2ShiftLeftElementWise(lhs, CInt32x2Negate(rhs));
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshl_s32(lhs, vneg_s32(vreinterpret_s32_u32(vmin_u32(vreinterpret_u32_s32(rhs), vdup_n_u32(32)))));
+#elif CSIMDX_X86_MMX
+  // Shifts the whole storage by the count of each lane, then picks each lane
+  // from its own shift. Counts are read from all 64 bits of the count operand.
+  const __m64 zero = _mm_setzero_si64();
+  __m64 shifted0 = _mm_sra_pi32(lhs, _mm_unpacklo_pi32(rhs, zero));
+  __m64 shifted1 = _mm_sra_pi32(lhs, _mm_unpackhi_pi32(rhs, zero));
+  return _mm_unpacklo_pi32(shifted0, _mm_srli_si64(shifted1, 32));
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  CUInt32x2 count = (CUInt32x2)rhs;
+  return lhs >> (CInt32x2)(((count & 31) | (CUInt32x2)(count > 31)) & 31);
 #else
-  return CInt32x2Make(CInt32x2GetElement(lhs, 0) >> CInt32x2GetElement(rhs, 0),
-                      CInt32x2GetElement(lhs, 1) >> CInt32x2GetElement(rhs, 1));
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  uint32_t count0 = (uint32_t)CInt32x2GetElement(rhs, 0);
+  uint32_t count1 = (uint32_t)CInt32x2GetElement(rhs, 1);
+  return CInt32x2Make(CInt32x2GetElement(lhs, 0) >> (count0 < 32 ? count0 : 31),
+                      CInt32x2GetElement(lhs, 1) >> (count1 < 32 ? count1 : 31));
 #endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits of rhs.
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
 FORCE_INLINE(CInt32x2)
 CInt32x2ShiftRight(const CInt32x2 lhs, const Int32 rhs)
 {
 #if CSIMDX_X86_MMX
-  return _mm_srli_pi32(lhs, rhs);
+  return _mm_srai_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs >> (Int32)((uint32_t)rhs < 32 ? rhs : 31);
 #else
   return CInt32x2ShiftRightElementWise(lhs, CInt32x2MakeRepeatingElement(rhs));
 #endif
 }
 
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CInt32x2){ popcount(operand[0]), popcount(operand[1]) }`
+FORCE_INLINE(CInt32x2) CInt32x2PopulationCount(const CInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  uint8x8_t count = vcnt_u8(vreinterpret_u8_s32(operand));
+  return vreinterpret_s32_u32(vpaddl_u16(vpaddl_u8(count)));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 bits = (CUInt32x2)operand;
+  bits = bits - ((bits >> 1) & 0x55555555);
+  bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+  bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+  return (CInt32x2)((bits * 0x01010101) >> 24);
+#else
+  return CInt32x2Make(__builtin_popcount((uint32_t)CInt32x2GetElement(operand, 0)),
+                      __builtin_popcount((uint32_t)CInt32x2GetElement(operand, 1)));
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CInt32x2){ clz(operand[0]), clz(operand[1]) }`
+FORCE_INLINE(CInt32x2) CInt32x2LeadingZeroBitCount(const CInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vclz_s32(operand);
+#elif CSIMDX_EXT_VECTOR
+  // Smear the highest set bit to the right and count the remaining zeros
+  CUInt32x2 bits = (CUInt32x2)operand;
+  bits |= bits >> 1;
+  bits |= bits >> 2;
+  bits |= bits >> 4;
+  bits |= bits >> 8;
+  bits |= bits >> 16;
+  return CInt32x2PopulationCount(CInt32x2BitwiseNot((CInt32x2)bits));
+#else
+  uint32_t element0 = (uint32_t)CInt32x2GetElement(operand, 0);
+  uint32_t element1 = (uint32_t)CInt32x2GetElement(operand, 1);
+  return CInt32x2Make(element0 ? __builtin_clz(element0) : 32,
+                      element1 ? __builtin_clz(element1) : 32);
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CInt32x2){ ctz(operand[0]), ctz(operand[1]) }`
+FORCE_INLINE(CInt32x2) CInt32x2TrailingZeroBitCount(const CInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vclz_s32(vreinterpret_s32_u8(vrbit_u8(vrev32_u8(vreinterpret_u8_s32(operand)))));
+#elif CSIMDX_ARM_NEON
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  return CInt32x2PopulationCount(vbic_s32(vsub_s32(operand, vdup_n_s32(1)), operand));
+#elif CSIMDX_EXT_VECTOR
+  // The trailing zeros are the bits set in ~x & (x - 1)
+  return CInt32x2PopulationCount(CInt32x2BitwiseNot(operand) & (CInt32x2)((CUInt32x2)operand - 1));
+#else
+  uint32_t element0 = (uint32_t)CInt32x2GetElement(operand, 0);
+  uint32_t element1 = (uint32_t)CInt32x2GetElement(operand, 1);
+  return CInt32x2Make(element0 ? __builtin_ctz(element0) : 32,
+                      element1 ? __builtin_ctz(element1) : 32);
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CInt32x2){ bswap(operand[0]), bswap(operand[1]) }`
+FORCE_INLINE(CInt32x2) CInt32x2ByteSwap(const CInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u8(vrev32_u8(vreinterpret_u8_s32(operand)));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 bits = (CUInt32x2)operand;
+  return (CInt32x2)((bits << 24) | ((bits & 0xFF00) << 8) | ((bits >> 8) & 0xFF00) | (bits >> 24));
+#else
+  return CInt32x2Make(__builtin_bswap32((uint32_t)CInt32x2GetElement(operand, 0)),
+                      __builtin_bswap32((uint32_t)CInt32x2GetElement(operand, 1)));
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CInt32x2){ bitreverse(operand[0]), bitreverse(operand[1]) }`
+FORCE_INLINE(CInt32x2) CInt32x2BitReverse(const CInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpret_s32_u8(vrbit_u8(vrev32_u8(vreinterpret_u8_s32(operand))));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 bits = (CUInt32x2)operand;
+  bits = ((bits >> 1) & 0x55555555) | ((bits & 0x55555555) << 1);
+  bits = ((bits >> 2) & 0x33333333) | ((bits & 0x33333333) << 2);
+  bits = ((bits >> 4) & 0x0F0F0F0F) | ((bits & 0x0F0F0F0F) << 4);
+  return CInt32x2ByteSwap((CInt32x2)bits);
+#else
+  return CInt32x2Make(__builtin_bitreverse32((uint32_t)CInt32x2GetElement(operand, 0)),
+                      __builtin_bitreverse32((uint32_t)CInt32x2GetElement(operand, 1)));
+#endif
+}
+
 #undef Int32
@@ -24,6 +24,8 @@
 typedef int32x4_t CInt32x3; // Most significant 32 bits are unused (zero)
 #elif CSIMDX_X86_SSE2
 typedef __m128i CInt32x3;   // Most significant 32 bits are unused (zero)
+#elif CSIMDX_EXT_VECTOR
+typedef Int32 CInt32x3 CSIMDX_EXT_VECTOR_TYPE(Int32, 4);  // Most significant 32 bits are unused (zero)
 #else
 typedef struct CInt32x3_t {
   Int32 rawValue[4];        // Most significant 32 bits are unused (zero)
@@ -39,6 +41,8 @@ CInt32x3GetElement(const CInt32x3 storage, const int index)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   return ((Int32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   return storage.rawValue[index];
 #endif
@@ -51,6 +55,8 @@ CInt32x3SetElement(CInt32x3* storage, const int index, const Int32 value)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   ((Int32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   (storage->rawValue)[index] = value;
 #endif
@@ -70,19 +76,17 @@ CInt32x3Make(Int32 element0, Int32 element1, Int32 element2)
 #endif
 }
 
-/// Loads 3 x Int32 values from unaligned memory.
-/// @return `(CInt32x3){ pointer[0], pointer[1] }`
+/// Loads 3 x Int32 values from unaligned memory, without reading beyond them.
+/// @return `(CInt32x3){ pointer[0], pointer[1], pointer[2] }`
 FORCE_INLINE(CInt32x3)
 CInt32x3MakeLoad(const Int32* pointer)
 {
 #if CSIMDX_ARM_NEON
-  CInt32x3 result = vld1q_s32(pointer);
-  CInt32x3SetElement(&result, 3, 0); // Set last element (unused) to 0
-  return result;
+  return vcombine_s32(vld1_s32(pointer), vld1_lane_s32(pointer + 2, vdup_n_s32(0), 0));
 #elif CSIMDX_X86_SSE2
-  CInt32x3 result = _mm_loadu_si128((__m128i*)pointer);
-  CInt32x3SetElement(&result, 3, 0); // Set last element (unused) to 0
-  return result;
+  return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)pointer), _mm_cvtsi32_si128(pointer[2]));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3){ pointer[0], pointer[1], pointer[2], 0 };
 #else
   return CInt32x3Make(pointer[0], pointer[1], pointer[2]);
 #endif
@@ -97,8 +101,10 @@ CInt32x3MakeRepeatingElement(const Int32 value)
   return vdupq_n_s32(value);
 #elif CSIMDX_X86_SSE2
   return _mm_set1_epi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3){ value, value, value, 0 };
 #else
-  return CInt32x3Make(value, value);
+  return CInt32x3Make(value, value, value);
 #endif
 }
 
@@ -110,6 +116,8 @@ FORCE_INLINE(CInt32x3) CInt32x3MakeZero(void)
   return vdupq_n_s32(0);
 #elif CSIMDX_X86_SSE2
   return _mm_setzero_si128();
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3){ 0 };
 #else
   return CInt32x3MakeRepeatingElement(0);
 #endif
@@ -131,6 +139,9 @@ CInt32x3Minimum(const CInt32x3 lhs, const CInt32x3 rhs)
   return vminq_s32(lhs, rhs);
 #elif CSIMDX_X86_SSE4_1 // SSE2 has no `min` function, but SSE4 does.
   return _mm_min_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CInt32x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Int32 lhs0 = CInt32x3GetElement(lhs, 0);
   Int32 rhs0 = CInt32x3GetElement(rhs, 0);
@@ -158,6 +169,9 @@ CInt32x3Maximum(const CInt32x3 lhs, const CInt32x3 rhs)
   return vmaxq_s32(lhs, rhs);
 #elif CSIMDX_X86_SSE4_1 // SSE2 has no `min` function, but SSE4 does.
   return _mm_max_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CInt32x3)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   Int32 lhs0 = CInt32x3GetElement(lhs, 0);
   Int32 rhs0 = CInt32x3GetElement(rhs, 0);
@@ -173,7 +187,8 @@ CInt32x3Maximum(const CInt32x3 lhs, const CInt32x3 rhs)
 
 #pragma mark - Arithmetics
 
-/// Returns the negated storage (element-wise).
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
 /// @return `(CInt32x3){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
 FORCE_INLINE(CInt32x3)
 CInt32x3CompareElementWise(const CInt32x3 lhs, const CInt32x3 rhs)
@@ -182,6 +197,8 @@ CInt32x3CompareElementWise(const CInt32x3 lhs, const CInt32x3 rhs)
   return vceqq_s32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_cmpeq_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3)(lhs == rhs);
 #else
   Int32 lhs0 = CInt32x3GetElement(lhs, 0);
   Int32 rhs0 = CInt32x3GetElement(rhs, 0);
@@ -189,7 +206,36 @@ CInt32x3CompareElementWise(const CInt32x3 lhs, const CInt32x3 rhs)
   Int32 rhs1 = CInt32x3GetElement(rhs, 1);
   Int32 lhs2 = CInt32x3GetElement(lhs, 2);
   Int32 rhs2 = CInt32x3GetElement(rhs, 2);
-  return CInt32x3Make(lhs0 == rhs0, lhs1 == rhs1, lhs2 == rhs2);
+  return CInt32x3Make(-(Int32)(lhs0 == rhs0),
+                      -(Int32)(lhs1 == rhs1),
+                      -(Int32)(lhs2 == rhs2));
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2]`
+FORCE_INLINE(bool)
+CInt32x3Equal(const CInt32x3 lhs, const CInt32x3 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  // The most significant element is unused, take it as equal
+  return vminvq_u32(vsetq_lane_u32(~0u, vceqq_s32(lhs, rhs), 3)) != 0;
+#elif CSIMDX_ARM_NEON
+  // The most significant element is unused, take it as equal
+  uint32x4_t mask = vsetq_lane_u32(~0u, vceqq_s32(lhs, rhs), 3);
+  uint32x2_t half = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+  return vget_lane_u32(vpmin_u32(half, half), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  // The most significant element is unused, ignore it
+  return (_mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)) & 0x0FFF) == 0x0FFF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2]) != 0;
+#else
+  return CInt32x3GetElement(lhs, 0) == CInt32x3GetElement(rhs, 0)
+      && CInt32x3GetElement(lhs, 1) == CInt32x3GetElement(rhs, 1)
+      && CInt32x3GetElement(lhs, 2) == CInt32x3GetElement(rhs, 2);
 #endif
 }
 
@@ -201,6 +247,8 @@ FORCE_INLINE(CInt32x3) CInt32x3Negate(const CInt32x3 operand)
   return vnegq_s32(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_sub_epi32(CInt32x3MakeZero(), operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3)(-(CUInt32x3)operand);
 #else
   return CInt32x3Make(-CInt32x3GetElement(operand, 0),
                       -CInt32x3GetElement(operand, 1),
@@ -217,10 +265,13 @@ CInt32x3Magnitude(const CInt32x3 operand)
   return vreinterpretq_u32_s32(vabsq_s32(operand));
 #elif CSIMDX_X86_SSE3 // MMX has no `abs` function for __m64, but SSE3 does
   return _mm_abs_epi32(operand);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x3 sign = (CUInt32x3)(operand >> 31);
+  return ((CUInt32x3)operand ^ sign) - sign;
 #else
-  return CInt32x3Make(__builtin_abs(CInt32x3GetElement(operand, 0)),
-                      __builtin_abs(CInt32x3GetElement(operand, 1)),
-                      __builtin_abs(CInt32x3GetElement(operand, 2)));
+  return CUInt32x3Make(__builtin_abs(CInt32x3GetElement(operand, 0)),
+                       __builtin_abs(CInt32x3GetElement(operand, 1)),
+                       __builtin_abs(CInt32x3GetElement(operand, 2)));
 #endif
 }
 
@@ -235,6 +286,8 @@ CInt32x3Add(const CInt32x3 lhs, const CInt32x3 rhs)
   return vaddq_s32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_add_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3)((CUInt32x3)lhs + (CUInt32x3)rhs);
 #else
   Int32 lhs0 = CInt32x3GetElement(lhs, 0);
   Int32 rhs0 = CInt32x3GetElement(rhs, 0);
@@ -255,6 +308,8 @@ CInt32x3Subtract(const CInt32x3 lhs, const CInt32x3 rhs)
   return vsubq_s32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_sub_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3)((CUInt32x3)lhs - (CUInt32x3)rhs);
 #else
   Int32 lhs0 = CInt32x3GetElement(lhs, 0);
   Int32 rhs0 = CInt32x3GetElement(rhs, 0);
@@ -275,6 +330,8 @@ CInt32x3Multiply(const CInt32x3 lhs, const CInt32x3 rhs)
 {
 #if CSIMDX_ARM_NEON
   return vmulq_s32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3)((CUInt32x3)lhs * (CUInt32x3)rhs);
 #else
   Int32 lhs0 = CInt32x3GetElement(lhs, 0);
   Int32 rhs0 = CInt32x3GetElement(rhs, 0);
@@ -295,6 +352,9 @@ FORCE_INLINE(CInt32x3) CInt32x3BitwiseNot(const CInt32x3 operand)
   return vmvnq_s32(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_xor_si128(operand, CInt32x3MakeRepeatingElement(-1));
+#elif CSIMDX_EXT_VECTOR
+  // Keep the unused lane zero
+  return operand ^ (CInt32x3){ -1, -1, -1, 0 };
 #else
   return CInt32x3Make(~CInt32x3GetElement(operand, 0),
                       ~CInt32x3GetElement(operand, 1),
@@ -310,10 +370,12 @@ CInt32x3BitwiseAnd(const CInt32x3 lhs, const CInt32x3 rhs)
   return vandq_s32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_and_si128(rhs, lhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
 #else
   return CInt32x3Make(CInt32x3GetElement(lhs, 0) & CInt32x3GetElement(rhs, 0),
                       CInt32x3GetElement(lhs, 1) & CInt32x3GetElement(rhs, 1),
-                      CInt32x3GetElement(lhs, 2) & CInt32x3GetElement(rhs, 2);
+                      CInt32x3GetElement(lhs, 2) & CInt32x3GetElement(rhs, 2));
 #endif
 }
 
@@ -323,6 +385,8 @@ CInt32x3BitwiseAndNot(const CInt32x3 lhs, const CInt32x3 rhs)
 {
 #if CSIMDX_X86_MMX
   return _mm_andnot_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
 #else
   return CInt32x3BitwiseAnd(CInt32x3BitwiseNot(lhs), rhs);
 #endif
@@ -336,9 +400,11 @@ CInt32x3BitwiseOr(const CInt32x3 lhs, const CInt32x3 rhs)
   return vorrq_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_or_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
 #else
   return CInt32x3Make(CInt32x3GetElement(lhs, 0) | CInt32x3GetElement(rhs, 0),
-                      CInt32x3GetElement(lhs, 1) | CInt32x3GetElement(rhs, 1)
+                      CInt32x3GetElement(lhs, 1) | CInt32x3GetElement(rhs, 1),
                       CInt32x3GetElement(lhs, 2) | CInt32x3GetElement(rhs, 2));
 #endif
 }
@@ -351,6 +417,8 @@ CInt32x3BitwiseExclusiveOr(const CInt32x3 lhs, const CInt32x3 rhs)
   return veorq_s32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_xor_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
 #else
   return CInt32x3Make(CInt32x3GetElement(lhs, 0) ^ CInt32x3GetElement(rhs, 0),
                       CInt32x3GetElement(lhs, 1) ^ CInt32x3GetElement(rhs, 1),
@@ -361,16 +429,46 @@ CInt32x3BitwiseExclusiveOr(const CInt32x3 lhs, const CInt32x3 rhs)
 #pragma mark Shifting
 
 /// Left-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero, as does a negative count, which is taken as an unsigned one.
 FORCE_INLINE(CInt32x3)
 CInt32x3ShiftLeftElementWise(const CInt32x3 lhs, const CInt32x3 rhs)
 {
 #if CSIMDX_ARM_NEON
-  return vshlq_s32(lhs, rhs);
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshlq_s32(lhs, vreinterpretq_s32_u32(vminq_u32(vreinterpretq_u32_s32(rhs), vdupq_n_u32(32))));
+#elif CSIMDX_X86_AVX2
+  return _mm_sllv_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Multiplies by 2^rhs, built from the exponent bits of a 32-bit float. 2^31
+  // does not fit the signed conversion, but -2^31 does and is equal modulo 2^32.
+  __m128i sign = _mm_slli_epi32(_mm_cmpeq_epi32(rhs, _mm_set1_epi32(31)), 31);
+  __m128i exponent = _mm_add_epi32(_mm_slli_epi32(rhs, 23), _mm_set1_epi32(0x3F800000));
+  exponent = _mm_or_si128(exponent, sign);
+  __m128i power = _mm_cvttps_epi32(_mm_castsi128_ps(exponent));
+  #if CSIMDX_X86_SSE4_1
+  __m128i product = _mm_mullo_epi32(lhs, power);
+  #else
+  __m128i even = _mm_mul_epu32(lhs, power);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(power, 32));
+  __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                       _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  #endif
+  // Clear the lanes shifted by 32 or more bits, i.e. where `rhs & ~31` is non-zero
+  __m128i inRange = _mm_cmpeq_epi32(_mm_and_si128(rhs, _mm_set1_epi32(~31)), _mm_setzero_si128());
+  return _mm_and_si128(product, inRange);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x3 count = (CUInt32x3)rhs;
+  return (CInt32x3)(((CUInt32x3)lhs << (count & 31)) & (CUInt32x3)(count < 32));
 #else
-  return CInt32x3Make(CInt32x3GetElement(lhs, 0) << CInt32x3GetElement(rhs, 0),
-                      CInt32x3GetElement(lhs, 1) << CInt32x3GetElement(rhs, 1),
-                      CInt32x3GetElement(lhs, 2) << CInt32x3GetElement(rhs, 2));
+  // Shifting by the element width or more is undefined, clear those lanes
+  uint32_t count0 = (uint32_t)CInt32x3GetElement(rhs, 0);
+  uint32_t count1 = (uint32_t)CInt32x3GetElement(rhs, 1);
+  uint32_t count2 = (uint32_t)CInt32x3GetElement(rhs, 2);
+  return CInt32x3Make(count0 < 32 ? (Int32)((uint32_t)CInt32x3GetElement(lhs, 0) << count0) : 0,
+                      count1 < 32 ? (Int32)((uint32_t)CInt32x3GetElement(lhs, 1) << count1) : 0,
+                      count2 < 32 ? (Int32)((uint32_t)CInt32x3GetElement(lhs, 2) << count2) : 0);
 #endif
 }
 
@@ -379,37 +477,243 @@ CInt32x3ShiftLeftElementWise(const CInt32x3 lhs, const CInt32x3 rhs)
 FORCE_INLINE(CInt32x3)
 CInt32x3ShiftLeft(const CInt32x3 lhs, const Int32 rhs)
 {
-#if CSIMDX_X86_MMX
+#if CSIMDX_X86_SSE2
   return _mm_slli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (uint32_t)rhs < 32 ? (CInt32x3)((CUInt32x3)lhs << rhs) : (CInt32x3){ 0 };
 #else
   return CInt32x3ShiftLeftElementWise(lhs, CInt32x3MakeRepeatingElement(rhs));
 #endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with the sign bit, as does a negative count, which is
+/// taken as an unsigned one.
 FORCE_INLINE(CInt32x3)
 CInt32x3ShiftRightElementWise(const CInt32x3 lhs, const CInt32x3 rhs)
 {
 #if CSIMDX_ARM_NEON
-  return CInt32x3ShiftLeftElementWise(lhs, CInt32x3Negate(rhs));
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshlq_s32(lhs, vnegq_s32(vreinterpretq_s32_u32(vminq_u32(vreinterpretq_u32_s32(rhs), vdupq_n_u32(32)))));
+#elif CSIMDX_X86_AVX2
+  return _mm_srav_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Shifts the whole storage by the count of each lane, which is read from the
+  // low 64 bits of the count operand, then picks each lane from its own shift.
+  const __m128i zero = _mm_setzero_si128();
+  __m128i low = _mm_unpacklo_epi32(rhs, zero);
+  __m128i high = _mm_unpackhi_epi32(rhs, zero);
+  __m128i shifted0 = _mm_sra_epi32(lhs, low);
+  __m128i shifted1 = _mm_sra_epi32(lhs, _mm_srli_si128(low, 8));
+  __m128i shifted2 = _mm_sra_epi32(lhs, high);
+  // The unused lane is zero in every shifted storage, so it needs no shift of its own
+  __m128 lowPair = _mm_castsi128_ps(_mm_unpacklo_epi64(shifted0, shifted1));
+  __m128 highPair = _mm_castsi128_ps(_mm_unpackhi_epi64(shifted2, shifted2));
+  return _mm_castps_si128(_mm_shuffle_ps(lowPair, highPair, _MM_SHUFFLE(3, 0, 3, 0)));
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  CUInt32x3 count = (CUInt32x3)rhs;
+  return lhs >> (CInt32x3)(((count & 31) | (CUInt32x3)(count > 31)) & 31);
 #else
-  return CInt32x3Make(CInt32x3GetElement(lhs, 0) >> CInt32x3GetElement(rhs, 0),
-                      CInt32x3GetElement(lhs, 1) >> CInt32x3GetElement(rhs, 1),
-                      CInt32x3GetElement(lhs, 2) >> CInt32x3GetElement(rhs, 2));
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  uint32_t count0 = (uint32_t)CInt32x3GetElement(rhs, 0);
+  uint32_t count1 = (uint32_t)CInt32x3GetElement(rhs, 1);
+  uint32_t count2 = (uint32_t)CInt32x3GetElement(rhs, 2);
+  return CInt32x3Make(CInt32x3GetElement(lhs, 0) >> (count0 < 32 ? count0 : 31),
+                      CInt32x3GetElement(lhs, 1) >> (count1 < 32 ? count1 : 31),
+                      CInt32x3GetElement(lhs, 2) >> (count2 < 32 ? count2 : 31));
 #endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits of rhs.
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
 FORCE_INLINE(CInt32x3)
 CInt32x3ShiftRight(const CInt32x3 lhs, const Int32 rhs)
 {
-#if CSIMDX_X86_MMX
-  return _mm_srli_epi32(lhs, rhs);
+#if CSIMDX_X86_SSE2
+  return _mm_srai_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs >> (Int32)((uint32_t)rhs < 32 ? rhs : 31);
 #else
   return CInt32x3ShiftRightElementWise(lhs, CInt32x3MakeRepeatingElement(rhs));
 #endif
 }
 
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CInt32x3){ popcount(operand[0]), popcount(operand[1]), ... }`
+FORCE_INLINE(CInt32x3) CInt32x3PopulationCount(const CInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  uint8x16_t count = vcntq_u8(vreinterpretq_u8_s32(operand));
+  return vreinterpretq_s32_u32(vpaddlq_u16(vpaddlq_u8(count)));
+#elif CSIMDX_X86_AVX512_VPOPCNTDQ
+  return _mm_popcnt_epi32(operand);
+#elif CSIMDX_X86_SSSE3
+  // Look up the bit count of each nibble, then sum up the bytes of each element
+  const __m128i table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  __m128i low = _mm_shuffle_epi8(table, _mm_and_si128(operand, nibble));
+  __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(operand, 4), nibble));
+  __m128i count = _mm_maddubs_epi16(_mm_add_epi8(low, high), _mm_set1_epi8(1));
+  return _mm_madd_epi16(count, _mm_set1_epi16(1));
+#elif CSIMDX_X86_SSE2
+  __m128i count = _mm_sub_epi32(operand, _mm_and_si128(_mm_srli_epi32(operand, 1), _mm_set1_epi32(0x55555555)));
+  count = _mm_add_epi32(_mm_and_si128(count, _mm_set1_epi32(0x33333333)),
+                        _mm_and_si128(_mm_srli_epi32(count, 2), _mm_set1_epi32(0x33333333)));
+  count = _mm_and_si128(_mm_add_epi32(count, _mm_srli_epi32(count, 4)), _mm_set1_epi32(0x0F0F0F0F));
+  count = _mm_add_epi32(count, _mm_srli_epi32(count, 8));
+  count = _mm_add_epi32(count, _mm_srli_epi32(count, 16));
+  return _mm_and_si128(count, _mm_set1_epi32(0x3F));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x3 bits = (CUInt32x3)operand;
+  bits = bits - ((bits >> 1) & 0x55555555);
+  bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+  bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+  return (CInt32x3)((bits * 0x01010101) >> 24);
+#else
+  return CInt32x3Make(__builtin_popcount((uint32_t)CInt32x3GetElement(operand, 0)),
+                      __builtin_popcount((uint32_t)CInt32x3GetElement(operand, 1)),
+                      __builtin_popcount((uint32_t)CInt32x3GetElement(operand, 2)));
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CInt32x3){ clz(operand[0]), clz(operand[1]), ... }`
+FORCE_INLINE(CInt32x3) CInt32x3LeadingZeroBitCount(const CInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vsetq_lane_s32(0, vclzq_s32(operand), 3);
+#elif CSIMDX_X86_SSE2
+  #if CSIMDX_X86_AVX512_CD
+  __m128i count = _mm_lzcnt_epi32(operand);
+  #else
+  // Smear the most significant set bit to the right, then count the set bits
+  __m128i smeared = _mm_or_si128(operand, _mm_srli_epi32(operand, 1));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 2));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 4));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 8));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 16));
+  __m128i count = _mm_sub_epi32(_mm_set1_epi32(32), CInt32x3PopulationCount(smeared));
+  #endif
+  // Clear the unused lane, which counted 32 leading zeros
+  return _mm_and_si128(count, _mm_setr_epi32(-1, -1, -1, 0));
+#elif CSIMDX_EXT_VECTOR
+  // Smear the highest set bit to the right and count the remaining zeros
+  CUInt32x3 bits = (CUInt32x3)operand;
+  bits |= bits >> 1;
+  bits |= bits >> 2;
+  bits |= bits >> 4;
+  bits |= bits >> 8;
+  bits |= bits >> 16;
+  return CInt32x3PopulationCount(CInt32x3BitwiseNot((CInt32x3)bits));
+#else
+  uint32_t element0 = (uint32_t)CInt32x3GetElement(operand, 0);
+  uint32_t element1 = (uint32_t)CInt32x3GetElement(operand, 1);
+  uint32_t element2 = (uint32_t)CInt32x3GetElement(operand, 2);
+  return CInt32x3Make(element0 ? __builtin_clz(element0) : 32,
+                      element1 ? __builtin_clz(element1) : 32,
+                      element2 ? __builtin_clz(element2) : 32);
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CInt32x3){ ctz(operand[0]), ctz(operand[1]), ... }`
+FORCE_INLINE(CInt32x3) CInt32x3TrailingZeroBitCount(const CInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vsetq_lane_s32(0, vclzq_s32(vreinterpretq_s32_u8(vrbitq_u8(vrev32q_u8(vreinterpretq_u8_s32(operand))))), 3);
+#elif CSIMDX_ARM_NEON
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  CInt32x3 lowest = vbicq_s32(vsubq_s32(operand, vdupq_n_s32(1)), operand);
+  return vsetq_lane_s32(0, CInt32x3PopulationCount(lowest), 3);
+#elif CSIMDX_X86_SSE2
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  __m128i lowest = _mm_andnot_si128(operand, _mm_sub_epi32(operand, _mm_set1_epi32(1)));
+  // Clear the unused lane, which counted 32 trailing zeros
+  return _mm_and_si128(CInt32x3PopulationCount(lowest), _mm_setr_epi32(-1, -1, -1, 0));
+#elif CSIMDX_EXT_VECTOR
+  // The trailing zeros are the bits set in ~x & (x - 1)
+  return CInt32x3PopulationCount(CInt32x3BitwiseNot(operand) & (CInt32x3)((CUInt32x3)operand - 1));
+#else
+  uint32_t element0 = (uint32_t)CInt32x3GetElement(operand, 0);
+  uint32_t element1 = (uint32_t)CInt32x3GetElement(operand, 1);
+  uint32_t element2 = (uint32_t)CInt32x3GetElement(operand, 2);
+  return CInt32x3Make(element0 ? __builtin_ctz(element0) : 32,
+                      element1 ? __builtin_ctz(element1) : 32,
+                      element2 ? __builtin_ctz(element2) : 32);
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CInt32x3){ bswap(operand[0]), bswap(operand[1]), ... }`
+FORCE_INLINE(CInt32x3) CInt32x3ByteSwap(const CInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u8(vrev32q_u8(vreinterpretq_u8_s32(operand)));
+#elif CSIMDX_X86_SSSE3
+  return _mm_shuffle_epi8(operand, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+#elif CSIMDX_X86_SSE2
+  __m128i swapped = _mm_shufflelo_epi16(operand, _MM_SHUFFLE(2, 3, 0, 1));
+  swapped = _mm_shufflehi_epi16(swapped, _MM_SHUFFLE(2, 3, 0, 1));
+  return _mm_or_si128(_mm_slli_epi16(swapped, 8), _mm_srli_epi16(swapped, 8));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x3 bits = (CUInt32x3)operand;
+  return (CInt32x3)((bits << 24) | ((bits & 0xFF00) << 8) | ((bits >> 8) & 0xFF00) | (bits >> 24));
+#else
+  return CInt32x3Make(__builtin_bswap32((uint32_t)CInt32x3GetElement(operand, 0)),
+                      __builtin_bswap32((uint32_t)CInt32x3GetElement(operand, 1)),
+                      __builtin_bswap32((uint32_t)CInt32x3GetElement(operand, 2)));
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CInt32x3){ bitreverse(operand[0]), bitreverse(operand[1]), ... }`
+FORCE_INLINE(CInt32x3) CInt32x3BitReverse(const CInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_s32_u8(vrbitq_u8(vrev32q_u8(vreinterpretq_u8_s32(operand))));
+#elif CSIMDX_ARM_NEON
+  // Swap adjacent bits, pairs of bits and nibbles, then the bytes
+  CInt32x3 result = vorrq_s32(vandq_s32(vshrq_n_s32(operand, 1), vdupq_n_s32(0x55555555)),
+                              vshlq_n_s32(vandq_s32(operand, vdupq_n_s32(0x55555555)), 1));
+  result = vorrq_s32(vandq_s32(vshrq_n_s32(result, 2), vdupq_n_s32(0x33333333)),
+                     vshlq_n_s32(vandq_s32(result, vdupq_n_s32(0x33333333)), 2));
+  result = vorrq_s32(vandq_s32(vshrq_n_s32(result, 4), vdupq_n_s32(0x0F0F0F0F)),
+                     vshlq_n_s32(vandq_s32(result, vdupq_n_s32(0x0F0F0F0F)), 4));
+  return CInt32x3ByteSwap(result);
+#elif CSIMDX_X86_SSSE3
+  // Look up the reversed nibbles of each byte, swapping them in the same go
+  const __m128i table = _mm_setr_epi8(0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+                                      0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  __m128i low = _mm_shuffle_epi8(_mm_slli_epi16(table, 4), _mm_and_si128(operand, nibble));
+  __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(operand, 4), nibble));
+  return CInt32x3ByteSwap(_mm_or_si128(low, high));
+#elif CSIMDX_X86_SSE2
+  // Swap adjacent bits, pairs of bits and nibbles, then the bytes
+  __m128i result = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(operand, 1), _mm_set1_epi32(0x55555555)),
+                                _mm_slli_epi32(_mm_and_si128(operand, _mm_set1_epi32(0x55555555)), 1));
+  result = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(result, 2), _mm_set1_epi32(0x33333333)),
+                        _mm_slli_epi32(_mm_and_si128(result, _mm_set1_epi32(0x33333333)), 2));
+  result = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(result, 4), _mm_set1_epi32(0x0F0F0F0F)),
+                        _mm_slli_epi32(_mm_and_si128(result, _mm_set1_epi32(0x0F0F0F0F)), 4));
+  return CInt32x3ByteSwap(result);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x3 bits = (CUInt32x3)operand;
+  bits = ((bits >> 1) & 0x55555555) | ((bits & 0x55555555) << 1);
+  bits = ((bits >> 2) & 0x33333333) | ((bits & 0x33333333) << 2);
+  bits = ((bits >> 4) & 0x0F0F0F0F) | ((bits & 0x0F0F0F0F) << 4);
+  return CInt32x3ByteSwap((CInt32x3)bits);
+#else
+  return CInt32x3Make(__builtin_bitreverse32((uint32_t)CInt32x3GetElement(operand, 0)),
+                      __builtin_bitreverse32((uint32_t)CInt32x3GetElement(operand, 1)),
+                      __builtin_bitreverse32((uint32_t)CInt32x3GetElement(operand, 2)));
+#endif
+}
+
 #undef Int32
@@ -0,0 +1,684 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit signed integer element
+#define Int32 int32_t
+
+/// The 4 x 32-bit signed integer storage
+#if CSIMDX_ARM_NEON
+typedef int32x4_t CInt32x4;
+#elif CSIMDX_X86_SSE2
+typedef __m128i CInt32x4;
+#elif CSIMDX_EXT_VECTOR
+typedef Int32 CInt32x4 CSIMDX_EXT_VECTOR_TYPE(Int32, 4);
+#else
+typedef struct CInt32x4_t {
+  Int32 rawValue[4];
+} CInt32x4;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(Int32)
+CInt32x4GetElement(const CInt32x4 storage, const int index)
+{
+#if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
+  return ((Int32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  return storage.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CInt32x4SetElement(CInt32x4* storage, const int index, const Int32 value)
+{
+#if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
+  ((Int32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  (storage->rawValue)[index] = value;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Initializes a storage to given elements. Least- to most-significant bits.
+/// @return `(CInt32x4){ element0, element1, element2, element3 }`
+FORCE_INLINE(CInt32x4)
+CInt32x4Make(Int32 element0, Int32 element1, Int32 element2, Int32 element3)
+{
+#if CSIMDX_X86_SSE2
+  return _mm_setr_epi32(element0, element1, element2, element3);
+#else
+  return (CInt32x4){ element0, element1, element2, element3 };
+#endif
+}
+
+/// Loads 4 x Int32 values from unaligned memory.
+/// @return `(CInt32x4){ pointer[0], pointer[1], pointer[2], pointer[3] }`
+FORCE_INLINE(CInt32x4)
+CInt32x4MakeLoad(const Int32* pointer)
+{
+#if CSIMDX_ARM_NEON
+  return vld1q_s32(pointer);
+#elif CSIMDX_X86_SSE2
+  return _mm_loadu_si128((__m128i*)pointer);
+#elif CSIMDX_EXT_VECTOR
+  CInt32x4 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  return CInt32x4Make(pointer[0], pointer[1], pointer[2], pointer[3]);
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CInt32x4){ value, value, value, value }`
+FORCE_INLINE(CInt32x4)
+CInt32x4MakeRepeatingElement(const Int32 value)
+{
+#if CSIMDX_ARM_NEON
+  return vdupq_n_s32(value);
+#elif CSIMDX_X86_SSE2
+  return _mm_set1_epi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4){ value, value, value, value };
+#else
+  return CInt32x4Make(value, value, value, value);
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0).
+/// @return `(CInt32x4){ 0, 0, 0, 0 }`
+FORCE_INLINE(CInt32x4) CInt32x4MakeZero(void)
+{
+#if CSIMDX_ARM_NEON
+  return vdupq_n_s32(0);
+#elif CSIMDX_X86_SSE2
+  return _mm_setzero_si128();
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4){ 0 };
+#else
+  return CInt32x4MakeRepeatingElement(0);
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return
+///   (CInt32x4){
+///     lhs[0] < rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] < rhs[1] ? lhs[1] : rhs[1]
+///   }
+FORCE_INLINE(CInt32x4)
+CInt32x4Minimum(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vminq_s32(lhs, rhs);
+#elif CSIMDX_X86_SSE4_1 // SSE2 has no `min` function, but SSE4 does.
+  return _mm_min_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Select from both storages by the mask of the signed comparison
+  __m128i mask = _mm_cmplt_epi32(lhs, rhs);
+  return _mm_or_si128(_mm_and_si128(mask, lhs), _mm_andnot_si128(mask, rhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CInt32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  Int32 lhs0 = CInt32x4GetElement(lhs, 0);
+  Int32 rhs0 = CInt32x4GetElement(rhs, 0);
+  Int32 lhs1 = CInt32x4GetElement(lhs, 1);
+  Int32 rhs1 = CInt32x4GetElement(rhs, 1);
+  Int32 lhs2 = CInt32x4GetElement(lhs, 2);
+  Int32 rhs2 = CInt32x4GetElement(rhs, 2);
+  Int32 lhs3 = CInt32x4GetElement(lhs, 3);
+  Int32 rhs3 = CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make(lhs0 < rhs0 ? lhs0 : rhs0,
+                      lhs1 < rhs1 ? lhs1 : rhs1,
+                      lhs2 < rhs2 ? lhs2 : rhs2,
+                      lhs3 < rhs3 ? lhs3 : rhs3);
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return
+///   (CInt32x4){
+///     lhs[0] > rhs[0] ? lhs[0] : rhs[0],
+///     lhs[1] > rhs[1] ? lhs[1] : rhs[1]
+///   }
+FORCE_INLINE(CInt32x4)
+CInt32x4Maximum(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vmaxq_s32(lhs, rhs);
+#elif CSIMDX_X86_SSE4_1 // SSE2 has no `max` function, but SSE4 does.
+  return _mm_max_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Select from both storages by the mask of the signed comparison
+  __m128i mask = _mm_cmpgt_epi32(lhs, rhs);
+  return _mm_or_si128(_mm_and_si128(mask, lhs), _mm_andnot_si128(mask, rhs));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CInt32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  Int32 lhs0 = CInt32x4GetElement(lhs, 0);
+  Int32 rhs0 = CInt32x4GetElement(rhs, 0);
+  Int32 lhs1 = CInt32x4GetElement(lhs, 1);
+  Int32 rhs1 = CInt32x4GetElement(rhs, 1);
+  Int32 lhs2 = CInt32x4GetElement(lhs, 2);
+  Int32 rhs2 = CInt32x4GetElement(rhs, 2);
+  Int32 lhs3 = CInt32x4GetElement(lhs, 3);
+  Int32 rhs3 = CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make(lhs0 > rhs0 ? lhs0 : rhs0,
+                      lhs1 > rhs1 ? lhs1 : rhs1,
+                      lhs2 > rhs2 ? lhs2 : rhs2,
+                      lhs3 > rhs3 ? lhs3 : rhs3);
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
+/// @return `(CInt32x4){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
+FORCE_INLINE(CInt32x4)
+CInt32x4CompareElementWise(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vceqq_s32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_cmpeq_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs == rhs);
+#else
+  Int32 lhs0 = CInt32x4GetElement(lhs, 0);
+  Int32 rhs0 = CInt32x4GetElement(rhs, 0);
+  Int32 lhs1 = CInt32x4GetElement(lhs, 1);
+  Int32 rhs1 = CInt32x4GetElement(rhs, 1);
+  Int32 lhs2 = CInt32x4GetElement(lhs, 2);
+  Int32 rhs2 = CInt32x4GetElement(rhs, 2);
+  Int32 lhs3 = CInt32x4GetElement(lhs, 3);
+  Int32 rhs3 = CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make(-(Int32)(lhs0 == rhs0),
+                      -(Int32)(lhs1 == rhs1),
+                      -(Int32)(lhs2 == rhs2),
+                      -(Int32)(lhs3 == rhs3));
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3]`
+FORCE_INLINE(bool)
+CInt32x4Equal(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminvq_u32(vceqq_s32(lhs, rhs)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x4_t mask = vceqq_s32(lhs, rhs);
+  uint32x2_t half = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+  return vget_lane_u32(vpmin_u32(half, half), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  return _mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)) == 0xFFFF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2] & mask[3]) != 0;
+#else
+  return CInt32x4GetElement(lhs, 0) == CInt32x4GetElement(rhs, 0)
+      && CInt32x4GetElement(lhs, 1) == CInt32x4GetElement(rhs, 1)
+      && CInt32x4GetElement(lhs, 2) == CInt32x4GetElement(rhs, 2)
+      && CInt32x4GetElement(lhs, 3) == CInt32x4GetElement(rhs, 3);
+#endif
+}
+
+/// Returns the negated storage (element-wise).
+/// @return `(CInt32x4){ -(operand[0]), -(operand[1]), -(operand[2]), -(operand[3]) }`
+FORCE_INLINE(CInt32x4) CInt32x4Negate(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vnegq_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_sub_epi32(CInt32x4MakeZero(), operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(-(CUInt32x4)operand);
+#else
+  return CInt32x4Make(-CInt32x4GetElement(operand, 0),
+                      -CInt32x4GetElement(operand, 1),
+                      -CInt32x4GetElement(operand, 2),
+                      -CInt32x4GetElement(operand, 3));
+#endif
+}
+
+/// Returns the absolute storage (element-wise).
+/// @return `(CUInt32x4){ abs(operand[0]), abs(operand[1]), abs(operand[2]), abs(operand[3]) }`
+FORCE_INLINE(CUInt32x4)
+CInt32x4Magnitude(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_u32_s32(vabsq_s32(operand));
+#elif CSIMDX_X86_SSE3 // MMX has no `abs` function for __m64, but SSE3 does
+  return _mm_abs_epi32(operand);
+#elif CSIMDX_X86_SSE2
+  // Flip the bits of the negative elements and add one to them
+  __m128i sign = _mm_srai_epi32(operand, 31);
+  return _mm_sub_epi32(_mm_xor_si128(operand, sign), sign);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x4 sign = (CUInt32x4)(operand >> 31);
+  return ((CUInt32x4)operand ^ sign) - sign;
+#else
+  return CUInt32x4Make(__builtin_abs(CInt32x4GetElement(operand, 0)),
+                       __builtin_abs(CInt32x4GetElement(operand, 1)),
+                       __builtin_abs(CInt32x4GetElement(operand, 2)),
+                       __builtin_abs(CInt32x4GetElement(operand, 3)));
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CInt32x4){ lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3] }`
+FORCE_INLINE(CInt32x4)
+CInt32x4Add(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vaddq_s32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  return _mm_add_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)((CUInt32x4)lhs + (CUInt32x4)rhs);
+#else
+  Int32 lhs0 = CInt32x4GetElement(lhs, 0);
+  Int32 rhs0 = CInt32x4GetElement(rhs, 0);
+  Int32 lhs1 = CInt32x4GetElement(lhs, 1);
+  Int32 rhs1 = CInt32x4GetElement(rhs, 1);
+  Int32 lhs2 = CInt32x4GetElement(lhs, 2);
+  Int32 rhs2 = CInt32x4GetElement(rhs, 2);
+  Int32 lhs3 = CInt32x4GetElement(lhs, 3);
+  Int32 rhs3 = CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make(lhs0 + rhs0, lhs1 + rhs1, lhs2 + rhs2, lhs3 + rhs3);
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CInt32x4){ lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3] }`
+FORCE_INLINE(CInt32x4)
+CInt32x4Subtract(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vsubq_s32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  return _mm_sub_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)((CUInt32x4)lhs - (CUInt32x4)rhs);
+#else
+  Int32 lhs0 = CInt32x4GetElement(lhs, 0);
+  Int32 rhs0 = CInt32x4GetElement(rhs, 0);
+  Int32 lhs1 = CInt32x4GetElement(lhs, 1);
+  Int32 rhs1 = CInt32x4GetElement(rhs, 1);
+  Int32 lhs2 = CInt32x4GetElement(lhs, 2);
+  Int32 rhs2 = CInt32x4GetElement(rhs, 2);
+  Int32 lhs3 = CInt32x4GetElement(lhs, 3);
+  Int32 rhs3 = CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make(lhs0 - rhs0, lhs1 - rhs1, lhs2 - rhs2, lhs3 - rhs3);
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise), wrapping around on overflow.
+/// @return `(CInt32x4){ lhs[0] * rhs[0], lhs[1] * rhs[1], lhs[2] * rhs[2], lhs[3] * rhs[3] }`
+FORCE_INLINE(CInt32x4)
+CInt32x4Multiply(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vmulq_s32(lhs, rhs);
+#elif CSIMDX_X86_SSE4_1
+  return _mm_mullo_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Multiply the even and the odd elements into 64 bits each, then pick the
+  // low 32 bits of each product, which are the same for signed elements.
+  __m128i even = _mm_mul_epu32(lhs, rhs);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)((CUInt32x4)lhs * (CUInt32x4)rhs);
+#else
+  uint32_t lhs0 = (uint32_t)CInt32x4GetElement(lhs, 0);
+  uint32_t rhs0 = (uint32_t)CInt32x4GetElement(rhs, 0);
+  uint32_t lhs1 = (uint32_t)CInt32x4GetElement(lhs, 1);
+  uint32_t rhs1 = (uint32_t)CInt32x4GetElement(rhs, 1);
+  uint32_t lhs2 = (uint32_t)CInt32x4GetElement(lhs, 2);
+  uint32_t rhs2 = (uint32_t)CInt32x4GetElement(rhs, 2);
+  uint32_t lhs3 = (uint32_t)CInt32x4GetElement(lhs, 3);
+  uint32_t rhs3 = (uint32_t)CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make((Int32)(lhs0 * rhs0), (Int32)(lhs1 * rhs1),
+                      (Int32)(lhs2 * rhs2), (Int32)(lhs3 * rhs3));
+#endif
+}
+
+#pragma mark - Bitwise
+
+/// Bitwise Not
+FORCE_INLINE(CInt32x4) CInt32x4BitwiseNot(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vmvnq_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_xor_si128(operand, CInt32x4MakeRepeatingElement(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
+#else
+  return CInt32x4Make(~CInt32x4GetElement(operand, 0),
+                      ~CInt32x4GetElement(operand, 1),
+                      ~CInt32x4GetElement(operand, 2),
+                      ~CInt32x4GetElement(operand, 3));
+#endif
+}
+
+/// Bitwise And
+FORCE_INLINE(CInt32x4)
+CInt32x4BitwiseAnd(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vandq_s32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  return _mm_and_si128(rhs, lhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
+#else
+  return CInt32x4Make(CInt32x4GetElement(lhs, 0) & CInt32x4GetElement(rhs, 0),
+                      CInt32x4GetElement(lhs, 1) & CInt32x4GetElement(rhs, 1),
+                      CInt32x4GetElement(lhs, 2) & CInt32x4GetElement(rhs, 2),
+                      CInt32x4GetElement(lhs, 3) & CInt32x4GetElement(rhs, 3));
+#endif
+}
+
+/// Bitwise And Not
+FORCE_INLINE(CInt32x4)
+CInt32x4BitwiseAndNot(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_X86_MMX
+  return _mm_andnot_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
+#else
+  return CInt32x4BitwiseAnd(CInt32x4BitwiseNot(lhs), rhs);
+#endif
+}
+
+/// Bitwise Or
+FORCE_INLINE(CInt32x4)
+CInt32x4BitwiseOr(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vorrq_s32(lhs, rhs);
+#elif CSIMDX_X86_MMX
+  return _mm_or_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
+#else
+  return CInt32x4Make(CInt32x4GetElement(lhs, 0) | CInt32x4GetElement(rhs, 0),
+                      CInt32x4GetElement(lhs, 1) | CInt32x4GetElement(rhs, 1),
+                      CInt32x4GetElement(lhs, 2) | CInt32x4GetElement(rhs, 2),
+                      CInt32x4GetElement(lhs, 3) | CInt32x4GetElement(rhs, 3));
+#endif
+}
+
+/// Bitwise Exclusive Or
+FORCE_INLINE(CInt32x4)
+CInt32x4BitwiseExclusiveOr(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return veorq_s32(lhs, rhs);
+#elif CSIMDX_X86_MMX
+  return _mm_xor_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
+#else
+  return CInt32x4Make(CInt32x4GetElement(lhs, 0) ^ CInt32x4GetElement(rhs, 0),
+                      CInt32x4GetElement(lhs, 1) ^ CInt32x4GetElement(rhs, 1),
+                      CInt32x4GetElement(lhs, 2) ^ CInt32x4GetElement(rhs, 2),
+                      CInt32x4GetElement(lhs, 3) ^ CInt32x4GetElement(rhs, 3));
+#endif
+}
+
+#pragma mark Shifting
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero, as does a negative count, which is taken as an unsigned one.
+FORCE_INLINE(CInt32x4)
+CInt32x4ShiftLeftElementWise(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshlq_s32(lhs, vreinterpretq_s32_u32(vminq_u32(vreinterpretq_u32_s32(rhs), vdupq_n_u32(32))));
+#elif CSIMDX_X86_AVX2
+  return _mm_sllv_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Multiplies by 2^rhs, built from the exponent bits of a 32-bit float. 2^31
+  // does not fit the signed conversion, but -2^31 does and is equal modulo 2^32.
+  __m128i sign = _mm_slli_epi32(_mm_cmpeq_epi32(rhs, _mm_set1_epi32(31)), 31);
+  __m128i exponent = _mm_add_epi32(_mm_slli_epi32(rhs, 23), _mm_set1_epi32(0x3F800000));
+  exponent = _mm_or_si128(exponent, sign);
+  __m128i power = _mm_cvttps_epi32(_mm_castsi128_ps(exponent));
+  // Clear the lanes shifted by 32 or more bits, i.e. where `rhs & ~31` is non-zero
+  __m128i inRange = _mm_cmpeq_epi32(_mm_and_si128(rhs, _mm_set1_epi32(~31)), _mm_setzero_si128());
+  return _mm_and_si128(CInt32x4Multiply(lhs, power), inRange);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x4 count = (CUInt32x4)rhs;
+  return (CInt32x4)(((CUInt32x4)lhs << (count & 31)) & (CUInt32x4)(count < 32));
+#else
+  // Shifting by the element width or more is undefined, clear those lanes
+  uint32_t count0 = (uint32_t)CInt32x4GetElement(rhs, 0);
+  uint32_t count1 = (uint32_t)CInt32x4GetElement(rhs, 1);
+  uint32_t count2 = (uint32_t)CInt32x4GetElement(rhs, 2);
+  uint32_t count3 = (uint32_t)CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make(count0 < 32 ? (Int32)((uint32_t)CInt32x4GetElement(lhs, 0) << count0) : 0,
+                      count1 < 32 ? (Int32)((uint32_t)CInt32x4GetElement(lhs, 1) << count1) : 0,
+                      count2 < 32 ? (Int32)((uint32_t)CInt32x4GetElement(lhs, 2) << count2) : 0,
+                      count3 < 32 ? (Int32)((uint32_t)CInt32x4GetElement(lhs, 3) << count3) : 0);
+#endif
+}
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits of rhs.
+FORCE_INLINE(CInt32x4)
+CInt32x4ShiftLeft(const CInt32x4 lhs, const Int32 rhs)
+{
+#if CSIMDX_X86_SSE2
+  return _mm_slli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (uint32_t)rhs < 32 ? (CInt32x4)((CUInt32x4)lhs << rhs) : (CInt32x4){ 0 };
+#else
+  return CInt32x4ShiftLeftElementWise(lhs, CInt32x4MakeRepeatingElement(rhs));
+#endif
+}
+
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with the sign bit, as does a negative count, which is
+/// taken as an unsigned one.
+FORCE_INLINE(CInt32x4)
+CInt32x4ShiftRightElementWise(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshlq_s32(lhs, vnegq_s32(vreinterpretq_s32_u32(vminq_u32(vreinterpretq_u32_s32(rhs), vdupq_n_u32(32)))));
+#elif CSIMDX_X86_AVX2
+  return _mm_srav_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Shifts the whole storage by the count of each lane, which is read from the
+  // low 64 bits of the count operand, then picks each lane from its own shift.
+  const __m128i zero = _mm_setzero_si128();
+  __m128i low = _mm_unpacklo_epi32(rhs, zero);
+  __m128i high = _mm_unpackhi_epi32(rhs, zero);
+  __m128i shifted0 = _mm_sra_epi32(lhs, low);
+  __m128i shifted1 = _mm_sra_epi32(lhs, _mm_srli_si128(low, 8));
+  __m128i shifted2 = _mm_sra_epi32(lhs, high);
+  __m128i shifted3 = _mm_sra_epi32(lhs, _mm_srli_si128(high, 8));
+  __m128 lowPair = _mm_castsi128_ps(_mm_unpacklo_epi64(shifted0, shifted1));
+  __m128 highPair = _mm_castsi128_ps(_mm_unpackhi_epi64(shifted2, shifted3));
+  return _mm_castps_si128(_mm_shuffle_ps(lowPair, highPair, _MM_SHUFFLE(3, 0, 3, 0)));
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  CUInt32x4 count = (CUInt32x4)rhs;
+  return lhs >> (CInt32x4)(((count & 31) | (CUInt32x4)(count > 31)) & 31);
+#else
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  uint32_t count0 = (uint32_t)CInt32x4GetElement(rhs, 0);
+  uint32_t count1 = (uint32_t)CInt32x4GetElement(rhs, 1);
+  uint32_t count2 = (uint32_t)CInt32x4GetElement(rhs, 2);
+  uint32_t count3 = (uint32_t)CInt32x4GetElement(rhs, 3);
+  return CInt32x4Make(CInt32x4GetElement(lhs, 0) >> (count0 < 32 ? count0 : 31),
+                      CInt32x4GetElement(lhs, 1) >> (count1 < 32 ? count1 : 31),
+                      CInt32x4GetElement(lhs, 2) >> (count2 < 32 ? count2 : 31),
+                      CInt32x4GetElement(lhs, 3) >> (count3 < 32 ? count3 : 31));
+#endif
+}
+
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
+FORCE_INLINE(CInt32x4)
+CInt32x4ShiftRight(const CInt32x4 lhs, const Int32 rhs)
+{
+#if CSIMDX_X86_SSE2
+  return _mm_srai_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs >> (Int32)((uint32_t)rhs < 32 ? rhs : 31);
+#else
+  return CInt32x4ShiftRightElementWise(lhs, CInt32x4MakeRepeatingElement(rhs));
+#endif
+}
+
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CInt32x4){ popcount(operand[0]), popcount(operand[1]), ... }`
+FORCE_INLINE(CInt32x4) CInt32x4PopulationCount(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  uint8x16_t count = vcntq_u8(vreinterpretq_u8_s32(operand));
+  return vreinterpretq_s32_u32(vpaddlq_u16(vpaddlq_u8(count)));
+#elif CSIMDX_X86_SSE2
+  return CUInt32x4PopulationCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)CUInt32x4PopulationCount((CUInt32x4)operand);
+#else
+  return CInt32x4Make(__builtin_popcount((uint32_t)CInt32x4GetElement(operand, 0)),
+                      __builtin_popcount((uint32_t)CInt32x4GetElement(operand, 1)),
+                      __builtin_popcount((uint32_t)CInt32x4GetElement(operand, 2)),
+                      __builtin_popcount((uint32_t)CInt32x4GetElement(operand, 3)));
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CInt32x4){ clz(operand[0]), clz(operand[1]), ... }`
+FORCE_INLINE(CInt32x4) CInt32x4LeadingZeroBitCount(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vclzq_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return CUInt32x4LeadingZeroBitCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)CUInt32x4LeadingZeroBitCount((CUInt32x4)operand);
+#else
+  uint32_t element0 = (uint32_t)CInt32x4GetElement(operand, 0);
+  uint32_t element1 = (uint32_t)CInt32x4GetElement(operand, 1);
+  uint32_t element2 = (uint32_t)CInt32x4GetElement(operand, 2);
+  uint32_t element3 = (uint32_t)CInt32x4GetElement(operand, 3);
+  return CInt32x4Make(element0 ? __builtin_clz(element0) : 32,
+                      element1 ? __builtin_clz(element1) : 32,
+                      element2 ? __builtin_clz(element2) : 32,
+                      element3 ? __builtin_clz(element3) : 32);
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CInt32x4){ ctz(operand[0]), ctz(operand[1]), ... }`
+FORCE_INLINE(CInt32x4) CInt32x4TrailingZeroBitCount(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(CUInt32x4TrailingZeroBitCount(vreinterpretq_u32_s32(operand)));
+#elif CSIMDX_X86_SSE2
+  return CUInt32x4TrailingZeroBitCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)CUInt32x4TrailingZeroBitCount((CUInt32x4)operand);
+#else
+  uint32_t element0 = (uint32_t)CInt32x4GetElement(operand, 0);
+  uint32_t element1 = (uint32_t)CInt32x4GetElement(operand, 1);
+  uint32_t element2 = (uint32_t)CInt32x4GetElement(operand, 2);
+  uint32_t element3 = (uint32_t)CInt32x4GetElement(operand, 3);
+  return CInt32x4Make(element0 ? __builtin_ctz(element0) : 32,
+                      element1 ? __builtin_ctz(element1) : 32,
+                      element2 ? __builtin_ctz(element2) : 32,
+                      element3 ? __builtin_ctz(element3) : 32);
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CInt32x4){ bswap(operand[0]), bswap(operand[1]), ... }`
+FORCE_INLINE(CInt32x4) CInt32x4ByteSwap(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u8(vrev32q_u8(vreinterpretq_u8_s32(operand)));
+#elif CSIMDX_X86_SSE2
+  return CUInt32x4ByteSwap(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)CUInt32x4ByteSwap((CUInt32x4)operand);
+#else
+  return CInt32x4Make(__builtin_bswap32((uint32_t)CInt32x4GetElement(operand, 0)),
+                      __builtin_bswap32((uint32_t)CInt32x4GetElement(operand, 1)),
+                      __builtin_bswap32((uint32_t)CInt32x4GetElement(operand, 2)),
+                      __builtin_bswap32((uint32_t)CInt32x4GetElement(operand, 3)));
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CInt32x4){ bitreverse(operand[0]), bitreverse(operand[1]), ... }`
+FORCE_INLINE(CInt32x4) CInt32x4BitReverse(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(CUInt32x4BitReverse(vreinterpretq_u32_s32(operand)));
+#elif CSIMDX_X86_SSE2
+  return CUInt32x4BitReverse(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)CUInt32x4BitReverse((CUInt32x4)operand);
+#else
+  return CInt32x4Make(__builtin_bitreverse32((uint32_t)CInt32x4GetElement(operand, 0)),
+                      __builtin_bitreverse32((uint32_t)CInt32x4GetElement(operand, 1)),
+                      __builtin_bitreverse32((uint32_t)CInt32x4GetElement(operand, 2)),
+                      __builtin_bitreverse32((uint32_t)CInt32x4GetElement(operand, 3)));
+#endif
+}
+
+#undef Int32
@@ -0,0 +1,576 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit signed integer element
+#define Int32 int32_t
+
+/// The 8 x 32-bit signed integer storage, a single register where the target
+/// has 256-bit integer registers and two CInt32x4 otherwise
+#if CSIMDX_X86_AVX2
+typedef __m256i CInt32x8;
+#elif CSIMDX_EXT_VECTOR
+typedef Int32 CInt32x8 CSIMDX_EXT_VECTOR_TYPE(Int32, 8);
+#else
+typedef struct CInt32x8_t {
+  CInt32x4 lo, hi;
+} CInt32x8;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(Int32)
+CInt32x8GetElement(const CInt32x8 storage, const int index)
+{
+#if CSIMDX_X86_AVX2
+  return ((Int32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  union { CInt32x8 storage; Int32 rawValue[8]; } Union;
+  Union.storage = storage;
+  return Union.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CInt32x8SetElement(CInt32x8* storage, const int index, const Int32 value)
+{
+#if CSIMDX_X86_AVX2
+  ((Int32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  union { CInt32x8* storage; Int32* rawValue; } Union;
+  Union.storage = storage;
+  Union.rawValue[index] = value;
+#endif
+}
+
+#pragma mark Lanes
+
+/// Returns the lower half of `storage`.
+/// @return `(CInt32x4){ storage[0], ..., storage[3] }`
+FORCE_INLINE(CInt32x4) CInt32x8GetLow(const CInt32x8 storage)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castsi256_si128(storage);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 0, 1, 2, 3);
+#else
+  return storage.lo;
+#endif
+}
+
+/// Returns the upper half of `storage`.
+/// @return `(CInt32x4){ storage[4], ..., storage[7] }`
+FORCE_INLINE(CInt32x4) CInt32x8GetHigh(const CInt32x8 storage)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_extracti128_si256(storage, 1);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 4, 5, 6, 7);
+#else
+  return storage.hi;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Initializes a storage to given elements. Least- to most-significant bits.
+/// @return `(CInt32x8){ element0, element1, ..., element7 }`
+FORCE_INLINE(CInt32x8)
+CInt32x8Make(Int32 element0, Int32 element1, Int32 element2, Int32 element3,
+             Int32 element4, Int32 element5, Int32 element6, Int32 element7)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_setr_epi32(element0, element1, element2, element3,
+                           element4, element5, element6, element7);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8){ element0, element1, element2, element3,
+                     element4, element5, element6, element7 };
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Make(element0, element1, element2, element3);
+  result.hi = CInt32x4Make(element4, element5, element6, element7);
+  return result;
+#endif
+}
+
+/// Loads 8 x Int32 values from unaligned memory.
+/// @return `(CInt32x8){ pointer[0], pointer[1], ..., pointer[7] }`
+FORCE_INLINE(CInt32x8)
+CInt32x8MakeLoad(const Int32* pointer)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_loadu_si256((const __m256i*)pointer);
+#elif CSIMDX_EXT_VECTOR
+  CInt32x8 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4MakeLoad(pointer);
+  result.hi = CInt32x4MakeLoad(&pointer[4]);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CInt32x8){ value, value, ..., value }`
+FORCE_INLINE(CInt32x8) CInt32x8MakeRepeatingElement(const Int32 value)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_set1_epi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8){ value, value, value, value, value, value, value, value };
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4MakeRepeatingElement(value);
+  result.hi = CInt32x4MakeRepeatingElement(value);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0).
+/// @return `(CInt32x8){ 0, 0, ..., 0 }`
+FORCE_INLINE(CInt32x8) CInt32x8MakeZero(void)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_setzero_si256();
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8){ 0 };
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4MakeZero();
+  result.hi = CInt32x4MakeZero();
+  return result;
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return `(CInt32x8){ lhs[0] < rhs[0] ? lhs[0] : rhs[0], ..., lhs[7] < rhs[7] ? lhs[7] : rhs[7] }`
+FORCE_INLINE(CInt32x8)
+CInt32x8Minimum(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_min_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CInt32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Minimum(lhs.lo, rhs.lo);
+  result.hi = CInt32x4Minimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return `(CInt32x8){ lhs[0] > rhs[0] ? lhs[0] : rhs[0], ..., lhs[7] > rhs[7] ? lhs[7] : rhs[7] }`
+FORCE_INLINE(CInt32x8)
+CInt32x8Maximum(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_max_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CInt32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Maximum(lhs.lo, rhs.lo);
+  result.hi = CInt32x4Maximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
+/// @return `(CInt32x8){ lhs[0] == rhs[0], lhs[1] == rhs[1], ..., lhs[7] == rhs[7] }`
+FORCE_INLINE(CInt32x8)
+CInt32x8CompareElementWise(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_cmpeq_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs == rhs);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4CompareElementWise(lhs.lo, rhs.lo);
+  result.hi = CInt32x4CompareElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && ... && lhs[7] == rhs[7]`
+FORCE_INLINE(bool)
+CInt32x8Equal(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi32(lhs, rhs)) == 0xFFFFFFFF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2] & mask[3] & mask[4] & mask[5] & mask[6] & mask[7]) != 0;
+#else
+  return CInt32x4Equal(lhs.lo, rhs.lo) && CInt32x4Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+/// Returns the negated storage (element-wise).
+/// @return `(CInt32x8){ -(operand[0]), -(operand[1]), ..., -(operand[7]) }`
+FORCE_INLINE(CInt32x8) CInt32x8Negate(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_sub_epi32(_mm256_setzero_si256(), operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(-(CUInt32x8)operand);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Negate(operand.lo);
+  result.hi = CInt32x4Negate(operand.hi);
+  return result;
+#endif
+}
+
+/// Returns the absolute storage (element-wise).
+/// @return `(CUInt32x8){ abs(operand[0]), abs(operand[1]), ..., abs(operand[7]) }`
+FORCE_INLINE(CUInt32x8)
+CInt32x8Magnitude(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_abs_epi32(operand);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x8 sign = (CUInt32x8)(operand >> 31);
+  return ((CUInt32x8)operand ^ sign) - sign;
+#else
+  CUInt32x8 result;
+  result.lo = CInt32x4Magnitude(operand.lo);
+  result.hi = CInt32x4Magnitude(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CInt32x8){ lhs[0] + rhs[0], lhs[1] + rhs[1], ..., lhs[7] + rhs[7] }`
+FORCE_INLINE(CInt32x8)
+CInt32x8Add(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_add_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Add(lhs.lo, rhs.lo);
+  result.hi = CInt32x4Add(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CInt32x8){ lhs[0] - rhs[0], lhs[1] - rhs[1], ..., lhs[7] - rhs[7] }`
+FORCE_INLINE(CInt32x8)
+CInt32x8Subtract(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_sub_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Subtract(lhs.lo, rhs.lo);
+  result.hi = CInt32x4Subtract(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise), wrapping around on overflow.
+/// @return `(CInt32x8){ lhs[0] * rhs[0], lhs[1] * rhs[1], ..., lhs[7] * rhs[7] }`
+FORCE_INLINE(CInt32x8)
+CInt32x8Multiply(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_mullo_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)((CUInt32x8)lhs * (CUInt32x8)rhs);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Multiply(lhs.lo, rhs.lo);
+  result.hi = CInt32x4Multiply(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Bitwise
+
+/// Bitwise Not
+FORCE_INLINE(CInt32x8) CInt32x8BitwiseNot(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_xor_si256(operand, _mm256_set1_epi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4BitwiseNot(operand.lo);
+  result.hi = CInt32x4BitwiseNot(operand.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And
+FORCE_INLINE(CInt32x8)
+CInt32x8BitwiseAnd(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_and_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4BitwiseAnd(lhs.lo, rhs.lo);
+  result.hi = CInt32x4BitwiseAnd(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And Not
+FORCE_INLINE(CInt32x8)
+CInt32x8BitwiseAndNot(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_andnot_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4BitwiseAndNot(lhs.lo, rhs.lo);
+  result.hi = CInt32x4BitwiseAndNot(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Or
+FORCE_INLINE(CInt32x8)
+CInt32x8BitwiseOr(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_or_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4BitwiseOr(lhs.lo, rhs.lo);
+  result.hi = CInt32x4BitwiseOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Exclusive Or
+FORCE_INLINE(CInt32x8)
+CInt32x8BitwiseExclusiveOr(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_xor_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4BitwiseExclusiveOr(lhs.lo, rhs.lo);
+  result.hi = CInt32x4BitwiseExclusiveOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Shifting
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero, as does a negative count, which is taken as an unsigned one.
+FORCE_INLINE(CInt32x8)
+CInt32x8ShiftLeftElementWise(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_sllv_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x8 count = (CUInt32x8)rhs;
+  return (CInt32x8)(((CUInt32x8)lhs << (count & 31)) & (CUInt32x8)(count < 32));
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4ShiftLeftElementWise(lhs.lo, rhs.lo);
+  result.hi = CInt32x4ShiftLeftElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits of rhs.
+FORCE_INLINE(CInt32x8)
+CInt32x8ShiftLeft(const CInt32x8 lhs, const Int32 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_slli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (uint32_t)rhs < 32 ? (CInt32x8)((CUInt32x8)lhs << rhs) : (CInt32x8){ 0 };
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4ShiftLeft(lhs.lo, rhs);
+  result.hi = CInt32x4ShiftLeft(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with the sign bit, as does a negative count, which is
+/// taken as an unsigned one.
+FORCE_INLINE(CInt32x8)
+CInt32x8ShiftRightElementWise(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_srav_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, shift by 31 instead
+  CUInt32x8 count = (CUInt32x8)rhs;
+  return lhs >> (CInt32x8)(((count & 31) | (CUInt32x8)(count > 31)) & 31);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4ShiftRightElementWise(lhs.lo, rhs.lo);
+  result.hi = CInt32x4ShiftRightElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Right-shifts (arithmetic) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
+FORCE_INLINE(CInt32x8)
+CInt32x8ShiftRight(const CInt32x8 lhs, const Int32 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_srai_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs >> (Int32)((uint32_t)rhs < 32 ? rhs : 31);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4ShiftRight(lhs.lo, rhs);
+  result.hi = CInt32x4ShiftRight(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CInt32x8){ popcount(operand[0]), popcount(operand[1]), ..., popcount(operand[7]) }`
+FORCE_INLINE(CInt32x8) CInt32x8PopulationCount(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return CUInt32x8PopulationCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)CUInt32x8PopulationCount((CUInt32x8)operand);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4PopulationCount(operand.lo);
+  result.hi = CInt32x4PopulationCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CInt32x8){ clz(operand[0]), clz(operand[1]), ..., clz(operand[7]) }`
+FORCE_INLINE(CInt32x8) CInt32x8LeadingZeroBitCount(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return CUInt32x8LeadingZeroBitCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)CUInt32x8LeadingZeroBitCount((CUInt32x8)operand);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4LeadingZeroBitCount(operand.lo);
+  result.hi = CInt32x4LeadingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CInt32x8){ ctz(operand[0]), ctz(operand[1]), ..., ctz(operand[7]) }`
+FORCE_INLINE(CInt32x8) CInt32x8TrailingZeroBitCount(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return CUInt32x8TrailingZeroBitCount(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)CUInt32x8TrailingZeroBitCount((CUInt32x8)operand);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4TrailingZeroBitCount(operand.lo);
+  result.hi = CInt32x4TrailingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CInt32x8){ bswap(operand[0]), bswap(operand[1]), ..., bswap(operand[7]) }`
+FORCE_INLINE(CInt32x8) CInt32x8ByteSwap(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return CUInt32x8ByteSwap(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)CUInt32x8ByteSwap((CUInt32x8)operand);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4ByteSwap(operand.lo);
+  result.hi = CInt32x4ByteSwap(operand.hi);
+  return result;
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CInt32x8){ bitreverse(operand[0]), bitreverse(operand[1]), ..., bitreverse(operand[7]) }`
+FORCE_INLINE(CInt32x8) CInt32x8BitReverse(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return CUInt32x8BitReverse(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)CUInt32x8BitReverse((CUInt32x8)operand);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4BitReverse(operand.lo);
+  result.hi = CInt32x4BitReverse(operand.hi);
+  return result;
+#endif
+}
+
+#undef Int32
@@ -0,0 +1,264 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Masks of 16 lanes are `CInt32x16` storages, with all bits set in the lanes
+// where a comparison holds and none in the others. AVX-512 compares into a
+// mask register, which is expanded to all bits of the lanes it has set.
+
+#pragma mark - Float32x16
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x16){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CFloat32x16CompareEqual(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_OQ), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs == rhs);
+#else
+  CInt32x16 result;
+  result.lo = CFloat32x8CompareEqual(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8CompareEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x16){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CFloat32x16CompareLessThan(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs < rhs);
+#else
+  CInt32x16 result;
+  result.lo = CFloat32x8CompareLessThan(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8CompareLessThan(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x16){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CFloat32x16CompareLessThanOrEqual(const CFloat32x16 lhs, const CFloat32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs <= rhs);
+#else
+  CInt32x16 result;
+  result.lo = CFloat32x8CompareLessThanOrEqual(lhs.lo, rhs.lo);
+  result.hi = CFloat32x8CompareLessThanOrEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CFloat32x16){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CFloat32x16)
+CFloat32x16Select(const CInt32x16 mask, const CFloat32x16 trueValue, const CFloat32x16 falseValue)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mask_blend_ps(_mm512_test_epi32_mask(mask, mask), falseValue, trueValue);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x16)(((CInt32x16)trueValue & mask) | ((CInt32x16)falseValue & ~mask));
+#else
+  CFloat32x16 result;
+  result.lo = CFloat32x8Select(mask.lo, trueValue.lo, falseValue.lo);
+  result.hi = CFloat32x8Select(mask.hi, trueValue.hi, falseValue.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Int32x16
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x16){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CInt32x16CompareEqual(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+  return CInt32x16CompareElementWise(lhs, rhs);
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x16){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CInt32x16CompareLessThan(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmplt_epi32_mask(lhs, rhs), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs < rhs);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8CompareLessThan(lhs.lo, rhs.lo);
+  result.hi = CInt32x8CompareLessThan(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x16){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CInt32x16CompareLessThanOrEqual(const CInt32x16 lhs, const CInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmple_epi32_mask(lhs, rhs), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs <= rhs);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8CompareLessThanOrEqual(lhs.lo, rhs.lo);
+  result.hi = CInt32x8CompareLessThanOrEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CInt32x16){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CInt32x16)
+CInt32x16Select(const CInt32x16 mask, const CInt32x16 trueValue, const CInt32x16 falseValue)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mask_blend_epi32(_mm512_test_epi32_mask(mask, mask), falseValue, trueValue);
+#elif CSIMDX_EXT_VECTOR
+  return (trueValue & mask) | (falseValue & ~mask);
+#else
+  CInt32x16 result;
+  result.lo = CInt32x8Select(mask.lo, trueValue.lo, falseValue.lo);
+  result.hi = CInt32x8Select(mask.hi, trueValue.hi, falseValue.hi);
+  return result;
+#endif
+}
+
+#pragma mark - UInt32x16
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x16){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CUInt32x16CompareEqual(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmpeq_epi32_mask(lhs, rhs), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs == rhs);
+#else
+  CInt32x16 result;
+  result.lo = CUInt32x8CompareEqual(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8CompareEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x16){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CUInt32x16CompareLessThan(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmplt_epu32_mask(lhs, rhs), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs < rhs);
+#else
+  CInt32x16 result;
+  result.lo = CUInt32x8CompareLessThan(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8CompareLessThan(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x16){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x16)
+CUInt32x16CompareLessThanOrEqual(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmple_epu32_mask(lhs, rhs), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)(lhs <= rhs);
+#else
+  CInt32x16 result;
+  result.lo = CUInt32x8CompareLessThanOrEqual(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8CompareLessThanOrEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CUInt32x16){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16Select(const CInt32x16 mask, const CUInt32x16 trueValue, const CUInt32x16 falseValue)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mask_blend_epi32(_mm512_test_epi32_mask(mask, mask), falseValue, trueValue);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x16)(((CInt32x16)trueValue & mask) | ((CInt32x16)falseValue & ~mask));
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8Select(mask.lo, trueValue.lo, falseValue.lo);
+  result.hi = CUInt32x8Select(mask.hi, trueValue.hi, falseValue.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Reduction
+
+/// Returns whether any lane of `mask` is set, testing all lanes at once.
+/// @return `mask[0] || mask[1] || ... || mask[15]`
+FORCE_INLINE(bool)
+CInt32x16MaskAny(const CInt32x16 mask)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_test_epi32_mask(mask, mask) != 0;
+#else
+  return CInt32x8MaskAny(CInt32x8BitwiseOr(CInt32x16GetLow(mask), CInt32x16GetHigh(mask)));
+#endif
+}
+
+/// Returns whether all lanes of `mask` are set, testing all lanes at once.
+/// @return `mask[0] && mask[1] && ... && mask[15]`
+FORCE_INLINE(bool)
+CInt32x16MaskAll(const CInt32x16 mask)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_test_epi32_mask(mask, mask) == 0xFFFF;
+#else
+  return CInt32x8MaskAll(CInt32x8BitwiseAnd(CInt32x16GetLow(mask), CInt32x16GetHigh(mask)));
+#endif
+}
@@ -0,0 +1,291 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/// The 32-bit signed integer element of a mask
+#define Int32 int32_t
+
+// Masks of 2 lanes are `CInt32x2` storages, with all bits set in the lanes
+// where a comparison holds and none in the others. They are declared after all
+// storages, as they combine the 32-bit float and integer storages of 2 lanes.
+
+#pragma mark - Float32x2
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x2){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CFloat32x2CompareEqual(const CFloat32x2 lhs, const CFloat32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vceq_f32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_movepi64_pi64(_mm_castps_si128(_mm_cmpeq_ps(lhs, rhs)));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs == rhs);
+#else
+  return CInt32x2Make(-(Int32)(CFloat32x2GetElement(lhs, 0) == CFloat32x2GetElement(rhs, 0)),
+                      -(Int32)(CFloat32x2GetElement(lhs, 1) == CFloat32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x2){ lhs[0] < rhs[0], lhs[1] < rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CFloat32x2CompareLessThan(const CFloat32x2 lhs, const CFloat32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vclt_f32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_movepi64_pi64(_mm_castps_si128(_mm_cmplt_ps(lhs, rhs)));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs < rhs);
+#else
+  return CInt32x2Make(-(Int32)(CFloat32x2GetElement(lhs, 0) < CFloat32x2GetElement(rhs, 0)),
+                      -(Int32)(CFloat32x2GetElement(lhs, 1) < CFloat32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x2){ lhs[0] <= rhs[0], lhs[1] <= rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CFloat32x2CompareLessThanOrEqual(const CFloat32x2 lhs, const CFloat32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vcle_f32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_movepi64_pi64(_mm_castps_si128(_mm_cmple_ps(lhs, rhs)));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs <= rhs);
+#else
+  return CInt32x2Make(-(Int32)(CFloat32x2GetElement(lhs, 0) <= CFloat32x2GetElement(rhs, 0)),
+                      -(Int32)(CFloat32x2GetElement(lhs, 1) <= CFloat32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CFloat32x2){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CFloat32x2)
+CFloat32x2Select(const CInt32x2 mask, const CFloat32x2 trueValue, const CFloat32x2 falseValue)
+{
+#if CSIMDX_ARM_NEON
+  return vbsl_f32(vreinterpret_u32_s32(mask), trueValue, falseValue);
+#elif CSIMDX_X86_SSE4_1
+  return _mm_blendv_ps(falseValue, trueValue, _mm_castsi128_ps(_mm_movpi64_epi64(mask)));
+#elif CSIMDX_X86_SSE2
+  __m128 select = _mm_castsi128_ps(_mm_movpi64_epi64(mask));
+  return _mm_or_ps(_mm_and_ps(select, trueValue), _mm_andnot_ps(select, falseValue));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x2)(((CInt32x2)trueValue & mask) | ((CInt32x2)falseValue & ~mask));
+#else
+  return CFloat32x2Make(CInt32x2GetElement(mask, 0) ? CFloat32x2GetElement(trueValue, 0) : CFloat32x2GetElement(falseValue, 0),
+                        CInt32x2GetElement(mask, 1) ? CFloat32x2GetElement(trueValue, 1) : CFloat32x2GetElement(falseValue, 1));
+#endif
+}
+
+#pragma mark - Int32x2
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x2){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CInt32x2CompareEqual(const CInt32x2 lhs, const CInt32x2 rhs)
+{
+  return CInt32x2CompareElementWise(lhs, rhs);
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x2){ lhs[0] < rhs[0], lhs[1] < rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CInt32x2CompareLessThan(const CInt32x2 lhs, const CInt32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vclt_s32(lhs, rhs));
+#elif CSIMDX_X86_MMX
+  return _mm_cmpgt_pi32(rhs, lhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs < rhs);
+#else
+  return CInt32x2Make(-(Int32)(CInt32x2GetElement(lhs, 0) < CInt32x2GetElement(rhs, 0)),
+                      -(Int32)(CInt32x2GetElement(lhs, 1) < CInt32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x2){ lhs[0] <= rhs[0], lhs[1] <= rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CInt32x2CompareLessThanOrEqual(const CInt32x2 lhs, const CInt32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vcle_s32(lhs, rhs));
+#elif CSIMDX_X86_MMX
+  return _mm_xor_si64(_mm_cmpgt_pi32(lhs, rhs), _mm_set1_pi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs <= rhs);
+#else
+  return CInt32x2Make(-(Int32)(CInt32x2GetElement(lhs, 0) <= CInt32x2GetElement(rhs, 0)),
+                      -(Int32)(CInt32x2GetElement(lhs, 1) <= CInt32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CInt32x2){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CInt32x2)
+CInt32x2Select(const CInt32x2 mask, const CInt32x2 trueValue, const CInt32x2 falseValue)
+{
+#if CSIMDX_ARM_NEON
+  return vbsl_s32(vreinterpret_u32_s32(mask), trueValue, falseValue);
+#elif CSIMDX_X86_MMX
+  return _mm_or_si64(_mm_and_si64(mask, trueValue), _mm_andnot_si64(mask, falseValue));
+#elif CSIMDX_EXT_VECTOR
+  return (trueValue & mask) | (falseValue & ~mask);
+#else
+  return CInt32x2Make(CInt32x2GetElement(mask, 0) ? CInt32x2GetElement(trueValue, 0) : CInt32x2GetElement(falseValue, 0),
+                      CInt32x2GetElement(mask, 1) ? CInt32x2GetElement(trueValue, 1) : CInt32x2GetElement(falseValue, 1));
+#endif
+}
+
+#pragma mark - UInt32x2
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x2){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CUInt32x2CompareEqual(const CUInt32x2 lhs, const CUInt32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vceq_u32(lhs, rhs));
+#elif CSIMDX_X86_MMX
+  return _mm_cmpeq_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs == rhs);
+#else
+  return CInt32x2Make(-(Int32)(CUInt32x2GetElement(lhs, 0) == CUInt32x2GetElement(rhs, 0)),
+                      -(Int32)(CUInt32x2GetElement(lhs, 1) == CUInt32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x2){ lhs[0] < rhs[0], lhs[1] < rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CUInt32x2CompareLessThan(const CUInt32x2 lhs, const CUInt32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vclt_u32(lhs, rhs));
+#elif CSIMDX_X86_MMX
+  // Flip the sign bits, to compare unsigned elements as signed ones
+  __m64 sign = _mm_set1_pi32(INT32_MIN);
+  return _mm_cmpgt_pi32(_mm_xor_si64(rhs, sign), _mm_xor_si64(lhs, sign));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs < rhs);
+#else
+  return CInt32x2Make(-(Int32)(CUInt32x2GetElement(lhs, 0) < CUInt32x2GetElement(rhs, 0)),
+                      -(Int32)(CUInt32x2GetElement(lhs, 1) < CUInt32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x2){ lhs[0] <= rhs[0], lhs[1] <= rhs[1] }`
+FORCE_INLINE(CInt32x2)
+CUInt32x2CompareLessThanOrEqual(const CUInt32x2 lhs, const CUInt32x2 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(vcle_u32(lhs, rhs));
+#elif CSIMDX_X86_MMX
+  // Flip the sign bits, to compare unsigned elements as signed ones
+  __m64 sign = _mm_set1_pi32(INT32_MIN);
+  return _mm_xor_si64(_mm_cmpgt_pi32(_mm_xor_si64(lhs, sign), _mm_xor_si64(rhs, sign)),
+                      _mm_set1_pi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)(lhs <= rhs);
+#else
+  return CInt32x2Make(-(Int32)(CUInt32x2GetElement(lhs, 0) <= CUInt32x2GetElement(rhs, 0)),
+                      -(Int32)(CUInt32x2GetElement(lhs, 1) <= CUInt32x2GetElement(rhs, 1)));
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CUInt32x2){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CUInt32x2)
+CUInt32x2Select(const CInt32x2 mask, const CUInt32x2 trueValue, const CUInt32x2 falseValue)
+{
+#if CSIMDX_ARM_NEON
+  return vbsl_u32(vreinterpret_u32_s32(mask), trueValue, falseValue);
+#elif CSIMDX_X86_MMX
+  return _mm_or_si64(_mm_and_si64(mask, trueValue), _mm_andnot_si64(mask, falseValue));
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x2)(((CInt32x2)trueValue & mask) | ((CInt32x2)falseValue & ~mask));
+#else
+  return CUInt32x2Make(CInt32x2GetElement(mask, 0) ? CUInt32x2GetElement(trueValue, 0) : CUInt32x2GetElement(falseValue, 0),
+                       CInt32x2GetElement(mask, 1) ? CUInt32x2GetElement(trueValue, 1) : CUInt32x2GetElement(falseValue, 1));
+#endif
+}
+
+#pragma mark - Reduction
+
+/// Returns whether any lane of `mask` is set, testing all lanes at once.
+/// @return `mask[0] || mask[1]`
+FORCE_INLINE(bool)
+CInt32x2MaskAny(const CInt32x2 mask)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vmaxv_u32(vreinterpret_u32_s32(mask)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x2_t lanes = vreinterpret_u32_s32(mask);
+  return vget_lane_u32(vpmax_u32(lanes, lanes), 0) != 0;
+#elif CSIMDX_X86_MMX
+  return _mm_cvtm64_si64(mask) != 0;
+#elif CSIMDX_EXT_VECTOR
+  return (mask[0] | mask[1]) != 0;
+#else
+  return (CInt32x2GetElement(mask, 0) | CInt32x2GetElement(mask, 1)) != 0;
+#endif
+}
+
+/// Returns whether all lanes of `mask` are set, testing all lanes at once.
+/// @return `mask[0] && mask[1]`
+FORCE_INLINE(bool)
+CInt32x2MaskAll(const CInt32x2 mask)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminv_u32(vreinterpret_u32_s32(mask)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x2_t lanes = vreinterpret_u32_s32(mask);
+  return vget_lane_u32(vpmin_u32(lanes, lanes), 0) != 0;
+#elif CSIMDX_X86_MMX
+  return _mm_cvtm64_si64(mask) == -1;
+#elif CSIMDX_EXT_VECTOR
+  return (mask[0] & mask[1]) != 0;
+#else
+  return (CInt32x2GetElement(mask, 0) & CInt32x2GetElement(mask, 1)) != 0;
+#endif
+}
+
+#undef Int32
@@ -0,0 +1,327 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/// The 32-bit signed integer element of a mask
+#define Int32 int32_t
+
+// Masks of 4 lanes are `CInt32x4` storages, with all bits set in the lanes
+// where a comparison holds and none in the others. They are declared after all
+// storages, as they combine the 32-bit float and integer storages of 4 lanes.
+
+#pragma mark - Float32x4
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x4){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CFloat32x4CompareEqual(const CFloat32x4 lhs, const CFloat32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vceqq_f32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_si128(_mm_cmpeq_ps(lhs, rhs));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs == rhs);
+#else
+  return CInt32x4Make(-(Int32)(CFloat32x4GetElement(lhs, 0) == CFloat32x4GetElement(rhs, 0)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 1) == CFloat32x4GetElement(rhs, 1)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 2) == CFloat32x4GetElement(rhs, 2)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 3) == CFloat32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x4){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CFloat32x4CompareLessThan(const CFloat32x4 lhs, const CFloat32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vcltq_f32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_si128(_mm_cmplt_ps(lhs, rhs));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs < rhs);
+#else
+  return CInt32x4Make(-(Int32)(CFloat32x4GetElement(lhs, 0) < CFloat32x4GetElement(rhs, 0)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 1) < CFloat32x4GetElement(rhs, 1)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 2) < CFloat32x4GetElement(rhs, 2)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 3) < CFloat32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x4){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CFloat32x4CompareLessThanOrEqual(const CFloat32x4 lhs, const CFloat32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vcleq_f32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_si128(_mm_cmple_ps(lhs, rhs));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs <= rhs);
+#else
+  return CInt32x4Make(-(Int32)(CFloat32x4GetElement(lhs, 0) <= CFloat32x4GetElement(rhs, 0)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 1) <= CFloat32x4GetElement(rhs, 1)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 2) <= CFloat32x4GetElement(rhs, 2)),
+                      -(Int32)(CFloat32x4GetElement(lhs, 3) <= CFloat32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CFloat32x4){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CFloat32x4)
+CFloat32x4Select(const CInt32x4 mask, const CFloat32x4 trueValue, const CFloat32x4 falseValue)
+{
+#if CSIMDX_ARM_NEON
+  return vbslq_f32(vreinterpretq_u32_s32(mask), trueValue, falseValue);
+#elif CSIMDX_X86_SSE4_1
+  return _mm_blendv_ps(falseValue, trueValue, _mm_castsi128_ps(mask));
+#elif CSIMDX_X86_SSE2
+  __m128 select = _mm_castsi128_ps(mask);
+  return _mm_or_ps(_mm_and_ps(select, trueValue), _mm_andnot_ps(select, falseValue));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4)(((CInt32x4)trueValue & mask) | ((CInt32x4)falseValue & ~mask));
+#else
+  return CFloat32x4Make(CInt32x4GetElement(mask, 0) ? CFloat32x4GetElement(trueValue, 0) : CFloat32x4GetElement(falseValue, 0),
+                        CInt32x4GetElement(mask, 1) ? CFloat32x4GetElement(trueValue, 1) : CFloat32x4GetElement(falseValue, 1),
+                        CInt32x4GetElement(mask, 2) ? CFloat32x4GetElement(trueValue, 2) : CFloat32x4GetElement(falseValue, 2),
+                        CInt32x4GetElement(mask, 3) ? CFloat32x4GetElement(trueValue, 3) : CFloat32x4GetElement(falseValue, 3));
+#endif
+}
+
+#pragma mark - Int32x4
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x4){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CInt32x4CompareEqual(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+  return CInt32x4CompareElementWise(lhs, rhs);
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x4){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CInt32x4CompareLessThan(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vcltq_s32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_cmplt_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs < rhs);
+#else
+  return CInt32x4Make(-(Int32)(CInt32x4GetElement(lhs, 0) < CInt32x4GetElement(rhs, 0)),
+                      -(Int32)(CInt32x4GetElement(lhs, 1) < CInt32x4GetElement(rhs, 1)),
+                      -(Int32)(CInt32x4GetElement(lhs, 2) < CInt32x4GetElement(rhs, 2)),
+                      -(Int32)(CInt32x4GetElement(lhs, 3) < CInt32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x4){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CInt32x4CompareLessThanOrEqual(const CInt32x4 lhs, const CInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vcleq_s32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_xor_si128(_mm_cmpgt_epi32(lhs, rhs), _mm_set1_epi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs <= rhs);
+#else
+  return CInt32x4Make(-(Int32)(CInt32x4GetElement(lhs, 0) <= CInt32x4GetElement(rhs, 0)),
+                      -(Int32)(CInt32x4GetElement(lhs, 1) <= CInt32x4GetElement(rhs, 1)),
+                      -(Int32)(CInt32x4GetElement(lhs, 2) <= CInt32x4GetElement(rhs, 2)),
+                      -(Int32)(CInt32x4GetElement(lhs, 3) <= CInt32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CInt32x4){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CInt32x4)
+CInt32x4Select(const CInt32x4 mask, const CInt32x4 trueValue, const CInt32x4 falseValue)
+{
+#if CSIMDX_ARM_NEON
+  return vbslq_s32(vreinterpretq_u32_s32(mask), trueValue, falseValue);
+#elif CSIMDX_X86_SSE4_1
+  return _mm_blendv_epi8(falseValue, trueValue, mask);
+#elif CSIMDX_X86_SSE2
+  return _mm_or_si128(_mm_and_si128(mask, trueValue), _mm_andnot_si128(mask, falseValue));
+#elif CSIMDX_EXT_VECTOR
+  return (trueValue & mask) | (falseValue & ~mask);
+#else
+  return CInt32x4Make(CInt32x4GetElement(mask, 0) ? CInt32x4GetElement(trueValue, 0) : CInt32x4GetElement(falseValue, 0),
+                      CInt32x4GetElement(mask, 1) ? CInt32x4GetElement(trueValue, 1) : CInt32x4GetElement(falseValue, 1),
+                      CInt32x4GetElement(mask, 2) ? CInt32x4GetElement(trueValue, 2) : CInt32x4GetElement(falseValue, 2),
+                      CInt32x4GetElement(mask, 3) ? CInt32x4GetElement(trueValue, 3) : CInt32x4GetElement(falseValue, 3));
+#endif
+}
+
+#pragma mark - UInt32x4
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x4){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CUInt32x4CompareEqual(const CUInt32x4 lhs, const CUInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vceqq_u32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  return _mm_cmpeq_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs == rhs);
+#else
+  return CInt32x4Make(-(Int32)(CUInt32x4GetElement(lhs, 0) == CUInt32x4GetElement(rhs, 0)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 1) == CUInt32x4GetElement(rhs, 1)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 2) == CUInt32x4GetElement(rhs, 2)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 3) == CUInt32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x4){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CUInt32x4CompareLessThan(const CUInt32x4 lhs, const CUInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vcltq_u32(lhs, rhs));
+#elif CSIMDX_X86_SSE2
+  // Flip the sign bits, to compare unsigned elements as signed ones
+  __m128i sign = _mm_set1_epi32(INT32_MIN);
+  return _mm_cmplt_epi32(_mm_xor_si128(lhs, sign), _mm_xor_si128(rhs, sign));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs < rhs);
+#else
+  return CInt32x4Make(-(Int32)(CUInt32x4GetElement(lhs, 0) < CUInt32x4GetElement(rhs, 0)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 1) < CUInt32x4GetElement(rhs, 1)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 2) < CUInt32x4GetElement(rhs, 2)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 3) < CUInt32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x4){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x4)
+CUInt32x4CompareLessThanOrEqual(const CUInt32x4 lhs, const CUInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(vcleq_u32(lhs, rhs));
+#elif CSIMDX_X86_SSE4_1
+  return _mm_cmpeq_epi32(_mm_max_epu32(lhs, rhs), rhs);
+#elif CSIMDX_X86_SSE2
+  // Flip the sign bits, to compare unsigned elements as signed ones
+  __m128i sign = _mm_set1_epi32(INT32_MIN);
+  __m128i greater = _mm_cmpgt_epi32(_mm_xor_si128(lhs, sign), _mm_xor_si128(rhs, sign));
+  return _mm_xor_si128(greater, _mm_set1_epi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)(lhs <= rhs);
+#else
+  return CInt32x4Make(-(Int32)(CUInt32x4GetElement(lhs, 0) <= CUInt32x4GetElement(rhs, 0)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 1) <= CUInt32x4GetElement(rhs, 1)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 2) <= CUInt32x4GetElement(rhs, 2)),
+                      -(Int32)(CUInt32x4GetElement(lhs, 3) <= CUInt32x4GetElement(rhs, 3)));
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CUInt32x4){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CUInt32x4)
+CUInt32x4Select(const CInt32x4 mask, const CUInt32x4 trueValue, const CUInt32x4 falseValue)
+{
+#if CSIMDX_ARM_NEON
+  return vbslq_u32(vreinterpretq_u32_s32(mask), trueValue, falseValue);
+#elif CSIMDX_X86_SSE4_1
+  return _mm_blendv_epi8(falseValue, trueValue, mask);
+#elif CSIMDX_X86_SSE2
+  return _mm_or_si128(_mm_and_si128(mask, trueValue), _mm_andnot_si128(mask, falseValue));
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x4)(((CInt32x4)trueValue & mask) | ((CInt32x4)falseValue & ~mask));
+#else
+  return CUInt32x4Make(CInt32x4GetElement(mask, 0) ? CUInt32x4GetElement(trueValue, 0) : CUInt32x4GetElement(falseValue, 0),
+                       CInt32x4GetElement(mask, 1) ? CUInt32x4GetElement(trueValue, 1) : CUInt32x4GetElement(falseValue, 1),
+                       CInt32x4GetElement(mask, 2) ? CUInt32x4GetElement(trueValue, 2) : CUInt32x4GetElement(falseValue, 2),
+                       CInt32x4GetElement(mask, 3) ? CUInt32x4GetElement(trueValue, 3) : CUInt32x4GetElement(falseValue, 3));
+#endif
+}
+
+#pragma mark - Reduction
+
+/// Returns whether any lane of `mask` is set, testing all lanes at once.
+/// @return `mask[0] || mask[1] || mask[2] || mask[3]`
+FORCE_INLINE(bool)
+CInt32x4MaskAny(const CInt32x4 mask)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vmaxvq_u32(vreinterpretq_u32_s32(mask)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x4_t lanes = vreinterpretq_u32_s32(mask);
+  uint32x2_t half = vorr_u32(vget_low_u32(lanes), vget_high_u32(lanes));
+  return vget_lane_u32(vpmax_u32(half, half), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  return _mm_movemask_ps(_mm_castsi128_ps(mask)) != 0;
+#elif CSIMDX_EXT_VECTOR
+  return (mask[0] | mask[1] | mask[2] | mask[3]) != 0;
+#else
+  return (CInt32x4GetElement(mask, 0) |
+          CInt32x4GetElement(mask, 1) |
+          CInt32x4GetElement(mask, 2) |
+          CInt32x4GetElement(mask, 3)) != 0;
+#endif
+}
+
+/// Returns whether all lanes of `mask` are set, testing all lanes at once.
+/// @return `mask[0] && mask[1] && mask[2] && mask[3]`
+FORCE_INLINE(bool)
+CInt32x4MaskAll(const CInt32x4 mask)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminvq_u32(vreinterpretq_u32_s32(mask)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x4_t lanes = vreinterpretq_u32_s32(mask);
+  uint32x2_t half = vand_u32(vget_low_u32(lanes), vget_high_u32(lanes));
+  return vget_lane_u32(vpmin_u32(half, half), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  return _mm_movemask_ps(_mm_castsi128_ps(mask)) == 0xF;
+#elif CSIMDX_EXT_VECTOR
+  return (mask[0] & mask[1] & mask[2] & mask[3]) != 0;
+#else
+  return (CInt32x4GetElement(mask, 0) &
+          CInt32x4GetElement(mask, 1) &
+          CInt32x4GetElement(mask, 2) &
+          CInt32x4GetElement(mask, 3)) != 0;
+#endif
+}
+
+#undef Int32
@@ -0,0 +1,404 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/// The 32-bit signed integer element of a mask
+#define Int32 int32_t
+
+// Masks of 8 lanes are `CInt32x8` storages, with all bits set in the lanes
+// where a comparison holds and none in the others. On AVX without AVX2 they
+// are a pair of 128-bit registers, so the floating-point comparisons and
+// selections reinterpret the masks from and to their 256-bit registers.
+
+#pragma mark - Float32x8
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x8){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CFloat32x8CompareEqual(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return CFloat32x8ReinterpretAsCInt32x8(_mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs == rhs);
+#else
+  CInt32x8 result;
+  result.lo = CFloat32x4CompareEqual(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4CompareEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x8){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CFloat32x8CompareLessThan(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return CFloat32x8ReinterpretAsCInt32x8(_mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs < rhs);
+#else
+  CInt32x8 result;
+  result.lo = CFloat32x4CompareLessThan(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4CompareLessThan(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x8){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CFloat32x8CompareLessThanOrEqual(const CFloat32x8 lhs, const CFloat32x8 rhs)
+{
+#if CSIMDX_X86_AVX
+  return CFloat32x8ReinterpretAsCInt32x8(_mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs <= rhs);
+#else
+  CInt32x8 result;
+  result.lo = CFloat32x4CompareLessThanOrEqual(lhs.lo, rhs.lo);
+  result.hi = CFloat32x4CompareLessThanOrEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CFloat32x8){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CFloat32x8)
+CFloat32x8Select(const CInt32x8 mask, const CFloat32x8 trueValue, const CFloat32x8 falseValue)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_blendv_ps(falseValue, trueValue, CInt32x8ReinterpretAsCFloat32x8(mask));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8)(((CInt32x8)trueValue & mask) | ((CInt32x8)falseValue & ~mask));
+#else
+  CFloat32x8 result;
+  result.lo = CFloat32x4Select(mask.lo, trueValue.lo, falseValue.lo);
+  result.hi = CFloat32x4Select(mask.hi, trueValue.hi, falseValue.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Float64x8
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x8){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CFloat64x8CompareEqual(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  __mmask8 mask = _mm512_cmp_pd_mask(lhs, rhs, _CMP_EQ_OQ);
+  return _mm512_castsi512_si256(_mm512_maskz_set1_epi32(mask, -1));
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_convertvector(lhs == rhs, CInt32x8);
+#elif CSIMDX_X86_AVX
+  __m256 lo = _mm256_castpd_ps(_mm256_cmp_pd(lhs.lo, rhs.lo, _CMP_EQ_OQ));
+  __m256 hi = _mm256_castpd_ps(_mm256_cmp_pd(lhs.hi, rhs.hi, _CMP_EQ_OQ));
+  // Narrow the 64-bit lanes to their lower 32 bits, in the order of the lanes
+  __m256 mask = _mm256_shuffle_ps(_mm256_permute2f128_ps(lo, hi, 0x20),
+                                  _mm256_permute2f128_ps(lo, hi, 0x31), _MM_SHUFFLE(2, 0, 2, 0));
+  return CFloat32x8ReinterpretAsCInt32x8(mask);
+#else
+  return CInt32x8Make(-(Int32)(CFloat64x8GetElement(lhs, 0) == CFloat64x8GetElement(rhs, 0)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 1) == CFloat64x8GetElement(rhs, 1)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 2) == CFloat64x8GetElement(rhs, 2)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 3) == CFloat64x8GetElement(rhs, 3)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 4) == CFloat64x8GetElement(rhs, 4)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 5) == CFloat64x8GetElement(rhs, 5)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 6) == CFloat64x8GetElement(rhs, 6)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 7) == CFloat64x8GetElement(rhs, 7)));
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x8){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CFloat64x8CompareLessThan(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  __mmask8 mask = _mm512_cmp_pd_mask(lhs, rhs, _CMP_LT_OQ);
+  return _mm512_castsi512_si256(_mm512_maskz_set1_epi32(mask, -1));
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_convertvector(lhs < rhs, CInt32x8);
+#elif CSIMDX_X86_AVX
+  __m256 lo = _mm256_castpd_ps(_mm256_cmp_pd(lhs.lo, rhs.lo, _CMP_LT_OQ));
+  __m256 hi = _mm256_castpd_ps(_mm256_cmp_pd(lhs.hi, rhs.hi, _CMP_LT_OQ));
+  __m256 mask = _mm256_shuffle_ps(_mm256_permute2f128_ps(lo, hi, 0x20),
+                                  _mm256_permute2f128_ps(lo, hi, 0x31), _MM_SHUFFLE(2, 0, 2, 0));
+  return CFloat32x8ReinterpretAsCInt32x8(mask);
+#else
+  return CInt32x8Make(-(Int32)(CFloat64x8GetElement(lhs, 0) < CFloat64x8GetElement(rhs, 0)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 1) < CFloat64x8GetElement(rhs, 1)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 2) < CFloat64x8GetElement(rhs, 2)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 3) < CFloat64x8GetElement(rhs, 3)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 4) < CFloat64x8GetElement(rhs, 4)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 5) < CFloat64x8GetElement(rhs, 5)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 6) < CFloat64x8GetElement(rhs, 6)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 7) < CFloat64x8GetElement(rhs, 7)));
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others, which is never the case for
+/// a NaN element.
+/// @return `(CInt32x8){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CFloat64x8CompareLessThanOrEqual(const CFloat64x8 lhs, const CFloat64x8 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  __mmask8 mask = _mm512_cmp_pd_mask(lhs, rhs, _CMP_LE_OQ);
+  return _mm512_castsi512_si256(_mm512_maskz_set1_epi32(mask, -1));
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_convertvector(lhs <= rhs, CInt32x8);
+#elif CSIMDX_X86_AVX
+  __m256 lo = _mm256_castpd_ps(_mm256_cmp_pd(lhs.lo, rhs.lo, _CMP_LE_OQ));
+  __m256 hi = _mm256_castpd_ps(_mm256_cmp_pd(lhs.hi, rhs.hi, _CMP_LE_OQ));
+  __m256 mask = _mm256_shuffle_ps(_mm256_permute2f128_ps(lo, hi, 0x20),
+                                  _mm256_permute2f128_ps(lo, hi, 0x31), _MM_SHUFFLE(2, 0, 2, 0));
+  return CFloat32x8ReinterpretAsCInt32x8(mask);
+#else
+  return CInt32x8Make(-(Int32)(CFloat64x8GetElement(lhs, 0) <= CFloat64x8GetElement(rhs, 0)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 1) <= CFloat64x8GetElement(rhs, 1)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 2) <= CFloat64x8GetElement(rhs, 2)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 3) <= CFloat64x8GetElement(rhs, 3)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 4) <= CFloat64x8GetElement(rhs, 4)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 5) <= CFloat64x8GetElement(rhs, 5)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 6) <= CFloat64x8GetElement(rhs, 6)),
+                      -(Int32)(CFloat64x8GetElement(lhs, 7) <= CFloat64x8GetElement(rhs, 7)));
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CFloat64x8){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CFloat64x8)
+CFloat64x8Select(const CInt32x8 mask, const CFloat64x8 trueValue, const CFloat64x8 falseValue)
+{
+#if CSIMDX_X86_AVX512_F
+  // The upper lanes of the widened mask are undefined, and dropped by the narrower mask register
+  __m512i lanes = _mm512_castsi256_si512(mask);
+  __mmask8 select = (__mmask8)_mm512_test_epi32_mask(lanes, lanes);
+  return _mm512_mask_blend_pd(select, falseValue, trueValue);
+#elif CSIMDX_EXT_VECTOR
+  // Widen the 32-bit lanes of the mask to the 64-bit elements
+  __typeof__(trueValue == falseValue) select;
+  select = __builtin_convertvector(mask, __typeof__(select));
+  return (CFloat64x8)(((__typeof__(select))trueValue & select) | ((__typeof__(select))falseValue & ~select));
+#elif CSIMDX_X86_AVX
+  // Widen the 32-bit lanes of the mask to the 64-bit elements, by duplicating them
+  __m256 lanes = CInt32x8ReinterpretAsCFloat32x8(mask);
+  __m128 lo = _mm256_castps256_ps128(lanes), hi = _mm256_extractf128_ps(lanes, 1);
+  __m256d selectLow = _mm256_castps_pd(_mm256_setr_m128(_mm_unpacklo_ps(lo, lo), _mm_unpackhi_ps(lo, lo)));
+  __m256d selectHigh = _mm256_castps_pd(_mm256_setr_m128(_mm_unpacklo_ps(hi, hi), _mm_unpackhi_ps(hi, hi)));
+  CFloat64x8 result;
+  result.lo = _mm256_blendv_pd(falseValue.lo, trueValue.lo, selectLow);
+  result.hi = _mm256_blendv_pd(falseValue.hi, trueValue.hi, selectHigh);
+  return result;
+#else
+  return CFloat64x8Make(CInt32x8GetElement(mask, 0) ? CFloat64x8GetElement(trueValue, 0) : CFloat64x8GetElement(falseValue, 0),
+                        CInt32x8GetElement(mask, 1) ? CFloat64x8GetElement(trueValue, 1) : CFloat64x8GetElement(falseValue, 1),
+                        CInt32x8GetElement(mask, 2) ? CFloat64x8GetElement(trueValue, 2) : CFloat64x8GetElement(falseValue, 2),
+                        CInt32x8GetElement(mask, 3) ? CFloat64x8GetElement(trueValue, 3) : CFloat64x8GetElement(falseValue, 3),
+                        CInt32x8GetElement(mask, 4) ? CFloat64x8GetElement(trueValue, 4) : CFloat64x8GetElement(falseValue, 4),
+                        CInt32x8GetElement(mask, 5) ? CFloat64x8GetElement(trueValue, 5) : CFloat64x8GetElement(falseValue, 5),
+                        CInt32x8GetElement(mask, 6) ? CFloat64x8GetElement(trueValue, 6) : CFloat64x8GetElement(falseValue, 6),
+                        CInt32x8GetElement(mask, 7) ? CFloat64x8GetElement(trueValue, 7) : CFloat64x8GetElement(falseValue, 7));
+#endif
+}
+
+#pragma mark - Int32x8
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x8){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CInt32x8CompareEqual(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+  return CInt32x8CompareElementWise(lhs, rhs);
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x8){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CInt32x8CompareLessThan(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_cmpgt_epi32(rhs, lhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs < rhs);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4CompareLessThan(lhs.lo, rhs.lo);
+  result.hi = CInt32x4CompareLessThan(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x8){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CInt32x8CompareLessThanOrEqual(const CInt32x8 lhs, const CInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_xor_si256(_mm256_cmpgt_epi32(lhs, rhs), _mm256_set1_epi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs <= rhs);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4CompareLessThanOrEqual(lhs.lo, rhs.lo);
+  result.hi = CInt32x4CompareLessThanOrEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CInt32x8){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CInt32x8)
+CInt32x8Select(const CInt32x8 mask, const CInt32x8 trueValue, const CInt32x8 falseValue)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_blendv_epi8(falseValue, trueValue, mask);
+#elif CSIMDX_EXT_VECTOR
+  return (trueValue & mask) | (falseValue & ~mask);
+#else
+  CInt32x8 result;
+  result.lo = CInt32x4Select(mask.lo, trueValue.lo, falseValue.lo);
+  result.hi = CInt32x4Select(mask.hi, trueValue.hi, falseValue.hi);
+  return result;
+#endif
+}
+
+#pragma mark - UInt32x8
+
+/// Compares both storages for `lhs == rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x8){ lhs[0] == rhs[0], lhs[1] == rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CUInt32x8CompareEqual(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_cmpeq_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs == rhs);
+#else
+  CInt32x8 result;
+  result.lo = CUInt32x4CompareEqual(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4CompareEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs < rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x8){ lhs[0] < rhs[0], lhs[1] < rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CUInt32x8CompareLessThan(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  // Flip the sign bits, to compare unsigned elements as signed ones
+  __m256i sign = _mm256_set1_epi32(INT32_MIN);
+  return _mm256_cmpgt_epi32(_mm256_xor_si256(rhs, sign), _mm256_xor_si256(lhs, sign));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs < rhs);
+#else
+  CInt32x8 result;
+  result.lo = CUInt32x4CompareLessThan(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4CompareLessThan(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Compares both storages for `lhs <= rhs` (element-wise), with all bits set in
+/// the lanes where it holds and none in the others.
+/// @return `(CInt32x8){ lhs[0] <= rhs[0], lhs[1] <= rhs[1], ... }`
+FORCE_INLINE(CInt32x8)
+CUInt32x8CompareLessThanOrEqual(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_cmpeq_epi32(_mm256_max_epu32(lhs, rhs), rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)(lhs <= rhs);
+#else
+  CInt32x8 result;
+  result.lo = CUInt32x4CompareLessThanOrEqual(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4CompareLessThanOrEqual(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Selects the elements of `trueValue` in the lanes set in `mask` and the ones
+/// of `falseValue` in the others, without a branch. Each lane of `mask` must
+/// have either all or none of its bits set, as the comparisons return them.
+/// @return `(CUInt32x8){ mask[0] ? trueValue[0] : falseValue[0], ... }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8Select(const CInt32x8 mask, const CUInt32x8 trueValue, const CUInt32x8 falseValue)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_blendv_epi8(falseValue, trueValue, mask);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8)(((CInt32x8)trueValue & mask) | ((CInt32x8)falseValue & ~mask));
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4Select(mask.lo, trueValue.lo, falseValue.lo);
+  result.hi = CUInt32x4Select(mask.hi, trueValue.hi, falseValue.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Reduction
+
+/// Returns whether any lane of `mask` is set, testing all lanes at once.
+/// @return `mask[0] || mask[1] || ... || mask[7]`
+FORCE_INLINE(bool)
+CInt32x8MaskAny(const CInt32x8 mask)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_movemask_ps(_mm256_castsi256_ps(mask)) != 0;
+#else
+  return CInt32x4MaskAny(CInt32x4BitwiseOr(CInt32x8GetLow(mask), CInt32x8GetHigh(mask)));
+#endif
+}
+
+/// Returns whether all lanes of `mask` are set, testing all lanes at once.
+/// @return `mask[0] && mask[1] && ... && mask[7]`
+FORCE_INLINE(bool)
+CInt32x8MaskAll(const CInt32x8 mask)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_movemask_ps(_mm256_castsi256_ps(mask)) == 0xFF;
+#else
+  return CInt32x4MaskAll(CInt32x4BitwiseAnd(CInt32x8GetLow(mask), CInt32x8GetHigh(mask)));
+#endif
+}
+
+#undef Int32
@@ -0,0 +1,505 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit floating point element
+#define Float32 float
+
+/// A quaternion of 4 x 32-bit floating point components.
+///
+/// The imaginary parts are stored in the three least-significant lanes and the
+/// real part in the most-significant lane, i.e. `(CFloat32x4){ x, y, z, w }`.
+typedef CFloat32x4 CQuaternionF32;
+
+#pragma mark - Initialisation
+
+/// Initializes a quaternion to given components. Imaginary parts first.
+/// @return `(CQuaternionF32){ x, y, z, w }`
+FORCE_INLINE(CQuaternionF32)
+CQuaternionF32Make(Float32 x, Float32 y, Float32 z, Float32 w)
+{
+  return CFloat32x4Make(x, y, z, w);
+}
+
+/// Returns the multiplicative identity quaternion.
+/// @return `(CQuaternionF32){ 0.f, 0.f, 0.f, 1.f }`
+FORCE_INLINE(CQuaternionF32) CQuaternionF32MakeIdentity(void)
+{
+  return CFloat32x4Make(0.f, 0.f, 0.f, 1.f);
+}
+
+/// Initializes a quaternion to given imaginary parts and real part, by
+/// inserting the real part into the unused lane of `imaginary`.
+/// @return `(CQuaternionF32){ imaginary[0], imaginary[1], imaginary[2], real }`
+FORCE_INLINE(CQuaternionF32)
+CQuaternionF32MakeWithImaginary(const CFloat32x3 imaginary, const Float32 real)
+{
+#if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2 || CSIMDX_EXT_VECTOR
+  return CFloat32x4InsertLane(imaginary, 3, real);
+#else
+  return CFloat32x4Make(CFloat32x3GetElement(imaginary, 0),
+                        CFloat32x3GetElement(imaginary, 1),
+                        CFloat32x3GetElement(imaginary, 2),
+                        real);
+#endif
+}
+
+#pragma mark - Components
+
+/// Returns the real part of the quaternion.
+/// @return `operand[3]`
+FORCE_INLINE(Float32) CQuaternionF32GetReal(const CQuaternionF32 operand)
+{
+  return CFloat32x4ExtractLane(operand, 3);
+}
+
+/// Returns the imaginary parts of the quaternion, by zeroing the lane of the
+/// real part, which is the unused lane of a `CFloat32x3`.
+/// @return `(CFloat32x3){ operand[0], operand[1], operand[2] }`
+FORCE_INLINE(CFloat32x3) CQuaternionF32GetImaginary(const CQuaternionF32 operand)
+{
+#if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2 || CSIMDX_EXT_VECTOR
+  return CFloat32x4InsertLane(operand, 3, 0.f);
+#else
+  return CFloat32x3Make(CFloat32x4GetElement(operand, 0),
+                        CFloat32x4GetElement(operand, 1),
+                        CFloat32x4GetElement(operand, 2));
+#endif
+}
+
+#pragma mark - Products
+
+/// Returns the four-dimensional dot product of both quaternions.
+/// @return `lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3] * rhs[3]`
+FORCE_INLINE(Float32)
+CQuaternionF32Dot(const CQuaternionF32 lhs, const CQuaternionF32 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vaddvq_f32(vmulq_f32(lhs, rhs));
+#elif CSIMDX_ARM_NEON
+  float32x4_t product = vmulq_f32(lhs, rhs);
+  float32x2_t sum = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+  return vget_lane_f32(vpadd_f32(sum, sum), 0);
+#elif CSIMDX_X86_SSE4_1
+  return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xF1));
+#elif CSIMDX_X86_SSE2
+  __m128 product = _mm_mul_ps(lhs, rhs);
+  __m128 sum = _mm_add_ps(product, _mm_movehl_ps(product, product));
+  return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+#else
+  return CFloat32x4GetElement(lhs, 0) * CFloat32x4GetElement(rhs, 0)
+       + CFloat32x4GetElement(lhs, 1) * CFloat32x4GetElement(rhs, 1)
+       + CFloat32x4GetElement(lhs, 2) * CFloat32x4GetElement(rhs, 2)
+       + CFloat32x4GetElement(lhs, 3) * CFloat32x4GetElement(rhs, 3);
+#endif
+}
+
+/// Returns the Hamilton product of both quaternions, i.e. the rotation `rhs`
+/// followed by the rotation `lhs`.
+/// @return
+///   (CQuaternionF32){
+///     lw * rx + lx * rw + ly * rz - lz * ry,
+///     lw * ry - lx * rz + ly * rw + lz * rx,
+///     lw * rz + lx * ry - ly * rx + lz * rw,
+///     lw * rw - lx * rx - ly * ry - lz * rz
+///   }
+FORCE_INLINE(CQuaternionF32)
+CQuaternionF32Multiply(const CQuaternionF32 lhs, const CQuaternionF32 rhs)
+{
+#if CSIMDX_ARM_NEON
+  // The sign of each product term is applied by flipping the sign bit.
+  const uint32x4_t signs0 = { 0, 0x80000000, 0, 0x80000000 };
+  const uint32x4_t signs1 = { 0, 0, 0x80000000, 0x80000000 };
+  const uint32x4_t signs2 = { 0x80000000, 0, 0, 0x80000000 };
+  float32x4_t rhsYXWZ = vrev64q_f32(rhs);
+  float32x4_t rhsWZYX = vextq_f32(rhsYXWZ, rhsYXWZ, 2);
+  float32x4_t rhsZWXY = vextq_f32(rhs, rhs, 2);
+  float32x4_t result = vmulq_f32(vdupq_lane_f32(vget_high_f32(lhs), 1), rhs);
+  result = CFloat32x4MultiplyAdd(vdupq_lane_f32(vget_low_f32(lhs), 0),
+    vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(rhsWZYX), signs0)), result);
+  result = CFloat32x4MultiplyAdd(vdupq_lane_f32(vget_low_f32(lhs), 1),
+    vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(rhsZWXY), signs1)), result);
+  result = CFloat32x4MultiplyAdd(vdupq_lane_f32(vget_high_f32(lhs), 0),
+    vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(rhsYXWZ), signs2)), result);
+  return result;
+#elif CSIMDX_X86_SSE2
+  // The sign of each product term is applied by flipping the sign bit.
+  const __m128 signs0 = _mm_setr_ps( 0.f, -0.f,  0.f, -0.f);
+  const __m128 signs1 = _mm_setr_ps( 0.f,  0.f, -0.f, -0.f);
+  const __m128 signs2 = _mm_setr_ps(-0.f,  0.f,  0.f, -0.f);
+  __m128 rhsWZYX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 1, 2, 3));
+  __m128 rhsZWXY = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2));
+  __m128 rhsYXWZ = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(2, 3, 0, 1));
+  __m128 result = _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 3, 3, 3)), rhs);
+  result = CFloat32x4MultiplyAdd(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(0, 0, 0, 0)),
+                                 _mm_xor_ps(rhsWZYX, signs0), result);
+  result = CFloat32x4MultiplyAdd(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(1, 1, 1, 1)),
+                                 _mm_xor_ps(rhsZWXY, signs1), result);
+  result = CFloat32x4MultiplyAdd(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 2, 2, 2)),
+                                 _mm_xor_ps(rhsYXWZ, signs2), result);
+  return result;
+#else
+  Float32 lx = CFloat32x4GetElement(lhs, 0), rx = CFloat32x4GetElement(rhs, 0);
+  Float32 ly = CFloat32x4GetElement(lhs, 1), ry = CFloat32x4GetElement(rhs, 1);
+  Float32 lz = CFloat32x4GetElement(lhs, 2), rz = CFloat32x4GetElement(rhs, 2);
+  Float32 lw = CFloat32x4GetElement(lhs, 3), rw = CFloat32x4GetElement(rhs, 3);
+  return CFloat32x4Make(lw * rx + lx * rw + ly * rz - lz * ry,
+                        lw * ry - lx * rz + ly * rw + lz * rx,
+                        lw * rz + lx * ry - ly * rx + lz * rw,
+                        lw * rw - lx * rx - ly * ry - lz * rz);
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Returns the conjugate of the quaternion, i.e. its imaginary parts negated.
+/// @return `(CQuaternionF32){ -(operand[0]), -(operand[1]), -(operand[2]), operand[3] }`
+FORCE_INLINE(CQuaternionF32) CQuaternionF32Conjugate(const CQuaternionF32 operand)
+{
+#if CSIMDX_ARM_NEON
+  const uint32x4_t signs = { 0x80000000, 0x80000000, 0x80000000, 0 };
+  return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(operand), signs));
+#elif CSIMDX_X86_SSE2
+  return _mm_xor_ps(operand, _mm_setr_ps(-0.f, -0.f, -0.f, 0.f));
+#else
+  return CFloat32x4Make(-CFloat32x4GetElement(operand, 0),
+                        -CFloat32x4GetElement(operand, 1),
+                        -CFloat32x4GetElement(operand, 2),
+                        CFloat32x4GetElement(operand, 3));
+#endif
+}
+
+/// Returns the quaternion scaled to unit length. The reciprocal length is
+/// estimated and refined by Newton-Raphson, which yields a relative error of
+/// about 1e-6 without a square root or a division. The result of a quaternion
+/// of zero length is undefined.
+/// @return `operand / sqrt(dot(operand, operand))`
+FORCE_INLINE(CQuaternionF32) CQuaternionF32Normalize(const CQuaternionF32 operand)
+{
+#if CSIMDX_ARM_NEON
+  float32x4_t lengthSquared = vdupq_n_f32(CQuaternionF32Dot(operand, operand));
+  // vrsqrte is accurate to about 8 bits, each step doubles the precision.
+  float32x4_t estimate = vrsqrteq_f32(lengthSquared);
+  estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(lengthSquared, estimate), estimate));
+  estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(lengthSquared, estimate), estimate));
+  return vmulq_f32(operand, estimate);
+#elif CSIMDX_X86_SSE2
+  #if CSIMDX_X86_SSE4_1
+  __m128 lengthSquared = _mm_dp_ps(operand, operand, 0xFF);
+  #else
+  __m128 product = _mm_mul_ps(operand, operand);
+  __m128 sum = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 0, 3, 2)));
+  __m128 lengthSquared = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  #endif
+  // rsqrtps is accurate to about 12 bits, one step is enough for Float32.
+  // estimate' = estimate * (1.5 - 0.5 * lengthSquared * estimate * estimate)
+  __m128 estimate = _mm_rsqrt_ps(lengthSquared);
+  __m128 halfLengthSquared = _mm_mul_ps(lengthSquared, _mm_set1_ps(0.5f));
+  __m128 correction = _mm_sub_ps(_mm_set1_ps(1.5f),
+    _mm_mul_ps(halfLengthSquared, _mm_mul_ps(estimate, estimate)));
+  return _mm_mul_ps(operand, _mm_mul_ps(estimate, correction));
+#else
+  Float32 length = __builtin_sqrtf(CQuaternionF32Dot(operand, operand));
+  return CFloat32x4Multiply(operand, CFloat32x4MakeRepeatingElement(1.f / length));
+#endif
+}
+
+#pragma mark - Rotation
+
+/// Rotates the vector by the unit quaternion, i.e. `q * v * conjugate(q)`.
+/// Computed as `v + w * t + cross(q.xyz, t)` with `t = 2 * cross(q.xyz, v)`.
+/// @return `(CFloat32x3){ rotated[0], rotated[1], rotated[2] }`
+FORCE_INLINE(CFloat32x3)
+CQuaternionF32RotateVector(const CQuaternionF32 quaternion, const CFloat32x3 vector)
+{
+#if CSIMDX_ARM_NEON || CSIMDX_X86_SSE2
+  // The unused lane of `vector` is zero and so is the unused lane of every cross product
+  CFloat32x3 twice = CFloat32x3Cross(quaternion, vector);
+  twice = CFloat32x3Add(twice, twice);
+  #if CSIMDX_ARM_NEON
+  CFloat32x4 real = vdupq_lane_f32(vget_high_f32(quaternion), 1);
+  #else
+  CFloat32x4 real = _mm_shuffle_ps(quaternion, quaternion, _MM_SHUFFLE(3, 3, 3, 3));
+  #endif
+  return CFloat32x4Add(CFloat32x4MultiplyAdd(real, twice, vector),
+                       CFloat32x3Cross(quaternion, twice));
+#else
+  Float32 qx = CFloat32x4GetElement(quaternion, 0);
+  Float32 qy = CFloat32x4GetElement(quaternion, 1);
+  Float32 qz = CFloat32x4GetElement(quaternion, 2);
+  Float32 qw = CFloat32x4GetElement(quaternion, 3);
+  Float32 vx = CFloat32x3GetElement(vector, 0);
+  Float32 vy = CFloat32x3GetElement(vector, 1);
+  Float32 vz = CFloat32x3GetElement(vector, 2);
+  Float32 tx = 2.f * (qy * vz - qz * vy);
+  Float32 ty = 2.f * (qz * vx - qx * vz);
+  Float32 tz = 2.f * (qx * vy - qy * vx);
+  return CFloat32x3Make(vx + qw * tx + (qy * tz - qz * ty),
+                        vy + qw * ty + (qz * tx - qx * tz),
+                        vz + qw * tz + (qx * ty - qy * tx));
+#endif
+}
+
+#pragma mark - Interpolation
+
+/// Linearly interpolates both quaternions along the shorter path and
+/// normalizes the result. Cheaper than, but not of constant angular
+/// velocity like `CQuaternionF32Slerp`.
+/// @return `normalize(from + (to - from) * t)`
+FORCE_INLINE(CQuaternionF32)
+CQuaternionF32NLerp(const CQuaternionF32 from, const CQuaternionF32 to, const Float32 t)
+{
+  CQuaternionF32 target = CQuaternionF32Dot(from, to) < 0.f ? CFloat32x4Negate(to) : to;
+  CFloat32x4 difference = CFloat32x4Subtract(target, from);
+  return CQuaternionF32Normalize(
+    CFloat32x4MultiplyAdd(difference, CFloat32x4MakeRepeatingElement(t), from)
+  );
+}
+
+/// Spherically interpolates both unit quaternions along the shorter path.
+/// Falls back to `CQuaternionF32NLerp` for nearly parallel quaternions, where
+/// the spherical weights become numerically unstable.
+/// @return `from * sin((1 - t) * angle) / sin(angle) + to * sin(t * angle) / sin(angle)`
+FORCE_INLINE(CQuaternionF32)
+CQuaternionF32Slerp(const CQuaternionF32 from, const CQuaternionF32 to, const Float32 t)
+{
+  Float32 cosine = CQuaternionF32Dot(from, to);
+  CQuaternionF32 target = to;
+  if (cosine < 0.f) {
+    cosine = -cosine;
+    target = CFloat32x4Negate(to);
+  }
+  if (cosine > 0.9995f) {
+    CFloat32x4 difference = CFloat32x4Subtract(target, from);
+    return CQuaternionF32Normalize(
+      CFloat32x4MultiplyAdd(difference, CFloat32x4MakeRepeatingElement(t), from)
+    );
+  }
+  Float32 angle = __builtin_acosf(cosine);
+  Float32 reciprocalSine = 1.f / __builtin_sinf(angle);
+  Float32 fromWeight = __builtin_sinf((1.f - t) * angle) * reciprocalSine;
+  Float32 toWeight = __builtin_sinf(t * angle) * reciprocalSine;
+  return CFloat32x4MultiplyAdd(
+    CFloat32x4MakeRepeatingElement(toWeight), target,
+    CFloat32x4Multiply(CFloat32x4MakeRepeatingElement(fromWeight), from)
+  );
+}
+
+#pragma mark - Batch Interpolation
+
+/// Transposes 4 quaternions, one per storage, into 4 storages of one
+/// component each, i.e. `x`, `y`, `z` and `w` of all quaternions. Transposing
+/// again restores the quaternions.
+FORCE_INLINE(void)
+CQuaternionF32Transpose4(CFloat32x4* row0, CFloat32x4* row1, CFloat32x4* row2, CFloat32x4* row3)
+{
+#if CSIMDX_ARM_NEON
+  float32x4x2_t low = vtrnq_f32(*row0, *row1);  // { x0, x1, z0, z1 }, { y0, y1, w0, w1 }
+  float32x4x2_t high = vtrnq_f32(*row2, *row3); // { x2, x3, z2, z3 }, { y2, y3, w2, w3 }
+  *row0 = vcombine_f32(vget_low_f32(low.val[0]), vget_low_f32(high.val[0]));
+  *row1 = vcombine_f32(vget_low_f32(low.val[1]), vget_low_f32(high.val[1]));
+  *row2 = vcombine_f32(vget_high_f32(low.val[0]), vget_high_f32(high.val[0]));
+  *row3 = vcombine_f32(vget_high_f32(low.val[1]), vget_high_f32(high.val[1]));
+#elif CSIMDX_X86_SSE2
+  _MM_TRANSPOSE4_PS(*row0, *row1, *row2, *row3);
+#else
+  Float32 elements[4][4];
+  for (int lane = 0; lane < 4; ++lane) {
+    elements[0][lane] = CFloat32x4GetElement(*row0, lane);
+    elements[1][lane] = CFloat32x4GetElement(*row1, lane);
+    elements[2][lane] = CFloat32x4GetElement(*row2, lane);
+    elements[3][lane] = CFloat32x4GetElement(*row3, lane);
+  }
+  *row0 = CFloat32x4Make(elements[0][0], elements[1][0], elements[2][0], elements[3][0]);
+  *row1 = CFloat32x4Make(elements[0][1], elements[1][1], elements[2][1], elements[3][1]);
+  *row2 = CFloat32x4Make(elements[0][2], elements[1][2], elements[2][2], elements[3][2]);
+  *row3 = CFloat32x4Make(elements[0][3], elements[1][3], elements[2][3], elements[3][3]);
+#endif
+}
+
+/// Flips 4 quaternions of `to`, one per lane of each component, to the
+/// shorter path from those of `from`, and returns their cosines, i.e. the
+/// magnitudes of the dot products.
+FORCE_INLINE(CFloat32x4)
+CQuaternionF32ShorterPath4(const CFloat32x4 from[4], CFloat32x4 to[4])
+{
+  CFloat32x4 cosine = CFloat32x4Multiply(from[0], to[0]);
+  cosine = CFloat32x4MultiplyAdd(from[1], to[1], cosine);
+  cosine = CFloat32x4MultiplyAdd(from[2], to[2], cosine);
+  cosine = CFloat32x4MultiplyAdd(from[3], to[3], cosine);
+  // The sign bit of the lanes of a negative dot product, to be flipped in all components
+  CUInt32x4 sign = CUInt32x4BitwiseAnd(
+    CInt32x4ReinterpretAsCUInt32x4(CFloat32x4CompareLessThan(cosine, CFloat32x4MakeRepeatingElement(0.f))),
+    CUInt32x4MakeRepeatingElement(0x80000000)
+  );
+  for (int component = 0; component < 4; ++component) {
+    to[component] = CUInt32x4ReinterpretAsCFloat32x4(
+      CUInt32x4BitwiseExclusiveOr(CFloat32x4ReinterpretAsCUInt32x4(to[component]), sign)
+    );
+  }
+  return CUInt32x4ReinterpretAsCFloat32x4(
+    CUInt32x4BitwiseExclusiveOr(CFloat32x4ReinterpretAsCUInt32x4(cosine), sign)
+  );
+}
+
+/// Linearly interpolates 4 quaternions, one per lane of each component, and
+/// normalizes the results.
+FORCE_INLINE(void)
+CQuaternionF32NLerp4(const CFloat32x4 from[4], const CFloat32x4 to[4], const CFloat32x4 t, CFloat32x4 result[4])
+{
+  CFloat32x4 lengthSquared = CFloat32x4MakeRepeatingElement(0.f);
+  for (int component = 0; component < 4; ++component) {
+    result[component] = CFloat32x4MultiplyAdd(CFloat32x4Subtract(to[component], from[component]), t,
+                                              from[component]);
+    lengthSquared = CFloat32x4MultiplyAdd(result[component], result[component], lengthSquared);
+  }
+  CFloat32x4 reciprocalLength = CFloat32x4Divide(CFloat32x4MakeRepeatingElement(1.f),
+                                                 CFloat32x4SquareRoot(lengthSquared));
+  for (int component = 0; component < 4; ++component) {
+    result[component] = CFloat32x4Multiply(result[component], reciprocalLength);
+  }
+}
+
+/// Returns the arc cosine of each element in [0, 1], by the arc sine of either
+/// the element or the half angle, which are both at most 0.5 and of which the
+/// arc sine is a polynomial accurate to a few units in the last place.
+/// @return `(CFloat32x4){ acos(operand[0]), acos(operand[1]), ... }`
+FORCE_INLINE(CFloat32x4) CQuaternionF32ArcCosine4(const CFloat32x4 operand)
+{
+  // acos(c) = π/2 - asin(c) for c <= 0.5 and 2 * asin(sqrt((1 - c) / 2)) otherwise
+  CInt32x4 isLarge = CFloat32x4CompareLessThan(CFloat32x4MakeRepeatingElement(0.5f), operand);
+  CFloat32x4 halfAngle = CFloat32x4SquareRoot(CFloat32x4Multiply(
+    CFloat32x4Subtract(CFloat32x4MakeRepeatingElement(1.f), operand), CFloat32x4MakeRepeatingElement(0.5f)
+  ));
+  CFloat32x4 x = CFloat32x4Select(isLarge, halfAngle, operand);
+  CFloat32x4 x2 = CFloat32x4Multiply(x, x);
+  CFloat32x4 series = CFloat32x4MultiplyAdd(x2, CFloat32x4MakeRepeatingElement(4.2163199048e-2f),
+                                            CFloat32x4MakeRepeatingElement(2.4181311049e-2f));
+  series = CFloat32x4MultiplyAdd(x2, series, CFloat32x4MakeRepeatingElement(4.5470025998e-2f));
+  series = CFloat32x4MultiplyAdd(x2, series, CFloat32x4MakeRepeatingElement(7.4953002686e-2f));
+  series = CFloat32x4MultiplyAdd(x2, series, CFloat32x4MakeRepeatingElement(1.6666752422e-1f));
+  CFloat32x4 arcSine = CFloat32x4MultiplyAdd(CFloat32x4Multiply(x2, series), x, x);
+  return CFloat32x4Select(isLarge, CFloat32x4Add(arcSine, arcSine),
+                          CFloat32x4Subtract(CFloat32x4MakeRepeatingElement(1.57079632679f), arcSine));
+}
+
+/// Returns the sine of each element in [0, π/2], by its Taylor series, which
+/// is accurate to about one unit in the last place on this range.
+/// @return `(CFloat32x4){ sin(operand[0]), sin(operand[1]), ... }`
+FORCE_INLINE(CFloat32x4) CQuaternionF32Sine4(const CFloat32x4 operand)
+{
+  CFloat32x4 x2 = CFloat32x4Multiply(operand, operand);
+  CFloat32x4 sine = CFloat32x4MultiplyAdd(x2, CFloat32x4MakeRepeatingElement(-1.f / 39916800.f),
+                                          CFloat32x4MakeRepeatingElement(1.f / 362880.f));
+  sine = CFloat32x4MultiplyAdd(x2, sine, CFloat32x4MakeRepeatingElement(-1.f / 5040.f));
+  sine = CFloat32x4MultiplyAdd(x2, sine, CFloat32x4MakeRepeatingElement(1.f / 120.f));
+  sine = CFloat32x4MultiplyAdd(x2, sine, CFloat32x4MakeRepeatingElement(-1.f / 6.f));
+  return CFloat32x4MultiplyAdd(CFloat32x4Multiply(x2, sine), operand, operand);
+}
+
+/// Interpolates `count` pairs of quaternions using `CQuaternionF32NLerp`,
+/// i.e. `result[i] = CQuaternionF32NLerp(from[i], to[i], t[i])`.
+///
+/// Each 4 pairs are transposed into one storage per component, so that all
+/// 4 are interpolated lane-parallel, and the remaining pairs one by one.
+FORCE_INLINE(void)
+CQuaternionF32NLerpBatch(const CQuaternionF32* from,
+                         const CQuaternionF32* to,
+                         const Float32* t,
+                         CQuaternionF32* result,
+                         const long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    CFloat32x4 fromComponents[4] = { from[index], from[index + 1], from[index + 2], from[index + 3] };
+    CFloat32x4 toComponents[4] = { to[index], to[index + 1], to[index + 2], to[index + 3] };
+    CQuaternionF32Transpose4(&fromComponents[0], &fromComponents[1], &fromComponents[2], &fromComponents[3]);
+    CQuaternionF32Transpose4(&toComponents[0], &toComponents[1], &toComponents[2], &toComponents[3]);
+    CQuaternionF32ShorterPath4(fromComponents, toComponents);
+
+    CFloat32x4 components[4];
+    CQuaternionF32NLerp4(fromComponents, toComponents, CFloat32x4MakeLoad(&t[index]), components);
+    CQuaternionF32Transpose4(&components[0], &components[1], &components[2], &components[3]);
+    for (int offset = 0; offset < 4; ++offset) result[index + offset] = components[offset];
+  }
+  for (; index < count; ++index) {
+    result[index] = CQuaternionF32NLerp(from[index], to[index], t[index]);
+  }
+}
+
+/// Interpolates `count` pairs of quaternions using `CQuaternionF32Slerp`,
+/// i.e. `result[i] = CQuaternionF32Slerp(from[i], to[i], t[i])`.
+///
+/// Each 4 pairs are transposed into one storage per component, so that all
+/// 4 are interpolated lane-parallel, and the remaining pairs one by one. The
+/// arc cosine and sines are polynomial approximations to stay in vector
+/// registers, and nearly parallel pairs are linearly interpolated in the same
+/// pass and selected by lane. The sines are accurate for `t` in [0, 1] only,
+/// so pairs extrapolated beyond are interpolated one by one as well.
+FORCE_INLINE(void)
+CQuaternionF32SlerpBatch(const CQuaternionF32* from,
+                         const CQuaternionF32* to,
+                         const Float32* t,
+                         CQuaternionF32* result,
+                         const long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    CFloat32x4 fromComponents[4] = { from[index], from[index + 1], from[index + 2], from[index + 3] };
+    CFloat32x4 toComponents[4] = { to[index], to[index + 1], to[index + 2], to[index + 3] };
+    CQuaternionF32Transpose4(&fromComponents[0], &fromComponents[1], &fromComponents[2], &fromComponents[3]);
+    CQuaternionF32Transpose4(&toComponents[0], &toComponents[1], &toComponents[2], &toComponents[3]);
+    CFloat32x4 cosine = CQuaternionF32ShorterPath4(fromComponents, toComponents);
+    CFloat32x4 parameter = CFloat32x4MakeLoad(&t[index]);
+
+    CFloat32x4 components[4];
+    CQuaternionF32NLerp4(fromComponents, toComponents, parameter, components);
+    CInt32x4 isParallel = CFloat32x4CompareLessThan(CFloat32x4MakeRepeatingElement(0.9995f), cosine);
+    CInt32x4 isExtrapolated = CInt32x4BitwiseOr(
+      CFloat32x4CompareLessThan(parameter, CFloat32x4MakeZero()),
+      CFloat32x4CompareLessThan(CFloat32x4MakeRepeatingElement(1.f), parameter)
+    );
+
+    // The weights of parallel lanes may divide by zero, but are not selected
+    CFloat32x4 angle = CQuaternionF32ArcCosine4(cosine);
+    CFloat32x4 reciprocalSine = CFloat32x4Divide(CFloat32x4MakeRepeatingElement(1.f),
+                                                 CQuaternionF32Sine4(angle));
+    CFloat32x4 fromWeight = CFloat32x4Multiply(CQuaternionF32Sine4(CFloat32x4Multiply(
+      CFloat32x4Subtract(CFloat32x4MakeRepeatingElement(1.f), parameter), angle
+    )), reciprocalSine);
+    CFloat32x4 toWeight = CFloat32x4Multiply(CQuaternionF32Sine4(CFloat32x4Multiply(parameter, angle)),
+                                             reciprocalSine);
+    for (int component = 0; component < 4; ++component) {
+      CFloat32x4 weighted = CFloat32x4MultiplyAdd(toWeight, toComponents[component],
+                                                  CFloat32x4Multiply(fromWeight, fromComponents[component]));
+      components[component] = CFloat32x4Select(isParallel, components[component], weighted);
+    }
+    CQuaternionF32Transpose4(&components[0], &components[1], &components[2], &components[3]);
+    for (int offset = 0; offset < 4; ++offset) result[index + offset] = components[offset];
+    if (CInt32x4MaskAny(isExtrapolated)) {
+      for (int offset = 0; offset < 4; ++offset) {
+        if (CInt32x4GetElement(isExtrapolated, offset) == 0) continue;
+        result[index + offset] = CQuaternionF32Slerp(from[index + offset], to[index + offset], t[index + offset]);
+      }
+    }
+  }
+  for (; index < count; ++index) {
+    result[index] = CQuaternionF32Slerp(from[index], to[index], t[index]);
+  }
+}
+
+#undef Float32
@@ -0,0 +1,281 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit unsigned integer element
+#define UInt32 uint32_t
+
+/// The 32-bit floating point element
+#define Float32 float
+
+/// The state of 4 independent xoshiro128+ generators, one per lane.
+///
+/// xoshiro128+ (Blackman & Vigna) has a period of 2^128 - 1 and is fast, but its
+/// lowest bits have low linear complexity. All floating-point outputs are thus
+/// derived from the upper bits of each 32-bit output only.
+typedef struct CXoshiro128x4_t {
+  CUInt32x4 s0, s1, s2, s3;
+} CXoshiro128x4;
+
+#pragma mark - Helpers
+
+/// Advances a splitmix64 state and returns its next output, used for seeding.
+FORCE_INLINE(uint64_t) CXoshiro128x4SplitMix64(uint64_t* state)
+{
+  uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+#pragma mark - Initialisation
+
+/// Initializes 4 generators from `seed`, where each (`seed`, `stream`) pair
+/// results in a different set of lanes. Use one `stream` per thread to get
+/// independent sequences; `CXoshiro128x4Jump` guarantees non-overlapping ones.
+FORCE_INLINE(CXoshiro128x4)
+CXoshiro128x4Make(const uint64_t seed, const uint64_t stream)
+{
+  uint64_t splitMix = seed ^ (stream * 0xD1342543DE82EF95ULL);
+  UInt32 words[16];
+  for (int index = 0; index < 16; index += 2) {
+    uint64_t value = CXoshiro128x4SplitMix64(&splitMix);
+    words[index] = (UInt32)value;
+    words[index + 1] = (UInt32)(value >> 32);
+  }
+  // Lane `i` is seeded from words `4 * i ..< 4 * i + 4`, transposed into `s0...s3`.
+  CXoshiro128x4 state;
+  state.s0 = CUInt32x4Make(words[0], words[4], words[8], words[12]);
+  state.s1 = CUInt32x4Make(words[1], words[5], words[9], words[13]);
+  state.s2 = CUInt32x4Make(words[2], words[6], words[10], words[14]);
+  state.s3 = CUInt32x4Make(words[3], words[7], words[11], words[15]);
+  return state;
+}
+
+#pragma mark - Generation
+
+/// Returns the next 32-bit output of each lane and advances the state.
+/// @return `(CUInt32x4){ s0[0] + s3[0], s0[1] + s3[1], ... }`
+FORCE_INLINE(CUInt32x4) CXoshiro128x4NextUInt32x4(CXoshiro128x4* state)
+{
+  CUInt32x4 result = CUInt32x4Add(state->s0, state->s3);
+  CUInt32x4 t = CUInt32x4ShiftLeft(state->s1, 9);
+  state->s2 = CUInt32x4BitwiseExclusiveOr(state->s2, state->s0);
+  state->s3 = CUInt32x4BitwiseExclusiveOr(state->s3, state->s1);
+  state->s1 = CUInt32x4BitwiseExclusiveOr(state->s1, state->s2);
+  state->s0 = CUInt32x4BitwiseExclusiveOr(state->s0, state->s3);
+  state->s2 = CUInt32x4BitwiseExclusiveOr(state->s2, t);
+  state->s3 = CUInt32x4BitwiseOr(CUInt32x4ShiftLeft(state->s3, 11), CUInt32x4ShiftRight(state->s3, 21));
+  return result;
+}
+
+/// Advances each lane by 2^64 steps, i.e. the equivalent of 2^64 calls to
+/// `CXoshiro128x4NextUInt32x4`. Can be used to generate 2^64 non-overlapping
+/// sequences from a single seed.
+FORCE_INLINE(void) CXoshiro128x4Jump(CXoshiro128x4* state)
+{
+  static const UInt32 jump[4] = { 0x8764000B, 0xF542D2D3, 0x6FA035C3, 0x77F2DB5B };
+  CXoshiro128x4 result = {
+    CUInt32x4MakeZero(), CUInt32x4MakeZero(), CUInt32x4MakeZero(), CUInt32x4MakeZero()
+  };
+  for (int word = 0; word < 4; ++word) {
+    for (int bit = 0; bit < 32; ++bit) {
+      if (jump[word] & (1u << bit)) {
+        result.s0 = CUInt32x4BitwiseExclusiveOr(result.s0, state->s0);
+        result.s1 = CUInt32x4BitwiseExclusiveOr(result.s1, state->s1);
+        result.s2 = CUInt32x4BitwiseExclusiveOr(result.s2, state->s2);
+        result.s3 = CUInt32x4BitwiseExclusiveOr(result.s3, state->s3);
+      }
+      CXoshiro128x4NextUInt32x4(state);
+    }
+  }
+  *state = result;
+}
+
+/// Returns uniformly distributed values in `[0, 1)` with 23 bits of
+/// randomness each, built from the upper bits of the next output.
+/// @return `(CFloat32x4){ (next[0] >> 9) * 0x1p-23f, ... }`
+FORCE_INLINE(CFloat32x4) CXoshiro128x4NextFloat32x4(CXoshiro128x4* state)
+{
+  // Use the upper 23 bits as mantissa of a float in `[1, 2)` and subtract one
+  CUInt32x4 mantissa = CUInt32x4ShiftRight(CXoshiro128x4NextUInt32x4(state), 9);
+  CUInt32x4 bits = CUInt32x4BitwiseOr(mantissa, CUInt32x4MakeRepeatingElement(0x3F800000));
+  return CFloat32x4Subtract(CUInt32x4ReinterpretAsCFloat32x4(bits), CFloat32x4MakeRepeatingElement(1.f));
+}
+
+/// Returns standard normally distributed values (mean 0, deviation 1) using
+/// the Box-Muller transform, which yields 2 values per pair of uniform values.
+/// The second set is written to `second`, if non-null.
+///
+/// The logarithm, sine and cosine are polynomial approximations, accurate to
+/// a few units in the last place of 32-bit floats, to stay in vector registers.
+FORCE_INLINE(CFloat32x4)
+CXoshiro128x4NextNormalFloat32x4(CXoshiro128x4* state, CFloat32x4* second)
+{
+  const CUInt32x4 one = CUInt32x4MakeRepeatingElement(0x3F800000);
+  CUInt32x4 bits1 = CUInt32x4ShiftRight(CXoshiro128x4NextUInt32x4(state), 9);
+  CUInt32x4 bits2 = CUInt32x4ShiftRight(CXoshiro128x4NextUInt32x4(state), 9);
+  // uniform1 in (0, 1] to keep the logarithm finite, half the angle in [-π/2, π/2)
+  CFloat32x4 uniform1 = CFloat32x4Subtract(CFloat32x4MakeRepeatingElement(2.f),
+                                           CUInt32x4ReinterpretAsCFloat32x4(CUInt32x4BitwiseOr(bits1, one)));
+  CFloat32x4 halfAngle = CFloat32x4Multiply(
+    CFloat32x4Subtract(CUInt32x4ReinterpretAsCFloat32x4(CUInt32x4BitwiseOr(bits2, one)),
+                       CFloat32x4MakeRepeatingElement(1.5f)),
+    CFloat32x4MakeRepeatingElement(3.14159265f)
+  );
+
+  // log(uniform1) = exponent * log(2) + log(mantissa), where the mantissa is
+  // offset to [sqrt(1/2), sqrt(2)) and log(mantissa) = 2 * atanh((m - 1) / (m + 1))
+  CUInt32x4 offset = CUInt32x4Add(CFloat32x4ReinterpretAsCUInt32x4(uniform1),
+                                  CUInt32x4MakeRepeatingElement(0x3F800000 - 0x3F3504F3));
+  CFloat32x4 exponent = CFloat32x4Subtract(
+    CUInt32x4ReinterpretAsCFloat32x4(CUInt32x4BitwiseOr(CUInt32x4ShiftRight(offset, 23),
+                                                        CUInt32x4MakeRepeatingElement(0x4B000000))),
+    CFloat32x4MakeRepeatingElement(8388608.f + 127.f)
+  );
+  CFloat32x4 mantissa = CUInt32x4ReinterpretAsCFloat32x4(
+    CUInt32x4Add(CUInt32x4BitwiseAnd(offset, CUInt32x4MakeRepeatingElement(0x007FFFFF)),
+                 CUInt32x4MakeRepeatingElement(0x3F3504F3))
+  );
+  CFloat32x4 t = CFloat32x4Divide(CFloat32x4Subtract(mantissa, CFloat32x4MakeRepeatingElement(1.f)),
+                                  CFloat32x4Add(mantissa, CFloat32x4MakeRepeatingElement(1.f)));
+  CFloat32x4 t2 = CFloat32x4Multiply(t, t);
+  CFloat32x4 series = CFloat32x4MultiplyAdd(t2, CFloat32x4MakeRepeatingElement(1.f / 9.f),
+                                            CFloat32x4MakeRepeatingElement(1.f / 7.f));
+  series = CFloat32x4MultiplyAdd(t2, series, CFloat32x4MakeRepeatingElement(1.f / 5.f));
+  series = CFloat32x4MultiplyAdd(t2, series, CFloat32x4MakeRepeatingElement(1.f / 3.f));
+  series = CFloat32x4MultiplyAdd(t2, series, CFloat32x4MakeRepeatingElement(1.f));
+  // radius = sqrt(-2 * log(uniform1)) = sqrt(exponent * -2log(2) - 4 * t * series)
+  CFloat32x4 radius = CFloat32x4SquareRoot(CFloat32x4MultiplyAdd(
+    exponent, CFloat32x4MakeRepeatingElement(-1.38629436f),
+    CFloat32x4Multiply(CFloat32x4Multiply(t, series), CFloat32x4MakeRepeatingElement(-4.f))
+  ));
+
+  // Taylor series of sine and cosine of the half angle, then the double angle formulas
+  CFloat32x4 h2 = CFloat32x4Multiply(halfAngle, halfAngle);
+  CFloat32x4 sine = CFloat32x4MultiplyAdd(h2, CFloat32x4MakeRepeatingElement(-1.f / 39916800.f),
+                                          CFloat32x4MakeRepeatingElement(1.f / 362880.f));
+  sine = CFloat32x4MultiplyAdd(h2, sine, CFloat32x4MakeRepeatingElement(-1.f / 5040.f));
+  sine = CFloat32x4MultiplyAdd(h2, sine, CFloat32x4MakeRepeatingElement(1.f / 120.f));
+  sine = CFloat32x4MultiplyAdd(h2, sine, CFloat32x4MakeRepeatingElement(-1.f / 6.f));
+  sine = CFloat32x4MultiplyAdd(h2, sine, CFloat32x4MakeRepeatingElement(1.f));
+  sine = CFloat32x4Multiply(sine, halfAngle);
+  CFloat32x4 cosine = CFloat32x4MultiplyAdd(h2, CFloat32x4MakeRepeatingElement(1.f / 479001600.f),
+                                            CFloat32x4MakeRepeatingElement(-1.f / 3628800.f));
+  cosine = CFloat32x4MultiplyAdd(h2, cosine, CFloat32x4MakeRepeatingElement(1.f / 40320.f));
+  cosine = CFloat32x4MultiplyAdd(h2, cosine, CFloat32x4MakeRepeatingElement(-1.f / 720.f));
+  cosine = CFloat32x4MultiplyAdd(h2, cosine, CFloat32x4MakeRepeatingElement(1.f / 24.f));
+  cosine = CFloat32x4MultiplyAdd(h2, cosine, CFloat32x4MakeRepeatingElement(-1.f / 2.f));
+  cosine = CFloat32x4MultiplyAdd(h2, cosine, CFloat32x4MakeRepeatingElement(1.f));
+
+  if (second) {
+    // sin(2h) = 2 * sin(h) * cos(h)
+    CFloat32x4 twiceSine = CFloat32x4Add(sine, sine);
+    *second = CFloat32x4Multiply(radius, CFloat32x4Multiply(twiceSine, cosine));
+  }
+  // cos(2h) = cos(h)^2 - sin(h)^2
+  CFloat32x4 doubleCosine = CFloat32x4Subtract(CFloat32x4Multiply(cosine, cosine),
+                                               CFloat32x4Multiply(sine, sine));
+  return CFloat32x4Multiply(radius, doubleCosine);
+}
+
+#pragma mark - Bulk Generation
+
+/// Fills `buffer` with `count` uniformly distributed 32-bit values.
+FORCE_INLINE(void)
+CXoshiro128x4FillUInt32(CXoshiro128x4* state, UInt32* buffer, const long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    CUInt32x4 next = CXoshiro128x4NextUInt32x4(state);
+#if CSIMDX_ARM_NEON
+    vst1q_u32(buffer + index, next);
+#elif CSIMDX_X86_SSE2
+    _mm_storeu_si128((__m128i*)(buffer + index), next);
+#else
+    for (int lane = 0; lane < 4; ++lane) {
+      buffer[index + lane] = CUInt32x4GetElement(next, lane);
+    }
+#endif
+  }
+  if (index < count) {
+    CUInt32x4 next = CXoshiro128x4NextUInt32x4(state);
+    for (int lane = 0; index < count; ++index, ++lane) {
+      buffer[index] = CUInt32x4GetElement(next, lane);
+    }
+  }
+}
+
+/// Fills `buffer` with `count` uniformly distributed values in `[0, 1)`.
+FORCE_INLINE(void)
+CXoshiro128x4FillFloat32(CXoshiro128x4* state, Float32* buffer, const long count)
+{
+  long index = 0;
+  for (; index + 4 <= count; index += 4) {
+    CFloat32x4 next = CXoshiro128x4NextFloat32x4(state);
+#if CSIMDX_ARM_NEON
+    vst1q_f32(buffer + index, next);
+#elif CSIMDX_X86_SSE2
+    _mm_storeu_ps(buffer + index, next);
+#else
+    for (int lane = 0; lane < 4; ++lane) {
+      buffer[index + lane] = CFloat32x4GetElement(next, lane);
+    }
+#endif
+  }
+  if (index < count) {
+    CFloat32x4 next = CXoshiro128x4NextFloat32x4(state);
+    for (int lane = 0; index < count; ++index, ++lane) {
+      buffer[index] = CFloat32x4GetElement(next, lane);
+    }
+  }
+}
+
+/// Fills `buffer` with `count` standard normally distributed values, using
+/// both sets of values of each `CXoshiro128x4NextNormalFloat32x4` call.
+FORCE_INLINE(void)
+CXoshiro128x4FillNormalFloat32(CXoshiro128x4* state, Float32* buffer, const long count)
+{
+  long index = 0;
+  for (; index + 8 <= count; index += 8) {
+    CFloat32x4 second;
+    CFloat32x4 first = CXoshiro128x4NextNormalFloat32x4(state, &second);
+#if CSIMDX_ARM_NEON
+    vst1q_f32(buffer + index, first);
+    vst1q_f32(buffer + index + 4, second);
+#elif CSIMDX_X86_SSE2
+    _mm_storeu_ps(buffer + index, first);
+    _mm_storeu_ps(buffer + index + 4, second);
+#else
+    for (int lane = 0; lane < 4; ++lane) {
+      buffer[index + lane] = CFloat32x4GetElement(first, lane);
+      buffer[index + 4 + lane] = CFloat32x4GetElement(second, lane);
+    }
+#endif
+  }
+  if (index < count) {
+    CFloat32x4 second;
+    CFloat32x4 first = CXoshiro128x4NextNormalFloat32x4(state, &second);
+    for (int lane = 0; index < count; ++index, ++lane) {
+      buffer[index] = lane < 4 ? CFloat32x4GetElement(first, lane)
+                               : CFloat32x4GetElement(second, lane - 4);
+    }
+  }
+}
+
+#undef UInt32
+#undef Float32
@@ -0,0 +1,360 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Reinterpret the bits of one 128-bit storage as another one, without any
+// instruction. The unused lane of the storages of 3 lanes is zero in either,
+// hence they are only reinterpreted as one another.
+//
+// They are declared after all storages, as they combine storages of different
+// element types.
+
+#pragma mark - Float32x4
+
+/// Reinterprets the bits of `operand` as a `CInt32x4`, without converting them.
+/// @return `(CInt32x4){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x4)
+CFloat32x4ReinterpretAsCInt32x4(const CFloat32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_f32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_si128(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)operand;
+#else
+  union { CFloat32x4 value; CInt32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x4`, without converting them.
+/// @return `(CUInt32x4){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x4)
+CFloat32x4ReinterpretAsCUInt32x4(const CFloat32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_u32_f32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_si128(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x4)operand;
+#else
+  union { CFloat32x4 value; CUInt32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x2`, without converting them.
+/// @return `(CFloat64x2){ bits(operand[0], operand[1]), bits(operand[2], operand[3]) }`
+FORCE_INLINE(CFloat64x2)
+CFloat32x4ReinterpretAsCFloat64x2(const CFloat32x4 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_f64_f32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x2)operand;
+#else
+  union { CFloat32x4 value; CFloat64x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - Int32x4
+
+/// Reinterprets the bits of `operand` as a `CFloat32x4`, without converting them.
+/// @return `(CFloat32x4){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x4)
+CInt32x4ReinterpretAsCFloat32x4(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_f32_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4)operand;
+#else
+  union { CInt32x4 value; CFloat32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x4`, without converting them.
+/// @return `(CUInt32x4){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x4)
+CInt32x4ReinterpretAsCUInt32x4(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_u32_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x4)operand;
+#else
+  union { CInt32x4 value; CUInt32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x2`, without converting them.
+/// @return `(CFloat64x2){ bits(operand[0], operand[1]), bits(operand[2], operand[3]) }`
+FORCE_INLINE(CFloat64x2)
+CInt32x4ReinterpretAsCFloat64x2(const CInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_f64_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x2)operand;
+#else
+  union { CInt32x4 value; CFloat64x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - UInt32x4
+
+/// Reinterprets the bits of `operand` as a `CFloat32x4`, without converting them.
+/// @return `(CFloat32x4){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x4)
+CUInt32x4ReinterpretAsCFloat32x4(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_f32_u32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4)operand;
+#else
+  union { CUInt32x4 value; CFloat32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x4`, without converting them.
+/// @return `(CInt32x4){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x4)
+CUInt32x4ReinterpretAsCInt32x4(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(operand);
+#elif CSIMDX_X86_SSE2
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)operand;
+#else
+  union { CUInt32x4 value; CInt32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x2`, without converting them.
+/// @return `(CFloat64x2){ bits(operand[0], operand[1]), bits(operand[2], operand[3]) }`
+FORCE_INLINE(CFloat64x2)
+CUInt32x4ReinterpretAsCFloat64x2(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_f64_u32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x2)operand;
+#else
+  union { CUInt32x4 value; CFloat64x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - Float64x2
+
+/// Reinterprets the bits of `operand` as a `CFloat32x4`, without converting them.
+/// @return `(CFloat32x4){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CFloat32x4)
+CFloat64x2ReinterpretAsCFloat32x4(const CFloat64x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_f32_f64(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castpd_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x4)operand;
+#else
+  union { CFloat64x2 value; CFloat32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x4`, without converting them.
+/// @return `(CInt32x4){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CInt32x4)
+CFloat64x2ReinterpretAsCInt32x4(const CFloat64x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_s32_f64(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castpd_si128(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x4)operand;
+#else
+  union { CFloat64x2 value; CInt32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x4`, without converting them.
+/// @return `(CUInt32x4){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CUInt32x4)
+CFloat64x2ReinterpretAsCUInt32x4(const CFloat64x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_u32_f64(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castpd_si128(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x4)operand;
+#else
+  union { CFloat64x2 value; CUInt32x4 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - Float32x3
+
+/// Reinterprets the bits of `operand` as a `CInt32x3`, without converting them.
+/// @return `(CInt32x3){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x3)
+CFloat32x3ReinterpretAsCInt32x3(const CFloat32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_f32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_si128(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3)operand;
+#else
+  union { CFloat32x3 value; CInt32x3 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x3`, without converting them.
+/// @return `(CUInt32x3){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x3)
+CFloat32x3ReinterpretAsCUInt32x3(const CFloat32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_u32_f32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castps_si128(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x3)operand;
+#else
+  union { CFloat32x3 value; CUInt32x3 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - Int32x3
+
+/// Reinterprets the bits of `operand` as a `CFloat32x3`, without converting them.
+/// @return `(CFloat32x3){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x3)
+CInt32x3ReinterpretAsCFloat32x3(const CInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_f32_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x3)operand;
+#else
+  union { CInt32x3 value; CFloat32x3 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x3`, without converting them.
+/// @return `(CUInt32x3){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x3)
+CInt32x3ReinterpretAsCUInt32x3(const CInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_u32_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x3)operand;
+#else
+  union { CInt32x3 value; CUInt32x3 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - UInt32x3
+
+/// Reinterprets the bits of `operand` as a `CFloat32x3`, without converting them.
+/// @return `(CFloat32x3){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x3)
+CUInt32x3ReinterpretAsCFloat32x3(const CUInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_f32_u32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x3)operand;
+#else
+  union { CUInt32x3 value; CFloat32x3 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x3`, without converting them.
+/// @return `(CInt32x3){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x3)
+CUInt32x3ReinterpretAsCInt32x3(const CUInt32x3 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_s32_u32(operand);
+#elif CSIMDX_X86_SSE2
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x3)operand;
+#else
+  union { CUInt32x3 value; CInt32x3 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
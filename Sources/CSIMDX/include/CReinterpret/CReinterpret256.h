@@ -0,0 +1,267 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Reinterpret the bits of one 256-bit storage as another one, without any
+// instruction on AVX2 and per half of 128 bits otherwise. On AVX without
+// AVX2, only the float storages are single registers, so that the halves
+// of the integer ones are inserted or extracted.
+//
+// They are declared after all storages, as they combine storages of different
+// element types.
+
+#pragma mark - Float32x8
+
+/// Reinterprets the bits of `operand` as a `CInt32x8`, without converting them.
+/// @return `(CInt32x8){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x8)
+CFloat32x8ReinterpretAsCInt32x8(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castps_si256(operand);
+#elif CSIMDX_X86_AVX
+  CInt32x8 result;
+  result.lo = CFloat32x4ReinterpretAsCInt32x4(_mm256_castps256_ps128(operand));
+  result.hi = CFloat32x4ReinterpretAsCInt32x4(_mm256_extractf128_ps(operand, 1));
+  return result;
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)operand;
+#else
+  CInt32x8 result;
+  result.lo = CFloat32x4ReinterpretAsCInt32x4(operand.lo);
+  result.hi = CFloat32x4ReinterpretAsCInt32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x8`, without converting them.
+/// @return `(CUInt32x8){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x8)
+CFloat32x8ReinterpretAsCUInt32x8(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castps_si256(operand);
+#elif CSIMDX_X86_AVX
+  CUInt32x8 result;
+  result.lo = CFloat32x4ReinterpretAsCUInt32x4(_mm256_castps256_ps128(operand));
+  result.hi = CFloat32x4ReinterpretAsCUInt32x4(_mm256_extractf128_ps(operand, 1));
+  return result;
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8)operand;
+#else
+  CUInt32x8 result;
+  result.lo = CFloat32x4ReinterpretAsCUInt32x4(operand.lo);
+  result.hi = CFloat32x4ReinterpretAsCUInt32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x4`, without converting them.
+/// @return `(CFloat64x4){ bits(operand[0], operand[1]), bits(operand[2], operand[3]), ... }`
+FORCE_INLINE(CFloat64x4)
+CFloat32x8ReinterpretAsCFloat64x4(const CFloat32x8 operand)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_castps_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x4)operand;
+#else
+  CFloat64x4 result;
+  result.lo = CFloat32x4ReinterpretAsCFloat64x2(operand.lo);
+  result.hi = CFloat32x4ReinterpretAsCFloat64x2(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Int32x8
+
+/// Reinterprets the bits of `operand` as a `CFloat32x8`, without converting them.
+/// @return `(CFloat32x8){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x8)
+CInt32x8ReinterpretAsCFloat32x8(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castsi256_ps(operand);
+#elif CSIMDX_X86_AVX
+  return _mm256_setr_m128(CInt32x4ReinterpretAsCFloat32x4(operand.lo),
+                          CInt32x4ReinterpretAsCFloat32x4(operand.hi));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8)operand;
+#else
+  CFloat32x8 result;
+  result.lo = CInt32x4ReinterpretAsCFloat32x4(operand.lo);
+  result.hi = CInt32x4ReinterpretAsCFloat32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x8`, without converting them.
+/// @return `(CUInt32x8){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x8)
+CInt32x8ReinterpretAsCUInt32x8(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8)operand;
+#else
+  CUInt32x8 result;
+  result.lo = CInt32x4ReinterpretAsCUInt32x4(operand.lo);
+  result.hi = CInt32x4ReinterpretAsCUInt32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x4`, without converting them.
+/// @return `(CFloat64x4){ bits(operand[0], operand[1]), bits(operand[2], operand[3]), ... }`
+FORCE_INLINE(CFloat64x4)
+CInt32x8ReinterpretAsCFloat64x4(const CInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castsi256_pd(operand);
+#elif CSIMDX_X86_AVX
+  return _mm256_setr_m128d(CInt32x4ReinterpretAsCFloat64x2(operand.lo),
+                           CInt32x4ReinterpretAsCFloat64x2(operand.hi));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x4)operand;
+#else
+  CFloat64x4 result;
+  result.lo = CInt32x4ReinterpretAsCFloat64x2(operand.lo);
+  result.hi = CInt32x4ReinterpretAsCFloat64x2(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - UInt32x8
+
+/// Reinterprets the bits of `operand` as a `CFloat32x8`, without converting them.
+/// @return `(CFloat32x8){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x8)
+CUInt32x8ReinterpretAsCFloat32x8(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castsi256_ps(operand);
+#elif CSIMDX_X86_AVX
+  return _mm256_setr_m128(CUInt32x4ReinterpretAsCFloat32x4(operand.lo),
+                          CUInt32x4ReinterpretAsCFloat32x4(operand.hi));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8)operand;
+#else
+  CFloat32x8 result;
+  result.lo = CUInt32x4ReinterpretAsCFloat32x4(operand.lo);
+  result.hi = CUInt32x4ReinterpretAsCFloat32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x8`, without converting them.
+/// @return `(CInt32x8){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x8)
+CUInt32x8ReinterpretAsCInt32x8(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)operand;
+#else
+  CInt32x8 result;
+  result.lo = CUInt32x4ReinterpretAsCInt32x4(operand.lo);
+  result.hi = CUInt32x4ReinterpretAsCInt32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x4`, without converting them.
+/// @return `(CFloat64x4){ bits(operand[0], operand[1]), bits(operand[2], operand[3]), ... }`
+FORCE_INLINE(CFloat64x4)
+CUInt32x8ReinterpretAsCFloat64x4(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castsi256_pd(operand);
+#elif CSIMDX_X86_AVX
+  return _mm256_setr_m128d(CUInt32x4ReinterpretAsCFloat64x2(operand.lo),
+                           CUInt32x4ReinterpretAsCFloat64x2(operand.hi));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x4)operand;
+#else
+  CFloat64x4 result;
+  result.lo = CUInt32x4ReinterpretAsCFloat64x2(operand.lo);
+  result.hi = CUInt32x4ReinterpretAsCFloat64x2(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Float64x4
+
+/// Reinterprets the bits of `operand` as a `CFloat32x8`, without converting them.
+/// @return `(CFloat32x8){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CFloat32x8)
+CFloat64x4ReinterpretAsCFloat32x8(const CFloat64x4 operand)
+{
+#if CSIMDX_X86_AVX
+  return _mm256_castpd_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x8)operand;
+#else
+  CFloat32x8 result;
+  result.lo = CFloat64x2ReinterpretAsCFloat32x4(operand.lo);
+  result.hi = CFloat64x2ReinterpretAsCFloat32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x8`, without converting them.
+/// @return `(CInt32x8){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CInt32x8)
+CFloat64x4ReinterpretAsCInt32x8(const CFloat64x4 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castpd_si256(operand);
+#elif CSIMDX_X86_AVX
+  CInt32x8 result;
+  result.lo = CFloat64x2ReinterpretAsCInt32x4(_mm256_castpd256_pd128(operand));
+  result.hi = CFloat64x2ReinterpretAsCInt32x4(_mm256_extractf128_pd(operand, 1));
+  return result;
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x8)operand;
+#else
+  CInt32x8 result;
+  result.lo = CFloat64x2ReinterpretAsCInt32x4(operand.lo);
+  result.hi = CFloat64x2ReinterpretAsCInt32x4(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x8`, without converting them.
+/// @return `(CUInt32x8){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CUInt32x8)
+CFloat64x4ReinterpretAsCUInt32x8(const CFloat64x4 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castpd_si256(operand);
+#elif CSIMDX_X86_AVX
+  CUInt32x8 result;
+  result.lo = CFloat64x2ReinterpretAsCUInt32x4(_mm256_castpd256_pd128(operand));
+  result.hi = CFloat64x2ReinterpretAsCUInt32x4(_mm256_extractf128_pd(operand, 1));
+  return result;
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8)operand;
+#else
+  CUInt32x8 result;
+  result.lo = CFloat64x2ReinterpretAsCUInt32x4(operand.lo);
+  result.hi = CFloat64x2ReinterpretAsCUInt32x4(operand.hi);
+  return result;
+#endif
+}
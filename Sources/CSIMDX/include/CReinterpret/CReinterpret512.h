@@ -0,0 +1,233 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Reinterpret the bits of one 512-bit storage as another one, without any
+// instruction on AVX-512 and per half of 256 bits otherwise.
+//
+// They are declared after all storages, as they combine storages of different
+// element types.
+
+#pragma mark - Float32x16
+
+/// Reinterprets the bits of `operand` as a `CInt32x16`, without converting them.
+/// @return `(CInt32x16){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x16)
+CFloat32x16ReinterpretAsCInt32x16(const CFloat32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castps_si512(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)operand;
+#else
+  CInt32x16 result;
+  result.lo = CFloat32x8ReinterpretAsCInt32x8(operand.lo);
+  result.hi = CFloat32x8ReinterpretAsCInt32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x16`, without converting them.
+/// @return `(CUInt32x16){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x16)
+CFloat32x16ReinterpretAsCUInt32x16(const CFloat32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castps_si512(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x16)operand;
+#else
+  CUInt32x16 result;
+  result.lo = CFloat32x8ReinterpretAsCUInt32x8(operand.lo);
+  result.hi = CFloat32x8ReinterpretAsCUInt32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x8`, without converting them.
+/// @return `(CFloat64x8){ bits(operand[0], operand[1]), bits(operand[2], operand[3]), ... }`
+FORCE_INLINE(CFloat64x8)
+CFloat32x16ReinterpretAsCFloat64x8(const CFloat32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castps_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x8)operand;
+#else
+  CFloat64x8 result;
+  result.lo = CFloat32x8ReinterpretAsCFloat64x4(operand.lo);
+  result.hi = CFloat32x8ReinterpretAsCFloat64x4(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Int32x16
+
+/// Reinterprets the bits of `operand` as a `CFloat32x16`, without converting them.
+/// @return `(CFloat32x16){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x16)
+CInt32x16ReinterpretAsCFloat32x16(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x16)operand;
+#else
+  CFloat32x16 result;
+  result.lo = CInt32x8ReinterpretAsCFloat32x8(operand.lo);
+  result.hi = CInt32x8ReinterpretAsCFloat32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x16`, without converting them.
+/// @return `(CUInt32x16){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CUInt32x16)
+CInt32x16ReinterpretAsCUInt32x16(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x16)operand;
+#else
+  CUInt32x16 result;
+  result.lo = CInt32x8ReinterpretAsCUInt32x8(operand.lo);
+  result.hi = CInt32x8ReinterpretAsCUInt32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x8`, without converting them.
+/// @return `(CFloat64x8){ bits(operand[0], operand[1]), bits(operand[2], operand[3]), ... }`
+FORCE_INLINE(CFloat64x8)
+CInt32x16ReinterpretAsCFloat64x8(const CInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x8)operand;
+#else
+  CFloat64x8 result;
+  result.lo = CInt32x8ReinterpretAsCFloat64x4(operand.lo);
+  result.hi = CInt32x8ReinterpretAsCFloat64x4(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - UInt32x16
+
+/// Reinterprets the bits of `operand` as a `CFloat32x16`, without converting them.
+/// @return `(CFloat32x16){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CFloat32x16)
+CUInt32x16ReinterpretAsCFloat32x16(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x16)operand;
+#else
+  CFloat32x16 result;
+  result.lo = CUInt32x8ReinterpretAsCFloat32x8(operand.lo);
+  result.hi = CUInt32x8ReinterpretAsCFloat32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x16`, without converting them.
+/// @return `(CInt32x16){ bits(operand[0]), bits(operand[1]), ... }`
+FORCE_INLINE(CInt32x16)
+CUInt32x16ReinterpretAsCInt32x16(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)operand;
+#else
+  CInt32x16 result;
+  result.lo = CUInt32x8ReinterpretAsCInt32x8(operand.lo);
+  result.hi = CUInt32x8ReinterpretAsCInt32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CFloat64x8`, without converting them.
+/// @return `(CFloat64x8){ bits(operand[0], operand[1]), bits(operand[2], operand[3]), ... }`
+FORCE_INLINE(CFloat64x8)
+CUInt32x16ReinterpretAsCFloat64x8(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_pd(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat64x8)operand;
+#else
+  CFloat64x8 result;
+  result.lo = CUInt32x8ReinterpretAsCFloat64x4(operand.lo);
+  result.hi = CUInt32x8ReinterpretAsCFloat64x4(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Float64x8
+
+/// Reinterprets the bits of `operand` as a `CFloat32x16`, without converting them.
+/// @return `(CFloat32x16){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CFloat32x16)
+CFloat64x8ReinterpretAsCFloat32x16(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castpd_ps(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x16)operand;
+#else
+  CFloat32x16 result;
+  result.lo = CFloat64x4ReinterpretAsCFloat32x8(operand.lo);
+  result.hi = CFloat64x4ReinterpretAsCFloat32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x16`, without converting them.
+/// @return `(CInt32x16){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CInt32x16)
+CFloat64x8ReinterpretAsCInt32x16(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castpd_si512(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x16)operand;
+#else
+  CInt32x16 result;
+  result.lo = CFloat64x4ReinterpretAsCInt32x8(operand.lo);
+  result.hi = CFloat64x4ReinterpretAsCInt32x8(operand.hi);
+  return result;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x16`, without converting them.
+/// @return `(CUInt32x16){ bits(operand[0]).low, bits(operand[0]).high, ... }`
+FORCE_INLINE(CUInt32x16)
+CFloat64x8ReinterpretAsCUInt32x16(const CFloat64x8 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castpd_si512(operand);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x16)operand;
+#else
+  CUInt32x16 result;
+  result.lo = CFloat64x4ReinterpretAsCUInt32x8(operand.lo);
+  result.hi = CFloat64x4ReinterpretAsCUInt32x8(operand.hi);
+  return result;
+#endif
+}
@@ -0,0 +1,137 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Reinterpret the bits of one 64-bit storage as another one, without any
+// instruction on Arm. On x86, the float storage is held in the lower half of
+// an SSE register and the integer ones in MMX registers, so that a single
+// move is needed between both.
+//
+// They are declared after all storages, as they combine storages of different
+// element types.
+
+#pragma mark - Float32x2
+
+/// Reinterprets the bits of `operand` as a `CInt32x2`, without converting them.
+/// @return `(CInt32x2){ bits(operand[0]), bits(operand[1]) }`
+FORCE_INLINE(CInt32x2)
+CFloat32x2ReinterpretAsCInt32x2(const CFloat32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_f32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_movepi64_pi64(_mm_castps_si128(operand));
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)operand;
+#else
+  union { CFloat32x2 value; CInt32x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x2`, without converting them.
+/// @return `(CUInt32x2){ bits(operand[0]), bits(operand[1]) }`
+FORCE_INLINE(CUInt32x2)
+CFloat32x2ReinterpretAsCUInt32x2(const CFloat32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_u32_f32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_movepi64_pi64(_mm_castps_si128(operand));
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x2)operand;
+#else
+  union { CFloat32x2 value; CUInt32x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - Int32x2
+
+/// Reinterprets the bits of `operand` as a `CFloat32x2`, without converting them.
+/// @return `(CFloat32x2){ bits(operand[0]), bits(operand[1]) }`
+FORCE_INLINE(CFloat32x2)
+CInt32x2ReinterpretAsCFloat32x2(const CInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_f32_s32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_ps(_mm_movpi64_epi64(operand));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x2)operand;
+#else
+  union { CInt32x2 value; CFloat32x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CUInt32x2`, without converting them.
+/// @return `(CUInt32x2){ bits(operand[0]), bits(operand[1]) }`
+FORCE_INLINE(CUInt32x2)
+CInt32x2ReinterpretAsCUInt32x2(const CInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_u32_s32(operand);
+#elif CSIMDX_X86_MMX
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x2)operand;
+#else
+  union { CInt32x2 value; CUInt32x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+#pragma mark - UInt32x2
+
+/// Reinterprets the bits of `operand` as a `CFloat32x2`, without converting them.
+/// @return `(CFloat32x2){ bits(operand[0]), bits(operand[1]) }`
+FORCE_INLINE(CFloat32x2)
+CUInt32x2ReinterpretAsCFloat32x2(const CUInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_f32_u32(operand);
+#elif CSIMDX_X86_SSE2
+  return _mm_castsi128_ps(_mm_movpi64_epi64(operand));
+#elif CSIMDX_EXT_VECTOR
+  return (CFloat32x2)operand;
+#else
+  union { CUInt32x2 value; CFloat32x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
+
+/// Reinterprets the bits of `operand` as a `CInt32x2`, without converting them.
+/// @return `(CInt32x2){ bits(operand[0]), bits(operand[1]) }`
+FORCE_INLINE(CInt32x2)
+CUInt32x2ReinterpretAsCInt32x2(const CUInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_s32_u32(operand);
+#elif CSIMDX_X86_MMX
+  return operand;
+#elif CSIMDX_EXT_VECTOR
+  return (CInt32x2)operand;
+#else
+  union { CUInt32x2 value; CInt32x2 bits; } Union;
+  Union.value = operand;
+  return Union.bits;
+#endif
+}
@@ -31,11 +31,33 @@
 // #define CSIMDX_X86_MMX
 // #define CSIMDX_X86_SSE2
 // #define CSIMDX_X86_SSE3
+// #define CSIMDX_X86_SSSE3
 // #define CSIMDX_X86_SSE4_1
 // #define CSIMDX_X86_AVX
+// #define CSIMDX_X86_AVX2
+// #define CSIMDX_X86_FMA
+// #define CSIMDX_X86_AVX512_CD
+// #define CSIMDX_X86_AVX512_VPOPCNTDQ
+
+// == References ================================================================================
+//  - https://clang.llvm.org/docs/LanguageExtensions.html#vectors-and-extended-vectors
+//  - https://gcc.gnu.org/onlinedocs/gcc/Vector-Extensions.html
+// ==============================================================================================
+// #define CSIMDX_EXT_VECTOR
+
+// == Overrides =================================================================================
+//  Define one of these to bypass the instruction set of the target, e.g. to benchmark a fallback
+//  path on a host that would never take it. Both are slower than the native path.
+// ==============================================================================================
+// #define CSIMDX_FORCE_SCALAR
+// #define CSIMDX_FORCE_EXT_VECTOR
 
 /// Find the relevant instruction set
-#ifdef __ARM_NEON
+#if defined(CSIMDX_FORCE_SCALAR)
+  /// No instruction set at all, every storage uses the plain C fallback
+#elif defined(CSIMDX_FORCE_EXT_VECTOR)
+  #define CSIMDX_EXT_VECTOR 1
+#elif defined(__ARM_NEON)
   #define CSIMDX_ARM_NEON 1
   #include <arm_neon.h>
   #ifdef __aarch64__
@@ -55,24 +77,66 @@
     #ifdef __SSE3__
       #define CSIMDX_X86_SSE3 1
       #include <tmmintrin.h>
+      #ifdef __SSSE3__
+        #define CSIMDX_X86_SSSE3 1
+      #endif // SSSE3
       #ifdef __SSE4_1__
         #define CSIMDX_X86_SSE4_1 1
         #include <smmintrin.h>
         #ifdef __AVX__
           #define CSIMDX_X86_AVX 1
           #include <immintrin.h>
+          #ifdef __AVX2__
+            #define CSIMDX_X86_AVX2 1
+          #endif // AVX2
+          #ifdef __FMA__
+            #define CSIMDX_X86_FMA 1
+          #endif // FMA
+          #ifdef __AVX512F__
+            #define CSIMDX_X86_AVX512_F 1
+          #endif // AVX512F
+          #if defined(__AVX512VL__) && defined(__AVX512CD__)
+            #define CSIMDX_X86_AVX512_CD 1
+          #endif // AVX512CD
+          #if defined(__AVX512VL__) && defined(__AVX512VPOPCNTDQ__)
+            #define CSIMDX_X86_AVX512_VPOPCNTDQ 1
+          #endif // AVX512VPOPCNTDQ
         #endif // AVX
       #endif // SSE4_1
     #endif // SSE 3
   #endif // SSE2
+#elif defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 12)
+  /// No hand-tuned instruction set, let the compiler lower generic vector types
+  /// to whatever the target provides, e.g. RISC-V V, POWER VSX or WASM SIMD128.
+  #define CSIMDX_EXT_VECTOR 1
 #endif // MMX
 
+#if CSIMDX_EXT_VECTOR
+  #if defined(__has_attribute) && __has_attribute(ext_vector_type)
+    /// Declares a vector of `count` elements of `type`, indexable and with
+    /// element-wise operators.
+    #define CSIMDX_EXT_VECTOR_TYPE(type, count) __attribute__((ext_vector_type(count)))
+  #else
+    /// GCC has no extended vectors, but its generic vectors provide the same
+    /// operators, as long as `count` is a power of two.
+    #define CSIMDX_EXT_VECTOR_TYPE(type, count) __attribute__((vector_size(sizeof(type) * count)))
+  #endif
+#endif
+
+#include <stdbool.h>
+
 /// Tries force inlining the function. Takes the return value as input.
 #define FORCE_INLINE(returnType) static __inline__ __attribute__((always_inline)) returnType
 
 #include "CFloat/CFloat.h"
 #include "CUInt/CUInt.h"
 #include "CInt/CInt.h"
+#include "CReinterpret/CReinterpret.h"
+#include "CMask/CMask.h"
+#include "CQuaternion/CQuaternion.h"
+#include "CRandom/CRandom.h"
+#include "CDispatch/CDispatch.h"
+#include "CBackend/CBackend.h"
 
 #undef CSIMDX_ARM_NEON
 #undef CSIMDX_ARM_NEON_AARCH64
@@ -80,5 +144,13 @@
 #undef CSIMDX_X86_MMX
 #undef CSIMDX_X86_SSE2
 #undef CSIMDX_X86_SSE3
+#undef CSIMDX_X86_SSSE3
 #undef CSIMDX_X86_SSE4_1
 #undef CSIMDX_X86_AVX
+#undef CSIMDX_X86_AVX2
+#undef CSIMDX_X86_FMA
+#undef CSIMDX_X86_AVX512_F
+#undef CSIMDX_X86_AVX512_CD
+#undef CSIMDX_X86_AVX512_VPOPCNTDQ
+#undef CSIMDX_EXT_VECTOR
+#undef CSIMDX_EXT_VECTOR_TYPE
@@ -17,3 +17,5 @@
 #include "CUInt32x2.h"
 #include "CUInt32x3.h"
 #include "CUInt32x4.h"
+#include "CUInt32x8.h"
+#include "CUInt32x16.h"
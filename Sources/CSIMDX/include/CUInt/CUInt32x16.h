@@ -0,0 +1,561 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit unsigned integer element
+#define UInt32 uint32_t
+
+/// The 16 x 32-bit unsigned integer storage, a single register where the target
+/// has 512-bit integer registers and two CUInt32x8 otherwise
+#if CSIMDX_X86_AVX512_F
+typedef __m512i CUInt32x16;
+#elif CSIMDX_EXT_VECTOR
+typedef UInt32 CUInt32x16 CSIMDX_EXT_VECTOR_TYPE(UInt32, 16);
+#else
+typedef struct CUInt32x16_t {
+  CUInt32x8 lo, hi;
+} CUInt32x16;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(UInt32)
+CUInt32x16GetElement(const CUInt32x16 storage, const int index)
+{
+#if CSIMDX_X86_AVX512_F
+  return ((UInt32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  union { CUInt32x16 storage; UInt32 rawValue[16]; } Union;
+  Union.storage = storage;
+  return Union.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CUInt32x16SetElement(CUInt32x16* storage, const int index, const UInt32 value)
+{
+#if CSIMDX_X86_AVX512_F
+  ((UInt32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  union { CUInt32x16* storage; UInt32* rawValue; } Union;
+  Union.storage = storage;
+  Union.rawValue[index] = value;
+#endif
+}
+
+#pragma mark Lanes
+
+/// Returns the lower half of `storage`.
+/// @return `(CUInt32x8){ storage[0], ..., storage[7] }`
+FORCE_INLINE(CUInt32x8) CUInt32x16GetLow(const CUInt32x16 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_castsi512_si256(storage);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 0, 1, 2, 3, 4, 5, 6, 7);
+#else
+  return storage.lo;
+#endif
+}
+
+/// Returns the upper half of `storage`.
+/// @return `(CUInt32x8){ storage[8], ..., storage[15] }`
+FORCE_INLINE(CUInt32x8) CUInt32x16GetHigh(const CUInt32x16 storage)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_extracti64x4_epi64(storage, 1);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 8, 9, 10, 11, 12, 13, 14, 15);
+#else
+  return storage.hi;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Loads 16 x UInt32 values from unaligned memory.
+/// @return `(CUInt32x16){ pointer[0], pointer[1], ..., pointer[15] }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16MakeLoad(const UInt32* pointer)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_loadu_si512(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x16 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8MakeLoad(pointer);
+  result.hi = CUInt32x8MakeLoad(&pointer[8]);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CUInt32x16){ value, value, ..., value }`
+FORCE_INLINE(CUInt32x16) CUInt32x16MakeRepeatingElement(const UInt32 value)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_set1_epi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x16){ value, value, value, value, value, value, value, value, value, value, value, value, value, value, value, value };
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8MakeRepeatingElement(value);
+  result.hi = CUInt32x8MakeRepeatingElement(value);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0).
+/// @return `(CUInt32x16){ 0, 0, ..., 0 }`
+FORCE_INLINE(CUInt32x16) CUInt32x16MakeZero(void)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_setzero_si512();
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x16){ 0 };
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8MakeZero();
+  result.hi = CUInt32x8MakeZero();
+  return result;
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return `(CUInt32x16){ lhs[0] < rhs[0] ? lhs[0] : rhs[0], ..., lhs[15] < rhs[15] ? lhs[15] : rhs[15] }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16Minimum(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_min_epu32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CUInt32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8Minimum(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8Minimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return `(CUInt32x16){ lhs[0] > rhs[0] ? lhs[0] : rhs[0], ..., lhs[15] > rhs[15] ? lhs[15] : rhs[15] }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16Maximum(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_max_epu32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CUInt32x16)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8Maximum(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8Maximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
+/// @return `(CUInt32x16){ lhs[0] == rhs[0], lhs[1] == rhs[1], ..., lhs[15] == rhs[15] }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16CompareElementWise(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_maskz_set1_epi32(_mm512_cmpeq_epi32_mask(lhs, rhs), -1);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x16)(lhs == rhs);
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8CompareElementWise(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8CompareElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && ... && lhs[15] == rhs[15]`
+FORCE_INLINE(bool)
+CUInt32x16Equal(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_cmpeq_epi32_mask(lhs, rhs) == 0xFFFF;
+#elif CSIMDX_EXT_VECTOR
+  return CUInt32x8Equal(CUInt32x16GetLow(lhs), CUInt32x16GetLow(rhs)) && CUInt32x8Equal(CUInt32x16GetHigh(lhs), CUInt32x16GetHigh(rhs));
+#else
+  return CUInt32x8Equal(lhs.lo, rhs.lo) && CUInt32x8Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CUInt32x16){ lhs[0] + rhs[0], lhs[1] + rhs[1], ..., lhs[15] + rhs[15] }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16Add(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_add_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8Add(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8Add(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CUInt32x16){ lhs[0] - rhs[0], lhs[1] - rhs[1], ..., lhs[15] - rhs[15] }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16Subtract(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sub_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8Subtract(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8Subtract(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise), wrapping around on overflow.
+/// @return `(CUInt32x16){ lhs[0] * rhs[0], lhs[1] * rhs[1], ..., lhs[15] * rhs[15] }`
+FORCE_INLINE(CUInt32x16)
+CUInt32x16Multiply(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_mullo_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8Multiply(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8Multiply(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Bitwise
+
+/// Bitwise Not
+FORCE_INLINE(CUInt32x16) CUInt32x16BitwiseNot(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_xor_si512(operand, _mm512_set1_epi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8BitwiseNot(operand.lo);
+  result.hi = CUInt32x8BitwiseNot(operand.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And
+FORCE_INLINE(CUInt32x16)
+CUInt32x16BitwiseAnd(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_and_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8BitwiseAnd(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8BitwiseAnd(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And Not
+FORCE_INLINE(CUInt32x16)
+CUInt32x16BitwiseAndNot(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_andnot_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8BitwiseAndNot(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8BitwiseAndNot(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Or
+FORCE_INLINE(CUInt32x16)
+CUInt32x16BitwiseOr(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_or_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8BitwiseOr(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8BitwiseOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Exclusive Or
+FORCE_INLINE(CUInt32x16)
+CUInt32x16BitwiseExclusiveOr(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_xor_si512(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8BitwiseExclusiveOr(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8BitwiseExclusiveOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Shifting
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero.
+FORCE_INLINE(CUInt32x16)
+CUInt32x16ShiftLeftElementWise(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_sllv_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x16 count = (CUInt32x16)rhs;
+  return (CUInt32x16)(((CUInt32x16)lhs << (count & 31)) & (CUInt32x16)(count < 32));
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8ShiftLeftElementWise(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8ShiftLeftElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits of rhs.
+FORCE_INLINE(CUInt32x16)
+CUInt32x16ShiftLeft(const CUInt32x16 lhs, const UInt32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_slli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? lhs << rhs : (CUInt32x16){ 0 };
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8ShiftLeft(lhs.lo, rhs);
+  result.hi = CUInt32x8ShiftLeft(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with zero.
+FORCE_INLINE(CUInt32x16)
+CUInt32x16ShiftRightElementWise(const CUInt32x16 lhs, const CUInt32x16 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_srlv_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  return (lhs >> (rhs & 31)) & (CUInt32x16)(rhs < 32);
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8ShiftRightElementWise(lhs.lo, rhs.lo);
+  result.hi = CUInt32x8ShiftRightElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
+FORCE_INLINE(CUInt32x16)
+CUInt32x16ShiftRight(const CUInt32x16 lhs, const UInt32 rhs)
+{
+#if CSIMDX_X86_AVX512_F
+  return _mm512_srli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? lhs >> rhs : (CUInt32x16){ 0 };
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8ShiftRight(lhs.lo, rhs);
+  result.hi = CUInt32x8ShiftRight(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CUInt32x16){ popcount(operand[0]), popcount(operand[1]), ..., popcount(operand[15]) }`
+FORCE_INLINE(CUInt32x16) CUInt32x16PopulationCount(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_VPOPCNTDQ
+  return _mm512_popcnt_epi32(operand);
+#elif CSIMDX_X86_AVX512_F
+  // Sum up the bits of each pair, nibble and byte, then the bytes of each element
+  __m512i count = _mm512_sub_epi32(operand, _mm512_and_si512(_mm512_srli_epi32(operand, 1), _mm512_set1_epi32(0x55555555)));
+  count = _mm512_add_epi32(_mm512_and_si512(count, _mm512_set1_epi32(0x33333333)),
+                           _mm512_and_si512(_mm512_srli_epi32(count, 2), _mm512_set1_epi32(0x33333333)));
+  count = _mm512_and_si512(_mm512_add_epi32(count, _mm512_srli_epi32(count, 4)), _mm512_set1_epi32(0x0F0F0F0F));
+  return _mm512_srli_epi32(_mm512_mullo_epi32(count, _mm512_set1_epi32(0x01010101)), 24);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x16 bits = operand;
+  bits = bits - ((bits >> 1) & 0x55555555);
+  bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+  bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+  return (bits * 0x01010101) >> 24;
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8PopulationCount(operand.lo);
+  result.hi = CUInt32x8PopulationCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CUInt32x16){ clz(operand[0]), clz(operand[1]), ..., clz(operand[15]) }`
+FORCE_INLINE(CUInt32x16) CUInt32x16LeadingZeroBitCount(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_CD
+  return _mm512_lzcnt_epi32(operand);
+#elif CSIMDX_X86_AVX512_F
+  // Smear the most significant set bit to the right, then count the set bits
+  __m512i smeared = _mm512_or_si512(operand, _mm512_srli_epi32(operand, 1));
+  smeared = _mm512_or_si512(smeared, _mm512_srli_epi32(smeared, 2));
+  smeared = _mm512_or_si512(smeared, _mm512_srli_epi32(smeared, 4));
+  smeared = _mm512_or_si512(smeared, _mm512_srli_epi32(smeared, 8));
+  smeared = _mm512_or_si512(smeared, _mm512_srli_epi32(smeared, 16));
+  return _mm512_sub_epi32(_mm512_set1_epi32(32), CUInt32x16PopulationCount(smeared));
+#elif CSIMDX_EXT_VECTOR
+  // Smear the highest set bit to the right and count the remaining zeros
+  CUInt32x16 bits = operand;
+  bits |= bits >> 1;
+  bits |= bits >> 2;
+  bits |= bits >> 4;
+  bits |= bits >> 8;
+  bits |= bits >> 16;
+  return CUInt32x16PopulationCount(~bits);
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8LeadingZeroBitCount(operand.lo);
+  result.hi = CUInt32x8LeadingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CUInt32x16){ ctz(operand[0]), ctz(operand[1]), ..., ctz(operand[15]) }`
+FORCE_INLINE(CUInt32x16) CUInt32x16TrailingZeroBitCount(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  return CUInt32x16PopulationCount(_mm512_andnot_si512(operand, _mm512_sub_epi32(operand, _mm512_set1_epi32(1))));
+#elif CSIMDX_EXT_VECTOR
+  // The trailing zeros are the bits set in ~x & (x - 1)
+  return CUInt32x16PopulationCount(~operand & (operand - 1));
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8TrailingZeroBitCount(operand.lo);
+  result.hi = CUInt32x8TrailingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CUInt32x16){ bswap(operand[0]), bswap(operand[1]), ..., bswap(operand[15]) }`
+FORCE_INLINE(CUInt32x16) CUInt32x16ByteSwap(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  // AVX-512F has no byte shuffle, but rotating by 8 and 24 bits puts each
+  // byte in place for every other one
+  return _mm512_or_si512(_mm512_and_si512(_mm512_rol_epi32(operand, 8), _mm512_set1_epi32(0x00FF00FF)),
+                         _mm512_and_si512(_mm512_rol_epi32(operand, 24), _mm512_set1_epi32(0xFF00FF00)));
+#elif CSIMDX_EXT_VECTOR
+  return (operand << 24) | ((operand & 0xFF00) << 8) | ((operand >> 8) & 0xFF00) | (operand >> 24);
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8ByteSwap(operand.lo);
+  result.hi = CUInt32x8ByteSwap(operand.hi);
+  return result;
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CUInt32x16){ bitreverse(operand[0]), bitreverse(operand[1]), ..., bitreverse(operand[15]) }`
+FORCE_INLINE(CUInt32x16) CUInt32x16BitReverse(const CUInt32x16 operand)
+{
+#if CSIMDX_X86_AVX512_F
+  // Swap adjacent bits, pairs of bits and nibbles, then the bytes
+  __m512i result = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(operand, 1), _mm512_set1_epi32(0x55555555)),
+                                   _mm512_slli_epi32(_mm512_and_si512(operand, _mm512_set1_epi32(0x55555555)), 1));
+  result = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(result, 2), _mm512_set1_epi32(0x33333333)),
+                           _mm512_slli_epi32(_mm512_and_si512(result, _mm512_set1_epi32(0x33333333)), 2));
+  result = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(result, 4), _mm512_set1_epi32(0x0F0F0F0F)),
+                           _mm512_slli_epi32(_mm512_and_si512(result, _mm512_set1_epi32(0x0F0F0F0F)), 4));
+  return CUInt32x16ByteSwap(result);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x16 bits = operand;
+  bits = ((bits >> 1) & 0x55555555) | ((bits & 0x55555555) << 1);
+  bits = ((bits >> 2) & 0x33333333) | ((bits & 0x33333333) << 2);
+  bits = ((bits >> 4) & 0x0F0F0F0F) | ((bits & 0x0F0F0F0F) << 4);
+  return CUInt32x16ByteSwap(bits);
+#else
+  CUInt32x16 result;
+  result.lo = CUInt32x8BitReverse(operand.lo);
+  result.hi = CUInt32x8BitReverse(operand.hi);
+  return result;
+#endif
+}
+
+#undef UInt32
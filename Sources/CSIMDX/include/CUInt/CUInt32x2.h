@@ -24,6 +24,8 @@
 typedef uint32x2_t CUInt32x2;
 #elif CSIMDX_X86_MMX
 typedef __m64 CUInt32x2;
+#elif CSIMDX_EXT_VECTOR
+typedef UInt32 CUInt32x2 CSIMDX_EXT_VECTOR_TYPE(UInt32, 2);
 #else
 typedef struct CUInt32x2_t {
   UInt32 rawValue[2];
@@ -39,6 +41,8 @@ CUInt32x2GetElement(const CUInt32x2 storage, const int index)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   return ((UInt32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   return storage.rawValue[index];
 #endif
@@ -51,6 +55,8 @@ CUInt32x2SetElement(CUInt32x2* storage, const int index, const UInt32 value)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   ((UInt32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   (storage->rawValue)[index] = value;
 #endif
@@ -77,6 +83,10 @@ CUInt32x2MakeLoad(const UInt32* pointer)
 {
 #if CSIMDX_ARM_NEON
   return vld1_u32(pointer);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
 #else
   return CUInt32x2Make(pointer[0], pointer[1]);
 #endif
@@ -91,6 +101,8 @@ CUInt32x2MakeRepeatingElement(const UInt32 value)
   return vdup_n_u32(value);
 #elif CSIMDX_X86_MMX
   return _mm_set1_pi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x2){ value, value };
 #else
   return CUInt32x2Make(value, value);
 #endif
@@ -104,6 +116,8 @@ FORCE_INLINE(CUInt32x2) CUInt32x2MakeZero(void)
   return vdup_n_u32(0);
 #elif CSIMDX_X86_MMX
   return _mm_setzero_si64();
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x2){ 0 };
 #else
   return CUInt32x2MakeRepeatingElement(0);
 #endif
@@ -126,8 +140,11 @@ CUInt32x2Minimum(const CUInt32x2 lhs, const CUInt32x2 rhs)
 #elif CSIMDX_X86_SSE4_1
   // MMX has no `min` function for __m64, but SSE4 does for __m128i.
   // So promote both to __m128i, run `min`, and move back to __m64.
-  return _mm_movepi64_pi64(_mm_min_epi32(_mm_movpi64_epi64(lhs),
+  return _mm_movepi64_pi64(_mm_min_epu32(_mm_movpi64_epi64(lhs),
                                          _mm_movpi64_epi64(rhs)));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CUInt32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   UInt32 lhs0 = CUInt32x2GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x2GetElement(rhs, 0);
@@ -153,8 +170,11 @@ CUInt32x2Maximum(const CUInt32x2 lhs, const CUInt32x2 rhs)
 #elif CSIMDX_X86_SSE4_1
   // MMX has no `max` function for __m64, but SSE4 does for __m128i.
   // So promote both to __m128i, run `max`, and move back to __m64.
-  return _mm_movepi64_pi64(_mm_max_epi32(_mm_movpi64_epi64(lhs),
+  return _mm_movepi64_pi64(_mm_max_epu32(_mm_movpi64_epi64(lhs),
                                          _mm_movpi64_epi64(rhs)));
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CUInt32x2)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   UInt32 lhs0 = CUInt32x2GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x2GetElement(rhs, 0);
@@ -167,7 +187,8 @@ CUInt32x2Maximum(const CUInt32x2 lhs, const CUInt32x2 rhs)
 
 #pragma mark - Arithmetics
 
-/// Returns the negated storage (element-wise).
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
 /// @return `(CUInt32x2){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
 FORCE_INLINE(CUInt32x2)
 CUInt32x2CompareElementWise(const CUInt32x2 lhs, const CUInt32x2 rhs)
@@ -176,12 +197,37 @@ CUInt32x2CompareElementWise(const CUInt32x2 lhs, const CUInt32x2 rhs)
   return vceq_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_cmpeq_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x2)(lhs == rhs);
 #else
   UInt32 lhs0 = CUInt32x2GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x2GetElement(rhs, 0);
   UInt32 lhs1 = CUInt32x2GetElement(lhs, 1);
   UInt32 rhs1 = CUInt32x2GetElement(rhs, 1);
-  return CUInt32x2Make(lhs0 == rhs0, lhs1 == rhs1);
+  return CUInt32x2Make(-(UInt32)(lhs0 == rhs0),
+                       -(UInt32)(lhs1 == rhs1));
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1]`
+FORCE_INLINE(bool)
+CUInt32x2Equal(const CUInt32x2 lhs, const CUInt32x2 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminv_u32(vceq_u32(lhs, rhs)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x2_t mask = vceq_u32(lhs, rhs);
+  return vget_lane_u32(vpmin_u32(mask, mask), 0) != 0;
+#elif CSIMDX_X86_MMX
+  return _mm_cvtm64_si64(_mm_cmpeq_pi32(lhs, rhs)) == -1;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1]) != 0;
+#else
+  return CUInt32x2GetElement(lhs, 0) == CUInt32x2GetElement(rhs, 0)
+      && CUInt32x2GetElement(lhs, 1) == CUInt32x2GetElement(rhs, 1);
 #endif
 }
 
@@ -196,6 +242,8 @@ CUInt32x2Add(const CUInt32x2 lhs, const CUInt32x2 rhs)
   return vadd_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_add_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   UInt32 lhs0 = CUInt32x2GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x2GetElement(rhs, 0);
@@ -214,6 +262,8 @@ CUInt32x2Subtract(const CUInt32x2 lhs, const CUInt32x2 rhs)
   return vsub_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_sub_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   UInt32 lhs0 = CUInt32x2GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x2GetElement(rhs, 0);
@@ -232,6 +282,8 @@ CUInt32x2Multiply(const CUInt32x2 lhs, const CUInt32x2 rhs)
 {
 #if CSIMDX_ARM_NEON
   return vmul_u32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   UInt32 lhs0 = CUInt32x2GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x2GetElement(rhs, 0);
@@ -250,6 +302,8 @@ FORCE_INLINE(CUInt32x2) CUInt32x2BitwiseNot(const CUInt32x2 operand)
   return vmvn_u32(operand);
 #elif CSIMDX_X86_MMX
   return _mm_xor_si64(operand, CUInt32x2MakeRepeatingElement(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
 #else
   return CUInt32x2Make(~CUInt32x2GetElement(operand, 0),
                       ~CUInt32x2GetElement(operand, 1));
@@ -264,6 +318,8 @@ CUInt32x2BitwiseAnd(const CUInt32x2 lhs, const CUInt32x2 rhs)
   return vand_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_and_si64(rhs, lhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
 #else
   return CUInt32x2Make(CUInt32x2GetElement(lhs, 0) & CUInt32x2GetElement(rhs, 0),
                       CUInt32x2GetElement(lhs, 1) & CUInt32x2GetElement(rhs, 1));
@@ -276,6 +332,8 @@ CUInt32x2BitwiseAndNot(const CUInt32x2 lhs, const CUInt32x2 rhs)
 {
 #if CSIMDX_X86_MMX
   return _mm_andnot_si64(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
 #else
   return CUInt32x2BitwiseAnd(CUInt32x2BitwiseNot(lhs), rhs);
 #endif
@@ -289,6 +347,8 @@ CUInt32x2BitwiseOr(const CUInt32x2 lhs, const CUInt32x2 rhs)
   return vorr_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_or_si64(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
 #else
   return CUInt32x2Make(CUInt32x2GetElement(lhs, 0) | CUInt32x2GetElement(rhs, 0),
                       CUInt32x2GetElement(lhs, 1) | CUInt32x2GetElement(rhs, 1));
@@ -303,6 +363,8 @@ CUInt32x2BitwiseExclusiveOr(const CUInt32x2 lhs, const CUInt32x2 rhs)
   return veor_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_xor_si64(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
 #else
   return CUInt32x2Make(CUInt32x2GetElement(lhs, 0) ^ CUInt32x2GetElement(rhs, 0),
                       CUInt32x2GetElement(lhs, 1) ^ CUInt32x2GetElement(rhs, 1));
@@ -312,15 +374,31 @@ CUInt32x2BitwiseExclusiveOr(const CUInt32x2 lhs, const CUInt32x2 rhs)
 #pragma mark Shifting
 
 /// Left-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero.
 FORCE_INLINE(CUInt32x2)
 CUInt32x2ShiftLeftElementWise(const CUInt32x2 lhs, const CUInt32x2 rhs)
 {
 #if CSIMDX_ARM_NEON
-  return vshl_u32(lhs, rhs);
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshl_u32(lhs, vreinterpret_s32_u32(vmin_u32(rhs, vdup_n_u32(32))));
+#elif CSIMDX_X86_MMX
+  // Shifts the whole storage by the count of each lane, then picks each lane
+  // from its own shift. Counts are read from all 64 bits of the count operand.
+  const __m64 zero = _mm_setzero_si64();
+  __m64 shifted0 = _mm_sll_pi32(lhs, _mm_unpacklo_pi32(rhs, zero));
+  __m64 shifted1 = _mm_sll_pi32(lhs, _mm_unpackhi_pi32(rhs, zero));
+  return _mm_unpacklo_pi32(shifted0, _mm_srli_si64(shifted1, 32));
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x2 count = (CUInt32x2)rhs;
+  return (CUInt32x2)(((CUInt32x2)lhs << (count & 31)) & (CUInt32x2)(count < 32));
 #else
-  return CUInt32x2Make(CUInt32x2GetElement(lhs, 0) << CUInt32x2GetElement(rhs, 0),
-                      CUInt32x2GetElement(lhs, 1) << CUInt32x2GetElement(rhs, 1));
+  // Shifting by the element width or more is undefined, clear those lanes
+  UInt32 count0 = CUInt32x2GetElement(rhs, 0);
+  UInt32 count1 = CUInt32x2GetElement(rhs, 1);
+  return CUInt32x2Make(count0 < 32 ? CUInt32x2GetElement(lhs, 0) << count0 : 0,
+                       count1 < 32 ? CUInt32x2GetElement(lhs, 1) << count1 : 0);
 #endif
 }
 
@@ -331,30 +409,152 @@ CUInt32x2ShiftLeft(const CUInt32x2 lhs, const UInt32 rhs)
 {
 #if CSIMDX_X86_MMX
   return _mm_slli_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? (CUInt32x2)((CUInt32x2)lhs << rhs) : (CUInt32x2){ 0 };
 #else
   return CUInt32x2ShiftLeftElementWise(lhs, CUInt32x2MakeRepeatingElement(rhs));
 #endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with zero.
 FORCE_INLINE(CUInt32x2)
 CUInt32x2ShiftRightElementWise(const CUInt32x2 lhs, const CUInt32x2 rhs)
 {
-  return CUInt32x2Make(CUInt32x2GetElement(lhs, 0) >> CUInt32x2GetElement(rhs, 0),
-                       CUInt32x2GetElement(lhs, 1) >> CUInt32x2GetElement(rhs, 1));
+#if CSIMDX_ARM_NEON
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshl_u32(lhs, vneg_s32(vreinterpret_s32_u32(vmin_u32(rhs, vdup_n_u32(32)))));
+#elif CSIMDX_X86_MMX
+  // Shifts the whole storage by the count of each lane, then picks each lane
+  // from its own shift. Counts are read from all 64 bits of the count operand.
+  const __m64 zero = _mm_setzero_si64();
+  __m64 shifted0 = _mm_srl_pi32(lhs, _mm_unpacklo_pi32(rhs, zero));
+  __m64 shifted1 = _mm_srl_pi32(lhs, _mm_unpackhi_pi32(rhs, zero));
+  return _mm_unpacklo_pi32(shifted0, _mm_srli_si64(shifted1, 32));
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  return (lhs >> (rhs & 31)) & (CUInt32x2)(rhs < 32);
+#else
+  // Shifting by the element width or more is undefined, clear those lanes
+  UInt32 count0 = CUInt32x2GetElement(rhs, 0);
+  UInt32 count1 = CUInt32x2GetElement(rhs, 1);
+  return CUInt32x2Make(count0 < 32 ? CUInt32x2GetElement(lhs, 0) >> count0 : 0,
+                       count1 < 32 ? CUInt32x2GetElement(lhs, 1) >> count1 : 0);
+#endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits of rhs.
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
 FORCE_INLINE(CUInt32x2)
 CUInt32x2ShiftRight(const CUInt32x2 lhs, const UInt32 rhs)
 {
 #if CSIMDX_X86_MMX
   return _mm_srli_pi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? lhs >> rhs : (CUInt32x2){ 0 };
 #else
   return CUInt32x2ShiftRightElementWise(lhs, CUInt32x2MakeRepeatingElement(rhs));
 #endif
 }
 
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CUInt32x2){ popcount(operand[0]), popcount(operand[1]) }`
+FORCE_INLINE(CUInt32x2) CUInt32x2PopulationCount(const CUInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  uint8x8_t count = vcnt_u8(vreinterpret_u8_u32(operand));
+  return vpaddl_u16(vpaddl_u8(count));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 bits = (CUInt32x2)operand;
+  bits = bits - ((bits >> 1) & 0x55555555);
+  bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+  bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+  return (CUInt32x2)((bits * 0x01010101) >> 24);
+#else
+  return CUInt32x2Make(__builtin_popcount(CUInt32x2GetElement(operand, 0)),
+                       __builtin_popcount(CUInt32x2GetElement(operand, 1)));
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CUInt32x2){ clz(operand[0]), clz(operand[1]) }`
+FORCE_INLINE(CUInt32x2) CUInt32x2LeadingZeroBitCount(const CUInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vclz_u32(operand);
+#elif CSIMDX_EXT_VECTOR
+  // Smear the highest set bit to the right and count the remaining zeros
+  CUInt32x2 bits = (CUInt32x2)operand;
+  bits |= bits >> 1;
+  bits |= bits >> 2;
+  bits |= bits >> 4;
+  bits |= bits >> 8;
+  bits |= bits >> 16;
+  return CUInt32x2PopulationCount(CUInt32x2BitwiseNot((CUInt32x2)bits));
+#else
+  uint32_t element0 = CUInt32x2GetElement(operand, 0);
+  uint32_t element1 = CUInt32x2GetElement(operand, 1);
+  return CUInt32x2Make(element0 ? __builtin_clz(element0) : 32,
+                       element1 ? __builtin_clz(element1) : 32);
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CUInt32x2){ ctz(operand[0]), ctz(operand[1]) }`
+FORCE_INLINE(CUInt32x2) CUInt32x2TrailingZeroBitCount(const CUInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vclz_u32(vreinterpret_u32_u8(vrbit_u8(vrev32_u8(vreinterpret_u8_u32(operand)))));
+#elif CSIMDX_ARM_NEON
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  return CUInt32x2PopulationCount(vbic_u32(vsub_u32(operand, vdup_n_u32(1)), operand));
+#elif CSIMDX_EXT_VECTOR
+  // The trailing zeros are the bits set in ~x & (x - 1)
+  return CUInt32x2PopulationCount(CUInt32x2BitwiseNot(operand) & (operand - 1));
+#else
+  uint32_t element0 = CUInt32x2GetElement(operand, 0);
+  uint32_t element1 = CUInt32x2GetElement(operand, 1);
+  return CUInt32x2Make(element0 ? __builtin_ctz(element0) : 32,
+                       element1 ? __builtin_ctz(element1) : 32);
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CUInt32x2){ bswap(operand[0]), bswap(operand[1]) }`
+FORCE_INLINE(CUInt32x2) CUInt32x2ByteSwap(const CUInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpret_u32_u8(vrev32_u8(vreinterpret_u8_u32(operand)));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 bits = (CUInt32x2)operand;
+  return (CUInt32x2)((bits << 24) | ((bits & 0xFF00) << 8) | ((bits >> 8) & 0xFF00) | (bits >> 24));
+#else
+  return CUInt32x2Make(__builtin_bswap32(CUInt32x2GetElement(operand, 0)),
+                       __builtin_bswap32(CUInt32x2GetElement(operand, 1)));
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CUInt32x2){ bitreverse(operand[0]), bitreverse(operand[1]) }`
+FORCE_INLINE(CUInt32x2) CUInt32x2BitReverse(const CUInt32x2 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpret_u32_u8(vrbit_u8(vrev32_u8(vreinterpret_u8_u32(operand))));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x2 bits = (CUInt32x2)operand;
+  bits = ((bits >> 1) & 0x55555555) | ((bits & 0x55555555) << 1);
+  bits = ((bits >> 2) & 0x33333333) | ((bits & 0x33333333) << 2);
+  bits = ((bits >> 4) & 0x0F0F0F0F) | ((bits & 0x0F0F0F0F) << 4);
+  return CUInt32x2ByteSwap((CUInt32x2)bits);
+#else
+  return CUInt32x2Make(__builtin_bitreverse32(CUInt32x2GetElement(operand, 0)),
+                       __builtin_bitreverse32(CUInt32x2GetElement(operand, 1)));
+#endif
+}
+
 #undef UInt32
@@ -24,6 +24,8 @@
 typedef uint32x4_t CUInt32x4;
 #elif CSIMDX_X86_SSE2
 typedef __m128i CUInt32x4;
+#elif CSIMDX_EXT_VECTOR
+typedef UInt32 CUInt32x4 CSIMDX_EXT_VECTOR_TYPE(UInt32, 4);
 #else
 typedef struct CUInt32x4_t {
   UInt32 rawValue[4];
@@ -39,6 +41,8 @@ CUInt32x4GetElement(const CUInt32x4 storage, const int index)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   return ((UInt32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
 #else
   return storage.rawValue[index];
 #endif
@@ -51,6 +55,8 @@ CUInt32x4SetElement(CUInt32x4* storage, const int index, const UInt32 value)
 {
 #if CSIMDX_ARM_NEON || CSIMDX_X86_MMX
   ((UInt32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
 #else
   (storage->rawValue)[index] = value;
 #endif
@@ -80,6 +86,10 @@ CUInt32x4MakeLoad(const UInt32* pointer)
   return vld1q_u32(pointer);
 #elif CSIMDX_X86_SSE2
   return _mm_loadu_si128((__m128i*)pointer);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x4 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
 #else
   return CUInt32x4Make(pointer[0], pointer[1], pointer[2], pointer[3]);
 #endif
@@ -94,6 +104,8 @@ CUInt32x4MakeRepeatingElement(const UInt32 value)
   return vdupq_n_u32(value);
 #elif CSIMDX_X86_SSE2
   return _mm_set1_epi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x4){ value, value, value, value };
 #else
   return CUInt32x4Make(value, value, value, value);
 #endif
@@ -107,6 +119,8 @@ FORCE_INLINE(CUInt32x4) CUInt32x4MakeZero(void)
   return vdupq_n_u32(0);
 #elif CSIMDX_X86_SSE2
   return _mm_setzero_si128();
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x4){ 0 };
 #else
   return CUInt32x4MakeRepeatingElement(0);
 #endif
@@ -128,6 +142,9 @@ CUInt32x4Minimum(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return vminq_u32(lhs, rhs);
 #elif CSIMDX_X86_SSE4_1 // SSE2 has no `min` function, but SSE4 does.
   return _mm_min_epu32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CUInt32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   UInt32 lhs0 = CUInt32x4GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x4GetElement(rhs, 0);
@@ -158,6 +175,9 @@ CUInt32x4Maximum(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return vmaxq_u32(lhs, rhs);
 #elif CSIMDX_X86_SSE4_1 // SSE2 has no `min` function, but SSE4 does.
   return _mm_max_epu32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CUInt32x4)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
 #else
   UInt32 lhs0 = CUInt32x4GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x4GetElement(rhs, 0);
@@ -176,7 +196,8 @@ CUInt32x4Maximum(const CUInt32x4 lhs, const CUInt32x4 rhs)
 
 #pragma mark - Arithmetics
 
-/// Returns the negated storage (element-wise).
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
 /// @return `(CUInt32x4){ lhs[0] == rhs[0], lhs[1] == rhs[1] }`
 FORCE_INLINE(CUInt32x4)
 CUInt32x4CompareElementWise(const CUInt32x4 lhs, const CUInt32x4 rhs)
@@ -185,6 +206,8 @@ CUInt32x4CompareElementWise(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return vceqq_u32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_cmpeq_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x4)(lhs == rhs);
 #else
   UInt32 lhs0 = CUInt32x4GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x4GetElement(rhs, 0);
@@ -194,7 +217,35 @@ CUInt32x4CompareElementWise(const CUInt32x4 lhs, const CUInt32x4 rhs)
   UInt32 rhs2 = CUInt32x4GetElement(rhs, 2);
   UInt32 lhs3 = CUInt32x4GetElement(lhs, 3);
   UInt32 rhs3 = CUInt32x4GetElement(rhs, 3);
-  return CUInt32x4Make(lhs0 == rhs0, lhs1 == rhs1, lhs2 == rhs2, lhs3 == rhs3);
+  return CUInt32x4Make(-(UInt32)(lhs0 == rhs0),
+                       -(UInt32)(lhs1 == rhs1),
+                       -(UInt32)(lhs2 == rhs2),
+                       -(UInt32)(lhs3 == rhs3));
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3]`
+FORCE_INLINE(bool)
+CUInt32x4Equal(const CUInt32x4 lhs, const CUInt32x4 rhs)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vminvq_u32(vceqq_u32(lhs, rhs)) != 0;
+#elif CSIMDX_ARM_NEON
+  uint32x4_t mask = vceqq_u32(lhs, rhs);
+  uint32x2_t half = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+  return vget_lane_u32(vpmin_u32(half, half), 0) != 0;
+#elif CSIMDX_X86_SSE2
+  return _mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)) == 0xFFFF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2] & mask[3]) != 0;
+#else
+  return CUInt32x4GetElement(lhs, 0) == CUInt32x4GetElement(rhs, 0)
+      && CUInt32x4GetElement(lhs, 1) == CUInt32x4GetElement(rhs, 1)
+      && CUInt32x4GetElement(lhs, 2) == CUInt32x4GetElement(rhs, 2)
+      && CUInt32x4GetElement(lhs, 3) == CUInt32x4GetElement(rhs, 3);
 #endif
 }
 
@@ -209,6 +260,8 @@ CUInt32x4Add(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return vaddq_u32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_add_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
 #else
   UInt32 lhs0 = CUInt32x4GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x4GetElement(rhs, 0);
@@ -231,6 +284,8 @@ CUInt32x4Subtract(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return vsubq_u32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_sub_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
 #else
   UInt32 lhs0 = CUInt32x4GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x4GetElement(rhs, 0);
@@ -253,6 +308,8 @@ CUInt32x4Multiply(const CUInt32x4 lhs, const CUInt32x4 rhs)
 {
 #if CSIMDX_ARM_NEON
   return vmulq_u32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
 #else
   UInt32 lhs0 = CUInt32x4GetElement(lhs, 0);
   UInt32 rhs0 = CUInt32x4GetElement(rhs, 0);
@@ -275,6 +332,8 @@ FORCE_INLINE(CUInt32x4) CUInt32x4BitwiseNot(const CUInt32x4 operand)
   return vmvnq_u32(operand);
 #elif CSIMDX_X86_SSE2
   return _mm_xor_si128(operand, CUInt32x4MakeRepeatingElement(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
 #else
   return CUInt32x4Make(~CUInt32x4GetElement(operand, 0),
                        ~CUInt32x4GetElement(operand, 1),
@@ -291,6 +350,8 @@ CUInt32x4BitwiseAnd(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return vandq_u32(lhs, rhs);
 #elif CSIMDX_X86_SSE2
   return _mm_and_si128(rhs, lhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
 #else
   return CUInt32x4Make(CUInt32x4GetElement(lhs, 0) & CUInt32x4GetElement(rhs, 0),
                        CUInt32x4GetElement(lhs, 1) & CUInt32x4GetElement(rhs, 1),
@@ -305,6 +366,8 @@ CUInt32x4BitwiseAndNot(const CUInt32x4 lhs, const CUInt32x4 rhs)
 {
 #if CSIMDX_X86_MMX
   return _mm_andnot_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
 #else
   return CUInt32x4BitwiseAnd(CUInt32x4BitwiseNot(lhs), rhs);
 #endif
@@ -318,9 +381,11 @@ CUInt32x4BitwiseOr(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return vorrq_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_or_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
 #else
   return CUInt32x4Make(CUInt32x4GetElement(lhs, 0) | CUInt32x4GetElement(rhs, 0),
-                       CUInt32x4GetElement(lhs, 1) | CUInt32x4GetElement(rhs, 1)
+                       CUInt32x4GetElement(lhs, 1) | CUInt32x4GetElement(rhs, 1),
                        CUInt32x4GetElement(lhs, 2) | CUInt32x4GetElement(rhs, 2),
                        CUInt32x4GetElement(lhs, 3) | CUInt32x4GetElement(rhs, 3));
 #endif
@@ -334,6 +399,8 @@ CUInt32x4BitwiseExclusiveOr(const CUInt32x4 lhs, const CUInt32x4 rhs)
   return veorq_u32(lhs, rhs);
 #elif CSIMDX_X86_MMX
   return _mm_xor_si128(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
 #else
   return CUInt32x4Make(CUInt32x4GetElement(lhs, 0) ^ CUInt32x4GetElement(rhs, 0),
                        CUInt32x4GetElement(lhs, 1) ^ CUInt32x4GetElement(rhs, 1),
@@ -345,17 +412,48 @@ CUInt32x4BitwiseExclusiveOr(const CUInt32x4 lhs, const CUInt32x4 rhs)
 #pragma mark Shifting
 
 /// Left-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero.
 FORCE_INLINE(CUInt32x4)
 CUInt32x4ShiftLeftElementWise(const CUInt32x4 lhs, const CUInt32x4 rhs)
 {
 #if CSIMDX_ARM_NEON
-  return vshlq_u32(lhs, rhs);
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshlq_u32(lhs, vreinterpretq_s32_u32(vminq_u32(rhs, vdupq_n_u32(32))));
+#elif CSIMDX_X86_AVX2
+  return _mm_sllv_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Multiplies by 2^rhs, built from the exponent bits of a 32-bit float. 2^31
+  // does not fit the signed conversion, but -2^31 does and is equal modulo 2^32.
+  __m128i sign = _mm_slli_epi32(_mm_cmpeq_epi32(rhs, _mm_set1_epi32(31)), 31);
+  __m128i exponent = _mm_add_epi32(_mm_slli_epi32(rhs, 23), _mm_set1_epi32(0x3F800000));
+  exponent = _mm_or_si128(exponent, sign);
+  __m128i power = _mm_cvttps_epi32(_mm_castsi128_ps(exponent));
+  #if CSIMDX_X86_SSE4_1
+  __m128i product = _mm_mullo_epi32(lhs, power);
+  #else
+  __m128i even = _mm_mul_epu32(lhs, power);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(power, 32));
+  __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                       _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  #endif
+  // Clear the lanes shifted by 32 or more bits, i.e. where `rhs & ~31` is non-zero
+  __m128i inRange = _mm_cmpeq_epi32(_mm_and_si128(rhs, _mm_set1_epi32(~31)), _mm_setzero_si128());
+  return _mm_and_si128(product, inRange);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x4 count = (CUInt32x4)rhs;
+  return (CUInt32x4)(((CUInt32x4)lhs << (count & 31)) & (CUInt32x4)(count < 32));
 #else
-  return CUInt32x4Make(CUInt32x4GetElement(lhs, 0) << CUInt32x4GetElement(rhs, 0),
-                       CUInt32x4GetElement(lhs, 1) << CUInt32x4GetElement(rhs, 1),
-                       CUInt32x4GetElement(lhs, 2) << CUInt32x4GetElement(rhs, 2),
-                       CUInt32x4GetElement(lhs, 3) << CUInt32x4GetElement(rhs, 3));
+  // Shifting by the element width or more is undefined, clear those lanes
+  UInt32 count0 = CUInt32x4GetElement(rhs, 0);
+  UInt32 count1 = CUInt32x4GetElement(rhs, 1);
+  UInt32 count2 = CUInt32x4GetElement(rhs, 2);
+  UInt32 count3 = CUInt32x4GetElement(rhs, 3);
+  return CUInt32x4Make(count0 < 32 ? CUInt32x4GetElement(lhs, 0) << count0 : 0,
+                       count1 < 32 ? CUInt32x4GetElement(lhs, 1) << count1 : 0,
+                       count2 < 32 ? CUInt32x4GetElement(lhs, 2) << count2 : 0,
+                       count3 < 32 ? CUInt32x4GetElement(lhs, 3) << count3 : 0);
 #endif
 }
 
@@ -364,34 +462,243 @@ CUInt32x4ShiftLeftElementWise(const CUInt32x4 lhs, const CUInt32x4 rhs)
 FORCE_INLINE(CUInt32x4)
 CUInt32x4ShiftLeft(const CUInt32x4 lhs, const UInt32 rhs)
 {
-#if CSIMDX_X86_MMX
+#if CSIMDX_X86_SSE2
   return _mm_slli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? (CUInt32x4)((CUInt32x4)lhs << rhs) : (CUInt32x4){ 0 };
 #else
   return CUInt32x4ShiftLeftElementWise(lhs, CUInt32x4MakeRepeatingElement(rhs));
 #endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits in each lane of rhs.
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with zero.
 FORCE_INLINE(CUInt32x4)
 CUInt32x4ShiftRightElementWise(const CUInt32x4 lhs, const CUInt32x4 rhs)
 {
-  return CUInt32x4Make(CUInt32x4GetElement(lhs, 0) >> CUInt32x4GetElement(rhs, 0),
-                       CUInt32x4GetElement(lhs, 1) >> CUInt32x4GetElement(rhs, 1),
-                       CUInt32x4GetElement(lhs, 2) >> CUInt32x4GetElement(rhs, 2),
-                       CUInt32x4GetElement(lhs, 3) >> CUInt32x4GetElement(rhs, 3));
+#if CSIMDX_ARM_NEON
+  // VSHL takes the lowest byte of each count as signed, clamp it to the element width
+  return vshlq_u32(lhs, vnegq_s32(vreinterpretq_s32_u32(vminq_u32(rhs, vdupq_n_u32(32)))));
+#elif CSIMDX_X86_AVX2
+  return _mm_srlv_epi32(lhs, rhs);
+#elif CSIMDX_X86_SSE2
+  // Shifts the whole storage by the count of each lane, which is read from the
+  // low 64 bits of the count operand, then picks each lane from its own shift.
+  const __m128i zero = _mm_setzero_si128();
+  __m128i low = _mm_unpacklo_epi32(rhs, zero);
+  __m128i high = _mm_unpackhi_epi32(rhs, zero);
+  __m128i shifted0 = _mm_srl_epi32(lhs, low);
+  __m128i shifted1 = _mm_srl_epi32(lhs, _mm_srli_si128(low, 8));
+  __m128i shifted2 = _mm_srl_epi32(lhs, high);
+  __m128i shifted3 = _mm_srl_epi32(lhs, _mm_srli_si128(high, 8));
+  __m128 lowPair = _mm_castsi128_ps(_mm_unpacklo_epi64(shifted0, shifted1));
+  __m128 highPair = _mm_castsi128_ps(_mm_unpackhi_epi64(shifted2, shifted3));
+  return _mm_castps_si128(_mm_shuffle_ps(lowPair, highPair, _MM_SHUFFLE(3, 0, 3, 0)));
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  return (lhs >> (rhs & 31)) & (CUInt32x4)(rhs < 32);
+#else
+  // Shifting by the element width or more is undefined, clear those lanes
+  UInt32 count0 = CUInt32x4GetElement(rhs, 0);
+  UInt32 count1 = CUInt32x4GetElement(rhs, 1);
+  UInt32 count2 = CUInt32x4GetElement(rhs, 2);
+  UInt32 count3 = CUInt32x4GetElement(rhs, 3);
+  return CUInt32x4Make(count0 < 32 ? CUInt32x4GetElement(lhs, 0) >> count0 : 0,
+                       count1 < 32 ? CUInt32x4GetElement(lhs, 1) >> count1 : 0,
+                       count2 < 32 ? CUInt32x4GetElement(lhs, 2) >> count2 : 0,
+                       count3 < 32 ? CUInt32x4GetElement(lhs, 3) >> count3 : 0);
+#endif
 }
 
-/// Right-shifts each element in the storage operand (lhs) by the specified
-/// number of bits of rhs.
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
 FORCE_INLINE(CUInt32x4)
 CUInt32x4ShiftRight(const CUInt32x4 lhs, const UInt32 rhs)
 {
-#if CSIMDX_X86_MMX
+#if CSIMDX_X86_SSE2
   return _mm_srli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? lhs >> rhs : (CUInt32x4){ 0 };
 #else
   return CUInt32x4ShiftRightElementWise(lhs, CUInt32x4MakeRepeatingElement(rhs));
 #endif
 }
 
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CUInt32x4){ popcount(operand[0]), popcount(operand[1]), ... }`
+FORCE_INLINE(CUInt32x4) CUInt32x4PopulationCount(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  uint8x16_t count = vcntq_u8(vreinterpretq_u8_u32(operand));
+  return vpaddlq_u16(vpaddlq_u8(count));
+#elif CSIMDX_X86_AVX512_VPOPCNTDQ
+  return _mm_popcnt_epi32(operand);
+#elif CSIMDX_X86_SSSE3
+  // Look up the bit count of each nibble, then sum up the bytes of each element
+  const __m128i table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  __m128i low = _mm_shuffle_epi8(table, _mm_and_si128(operand, nibble));
+  __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(operand, 4), nibble));
+  __m128i count = _mm_maddubs_epi16(_mm_add_epi8(low, high), _mm_set1_epi8(1));
+  return _mm_madd_epi16(count, _mm_set1_epi16(1));
+#elif CSIMDX_X86_SSE2
+  __m128i count = _mm_sub_epi32(operand, _mm_and_si128(_mm_srli_epi32(operand, 1), _mm_set1_epi32(0x55555555)));
+  count = _mm_add_epi32(_mm_and_si128(count, _mm_set1_epi32(0x33333333)),
+                        _mm_and_si128(_mm_srli_epi32(count, 2), _mm_set1_epi32(0x33333333)));
+  count = _mm_and_si128(_mm_add_epi32(count, _mm_srli_epi32(count, 4)), _mm_set1_epi32(0x0F0F0F0F));
+  count = _mm_add_epi32(count, _mm_srli_epi32(count, 8));
+  count = _mm_add_epi32(count, _mm_srli_epi32(count, 16));
+  return _mm_and_si128(count, _mm_set1_epi32(0x3F));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x4 bits = (CUInt32x4)operand;
+  bits = bits - ((bits >> 1) & 0x55555555);
+  bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+  bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+  return (CUInt32x4)((bits * 0x01010101) >> 24);
+#else
+  return CUInt32x4Make(__builtin_popcount(CUInt32x4GetElement(operand, 0)),
+                       __builtin_popcount(CUInt32x4GetElement(operand, 1)),
+                       __builtin_popcount(CUInt32x4GetElement(operand, 2)),
+                       __builtin_popcount(CUInt32x4GetElement(operand, 3)));
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CUInt32x4){ clz(operand[0]), clz(operand[1]), ... }`
+FORCE_INLINE(CUInt32x4) CUInt32x4LeadingZeroBitCount(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vclzq_u32(operand);
+#elif CSIMDX_X86_AVX512_CD
+  return _mm_lzcnt_epi32(operand);
+#elif CSIMDX_X86_SSE2
+  // Smear the most significant set bit to the right, then count the set bits
+  __m128i smeared = _mm_or_si128(operand, _mm_srli_epi32(operand, 1));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 2));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 4));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 8));
+  smeared = _mm_or_si128(smeared, _mm_srli_epi32(smeared, 16));
+  return _mm_sub_epi32(_mm_set1_epi32(32), CUInt32x4PopulationCount(smeared));
+#elif CSIMDX_EXT_VECTOR
+  // Smear the highest set bit to the right and count the remaining zeros
+  CUInt32x4 bits = (CUInt32x4)operand;
+  bits |= bits >> 1;
+  bits |= bits >> 2;
+  bits |= bits >> 4;
+  bits |= bits >> 8;
+  bits |= bits >> 16;
+  return CUInt32x4PopulationCount(CUInt32x4BitwiseNot((CUInt32x4)bits));
+#else
+  uint32_t element0 = CUInt32x4GetElement(operand, 0);
+  uint32_t element1 = CUInt32x4GetElement(operand, 1);
+  uint32_t element2 = CUInt32x4GetElement(operand, 2);
+  uint32_t element3 = CUInt32x4GetElement(operand, 3);
+  return CUInt32x4Make(element0 ? __builtin_clz(element0) : 32,
+                       element1 ? __builtin_clz(element1) : 32,
+                       element2 ? __builtin_clz(element2) : 32,
+                       element3 ? __builtin_clz(element3) : 32);
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CUInt32x4){ ctz(operand[0]), ctz(operand[1]), ... }`
+FORCE_INLINE(CUInt32x4) CUInt32x4TrailingZeroBitCount(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vclzq_u32(vreinterpretq_u32_u8(vrbitq_u8(vrev32q_u8(vreinterpretq_u8_u32(operand)))));
+#elif CSIMDX_ARM_NEON
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  return CUInt32x4PopulationCount(vbicq_u32(vsubq_u32(operand, vdupq_n_u32(1)), operand));
+#elif CSIMDX_X86_SSE2
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  return CUInt32x4PopulationCount(_mm_andnot_si128(operand, _mm_sub_epi32(operand, _mm_set1_epi32(1))));
+#elif CSIMDX_EXT_VECTOR
+  // The trailing zeros are the bits set in ~x & (x - 1)
+  return CUInt32x4PopulationCount(CUInt32x4BitwiseNot(operand) & (operand - 1));
+#else
+  uint32_t element0 = CUInt32x4GetElement(operand, 0);
+  uint32_t element1 = CUInt32x4GetElement(operand, 1);
+  uint32_t element2 = CUInt32x4GetElement(operand, 2);
+  uint32_t element3 = CUInt32x4GetElement(operand, 3);
+  return CUInt32x4Make(element0 ? __builtin_ctz(element0) : 32,
+                       element1 ? __builtin_ctz(element1) : 32,
+                       element2 ? __builtin_ctz(element2) : 32,
+                       element3 ? __builtin_ctz(element3) : 32);
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CUInt32x4){ bswap(operand[0]), bswap(operand[1]), ... }`
+FORCE_INLINE(CUInt32x4) CUInt32x4ByteSwap(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON
+  return vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(operand)));
+#elif CSIMDX_X86_SSSE3
+  return _mm_shuffle_epi8(operand, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+#elif CSIMDX_X86_SSE2
+  __m128i swapped = _mm_shufflelo_epi16(operand, _MM_SHUFFLE(2, 3, 0, 1));
+  swapped = _mm_shufflehi_epi16(swapped, _MM_SHUFFLE(2, 3, 0, 1));
+  return _mm_or_si128(_mm_slli_epi16(swapped, 8), _mm_srli_epi16(swapped, 8));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x4 bits = (CUInt32x4)operand;
+  return (CUInt32x4)((bits << 24) | ((bits & 0xFF00) << 8) | ((bits >> 8) & 0xFF00) | (bits >> 24));
+#else
+  return CUInt32x4Make(__builtin_bswap32(CUInt32x4GetElement(operand, 0)),
+                       __builtin_bswap32(CUInt32x4GetElement(operand, 1)),
+                       __builtin_bswap32(CUInt32x4GetElement(operand, 2)),
+                       __builtin_bswap32(CUInt32x4GetElement(operand, 3)));
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CUInt32x4){ bitreverse(operand[0]), bitreverse(operand[1]), ... }`
+FORCE_INLINE(CUInt32x4) CUInt32x4BitReverse(const CUInt32x4 operand)
+{
+#if CSIMDX_ARM_NEON_AARCH64
+  return vreinterpretq_u32_u8(vrbitq_u8(vrev32q_u8(vreinterpretq_u8_u32(operand))));
+#elif CSIMDX_ARM_NEON
+  // Swap adjacent bits, pairs of bits and nibbles, then the bytes
+  CUInt32x4 result = vorrq_u32(vandq_u32(vshrq_n_u32(operand, 1), vdupq_n_u32(0x55555555)),
+                               vshlq_n_u32(vandq_u32(operand, vdupq_n_u32(0x55555555)), 1));
+  result = vorrq_u32(vandq_u32(vshrq_n_u32(result, 2), vdupq_n_u32(0x33333333)),
+                     vshlq_n_u32(vandq_u32(result, vdupq_n_u32(0x33333333)), 2));
+  result = vorrq_u32(vandq_u32(vshrq_n_u32(result, 4), vdupq_n_u32(0x0F0F0F0F)),
+                     vshlq_n_u32(vandq_u32(result, vdupq_n_u32(0x0F0F0F0F)), 4));
+  return CUInt32x4ByteSwap(result);
+#elif CSIMDX_X86_SSSE3
+  // Look up the reversed nibbles of each byte, swapping them in the same go
+  const __m128i table = _mm_setr_epi8(0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+                                      0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  __m128i low = _mm_shuffle_epi8(_mm_slli_epi16(table, 4), _mm_and_si128(operand, nibble));
+  __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(operand, 4), nibble));
+  return CUInt32x4ByteSwap(_mm_or_si128(low, high));
+#elif CSIMDX_X86_SSE2
+  // Swap adjacent bits, pairs of bits and nibbles, then the bytes
+  __m128i result = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(operand, 1), _mm_set1_epi32(0x55555555)),
+                                _mm_slli_epi32(_mm_and_si128(operand, _mm_set1_epi32(0x55555555)), 1));
+  result = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(result, 2), _mm_set1_epi32(0x33333333)),
+                        _mm_slli_epi32(_mm_and_si128(result, _mm_set1_epi32(0x33333333)), 2));
+  result = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(result, 4), _mm_set1_epi32(0x0F0F0F0F)),
+                        _mm_slli_epi32(_mm_and_si128(result, _mm_set1_epi32(0x0F0F0F0F)), 4));
+  return CUInt32x4ByteSwap(result);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x4 bits = (CUInt32x4)operand;
+  bits = ((bits >> 1) & 0x55555555) | ((bits & 0x55555555) << 1);
+  bits = ((bits >> 2) & 0x33333333) | ((bits & 0x33333333) << 2);
+  bits = ((bits >> 4) & 0x0F0F0F0F) | ((bits & 0x0F0F0F0F) << 4);
+  return CUInt32x4ByteSwap((CUInt32x4)bits);
+#else
+  return CUInt32x4Make(__builtin_bitreverse32(CUInt32x4GetElement(operand, 0)),
+                       __builtin_bitreverse32(CUInt32x4GetElement(operand, 1)),
+                       __builtin_bitreverse32(CUInt32x4GetElement(operand, 2)),
+                       __builtin_bitreverse32(CUInt32x4GetElement(operand, 3)));
+#endif
+}
+
 #undef UInt32
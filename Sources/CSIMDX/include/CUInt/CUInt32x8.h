@@ -0,0 +1,583 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#pragma mark - Type def
+
+/// The 32-bit unsigned integer element
+#define UInt32 uint32_t
+
+/// The 8 x 32-bit unsigned integer storage, a single register where the target
+/// has 256-bit integer registers and two CUInt32x4 otherwise
+#if CSIMDX_X86_AVX2
+typedef __m256i CUInt32x8;
+#elif CSIMDX_EXT_VECTOR
+typedef UInt32 CUInt32x8 CSIMDX_EXT_VECTOR_TYPE(UInt32, 8);
+#else
+typedef struct CUInt32x8_t {
+  CUInt32x4 lo, hi;
+} CUInt32x8;
+#endif
+
+#pragma mark - Getter/Setter
+
+/// Returns the element at `index` of `storage` (`storage[index]`).
+/// @return `storage[index]`
+FORCE_INLINE(UInt32)
+CUInt32x8GetElement(const CUInt32x8 storage, const int index)
+{
+#if CSIMDX_X86_AVX2
+  return ((UInt32*)&(storage))[index];
+#elif CSIMDX_EXT_VECTOR
+  return storage[index];
+#else
+  union { CUInt32x8 storage; UInt32 rawValue[8]; } Union;
+  Union.storage = storage;
+  return Union.rawValue[index];
+#endif
+}
+
+/// Sets the element at `index` from `storage` to given value,
+/// i.e. `(*storage)[index] = value;`
+FORCE_INLINE(void)
+CUInt32x8SetElement(CUInt32x8* storage, const int index, const UInt32 value)
+{
+#if CSIMDX_X86_AVX2
+  ((UInt32*)storage)[index] = value;
+#elif CSIMDX_EXT_VECTOR
+  (*storage)[index] = value;
+#else
+  union { CUInt32x8* storage; UInt32* rawValue; } Union;
+  Union.storage = storage;
+  Union.rawValue[index] = value;
+#endif
+}
+
+#pragma mark Lanes
+
+/// Returns the lower half of `storage`.
+/// @return `(CUInt32x4){ storage[0], ..., storage[3] }`
+FORCE_INLINE(CUInt32x4) CUInt32x8GetLow(const CUInt32x8 storage)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_castsi256_si128(storage);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 0, 1, 2, 3);
+#else
+  return storage.lo;
+#endif
+}
+
+/// Returns the upper half of `storage`.
+/// @return `(CUInt32x4){ storage[4], ..., storage[7] }`
+FORCE_INLINE(CUInt32x4) CUInt32x8GetHigh(const CUInt32x8 storage)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_extracti128_si256(storage, 1);
+#elif CSIMDX_EXT_VECTOR
+  return __builtin_shufflevector(storage, storage, 4, 5, 6, 7);
+#else
+  return storage.hi;
+#endif
+}
+
+#pragma mark - Initialisation
+
+/// Initializes a storage to given elements. Least- to most-significant bits.
+/// @return `(CUInt32x8){ element0, element1, ..., element7 }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8Make(UInt32 element0, UInt32 element1, UInt32 element2, UInt32 element3,
+              UInt32 element4, UInt32 element5, UInt32 element6, UInt32 element7)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_setr_epi32(element0, element1, element2, element3,
+                           element4, element5, element6, element7);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8){ element0, element1, element2, element3,
+                      element4, element5, element6, element7 };
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4Make(element0, element1, element2, element3);
+  result.hi = CUInt32x4Make(element4, element5, element6, element7);
+  return result;
+#endif
+}
+
+/// Loads 8 x UInt32 values from unaligned memory.
+/// @return `(CUInt32x8){ pointer[0], pointer[1], ..., pointer[7] }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8MakeLoad(const UInt32* pointer)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_loadu_si256((const __m256i*)pointer);
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x8 result;
+  __builtin_memcpy(&result, pointer, sizeof(result));
+  return result;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4MakeLoad(pointer);
+  result.hi = CUInt32x4MakeLoad(&pointer[4]);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to `value`.
+/// @return `(CUInt32x8){ value, value, ..., value }`
+FORCE_INLINE(CUInt32x8) CUInt32x8MakeRepeatingElement(const UInt32 value)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_set1_epi32(value);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8){ value, value, value, value, value, value, value, value };
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4MakeRepeatingElement(value);
+  result.hi = CUInt32x4MakeRepeatingElement(value);
+  return result;
+#endif
+}
+
+/// Returns an intrinsic type with all elements initialized to zero (0).
+/// @return `(CUInt32x8){ 0, 0, ..., 0 }`
+FORCE_INLINE(CUInt32x8) CUInt32x8MakeZero(void)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_setzero_si256();
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8){ 0 };
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4MakeZero();
+  result.hi = CUInt32x4MakeZero();
+  return result;
+#endif
+}
+
+#pragma mark - Minimum & Maximum
+
+/// Performs element-by-element comparison of both storages and returns
+/// the lesser of each pair in the result.
+/// @return `(CUInt32x8){ lhs[0] < rhs[0] ? lhs[0] : rhs[0], ..., lhs[7] < rhs[7] ? lhs[7] : rhs[7] }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8Minimum(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_min_epu32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs < rhs) mask = lhs < rhs;
+  return (CUInt32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4Minimum(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4Minimum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Performs element-by-element comparison of both storages and returns
+/// the greater of each pair in the result.
+/// @return `(CUInt32x8){ lhs[0] > rhs[0] ? lhs[0] : rhs[0], ..., lhs[7] > rhs[7] ? lhs[7] : rhs[7] }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8Maximum(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_max_epu32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs > rhs) mask = lhs > rhs;
+  return (CUInt32x8)(((__typeof__(mask))lhs & mask) | ((__typeof__(mask))rhs & ~mask));
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4Maximum(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4Maximum(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Arithmetics
+
+/// Compares two storages for equality (element-wise), with all bits set in
+/// the elements that are equal and none in the others.
+/// @return `(CUInt32x8){ lhs[0] == rhs[0], lhs[1] == rhs[1], ..., lhs[7] == rhs[7] }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8CompareElementWise(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_cmpeq_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return (CUInt32x8)(lhs == rhs);
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4CompareElementWise(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4CompareElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Returns whether all elements of both storages are equal, comparing all
+/// elements at once and testing the mask of the comparison.
+/// @return `lhs[0] == rhs[0] && lhs[1] == rhs[1] && ... && lhs[7] == rhs[7]`
+FORCE_INLINE(bool)
+CUInt32x8Equal(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi32(lhs, rhs)) == 0xFFFFFFFF;
+#elif CSIMDX_EXT_VECTOR
+  __typeof__(lhs == rhs) mask = lhs == rhs;
+  return (mask[0] & mask[1] & mask[2] & mask[3] & mask[4] & mask[5] & mask[6] & mask[7]) != 0;
+#else
+  return CUInt32x4Equal(lhs.lo, rhs.lo) && CUInt32x4Equal(lhs.hi, rhs.hi);
+#endif
+}
+
+#pragma mark Additive
+
+/// Adds two storages (element-wise).
+/// @return `(CUInt32x8){ lhs[0] + rhs[0], lhs[1] + rhs[1], ..., lhs[7] + rhs[7] }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8Add(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_add_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs + rhs;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4Add(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4Add(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Subtracts a storage from another (element-wise).
+/// @return `(CUInt32x8){ lhs[0] - rhs[0], lhs[1] - rhs[1], ..., lhs[7] - rhs[7] }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8Subtract(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_sub_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs - rhs;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4Subtract(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4Subtract(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Multiplicative
+
+/// Multiplies two storages (element-wise), wrapping around on overflow.
+/// @return `(CUInt32x8){ lhs[0] * rhs[0], lhs[1] * rhs[1], ..., lhs[7] * rhs[7] }`
+FORCE_INLINE(CUInt32x8)
+CUInt32x8Multiply(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_mullo_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs * rhs;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4Multiply(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4Multiply(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark - Bitwise
+
+/// Bitwise Not
+FORCE_INLINE(CUInt32x8) CUInt32x8BitwiseNot(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_xor_si256(operand, _mm256_set1_epi32(-1));
+#elif CSIMDX_EXT_VECTOR
+  return ~operand;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4BitwiseNot(operand.lo);
+  result.hi = CUInt32x4BitwiseNot(operand.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And
+FORCE_INLINE(CUInt32x8)
+CUInt32x8BitwiseAnd(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_and_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs & rhs;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4BitwiseAnd(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4BitwiseAnd(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise And Not
+FORCE_INLINE(CUInt32x8)
+CUInt32x8BitwiseAndNot(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_andnot_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return ~lhs & rhs;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4BitwiseAndNot(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4BitwiseAndNot(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Or
+FORCE_INLINE(CUInt32x8)
+CUInt32x8BitwiseOr(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_or_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs | rhs;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4BitwiseOr(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4BitwiseOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Bitwise Exclusive Or
+FORCE_INLINE(CUInt32x8)
+CUInt32x8BitwiseExclusiveOr(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_xor_si256(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return lhs ^ rhs;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4BitwiseExclusiveOr(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4BitwiseExclusiveOr(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+#pragma mark Shifting
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits in each lane of rhs. Shifting by 32 or more bits results
+/// in zero.
+FORCE_INLINE(CUInt32x8)
+CUInt32x8ShiftLeftElementWise(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_sllv_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  CUInt32x8 count = (CUInt32x8)rhs;
+  return (CUInt32x8)(((CUInt32x8)lhs << (count & 31)) & (CUInt32x8)(count < 32));
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4ShiftLeftElementWise(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4ShiftLeftElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Left-shifts each element in the storage operand (lhs) by the specified
+/// number of bits of rhs.
+FORCE_INLINE(CUInt32x8)
+CUInt32x8ShiftLeft(const CUInt32x8 lhs, const UInt32 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_slli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? lhs << rhs : (CUInt32x8){ 0 };
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4ShiftLeft(lhs.lo, rhs);
+  result.hi = CUInt32x4ShiftLeft(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits in each lane of rhs. Shifting by 32 or more bits
+/// fills the element with zero.
+FORCE_INLINE(CUInt32x8)
+CUInt32x8ShiftRightElementWise(const CUInt32x8 lhs, const CUInt32x8 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_srlv_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  // Shifting by the element width or more is undefined, clear those lanes
+  return (lhs >> (rhs & 31)) & (CUInt32x8)(rhs < 32);
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4ShiftRightElementWise(lhs.lo, rhs.lo);
+  result.hi = CUInt32x4ShiftRightElementWise(lhs.hi, rhs.hi);
+  return result;
+#endif
+}
+
+/// Right-shifts (logical) each element in the storage operand (lhs) by the
+/// specified number of bits of rhs.
+FORCE_INLINE(CUInt32x8)
+CUInt32x8ShiftRight(const CUInt32x8 lhs, const UInt32 rhs)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_srli_epi32(lhs, rhs);
+#elif CSIMDX_EXT_VECTOR
+  return rhs < 32 ? lhs >> rhs : (CUInt32x8){ 0 };
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4ShiftRight(lhs.lo, rhs);
+  result.hi = CUInt32x4ShiftRight(lhs.hi, rhs);
+  return result;
+#endif
+}
+
+#pragma mark Counting
+
+/// Counts the number of set bits (element-wise).
+/// @return `(CUInt32x8){ popcount(operand[0]), popcount(operand[1]), ..., popcount(operand[7]) }`
+FORCE_INLINE(CUInt32x8) CUInt32x8PopulationCount(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX512_VPOPCNTDQ
+  return _mm256_popcnt_epi32(operand);
+#elif CSIMDX_X86_AVX2
+  // Look up the bit count of each nibble, then sum up the bytes of each element
+  const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(operand, nibble));
+  __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(operand, 4), nibble));
+  __m256i count = _mm256_maddubs_epi16(_mm256_add_epi8(low, high), _mm256_set1_epi8(1));
+  return _mm256_madd_epi16(count, _mm256_set1_epi16(1));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x8 bits = operand;
+  bits = bits - ((bits >> 1) & 0x55555555);
+  bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+  bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+  return (bits * 0x01010101) >> 24;
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4PopulationCount(operand.lo);
+  result.hi = CUInt32x4PopulationCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of leading (most significant) zero bits (element-wise).
+/// @return `(CUInt32x8){ clz(operand[0]), clz(operand[1]), ..., clz(operand[7]) }`
+FORCE_INLINE(CUInt32x8) CUInt32x8LeadingZeroBitCount(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX512_CD
+  return _mm256_lzcnt_epi32(operand);
+#elif CSIMDX_X86_AVX2
+  // Smear the most significant set bit to the right, then count the set bits
+  __m256i smeared = _mm256_or_si256(operand, _mm256_srli_epi32(operand, 1));
+  smeared = _mm256_or_si256(smeared, _mm256_srli_epi32(smeared, 2));
+  smeared = _mm256_or_si256(smeared, _mm256_srli_epi32(smeared, 4));
+  smeared = _mm256_or_si256(smeared, _mm256_srli_epi32(smeared, 8));
+  smeared = _mm256_or_si256(smeared, _mm256_srli_epi32(smeared, 16));
+  return _mm256_sub_epi32(_mm256_set1_epi32(32), CUInt32x8PopulationCount(smeared));
+#elif CSIMDX_EXT_VECTOR
+  // Smear the highest set bit to the right and count the remaining zeros
+  CUInt32x8 bits = operand;
+  bits |= bits >> 1;
+  bits |= bits >> 2;
+  bits |= bits >> 4;
+  bits |= bits >> 8;
+  bits |= bits >> 16;
+  return CUInt32x8PopulationCount(~bits);
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4LeadingZeroBitCount(operand.lo);
+  result.hi = CUInt32x4LeadingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+/// Counts the number of trailing (least significant) zero bits (element-wise).
+/// @return `(CUInt32x8){ ctz(operand[0]), ctz(operand[1]), ..., ctz(operand[7]) }`
+FORCE_INLINE(CUInt32x8) CUInt32x8TrailingZeroBitCount(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  // Count the bits below the least significant set bit, i.e. `~x & (x - 1)`
+  return CUInt32x8PopulationCount(_mm256_andnot_si256(operand, _mm256_sub_epi32(operand, _mm256_set1_epi32(1))));
+#elif CSIMDX_EXT_VECTOR
+  // The trailing zeros are the bits set in ~x & (x - 1)
+  return CUInt32x8PopulationCount(~operand & (operand - 1));
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4TrailingZeroBitCount(operand.lo);
+  result.hi = CUInt32x4TrailingZeroBitCount(operand.hi);
+  return result;
+#endif
+}
+
+#pragma mark Reordering
+
+/// Reverses the order of the bytes (element-wise).
+/// @return `(CUInt32x8){ bswap(operand[0]), bswap(operand[1]), ..., bswap(operand[7]) }`
+FORCE_INLINE(CUInt32x8) CUInt32x8ByteSwap(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  return _mm256_shuffle_epi8(operand, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+#elif CSIMDX_EXT_VECTOR
+  return (operand << 24) | ((operand & 0xFF00) << 8) | ((operand >> 8) & 0xFF00) | (operand >> 24);
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4ByteSwap(operand.lo);
+  result.hi = CUInt32x4ByteSwap(operand.hi);
+  return result;
+#endif
+}
+
+/// Reverses the order of the bits (element-wise).
+/// @return `(CUInt32x8){ bitreverse(operand[0]), bitreverse(operand[1]), ..., bitreverse(operand[7]) }`
+FORCE_INLINE(CUInt32x8) CUInt32x8BitReverse(const CUInt32x8 operand)
+{
+#if CSIMDX_X86_AVX2
+  // Look up the reversed nibbles of each byte, swapping them in the same go
+  const __m256i table = _mm256_setr_epi8(0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+                                         0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF,
+                                         0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+                                         0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF);
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  __m256i low = _mm256_shuffle_epi8(_mm256_slli_epi16(table, 4), _mm256_and_si256(operand, nibble));
+  __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(operand, 4), nibble));
+  return CUInt32x8ByteSwap(_mm256_or_si256(low, high));
+#elif CSIMDX_EXT_VECTOR
+  CUInt32x8 bits = operand;
+  bits = ((bits >> 1) & 0x55555555) | ((bits & 0x55555555) << 1);
+  bits = ((bits >> 2) & 0x33333333) | ((bits & 0x33333333) << 2);
+  bits = ((bits >> 4) & 0x0F0F0F0F) | ((bits & 0x0F0F0F0F) << 4);
+  return CUInt32x8ByteSwap(bits);
+#else
+  CUInt32x8 result;
+  result.lo = CUInt32x4BitReverse(operand.lo);
+  result.hi = CUInt32x4BitReverse(operand.hi);
+  return result;
+#endif
+}
+
+#undef UInt32
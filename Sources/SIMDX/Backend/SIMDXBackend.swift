@@ -0,0 +1,172 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+
+/// The code path the SIMDX storages have been compiled to, and the instruction
+/// set extensions of the executing CPU.
+///
+/// As the storages are inlined, `SIMDXBackend.current` describes the code
+/// path of the SIMDX module. Clients built with other compiler flags may query
+/// `CSIMDXActiveFeatures()` and `CSIMDXStorageKindOf(_:)` directly instead.
+public struct SIMDXBackend: Equatable {
+
+  /// A set of instruction set extensions.
+  public struct Features: OptionSet, Hashable {
+    public let rawValue: UInt32
+
+    public init(rawValue: UInt32) {
+      self.rawValue = rawValue
+    }
+
+    public static let sse2 = Self(CSIMDXCPUFeatureSSE2)
+    public static let sse3 = Self(CSIMDXCPUFeatureSSE3)
+    public static let ssse3 = Self(CSIMDXCPUFeatureSSSE3)
+    public static let sse4_1 = Self(CSIMDXCPUFeatureSSE4_1)
+    public static let avx = Self(CSIMDXCPUFeatureAVX)
+    public static let avx2 = Self(CSIMDXCPUFeatureAVX2)
+    public static let fma = Self(CSIMDXCPUFeatureFMA)
+    public static let avx512f = Self(CSIMDXCPUFeatureAVX512F)
+    public static let avx512vl = Self(CSIMDXCPUFeatureAVX512VL)
+    public static let avx512cd = Self(CSIMDXCPUFeatureAVX512CD)
+    public static let avx512vpopcntdq = Self(CSIMDXCPUFeatureAVX512VPOPCNTDQ)
+    public static let neon = Self(CSIMDXCPUFeatureNEON)
+    public static let neonFP16 = Self(CSIMDXCPUFeatureNEONFP16)
+    public static let neonDotProd = Self(CSIMDXCPUFeatureNEONDotProd)
+    public static let sve = Self(CSIMDXCPUFeatureSVE)
+
+    @inline(__always)
+    private init(_ feature: CSIMDXCPUFeature) {
+      self.init(rawValue: UInt32(feature.rawValue))
+    }
+
+    /// The names of all known extensions, in the order of their bits.
+    public static let names: [(feature: Features, name: String)] = [
+      (.sse2, "SSE2"), (.sse3, "SSE3"), (.ssse3, "SSSE3"), (.sse4_1, "SSE4.1"),
+      (.avx, "AVX"), (.avx2, "AVX2"), (.fma, "FMA"), (.avx512f, "AVX512F"),
+      (.avx512vl, "AVX512VL"), (.avx512cd, "AVX512CD"), (.avx512vpopcntdq, "AVX512VPOPCNTDQ"),
+      (.neon, "NEON"), (.neonFP16, "NEON-FP16"), (.neonDotProd, "NEON-DotProd"), (.sve, "SVE"),
+    ]
+  }
+
+  /// How a storage type is represented by the compiled code path.
+  public enum StorageKind: String {
+    /// A single register of the targeted instruction set
+    case nativeRegister = "native register"
+    /// Two storages of half the length, e.g. two `Float64x2` for `Float64x4`
+    case emulatedPair = "emulated pair"
+    /// A generic compiler vector, lowered to whatever the target provides
+    case genericVector = "generic vector"
+    /// A plain array, processed element by element
+    case scalarFallback = "scalar fallback"
+
+    init(_ kind: CSIMDXStorageKind) {
+      switch kind {
+      case CSIMDXStorageKindNativeRegister: self = .nativeRegister
+      case CSIMDXStorageKindEmulatedPair: self = .emulatedPair
+      case CSIMDXStorageKindGenericVector: self = .genericVector
+      default: self = .scalarFallback
+      }
+    }
+  }
+
+  /// The extensions the storages have been compiled for.
+  public let activeFeatures: Features
+
+  /// The extensions supported by the executing CPU and operating system.
+  public let cpuFeatures: Features
+
+  /// The `SIMDX_ISA` level the module has been built with, if any.
+  public let isaLevel: String?
+
+  /// The level the bulk buffer kernels are currently dispatched to.
+  public let dispatchLevel: CSIMDXDispatchLevel
+
+  /// The representation of each storage type, by name.
+  public let storages: [(name: String, kind: StorageKind)]
+
+  /// The backend of the SIMDX module on the executing CPU.
+  public static var current: SIMDXBackend {
+    let types: [(String, CSIMDXStorageType)] = [
+      ("Float32x2", CSIMDXStorageTypeFloat32x2), ("Float32x3", CSIMDXStorageTypeFloat32x3),
+      ("Float32x4", CSIMDXStorageTypeFloat32x4), ("Float32x8", CSIMDXStorageTypeFloat32x8),
+      ("Float32x16", CSIMDXStorageTypeFloat32x16), ("Float64x2", CSIMDXStorageTypeFloat64x2),
+      ("Float64x3", CSIMDXStorageTypeFloat64x3), ("Float64x4", CSIMDXStorageTypeFloat64x4),
+      ("Float64x8", CSIMDXStorageTypeFloat64x8),
+      ("Int32x2", CSIMDXStorageTypeInt32x2), ("Int32x3", CSIMDXStorageTypeInt32x3),
+      ("Int32x4", CSIMDXStorageTypeInt32x4), ("Int32x8", CSIMDXStorageTypeInt32x8),
+      ("Int32x16", CSIMDXStorageTypeInt32x16),
+      ("UInt32x2", CSIMDXStorageTypeUInt32x2), ("UInt32x3", CSIMDXStorageTypeUInt32x3),
+      ("UInt32x4", CSIMDXStorageTypeUInt32x4), ("UInt32x8", CSIMDXStorageTypeUInt32x8),
+      ("UInt32x16", CSIMDXStorageTypeUInt32x16),
+    ]
+    return SIMDXBackend(
+      activeFeatures: Features(rawValue: CSIMDXActiveFeatures()),
+      cpuFeatures: Features(rawValue: CSIMDXCPUFeatures()),
+      isaLevel: CSIMDXActiveISALevel().map { String(cString: $0) },
+      dispatchLevel: CSIMDXDispatchLevelCurrent(),
+      storages: types.map { ($0.0, StorageKind(CSIMDXStorageKindOf($0.1))) }
+    )
+  }
+
+  /// Whether any storage type is processed element by element.
+  public var usesScalarFallback: Bool {
+    storages.contains { $0.kind == .scalarFallback }
+  }
+
+  /// The extensions of the executing CPU the compiled code path leaves unused.
+  public var unusedFeatures: Features {
+    cpuFeatures.subtracting(activeFeatures)
+  }
+
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    lhs.activeFeatures == rhs.activeFeatures
+      && lhs.cpuFeatures == rhs.cpuFeatures
+      && lhs.isaLevel == rhs.isaLevel
+      && lhs.dispatchLevel == rhs.dispatchLevel
+      && lhs.storages.elementsEqual(rhs.storages) { $0.name == $1.name && $0.kind == $1.kind }
+  }
+}
+
+// MARK: - Conformance to CustomStringConvertible
+extension SIMDXBackend: CustomStringConvertible {
+  public var description: String {
+    func list(_ features: Features) -> String {
+      let names = Features.names.filter { features.contains($0.feature) }.map { $0.name }
+      return names.isEmpty ? "none" : names.joined(separator: " ")
+    }
+    let dispatch: String
+    switch dispatchLevel {
+    case CSIMDXDispatchLevelSSE2: dispatch = "SSE2"
+    case CSIMDXDispatchLevelSSE4_1: dispatch = "SSE4.1"
+    case CSIMDXDispatchLevelAVX2: dispatch = "AVX2"
+    case CSIMDXDispatchLevelAVX512: dispatch = "AVX-512"
+    case CSIMDXDispatchLevelNEON: dispatch = "NEON"
+    default: dispatch = "generic"
+    }
+    func row(_ label: String, _ value: String) -> String {
+      label + String(repeating: " ", count: max(1, 18 - label.count)) + value
+    }
+    var lines = [
+      row("ISA level:", isaLevel ?? "default"),
+      row("Compiled for:", list(activeFeatures)),
+      row("CPU supports:", list(cpuFeatures)),
+      row("Unused by build:", list(unusedFeatures)),
+      row("Bulk kernels:", dispatch),
+      "Storages:",
+    ]
+    lines += storages.map { row("  \($0.name)", $0.kind.rawValue) }
+    return lines.joined(separator: "\n")
+  }
+}
@@ -0,0 +1,407 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// An element-wise computation over buffers of SIMDX vectors, that is not
+/// evaluated until asked for its result.
+///
+/// The operators on expressions build a tree of nodes instead of a buffer per
+/// operator. `evaluated()` then runs a single loop, that computes each vector
+/// of the result from the vectors at the same index of all buffers at once.
+/// Intermediate vectors stay in registers and no intermediate buffer is ever
+/// written. A product, that is added to or subtracted from another operand, is
+/// contracted to a fused multiply-add for floating-point vectors.
+///
+///     let colors: [SIMDX4<Float32>] = ...
+///     let result = ((colors.expression + brightness) * scale).evaluated()
+public protocol SIMDXExpression {
+  /// The vector type the expression is computed in.
+  associatedtype Vector: SIMDX
+
+  /// The number of vectors of the expression, that is the least number of
+  /// vectors of all its buffers. A repeated vector does not limit the count.
+  var count: Int { get }
+
+  /// The vector at `index` of the expression, computed from the vectors at
+  /// `index` of all its buffers.
+  func vector(at index: Int) -> Vector
+}
+
+// MARK: - Evaluation
+extension SIMDXExpression {
+  /// Writes each vector of the expression to the same index of `buffer`, in a
+  /// single pass over all operands.
+  ///
+  /// - Precondition: The buffer must have room for at least `count` vectors.
+  @inlinable
+  public func evaluate(into buffer: UnsafeMutableBufferPointer<Vector>) {
+    let count = self.count
+    precondition(count <= buffer.count, "The buffer is too small for the expression")
+    guard let baseAddress = buffer.baseAddress else { return }
+    for index in 0 ..< count {
+      (baseAddress + index).initialize(to: vector(at: index))
+    }
+  }
+
+  /// Returns the vectors of the expression, computed in a single pass over all
+  /// operands.
+  ///
+  /// - Precondition: The expression must contain at least one buffer.
+  @inlinable
+  public func evaluated() -> [Vector] {
+    let count = self.count
+    precondition(count != .max, "An expression of repeated vectors only has no count")
+    return Array(unsafeUninitializedCapacity: count) { buffer, initializedCount in
+      evaluate(into: buffer)
+      initializedCount = count
+    }
+  }
+}
+
+// MARK: - Operands
+
+/// A buffer of vectors as operand of an expression.
+public struct SIMDXBufferExpression<Vector: SIMDX>: SIMDXExpression {
+  /// The vectors of the operand.
+  public let vectors: [Vector]
+
+  /// Initialize to an operand of the given vectors.
+  @inlinable
+  public init(_ vectors: [Vector]) {
+    self.vectors = vectors
+  }
+
+  @inlinable
+  public var count: Int { vectors.count }
+
+  @inlinable
+  public func vector(at index: Int) -> Vector {
+    vectors[index]
+  }
+}
+
+/// A single vector as operand of an expression, that is repeated for each
+/// index. It is held in a register for the whole evaluation, e.g. a scale.
+public struct SIMDXRepeatedExpression<Vector: SIMDX>: SIMDXExpression {
+  /// The repeated vector.
+  public let value: Vector
+
+  /// Initialize to an operand repeating `value` for each index.
+  @inlinable
+  public init(_ value: Vector) {
+    self.value = value
+  }
+
+  /// A repeated vector does not limit the number of vectors of an expression.
+  @inlinable
+  public var count: Int { .max }
+
+  @inlinable
+  public func vector(at index: Int) -> Vector {
+    value
+  }
+}
+
+extension Array where Element: SIMDX {
+  /// The vectors as operand of a lazily evaluated expression.
+  @inlinable
+  public var expression: SIMDXBufferExpression<Element> {
+    SIMDXBufferExpression(self)
+  }
+}
+
+// MARK: - Nodes
+
+/// The element-wise sum of two expressions.
+public struct SIMDXSum<LHS: SIMDXExpression, RHS: SIMDXExpression>: SIMDXExpression
+where LHS.Vector == RHS.Vector, LHS.Vector.RawValue: AdditiveArithmetic {
+  public let lhs: LHS
+  public let rhs: RHS
+
+  @inlinable
+  public init(_ lhs: LHS, _ rhs: RHS) {
+    self.lhs = lhs
+    self.rhs = rhs
+  }
+
+  @inlinable
+  public var count: Int { Swift.min(lhs.count, rhs.count) }
+
+  @inlinable
+  public func vector(at index: Int) -> LHS.Vector {
+    LHS.Vector(rawValue: lhs.vector(at: index).rawValue + rhs.vector(at: index).rawValue)
+  }
+}
+
+/// The element-wise difference of two expressions.
+public struct SIMDXDifference<LHS: SIMDXExpression, RHS: SIMDXExpression>: SIMDXExpression
+where LHS.Vector == RHS.Vector, LHS.Vector.RawValue: AdditiveArithmetic {
+  public let lhs: LHS
+  public let rhs: RHS
+
+  @inlinable
+  public init(_ lhs: LHS, _ rhs: RHS) {
+    self.lhs = lhs
+    self.rhs = rhs
+  }
+
+  @inlinable
+  public var count: Int { Swift.min(lhs.count, rhs.count) }
+
+  @inlinable
+  public func vector(at index: Int) -> LHS.Vector {
+    LHS.Vector(rawValue: lhs.vector(at: index).rawValue - rhs.vector(at: index).rawValue)
+  }
+}
+
+/// The element-wise product of two expressions. Adding it to or subtracting it
+/// from a floating-point expression yields a `SIMDXMultiplyAdd`.
+public struct SIMDXProduct<LHS: SIMDXExpression, RHS: SIMDXExpression>: SIMDXExpression
+where LHS.Vector == RHS.Vector, LHS.Vector.RawValue: Numeric {
+  public let lhs: LHS
+  public let rhs: RHS
+
+  @inlinable
+  public init(_ lhs: LHS, _ rhs: RHS) {
+    self.lhs = lhs
+    self.rhs = rhs
+  }
+
+  @inlinable
+  public var count: Int { Swift.min(lhs.count, rhs.count) }
+
+  @inlinable
+  public func vector(at index: Int) -> LHS.Vector {
+    LHS.Vector(rawValue: lhs.vector(at: index).rawValue * rhs.vector(at: index).rawValue)
+  }
+}
+
+/// The element-wise quotient of two expressions.
+public struct SIMDXQuotient<LHS: SIMDXExpression, RHS: SIMDXExpression>: SIMDXExpression
+where LHS.Vector == RHS.Vector, LHS.Vector.RawValue: SIMDXScalarArithmetic {
+  public let lhs: LHS
+  public let rhs: RHS
+
+  @inlinable
+  public init(_ lhs: LHS, _ rhs: RHS) {
+    self.lhs = lhs
+    self.rhs = rhs
+  }
+
+  @inlinable
+  public var count: Int { Swift.min(lhs.count, rhs.count) }
+
+  @inlinable
+  public func vector(at index: Int) -> LHS.Vector {
+    LHS.Vector(rawValue: lhs.vector(at: index).rawValue / rhs.vector(at: index).rawValue)
+  }
+}
+
+/// The element-wise negation of an expression.
+public struct SIMDXNegation<Operand: SIMDXExpression>: SIMDXExpression
+where Operand.Vector.RawValue: SignedNumeric {
+  public let operand: Operand
+
+  @inlinable
+  public init(_ operand: Operand) {
+    self.operand = operand
+  }
+
+  @inlinable
+  public var count: Int { operand.count }
+
+  @inlinable
+  public func vector(at index: Int) -> Operand.Vector {
+    Operand.Vector(rawValue: -operand.vector(at: index).rawValue)
+  }
+}
+
+/// The element-wise sum of `addend` and the product of `lhs` and `rhs`,
+/// computed by a fused multiply-add if the target has one.
+public struct SIMDXMultiplyAdd<LHS: SIMDXExpression, RHS: SIMDXExpression, Addend: SIMDXExpression>: SIMDXExpression
+where LHS.Vector == RHS.Vector, LHS.Vector == Addend.Vector, LHS.Vector.RawValue: SIMDXScalarArithmetic {
+  public let lhs: LHS
+  public let rhs: RHS
+  public let addend: Addend
+
+  @inlinable
+  public init(_ lhs: LHS, _ rhs: RHS, _ addend: Addend) {
+    self.lhs = lhs
+    self.rhs = rhs
+    self.addend = addend
+  }
+
+  @inlinable
+  public var count: Int { Swift.min(lhs.count, rhs.count, addend.count) }
+
+  @inlinable
+  public func vector(at index: Int) -> LHS.Vector {
+    let product = (lhs.vector(at: index).rawValue, rhs.vector(at: index).rawValue)
+    return LHS.Vector(rawValue: addend.vector(at: index).rawValue.addingProduct(product.0, product.1))
+  }
+}
+
+// MARK: - Operators
+// Both operands must be expressions, or one of them an element. A vector
+// operand is wrapped into a `SIMDXRepeatedExpression`, as overloads taking
+// either a vector or an element would be ambiguous for integer literals.
+extension SIMDXExpression where Vector.RawValue: AdditiveArithmetic {
+  @inlinable
+  public static func + <RHS: SIMDXExpression>(lhs: Self, rhs: RHS) -> SIMDXSum<Self, RHS> where RHS.Vector == Vector {
+    SIMDXSum(lhs, rhs)
+  }
+
+  @inlinable
+  public static func - <RHS: SIMDXExpression>(lhs: Self, rhs: RHS) -> SIMDXDifference<Self, RHS> where RHS.Vector == Vector {
+    SIMDXDifference(lhs, rhs)
+  }
+}
+
+extension SIMDXExpression where Vector.RawValue: Numeric {
+  @inlinable
+  public static func * <RHS: SIMDXExpression>(lhs: Self, rhs: RHS) -> SIMDXProduct<Self, RHS> where RHS.Vector == Vector {
+    SIMDXProduct(lhs, rhs)
+  }
+}
+
+extension SIMDXExpression where Vector.RawValue: SignedNumeric {
+  @inlinable
+  public static prefix func - (operand: Self) -> SIMDXNegation<Self> {
+    SIMDXNegation(operand)
+  }
+}
+
+// MARK: - Floating-Point Operators
+// An element operand is repeated into a vector once, before the evaluation.
+extension SIMDXExpression where Vector.RawValue: SIMDXScalarArithmetic {
+  public typealias Repeated = SIMDXRepeatedExpression<Vector>
+
+  @inlinable
+  static func repeated(_ element: Vector.Element) -> Repeated {
+    Repeated(Vector(rawValue: Vector.RawValue(repeating: element)))
+  }
+
+  @inlinable
+  public static func / <RHS: SIMDXExpression>(lhs: Self, rhs: RHS) -> SIMDXQuotient<Self, RHS> where RHS.Vector == Vector {
+    SIMDXQuotient(lhs, rhs)
+  }
+
+  @inlinable
+  public static func + (lhs: Self, rhs: Vector.Element) -> SIMDXSum<Self, Repeated> {
+    SIMDXSum(lhs, repeated(rhs))
+  }
+
+  @inlinable
+  public static func + (lhs: Vector.Element, rhs: Self) -> SIMDXSum<Repeated, Self> {
+    SIMDXSum(repeated(lhs), rhs)
+  }
+
+  @inlinable
+  public static func - (lhs: Self, rhs: Vector.Element) -> SIMDXDifference<Self, Repeated> {
+    SIMDXDifference(lhs, repeated(rhs))
+  }
+
+  @inlinable
+  public static func - (lhs: Vector.Element, rhs: Self) -> SIMDXDifference<Repeated, Self> {
+    SIMDXDifference(repeated(lhs), rhs)
+  }
+
+  @inlinable
+  public static func * (lhs: Self, rhs: Vector.Element) -> SIMDXProduct<Self, Repeated> {
+    SIMDXProduct(lhs, repeated(rhs))
+  }
+
+  @inlinable
+  public static func * (lhs: Vector.Element, rhs: Self) -> SIMDXProduct<Repeated, Self> {
+    SIMDXProduct(repeated(lhs), rhs)
+  }
+
+  @inlinable
+  public static func / (lhs: Self, rhs: Vector.Element) -> SIMDXQuotient<Self, Repeated> {
+    SIMDXQuotient(lhs, repeated(rhs))
+  }
+
+  @inlinable
+  public static func / (lhs: Vector.Element, rhs: Self) -> SIMDXQuotient<Repeated, Self> {
+    SIMDXQuotient(repeated(lhs), rhs)
+  }
+}
+
+// MARK: - Contraction
+// These overloads are declared on the product itself, which makes them more
+// specific than the ones of all expressions, so that `a * b + c` and `c - a * b`
+// become a single multiply-add node. `a * b - c` is `a * b + (-c)` and
+// `c - a * b` is `(-a) * b + c`, which is exact, as negation only flips the sign.
+extension SIMDXProduct where LHS.Vector.RawValue: SIMDXScalarArithmetic {
+  @inlinable
+  public static func + <Addend: SIMDXExpression>(lhs: Self, rhs: Addend) -> SIMDXMultiplyAdd<LHS, RHS, Addend> where Addend.Vector == Vector {
+    SIMDXMultiplyAdd(lhs.lhs, lhs.rhs, rhs)
+  }
+
+  @inlinable
+  public static func + <Addend: SIMDXExpression>(lhs: Addend, rhs: Self) -> SIMDXMultiplyAdd<LHS, RHS, Addend> where Addend.Vector == Vector {
+    SIMDXMultiplyAdd(rhs.lhs, rhs.rhs, lhs)
+  }
+
+  @inlinable
+  public static func + <OtherLHS, OtherRHS>(
+    lhs: Self,
+    rhs: SIMDXProduct<OtherLHS, OtherRHS>
+  ) -> SIMDXMultiplyAdd<LHS, RHS, SIMDXProduct<OtherLHS, OtherRHS>> where OtherLHS.Vector == Vector {
+    SIMDXMultiplyAdd(lhs.lhs, lhs.rhs, rhs)
+  }
+
+  @inlinable
+  public static func + (lhs: Self, rhs: Vector.Element) -> SIMDXMultiplyAdd<LHS, RHS, Repeated> {
+    SIMDXMultiplyAdd(lhs.lhs, lhs.rhs, repeated(rhs))
+  }
+
+  @inlinable
+  public static func + (lhs: Vector.Element, rhs: Self) -> SIMDXMultiplyAdd<LHS, RHS, Repeated> {
+    SIMDXMultiplyAdd(rhs.lhs, rhs.rhs, repeated(lhs))
+  }
+
+  @inlinable
+  public static func - <Subtrahend: SIMDXExpression>(
+    lhs: Self,
+    rhs: Subtrahend
+  ) -> SIMDXMultiplyAdd<LHS, RHS, SIMDXNegation<Subtrahend>> where Subtrahend.Vector == Vector {
+    SIMDXMultiplyAdd(lhs.lhs, lhs.rhs, SIMDXNegation(rhs))
+  }
+
+  @inlinable
+  public static func - <Minuend: SIMDXExpression>(
+    lhs: Minuend,
+    rhs: Self
+  ) -> SIMDXMultiplyAdd<SIMDXNegation<LHS>, RHS, Minuend> where Minuend.Vector == Vector {
+    SIMDXMultiplyAdd(SIMDXNegation(rhs.lhs), rhs.rhs, lhs)
+  }
+
+  @inlinable
+  public static func - <OtherLHS, OtherRHS>(
+    lhs: Self,
+    rhs: SIMDXProduct<OtherLHS, OtherRHS>
+  ) -> SIMDXMultiplyAdd<LHS, RHS, SIMDXNegation<SIMDXProduct<OtherLHS, OtherRHS>>> where OtherLHS.Vector == Vector {
+    SIMDXMultiplyAdd(lhs.lhs, lhs.rhs, SIMDXNegation(rhs))
+  }
+
+  @inlinable
+  public static func - (lhs: Self, rhs: Vector.Element) -> SIMDXMultiplyAdd<LHS, RHS, Repeated> {
+    SIMDXMultiplyAdd(lhs.lhs, lhs.rhs, repeated(-rhs))
+  }
+
+  @inlinable
+  public static func - (lhs: Vector.Element, rhs: Self) -> SIMDXMultiplyAdd<SIMDXNegation<LHS>, RHS, Repeated> {
+    SIMDXMultiplyAdd(SIMDXNegation(rhs.lhs), rhs.rhs, repeated(lhs))
+  }
+}
@@ -0,0 +1,256 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// The result of comparing two SIMDX values lane by lane, held in an integer
+/// storage of as many lanes with all bits set in the lanes where the
+/// comparison holds and none in the others. A mask selects the elements of
+/// either of two values without a branch, see `replacing(with:where:)`.
+public protocol SIMDXMask: RawRepresentable, Hashable, ExpressibleByArrayLiteral
+where RawValue: SIMDXMaskStorage, ArrayLiteralElement == Bool {
+  // OVERRIDEN: All modifications (setter)
+  var rawValue: RawValue { get set }
+
+  // OVERRIDEN: Non-failable initializer
+  init(rawValue: RawValue)
+}
+
+// MARK: - Additional Initializers
+extension SIMDXMask {
+  /// Initialize to a mask with all lanes equal to `value`.
+  @_transparent
+  public init(repeating value: Bool) {
+    self.init(rawValue: RawValue(repeating: value ? ~0 : 0))
+  }
+
+  @_transparent
+  public init(arrayLiteral elements: Bool...) {
+    self.init(rawValue: RawValue(elements.map { $0 ? ~0 : 0 }))
+  }
+}
+
+// MARK: - Lanes
+extension SIMDXMask {
+  /// The number of lanes.
+  @_transparent
+  public var count: Int { rawValue.count }
+
+  /// Whether the lane at `index` is set.
+  public subscript(index: RawValue.Index) -> Bool {
+    @_transparent set { rawValue[index] = newValue ? ~0 : 0 }
+    @_transparent get { rawValue[index] != 0 }
+  }
+}
+
+// MARK: - Reduction
+extension SIMDXMask {
+  /// Returns whether any lane is set, tested for all lanes at once.
+  @_transparent
+  public func any() -> Bool {
+    rawValue.any()
+  }
+
+  /// Returns whether all lanes are set, tested for all lanes at once.
+  @_transparent
+  public func all() -> Bool {
+    rawValue.all()
+  }
+}
+
+// MARK: - Logical Operators
+extension SIMDXMask {
+  /// The lanes set in both masks.
+  @_transparent
+  public static func .& (lhs: Self, rhs: Self) -> Self {
+    Self(rawValue: lhs.rawValue & rhs.rawValue)
+  }
+
+  /// The lanes set in either mask.
+  @_transparent
+  public static func .| (lhs: Self, rhs: Self) -> Self {
+    Self(rawValue: lhs.rawValue | rhs.rawValue)
+  }
+
+  /// The lanes set in exactly one of both masks.
+  @_transparent
+  public static func .^ (lhs: Self, rhs: Self) -> Self {
+    Self(rawValue: lhs.rawValue ^ rhs.rawValue)
+  }
+
+  /// The lanes not set in `operand`.
+  @_transparent
+  public static prefix func .! (operand: Self) -> Self {
+    Self(rawValue: ~operand.rawValue)
+  }
+}
+
+// MARK: - Comparison
+
+/// A SIMDX type that compares its elements lane by lane, to a mask of as many
+/// lanes.
+public protocol SIMDXLaneComparable: SIMDX where RawValue: SIMDXComparisonStorage {
+  associatedtype Mask: SIMDXMask where Mask.RawValue == RawValue.MaskStorage
+}
+
+extension SIMDXLaneComparable {
+  /// The lanes where `lhs == rhs`. A NaN element is never equal.
+  @_transparent
+  public static func .== (lhs: Self, rhs: Self) -> Mask {
+    Mask(rawValue: RawValue.compareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// The lanes where `lhs != rhs`. A NaN element is never equal.
+  @_transparent
+  public static func .!= (lhs: Self, rhs: Self) -> Mask {
+    .!(lhs .== rhs)
+  }
+
+  /// The lanes where `lhs < rhs`, never those of a NaN element.
+  @_transparent
+  public static func .< (lhs: Self, rhs: Self) -> Mask {
+    Mask(rawValue: RawValue.compareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// The lanes where `lhs <= rhs`, never those of a NaN element.
+  @_transparent
+  public static func .<= (lhs: Self, rhs: Self) -> Mask {
+    Mask(rawValue: RawValue.compareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// The lanes where `lhs > rhs`, never those of a NaN element.
+  @_transparent
+  public static func .> (lhs: Self, rhs: Self) -> Mask {
+    rhs .< lhs
+  }
+
+  /// The lanes where `lhs >= rhs`, never those of a NaN element.
+  @_transparent
+  public static func .>= (lhs: Self, rhs: Self) -> Mask {
+    rhs .<= lhs
+  }
+}
+
+// MARK: Comparison with Element
+extension SIMDXLaneComparable {
+  @_transparent
+  public static func .== (lhs: Self, rhs: Element) -> Mask {
+    lhs .== Self(rawValue: RawValue(repeating: rhs))
+  }
+
+  @_transparent
+  public static func .== (lhs: Element, rhs: Self) -> Mask {
+    Self(rawValue: RawValue(repeating: lhs)) .== rhs
+  }
+
+  @_transparent
+  public static func .!= (lhs: Self, rhs: Element) -> Mask {
+    lhs .!= Self(rawValue: RawValue(repeating: rhs))
+  }
+
+  @_transparent
+  public static func .!= (lhs: Element, rhs: Self) -> Mask {
+    Self(rawValue: RawValue(repeating: lhs)) .!= rhs
+  }
+
+  @_transparent
+  public static func .< (lhs: Self, rhs: Element) -> Mask {
+    lhs .< Self(rawValue: RawValue(repeating: rhs))
+  }
+
+  @_transparent
+  public static func .< (lhs: Element, rhs: Self) -> Mask {
+    Self(rawValue: RawValue(repeating: lhs)) .< rhs
+  }
+
+  @_transparent
+  public static func .<= (lhs: Self, rhs: Element) -> Mask {
+    lhs .<= Self(rawValue: RawValue(repeating: rhs))
+  }
+
+  @_transparent
+  public static func .<= (lhs: Element, rhs: Self) -> Mask {
+    Self(rawValue: RawValue(repeating: lhs)) .<= rhs
+  }
+
+  @_transparent
+  public static func .> (lhs: Self, rhs: Element) -> Mask {
+    lhs .> Self(rawValue: RawValue(repeating: rhs))
+  }
+
+  @_transparent
+  public static func .> (lhs: Element, rhs: Self) -> Mask {
+    Self(rawValue: RawValue(repeating: lhs)) .> rhs
+  }
+
+  @_transparent
+  public static func .>= (lhs: Self, rhs: Element) -> Mask {
+    lhs .>= Self(rawValue: RawValue(repeating: rhs))
+  }
+
+  @_transparent
+  public static func .>= (lhs: Element, rhs: Self) -> Mask {
+    Self(rawValue: RawValue(repeating: lhs)) .>= rhs
+  }
+}
+
+// MARK: - Replacing
+// The elements are selected by a single blend (SSE4.1) or bitwise select (NEON)
+// instruction, or by masking both values and combining them otherwise.
+extension SIMDXLaneComparable {
+  /// Returns the elements of `other` in the lanes set in `mask`, and the
+  /// elements of this value in the others.
+  @_transparent
+  public func replacing(with other: Self, where mask: Mask) -> Self {
+    Self(rawValue: RawValue.select(mask.rawValue, other.rawValue, rawValue))
+  }
+
+  /// Returns `other` in the lanes set in `mask`, and the elements of this
+  /// value in the others.
+  @_transparent
+  public func replacing(with other: Element, where mask: Mask) -> Self {
+    replacing(with: Self(rawValue: RawValue(repeating: other)), where: mask)
+  }
+
+  /// Replaces the elements in the lanes set in `mask` by those of `other`.
+  @_transparent
+  public mutating func replace(with other: Self, where mask: Mask) {
+    self = replacing(with: other, where: mask)
+  }
+
+  /// Replaces the elements in the lanes set in `mask` by `other`.
+  @_transparent
+  public mutating func replace(with other: Element, where mask: Mask) {
+    self = replacing(with: other, where: mask)
+  }
+}
+
+// MARK: - Masked Arithmetic
+// Both are computed for all lanes, and the lanes not set in the mask are
+// replaced by the elements of this value afterwards.
+extension SIMDXLaneComparable where RawValue: AdditiveArithmetic {
+  /// Returns the sum of this value and `other` in the lanes set in `mask`,
+  /// and the elements of this value in the others.
+  @_transparent
+  public func adding(_ other: Self, where mask: Mask) -> Self {
+    replacing(with: self + other, where: mask)
+  }
+}
+
+extension SIMDXLaneComparable where RawValue: Numeric {
+  /// Returns the product of this value and `other` in the lanes set in
+  /// `mask`, and the elements of this value in the others.
+  @_transparent
+  public func multiplied(by other: Self, where mask: Mask) -> Self {
+    replacing(with: self * other, where: mask)
+  }
+}
@@ -0,0 +1,27 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// A mask of 4 lanes, the result of comparing two `SIMDX4` lane by lane.
+public struct SIMDXMask4<Element>: SIMDXMask
+where Element: SIMDX4Element, Element.Storage4: SIMDXComparisonStorage {
+  public typealias RawValue = Element.Storage4.MaskStorage
+  public typealias ArrayLiteralElement = Bool
+
+  public var rawValue: RawValue
+
+  @_transparent
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
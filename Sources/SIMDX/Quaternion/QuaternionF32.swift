@@ -0,0 +1,195 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+
+/// A quaternion of single-precision floating-point components.
+///
+/// The quaternion wraps a `SIMDX4<Float32>`, that holds the imaginary parts in
+/// its first three lanes and the real part in its last lane. All operations
+/// are performed on the SIMD register and do not extract single lanes.
+public struct QuaternionF32: RawRepresentable {
+  public var rawValue: SIMDX4<Float32>
+
+  @_transparent
+  public init(rawValue: SIMDX4<Float32>) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Raw Storage
+extension QuaternionF32 {
+  @_transparent @usableFromInline
+  init(storage: CQuaternionF32) {
+    self.init(rawValue: SIMDX4(rawValue: Float32x4(rawValue: storage)))
+  }
+
+  @_transparent @usableFromInline
+  var storage: CQuaternionF32 {
+    rawValue.rawValue.rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension QuaternionF32 {
+  /// Initialize a quaternion to the specified components.
+  @_transparent
+  public init(_ x: Float32, _ y: Float32, _ z: Float32, _ w: Float32) {
+    self.init(storage: CQuaternionF32Make(x, y, z, w))
+  }
+
+  /// Initialize a quaternion to the specified imaginary and real parts.
+  @_transparent
+  public init(imaginary: SIMDX3<Float32>, real: Float32) {
+    self.init(storage: CQuaternionF32MakeWithImaginary(imaginary.rawValue.rawValue, real))
+  }
+
+  /// The multiplicative identity quaternion.
+  @_transparent
+  public static var identity: Self {
+    self.init(storage: CQuaternionF32MakeIdentity())
+  }
+}
+
+// MARK: - Components
+extension QuaternionF32 {
+  /// The real part of the quaternion.
+  @_transparent
+  public var real: Float32 {
+    CQuaternionF32GetReal(storage)
+  }
+
+  /// The imaginary parts of the quaternion.
+  @_transparent
+  public var imaginary: SIMDX3<Float32> {
+    SIMDX3(rawValue: Float32x3(rawValue: CQuaternionF32GetImaginary(storage)))
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension QuaternionF32: Equatable {}
+
+// MARK: - Arithmetics
+extension QuaternionF32 {
+  /// The conjugate of the quaternion, i.e. its imaginary parts negated.
+  @_transparent
+  public var conjugate: Self {
+    Self(storage: CQuaternionF32Conjugate(storage))
+  }
+
+  /// Returns the quaternion scaled to unit length.
+  @_transparent
+  public func normalized() -> Self {
+    Self(storage: CQuaternionF32Normalize(storage))
+  }
+
+  /// Returns the four-dimensional dot product of both quaternions.
+  @_transparent
+  public static func dot(_ lhs: Self, _ rhs: Self) -> Float32 {
+    CQuaternionF32Dot(lhs.storage, rhs.storage)
+  }
+
+  /// Returns the Hamilton product of both quaternions, i.e. the rotation `rhs`
+  /// followed by the rotation `lhs`.
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self {
+    Self(storage: CQuaternionF32Multiply(lhs.storage, rhs.storage))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+}
+
+// MARK: - Rotation
+extension QuaternionF32 {
+  /// Returns the vector rotated by this unit quaternion.
+  @_transparent
+  public func rotate(_ vector: SIMDX3<Float32>) -> SIMDX3<Float32> {
+    let rotated = CQuaternionF32RotateVector(storage, vector.rawValue.rawValue)
+    return SIMDX3(rawValue: Float32x3(rawValue: rotated))
+  }
+}
+
+// MARK: - Interpolation
+extension QuaternionF32 {
+  /// Linearly interpolates both quaternions along the shorter path and
+  /// normalizes the result.
+  @_transparent
+  public static func nlerp(from: Self, to: Self, t: Float32) -> Self {
+    Self(storage: CQuaternionF32NLerp(from.storage, to.storage, t))
+  }
+
+  /// Spherically interpolates both unit quaternions along the shorter path.
+  @_transparent
+  public static func slerp(from: Self, to: Self, t: Float32) -> Self {
+    Self(storage: CQuaternionF32Slerp(from.storage, to.storage, t))
+  }
+
+  /// Linearly interpolates each pair of quaternions along the shorter path,
+  /// i.e. `result[i] = nlerp(from: from[i], to: to[i], t: t[i])`.
+  ///
+  /// - Precondition: All buffers must be of the same length.
+  @inlinable
+  public static func nlerp(
+    from: UnsafeBufferPointer<Self>,
+    to: UnsafeBufferPointer<Self>,
+    t: UnsafeBufferPointer<Float32>,
+    into result: UnsafeMutableBufferPointer<Self>
+  ) {
+    precondition(from.count == to.count && to.count == t.count && t.count == result.count)
+    interpolate(from: from, to: to, t: t, into: result, using: CQuaternionF32NLerpBatch)
+  }
+
+  /// Spherically interpolates each pair of unit quaternions along the shorter
+  /// path, i.e. `result[i] = slerp(from: from[i], to: to[i], t: t[i])`.
+  ///
+  /// - Precondition: All buffers must be of the same length.
+  @inlinable
+  public static func slerp(
+    from: UnsafeBufferPointer<Self>,
+    to: UnsafeBufferPointer<Self>,
+    t: UnsafeBufferPointer<Float32>,
+    into result: UnsafeMutableBufferPointer<Self>
+  ) {
+    precondition(from.count == to.count && to.count == t.count && t.count == result.count)
+    interpolate(from: from, to: to, t: t, into: result, using: CQuaternionF32SlerpBatch)
+  }
+
+  /// Rebinds the quaternion buffers to their raw storage, which is of same
+  /// layout, and calls the batched C interpolation on them.
+  @inlinable
+  static func interpolate(
+    from: UnsafeBufferPointer<Self>,
+    to: UnsafeBufferPointer<Self>,
+    t: UnsafeBufferPointer<Float32>,
+    into result: UnsafeMutableBufferPointer<Self>,
+    using batch: (
+      UnsafePointer<CQuaternionF32>?,
+      UnsafePointer<CQuaternionF32>?,
+      UnsafePointer<Float32>?,
+      UnsafeMutablePointer<CQuaternionF32>?,
+      Int
+    ) -> Void
+  ) {
+    from.withMemoryRebound(to: CQuaternionF32.self) { from in
+      to.withMemoryRebound(to: CQuaternionF32.self) { to in
+        result.withMemoryRebound(to: CQuaternionF32.self) { result in
+          batch(from.baseAddress, to.baseAddress, t.baseAddress, result.baseAddress, result.count)
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,166 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+
+/// A random number generator running 4 independent xoshiro128+ generators,
+/// one per lane of a 128-bit vector.
+///
+/// The generator is not cryptographically secure. It is meant to produce
+/// many values of a `SIMDX4<Float32>` or bulk buffers at once. Use a separate
+/// instance for each thread, either with a distinct `stream` or by calling
+/// `jump()` on a copy, as it is a value type without any synchronisation.
+public struct Xoshiro128x4: RandomNumberGenerator {
+  @usableFromInline
+  var state: CXoshiro128x4
+
+  /// The upper half of the most recent vector, not yet returned by `next()`.
+  @usableFromInline
+  var pending: UInt64?
+
+  /// Initialize the generator from a `seed` and a `stream`, where each pair
+  /// results in a different sequence.
+  @inlinable
+  public init(seed: UInt64, stream: UInt64 = 0) {
+    self.state = CXoshiro128x4Make(seed, stream)
+    self.pending = nil
+  }
+
+  /// Initialize the generator from a seed drawn from the system generator.
+  @inlinable
+  public init() {
+    var generator = SystemRandomNumberGenerator()
+    self.init(seed: generator.next())
+  }
+
+  /// Advances the generator by 2^64 steps, to get a non-overlapping sequence.
+  @inlinable
+  public mutating func jump() {
+    CXoshiro128x4Jump(&state)
+    pending = nil
+  }
+}
+
+// MARK: - Conformance to RandomNumberGenerator
+extension Xoshiro128x4 {
+  @inlinable
+  public mutating func next() -> UInt64 {
+    if let value = pending {
+      pending = nil
+      return value
+    }
+    let next = CXoshiro128x4NextUInt32x4(&state)
+    pending = UInt64(CUInt32x4GetElement(next, 2)) << 32 | UInt64(CUInt32x4GetElement(next, 3))
+    return UInt64(CUInt32x4GetElement(next, 0)) << 32 | UInt64(CUInt32x4GetElement(next, 1))
+  }
+}
+
+// MARK: - Vector Generation
+extension Xoshiro128x4 {
+  /// Returns uniformly distributed values in `0 ..< 1`.
+  @_transparent
+  public mutating func nextUniform() -> SIMDX4<Float32> {
+    SIMDX4(rawValue: Float32x4(rawValue: CXoshiro128x4NextFloat32x4(&state)))
+  }
+
+  /// Returns standard normally distributed values, with a mean of 0 and a
+  /// standard deviation of 1.
+  @_transparent
+  public mutating func nextNormal() -> SIMDX4<Float32> {
+    SIMDX4(rawValue: Float32x4(rawValue: CXoshiro128x4NextNormalFloat32x4(&state, nil)))
+  }
+
+  /// Returns two sets of standard normally distributed values, generated at
+  /// the cost of one set.
+  @_transparent
+  public mutating func nextNormalPair() -> (SIMDX4<Float32>, SIMDX4<Float32>) {
+    var second = CFloat32x4MakeZero()
+    let first = CXoshiro128x4NextNormalFloat32x4(&state, &second)
+    return (
+      SIMDX4(rawValue: Float32x4(rawValue: first)),
+      SIMDX4(rawValue: Float32x4(rawValue: second))
+    )
+  }
+}
+
+// MARK: - Bulk Generation
+extension Xoshiro128x4 {
+  /// Fills `buffer` with uniformly distributed values.
+  @inlinable
+  public mutating func fill(_ buffer: UnsafeMutableBufferPointer<UInt32>) {
+    guard let baseAddress = buffer.baseAddress else { return }
+    CXoshiro128x4FillUInt32(&state, baseAddress, buffer.count)
+  }
+
+  /// Fills `buffer` with uniformly distributed values in `0 ..< 1`.
+  @inlinable
+  public mutating func fillUniform(_ buffer: UnsafeMutableBufferPointer<Float32>) {
+    guard let baseAddress = buffer.baseAddress else { return }
+    CXoshiro128x4FillFloat32(&state, baseAddress, buffer.count)
+  }
+
+  /// Fills `buffer` with standard normally distributed values.
+  @inlinable
+  public mutating func fillNormal(_ buffer: UnsafeMutableBufferPointer<Float32>) {
+    guard let baseAddress = buffer.baseAddress else { return }
+    CXoshiro128x4FillNormalFloat32(&state, baseAddress, buffer.count)
+  }
+}
+
+// MARK: - Random Instances
+extension SIMDX4 where Element == Float32 {
+  /// Returns a vector of values uniformly distributed in `range`.
+  ///
+  /// If `generator` is a `Xoshiro128x4`, all lanes are generated at once.
+  /// Otherwise two 64-bit values of `generator` provide 24 bits per lane.
+  @inlinable
+  public static func random<T: RandomNumberGenerator>(
+    in range: Range<Float32>,
+    using generator: inout T
+  ) -> Self {
+    precondition(!range.isEmpty, "Can't get random value with an empty range")
+    let delta = range.upperBound - range.lowerBound
+    precondition(delta.isFinite, "There is no uniform distribution on an infinite range")
+    let unit: CFloat32x4
+    if var vectorGenerator = generator as? Xoshiro128x4 {
+      unit = CXoshiro128x4NextFloat32x4(&vectorGenerator.state)
+      generator = vectorGenerator as! T
+    } else {
+      let lower = generator.next(), upper = generator.next()
+      let scale = Float32(1) / Float32(1 << 24)
+      unit = CFloat32x4Make(
+        Float32(lower >> 40) * scale,
+        Float32(lower >> 8 & 0xFFFFFF) * scale,
+        Float32(upper >> 40) * scale,
+        Float32(upper >> 8 & 0xFFFFFF) * scale
+      )
+    }
+    let value = CFloat32x4MultiplyAdd(
+      unit,
+      CFloat32x4MakeRepeatingElement(delta),
+      CFloat32x4MakeRepeatingElement(range.lowerBound)
+    )
+    // Rounding may map values just below 1 onto the excluded upper bound
+    let upperBound = CFloat32x4MakeRepeatingElement(range.upperBound.nextDown)
+    return SIMDX4(rawValue: Float32x4(rawValue: CFloat32x4Minimum(value, upperBound)))
+  }
+
+  /// Returns a vector of values uniformly distributed in `range`, using the
+  /// system's default random generator.
+  @inlinable
+  public static func random(in range: Range<Float32>) -> Self {
+    var generator = SystemRandomNumberGenerator()
+    return random(in: range, using: &generator)
+  }
+}
@@ -43,6 +43,52 @@ extension SIMDX/*: ExpressibleByArrayLiteral*/ {
   }
 }
 
+// MARK: - Loading
+// Contiguous elements are loaded in place by a single (unaligned) vector load,
+// without copying them or allocating any memory first.
+extension SIMDX {
+  /// Initialize to the elements of `buffer`.
+  ///
+  /// - Precondition: The buffer must contain exactly `count` elements.
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Element>) {
+    self.init(rawValue: RawValue(buffer))
+  }
+
+  /// Initialize to the `count` elements at `pointer`, which need not be
+  /// aligned. No element beyond these is read.
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Element>) {
+    self.init(rawValue: RawValue(loadingFrom: pointer))
+  }
+
+  /// Initialize to the elements of `slice`.
+  ///
+  /// - Precondition: The slice must contain exactly `count` elements.
+  @_transparent
+  public init(_ slice: ArraySlice<Element>) {
+    self.init(rawValue: RawValue(slice))
+  }
+
+  /// Initialize to the elements of `array`.
+  ///
+  /// - Precondition: The array must contain exactly `count` elements.
+  @_transparent
+  public init(_ array: ContiguousArray<Element>) {
+    self.init(rawValue: RawValue(array))
+  }
+
+  /// Initialize to the elements of `sequence`, which are loaded in place if
+  /// they are contiguous in memory, e.g. those of an `Array` or of a slice of
+  /// a buffer, and copied to an array first otherwise.
+  ///
+  /// - Precondition: The sequence must contain exactly `count` elements.
+  @inlinable
+  public init<Other: Sequence>(_ sequence: Other) where Other.Element == Element {
+    self.init(rawValue: RawValue(sequence))
+  }
+}
+
 // MARK: - Conformance to ExpressibleByIntegerLiteral
 extension SIMDX/*: ExpressibleByIntegerLiteral*/ where RawValue: ExpressibleByIntegerLiteral {
   public typealias IntegerLiteralType = RawValue.IntegerLiteralType
@@ -62,6 +108,15 @@ extension SIMDX/*: Equatable*/ where RawValue: Equatable {
   }
 }
 
+// MARK: - Conformance to Hashable
+extension SIMDX/*: Hashable*/ where RawValue: Hashable {
+  /// Hashes the elements of the storage, alike for values that are equal.
+  @inlinable
+  public func hash(into hasher: inout Hasher) {
+    rawValue.hash(into: &hasher)
+  }
+}
+
 // MARK: - Conformance to AdditiveArithmetic
 extension SIMDX/*: AdditiveArithmetic*/ where RawValue: AdditiveArithmetic {
   @_transparent
@@ -104,106 +159,395 @@ extension SIMDX/*: Numeric*/ where RawValue: Numeric {
   }
 }
 
-//// MARK: Binary Integer
-//
-//extension SIMDX where Storage: BinaryIntegerStorage {
-//
-//    /// A Boolean value indicating whether this storage contains signed integer types.
-//    @inlinable public static var isSigned: Bool { Storage.isSigned }
-//
-//    @inlinable public init?<Source>(
-//        exactly value: Source
-//    ) where Source: SIMDX, Source.Storage: NumericStorage, Source.Storage.Element: BinaryFloatingPoint {
-//        guard let rawValue = Storage.init(exactly: value.rawValue) else { return nil }
-//        self.init(rawValue: rawValue)
-//    }
-//
-//    @inlinable public init<Source>(
-//        _ value: Source
-//    ) where Source: SIMDX, Source.Storage: NumericStorage, Source.Storage.Element: BinaryFloatingPoint {
-//        self.init(rawValue: Storage.init(value.rawValue))
-//    }
-//
-//    @inlinable public init<Source>(
-//        _ value: Source
-//    ) where Source: SIMDX, Source.Storage: NumericStorage, Source.Storage.Element: BinaryInteger {
-//        self.init(rawValue: Storage.init(value.rawValue))
-//    }
-//
-//    @inlinable public init<Source>(
-//        truncatingIfNeeded value: Source
-//    ) where Source: SIMDX, Source.Storage: NumericStorage, Source.Storage.Element: BinaryInteger {
-//        self.init(rawValue: Storage.init(truncatingIfNeeded: value.rawValue))
-//    }
-//
-//    @inlinable public init<Source>(
-//        clamping value: Source
-//    ) where Source: SIMDX, Source.Storage: NumericStorage, Source.Storage.Element: BinaryInteger {
-//        self.init(rawValue: Storage.init(clamping: value.rawValue))
-//    }
-//
-//    @inlinable public prefix static func ~ (operand: Self) -> Self {
-//        .init(rawValue: ~(operand.rawValue))
-//    }
-//
-//    @inlinable public static func & (lhs: Self, rhs: Self) -> Self {
-//        .init(rawValue: lhs.rawValue & rhs.rawValue)
-//    }
-//
-//    @inlinable public static func &= (lhs: inout Self, rhs: Self) {
-//        lhs.rawValue &= rhs.rawValue
-//    }
-//
-//    @inlinable public static func | (lhs: Self, rhs: Self) -> Self {
-//        .init(rawValue: lhs.rawValue | rhs.rawValue)
-//    }
-//
-//    @inlinable public static func |= (lhs: inout Self, rhs: Self) {
-//        lhs.rawValue |= rhs.rawValue
-//    }
-//
-//    @inlinable public static func ^ (lhs: Self, rhs: Self) -> Self {
-//        .init(rawValue: lhs.rawValue ^ rhs.rawValue)
-//    }
-//
-//    @inlinable public static func ^= (lhs: inout Self, rhs: Self) {
-//        lhs.rawValue ^= rhs.rawValue
-//    }
-//
-//    @inlinable public static func >> <RHS>(lhs: Self, rhs: RHS) -> Self where RHS : BinaryInteger {
-//        .init(rawValue: lhs.rawValue >> rhs)
-//    }
-//
-//    @inlinable public static func >>= <RHS>(lhs: inout Self, rhs: RHS) where RHS : BinaryInteger {
-//        lhs.rawValue >>= rhs
-//    }
-//
-//    @inlinable public static func << <RHS>(lhs: Self, rhs: RHS) -> Self where RHS : BinaryInteger {
-//        .init(rawValue: lhs.rawValue << rhs)
-//    }
-//
-//    @inlinable public static func <<= <RHS>(lhs: inout Self, rhs: RHS) where RHS : BinaryInteger {
-//        lhs.rawValue <<= rhs
-//    }
-//}
-//
-//// MARK: Fixed Width Integer
-//
-//extension SIMDX where Storage: FixedWidthIntegerStorage {
-//
-//    /// The maximum representable integer in this type.
-//    ///
-//    /// For unsigned integer types, this value is `(2 ** bitWidth) - 1`, where
-//    /// `**` is exponentiation. For signed integer types, this value is `(2 ** (bitWidth - 1)) - 1`.
-//    @inlinable public static var max: Self { .init(rawValue: .max) }
-//
-//    /// The minimum representable integer in this type.
-//    ///
-//    /// For unsigned integer types, this value is always `0`. For signed integer
-//    /// types, this value is `-(2 ** (bitWidth - 1))`, where `**` is exponentiation.
-//    @inlinable public static var min: Self { .init(rawValue: .min) }
-//}
-//
+// MARK: - Scalar Arithmetic
+// The element is passed to the storage as is, which maps it to e.g. a multiply
+// by scalar instruction instead of initializing a storage repeating it first.
+extension SIMDX where RawValue: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: lhs.rawValue + rhs)
+  }
+
+  @_transparent
+  public static func + (lhs: Element, rhs: Self) -> Self {
+    self.init(rawValue: rhs.rawValue + lhs)
+  }
+
+  @_transparent
+  public static func += (lhs: inout Self, rhs: Element) {
+    lhs.rawValue = lhs.rawValue + rhs
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: lhs.rawValue - rhs)
+  }
+
+  @_transparent
+  public static func - (lhs: Element, rhs: Self) -> Self {
+    self.init(rawValue: RawValue(repeating: lhs) - rhs.rawValue)
+  }
+
+  @_transparent
+  public static func -= (lhs: inout Self, rhs: Element) {
+    lhs.rawValue = lhs.rawValue - rhs
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: lhs.rawValue * rhs)
+  }
+
+  @_transparent
+  public static func * (lhs: Element, rhs: Self) -> Self {
+    self.init(rawValue: rhs.rawValue * lhs)
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Element) {
+    lhs.rawValue = lhs.rawValue * rhs
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: lhs.rawValue / rhs)
+  }
+
+  @_transparent
+  public static func / (lhs: Element, rhs: Self) -> Self {
+    self.init(rawValue: RawValue(repeating: lhs) / rhs.rawValue)
+  }
+
+  @_transparent
+  public static func /= (lhs: inout Self, rhs: Element) {
+    lhs.rawValue = lhs.rawValue / rhs
+  }
+
+  /// Returns the sum of this value and the product of `lhs` and `rhs`,
+  /// computed with a single rounding if the target has a fused multiply-add.
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: rawValue.addingProduct(lhs.rawValue, rhs))
+  }
+
+  /// Adds the product of `lhs` and `rhs` to this value, computed with a
+  /// single rounding if the target has a fused multiply-add.
+  @_transparent
+  public mutating func addProduct(_ lhs: Self, _ rhs: Element) {
+    rawValue = rawValue.addingProduct(lhs.rawValue, rhs)
+  }
+}
+
+// MARK: - Binary Integer
+extension SIMDX where RawValue: SIMDXBinaryIntegerStorage {
+  /// A Boolean value indicating whether the elements are signed integers.
+  @_transparent
+  public static var isSigned: Bool {
+    RawValue.Element.isSigned
+  }
+
+  @_transparent
+  public prefix static func ~ (operand: Self) -> Self {
+    self.init(rawValue: ~operand.rawValue)
+  }
+
+  @_transparent
+  public static func & (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: lhs.rawValue & rhs.rawValue)
+  }
+
+  @_transparent
+  public static func &= (lhs: inout Self, rhs: Self) {
+    lhs.rawValue = lhs.rawValue & rhs.rawValue
+  }
+
+  @_transparent
+  public static func | (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: lhs.rawValue | rhs.rawValue)
+  }
+
+  @_transparent
+  public static func |= (lhs: inout Self, rhs: Self) {
+    lhs.rawValue = lhs.rawValue | rhs.rawValue
+  }
+
+  @_transparent
+  public static func ^ (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: lhs.rawValue ^ rhs.rawValue)
+  }
+
+  @_transparent
+  public static func ^= (lhs: inout Self, rhs: Self) {
+    lhs.rawValue = lhs.rawValue ^ rhs.rawValue
+  }
+
+  @_transparent
+  public static func >> <RHS: BinaryInteger>(lhs: Self, rhs: RHS) -> Self {
+    self.init(rawValue: lhs.rawValue >> rhs)
+  }
+
+  @_transparent
+  public static func >>= <RHS: BinaryInteger>(lhs: inout Self, rhs: RHS) {
+    lhs.rawValue = lhs.rawValue >> rhs
+  }
+
+  @_transparent
+  public static func << <RHS: BinaryInteger>(lhs: Self, rhs: RHS) -> Self {
+    self.init(rawValue: lhs.rawValue << rhs)
+  }
+
+  @_transparent
+  public static func <<= <RHS: BinaryInteger>(lhs: inout Self, rhs: RHS) {
+    lhs.rawValue = lhs.rawValue << rhs
+  }
+}
+
+// MARK: - Fixed Width Integer
+extension SIMDX where RawValue: SIMDXFixedWidthIntegerStorage {
+  /// The maximum representable integer in each element.
+  ///
+  /// For unsigned integer types, this value is `(2 ** bitWidth) - 1`, where
+  /// `**` is exponentiation. For signed integer types, this value is `(2 ** (bitWidth - 1)) - 1`.
+  @_transparent
+  public static var max: Self {
+    self.init(rawValue: RawValue(repeating: RawValue.Element.max))
+  }
+
+  /// The minimum representable integer in each element.
+  ///
+  /// For unsigned integer types, this value is always `0`. For signed integer
+  /// types, this value is `-(2 ** (bitWidth - 1))`, where `**` is exponentiation.
+  @_transparent
+  public static var min: Self {
+    self.init(rawValue: RawValue(repeating: RawValue.Element.min))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: lhs.rawValue >> rhs.rawValue)
+  }
+
+  @_transparent
+  public static func >>= (lhs: inout Self, rhs: Self) {
+    lhs.rawValue = lhs.rawValue >> rhs.rawValue
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: lhs.rawValue << rhs.rawValue)
+  }
+
+  @_transparent
+  public static func <<= (lhs: inout Self, rhs: Self) {
+    lhs.rawValue = lhs.rawValue << rhs.rawValue
+  }
+
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: Self {
+    Self(rawValue: rawValue.nonzeroBitCount)
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: Self {
+    Self(rawValue: rawValue.leadingZeroBitCount)
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: Self {
+    Self(rawValue: rawValue.trailingZeroBitCount)
+  }
+
+  /// The value with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: Self {
+    Self(rawValue: rawValue.byteSwapped)
+  }
+
+  /// The value with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: Self {
+    Self(rawValue: rawValue.bitReversed)
+  }
+}
+
+// MARK: - Reduction
+// The elements are folded within the registers, by combining the upper half of
+// the storage with its lower half until a single element is left.
+extension SIMDX where RawValue: SIMDXReduction {
+  /// Returns the sum of all elements.
+  @_transparent
+  public func sum() -> Element {
+    rawValue.sum()
+  }
+
+  /// Returns the least element. Whether a NaN element is returned depends on its lane.
+  @_transparent
+  public func minimum() -> Element {
+    rawValue.minimum()
+  }
+
+  /// Returns the greatest element. Whether a NaN element is returned depends on its lane.
+  @_transparent
+  public func maximum() -> Element {
+    rawValue.maximum()
+  }
+}
+
+// MARK: - Minimum & Maximum
+
+/// How the lane-wise minimum and maximum of floating-point elements treat NaN
+/// and signed zero elements.
+public enum SIMDXMinMaxSemantics {
+  /// The semantics of the single minimum and maximum instruction of the
+  /// target. On x86 (`minps`, `maxps`), a lane is the second operand if either
+  /// element is NaN or both are zero. On Arm (`fmin`, `fmax`), a lane is NaN
+  /// if either element is NaN, and -0.0 is less than +0.0.
+  case hardware
+
+  /// The IEEE 754-2019 `minimum` and `maximum` operations, i.e. a lane is NaN
+  /// if either element is NaN, and -0.0 is less than +0.0, on every target.
+  /// These are a single instruction on Arm as well, but take three (minimum)
+  /// or five (maximum) instructions on x86, partly executed in parallel.
+  case ieee754
+}
+
+extension SIMDX where RawValue: SIMDXMinMaxStorage {
+  /// Returns the lesser element of each lane, by a single instruction. See
+  /// `SIMDXMinMaxSemantics.hardware` for the lanes of NaN and zero elements.
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: RawValue.min(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Returns the greater element of each lane, by a single instruction. See
+  /// `SIMDXMinMaxSemantics.hardware` for the lanes of NaN and zero elements.
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: RawValue.max(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Returns the absolute value of each element, by a single instruction (or
+  /// three for integers on x86 without SSSE3). The minimum of a signed
+  /// integer element wraps around to itself, just like `&-` does.
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: RawValue.abs(operand.rawValue))
+  }
+
+  /// Returns each element limited to the range of the bounds in its lane, by
+  /// two instructions. A NaN element stays NaN, and a NaN bound is ignored on
+  /// x86.
+  @_transparent
+  public func clamped(lowerBound: Self, upperBound: Self) -> Self {
+    // The element is the second operand to either, which x86 returns if NaN
+    Self.max(lowerBound, Self.min(upperBound, self))
+  }
+
+  /// Returns each element limited to the range from `lowerBound` through
+  /// `upperBound`, by two instructions. A NaN element stays NaN.
+  @_transparent
+  public func clamped(lowerBound: Element, upperBound: Element) -> Self {
+    clamped(
+      lowerBound: Self(rawValue: RawValue(repeating: lowerBound)),
+      upperBound: Self(rawValue: RawValue(repeating: upperBound))
+    )
+  }
+
+  /// Limits each element to the range of the bounds in its lane.
+  @_transparent
+  public mutating func clamp(lowerBound: Self, upperBound: Self) {
+    self = clamped(lowerBound: lowerBound, upperBound: upperBound)
+  }
+
+  /// Limits each element to the range from `lowerBound` through `upperBound`.
+  @_transparent
+  public mutating func clamp(lowerBound: Element, upperBound: Element) {
+    self = clamped(lowerBound: lowerBound, upperBound: upperBound)
+  }
+}
+
+// The semantics are a constant in almost any call, in which case the switch is
+// resolved once the function is inlined.
+extension SIMDX where RawValue: SIMDXIEEEMinMaxStorage {
+  /// Returns the lesser element of each lane, by the given `semantics`.
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self, semantics: SIMDXMinMaxSemantics) -> Self {
+    switch semantics {
+    case .hardware: return self.init(rawValue: RawValue.min(lhs.rawValue, rhs.rawValue))
+    case .ieee754: return self.init(rawValue: RawValue.minimum(lhs.rawValue, rhs.rawValue))
+    }
+  }
+
+  /// Returns the greater element of each lane, by the given `semantics`.
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self, semantics: SIMDXMinMaxSemantics) -> Self {
+    switch semantics {
+    case .hardware: return self.init(rawValue: RawValue.max(lhs.rawValue, rhs.rawValue))
+    case .ieee754: return self.init(rawValue: RawValue.maximum(lhs.rawValue, rhs.rawValue))
+    }
+  }
+
+  /// Returns each element limited to the range of the bounds in its lane, by
+  /// the given `semantics`. A NaN element stays NaN with either, and a NaN
+  /// bound results in NaN by `.ieee754`.
+  @_transparent
+  public func clamped(
+    lowerBound: Self,
+    upperBound: Self,
+    semantics: SIMDXMinMaxSemantics
+  ) -> Self {
+    Self.max(lowerBound, Self.min(upperBound, self, semantics: semantics), semantics: semantics)
+  }
+
+  /// Returns each element limited to the range from `lowerBound` through
+  /// `upperBound`, by the given `semantics`.
+  @_transparent
+  public func clamped(
+    lowerBound: Element,
+    upperBound: Element,
+    semantics: SIMDXMinMaxSemantics
+  ) -> Self {
+    clamped(
+      lowerBound: Self(rawValue: RawValue(repeating: lowerBound)),
+      upperBound: Self(rawValue: RawValue(repeating: upperBound)),
+      semantics: semantics
+    )
+  }
+
+  /// Limits each element to the range of the bounds in its lane, by the given
+  /// `semantics`.
+  @_transparent
+  public mutating func clamp(lowerBound: Self, upperBound: Self, semantics: SIMDXMinMaxSemantics) {
+    self = clamped(lowerBound: lowerBound, upperBound: upperBound, semantics: semantics)
+  }
+
+  /// Limits each element to the range from `lowerBound` through `upperBound`,
+  /// by the given `semantics`.
+  @_transparent
+  public mutating func clamp(lowerBound: Element, upperBound: Element, semantics: SIMDXMinMaxSemantics) {
+    self = clamped(lowerBound: lowerBound, upperBound: upperBound, semantics: semantics)
+  }
+}
+
+// MARK: - Bit Pattern
+// The bits are reinterpreted in the register they are held in, so that neither
+// converts any element nor copies it through memory.
+extension SIMDX where RawValue: SIMDXBitPatternStorage {
+  /// Creates a storage of the bits of `other`, reinterpreted lane by lane as
+  /// the element of this storage, e.g. the IEEE 754 bits of a `Float32` as
+  /// `UInt32`, or back.
+  @_transparent
+  public init<Other: SIMDX>(bitPattern other: Other)
+  where Other.RawValue: SIMDXBitPatternStorage, Other.RawValue.BitPattern == RawValue.BitPattern {
+    self.init(rawValue: RawValue(bitPattern: other.rawValue.bitPattern))
+  }
+}
+
 //// MARK: Floating Point
 //
 //extension SIMDX where Storage: FloatingPointStorage {
@@ -0,0 +1,112 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import RealModule
+
+/// A SIMD storage to 16 elements
+public struct SIMDX16<Element>: SIMDX where Element: SIMDX16Element {
+  public typealias RawValue = Element.Storage16
+  public typealias Index = RawValue.Index
+
+  public var rawValue: RawValue
+
+  @_transparent
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Bridging to SIMD
+extension SIMDX16 where Element: SIMDScalar {
+  /// Initialize to the elements of a standard library `SIMD16`, by
+  /// reinterpreting its bits, which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMD16<Element>) {
+    self.init(rawValue: RawValue(bitCasting: vector))
+  }
+}
+
+extension SIMD16 where Scalar: SIMDX16Element {
+  /// Initialize to the elements of a `SIMDX16`, by reinterpreting its bits,
+  /// which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMDX16<Scalar>) {
+    self = vector.rawValue.bitCast(to: Self.self)
+  }
+}
+
+// MARK: - Conformance to (Mutable|RandomAccess)Collection
+extension SIMDX16 {
+  @_transparent
+  public var startIndex: Index {
+    rawValue.startIndex
+  }
+
+  @_transparent
+  public var endIndex: Index {
+    rawValue.endIndex
+  }
+
+  @_transparent
+  public func index(before i: RawValue.Index) -> RawValue.Index {
+    rawValue.index(before: i)
+  }
+
+  @_transparent
+  public func index(after i: RawValue.Index) -> RawValue.Index {
+    rawValue.index(after: i)
+  }
+}
+
+// MARK: - Conformance to ExpressibleBy(Array|Integer)Literal
+extension SIMDX16: ExpressibleByArrayLiteral {}
+extension SIMDX16: ExpressibleByIntegerLiteral where RawValue: ExpressibleByIntegerLiteral {}
+
+// MARK: - Conformance to Numerics Type
+extension SIMDX16: Equatable where RawValue: Equatable {}
+extension SIMDX16: Hashable where RawValue: Hashable {}
+extension SIMDX16: AdditiveArithmetic where RawValue: AdditiveArithmetic {}
+extension SIMDX16: Numeric where RawValue: Numeric {}
+
+// MARK: - Conformance to SIMDXLaneComparable
+extension SIMDX16: SIMDXLaneComparable where RawValue: SIMDXComparisonStorage {
+  public typealias Mask = SIMDXMask16<Element>
+}
+
+// NOTE:
+// Implementation details of SignedNumeric and AlgebraicField can not be
+// define in the SIMDX protocol for all its conforming types, as the standard
+// library does provide default implementations for these operations as well.
+extension SIMDX16: SignedNumeric where RawValue: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: -(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue.negate()
+  }
+}
+
+extension SIMDX16: AlgebraicField where RawValue: AlgebraicField {
+  @_transparent
+  public static func / (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: lhs.rawValue / rhs.rawValue)
+  }
+
+  public static func /= (lhs: inout Self, rhs: Self) {
+    lhs = lhs / rhs
+  }
+}
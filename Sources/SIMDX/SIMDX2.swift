@@ -36,6 +36,25 @@ extension SIMDX2 {
   }
 }
 
+// MARK: - Bridging to SIMD
+extension SIMDX2 where Element: SIMDScalar {
+  /// Initialize to the elements of a standard library `SIMD2`, by
+  /// reinterpreting its bits, which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMD2<Element>) {
+    self.init(rawValue: RawValue(bitCasting: vector))
+  }
+}
+
+extension SIMD2 where Scalar: SIMDX2Element {
+  /// Initialize to the elements of a `SIMDX2`, by reinterpreting its bits,
+  /// which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMDX2<Scalar>) {
+    self = vector.rawValue.bitCast(to: Self.self)
+  }
+}
+
 // MARK: - Conformance to (Mutable|RandomAccess)Collection
 extension SIMDX2 {
   @_transparent
@@ -65,9 +84,15 @@ extension SIMDX2: ExpressibleByIntegerLiteral where RawValue: ExpressibleByInteg
 
 // MARK: - Conformance to Numerics Type
 extension SIMDX2: Equatable where RawValue: Equatable {}
+extension SIMDX2: Hashable where RawValue: Hashable {}
 extension SIMDX2: AdditiveArithmetic where RawValue: AdditiveArithmetic {}
 extension SIMDX2: Numeric where RawValue: Numeric {}
 
+// MARK: - Conformance to SIMDXLaneComparable
+extension SIMDX2: SIMDXLaneComparable where RawValue: SIMDXComparisonStorage {
+  public typealias Mask = SIMDXMask2<Element>
+}
+
 // NOTE:
 // Implementation details of SignedNumeric and AlgebraicField can not be
 // define in the SIMDX protocol for all its conforming types, as the standard
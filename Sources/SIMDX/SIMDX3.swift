@@ -36,6 +36,28 @@ extension SIMDX3 {
   }
 }
 
+// MARK: - Bridging to SIMD
+extension SIMDX3 where Element: SIMDScalar {
+  /// Initialize to the elements of a standard library `SIMD3`, by
+  /// reinterpreting its bits, which compiles to no instructions.
+  ///
+  /// The unused fourth lane of the storage takes whatever the padding of
+  /// `vector` holds, which no operation reads.
+  @_transparent
+  public init(_ vector: SIMD3<Element>) {
+    self.init(rawValue: RawValue(bitCasting: vector))
+  }
+}
+
+extension SIMD3 where Scalar: SIMDX3Element {
+  /// Initialize to the elements of a `SIMDX3`, by reinterpreting its bits,
+  /// which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMDX3<Scalar>) {
+    self = vector.rawValue.bitCast(to: Self.self)
+  }
+}
+
 // MARK: - Conformance to (Mutable|RandomAccess)Collection
 extension SIMDX3 {
   @_transparent
@@ -65,9 +87,15 @@ extension SIMDX3: ExpressibleByIntegerLiteral where RawValue: ExpressibleByInteg
 
 // MARK: - Conformance to Numerics Type
 extension SIMDX3: Equatable where RawValue: Equatable {}
+extension SIMDX3: Hashable where RawValue: Hashable {}
 extension SIMDX3: AdditiveArithmetic where RawValue: AdditiveArithmetic {}
 extension SIMDX3: Numeric where RawValue: Numeric {}
 
+// MARK: - Conformance to SIMDXLaneComparable
+extension SIMDX3: SIMDXLaneComparable where RawValue: SIMDXComparisonStorage {
+  public typealias Mask = SIMDXMask3<Element>
+}
+
 // NOTE:
 // Implementation details of SignedNumeric and AlgebraicField can not be
 // define in the SIMDX protocol for all its conforming types, as the standard
@@ -94,3 +122,66 @@ extension SIMDX3: AlgebraicField where RawValue: AlgebraicField {
     lhs = lhs / rhs
   }
 }
+
+// MARK: - Geometry
+extension SIMDX3 where RawValue: SIMDX3GeometricStorage {
+  /// Returns the dot product of both vectors.
+  @_transparent
+  public static func dot(_ lhs: Self, _ rhs: Self) -> Element {
+    RawValue.dot(lhs.rawValue, rhs.rawValue)
+  }
+
+  /// Returns the cross product of both vectors.
+  @_transparent
+  public static func cross(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: RawValue.cross(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Returns the distance between both vectors, interpreted as points.
+  @_transparent
+  public static func distance(_ lhs: Self, _ rhs: Self) -> Element {
+    RawValue.distance(lhs.rawValue, rhs.rawValue)
+  }
+
+  /// The length of the vector.
+  @_transparent
+  public var length: Element {
+    rawValue.length
+  }
+
+  /// The squared length of the vector, avoiding the square root of `length`.
+  @_transparent
+  public var lengthSquared: Element {
+    rawValue.lengthSquared
+  }
+
+  /// Returns the vector scaled to unit length.
+  @_transparent
+  public func normalized() -> Self {
+    Self(rawValue: rawValue.normalized())
+  }
+
+  /// Returns the vector scaled to approximately unit length.
+  ///
+  /// Uses a reciprocal square root estimate, refined by Newton-Raphson steps,
+  /// in place of a square root and a division. Prefer `normalized()` where
+  /// the result must be correctly rounded.
+  @_transparent
+  public func fastNormalized() -> Self {
+    Self(rawValue: rawValue.fastNormalized())
+  }
+
+  /// Returns the vector reflected off the surface with given `normal`.
+  ///
+  /// - Parameter normal: The surface normal, expected to be of unit length.
+  @_transparent
+  public func reflected(off normal: Self) -> Self {
+    Self(rawValue: rawValue.reflected(off: normal.rawValue))
+  }
+
+  /// Returns the vector projected onto the direction of `other`.
+  @_transparent
+  public func projected(onto other: Self) -> Self {
+    Self(rawValue: rawValue.projected(onto: other.rawValue))
+  }
+}
@@ -41,6 +41,25 @@ extension SIMDX4 {
   }
 }
 
+// MARK: - Bridging to SIMD
+extension SIMDX4 where Element: SIMDScalar {
+  /// Initialize to the elements of a standard library `SIMD4`, by
+  /// reinterpreting its bits, which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMD4<Element>) {
+    self.init(rawValue: RawValue(bitCasting: vector))
+  }
+}
+
+extension SIMD4 where Scalar: SIMDX4Element {
+  /// Initialize to the elements of a `SIMDX4`, by reinterpreting its bits,
+  /// which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMDX4<Scalar>) {
+    self = vector.rawValue.bitCast(to: Self.self)
+  }
+}
+
 // MARK: - Conformance to (Mutable|RandomAccess)Collection
 extension SIMDX4 {
   @_transparent
@@ -70,9 +89,15 @@ extension SIMDX4: ExpressibleByIntegerLiteral where RawValue: ExpressibleByInteg
 
 // MARK: - Conformance to Numerics Type
 extension SIMDX4: Equatable where RawValue: Equatable {}
+extension SIMDX4: Hashable where RawValue: Hashable {}
 extension SIMDX4: AdditiveArithmetic where RawValue: AdditiveArithmetic {}
 extension SIMDX4: Numeric where RawValue: Numeric {}
 
+// MARK: - Conformance to SIMDXLaneComparable
+extension SIMDX4: SIMDXLaneComparable where RawValue: SIMDXComparisonStorage {
+  public typealias Mask = SIMDXMask4<Element>
+}
+
 // NOTE:
 // Implementation details of SignedNumeric and AlgebraicField can not be
 // define in the SIMDX protocol for all its conforming types, as the standard
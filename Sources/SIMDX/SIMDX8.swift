@@ -0,0 +1,133 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import RealModule
+
+/// A SIMD storage to 8 elements
+public struct SIMDX8<Element>: SIMDX where Element: SIMDX8Element {
+  public typealias RawValue = Element.Storage8
+  public typealias Index = RawValue.Index
+
+  public var rawValue: RawValue
+
+  @_transparent
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializer
+extension SIMDX8 {
+  /// Initialize a raw SIMD storage to specified elements.
+  @_transparent
+  public init(
+    _ element0: Element,
+    _ element1: Element,
+    _ element2: Element,
+    _ element3: Element,
+    _ element4: Element,
+    _ element5: Element,
+    _ element6: Element,
+    _ element7: Element
+  ) {
+    self.init(rawValue: RawValue(
+      element0, element1, element2, element3,
+      element4, element5, element6, element7
+    ))
+  }
+}
+
+// MARK: - Bridging to SIMD
+extension SIMDX8 where Element: SIMDScalar {
+  /// Initialize to the elements of a standard library `SIMD8`, by
+  /// reinterpreting its bits, which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMD8<Element>) {
+    self.init(rawValue: RawValue(bitCasting: vector))
+  }
+}
+
+extension SIMD8 where Scalar: SIMDX8Element {
+  /// Initialize to the elements of a `SIMDX8`, by reinterpreting its bits,
+  /// which compiles to no instructions.
+  @_transparent
+  public init(_ vector: SIMDX8<Scalar>) {
+    self = vector.rawValue.bitCast(to: Self.self)
+  }
+}
+
+// MARK: - Conformance to (Mutable|RandomAccess)Collection
+extension SIMDX8 {
+  @_transparent
+  public var startIndex: Index {
+    rawValue.startIndex
+  }
+
+  @_transparent
+  public var endIndex: Index {
+    rawValue.endIndex
+  }
+
+  @_transparent
+  public func index(before i: RawValue.Index) -> RawValue.Index {
+    rawValue.index(before: i)
+  }
+
+  @_transparent
+  public func index(after i: RawValue.Index) -> RawValue.Index {
+    rawValue.index(after: i)
+  }
+}
+
+// MARK: - Conformance to ExpressibleBy(Array|Integer)Literal
+extension SIMDX8: ExpressibleByArrayLiteral {}
+extension SIMDX8: ExpressibleByIntegerLiteral where RawValue: ExpressibleByIntegerLiteral {}
+
+// MARK: - Conformance to Numerics Type
+extension SIMDX8: Equatable where RawValue: Equatable {}
+extension SIMDX8: Hashable where RawValue: Hashable {}
+extension SIMDX8: AdditiveArithmetic where RawValue: AdditiveArithmetic {}
+extension SIMDX8: Numeric where RawValue: Numeric {}
+
+// MARK: - Conformance to SIMDXLaneComparable
+extension SIMDX8: SIMDXLaneComparable where RawValue: SIMDXComparisonStorage {
+  public typealias Mask = SIMDXMask8<Element>
+}
+
+// NOTE:
+// Implementation details of SignedNumeric and AlgebraicField can not be
+// define in the SIMDX protocol for all its conforming types, as the standard
+// library does provide default implementations for these operations as well.
+extension SIMDX8: SignedNumeric where RawValue: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: -(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue.negate()
+  }
+}
+
+extension SIMDX8: AlgebraicField where RawValue: AlgebraicField {
+  @_transparent
+  public static func / (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: lhs.rawValue / rhs.rawValue)
+  }
+
+  public static func /= (lhs: inout Self, rhs: Self) {
+    lhs = lhs / rhs
+  }
+}
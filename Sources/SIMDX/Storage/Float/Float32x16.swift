@@ -0,0 +1,273 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct Float32x16: SIMDXStorage, SIMDX16Storage {
+  public typealias RawValue = CFloat32x16
+  public typealias Element = Float32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension Float32x16 {
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CFloat32x16MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [Float32]) {
+    precondition(array.count == 16, "Array must contain exactly 16 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float32>) {
+    precondition(buffer.count == 16, "Buffer must contain exactly 16 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float32>) {
+    self.init(rawValue: CFloat32x16MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension Float32x16 {
+  public typealias Index = CInt
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat32x16ExtractLane`/`CFloat32x16InsertLane` operate within the register.
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      rawValue = CFloat32x16InsertLane(rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CFloat32x16ExtractLane(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension Float32x16: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CFloat32x16Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension Float32x16: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: CFloat32x16Canonicalize(rawValue), into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension Float32x16: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CFloat32x16MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x16Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat32x16Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension Float32x16: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    CFloat32x16ReduceMaximum(CFloat32x16Magnitude(rawValue))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat32x16Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CFloat32x16MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformace to SignedNumeric
+extension Float32x16: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: CFloat32x16Negate(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue = CFloat32x16Negate(rawValue)
+  }
+}
+
+// MARK: - Conformance to AlgebraicField
+extension Float32x16: AlgebraicField {
+  @_transparent
+  public static func / (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat32x16Divide(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func /= (lhs: inout Self, rhs: Self) {
+    lhs = lhs / rhs
+  }
+}
+
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float32x16: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x16AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x16SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x16MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x16DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat32x16MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat32x16MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXReduction
+extension Float32x16: SIMDXReduction {
+  @_transparent
+  public func sum() -> Element {
+    CFloat32x16ReduceAdd(rawValue)
+  }
+
+  @_transparent
+  public func minimum() -> Element {
+    CFloat32x16ReduceMinimum(rawValue)
+  }
+
+  @_transparent
+  public func maximum() -> Element {
+    CFloat32x16ReduceMaximum(rawValue)
+  }
+}
+
+// MARK: - Conformance to ElementaryFunctions
+// TODO: These are not yet exposed to SIMDX
+extension Float32x16/*: ElementaryFunctions*/ {
+  @_transparent
+  static func sqrt(_ x: Self) -> Self {
+    self.init(rawValue: CFloat32x16SquareRoot(x.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Float32x16: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x16
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x16CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x16CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x16CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CFloat32x16Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float32x16: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x16Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x16Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat32x16Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x16IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x16IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
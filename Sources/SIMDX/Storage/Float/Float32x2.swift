@@ -43,21 +43,33 @@ extension Float32x2: ExpressibleByIntegerLiteral {
   @_transparent
   public init(_ array: [Float32]) {
     precondition(array.count == 2, "Array must contain exactly 2 elements")
-    var array = array
-    self.init(rawValue: CFloat32x2MakeLoad(&array))
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float32>) {
+    precondition(buffer.count == 2, "Buffer must contain exactly 2 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float32>) {
+    self.init(rawValue: CFloat32x2MakeLoad(pointer))
   }
 }
 
 // MARK: - Conformance to MutableCollection
 extension Float32x2 {
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat32x2ExtractLane`/`CFloat32x2InsertLane` operate within the register.
   public subscript(index: Index) -> Element {
     @_transparent set {
       precondition(indices.contains(index))
-      CFloat32x2SetElement(&rawValue, index, newValue)
+      rawValue = CFloat32x2InsertLane(rawValue, index, newValue)
     }
     @_transparent get {
       precondition(indices.contains(index))
-      return CFloat32x2GetElement(rawValue, index)
+      return CFloat32x2ExtractLane(rawValue, index)
     }
   }
 }
@@ -66,15 +78,16 @@ extension Float32x2 {
 extension Float32x2: Equatable {
   @_transparent
   public static func == (lhs: Self, rhs: Self) -> Bool {
-    lhs.indices.allSatisfy { lhs[$0] == rhs[$0] }
+    CFloat32x2Equal(lhs.rawValue, rhs.rawValue)
   }
 }
 
 // MARK: - Conformance to Hashable
 extension Float32x2: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(CFloat32x2GetElement(rawValue, 0))
-    hasher.combine(CFloat32x2GetElement(rawValue, 1))
+    combineElements(of: CFloat32x2Canonicalize(rawValue), into: &hasher)
   }
 }
 
@@ -151,6 +164,39 @@ extension Float32x2: AlgebraicField {
   }
 }
 
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float32x2: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x2AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x2SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x2MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x2DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat32x2MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat32x2MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
 // MARK: - Conformance to ElementaryFunctions
 // TODO: These are not yet exposed to SIMDX
 extension Float32x2/*: ElementaryFunctions*/ {
@@ -159,3 +205,71 @@ extension Float32x2/*: ElementaryFunctions*/ {
     self.init(rawValue: CFloat32x2SquareRoot(x.rawValue))
   }
 }
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Float32x2: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x2
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x2CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x2CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x2CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CFloat32x2Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float32x2: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x2Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x2Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat32x2Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x2IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x2IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension Float32x2: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x2) {
+    self.init(rawValue: CUInt32x2ReinterpretAsCFloat32x2(bitPattern.rawValue))
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x2 {
+    UInt32x2(rawValue: CFloat32x2ReinterpretAsCUInt32x2(rawValue))
+  }
+}
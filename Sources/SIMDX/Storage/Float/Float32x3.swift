@@ -43,8 +43,18 @@ extension Float32x3: ExpressibleByIntegerLiteral {
   @_transparent
   public init(_ array: [Float32]) {
     precondition(array.count == 3, "Array must contain exactly 3 elements")
-    var array = array
-    self.init(rawValue: CFloat32x3MakeLoad(&array))
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float32>) {
+    precondition(buffer.count == 3, "Buffer must contain exactly 3 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float32>) {
+    self.init(rawValue: CFloat32x3MakeLoad(pointer))
   }
 }
 
@@ -52,14 +62,16 @@ extension Float32x3: ExpressibleByIntegerLiteral {
 extension Float32x3 {
   public typealias Index = CInt
 
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat32x3ExtractLane`/`CFloat32x3InsertLane` operate within the register.
   public subscript(index: Index) -> Element {
     @_transparent set {
       precondition(indices.contains(index))
-      CFloat32x3SetElement(&rawValue, index, newValue)
+      rawValue = CFloat32x3InsertLane(rawValue, index, newValue)
     }
     @_transparent get {
       precondition(indices.contains(index))
-      return CFloat32x3GetElement(rawValue, index)
+      return CFloat32x3ExtractLane(rawValue, index)
     }
   }
 }
@@ -68,16 +80,16 @@ extension Float32x3 {
 extension Float32x3: Equatable {
   @_transparent
   public static func == (lhs: Self, rhs: Self) -> Bool {
-    lhs.indices.allSatisfy { lhs[$0] == rhs[$0] }
+    CFloat32x3Equal(lhs.rawValue, rhs.rawValue)
   }
 }
 
 // MARK: - Conformance to Hashable
 extension Float32x3: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(CFloat32x3GetElement(rawValue, 0))
-    hasher.combine(CFloat32x3GetElement(rawValue, 1))
-    hasher.combine(CFloat32x3GetElement(rawValue, 2))
+    combineElements(of: CFloat32x3Canonicalize(rawValue), into: &hasher)
   }
 }
 
@@ -154,6 +166,39 @@ extension Float32x3: AlgebraicField {
   }
 }
 
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float32x3: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x3AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x3SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x3MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x3DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat32x3MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat32x3MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
 // MARK: - Conformance to ElementaryFunctions
 // TODO: These are not yet exposed to SIMDX
 extension Float32x3/*: ElementaryFunctions*/ {
@@ -162,3 +207,119 @@ extension Float32x3/*: ElementaryFunctions*/ {
     self.init(rawValue: CFloat32x3SquareRoot(x.rawValue))
   }
 }
+
+// MARK: - Conformance to SIMDX3GeometricStorage
+extension Float32x3: SIMDX3GeometricStorage {
+  @_transparent
+  public static func dot(_ lhs: Self, _ rhs: Self) -> Element {
+    CFloat32x3Dot(lhs.rawValue, rhs.rawValue)
+  }
+
+  @_transparent
+  public static func cross(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x3Cross(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func distance(_ lhs: Self, _ rhs: Self) -> Element {
+    CFloat32x3Distance(lhs.rawValue, rhs.rawValue)
+  }
+
+  @_transparent
+  public var length: Element {
+    CFloat32x3Length(rawValue)
+  }
+
+  @_transparent
+  public var lengthSquared: Element {
+    CFloat32x3LengthSquared(rawValue)
+  }
+
+  @_transparent
+  public func normalized() -> Self {
+    Self(rawValue: CFloat32x3Normalize(rawValue))
+  }
+
+  @_transparent
+  public func fastNormalized() -> Self {
+    Self(rawValue: CFloat32x3FastNormalize(rawValue))
+  }
+
+  @_transparent
+  public func reflected(off normal: Self) -> Self {
+    Self(rawValue: CFloat32x3Reflect(rawValue, normal.rawValue))
+  }
+
+  @_transparent
+  public func projected(onto other: Self) -> Self {
+    Self(rawValue: CFloat32x3Project(rawValue, other.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Float32x3: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x3
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x3CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x3CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x3CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CFloat32x3Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float32x3: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x3Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x3Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat32x3Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x3IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x3IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension Float32x3: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x3) {
+    self.init(rawValue: CUInt32x3ReinterpretAsCFloat32x3(bitPattern.rawValue))
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x3 {
+    UInt32x3(rawValue: CFloat32x3ReinterpretAsCUInt32x3(rawValue))
+  }
+}
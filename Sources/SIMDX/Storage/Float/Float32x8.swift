@@ -0,0 +1,290 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct Float32x8: SIMDXStorage, SIMDX8Storage {
+  public typealias RawValue = CFloat32x8
+  public typealias Element = Float32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension Float32x8 {
+  @_transparent
+  public init(
+    _ index0: Element,
+    _ index1: Element,
+    _ index2: Element,
+    _ index3: Element,
+    _ index4: Element,
+    _ index5: Element,
+    _ index6: Element,
+    _ index7: Element
+  ) {
+    self.init(rawValue: CFloat32x8Make(
+      index0, index1, index2, index3,
+      index4, index5, index6, index7
+    ))
+  }
+
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CFloat32x8MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [Float32]) {
+    precondition(array.count == 8, "Array must contain exactly 8 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float32>) {
+    precondition(buffer.count == 8, "Buffer must contain exactly 8 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float32>) {
+    self.init(rawValue: CFloat32x8MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension Float32x8 {
+  public typealias Index = CInt
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat32x8ExtractLane`/`CFloat32x8InsertLane` operate within the register.
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      rawValue = CFloat32x8InsertLane(rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CFloat32x8ExtractLane(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension Float32x8: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CFloat32x8Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension Float32x8: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: CFloat32x8Canonicalize(rawValue), into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension Float32x8: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CFloat32x8MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x8Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat32x8Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension Float32x8: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    CFloat32x8ReduceMaximum(CFloat32x8Magnitude(rawValue))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat32x8Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CFloat32x8MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformace to SignedNumeric
+extension Float32x8: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: CFloat32x8Negate(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue = CFloat32x8Negate(rawValue)
+  }
+}
+
+// MARK: - Conformance to AlgebraicField
+extension Float32x8: AlgebraicField {
+  @_transparent
+  public static func / (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat32x8Divide(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func /= (lhs: inout Self, rhs: Self) {
+    lhs = lhs / rhs
+  }
+}
+
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float32x8: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x8AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x8SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x8MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat32x8DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat32x8MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat32x8MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXReduction
+extension Float32x8: SIMDXReduction {
+  @_transparent
+  public func sum() -> Element {
+    CFloat32x8ReduceAdd(rawValue)
+  }
+
+  @_transparent
+  public func minimum() -> Element {
+    CFloat32x8ReduceMinimum(rawValue)
+  }
+
+  @_transparent
+  public func maximum() -> Element {
+    CFloat32x8ReduceMaximum(rawValue)
+  }
+}
+
+// MARK: - Conformance to ElementaryFunctions
+// TODO: These are not yet exposed to SIMDX
+extension Float32x8/*: ElementaryFunctions*/ {
+  @_transparent
+  static func sqrt(_ x: Self) -> Self {
+    self.init(rawValue: CFloat32x8SquareRoot(x.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Float32x8: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x8
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x8CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x8CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat32x8CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CFloat32x8Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float32x8: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x8Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x8Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat32x8Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x8IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat32x8IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
@@ -43,8 +43,18 @@ extension Float64x2: ExpressibleByIntegerLiteral {
   @_transparent
   public init(_ array: [Float64]) {
     precondition(array.count == 2, "Array must contain exactly 2 elements")
-    var array = array
-    self.init(rawValue: CFloat64x2MakeLoad(&array))
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float64>) {
+    precondition(buffer.count == 2, "Buffer must contain exactly 2 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float64>) {
+    self.init(rawValue: CFloat64x2MakeLoad(pointer))
   }
 }
 
@@ -52,14 +62,16 @@ extension Float64x2: ExpressibleByIntegerLiteral {
 extension Float64x2 {
   public typealias Index = CInt
 
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat64x2ExtractLane`/`CFloat64x2InsertLane` operate within the register.
   public subscript(index: Index) -> Element {
     @_transparent set {
       precondition(indices.contains(index))
-      CFloat64x2SetElement(&rawValue, index, newValue)
+      rawValue = CFloat64x2InsertLane(rawValue, index, newValue)
     }
     @_transparent get {
       precondition(indices.contains(index))
-      return CFloat64x2GetElement(rawValue, index)
+      return CFloat64x2ExtractLane(rawValue, index)
     }
   }
 }
@@ -68,15 +80,16 @@ extension Float64x2 {
 extension Float64x2: Equatable {
   @_transparent
   public static func == (lhs: Self, rhs: Self) -> Bool {
-    lhs.indices.allSatisfy { lhs[$0] == rhs[$0] }
+    CFloat64x2Equal(lhs.rawValue, rhs.rawValue)
   }
 }
 
 // MARK: - Conformance to Hashable
 extension Float64x2: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(CFloat64x2GetElement(rawValue, 0))
-    hasher.combine(CFloat64x2GetElement(rawValue, 1))
+    combineElements(of: CFloat64x2Canonicalize(rawValue), into: &hasher)
   }
 }
 
@@ -153,6 +166,39 @@ extension Float64x2: AlgebraicField {
   }
 }
 
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float64x2: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x2AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x2SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x2MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x2DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat64x2MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat64x2MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
 // MARK: - Conformance to ElementaryFunctions
 // TODO: These are not yet exposed to SIMDX
 extension Float64x2/*: ElementaryFunctions*/ {
@@ -161,3 +207,33 @@ extension Float64x2/*: ElementaryFunctions*/ {
     self.init(rawValue: CFloat64x2SquareRoot(x.rawValue))
   }
 }
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float64x2: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x2Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x2Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat64x2Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x2IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x2IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
@@ -43,8 +43,18 @@ extension Float64x3: ExpressibleByIntegerLiteral {
   @_transparent
   public init(_ array: [Float64]) {
     precondition(array.count == 3, "Array must contain exactly 3 elements")
-    var array = array
-    self.init(rawValue: CFloat64x3MakeLoad(&array))
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float64>) {
+    precondition(buffer.count == 3, "Buffer must contain exactly 3 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float64>) {
+    self.init(rawValue: CFloat64x3MakeLoad(pointer))
   }
 }
 
@@ -52,14 +62,16 @@ extension Float64x3: ExpressibleByIntegerLiteral {
 extension Float64x3 {
   public typealias Index = CInt
 
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat64x3ExtractLane`/`CFloat64x3InsertLane` operate within the register.
   public subscript(index: Index) -> Element {
     @_transparent set {
       precondition(indices.contains(index))
-      CFloat64x3SetElement(&rawValue, index, newValue)
+      rawValue = CFloat64x3InsertLane(rawValue, index, newValue)
     }
     @_transparent get {
       precondition(indices.contains(index))
-      return CFloat64x3GetElement(rawValue, index)
+      return CFloat64x3ExtractLane(rawValue, index)
     }
   }
 }
@@ -68,16 +80,16 @@ extension Float64x3 {
 extension Float64x3: Equatable {
   @_transparent
   public static func == (lhs: Self, rhs: Self) -> Bool {
-    lhs.indices.allSatisfy { lhs[$0] == rhs[$0] }
+    CFloat64x3Equal(lhs.rawValue, rhs.rawValue)
   }
 }
 
 // MARK: - Conformance to Hashable
 extension Float64x3: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(CFloat64x3GetElement(rawValue, 0))
-    hasher.combine(CFloat64x3GetElement(rawValue, 1))
-    hasher.combine(CFloat64x3GetElement(rawValue, 2))
+    combineElements(of: CFloat64x3Canonicalize(rawValue), into: &hasher)
   }
 }
 
@@ -154,6 +166,39 @@ extension Float64x3: AlgebraicField {
   }
 }
 
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float64x3: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x3AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x3SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x3MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x3DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat64x3MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat64x3MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
 // MARK: - Conformance to ElementaryFunctions
 // TODO: These are not yet exposed to SIMDX
 extension Float64x3/*: ElementaryFunctions*/ {
@@ -162,3 +207,81 @@ extension Float64x3/*: ElementaryFunctions*/ {
     self.init(rawValue: CFloat64x3SquareRoot(x.rawValue))
   }
 }
+
+// MARK: - Conformance to SIMDX3GeometricStorage
+extension Float64x3: SIMDX3GeometricStorage {
+  @_transparent
+  public static func dot(_ lhs: Self, _ rhs: Self) -> Element {
+    CFloat64x3Dot(lhs.rawValue, rhs.rawValue)
+  }
+
+  @_transparent
+  public static func cross(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x3Cross(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func distance(_ lhs: Self, _ rhs: Self) -> Element {
+    CFloat64x3Distance(lhs.rawValue, rhs.rawValue)
+  }
+
+  @_transparent
+  public var length: Element {
+    CFloat64x3Length(rawValue)
+  }
+
+  @_transparent
+  public var lengthSquared: Element {
+    CFloat64x3LengthSquared(rawValue)
+  }
+
+  @_transparent
+  public func normalized() -> Self {
+    Self(rawValue: CFloat64x3Normalize(rawValue))
+  }
+
+  @_transparent
+  public func fastNormalized() -> Self {
+    Self(rawValue: CFloat64x3FastNormalize(rawValue))
+  }
+
+  @_transparent
+  public func reflected(off normal: Self) -> Self {
+    Self(rawValue: CFloat64x3Reflect(rawValue, normal.rawValue))
+  }
+
+  @_transparent
+  public func projected(onto other: Self) -> Self {
+    Self(rawValue: CFloat64x3Project(rawValue, other.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float64x3: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x3Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x3Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat64x3Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x3IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x3IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
@@ -48,22 +48,34 @@ extension Float64x4 {
   @_transparent
   public init(_ array: [Float64]) {
     precondition(array.count == 4, "Array must contain exactly 4 elements")
-    var array = array
-    self.init(rawValue: CFloat64x4MakeLoad(&array))
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float64>) {
+    precondition(buffer.count == 4, "Buffer must contain exactly 4 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float64>) {
+    self.init(rawValue: CFloat64x4MakeLoad(pointer))
   }
 }
 
 // MARK: - Conformance to MutableCollection
 extension Float64x4 {
   public typealias Index = CInt
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat64x4ExtractLane`/`CFloat64x4InsertLane` operate within the register.
   public subscript(index: Index) -> Element {
     @_transparent set {
       precondition(indices.contains(index))
-      CFloat64x4SetElement(&rawValue, index, newValue)
+      rawValue = CFloat64x4InsertLane(rawValue, index, newValue)
     }
     @_transparent get {
       precondition(indices.contains(index))
-      return CFloat64x4GetElement(rawValue, index)
+      return CFloat64x4ExtractLane(rawValue, index)
     }
   }
 }
@@ -72,17 +84,16 @@ extension Float64x4 {
 extension Float64x4: Equatable {
   @_transparent
   public static func == (lhs: Self, rhs: Self) -> Bool {
-    lhs.indices.allSatisfy { lhs[$0] == rhs[$0] }
+    CFloat64x4Equal(lhs.rawValue, rhs.rawValue)
   }
 }
 
 // MARK: - Conformance to Hashable
 extension Float64x4: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(CFloat64x4GetElement(rawValue, 0))
-    hasher.combine(CFloat64x4GetElement(rawValue, 1))
-    hasher.combine(CFloat64x4GetElement(rawValue, 2))
-    hasher.combine(CFloat64x4GetElement(rawValue, 3))
+    combineElements(of: CFloat64x4Canonicalize(rawValue), into: &hasher)
   }
 }
 
@@ -159,6 +170,39 @@ extension Float64x4: AlgebraicField {
   }
 }
 
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float64x4: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x4AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x4SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x4MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x4DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat64x4MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat64x4MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
 // MARK: - Conformance to ElementaryFunctions
 // TODO: These are not yet exposed to SIMDX
 extension Float64x4/*: ElementaryFunctions*/ {
@@ -167,3 +211,33 @@ extension Float64x4/*: ElementaryFunctions*/ {
     self.init(rawValue: CFloat64x4SquareRoot(x.rawValue))
   }
 }
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float64x4: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x4Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x4Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat64x4Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x4IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x4IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
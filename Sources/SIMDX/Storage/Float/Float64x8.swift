@@ -0,0 +1,290 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct Float64x8: SIMDXStorage, SIMDX8Storage {
+  public typealias RawValue = CFloat64x8
+  public typealias Element = Float64
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension Float64x8 {
+  @_transparent
+  public init(
+    _ index0: Element,
+    _ index1: Element,
+    _ index2: Element,
+    _ index3: Element,
+    _ index4: Element,
+    _ index5: Element,
+    _ index6: Element,
+    _ index7: Element
+  ) {
+    self.init(rawValue: CFloat64x8Make(
+      index0, index1, index2, index3,
+      index4, index5, index6, index7
+    ))
+  }
+
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CFloat64x8MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [Float64]) {
+    precondition(array.count == 8, "Array must contain exactly 8 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Float64>) {
+    precondition(buffer.count == 8, "Buffer must contain exactly 8 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Float64>) {
+    self.init(rawValue: CFloat64x8MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension Float64x8 {
+  public typealias Index = CInt
+  // A literal `index` is constant once the accessors are inlined, in which case
+  // `CFloat64x8ExtractLane`/`CFloat64x8InsertLane` operate within the register.
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      rawValue = CFloat64x8InsertLane(rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CFloat64x8ExtractLane(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension Float64x8: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CFloat64x8Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension Float64x8: Hashable {
+  // -0.0 and +0.0 are equal and have to hash alike. NaNs hash alike as well,
+  // regardless of their sign and payload.
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: CFloat64x8Canonicalize(rawValue), into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension Float64x8: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CFloat64x8MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x8Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat64x8Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension Float64x8: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    CFloat64x8ReduceMaximum(CFloat64x8Magnitude(rawValue))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat64x8Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CFloat64x8MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformace to SignedNumeric
+extension Float64x8: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: CFloat64x8Negate(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue = CFloat64x8Negate(rawValue)
+  }
+}
+
+// MARK: - Conformance to AlgebraicField
+extension Float64x8: AlgebraicField {
+  @_transparent
+  public static func / (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CFloat64x8Divide(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func /= (lhs: inout Self, rhs: Self) {
+    lhs = lhs / rhs
+  }
+}
+
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension Float64x8: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x8AddElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x8SubtractElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x8MultiplyElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(rawValue: CFloat64x8DivideElement(lhs.rawValue, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(rawValue: CFloat64x8MultiplyElementAdd(lhs.rawValue, rhs, rawValue))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(rawValue: CFloat64x8MultiplyAdd(lhs.rawValue, rhs.rawValue, rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXReduction
+extension Float64x8: SIMDXReduction {
+  @_transparent
+  public func sum() -> Element {
+    CFloat64x8ReduceAdd(rawValue)
+  }
+
+  @_transparent
+  public func minimum() -> Element {
+    CFloat64x8ReduceMinimum(rawValue)
+  }
+
+  @_transparent
+  public func maximum() -> Element {
+    CFloat64x8ReduceMaximum(rawValue)
+  }
+}
+
+// MARK: - Conformance to ElementaryFunctions
+// TODO: These are not yet exposed to SIMDX
+extension Float64x8/*: ElementaryFunctions*/ {
+  @_transparent
+  static func sqrt(_ x: Self) -> Self {
+    self.init(rawValue: CFloat64x8SquareRoot(x.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Float64x8: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x8
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat64x8CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat64x8CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CFloat64x8CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CFloat64x8Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+// `min` and `max` are a single instruction. `minimum` and `maximum` are as well
+// on Arm, and take three (`minimum`) or five (`maximum`) on x86.
+extension Float64x8: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x8Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x8Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(rawValue: CFloat64x8Magnitude(operand.rawValue))
+  }
+
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x8IEEEMinimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CFloat64x8IEEEMaximum(lhs.rawValue, rhs.rawValue))
+  }
+}
@@ -43,8 +43,18 @@ extension Int32x2: ExpressibleByIntegerLiteral {
   @_transparent
   public init(_ array: [Int32]) {
     precondition(array.count == 2, "Array must contain exactly 2 elements")
-    var array = array
-    self.init(rawValue: CInt32x2MakeLoad(&array))
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Int32>) {
+    precondition(buffer.count == 2, "Buffer must contain exactly 2 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Int32>) {
+    self.init(rawValue: CInt32x2MakeLoad(pointer))
   }
 }
 
@@ -66,17 +76,14 @@ extension Int32x2 {
 extension Int32x2: Equatable {
   @_transparent
   public static func == (lhs: Self, rhs: Self) -> Bool {
-    #warning("TODO: Broadcast to other storages")
-    let cmp = CInt32x2CompareElementWise(lhs.rawValue, rhs.rawValue)
-    return lhs.indices.allSatisfy { CInt32x2GetElement(cmp, $0) != .zero }
+    CInt32x2Equal(lhs.rawValue, rhs.rawValue)
   }
 }
 
 // MARK: - Conformance to Hashable
 extension Int32x2: Hashable {
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(CInt32x2GetElement(rawValue, 0))
-    hasher.combine(CInt32x2GetElement(rawValue, 1))
+    combineElements(of: rawValue, into: &hasher)
   }
 }
 
@@ -140,8 +147,8 @@ extension Int32x2: SignedNumeric {
   }
 }
 
-// MARK: - Bitwise
-extension Int32x2 {
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension Int32x2: SIMDXFixedWidthIntegerStorage {
 
   @_transparent
   public prefix static func ~ (operand: Int32x2) -> Int32x2 {
@@ -170,7 +177,7 @@ extension Int32x2 {
     lhs: Int32x2,
     rhs: RHS
   ) -> Int32x2 where RHS: BinaryInteger {
-    self.init(rawValue: CInt32x2ShiftLeft(lhs.rawValue, numericCast(rhs)))
+    self.init(rawValue: CInt32x2ShiftRight(lhs.rawValue, numericCast(rhs)))
   }
 
   @_transparent
@@ -178,6 +185,121 @@ extension Int32x2 {
     lhs: Int32x2,
     rhs: RHS
   ) -> Int32x2 where RHS: BinaryInteger {
-    self.init(rawValue: CInt32x2ShiftRight(lhs.rawValue, numericCast(rhs)))
+    self.init(rawValue: CInt32x2ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: Int32x2, rhs: Int32x2) -> Int32x2 {
+    self.init(rawValue: CInt32x2ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: Int32x2, rhs: Int32x2) -> Int32x2 {
+    self.init(rawValue: CInt32x2ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension Int32x2 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: Int32x2 {
+    Int32x2(rawValue: CInt32x2PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: Int32x2 {
+    Int32x2(rawValue: CInt32x2LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: Int32x2 {
+    Int32x2(rawValue: CInt32x2TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: Int32x2 {
+    Int32x2(rawValue: CInt32x2ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: Int32x2 {
+    Int32x2(rawValue: CInt32x2BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Int32x2: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x2
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x2CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x2CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x2CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CInt32x2Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXMaskStorage
+extension Int32x2: SIMDXMaskStorage {
+  @_transparent
+  public func any() -> Bool {
+    CInt32x2MaskAny(rawValue)
+  }
+
+  @_transparent
+  public func all() -> Bool {
+    CInt32x2MaskAll(rawValue)
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension Int32x2: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x2Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x2Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    // The magnitude is of the same bits, only typed unsigned
+    self.init(bitPattern: UInt32x2(rawValue: CInt32x2Magnitude(operand.rawValue)))
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension Int32x2: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x2) {
+    self.init(rawValue: CUInt32x2ReinterpretAsCInt32x2(bitPattern.rawValue))
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x2 {
+    UInt32x2(rawValue: CInt32x2ReinterpretAsCUInt32x2(rawValue))
   }
 }
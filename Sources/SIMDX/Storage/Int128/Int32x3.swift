@@ -1,132 +1,305 @@
-//// Copyright 2019 Markus Winter
-////
-//// Licensed under the Apache License, Version 2.0 (the "License");
-//// you may not use this file except in compliance with the License.
-//// You may obtain a copy of the License at
-////
-////     http://www.apache.org/licenses/LICENSE-2.0
-////
-//// Unless required by applicable law or agreed to in writing, software
-//// distributed under the License is distributed on an "AS IS" BASIS,
-//// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-//// See the License for the specific language governing permissions and
-//// limitations under the License.
-//
-//import Foundation
-//import CSIMDX
-//
-//public struct Int32x3: RawStorage3, FixedWidthIntegerStorage, SignedIntegerStorage {
-//
-//    // MARK: Collection
-//
-//    @inlinable public var count: Int { 3 }
-//    @inlinable public var startIndex: Int32 { 0 }
-//    @inlinable public var endIndex: Int32 { 3 }
-//
-//    // MARK: RawValue
-//
-//    public var rawValue: CXInt32x3
-//
-//    @inlinable public subscript(index: Int32) -> Int32 {
-//        @inlinable set { CXInt32x3SetElement(&rawValue, index, newValue) }
-//        @inlinable get { CXInt32x3GetElement(rawValue, index) }
-//    }
-//
-//    @inlinable public init(rawValue: CXInt32x3) {
-//        self.rawValue = rawValue
-//    }
-//}
-//
-//// MARK: - Initializer
-//extension Int32x3 {
-//
-//    @inlinable public init(_ repeatingElement: Int32) {
-//        self.init(rawValue: CXInt32x3MakeRepeatingElement(repeatingElement))
-//    }
-//
-//    @inlinable public init(_ index0: Int32, _ index1: Int32, _ index2: Int32) {
-//        self.init(rawValue: CXInt32x3Make(index0, index1, index2))
-//    }
-//
-//    @inlinable public init(_ array: [Int32]) {
-//        var array = array
-//        self.init(rawValue: CXInt32x3MakeLoad(&array))
-//    }
-//
-//    @inlinable public init<Other>(_ sequence: Other) where Other: Sequence, Other.Element == Int32 {
-//        self.init(Array(sequence))
-//    }
-//}
-//
-//// MARK: - Comparison
-//extension Int32x3 {
-//
-//    @inlinable public static func minimum(_ lhs: Int32x3, _ rhs: Int32x3) -> Int32x3 {
-//        .init(rawValue: CXInt32x3Minimum(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func maximum(_ lhs: Int32x3, _ rhs: Int32x3) -> Int32x3 {
-//        .init(rawValue: CXInt32x3Maximum(lhs.rawValue, rhs.rawValue))
-//    }
-//}
-//
-//// MARK: - Bitwise
-//extension Int32x3 {
-//    @inlinable public  prefix static func ~ (operand: Int32x3) -> Int32x3 {
-//        return .init(rawValue: CXInt32x3BitwiseNot(operand.rawValue))
-//    }
-//
-//    @inlinable public static func & (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
-//        return .init(rawValue: CXInt32x3BitwiseAnd(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func | (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
-//        return .init(rawValue: CXInt32x3BitwiseOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func ^ (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
-//        return .init(rawValue: CXInt32x3BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    // MARK: Shifting
-//
-//    @inlinable public static func >> <RHS>(lhs: Int32x3, rhs: RHS) -> Int32x3 where RHS: BinaryInteger {
-//        return .init(rawValue: CXInt32x3ShiftLeft(lhs.rawValue, numericCast(rhs)))
-//    }
-//
-//    @inlinable public static func << <RHS>(lhs: Int32x3, rhs: RHS) -> Int32x3 where RHS: BinaryInteger {
-//        return .init(rawValue: CXInt32x3ShiftRight(lhs.rawValue, numericCast(rhs)))
-//    }
-//}
-//
-//// MARK: - Arithmetics
-//extension Int32x3 {
-//
-//    @inlinable public static var zero: Int32x3 { .init(rawValue: CXInt32x3MakeZero()) }
-//
-//    @inlinable public var magnitude: UInt32x3 { .init(rawValue: CXInt32x3Magnitude(rawValue)) }
-//
-//    // MARK: Additive
-//
-//    @inlinable public static func + (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
-//        .init(rawValue: CXInt32x3Add(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func - (lhs: Int32x3, rhs: Int32x3) -> Int32x3  {
-//        .init(rawValue: CXInt32x3Subtract(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static prefix func - (operand: Int32x3) -> Int32x3  {
-//        .init(rawValue: CXInt32x3Negate(operand.rawValue))
-//    }
-//
-//    @inlinable public mutating func negate() {
-//        rawValue = CXInt32x3Negate(rawValue)
-//    }
-//
-//    // MARK: Multiplicative
-//
-//    @inlinable public static func * (lhs: Int32x3, rhs: Int32x3) -> Int32x3  {
-//        .init(rawValue: CXInt32x3Multiply(lhs.rawValue, rhs.rawValue))
-//    }
-//}
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct Int32x3: SIMDXStorage, SIMDX3Storage {
+  public typealias RawValue = CInt32x3
+  public typealias Element = Int32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension Int32x3: ExpressibleByIntegerLiteral {
+  @_transparent
+  public init(_ index0: Element, _ index1: Element, _ index2: Element) {
+    self.init(rawValue: CInt32x3Make(index0, index1, index2))
+  }
+
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CInt32x3MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [Int32]) {
+    precondition(array.count == 3, "Array must contain exactly 3 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Int32>) {
+    precondition(buffer.count == 3, "Buffer must contain exactly 3 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Int32>) {
+    self.init(rawValue: CInt32x3MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension Int32x3 {
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      CInt32x3SetElement(&rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CInt32x3GetElement(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension Int32x3: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CInt32x3Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension Int32x3: Hashable {
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: rawValue, into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension Int32x3: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CInt32x3MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CInt32x3Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CInt32x3Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension Int32x3: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    let rawValue = CInt32x3Magnitude(rawValue)
+    return indices.reduce(into: CUInt32x3GetElement(rawValue, 0)) {
+      $0 = Swift.max($0, CUInt32x3GetElement(rawValue, $1))
+    }
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CInt32x3Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CInt32x3MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformace to SignedNumeric
+extension Int32x3: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: CInt32x3Negate(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue = CInt32x3Negate(rawValue)
+  }
+}
+
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension Int32x3: SIMDXFixedWidthIntegerStorage {
+
+  @_transparent
+  public prefix static func ~ (operand: Int32x3) -> Int32x3 {
+    self.init(rawValue: CInt32x3BitwiseNot(operand.rawValue))
+  }
+
+  @_transparent
+  public static func & (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
+    self.init(rawValue: CInt32x3BitwiseAnd(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func | (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
+    self.init(rawValue: CInt32x3BitwiseOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func ^ (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
+    self.init(rawValue: CInt32x3BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  // MARK: Shifting
+
+  @_transparent
+  public static func >> <RHS>(
+    lhs: Int32x3,
+    rhs: RHS
+  ) -> Int32x3 where RHS: BinaryInteger {
+    self.init(rawValue: CInt32x3ShiftRight(lhs.rawValue, numericCast(rhs)))
+  }
+
+  @_transparent
+  public static func << <RHS>(
+    lhs: Int32x3,
+    rhs: RHS
+  ) -> Int32x3 where RHS: BinaryInteger {
+    self.init(rawValue: CInt32x3ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
+    self.init(rawValue: CInt32x3ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: Int32x3, rhs: Int32x3) -> Int32x3 {
+    self.init(rawValue: CInt32x3ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension Int32x3 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: Int32x3 {
+    Int32x3(rawValue: CInt32x3PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: Int32x3 {
+    Int32x3(rawValue: CInt32x3LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: Int32x3 {
+    Int32x3(rawValue: CInt32x3TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: Int32x3 {
+    Int32x3(rawValue: CInt32x3ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: Int32x3 {
+    Int32x3(rawValue: CInt32x3BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Int32x3: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x3
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x3CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x3CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x3CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CInt32x3Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXMaskStorage
+extension Int32x3: SIMDXMaskStorage {
+  @_transparent
+  public func any() -> Bool {
+    CInt32x3MaskAny(rawValue)
+  }
+
+  @_transparent
+  public func all() -> Bool {
+    CInt32x3MaskAll(rawValue)
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension Int32x3: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x3Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x3Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    // The magnitude is of the same bits, only typed unsigned
+    self.init(bitPattern: UInt32x3(rawValue: CInt32x3Magnitude(operand.rawValue)))
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension Int32x3: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x3) {
+    self.init(rawValue: CUInt32x3ReinterpretAsCInt32x3(bitPattern.rawValue))
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x3 {
+    UInt32x3(rawValue: CInt32x3ReinterpretAsCUInt32x3(rawValue))
+  }
+}
@@ -1,133 +1,310 @@
-//// Copyright 2019 Markus Winter
-////
-//// Licensed under the Apache License, Version 2.0 (the "License");
-//// you may not use this file except in compliance with the License.
-//// You may obtain a copy of the License at
-////
-////     http://www.apache.org/licenses/LICENSE-2.0
-////
-//// Unless required by applicable law or agreed to in writing, software
-//// distributed under the License is distributed on an "AS IS" BASIS,
-//// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-//// See the License for the specific language governing permissions and
-//// limitations under the License.
-//
-//import Foundation
-//import CSIMDX
-//
-//public struct Int32x4: RawStorage4, FixedWidthIntegerStorage, SignedIntegerStorage {
-//
-//    // MARK: Collection
-//
-//    @inlinable public var count: Int { 4 }
-//    @inlinable public var startIndex: Int32 { 0 }
-//    @inlinable public var endIndex: Int32 { 4 }
-//
-//    // MARK: RawValue
-//
-//    public var rawValue: CXInt32x4
-//
-//    @inlinable public subscript(index: Int32) -> Int32 {
-//        @inlinable set { CXInt32x4SetElement(&rawValue, index, newValue) }
-//        @inlinable get { CXInt32x4GetElement(rawValue, index) }
-//    }
-//
-//    @inlinable public init(rawValue: CXInt32x4) {
-//        self.rawValue = rawValue
-//    }
-//}
-//
-//// MARK: - Initializer
-//extension Int32x4 {
-//
-//    @inlinable public init(_ repeatingElement: Int32) {
-//        self.init(rawValue: CXInt32x4MakeRepeatingElement(repeatingElement))
-//    }
-//
-//    @inlinable public init(_ index0: Int32, _ index1: Int32, _ index2: Int32, _ index3: Int32) {
-//        self.init(rawValue: CXInt32x4Make(index0, index1, index2, index3))
-//    }
-//
-//    @inlinable public init(_ array: [Int32]) {
-//        var array = array
-//        self.init(rawValue: CXInt32x4MakeLoad(&array))
-//    }
-//
-//    @inlinable public init<Other>(_ sequence: Other) where Other: Sequence, Other.Element == Int32 {
-//        self.init(Array(sequence))
-//    }
-//}
-//
-//// MARK: - Comparison
-//extension Int32x4 {
-//
-//    @inlinable public static func minimum(_ lhs: Int32x4, _ rhs: Int32x4) -> Int32x4 {
-//        .init(rawValue: CXInt32x4Minimum(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func maximum(_ lhs: Int32x4, _ rhs: Int32x4) -> Int32x4 {
-//        .init(rawValue: CXInt32x4Maximum(lhs.rawValue, rhs.rawValue))
-//    }
-//}
-//
-//// MARK: - Bitwise
-//extension Int32x4 {
-//
-//    @inlinable public  prefix static func ~ (operand: Int32x4) -> Int32x4 {
-//        return .init(rawValue: CXInt32x4BitwiseNot(operand.rawValue))
-//    }
-//
-//    @inlinable public static func & (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
-//        return .init(rawValue: CXInt32x4BitwiseAnd(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func | (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
-//        return .init(rawValue: CXInt32x4BitwiseOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func ^ (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
-//        return .init(rawValue: CXInt32x4BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    // MARK: Shifting
-//
-//    @inlinable public static func >> <RHS>(lhs: Int32x4, rhs: RHS) -> Int32x4 where RHS: BinaryInteger {
-//        return .init(rawValue: CXInt32x4ShiftLeft(lhs.rawValue, numericCast(rhs)))
-//    }
-//
-//    @inlinable public static func << <RHS>(lhs: Int32x4, rhs: RHS) -> Int32x4 where RHS: BinaryInteger {
-//        return .init(rawValue: CXInt32x4ShiftRight(lhs.rawValue, numericCast(rhs)))
-//    }
-//}
-//
-//// MARK: - Arithmetics
-//extension Int32x4 {
-//
-//    @inlinable public static var zero: Int32x4 { .init(rawValue: CXInt32x4MakeZero()) }
-//
-//    @inlinable public var magnitude: UInt32x4 { .init(rawValue: CXInt32x4Magnitude(rawValue)) }
-//
-//    // MARK: Additive
-//
-//    @inlinable public static func + (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
-//        .init(rawValue: CXInt32x4Add(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func - (lhs: Int32x4, rhs: Int32x4) -> Int32x4  {
-//        .init(rawValue: CXInt32x4Subtract(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static prefix func - (operand: Int32x4) -> Int32x4  {
-//        .init(rawValue: CXInt32x4Negate(operand.rawValue))
-//    }
-//
-//    @inlinable public mutating func negate() {
-//        rawValue = CXInt32x4Negate(rawValue)
-//    }
-//
-//    // MARK: Multiplicative
-//
-//    @inlinable public static func * (lhs: Int32x4, rhs: Int32x4) -> Int32x4  {
-//        .init(rawValue: CXInt32x4Multiply(lhs.rawValue, rhs.rawValue))
-//    }
-//}
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct Int32x4: SIMDXStorage, SIMDX4Storage {
+  public typealias RawValue = CInt32x4
+  public typealias Element = Int32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension Int32x4: ExpressibleByIntegerLiteral {
+  @_transparent
+  public init(
+    _ index0: Element,
+    _ index1: Element,
+    _ index2: Element,
+    _ index3: Element
+  ) {
+    self.init(rawValue: CInt32x4Make(index0, index1, index2, index3))
+  }
+
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CInt32x4MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [Int32]) {
+    precondition(array.count == 4, "Array must contain exactly 4 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Int32>) {
+    precondition(buffer.count == 4, "Buffer must contain exactly 4 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Int32>) {
+    self.init(rawValue: CInt32x4MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension Int32x4 {
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      CInt32x4SetElement(&rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CInt32x4GetElement(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension Int32x4: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CInt32x4Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension Int32x4: Hashable {
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: rawValue, into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension Int32x4: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CInt32x4MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CInt32x4Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CInt32x4Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension Int32x4: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    let rawValue = CInt32x4Magnitude(rawValue)
+    return indices.reduce(into: CUInt32x4GetElement(rawValue, 0)) {
+      $0 = Swift.max($0, CUInt32x4GetElement(rawValue, $1))
+    }
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CInt32x4Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CInt32x4MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformace to SignedNumeric
+extension Int32x4: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: CInt32x4Negate(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue = CInt32x4Negate(rawValue)
+  }
+}
+
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension Int32x4: SIMDXFixedWidthIntegerStorage {
+
+  @_transparent
+  public prefix static func ~ (operand: Int32x4) -> Int32x4 {
+    self.init(rawValue: CInt32x4BitwiseNot(operand.rawValue))
+  }
+
+  @_transparent
+  public static func & (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
+    self.init(rawValue: CInt32x4BitwiseAnd(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func | (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
+    self.init(rawValue: CInt32x4BitwiseOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func ^ (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
+    self.init(rawValue: CInt32x4BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  // MARK: Shifting
+
+  @_transparent
+  public static func >> <RHS>(
+    lhs: Int32x4,
+    rhs: RHS
+  ) -> Int32x4 where RHS: BinaryInteger {
+    self.init(rawValue: CInt32x4ShiftRight(lhs.rawValue, numericCast(rhs)))
+  }
+
+  @_transparent
+  public static func << <RHS>(
+    lhs: Int32x4,
+    rhs: RHS
+  ) -> Int32x4 where RHS: BinaryInteger {
+    self.init(rawValue: CInt32x4ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
+    self.init(rawValue: CInt32x4ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: Int32x4, rhs: Int32x4) -> Int32x4 {
+    self.init(rawValue: CInt32x4ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension Int32x4 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: Int32x4 {
+    Int32x4(rawValue: CInt32x4PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: Int32x4 {
+    Int32x4(rawValue: CInt32x4LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: Int32x4 {
+    Int32x4(rawValue: CInt32x4TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: Int32x4 {
+    Int32x4(rawValue: CInt32x4ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: Int32x4 {
+    Int32x4(rawValue: CInt32x4BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Int32x4: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x4
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x4CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x4CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x4CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CInt32x4Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXMaskStorage
+extension Int32x4: SIMDXMaskStorage {
+  @_transparent
+  public func any() -> Bool {
+    CInt32x4MaskAny(rawValue)
+  }
+
+  @_transparent
+  public func all() -> Bool {
+    CInt32x4MaskAll(rawValue)
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension Int32x4: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x4Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x4Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    // The magnitude is of the same bits, only typed unsigned
+    self.init(bitPattern: UInt32x4(rawValue: CInt32x4Magnitude(operand.rawValue)))
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension Int32x4: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x4) {
+    self.init(rawValue: CUInt32x4ReinterpretAsCInt32x4(bitPattern.rawValue))
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x4 {
+    UInt32x4(rawValue: CInt32x4ReinterpretAsCUInt32x4(rawValue))
+  }
+}
@@ -0,0 +1,300 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct Int32x16: SIMDXStorage, SIMDX16Storage {
+  public typealias RawValue = CInt32x16
+  public typealias Element = Int32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension Int32x16: ExpressibleByIntegerLiteral {
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CInt32x16MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [Int32]) {
+    precondition(array.count == 16, "Array must contain exactly 16 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Int32>) {
+    precondition(buffer.count == 16, "Buffer must contain exactly 16 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Int32>) {
+    self.init(rawValue: CInt32x16MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension Int32x16 {
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      CInt32x16SetElement(&rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CInt32x16GetElement(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension Int32x16: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CInt32x16Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension Int32x16: Hashable {
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: rawValue, into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension Int32x16: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CInt32x16MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CInt32x16Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CInt32x16Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension Int32x16: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    let rawValue = CInt32x16Magnitude(rawValue)
+    return indices.reduce(into: CUInt32x16GetElement(rawValue, 0)) {
+      $0 = Swift.max($0, CUInt32x16GetElement(rawValue, $1))
+    }
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CInt32x16Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CInt32x16MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformace to SignedNumeric
+extension Int32x16: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self  {
+    self.init(rawValue: CInt32x16Negate(operand.rawValue))
+  }
+
+  @_transparent
+  public mutating func negate() {
+    rawValue = CInt32x16Negate(rawValue)
+  }
+}
+
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension Int32x16: SIMDXFixedWidthIntegerStorage {
+
+  @_transparent
+  public prefix static func ~ (operand: Int32x16) -> Int32x16 {
+    self.init(rawValue: CInt32x16BitwiseNot(operand.rawValue))
+  }
+
+  @_transparent
+  public static func & (lhs: Int32x16, rhs: Int32x16) -> Int32x16 {
+    self.init(rawValue: CInt32x16BitwiseAnd(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func | (lhs: Int32x16, rhs: Int32x16) -> Int32x16 {
+    self.init(rawValue: CInt32x16BitwiseOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func ^ (lhs: Int32x16, rhs: Int32x16) -> Int32x16 {
+    self.init(rawValue: CInt32x16BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  // MARK: Shifting
+
+  @_transparent
+  public static func >> <RHS>(
+    lhs: Int32x16,
+    rhs: RHS
+  ) -> Int32x16 where RHS: BinaryInteger {
+    self.init(rawValue: CInt32x16ShiftRight(lhs.rawValue, numericCast(rhs)))
+  }
+
+  @_transparent
+  public static func << <RHS>(
+    lhs: Int32x16,
+    rhs: RHS
+  ) -> Int32x16 where RHS: BinaryInteger {
+    self.init(rawValue: CInt32x16ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: Int32x16, rhs: Int32x16) -> Int32x16 {
+    self.init(rawValue: CInt32x16ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: Int32x16, rhs: Int32x16) -> Int32x16 {
+    self.init(rawValue: CInt32x16ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension Int32x16 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: Int32x16 {
+    Int32x16(rawValue: CInt32x16PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: Int32x16 {
+    Int32x16(rawValue: CInt32x16LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: Int32x16 {
+    Int32x16(rawValue: CInt32x16TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: Int32x16 {
+    Int32x16(rawValue: CInt32x16ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: Int32x16 {
+    Int32x16(rawValue: CInt32x16BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension Int32x16: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x16
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x16CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x16CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CInt32x16CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CInt32x16Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXMaskStorage
+extension Int32x16: SIMDXMaskStorage {
+  @_transparent
+  public func any() -> Bool {
+    CInt32x16MaskAny(rawValue)
+  }
+
+  @_transparent
+  public func all() -> Bool {
+    CInt32x16MaskAll(rawValue)
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension Int32x16: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x16Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CInt32x16Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    // The magnitude is of the same bits, only typed unsigned
+    self.init(bitPattern: UInt32x16(rawValue: CInt32x16Magnitude(operand.rawValue)))
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension Int32x16: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x16) {
+    self.init(rawValue: CUInt32x16ReinterpretAsCInt32x16(bitPattern.rawValue))
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x16 {
+    UInt32x16(rawValue: CInt32x16ReinterpretAsCUInt32x16(rawValue))
+  }
+}
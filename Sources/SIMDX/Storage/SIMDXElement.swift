@@ -40,6 +40,30 @@ public protocol SIMDX4Element {
   associatedtype Storage4: SIMDX4Storage where Storage4.Element == Self
 }
 
+/// A type that can be stored in a SIMD8 lane.
+///
+/// Types conforming to this protocol can represent a single element of an SIMD
+/// storage, where the SIMD storage can hold 8 (equal type) elements in total.
+public protocol SIMDX8Element {
+  associatedtype Storage8: SIMDX8Storage where Storage8.Element == Self
+}
+
+/// A type that can be stored in a SIMD16 lane.
+///
+/// Types conforming to this protocol can represent a single element of an SIMD
+/// storage, where the SIMD storage can hold 16 (equal type) elements in total.
+public protocol SIMDX16Element {
+  associatedtype Storage16: SIMDX16Storage where Storage16.Element == Self
+}
+
+/// A type that can be stored in a SIMD32 lane.
+///
+/// Types conforming to this protocol can represent a single element of an SIMD
+/// storage, where the SIMD storage can hold 32 (equal type) elements in total.
+public protocol SIMDX32Element {
+  associatedtype Storage32: SIMDX32Storage where Storage32.Element == Self
+}
+
 // MARK: - Implementations
 
 extension Float32: SIMDX2Element, SIMDX3Element, SIMDX4Element {
@@ -48,17 +72,35 @@ extension Float32: SIMDX2Element, SIMDX3Element, SIMDX4Element {
   public typealias Storage4 = Float32x4
 }
 
+extension Float32: SIMDX8Element, SIMDX16Element, SIMDX32Element {
+  public typealias Storage8 = Float32x8
+  public typealias Storage16 = Float32x16
+  public typealias Storage32 = SIMDXPairStorage<Float32x16>
+}
+
 extension Float64: SIMDX2Element, SIMDX3Element, SIMDX4Element {
   public typealias Storage2 = Float64x2
   public typealias Storage3 = Float64x3
   public typealias Storage4 = Float64x4
 }
 
-//extension Int32: SIMDX2Element, SIMDX3Element, SIMDX4Element {
-//    public typealias Storage2 = Int32x2
-//    public typealias Storage3 = Int32x3
-//    public typealias Storage4 = Int32x4
-//}
+extension Float64: SIMDX8Element, SIMDX16Element, SIMDX32Element {
+  public typealias Storage8 = Float64x8
+  public typealias Storage16 = SIMDXPairStorage<Float64x8>
+  public typealias Storage32 = SIMDXPairStorage<SIMDXPairStorage<Float64x8>>
+}
+
+extension Int32: SIMDX2Element, SIMDX3Element, SIMDX4Element {
+  public typealias Storage2 = Int32x2
+  public typealias Storage3 = Int32x3
+  public typealias Storage4 = Int32x4
+}
+
+extension Int32: SIMDX8Element, SIMDX16Element, SIMDX32Element {
+  public typealias Storage8 = Int32x8
+  public typealias Storage16 = Int32x16
+  public typealias Storage32 = SIMDXPairStorage<Int32x16>
+}
 
 //extension Int64: SIMDX2Element/* CSIMDX3Element, SIMDX4Element*/ {
 //    public typealias Storage2 = Int64x2
@@ -66,11 +108,17 @@ extension Float64: SIMDX2Element, SIMDX3Element, SIMDX4Element {
 //    public typealias Storage4 = Int64x4
 //}
 
-//extension UInt32: SIMDX2Element, SIMDX3Element, SIMDX4Element {
-//    public typealias Storage2 = UInt32x2
-//    public typealias Storage3 = UInt32x3
-//    public typealias Storage4 = UInt32x4
-//}
+extension UInt32: SIMDX2Element, SIMDX3Element, SIMDX4Element {
+  public typealias Storage2 = UInt32x2
+  public typealias Storage3 = UInt32x3
+  public typealias Storage4 = UInt32x4
+}
+
+extension UInt32: SIMDX8Element, SIMDX16Element, SIMDX32Element {
+  public typealias Storage8 = UInt32x8
+  public typealias Storage16 = UInt32x16
+  public typealias Storage32 = SIMDXPairStorage<UInt32x16>
+}
 
 //extension UInt64: SIMDX2Element/* CSIMDX3Element, SIMDX4Element*/ {
 //    public typealias Storage2 = UInt64x2
@@ -0,0 +1,419 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import RealModule
+
+/// A raw SIMD storage of twice the elements of `Half`, held in two storages of
+/// the widest register the element type has, e.g. 32 x Float32 in two 16 x
+/// Float32 storages.
+///
+/// Each operation is performed on both halves independently, so that the two
+/// instructions do not depend on each other and the processor executes them
+/// in parallel.
+public struct SIMDXPairStorage<Half>: SIMDXStorage where Half: SIMDXStorage {
+  public typealias Element = Half.Element
+
+  /// The lower half of the elements, i.e. `self[0 ..< count / 2]`
+  public var low: Half
+
+  /// The upper half of the elements, i.e. `self[count / 2 ..< count]`
+  public var high: Half
+
+  @_transparent
+  public init(low: Half, high: Half) {
+    self.low = low
+    self.high = high
+  }
+}
+
+// MARK: - Additional Initializers
+extension SIMDXPairStorage {
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    let half = Half(repeating: repeatingElement)
+    self.init(low: half, high: half)
+  }
+
+  @_transparent
+  public init(_ array: [Element]) {
+    precondition(array.count % 2 == 0, "Array must contain an even number of elements")
+    self = array.withUnsafeBufferPointer { Self($0) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<Element>) {
+    precondition(buffer.count % 2 == 0, "Buffer must contain an even number of elements")
+    let half = buffer.count / 2
+    self.init(
+      low: Half(UnsafeBufferPointer(rebasing: buffer[..<half])),
+      high: Half(UnsafeBufferPointer(rebasing: buffer[half...]))
+    )
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<Element>) {
+    let low = Half(loadingFrom: pointer)
+    self.init(low: low, high: Half(loadingFrom: pointer + low.count))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension SIMDXPairStorage {
+  public typealias Index = CInt
+
+  @_transparent
+  public var count: Int { 2 * low.count }
+
+  @_transparent
+  public var endIndex: Index { 2 * low.endIndex }
+
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      if index < low.endIndex { low[index] = newValue }
+      else { high[index - low.endIndex] = newValue }
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return index < low.endIndex ? low[index] : high[index - low.endIndex]
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension SIMDXPairStorage: Equatable where Half: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    lhs.low == rhs.low && lhs.high == rhs.high
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension SIMDXPairStorage: Hashable where Half: Hashable {
+  public func hash(into hasher: inout Hasher) {
+    low.hash(into: &hasher)
+    high.hash(into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension SIMDXPairStorage: AdditiveArithmetic where Half: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(low: .zero, high: .zero)
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low + rhs.low, high: lhs.high + rhs.high)
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low - rhs.low, high: lhs.high - rhs.high)
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension SIMDXPairStorage: Numeric where Half: Numeric {
+  public typealias Magnitude = Half.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    Swift.max(low.magnitude, high.magnitude)
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low * rhs.low, high: lhs.high * rhs.high)
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let half = Half(exactly: source) else { return nil }
+    self.init(low: half, high: half)
+  }
+}
+
+// MARK: - Conformace to SignedNumeric
+extension SIMDXPairStorage: SignedNumeric where Half: SignedNumeric {
+  @_transparent
+  public static prefix func - (operand: Self) -> Self {
+    self.init(low: -operand.low, high: -operand.high)
+  }
+
+  @_transparent
+  public mutating func negate() {
+    low.negate()
+    high.negate()
+  }
+}
+
+// MARK: - Conformance to AlgebraicField
+extension SIMDXPairStorage: AlgebraicField where Half: AlgebraicField {
+  @_transparent
+  public static func / (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low / rhs.low, high: lhs.high / rhs.high)
+  }
+
+  @_transparent
+  public static func /= (lhs: inout Self, rhs: Self) {
+    lhs = lhs / rhs
+  }
+}
+
+// MARK: - Conformance to SIMDXScalarArithmetic
+extension SIMDXPairStorage: SIMDXScalarArithmetic where Half: SIMDXScalarArithmetic {
+  @_transparent
+  public static func + (lhs: Self, rhs: Element) -> Self {
+    self.init(low: lhs.low + rhs, high: lhs.high + rhs)
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Element) -> Self {
+    self.init(low: lhs.low - rhs, high: lhs.high - rhs)
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Element) -> Self {
+    self.init(low: lhs.low * rhs, high: lhs.high * rhs)
+  }
+
+  @_transparent
+  public static func / (lhs: Self, rhs: Element) -> Self {
+    self.init(low: lhs.low / rhs, high: lhs.high / rhs)
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Element) -> Self {
+    Self(low: low.addingProduct(lhs.low, rhs), high: high.addingProduct(lhs.high, rhs))
+  }
+
+  @_transparent
+  public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+    Self(low: low.addingProduct(lhs.low, rhs.low), high: high.addingProduct(lhs.high, rhs.high))
+  }
+}
+
+// MARK: - Conformance to SIMDXBinaryIntegerStorage
+extension SIMDXPairStorage: SIMDXBinaryIntegerStorage where Half: SIMDXBinaryIntegerStorage {
+  @_transparent
+  public prefix static func ~ (operand: Self) -> Self {
+    self.init(low: ~operand.low, high: ~operand.high)
+  }
+
+  @_transparent
+  public static func & (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low & rhs.low, high: lhs.high & rhs.high)
+  }
+
+  @_transparent
+  public static func | (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low | rhs.low, high: lhs.high | rhs.high)
+  }
+
+  @_transparent
+  public static func ^ (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low ^ rhs.low, high: lhs.high ^ rhs.high)
+  }
+
+  @_transparent
+  public static func >> <RHS: BinaryInteger>(lhs: Self, rhs: RHS) -> Self {
+    self.init(low: lhs.low >> rhs, high: lhs.high >> rhs)
+  }
+
+  @_transparent
+  public static func << <RHS: BinaryInteger>(lhs: Self, rhs: RHS) -> Self {
+    self.init(low: lhs.low << rhs, high: lhs.high << rhs)
+  }
+}
+
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension SIMDXPairStorage: SIMDXFixedWidthIntegerStorage where Half: SIMDXFixedWidthIntegerStorage {
+  @_transparent
+  public static func >> (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low >> rhs.low, high: lhs.high >> rhs.high)
+  }
+
+  @_transparent
+  public static func << (lhs: Self, rhs: Self) -> Self {
+    self.init(low: lhs.low << rhs.low, high: lhs.high << rhs.high)
+  }
+
+  @_transparent
+  public var nonzeroBitCount: Self {
+    Self(low: low.nonzeroBitCount, high: high.nonzeroBitCount)
+  }
+
+  @_transparent
+  public var leadingZeroBitCount: Self {
+    Self(low: low.leadingZeroBitCount, high: high.leadingZeroBitCount)
+  }
+
+  @_transparent
+  public var trailingZeroBitCount: Self {
+    Self(low: low.trailingZeroBitCount, high: high.trailingZeroBitCount)
+  }
+
+  @_transparent
+  public var byteSwapped: Self {
+    Self(low: low.byteSwapped, high: high.byteSwapped)
+  }
+
+  @_transparent
+  public var bitReversed: Self {
+    Self(low: low.bitReversed, high: high.bitReversed)
+  }
+}
+
+// MARK: - Conformance to SIMDXReduction
+// The sum adds both halves first, just like a storage folds its own upper half
+// onto the lower one, so that the elements are summed in the same order as by
+// a single storage of all elements.
+extension SIMDXPairStorage: SIMDXReduction where Half: SIMDXReduction & AdditiveArithmetic {
+  @_transparent
+  public func sum() -> Element {
+    (low + high).sum()
+  }
+
+  @_transparent
+  public func minimum() -> Element {
+    let (low, high) = (low.minimum(), high.minimum())
+    return high < low ? high : low
+  }
+
+  @_transparent
+  public func maximum() -> Element {
+    let (low, high) = (low.maximum(), high.maximum())
+    return high > low ? high : low
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension SIMDXPairStorage: SIMDXComparisonStorage where Half: SIMDXComparisonStorage {
+  public typealias MaskStorage = SIMDXPairStorage<Half.MaskStorage>
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(low: .compareEqual(lhs.low, rhs.low), high: .compareEqual(lhs.high, rhs.high))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(low: .compareLessThan(lhs.low, rhs.low), high: .compareLessThan(lhs.high, rhs.high))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(
+      low: .compareLessThanOrEqual(lhs.low, rhs.low),
+      high: .compareLessThanOrEqual(lhs.high, rhs.high)
+    )
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(
+      low: .select(mask.low, trueValue.low, falseValue.low),
+      high: .select(mask.high, trueValue.high, falseValue.high)
+    )
+  }
+}
+
+// MARK: - Conformance to SIMDXMaskStorage
+extension SIMDXPairStorage: SIMDXMaskStorage where Half: SIMDXMaskStorage {
+  @_transparent
+  public func any() -> Bool {
+    (low | high).any()
+  }
+
+  @_transparent
+  public func all() -> Bool {
+    (low & high).all()
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension SIMDXPairStorage: SIMDXMinMaxStorage where Half: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(low: .min(lhs.low, rhs.low), high: .min(lhs.high, rhs.high))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(low: .max(lhs.low, rhs.low), high: .max(lhs.high, rhs.high))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    self.init(low: .abs(operand.low), high: .abs(operand.high))
+  }
+}
+
+// MARK: - Conformance to SIMDXIEEEMinMaxStorage
+extension SIMDXPairStorage: SIMDXIEEEMinMaxStorage where Half: SIMDXIEEEMinMaxStorage {
+  @_transparent
+  public static func minimum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(low: .minimum(lhs.low, rhs.low), high: .minimum(lhs.high, rhs.high))
+  }
+
+  @_transparent
+  public static func maximum(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(low: .maximum(lhs.low, rhs.low), high: .maximum(lhs.high, rhs.high))
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension SIMDXPairStorage: SIMDXBitPatternStorage where Half: SIMDXBitPatternStorage {
+  public typealias BitPattern = SIMDXPairStorage<Half.BitPattern>
+
+  @_transparent
+  public init(bitPattern: BitPattern) {
+    self.init(low: Half(bitPattern: bitPattern.low), high: Half(bitPattern: bitPattern.high))
+  }
+
+  @_transparent
+  public var bitPattern: BitPattern {
+    BitPattern(low: low.bitPattern, high: high.bitPattern)
+  }
+}
+
+// MARK: - Cardinality
+extension SIMDXPairStorage: SIMDX8Storage where Half: SIMDX4Storage {
+  @_transparent
+  public init(
+    _ element0: Element,
+    _ element1: Element,
+    _ element2: Element,
+    _ element3: Element,
+    _ element4: Element,
+    _ element5: Element,
+    _ element6: Element,
+    _ element7: Element
+  ) {
+    self.init(
+      low: Half(element0, element1, element2, element3),
+      high: Half(element4, element5, element6, element7)
+    )
+  }
+}
+
+extension SIMDXPairStorage: SIMDX16Storage where Half: SIMDX8Storage {}
+extension SIMDXPairStorage: SIMDX32Storage where Half: SIMDX16Storage {}
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+import RealModule
+
 /// A protocol to address highly efficient and for parallel processing optimized
 /// `SIMD` register types.
 ///
@@ -31,6 +33,17 @@ public protocol SIMDXStorage: MutableCollection where Index == CInt {
   /// - Precondition: The array must be of same length as the raw SIMD storage.
   /// - Parameter sequence: Values used, in order, for the storage initalization
   init(_ array: [Element])
+
+  /// Initialize to a raw SIMD storage with values equal to values in the
+  /// buffer, loaded at once without copying them first.
+  ///
+  /// - Precondition: The buffer must be of same length as the raw SIMD storage.
+  init(_ buffer: UnsafeBufferPointer<Element>)
+
+  /// Initialize to a raw SIMD storage with values equal to as many values at
+  /// `pointer`, loaded at once from unaligned memory. No value beyond these is
+  /// read.
+  init(loadingFrom pointer: UnsafePointer<Element>)
 }
 
 // MARK: - Basic Properties
@@ -49,12 +62,70 @@ extension SIMDXStorage {
   }
 
   /// Initialize to a raw SIMD storage with values equal to values in the
-  /// sequence.
+  /// sequence. A sequence of contiguous elements, such as an array or a
+  /// buffer slice, is loaded in place, any other is copied to an array first.
   ///
   /// - Precondition: The sequence must be of same length as the storage.
   /// - Parameter sequence: Values used, in order, for the storage initalization
-  init<Other: Sequence>(_ sequence: Other) where Other.Element == Self.Element {
-    self.init(Array(sequence))
+  @inlinable
+  public init<Other: Sequence>(_ sequence: Other) where Other.Element == Self.Element {
+    self = sequence.withContiguousStorageIfAvailable { Self($0) } ?? Self(Array(sequence))
+  }
+
+  /// Initialize to a raw SIMD storage with values equal to values in the
+  /// slice, loaded in place.
+  ///
+  /// - Precondition: The slice must be of same length as the storage.
+  @_transparent
+  public init(_ slice: ArraySlice<Element>) {
+    self = slice.withUnsafeBufferPointer { Self($0) }
+  }
+
+  /// Initialize to a raw SIMD storage with values equal to values in the
+  /// array, loaded in place.
+  ///
+  /// - Precondition: The array must be of same length as the storage.
+  @_transparent
+  public init(_ array: ContiguousArray<Element>) {
+    self = array.withUnsafeBufferPointer { Self($0) }
+  }
+}
+
+// MARK: - Hashing
+extension SIMDXStorage {
+  /// Feeds the bits of all elements of `storage`, the raw value of this
+  /// storage, to `hasher` at once. The lanes that only pad the raw value, e.g.
+  /// the most significant one of a 3 element storage, are left out.
+  @_transparent
+  func combineElements<RawValue>(of storage: RawValue, into hasher: inout Hasher) {
+    withUnsafeBytes(of: storage) { bytes in
+      hasher.combine(bytes: UnsafeRawBufferPointer(rebasing: bytes.prefix(count * MemoryLayout<Element>.stride)))
+    }
+  }
+}
+
+// MARK: - Bridging
+extension SIMDXStorage {
+  /// Initialize to the elements of `vector`, a standard library SIMD vector of
+  /// as many elements, by reinterpreting its bits. Both have the same size and
+  /// lane order, which makes this no instruction at all once inlined, except
+  /// for a 2 x Float32 storage held in a 128-bit register on x86, whose unused
+  /// upper half is filled with the first element.
+  @_transparent @usableFromInline
+  init<Vector: SIMD>(bitCasting vector: Vector) where Vector.Scalar == Element {
+    if MemoryLayout<Self>.size == MemoryLayout<Vector>.size {
+      self = unsafeBitCast(vector, to: Self.self)
+    } else {
+      self.init(repeating: vector[0])
+      withUnsafeMutableBytes(of: &self) { $0.storeBytes(of: vector, as: Vector.self) }
+    }
+  }
+
+  /// Reinterprets the bits of the leading elements of this storage as a
+  /// standard library SIMD vector of as many elements.
+  @_transparent @usableFromInline
+  func bitCast<Vector: SIMD>(to type: Vector.Type) -> Vector where Vector.Scalar == Element {
+    withUnsafeBytes(of: self) { $0.load(as: Vector.self) }
   }
 }
 
@@ -68,6 +139,185 @@ extension SIMDXStorage where Element: ExpressibleByIntegerLiteral {
   }
 }
 
+// MARK: - Scalar Arithmetic
+
+/// A raw SIMD storage of floating-point values, that combines each of its
+/// elements with a single element directly, e.g. by a multiply by scalar
+/// instruction, rather than with a storage of that element repeated first.
+public protocol SIMDXScalarArithmetic: SIMDXStorage, AlgebraicField where Element: FloatingPoint {
+  /// Adds `rhs` to each element of `lhs`.
+  static func + (lhs: Self, rhs: Element) -> Self
+
+  /// Subtracts `rhs` from each element of `lhs`.
+  static func - (lhs: Self, rhs: Element) -> Self
+
+  /// Multiplies each element of `lhs` by `rhs`.
+  static func * (lhs: Self, rhs: Element) -> Self
+
+  /// Divides each element of `lhs` by `rhs`.
+  static func / (lhs: Self, rhs: Element) -> Self
+
+  /// The sum of this storage and the product of `lhs` and `rhs`, computed
+  /// with a single rounding if the target has a fused multiply-add.
+  func addingProduct(_ lhs: Self, _ rhs: Element) -> Self
+
+  /// The sum of this storage and the element-wise product of `lhs` and `rhs`,
+  /// computed with a single rounding if the target has a fused multiply-add.
+  func addingProduct(_ lhs: Self, _ rhs: Self) -> Self
+}
+
+// MARK: - Integer Arithmetic
+
+/// A raw SIMD storage of integer values, that combines and shifts the bits of
+/// all its elements at once.
+public protocol SIMDXBinaryIntegerStorage: SIMDXStorage, Numeric where Element: BinaryInteger {
+  /// Inverts all bits of each element.
+  prefix static func ~ (operand: Self) -> Self
+
+  /// The bitwise AND of both storages (element-wise).
+  static func & (lhs: Self, rhs: Self) -> Self
+
+  /// The bitwise OR of both storages (element-wise).
+  static func | (lhs: Self, rhs: Self) -> Self
+
+  /// The bitwise XOR of both storages (element-wise).
+  static func ^ (lhs: Self, rhs: Self) -> Self
+
+  /// Right-shifts each element by `rhs` bits.
+  static func >> <RHS: BinaryInteger>(lhs: Self, rhs: RHS) -> Self
+
+  /// Left-shifts each element by `rhs` bits.
+  static func << <RHS: BinaryInteger>(lhs: Self, rhs: RHS) -> Self
+}
+
+/// A raw SIMD storage of fixed-width integer values, that in addition shifts
+/// each element by its own count and counts the bits of each element.
+public protocol SIMDXFixedWidthIntegerStorage: SIMDXBinaryIntegerStorage where Element: FixedWidthInteger {
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  static func >> (lhs: Self, rhs: Self) -> Self
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  static func << (lhs: Self, rhs: Self) -> Self
+
+  /// The number of bits equal to 1 in each element.
+  var nonzeroBitCount: Self { get }
+
+  /// The number of leading zero bits in each element.
+  var leadingZeroBitCount: Self { get }
+
+  /// The number of trailing zero bits in each element.
+  var trailingZeroBitCount: Self { get }
+
+  /// The storage with the bytes of each element in reversed order.
+  var byteSwapped: Self { get }
+
+  /// The storage with the bits of each element in reversed order.
+  var bitReversed: Self { get }
+}
+
+// MARK: - Reduction
+
+/// A raw SIMD storage, that reduces all its elements to a single one by
+/// folding the upper half of its elements onto the lower half until a single
+/// element is left, in the same order on every target.
+public protocol SIMDXReduction: SIMDXStorage where Element: Comparable & AdditiveArithmetic {
+  /// The sum of all elements.
+  func sum() -> Element
+
+  /// The least element. Whether a NaN element is returned depends on its lane.
+  func minimum() -> Element
+
+  /// The greatest element. Whether a NaN element is returned depends on its lane.
+  func maximum() -> Element
+}
+
+// MARK: - Comparison
+
+/// A raw SIMD storage of integer values, that is the result of a lane-wise
+/// comparison, with all bits set in the lanes where it holds and none in the
+/// others.
+public protocol SIMDXMaskStorage: SIMDXFixedWidthIntegerStorage, Hashable {
+  /// Whether any lane is set, tested for all lanes at once.
+  func any() -> Bool
+
+  /// Whether all lanes are set, tested for all lanes at once.
+  func all() -> Bool
+}
+
+/// A raw SIMD storage, that compares its elements lane by lane to a mask, and
+/// selects the elements of either of two storages by such a mask, without a
+/// branch.
+public protocol SIMDXComparisonStorage: SIMDXStorage {
+  /// The mask storage of as many lanes as this storage.
+  associatedtype MaskStorage: SIMDXMaskStorage
+
+  /// The mask of the lanes where `lhs == rhs`, which is never the case for a
+  /// NaN element.
+  static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage
+
+  /// The mask of the lanes where `lhs < rhs`, which is never the case for a
+  /// NaN element.
+  static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage
+
+  /// The mask of the lanes where `lhs <= rhs`, which is never the case for a
+  /// NaN element.
+  static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage
+
+  /// The elements of `trueValue` in the lanes set in `mask`, and the elements
+  /// of `falseValue` in the others.
+  static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self
+}
+
+// MARK: - Minimum & Maximum
+
+/// A raw SIMD storage, that selects the lesser or greater of two elements and
+/// the absolute value of an element lane by lane, each by the single
+/// instruction of the target.
+public protocol SIMDXMinMaxStorage: SIMDXStorage where Element: Comparable {
+  /// The lesser element of each lane. A floating-point lane is `rhs` if
+  /// either element is NaN or both are zero on x86, and NaN on Arm if either
+  /// element is NaN.
+  static func min(_ lhs: Self, _ rhs: Self) -> Self
+
+  /// The greater element of each lane. A floating-point lane is `rhs` if
+  /// either element is NaN or both are zero on x86, and NaN on Arm if either
+  /// element is NaN.
+  static func max(_ lhs: Self, _ rhs: Self) -> Self
+
+  /// The absolute value of each element. The minimum of a signed integer
+  /// element wraps around to itself.
+  static func abs(_ operand: Self) -> Self
+}
+
+/// A raw SIMD storage of floating-point values, that also selects the lesser
+/// or greater of two elements as the IEEE 754-2019 `minimum` and `maximum`
+/// operations, i.e. NaN if either element is NaN and -0.0 before +0.0.
+///
+/// Note that this differs from `FloatingPoint.minimum(_:_:)`, which returns
+/// the number if only one of both elements is NaN.
+public protocol SIMDXIEEEMinMaxStorage: SIMDXMinMaxStorage where Element: FloatingPoint {
+  /// The lesser element of each lane, NaN if either element is NaN.
+  static func minimum(_ lhs: Self, _ rhs: Self) -> Self
+
+  /// The greater element of each lane, NaN if either element is NaN.
+  static func maximum(_ lhs: Self, _ rhs: Self) -> Self
+}
+
+// MARK: - Bit Pattern
+
+/// A raw SIMD storage, whose bits are reinterpreted as a storage of unsigned
+/// integers of the same width and count, and back, without any instruction.
+public protocol SIMDXBitPatternStorage: SIMDXStorage {
+  /// The storage of unsigned integers of the same width and count.
+  associatedtype BitPattern: SIMDXFixedWidthIntegerStorage where BitPattern.Element: UnsignedInteger
+
+  /// Initialize a raw SIMD storage to the bits of `bitPattern`.
+  init(bitPattern: BitPattern)
+
+  /// The bits of each element, as an unsigned integer.
+  var bitPattern: BitPattern { get }
+}
+
 // MARK: - Cardinality
 
 /// A raw SIMD register type of exactly 2 values
@@ -98,6 +348,38 @@ extension SIMDX3Storage {
   public var endIndex: Index { 3 }
 }
 
+/// A raw SIMD register type of exactly 3 floating-point values, that are
+/// interpreted as a vector in three dimensional space.
+public protocol SIMDX3GeometricStorage: SIMDX3Storage where Element: FloatingPoint {
+  /// The dot product of both vectors.
+  static func dot(_ lhs: Self, _ rhs: Self) -> Element
+
+  /// The cross product of both vectors.
+  static func cross(_ lhs: Self, _ rhs: Self) -> Self
+
+  /// The distance between both vectors, interpreted as points.
+  static func distance(_ lhs: Self, _ rhs: Self) -> Element
+
+  /// The length of the vector.
+  var length: Element { get }
+
+  /// The squared length of the vector.
+  var lengthSquared: Element { get }
+
+  /// The vector scaled to unit length.
+  func normalized() -> Self
+
+  /// The vector scaled to approximately unit length, using a reciprocal
+  /// square root estimate instead of a square root and a division.
+  func fastNormalized() -> Self
+
+  /// The vector reflected off the surface with given unit length `normal`.
+  func reflected(off normal: Self) -> Self
+
+  /// The vector projected onto the direction of `other`.
+  func projected(onto other: Self) -> Self
+}
+
 /// A raw SIMD register type of exactly 4 values
 public protocol SIMDX4Storage: SIMDXStorage {
   /// Initialize a raw SIMD register type to specified elements.
@@ -116,3 +398,48 @@ extension SIMDX4Storage {
   @_transparent
   public var endIndex: Index { 4 }
 }
+
+/// A raw SIMD register type of exactly 8 values
+public protocol SIMDX8Storage: SIMDXStorage {
+  /// Initialize a raw SIMD register type to specified elements.
+  init(
+    _ element0: Element,
+    _ element1: Element,
+    _ element2: Element,
+    _ element3: Element,
+    _ element4: Element,
+    _ element5: Element,
+    _ element6: Element,
+    _ element7: Element
+  )
+}
+
+extension SIMDX8Storage {
+  @_transparent
+  public var count: Int { 8 }
+
+  @_transparent
+  public var endIndex: Index { 8 }
+}
+
+/// A raw SIMD register type of exactly 16 values
+public protocol SIMDX16Storage: SIMDXStorage {}
+
+extension SIMDX16Storage {
+  @_transparent
+  public var count: Int { 16 }
+
+  @_transparent
+  public var endIndex: Index { 16 }
+}
+
+/// A raw SIMD register type of exactly 32 values
+public protocol SIMDX32Storage: SIMDXStorage {}
+
+extension SIMDX32Storage {
+  @_transparent
+  public var count: Int { 32 }
+
+  @_transparent
+  public var endIndex: Index { 32 }
+}
@@ -43,8 +43,18 @@ extension UInt32x2: ExpressibleByIntegerLiteral {
   @_transparent
   public init(_ array: [UInt32]) {
     precondition(array.count == 2, "Array must contain exactly 2 elements")
-    var array = array
-    self.init(rawValue: CUInt32x2MakeLoad(&array))
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<UInt32>) {
+    precondition(buffer.count == 2, "Buffer must contain exactly 2 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<UInt32>) {
+    self.init(rawValue: CUInt32x2MakeLoad(pointer))
   }
 }
 
@@ -66,16 +76,14 @@ extension UInt32x2 {
 extension UInt32x2: Equatable {
   @_transparent
   public static func == (lhs: Self, rhs: Self) -> Bool {
-    let cmp = CUInt32x2CompareElementWise(lhs.rawValue, rhs.rawValue)
-    return lhs.indices.allSatisfy { CUInt32x2GetElement(cmp, $0) != .zero }
+    CUInt32x2Equal(lhs.rawValue, rhs.rawValue)
   }
 }
 
 // MARK: - Conformance to Hashable
 extension UInt32x2: Hashable {
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(CUInt32x2GetElement(rawValue, 0))
-    hasher.combine(CUInt32x2GetElement(rawValue, 1))
+    combineElements(of: rawValue, into: &hasher)
   }
 }
 
@@ -125,8 +133,8 @@ extension UInt32x2: Numeric {
   }
 }
 
-// MARK: - Bitwise
-extension UInt32x2 {
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension UInt32x2: SIMDXFixedWidthIntegerStorage {
 
   @_transparent
   public prefix static func ~ (operand: UInt32x2) -> UInt32x2 {
@@ -155,7 +163,7 @@ extension UInt32x2 {
     lhs: UInt32x2,
     rhs: RHS
   ) -> UInt32x2 where RHS: BinaryInteger {
-    self.init(rawValue: CUInt32x2ShiftLeft(lhs.rawValue, numericCast(rhs)))
+    self.init(rawValue: CUInt32x2ShiftRight(lhs.rawValue, numericCast(rhs)))
   }
 
   @_transparent
@@ -163,6 +171,105 @@ extension UInt32x2 {
     lhs: UInt32x2,
     rhs: RHS
   ) -> UInt32x2 where RHS: BinaryInteger {
-    self.init(rawValue: CUInt32x2ShiftRight(lhs.rawValue, numericCast(rhs)))
+    self.init(rawValue: CUInt32x2ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: UInt32x2, rhs: UInt32x2) -> UInt32x2 {
+    self.init(rawValue: CUInt32x2ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: UInt32x2, rhs: UInt32x2) -> UInt32x2 {
+    self.init(rawValue: CUInt32x2ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension UInt32x2 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: UInt32x2 {
+    UInt32x2(rawValue: CUInt32x2PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: UInt32x2 {
+    UInt32x2(rawValue: CUInt32x2LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: UInt32x2 {
+    UInt32x2(rawValue: CUInt32x2TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: UInt32x2 {
+    UInt32x2(rawValue: CUInt32x2ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: UInt32x2 {
+    UInt32x2(rawValue: CUInt32x2BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension UInt32x2: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x2
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x2CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x2CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x2CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CUInt32x2Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
   }
 }
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension UInt32x2: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x2Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x2Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    operand
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension UInt32x2: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x2) {
+    self = bitPattern
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x2 { self }
+}
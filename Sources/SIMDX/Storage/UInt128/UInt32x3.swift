@@ -1,125 +1,275 @@
-//// Copyright 2019 Markus Winter
-////
-//// Licensed under the Apache License, Version 2.0 (the "License");
-//// you may not use this file except in compliance with the License.
-//// You may obtain a copy of the License at
-////
-////     http://www.apache.org/licenses/LICENSE-2.0
-////
-//// Unless required by applicable law or agreed to in writing, software
-//// distributed under the License is distributed on an "AS IS" BASIS,
-//// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-//// See the License for the specific language governing permissions and
-//// limitations under the License.
-//
-//import Foundation
-//import CSIMDX
-//
-//public struct UInt32x3: RawStorage3, FixedWidthIntegerStorage, UnsignedIntegerStorage {
-//
-//    // MARK: Collection
-//
-//    @inlinable public var count: Int { 3 }
-//    @inlinable public var startIndex: Int32 { 0 }
-//    @inlinable public var endIndex: Int32 { 3 }
-//
-//    // MARK: RawValue
-//
-//    public var rawValue: CXUInt32x3
-//
-//    @inlinable public subscript(index: Int32) -> UInt32 {
-//        @inlinable set { CXUInt32x3SetElement(&rawValue, index, newValue) }
-//        @inlinable get { CXUInt32x3GetElement(rawValue, index) }
-//    }
-//
-//    @inlinable public init(rawValue: CXUInt32x3) {
-//        self.rawValue = rawValue
-//    }
-//}
-//
-//// MARK: - Initializer
-//extension UInt32x3 {
-//
-//    @inlinable public init(_ repeatingElement: UInt32) {
-//        self.init(rawValue: CXUInt32x3MakeRepeatingElement(repeatingElement))
-//    }
-//
-//    @inlinable public init(_ index0: UInt32, _ index1: UInt32, _ index2: UInt32) {
-//        self.init(rawValue: CXUInt32x3Make(index0, index1, index2))
-//    }
-//
-//    @inlinable public init(_ array: [UInt32]) {
-//        var array = array
-//        self.init(rawValue: CXUInt32x3MakeLoad(&array))
-//    }
-//
-//    @inlinable public init<Other>(_ sequence: Other) where Other: Sequence, Other.Element == UInt32 {
-//        self.init(Array(sequence))
-//    }
-//}
-//
-//// MARK: - Comparison
-//extension UInt32x3 {
-//
-//    @inlinable public static func minimum(_ lhs: UInt32x3, _ rhs: UInt32x3) -> UInt32x3 {
-//        .init(rawValue: CXUInt32x3Minimum(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func maximum(_ lhs: UInt32x3, _ rhs: UInt32x3) -> UInt32x3 {
-//        .init(rawValue: CXUInt32x3Maximum(lhs.rawValue, rhs.rawValue))
-//    }
-//}
-//
-//// MARK: - Bitwise
-//extension UInt32x3 {
-//
-//    @inlinable public  prefix static func ~ (operand: UInt32x3) -> UInt32x3 {
-//        return .init(rawValue: CXUInt32x3BitwiseNot(operand.rawValue))
-//    }
-//
-//    @inlinable public static func & (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
-//        return .init(rawValue: CXUInt32x3BitwiseAnd(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func | (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
-//        return .init(rawValue: CXUInt32x3BitwiseOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func ^ (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
-//        return .init(rawValue: CXUInt32x3BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    // MARK: Shifting
-//
-//    @inlinable public static func >> <RHS>(lhs: UInt32x3, rhs: RHS) -> UInt32x3 where RHS: BinaryInteger {
-//        return .init(rawValue: CXUInt32x3ShiftLeft(lhs.rawValue, numericCast(rhs)))
-//    }
-//
-//    @inlinable public static func << <RHS>(lhs: UInt32x3, rhs: RHS) -> UInt32x3 where RHS: BinaryInteger {
-//        return .init(rawValue: CXUInt32x3ShiftRight(lhs.rawValue, numericCast(rhs)))
-//    }
-//}
-//
-//// MARK: - Arithmetics
-//extension UInt32x3 {
-//
-//    @inlinable public static var zero: UInt32x3 { .init(rawValue: CXUInt32x3MakeZero()) }
-//
-//    @inlinable public var magnitude: UInt32x3 { .init(rawValue: CXUInt32x3Magnitude(rawValue)) }
-//
-//    // MARK: Additive
-//
-//    @inlinable public static func + (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
-//        .init(rawValue: CXUInt32x3Add(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func - (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3  {
-//        .init(rawValue: CXUInt32x3Subtract(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    // MARK: Multiplicative
-//
-//    @inlinable public static func * (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3  {
-//        .init(rawValue: CXUInt32x3Multiply(lhs.rawValue, rhs.rawValue))
-//    }
-//}
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct UInt32x3: SIMDXStorage, SIMDX3Storage {
+  public typealias RawValue = CUInt32x3
+  public typealias Element = UInt32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension UInt32x3: ExpressibleByIntegerLiteral {
+  @_transparent
+  public init(_ index0: Element, _ index1: Element, _ index2: Element) {
+    self.init(rawValue: CUInt32x3Make(index0, index1, index2))
+  }
+
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CUInt32x3MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [UInt32]) {
+    precondition(array.count == 3, "Array must contain exactly 3 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<UInt32>) {
+    precondition(buffer.count == 3, "Buffer must contain exactly 3 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<UInt32>) {
+    self.init(rawValue: CUInt32x3MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension UInt32x3 {
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      CUInt32x3SetElement(&rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CUInt32x3GetElement(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension UInt32x3: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CUInt32x3Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension UInt32x3: Hashable {
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: rawValue, into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension UInt32x3: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CUInt32x3MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x3Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CUInt32x3Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension UInt32x3: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    return indices.reduce(into: CUInt32x3GetElement(rawValue, 0)) {
+      $0 = Swift.max($0, CUInt32x3GetElement(rawValue, $1))
+    }
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CUInt32x3Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CUInt32x3MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension UInt32x3: SIMDXFixedWidthIntegerStorage {
+
+  @_transparent
+  public prefix static func ~ (operand: UInt32x3) -> UInt32x3 {
+    self.init(rawValue: CUInt32x3BitwiseNot(operand.rawValue))
+  }
+
+  @_transparent
+  public static func & (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
+    self.init(rawValue: CUInt32x3BitwiseAnd(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func | (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
+    self.init(rawValue: CUInt32x3BitwiseOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func ^ (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
+    self.init(rawValue: CUInt32x3BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  // MARK: Shifting
+
+  @_transparent
+  public static func >> <RHS>(
+    lhs: UInt32x3,
+    rhs: RHS
+  ) -> UInt32x3 where RHS: BinaryInteger {
+    self.init(rawValue: CUInt32x3ShiftRight(lhs.rawValue, numericCast(rhs)))
+  }
+
+  @_transparent
+  public static func << <RHS>(
+    lhs: UInt32x3,
+    rhs: RHS
+  ) -> UInt32x3 where RHS: BinaryInteger {
+    self.init(rawValue: CUInt32x3ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
+    self.init(rawValue: CUInt32x3ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: UInt32x3, rhs: UInt32x3) -> UInt32x3 {
+    self.init(rawValue: CUInt32x3ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension UInt32x3 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: UInt32x3 {
+    UInt32x3(rawValue: CUInt32x3PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: UInt32x3 {
+    UInt32x3(rawValue: CUInt32x3LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: UInt32x3 {
+    UInt32x3(rawValue: CUInt32x3TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: UInt32x3 {
+    UInt32x3(rawValue: CUInt32x3ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: UInt32x3 {
+    UInt32x3(rawValue: CUInt32x3BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension UInt32x3: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x3
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x3CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x3CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x3CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CUInt32x3Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension UInt32x3: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x3Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x3Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    operand
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension UInt32x3: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x3) {
+    self = bitPattern
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x3 { self }
+}
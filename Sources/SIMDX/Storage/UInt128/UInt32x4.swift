@@ -1,125 +1,280 @@
-//// Copyright 2019 Markus Winter
-////
-//// Licensed under the Apache License, Version 2.0 (the "License");
-//// you may not use this file except in compliance with the License.
-//// You may obtain a copy of the License at
-////
-////     http://www.apache.org/licenses/LICENSE-2.0
-////
-//// Unless required by applicable law or agreed to in writing, software
-//// distributed under the License is distributed on an "AS IS" BASIS,
-//// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-//// See the License for the specific language governing permissions and
-//// limitations under the License.
-//
-//import Foundation
-//import CSIMDX
-//
-//public struct UInt32x4: RawStorage4, FixedWidthIntegerStorage, UnsignedIntegerStorage {
-//
-//    // MARK: Collection
-//
-//    @inlinable public var count: Int { 4 }
-//    @inlinable public var startIndex: Int32 { 0 }
-//    @inlinable public var endIndex: Int32 { 4 }
-//
-//    // MARK: RawValue
-//
-//    public var rawValue: CXUInt32x4
-//
-//    @inlinable public subscript(index: Int32) -> UInt32 {
-//        @inlinable set { CXUInt32x4SetElement(&rawValue, index, newValue) }
-//        @inlinable get { CXUInt32x4GetElement(rawValue, index) }
-//    }
-//
-//    @inlinable public init(rawValue: CXUInt32x4) {
-//        self.rawValue = rawValue
-//    }
-//}
-//
-//// MARK: - Initializer
-//extension UInt32x4 {
-//
-//    @inlinable public init(_ repeatingElement: UInt32) {
-//        self.init(rawValue: CXUInt32x4MakeRepeatingElement(repeatingElement))
-//    }
-//
-//    @inlinable public init(_ index0: UInt32, _ index1: UInt32, _ index2: UInt32, _ index3: UInt32) {
-//        self.init(rawValue: CXUInt32x4Make(index0, index1, index2, index3))
-//    }
-//
-//    @inlinable public init(_ array: [UInt32]) {
-//        var array = array
-//        self.init(rawValue: CXUInt32x4MakeLoad(&array))
-//    }
-//
-//    @inlinable public init<Other>(_ sequence: Other) where Other: Sequence, Other.Element == UInt32 {
-//        self.init(Array(sequence))
-//    }
-//}
-//
-//// MARK: - Comparison
-//extension UInt32x4 {
-//
-//    @inlinable public static func minimum(_ lhs: UInt32x4, _ rhs: UInt32x4) -> UInt32x4 {
-//        .init(rawValue: CXUInt32x4Minimum(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func maximum(_ lhs: UInt32x4, _ rhs: UInt32x4) -> UInt32x4 {
-//        .init(rawValue: CXUInt32x4Maximum(lhs.rawValue, rhs.rawValue))
-//    }
-//}
-//
-//// MARK: - Bitwise
-//extension UInt32x4 {
-//
-//    @inlinable public  prefix static func ~ (operand: UInt32x4) -> UInt32x4 {
-//        return .init(rawValue: CXUInt32x4BitwiseNot(operand.rawValue))
-//    }
-//
-//    @inlinable public static func & (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
-//        return .init(rawValue: CXUInt32x4BitwiseAnd(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func | (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
-//        return .init(rawValue: CXUInt32x4BitwiseOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func ^ (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
-//        return .init(rawValue: CXUInt32x4BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    // MARK: Shifting
-//
-//    @inlinable public static func >> <RHS>(lhs: UInt32x4, rhs: RHS) -> UInt32x4 where RHS: BinaryInteger {
-//        return .init(rawValue: CXUInt32x4ShiftLeft(lhs.rawValue, numericCast(rhs)))
-//    }
-//
-//    @inlinable public static func << <RHS>(lhs: UInt32x4, rhs: RHS) -> UInt32x4 where RHS: BinaryInteger {
-//        return .init(rawValue: CXUInt32x4ShiftRight(lhs.rawValue, numericCast(rhs)))
-//    }
-//}
-//
-//// MARK: - Arithmetics
-//extension UInt32x4 {
-//
-//    @inlinable public static var zero: UInt32x4 { .init(rawValue: CXUInt32x4MakeZero()) }
-//
-//    @inlinable public var magnitude: UInt32x4 { .init(rawValue: CXUInt32x4Magnitude(rawValue)) }
-//
-//    // MARK: Additive
-//
-//    @inlinable public static func + (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
-//        .init(rawValue: CXUInt32x4Add(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    @inlinable public static func - (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4  {
-//        .init(rawValue: CXUInt32x4Subtract(lhs.rawValue, rhs.rawValue))
-//    }
-//
-//    // MARK: Multiplicative
-//
-//    @inlinable public static func * (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4  {
-//        .init(rawValue: CXUInt32x4Multiply(lhs.rawValue, rhs.rawValue))
-//    }
-//}
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct UInt32x4: SIMDXStorage, SIMDX4Storage {
+  public typealias RawValue = CUInt32x4
+  public typealias Element = UInt32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension UInt32x4: ExpressibleByIntegerLiteral {
+  @_transparent
+  public init(
+    _ index0: Element,
+    _ index1: Element,
+    _ index2: Element,
+    _ index3: Element
+  ) {
+    self.init(rawValue: CUInt32x4Make(index0, index1, index2, index3))
+  }
+
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CUInt32x4MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [UInt32]) {
+    precondition(array.count == 4, "Array must contain exactly 4 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<UInt32>) {
+    precondition(buffer.count == 4, "Buffer must contain exactly 4 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<UInt32>) {
+    self.init(rawValue: CUInt32x4MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension UInt32x4 {
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      CUInt32x4SetElement(&rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CUInt32x4GetElement(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension UInt32x4: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CUInt32x4Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension UInt32x4: Hashable {
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: rawValue, into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension UInt32x4: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CUInt32x4MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x4Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CUInt32x4Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension UInt32x4: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    return indices.reduce(into: CUInt32x4GetElement(rawValue, 0)) {
+      $0 = Swift.max($0, CUInt32x4GetElement(rawValue, $1))
+    }
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CUInt32x4Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CUInt32x4MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension UInt32x4: SIMDXFixedWidthIntegerStorage {
+
+  @_transparent
+  public prefix static func ~ (operand: UInt32x4) -> UInt32x4 {
+    self.init(rawValue: CUInt32x4BitwiseNot(operand.rawValue))
+  }
+
+  @_transparent
+  public static func & (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
+    self.init(rawValue: CUInt32x4BitwiseAnd(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func | (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
+    self.init(rawValue: CUInt32x4BitwiseOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func ^ (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
+    self.init(rawValue: CUInt32x4BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  // MARK: Shifting
+
+  @_transparent
+  public static func >> <RHS>(
+    lhs: UInt32x4,
+    rhs: RHS
+  ) -> UInt32x4 where RHS: BinaryInteger {
+    self.init(rawValue: CUInt32x4ShiftRight(lhs.rawValue, numericCast(rhs)))
+  }
+
+  @_transparent
+  public static func << <RHS>(
+    lhs: UInt32x4,
+    rhs: RHS
+  ) -> UInt32x4 where RHS: BinaryInteger {
+    self.init(rawValue: CUInt32x4ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
+    self.init(rawValue: CUInt32x4ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: UInt32x4, rhs: UInt32x4) -> UInt32x4 {
+    self.init(rawValue: CUInt32x4ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension UInt32x4 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: UInt32x4 {
+    UInt32x4(rawValue: CUInt32x4PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: UInt32x4 {
+    UInt32x4(rawValue: CUInt32x4LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: UInt32x4 {
+    UInt32x4(rawValue: CUInt32x4TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: UInt32x4 {
+    UInt32x4(rawValue: CUInt32x4ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: UInt32x4 {
+    UInt32x4(rawValue: CUInt32x4BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension UInt32x4: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x4
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x4CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x4CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x4CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CUInt32x4Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension UInt32x4: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x4Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x4Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    operand
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension UInt32x4: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x4) {
+    self = bitPattern
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x4 { self }
+}
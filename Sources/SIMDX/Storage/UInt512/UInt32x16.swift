@@ -0,0 +1,270 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+import RealModule
+
+public struct UInt32x16: SIMDXStorage, SIMDX16Storage {
+  public typealias RawValue = CUInt32x16
+  public typealias Element = UInt32
+
+  @_alwaysEmitIntoClient
+  public var rawValue: RawValue
+
+  @_alwaysEmitIntoClient
+  public init(rawValue: RawValue) {
+    self.rawValue = rawValue
+  }
+}
+
+// MARK: - Additional Initializers
+extension UInt32x16: ExpressibleByIntegerLiteral {
+  @_transparent
+  public init(repeating repeatingElement: Element) {
+    self.init(rawValue: CUInt32x16MakeRepeatingElement(repeatingElement))
+  }
+
+  @_transparent
+  public init(_ array: [UInt32]) {
+    precondition(array.count == 16, "Array must contain exactly 16 elements")
+    self = array.withUnsafeBufferPointer { Self(loadingFrom: $0.baseAddress!) }
+  }
+
+  @_transparent
+  public init(_ buffer: UnsafeBufferPointer<UInt32>) {
+    precondition(buffer.count == 16, "Buffer must contain exactly 16 elements")
+    self.init(loadingFrom: buffer.baseAddress!)
+  }
+
+  @_transparent
+  public init(loadingFrom pointer: UnsafePointer<UInt32>) {
+    self.init(rawValue: CUInt32x16MakeLoad(pointer))
+  }
+}
+
+// MARK: - Conformance to MutableCollection
+extension UInt32x16 {
+  public subscript(index: Index) -> Element {
+    @_transparent set {
+      precondition(indices.contains(index))
+      CUInt32x16SetElement(&rawValue, index, newValue)
+    }
+    @_transparent get {
+      precondition(indices.contains(index))
+      return CUInt32x16GetElement(rawValue, index)
+    }
+  }
+}
+
+// MARK: - Conformance to Equatable
+extension UInt32x16: Equatable {
+  @_transparent
+  public static func == (lhs: Self, rhs: Self) -> Bool {
+    CUInt32x16Equal(lhs.rawValue, rhs.rawValue)
+  }
+}
+
+// MARK: - Conformance to Hashable
+extension UInt32x16: Hashable {
+  public func hash(into hasher: inout Hasher) {
+    combineElements(of: rawValue, into: &hasher)
+  }
+}
+
+// MARK: - Conformance to AdditiveArithmetic
+extension UInt32x16: AdditiveArithmetic {
+  @_transparent
+  public static var zero: Self {
+    self.init(rawValue: CUInt32x16MakeZero())
+  }
+
+  @_transparent
+  public static func + (lhs: Self, rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x16Add(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func - (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CUInt32x16Subtract(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Conformance to Numeric
+extension UInt32x16: Numeric {
+  public typealias Magnitude = Element.Magnitude
+
+  @_alwaysEmitIntoClient
+  public var magnitude: Magnitude {
+    return indices.reduce(into: CUInt32x16GetElement(rawValue, 0)) {
+      $0 = Swift.max($0, CUInt32x16GetElement(rawValue, $1))
+    }
+  }
+
+  @_transparent
+  public static func * (lhs: Self, rhs: Self) -> Self  {
+    self.init(rawValue: CUInt32x16Multiply(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func *= (lhs: inout Self, rhs: Self) {
+    lhs = lhs * rhs
+  }
+
+  @_transparent
+  public init?<T>(exactly source: T) where T : BinaryInteger {
+    guard let exactly = Element(exactly: source) else { return nil }
+    self.init(rawValue: CUInt32x16MakeRepeatingElement(exactly))
+  }
+}
+
+// MARK: - Conformance to SIMDXFixedWidthIntegerStorage
+extension UInt32x16: SIMDXFixedWidthIntegerStorage {
+
+  @_transparent
+  public prefix static func ~ (operand: UInt32x16) -> UInt32x16 {
+    self.init(rawValue: CUInt32x16BitwiseNot(operand.rawValue))
+  }
+
+  @_transparent
+  public static func & (lhs: UInt32x16, rhs: UInt32x16) -> UInt32x16 {
+    self.init(rawValue: CUInt32x16BitwiseAnd(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func | (lhs: UInt32x16, rhs: UInt32x16) -> UInt32x16 {
+    self.init(rawValue: CUInt32x16BitwiseOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func ^ (lhs: UInt32x16, rhs: UInt32x16) -> UInt32x16 {
+    self.init(rawValue: CUInt32x16BitwiseExclusiveOr(lhs.rawValue, rhs.rawValue))
+  }
+
+  // MARK: Shifting
+
+  @_transparent
+  public static func >> <RHS>(
+    lhs: UInt32x16,
+    rhs: RHS
+  ) -> UInt32x16 where RHS: BinaryInteger {
+    self.init(rawValue: CUInt32x16ShiftRight(lhs.rawValue, numericCast(rhs)))
+  }
+
+  @_transparent
+  public static func << <RHS>(
+    lhs: UInt32x16,
+    rhs: RHS
+  ) -> UInt32x16 where RHS: BinaryInteger {
+    self.init(rawValue: CUInt32x16ShiftLeft(lhs.rawValue, numericCast(rhs)))
+  }
+
+  /// Right-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func >> (lhs: UInt32x16, rhs: UInt32x16) -> UInt32x16 {
+    self.init(rawValue: CUInt32x16ShiftRightElementWise(lhs.rawValue, rhs.rawValue))
+  }
+
+  /// Left-shifts each element by the number of bits in the same lane of `rhs`.
+  @_transparent
+  public static func << (lhs: UInt32x16, rhs: UInt32x16) -> UInt32x16 {
+    self.init(rawValue: CUInt32x16ShiftLeftElementWise(lhs.rawValue, rhs.rawValue))
+  }
+}
+
+// MARK: - Counting & Reordering
+extension UInt32x16 {
+  /// The number of bits equal to 1 in each element.
+  @_transparent
+  public var nonzeroBitCount: UInt32x16 {
+    UInt32x16(rawValue: CUInt32x16PopulationCount(rawValue))
+  }
+
+  /// The number of leading zero bits in each element.
+  @_transparent
+  public var leadingZeroBitCount: UInt32x16 {
+    UInt32x16(rawValue: CUInt32x16LeadingZeroBitCount(rawValue))
+  }
+
+  /// The number of trailing zero bits in each element.
+  @_transparent
+  public var trailingZeroBitCount: UInt32x16 {
+    UInt32x16(rawValue: CUInt32x16TrailingZeroBitCount(rawValue))
+  }
+
+  /// The storage with the bytes of each element in reversed order.
+  @_transparent
+  public var byteSwapped: UInt32x16 {
+    UInt32x16(rawValue: CUInt32x16ByteSwap(rawValue))
+  }
+
+  /// The storage with the bits of each element in reversed order.
+  @_transparent
+  public var bitReversed: UInt32x16 {
+    UInt32x16(rawValue: CUInt32x16BitReverse(rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXComparisonStorage
+extension UInt32x16: SIMDXComparisonStorage {
+  public typealias MaskStorage = Int32x16
+
+  @_transparent
+  public static func compareEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x16CompareEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThan(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x16CompareLessThan(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func compareLessThanOrEqual(_ lhs: Self, _ rhs: Self) -> MaskStorage {
+    MaskStorage(rawValue: CUInt32x16CompareLessThanOrEqual(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func select(_ mask: MaskStorage, _ trueValue: Self, _ falseValue: Self) -> Self {
+    self.init(rawValue: CUInt32x16Select(mask.rawValue, trueValue.rawValue, falseValue.rawValue))
+  }
+}
+
+// MARK: - Conformance to SIMDXMinMaxStorage
+extension UInt32x16: SIMDXMinMaxStorage {
+  @_transparent
+  public static func min(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x16Minimum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func max(_ lhs: Self, _ rhs: Self) -> Self {
+    self.init(rawValue: CUInt32x16Maximum(lhs.rawValue, rhs.rawValue))
+  }
+
+  @_transparent
+  public static func abs(_ operand: Self) -> Self {
+    operand
+  }
+}
+
+// MARK: - Conformance to SIMDXBitPatternStorage
+extension UInt32x16: SIMDXBitPatternStorage {
+  @_transparent
+  public init(bitPattern: UInt32x16) {
+    self = bitPattern
+  }
+
+  @_transparent
+  public var bitPattern: UInt32x16 { self }
+}
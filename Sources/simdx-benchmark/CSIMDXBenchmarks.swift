@@ -0,0 +1,376 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CSIMDX
+
+/// Registers a throughput and a latency benchmark for the CSIMDX functions of
+/// every storage type; reductions and conversions are measured for throughput.
+func registerCSIMDXBenchmarks(_ registry: inout BenchmarkRegistry) {
+  registerFloatBenchmarks(&registry)
+  registerIntegerBenchmarks(&registry)
+  registerConversionBenchmarks(&registry)
+}
+
+// MARK: - Floating Point
+
+private func registerFloatBenchmarks(_ registry: inout BenchmarkRegistry) {
+  let float32x2 = Operands(step: CFloat32x2MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat32x2Make(Float32(operandValue($0)), Float32(operandValue($0 + 1)))
+  }
+  registry.add("Float32x2", "Add", .c) { measure($0, $1, float32x2, CFloat32x2Add) }
+  registry.add("Float32x2", "Subtract", .c) { measure($0, $1, float32x2, CFloat32x2Subtract) }
+  registry.add("Float32x2", "Multiply", .c) { measure($0, $1, float32x2, CFloat32x2Multiply) }
+  registry.add("Float32x2", "Divide", .c) { measure($0, $1, float32x2, CFloat32x2Divide) }
+  registry.add("Float32x2", "Minimum", .c) { measure($0, $1, float32x2, CFloat32x2Minimum) }
+  registry.add("Float32x2", "Maximum", .c) { measure($0, $1, float32x2, CFloat32x2Maximum) }
+  registry.add("Float32x2", "SquareRoot", .c) { measure($0, $1, float32x2, CFloat32x2SquareRoot) }
+  registry.add("Float32x2", "Negate", .c) { measure($0, $1, float32x2, CFloat32x2Negate) }
+  registry.add("Float32x2", "Magnitude", .c) { measure($0, $1, float32x2, CFloat32x2Magnitude) }
+
+  let float32x3 = Operands(step: CFloat32x3MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat32x3Make(Float32(operandValue($0)), Float32(operandValue($0 + 1)), Float32(operandValue($0 + 2)))
+  }
+  registry.add("Float32x3", "Add", .c) { measure($0, $1, float32x3, CFloat32x3Add) }
+  registry.add("Float32x3", "Subtract", .c) { measure($0, $1, float32x3, CFloat32x3Subtract) }
+  registry.add("Float32x3", "Multiply", .c) { measure($0, $1, float32x3, CFloat32x3Multiply) }
+  registry.add("Float32x3", "Divide", .c) { measure($0, $1, float32x3, CFloat32x3Divide) }
+  registry.add("Float32x3", "Minimum", .c) { measure($0, $1, float32x3, CFloat32x3Minimum) }
+  registry.add("Float32x3", "Maximum", .c) { measure($0, $1, float32x3, CFloat32x3Maximum) }
+  registry.add("Float32x3", "SquareRoot", .c) { measure($0, $1, float32x3, CFloat32x3SquareRoot) }
+  registry.add("Float32x3", "Negate", .c) { measure($0, $1, float32x3, CFloat32x3Negate) }
+  registry.add("Float32x3", "Magnitude", .c) { measure($0, $1, float32x3, CFloat32x3Magnitude) }
+  registry.add("Float32x3", "Normalize", .c) { measure($0, $1, float32x3, CFloat32x3Normalize) }
+  registry.add("Float32x3", "FastNormalize", .c) { measure($0, $1, float32x3, CFloat32x3FastNormalize) }
+  registry.add("Float32x3", "Cross", .c, metrics: [.throughput]) { measure($1, float32x3, CFloat32x3Cross) }
+  registry.add("Float32x3", "Reflect", .c, metrics: [.throughput]) { measure($1, float32x3, CFloat32x3Reflect) }
+  registry.add("Float32x3", "Project", .c, metrics: [.throughput]) { measure($1, float32x3, CFloat32x3Project) }
+  registry.add("Float32x3", "Dot", .c, metrics: [.throughput]) { measure($1, float32x3, CFloat32x3Dot) }
+  registry.add("Float32x3", "Distance", .c, metrics: [.throughput]) { measure($1, float32x3, CFloat32x3Distance) }
+  registry.add("Float32x3", "Length", .c, metrics: [.throughput]) { measure($1, float32x3, CFloat32x3Length) }
+  registry.add("Float32x3", "LengthSquared", .c, metrics: [.throughput]) { measure($1, float32x3, CFloat32x3LengthSquared) }
+
+  let float32x4 = Operands(step: CFloat32x4MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat32x4Make(Float32(operandValue($0)), Float32(operandValue($0 + 1)), Float32(operandValue($0 + 2)), Float32(operandValue($0 + 3)))
+  }
+  registry.add("Float32x4", "Add", .c) { measure($0, $1, float32x4, CFloat32x4Add) }
+  registry.add("Float32x4", "Subtract", .c) { measure($0, $1, float32x4, CFloat32x4Subtract) }
+  registry.add("Float32x4", "Multiply", .c) { measure($0, $1, float32x4, CFloat32x4Multiply) }
+  registry.add("Float32x4", "Divide", .c) { measure($0, $1, float32x4, CFloat32x4Divide) }
+  registry.add("Float32x4", "Minimum", .c) { measure($0, $1, float32x4, CFloat32x4Minimum) }
+  registry.add("Float32x4", "Maximum", .c) { measure($0, $1, float32x4, CFloat32x4Maximum) }
+  registry.add("Float32x4", "SquareRoot", .c) { measure($0, $1, float32x4, CFloat32x4SquareRoot) }
+  registry.add("Float32x4", "Negate", .c) { measure($0, $1, float32x4, CFloat32x4Negate) }
+  registry.add("Float32x4", "Magnitude", .c) { measure($0, $1, float32x4, CFloat32x4Magnitude) }
+  registry.add("Float32x4", "MultiplyAdd", .c) { measure($0, $1, float32x4) { CFloat32x4MultiplyAdd($0, $1, $1) } }
+
+  let float32x8 = Operands(step: CFloat32x8MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat32x8Make(
+      Float32(operandValue($0)), Float32(operandValue($0 + 1)), Float32(operandValue($0 + 2)), Float32(operandValue($0 + 3)),
+      Float32(operandValue($0 + 4)), Float32(operandValue($0 + 5)), Float32(operandValue($0 + 6)), Float32(operandValue($0 + 7))
+    )
+  }
+  registry.add("Float32x8", "Add", .c) { measure($0, $1, float32x8, CFloat32x8Add) }
+  registry.add("Float32x8", "Subtract", .c) { measure($0, $1, float32x8, CFloat32x8Subtract) }
+  registry.add("Float32x8", "Multiply", .c) { measure($0, $1, float32x8, CFloat32x8Multiply) }
+  registry.add("Float32x8", "Divide", .c) { measure($0, $1, float32x8, CFloat32x8Divide) }
+  registry.add("Float32x8", "Minimum", .c) { measure($0, $1, float32x8, CFloat32x8Minimum) }
+  registry.add("Float32x8", "Maximum", .c) { measure($0, $1, float32x8, CFloat32x8Maximum) }
+  registry.add("Float32x8", "SquareRoot", .c) { measure($0, $1, float32x8, CFloat32x8SquareRoot) }
+  registry.add("Float32x8", "Negate", .c) { measure($0, $1, float32x8, CFloat32x8Negate) }
+  registry.add("Float32x8", "Magnitude", .c) { measure($0, $1, float32x8, CFloat32x8Magnitude) }
+  registry.add("Float32x8", "MultiplyAdd", .c) { measure($0, $1, float32x8) { CFloat32x8MultiplyAdd($0, $1, $1) } }
+  registry.add("Float32x8", "ReduceAdd", .c, metrics: [.throughput]) { measure($1, float32x8, CFloat32x8ReduceAdd) }
+  registry.add("Float32x8", "ReduceMinimum", .c, metrics: [.throughput]) { measure($1, float32x8, CFloat32x8ReduceMinimum) }
+  registry.add("Float32x8", "ReduceMaximum", .c, metrics: [.throughput]) { measure($1, float32x8, CFloat32x8ReduceMaximum) }
+
+  let float32x16 = Operands(step: CFloat32x16MakeRepeatingElement(1 + .ulpOfOne)) { index in
+    var elements = (0 ..< 16).map { Float32(operandValue(index + $0)) }
+    return CFloat32x16MakeLoad(&elements)
+  }
+  registry.add("Float32x16", "Add", .c) { measure($0, $1, float32x16, CFloat32x16Add) }
+  registry.add("Float32x16", "Subtract", .c) { measure($0, $1, float32x16, CFloat32x16Subtract) }
+  registry.add("Float32x16", "Multiply", .c) { measure($0, $1, float32x16, CFloat32x16Multiply) }
+  registry.add("Float32x16", "Divide", .c) { measure($0, $1, float32x16, CFloat32x16Divide) }
+  registry.add("Float32x16", "Minimum", .c) { measure($0, $1, float32x16, CFloat32x16Minimum) }
+  registry.add("Float32x16", "Maximum", .c) { measure($0, $1, float32x16, CFloat32x16Maximum) }
+  registry.add("Float32x16", "SquareRoot", .c) { measure($0, $1, float32x16, CFloat32x16SquareRoot) }
+  registry.add("Float32x16", "Negate", .c) { measure($0, $1, float32x16, CFloat32x16Negate) }
+  registry.add("Float32x16", "Magnitude", .c) { measure($0, $1, float32x16, CFloat32x16Magnitude) }
+  registry.add("Float32x16", "MultiplyAdd", .c) { measure($0, $1, float32x16) { CFloat32x16MultiplyAdd($0, $1, $1) } }
+  registry.add("Float32x16", "ReduceAdd", .c, metrics: [.throughput]) { measure($1, float32x16, CFloat32x16ReduceAdd) }
+  registry.add("Float32x16", "ReduceMinimum", .c, metrics: [.throughput]) { measure($1, float32x16, CFloat32x16ReduceMinimum) }
+  registry.add("Float32x16", "ReduceMaximum", .c, metrics: [.throughput]) { measure($1, float32x16, CFloat32x16ReduceMaximum) }
+
+  let float64x2 = Operands(step: CFloat64x2MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat64x2Make(Float64(operandValue($0)), Float64(operandValue($0 + 1)))
+  }
+  registry.add("Float64x2", "Add", .c) { measure($0, $1, float64x2, CFloat64x2Add) }
+  registry.add("Float64x2", "Subtract", .c) { measure($0, $1, float64x2, CFloat64x2Subtract) }
+  registry.add("Float64x2", "Multiply", .c) { measure($0, $1, float64x2, CFloat64x2Multiply) }
+  registry.add("Float64x2", "Divide", .c) { measure($0, $1, float64x2, CFloat64x2Divide) }
+  registry.add("Float64x2", "Minimum", .c) { measure($0, $1, float64x2, CFloat64x2Minimum) }
+  registry.add("Float64x2", "Maximum", .c) { measure($0, $1, float64x2, CFloat64x2Maximum) }
+  registry.add("Float64x2", "SquareRoot", .c) { measure($0, $1, float64x2, CFloat64x2SquareRoot) }
+  registry.add("Float64x2", "Negate", .c) { measure($0, $1, float64x2, CFloat64x2Negate) }
+  registry.add("Float64x2", "Magnitude", .c) { measure($0, $1, float64x2, CFloat64x2Magnitude) }
+
+  let float64x3 = Operands(step: CFloat64x3MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat64x3Make(Float64(operandValue($0)), Float64(operandValue($0 + 1)), Float64(operandValue($0 + 2)))
+  }
+  registry.add("Float64x3", "Add", .c) { measure($0, $1, float64x3, CFloat64x3Add) }
+  registry.add("Float64x3", "Subtract", .c) { measure($0, $1, float64x3, CFloat64x3Subtract) }
+  registry.add("Float64x3", "Multiply", .c) { measure($0, $1, float64x3, CFloat64x3Multiply) }
+  registry.add("Float64x3", "Divide", .c) { measure($0, $1, float64x3, CFloat64x3Divide) }
+  registry.add("Float64x3", "Minimum", .c) { measure($0, $1, float64x3, CFloat64x3Minimum) }
+  registry.add("Float64x3", "Maximum", .c) { measure($0, $1, float64x3, CFloat64x3Maximum) }
+  registry.add("Float64x3", "SquareRoot", .c) { measure($0, $1, float64x3, CFloat64x3SquareRoot) }
+  registry.add("Float64x3", "Negate", .c) { measure($0, $1, float64x3, CFloat64x3Negate) }
+  registry.add("Float64x3", "Magnitude", .c) { measure($0, $1, float64x3, CFloat64x3Magnitude) }
+  registry.add("Float64x3", "Normalize", .c) { measure($0, $1, float64x3, CFloat64x3Normalize) }
+  registry.add("Float64x3", "FastNormalize", .c) { measure($0, $1, float64x3, CFloat64x3FastNormalize) }
+  registry.add("Float64x3", "Cross", .c, metrics: [.throughput]) { measure($1, float64x3, CFloat64x3Cross) }
+  registry.add("Float64x3", "Reflect", .c, metrics: [.throughput]) { measure($1, float64x3, CFloat64x3Reflect) }
+  registry.add("Float64x3", "Project", .c, metrics: [.throughput]) { measure($1, float64x3, CFloat64x3Project) }
+  registry.add("Float64x3", "Dot", .c, metrics: [.throughput]) { measure($1, float64x3, CFloat64x3Dot) }
+  registry.add("Float64x3", "Distance", .c, metrics: [.throughput]) { measure($1, float64x3, CFloat64x3Distance) }
+  registry.add("Float64x3", "Length", .c, metrics: [.throughput]) { measure($1, float64x3, CFloat64x3Length) }
+  registry.add("Float64x3", "LengthSquared", .c, metrics: [.throughput]) { measure($1, float64x3, CFloat64x3LengthSquared) }
+
+  let float64x4 = Operands(step: CFloat64x4MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat64x4Make(Float64(operandValue($0)), Float64(operandValue($0 + 1)), Float64(operandValue($0 + 2)), Float64(operandValue($0 + 3)))
+  }
+  registry.add("Float64x4", "Add", .c) { measure($0, $1, float64x4, CFloat64x4Add) }
+  registry.add("Float64x4", "Subtract", .c) { measure($0, $1, float64x4, CFloat64x4Subtract) }
+  registry.add("Float64x4", "Multiply", .c) { measure($0, $1, float64x4, CFloat64x4Multiply) }
+  registry.add("Float64x4", "Divide", .c) { measure($0, $1, float64x4, CFloat64x4Divide) }
+  registry.add("Float64x4", "Minimum", .c) { measure($0, $1, float64x4, CFloat64x4Minimum) }
+  registry.add("Float64x4", "Maximum", .c) { measure($0, $1, float64x4, CFloat64x4Maximum) }
+  registry.add("Float64x4", "SquareRoot", .c) { measure($0, $1, float64x4, CFloat64x4SquareRoot) }
+  registry.add("Float64x4", "Negate", .c) { measure($0, $1, float64x4, CFloat64x4Negate) }
+  registry.add("Float64x4", "Magnitude", .c) { measure($0, $1, float64x4, CFloat64x4Magnitude) }
+
+  let float64x8 = Operands(step: CFloat64x8MakeRepeatingElement(1 + .ulpOfOne)) {
+    CFloat64x8Make(
+      Float64(operandValue($0)), Float64(operandValue($0 + 1)), Float64(operandValue($0 + 2)), Float64(operandValue($0 + 3)),
+      Float64(operandValue($0 + 4)), Float64(operandValue($0 + 5)), Float64(operandValue($0 + 6)), Float64(operandValue($0 + 7))
+    )
+  }
+  registry.add("Float64x8", "Add", .c) { measure($0, $1, float64x8, CFloat64x8Add) }
+  registry.add("Float64x8", "Subtract", .c) { measure($0, $1, float64x8, CFloat64x8Subtract) }
+  registry.add("Float64x8", "Multiply", .c) { measure($0, $1, float64x8, CFloat64x8Multiply) }
+  registry.add("Float64x8", "Divide", .c) { measure($0, $1, float64x8, CFloat64x8Divide) }
+  registry.add("Float64x8", "Minimum", .c) { measure($0, $1, float64x8, CFloat64x8Minimum) }
+  registry.add("Float64x8", "Maximum", .c) { measure($0, $1, float64x8, CFloat64x8Maximum) }
+  registry.add("Float64x8", "SquareRoot", .c) { measure($0, $1, float64x8, CFloat64x8SquareRoot) }
+  registry.add("Float64x8", "Negate", .c) { measure($0, $1, float64x8, CFloat64x8Negate) }
+  registry.add("Float64x8", "Magnitude", .c) { measure($0, $1, float64x8, CFloat64x8Magnitude) }
+  registry.add("Float64x8", "MultiplyAdd", .c) { measure($0, $1, float64x8) { CFloat64x8MultiplyAdd($0, $1, $1) } }
+  registry.add("Float64x8", "ReduceAdd", .c, metrics: [.throughput]) { measure($1, float64x8, CFloat64x8ReduceAdd) }
+  registry.add("Float64x8", "ReduceMinimum", .c, metrics: [.throughput]) { measure($1, float64x8, CFloat64x8ReduceMinimum) }
+  registry.add("Float64x8", "ReduceMaximum", .c, metrics: [.throughput]) { measure($1, float64x8, CFloat64x8ReduceMaximum) }
+}
+
+// MARK: - Integer
+
+private func registerIntegerBenchmarks(_ registry: inout BenchmarkRegistry) {
+  let uint32x2 = Operands(step: CUInt32x2MakeRepeatingElement(1)) {
+    CUInt32x2Make(operandBits($0), operandBits($0 + 1))
+  }
+  registry.add("UInt32x2", "Add", .c) { measure($0, $1, uint32x2, CUInt32x2Add) }
+  registry.add("UInt32x2", "Subtract", .c) { measure($0, $1, uint32x2, CUInt32x2Subtract) }
+  registry.add("UInt32x2", "Multiply", .c) { measure($0, $1, uint32x2, CUInt32x2Multiply) }
+  registry.add("UInt32x2", "Minimum", .c) { measure($0, $1, uint32x2, CUInt32x2Minimum) }
+  registry.add("UInt32x2", "Maximum", .c) { measure($0, $1, uint32x2, CUInt32x2Maximum) }
+  registry.add("UInt32x2", "CompareElementWise", .c) { measure($0, $1, uint32x2, CUInt32x2CompareElementWise) }
+  registry.add("UInt32x2", "BitwiseAnd", .c) { measure($0, $1, uint32x2, CUInt32x2BitwiseAnd) }
+  registry.add("UInt32x2", "BitwiseAndNot", .c) { measure($0, $1, uint32x2, CUInt32x2BitwiseAndNot) }
+  registry.add("UInt32x2", "BitwiseOr", .c) { measure($0, $1, uint32x2, CUInt32x2BitwiseOr) }
+  registry.add("UInt32x2", "BitwiseExclusiveOr", .c) { measure($0, $1, uint32x2, CUInt32x2BitwiseExclusiveOr) }
+  registry.add("UInt32x2", "ShiftLeftElementWise", .c) { measure($0, $1, uint32x2, CUInt32x2ShiftLeftElementWise) }
+  registry.add("UInt32x2", "ShiftRightElementWise", .c) { measure($0, $1, uint32x2, CUInt32x2ShiftRightElementWise) }
+  registry.add("UInt32x2", "BitwiseNot", .c) { measure($0, $1, uint32x2, CUInt32x2BitwiseNot) }
+  registry.add("UInt32x2", "PopulationCount", .c) { measure($0, $1, uint32x2, CUInt32x2PopulationCount) }
+  registry.add("UInt32x2", "LeadingZeroBitCount", .c) { measure($0, $1, uint32x2, CUInt32x2LeadingZeroBitCount) }
+  registry.add("UInt32x2", "TrailingZeroBitCount", .c) { measure($0, $1, uint32x2, CUInt32x2TrailingZeroBitCount) }
+  registry.add("UInt32x2", "ByteSwap", .c) { measure($0, $1, uint32x2, CUInt32x2ByteSwap) }
+  registry.add("UInt32x2", "BitReverse", .c) { measure($0, $1, uint32x2, CUInt32x2BitReverse) }
+  registry.add("UInt32x2", "ShiftLeft", .c) { measure($0, $1, uint32x2) { CUInt32x2ShiftLeft($0, 3) } }
+  registry.add("UInt32x2", "ShiftRight", .c) { measure($0, $1, uint32x2) { CUInt32x2ShiftRight($0, 3) } }
+
+  let uint32x3 = Operands(step: CUInt32x3MakeRepeatingElement(1)) {
+    CUInt32x3Make(operandBits($0), operandBits($0 + 1), operandBits($0 + 2))
+  }
+  registry.add("UInt32x3", "Add", .c) { measure($0, $1, uint32x3, CUInt32x3Add) }
+  registry.add("UInt32x3", "Subtract", .c) { measure($0, $1, uint32x3, CUInt32x3Subtract) }
+  registry.add("UInt32x3", "Multiply", .c) { measure($0, $1, uint32x3, CUInt32x3Multiply) }
+  registry.add("UInt32x3", "Minimum", .c) { measure($0, $1, uint32x3, CUInt32x3Minimum) }
+  registry.add("UInt32x3", "Maximum", .c) { measure($0, $1, uint32x3, CUInt32x3Maximum) }
+  registry.add("UInt32x3", "CompareElementWise", .c) { measure($0, $1, uint32x3, CUInt32x3CompareElementWise) }
+  registry.add("UInt32x3", "BitwiseAnd", .c) { measure($0, $1, uint32x3, CUInt32x3BitwiseAnd) }
+  registry.add("UInt32x3", "BitwiseAndNot", .c) { measure($0, $1, uint32x3, CUInt32x3BitwiseAndNot) }
+  registry.add("UInt32x3", "BitwiseOr", .c) { measure($0, $1, uint32x3, CUInt32x3BitwiseOr) }
+  registry.add("UInt32x3", "BitwiseExclusiveOr", .c) { measure($0, $1, uint32x3, CUInt32x3BitwiseExclusiveOr) }
+  registry.add("UInt32x3", "ShiftLeftElementWise", .c) { measure($0, $1, uint32x3, CUInt32x3ShiftLeftElementWise) }
+  registry.add("UInt32x3", "ShiftRightElementWise", .c) { measure($0, $1, uint32x3, CUInt32x3ShiftRightElementWise) }
+  registry.add("UInt32x3", "BitwiseNot", .c) { measure($0, $1, uint32x3, CUInt32x3BitwiseNot) }
+  registry.add("UInt32x3", "PopulationCount", .c) { measure($0, $1, uint32x3, CUInt32x3PopulationCount) }
+  registry.add("UInt32x3", "LeadingZeroBitCount", .c) { measure($0, $1, uint32x3, CUInt32x3LeadingZeroBitCount) }
+  registry.add("UInt32x3", "TrailingZeroBitCount", .c) { measure($0, $1, uint32x3, CUInt32x3TrailingZeroBitCount) }
+  registry.add("UInt32x3", "ByteSwap", .c) { measure($0, $1, uint32x3, CUInt32x3ByteSwap) }
+  registry.add("UInt32x3", "BitReverse", .c) { measure($0, $1, uint32x3, CUInt32x3BitReverse) }
+  registry.add("UInt32x3", "ShiftLeft", .c) { measure($0, $1, uint32x3) { CUInt32x3ShiftLeft($0, 3) } }
+  registry.add("UInt32x3", "ShiftRight", .c) { measure($0, $1, uint32x3) { CUInt32x3ShiftRight($0, 3) } }
+
+  let uint32x4 = Operands(step: CUInt32x4MakeRepeatingElement(1)) {
+    CUInt32x4Make(operandBits($0), operandBits($0 + 1), operandBits($0 + 2), operandBits($0 + 3))
+  }
+  registry.add("UInt32x4", "Add", .c) { measure($0, $1, uint32x4, CUInt32x4Add) }
+  registry.add("UInt32x4", "Subtract", .c) { measure($0, $1, uint32x4, CUInt32x4Subtract) }
+  registry.add("UInt32x4", "Multiply", .c) { measure($0, $1, uint32x4, CUInt32x4Multiply) }
+  registry.add("UInt32x4", "Minimum", .c) { measure($0, $1, uint32x4, CUInt32x4Minimum) }
+  registry.add("UInt32x4", "Maximum", .c) { measure($0, $1, uint32x4, CUInt32x4Maximum) }
+  registry.add("UInt32x4", "CompareElementWise", .c) { measure($0, $1, uint32x4, CUInt32x4CompareElementWise) }
+  registry.add("UInt32x4", "BitwiseAnd", .c) { measure($0, $1, uint32x4, CUInt32x4BitwiseAnd) }
+  registry.add("UInt32x4", "BitwiseAndNot", .c) { measure($0, $1, uint32x4, CUInt32x4BitwiseAndNot) }
+  registry.add("UInt32x4", "BitwiseOr", .c) { measure($0, $1, uint32x4, CUInt32x4BitwiseOr) }
+  registry.add("UInt32x4", "BitwiseExclusiveOr", .c) { measure($0, $1, uint32x4, CUInt32x4BitwiseExclusiveOr) }
+  registry.add("UInt32x4", "ShiftLeftElementWise", .c) { measure($0, $1, uint32x4, CUInt32x4ShiftLeftElementWise) }
+  registry.add("UInt32x4", "ShiftRightElementWise", .c) { measure($0, $1, uint32x4, CUInt32x4ShiftRightElementWise) }
+  registry.add("UInt32x4", "BitwiseNot", .c) { measure($0, $1, uint32x4, CUInt32x4BitwiseNot) }
+  registry.add("UInt32x4", "PopulationCount", .c) { measure($0, $1, uint32x4, CUInt32x4PopulationCount) }
+  registry.add("UInt32x4", "LeadingZeroBitCount", .c) { measure($0, $1, uint32x4, CUInt32x4LeadingZeroBitCount) }
+  registry.add("UInt32x4", "TrailingZeroBitCount", .c) { measure($0, $1, uint32x4, CUInt32x4TrailingZeroBitCount) }
+  registry.add("UInt32x4", "ByteSwap", .c) { measure($0, $1, uint32x4, CUInt32x4ByteSwap) }
+  registry.add("UInt32x4", "BitReverse", .c) { measure($0, $1, uint32x4, CUInt32x4BitReverse) }
+  registry.add("UInt32x4", "ShiftLeft", .c) { measure($0, $1, uint32x4) { CUInt32x4ShiftLeft($0, 3) } }
+  registry.add("UInt32x4", "ShiftRight", .c) { measure($0, $1, uint32x4) { CUInt32x4ShiftRight($0, 3) } }
+
+  let uint32x8 = Operands(step: CUInt32x8MakeRepeatingElement(1)) { index in
+    var elements = (0 ..< 8).map { operandBits(index + $0) }
+    return CUInt32x8MakeLoad(&elements)
+  }
+  registry.add("UInt32x8", "Add", .c) { measure($0, $1, uint32x8, CUInt32x8Add) }
+  registry.add("UInt32x8", "Subtract", .c) { measure($0, $1, uint32x8, CUInt32x8Subtract) }
+  registry.add("UInt32x8", "Multiply", .c) { measure($0, $1, uint32x8, CUInt32x8Multiply) }
+  registry.add("UInt32x8", "Minimum", .c) { measure($0, $1, uint32x8, CUInt32x8Minimum) }
+  registry.add("UInt32x8", "Maximum", .c) { measure($0, $1, uint32x8, CUInt32x8Maximum) }
+  registry.add("UInt32x8", "CompareElementWise", .c) { measure($0, $1, uint32x8, CUInt32x8CompareElementWise) }
+  registry.add("UInt32x8", "BitwiseAnd", .c) { measure($0, $1, uint32x8, CUInt32x8BitwiseAnd) }
+  registry.add("UInt32x8", "BitwiseAndNot", .c) { measure($0, $1, uint32x8, CUInt32x8BitwiseAndNot) }
+  registry.add("UInt32x8", "BitwiseOr", .c) { measure($0, $1, uint32x8, CUInt32x8BitwiseOr) }
+  registry.add("UInt32x8", "BitwiseExclusiveOr", .c) { measure($0, $1, uint32x8, CUInt32x8BitwiseExclusiveOr) }
+  registry.add("UInt32x8", "ShiftLeftElementWise", .c) { measure($0, $1, uint32x8, CUInt32x8ShiftLeftElementWise) }
+  registry.add("UInt32x8", "ShiftRightElementWise", .c) { measure($0, $1, uint32x8, CUInt32x8ShiftRightElementWise) }
+  registry.add("UInt32x8", "BitwiseNot", .c) { measure($0, $1, uint32x8, CUInt32x8BitwiseNot) }
+  registry.add("UInt32x8", "PopulationCount", .c) { measure($0, $1, uint32x8, CUInt32x8PopulationCount) }
+  registry.add("UInt32x8", "LeadingZeroBitCount", .c) { measure($0, $1, uint32x8, CUInt32x8LeadingZeroBitCount) }
+  registry.add("UInt32x8", "TrailingZeroBitCount", .c) { measure($0, $1, uint32x8, CUInt32x8TrailingZeroBitCount) }
+  registry.add("UInt32x8", "ByteSwap", .c) { measure($0, $1, uint32x8, CUInt32x8ByteSwap) }
+  registry.add("UInt32x8", "BitReverse", .c) { measure($0, $1, uint32x8, CUInt32x8BitReverse) }
+  registry.add("UInt32x8", "ShiftLeft", .c) { measure($0, $1, uint32x8) { CUInt32x8ShiftLeft($0, 3) } }
+  registry.add("UInt32x8", "ShiftRight", .c) { measure($0, $1, uint32x8) { CUInt32x8ShiftRight($0, 3) } }
+
+  let uint32x16 = Operands(step: CUInt32x16MakeRepeatingElement(1)) { index in
+    var elements = (0 ..< 16).map { operandBits(index + $0) }
+    return CUInt32x16MakeLoad(&elements)
+  }
+  registry.add("UInt32x16", "Add", .c) { measure($0, $1, uint32x16, CUInt32x16Add) }
+  registry.add("UInt32x16", "Subtract", .c) { measure($0, $1, uint32x16, CUInt32x16Subtract) }
+  registry.add("UInt32x16", "Multiply", .c) { measure($0, $1, uint32x16, CUInt32x16Multiply) }
+  registry.add("UInt32x16", "Minimum", .c) { measure($0, $1, uint32x16, CUInt32x16Minimum) }
+  registry.add("UInt32x16", "Maximum", .c) { measure($0, $1, uint32x16, CUInt32x16Maximum) }
+  registry.add("UInt32x16", "CompareElementWise", .c) { measure($0, $1, uint32x16, CUInt32x16CompareElementWise) }
+  registry.add("UInt32x16", "BitwiseAnd", .c) { measure($0, $1, uint32x16, CUInt32x16BitwiseAnd) }
+  registry.add("UInt32x16", "BitwiseAndNot", .c) { measure($0, $1, uint32x16, CUInt32x16BitwiseAndNot) }
+  registry.add("UInt32x16", "BitwiseOr", .c) { measure($0, $1, uint32x16, CUInt32x16BitwiseOr) }
+  registry.add("UInt32x16", "BitwiseExclusiveOr", .c) { measure($0, $1, uint32x16, CUInt32x16BitwiseExclusiveOr) }
+  registry.add("UInt32x16", "ShiftLeftElementWise", .c) { measure($0, $1, uint32x16, CUInt32x16ShiftLeftElementWise) }
+  registry.add("UInt32x16", "ShiftRightElementWise", .c) { measure($0, $1, uint32x16, CUInt32x16ShiftRightElementWise) }
+  registry.add("UInt32x16", "BitwiseNot", .c) { measure($0, $1, uint32x16, CUInt32x16BitwiseNot) }
+  registry.add("UInt32x16", "PopulationCount", .c) { measure($0, $1, uint32x16, CUInt32x16PopulationCount) }
+  registry.add("UInt32x16", "LeadingZeroBitCount", .c) { measure($0, $1, uint32x16, CUInt32x16LeadingZeroBitCount) }
+  registry.add("UInt32x16", "TrailingZeroBitCount", .c) { measure($0, $1, uint32x16, CUInt32x16TrailingZeroBitCount) }
+  registry.add("UInt32x16", "ByteSwap", .c) { measure($0, $1, uint32x16, CUInt32x16ByteSwap) }
+  registry.add("UInt32x16", "BitReverse", .c) { measure($0, $1, uint32x16, CUInt32x16BitReverse) }
+  registry.add("UInt32x16", "ShiftLeft", .c) { measure($0, $1, uint32x16) { CUInt32x16ShiftLeft($0, 3) } }
+  registry.add("UInt32x16", "ShiftRight", .c) { measure($0, $1, uint32x16) { CUInt32x16ShiftRight($0, 3) } }
+
+  let int32x2 = Operands(step: CInt32x2MakeRepeatingElement(1)) {
+    CInt32x2Make(Int32(bitPattern: operandBits($0)), Int32(bitPattern: operandBits($0 + 1)))
+  }
+  registry.add("Int32x2", "Add", .c) { measure($0, $1, int32x2, CInt32x2Add) }
+  registry.add("Int32x2", "Subtract", .c) { measure($0, $1, int32x2, CInt32x2Subtract) }
+  registry.add("Int32x2", "Multiply", .c) { measure($0, $1, int32x2, CInt32x2Multiply) }
+  registry.add("Int32x2", "Minimum", .c) { measure($0, $1, int32x2, CInt32x2Minimum) }
+  registry.add("Int32x2", "Maximum", .c) { measure($0, $1, int32x2, CInt32x2Maximum) }
+  registry.add("Int32x2", "CompareElementWise", .c) { measure($0, $1, int32x2, CInt32x2CompareElementWise) }
+  registry.add("Int32x2", "BitwiseAnd", .c) { measure($0, $1, int32x2, CInt32x2BitwiseAnd) }
+  registry.add("Int32x2", "BitwiseAndNot", .c) { measure($0, $1, int32x2, CInt32x2BitwiseAndNot) }
+  registry.add("Int32x2", "BitwiseOr", .c) { measure($0, $1, int32x2, CInt32x2BitwiseOr) }
+  registry.add("Int32x2", "BitwiseExclusiveOr", .c) { measure($0, $1, int32x2, CInt32x2BitwiseExclusiveOr) }
+  registry.add("Int32x2", "ShiftLeftElementWise", .c) { measure($0, $1, int32x2, CInt32x2ShiftLeftElementWise) }
+  registry.add("Int32x2", "ShiftRightElementWise", .c) { measure($0, $1, int32x2, CInt32x2ShiftRightElementWise) }
+  registry.add("Int32x2", "BitwiseNot", .c) { measure($0, $1, int32x2, CInt32x2BitwiseNot) }
+  registry.add("Int32x2", "PopulationCount", .c) { measure($0, $1, int32x2, CInt32x2PopulationCount) }
+  registry.add("Int32x2", "LeadingZeroBitCount", .c) { measure($0, $1, int32x2, CInt32x2LeadingZeroBitCount) }
+  registry.add("Int32x2", "TrailingZeroBitCount", .c) { measure($0, $1, int32x2, CInt32x2TrailingZeroBitCount) }
+  registry.add("Int32x2", "ByteSwap", .c) { measure($0, $1, int32x2, CInt32x2ByteSwap) }
+  registry.add("Int32x2", "BitReverse", .c) { measure($0, $1, int32x2, CInt32x2BitReverse) }
+  registry.add("Int32x2", "ShiftLeft", .c) { measure($0, $1, int32x2) { CInt32x2ShiftLeft($0, 3) } }
+  registry.add("Int32x2", "ShiftRight", .c) { measure($0, $1, int32x2) { CInt32x2ShiftRight($0, 3) } }
+  registry.add("Int32x2", "Negate", .c) { measure($0, $1, int32x2, CInt32x2Negate) }
+  registry.add("Int32x2", "Magnitude", .c, metrics: [.throughput]) { measure($1, int32x2, CInt32x2Magnitude) }
+
+  let int32x3 = Operands(step: CInt32x3MakeRepeatingElement(1)) {
+    CInt32x3Make(Int32(bitPattern: operandBits($0)), Int32(bitPattern: operandBits($0 + 1)), Int32(bitPattern: operandBits($0 + 2)))
+  }
+  registry.add("Int32x3", "Add", .c) { measure($0, $1, int32x3, CInt32x3Add) }
+  registry.add("Int32x3", "Subtract", .c) { measure($0, $1, int32x3, CInt32x3Subtract) }
+  registry.add("Int32x3", "Multiply", .c) { measure($0, $1, int32x3, CInt32x3Multiply) }
+  registry.add("Int32x3", "Minimum", .c) { measure($0, $1, int32x3, CInt32x3Minimum) }
+  registry.add("Int32x3", "Maximum", .c) { measure($0, $1, int32x3, CInt32x3Maximum) }
+  registry.add("Int32x3", "CompareElementWise", .c) { measure($0, $1, int32x3, CInt32x3CompareElementWise) }
+  registry.add("Int32x3", "BitwiseAnd", .c) { measure($0, $1, int32x3, CInt32x3BitwiseAnd) }
+  registry.add("Int32x3", "BitwiseAndNot", .c) { measure($0, $1, int32x3, CInt32x3BitwiseAndNot) }
+  registry.add("Int32x3", "BitwiseOr", .c) { measure($0, $1, int32x3, CInt32x3BitwiseOr) }
+  registry.add("Int32x3", "BitwiseExclusiveOr", .c) { measure($0, $1, int32x3, CInt32x3BitwiseExclusiveOr) }
+  registry.add("Int32x3", "ShiftLeftElementWise", .c) { measure($0, $1, int32x3, CInt32x3ShiftLeftElementWise) }
+  registry.add("Int32x3", "ShiftRightElementWise", .c) { measure($0, $1, int32x3, CInt32x3ShiftRightElementWise) }
+  registry.add("Int32x3", "BitwiseNot", .c) { measure($0, $1, int32x3, CInt32x3BitwiseNot) }
+  registry.add("Int32x3", "PopulationCount", .c) { measure($0, $1, int32x3, CInt32x3PopulationCount) }
+  registry.add("Int32x3", "LeadingZeroBitCount", .c) { measure($0, $1, int32x3, CInt32x3LeadingZeroBitCount) }
+  registry.add("Int32x3", "TrailingZeroBitCount", .c) { measure($0, $1, int32x3, CInt32x3TrailingZeroBitCount) }
+  registry.add("Int32x3", "ByteSwap", .c) { measure($0, $1, int32x3, CInt32x3ByteSwap) }
+  registry.add("Int32x3", "BitReverse", .c) { measure($0, $1, int32x3, CInt32x3BitReverse) }
+  registry.add("Int32x3", "ShiftLeft", .c) { measure($0, $1, int32x3) { CInt32x3ShiftLeft($0, 3) } }
+  registry.add("Int32x3", "ShiftRight", .c) { measure($0, $1, int32x3) { CInt32x3ShiftRight($0, 3) } }
+  registry.add("Int32x3", "Negate", .c) { measure($0, $1, int32x3, CInt32x3Negate) }
+  registry.add("Int32x3", "Magnitude", .c, metrics: [.throughput]) { measure($1, int32x3, CInt32x3Magnitude) }
+}
+
+// MARK: - Conversion
+
+private func registerConversionBenchmarks(_ registry: inout BenchmarkRegistry) {
+  let float32x2 = Operands(step: CFloat32x2MakeRepeatingElement(1)) {
+    CFloat32x2Make(Float32(operandValue($0)), Float32(operandValue($0 + 1)))
+  }
+  let float64x2 = Operands(step: CFloat64x2MakeRepeatingElement(1)) {
+    CFloat64x2Make(operandValue($0), operandValue($0 + 1))
+  }
+  registry.add("Float32x2", "FromCFloat64x2", .c, metrics: [.throughput]) { measure($1, float64x2, CFloat32x2FromCFloat64x2) }
+  registry.add("Float64x2", "FromCFloat32x2", .c, metrics: [.throughput]) { measure($1, float32x2, CFloat64x2FromCFloat32x2) }
+  registry.add("Float32x2", "ConversionRoundTrip", .c, metrics: [.latency]) {
+    measure($0, $1, float32x2) { CFloat32x2FromCFloat64x2(CFloat64x2FromCFloat32x2($0)) }
+  }
+}
@@ -0,0 +1,61 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import Foundation
+
+/// A report of a previous run, labeled by the level it was built for.
+struct LabeledReport {
+  let label: String
+  let report: Report
+
+  init(contentsOf path: String) throws {
+    report = try JSONDecoder().decode(Report.self, from: Data(contentsOf: URL(fileURLWithPath: path)))
+    label = report.backend.isaLevel
+      ?? URL(fileURLWithPath: path).deletingPathExtension().lastPathComponent
+  }
+}
+
+/// Returns a Markdown table of the median of each benchmark in `reports`, one
+/// column per report, with the speedup over the first report in parentheses.
+func comparisonTable(_ reports: [LabeledReport], filter: String?) -> String {
+  var names: [String] = []
+  var medians: [String: [Double?]] = [:]
+  for (column, labeled) in reports.enumerated() {
+    for result in labeled.report.results where filter.map({ result.name.contains($0) }) ?? true {
+      if medians[result.name] == nil {
+        names.append(result.name)
+        medians[result.name] = Array(repeating: nil, count: reports.count)
+      }
+      medians[result.name]![column] = result.median
+    }
+  }
+
+  func row(_ cells: [String]) -> String {
+    "| " + cells.joined(separator: " | ") + " |\n"
+  }
+  var table = row(["Benchmark (ns/op)"] + reports.map { $0.label })
+  table += row(Array(repeating: "---", count: reports.count + 1))
+  for name in names {
+    let values = medians[name]!
+    let cells = values.enumerated().map { column, value -> String in
+      guard let value = value else { return "-" }
+      guard column > 0, let baseline = values[0], value > 0 else {
+        return String(format: "%.3f", value)
+      }
+      return String(format: "%.3f (%.2fx)", value, baseline / value)
+    }
+    table += row([name] + cells)
+  }
+  return table
+}
@@ -0,0 +1,268 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import Dispatch
+
+/// What a benchmark measures.
+enum Metric: String, Codable, CaseIterable {
+  /// Independent operations over a buffer of operands, bound by throughput
+  case throughput
+  /// A chain of operations, each consuming the previous result, bound by latency
+  case latency
+}
+
+/// The implementation a benchmark exercises.
+enum Variant: String, Codable, CaseIterable {
+  /// The CSIMDX function on the raw storage
+  case c
+  /// The SIMDX2, SIMDX3 or SIMDX4 wrapper
+  case simdx
+  /// An element-wise loop over Swift scalars; its latency is that of one element
+  case scalar
+  /// The standard library `SIMD2`, `SIMD3` or `SIMD4` type
+  case stdlib
+}
+
+/// A single measurement, performing a given number of operations per run.
+struct Benchmark {
+  let type: String
+  let operation: String
+  let variant: Variant
+  let metric: Metric
+  let run: (Int) -> Void
+
+  /// A unique name, e.g. `Float32x4.Add.c.throughput`
+  var name: String {
+    "\(type).\(operation).\(variant.rawValue).\(metric.rawValue)"
+  }
+}
+
+/// Collects the benchmarks of all suites.
+struct BenchmarkRegistry {
+  private(set) var benchmarks: [Benchmark] = []
+
+  /// Registers `body` for each of the given `metrics`; `body` has to perform
+  /// the requested number of operations for the metric it is handed.
+  mutating func add(
+    _ type: String,
+    _ operation: String,
+    _ variant: Variant,
+    metrics: [Metric] = Metric.allCases,
+    _ body: @escaping (Metric, Int) -> Void
+  ) {
+    for metric in metrics {
+      benchmarks.append(Benchmark(type: type, operation: operation, variant: variant, metric: metric) {
+        body(metric, $0)
+      })
+    }
+  }
+}
+
+// MARK: - Operands
+
+/// Buffers of operands and results of a storage type, allocated once for the
+/// lifetime of the process, so no run measures any allocation.
+final class Operands<T> {
+  /// The number of operands per buffer, a power of two
+  static var count: Int { 256 }
+
+  let lhs: UnsafeMutableBufferPointer<T>
+  let rhs: UnsafeMutableBufferPointer<T>
+  let result: UnsafeMutableBufferPointer<T>
+  /// The right hand side of latency chains, chosen to neither overflow nor
+  /// underflow into subnormals over millions of operations
+  let step: T
+
+  init(step: T, _ make: (Int) -> T) {
+    self.step = step
+    lhs = .allocate(capacity: Self.count)
+    rhs = .allocate(capacity: Self.count)
+    result = .allocate(capacity: Self.count)
+    for index in 0 ..< Self.count {
+      (lhs.baseAddress! + index).initialize(to: make(index))
+      (rhs.baseAddress! + index).initialize(to: make(index + 31))
+      (result.baseAddress! + index).initialize(to: make(index))
+    }
+  }
+}
+
+/// A floating-point operand value in [1, 2), varying with `index`.
+@inline(__always)
+func operandValue(_ index: Int) -> Double {
+  1 + Double(index % 97) / 128
+}
+
+/// An integer operand bit pattern, varying with `index`.
+@inline(__always)
+func operandBits(_ index: Int) -> UInt32 {
+  UInt32(truncatingIfNeeded: (index &+ 1) &* 0x9E37_79B9)
+}
+
+// MARK: - Measurement
+
+/// Keeps the optimizer from discarding `value` and everything computing it.
+@inline(never)
+func blackHole<T>(_ value: T) {
+  withExtendedLifetime(value) {}
+}
+
+@inline(__always)
+func measure<T>(_ metric: Metric, _ count: Int, _ operands: Operands<T>, _ operation: (T, T) -> T) {
+  switch metric {
+  case .throughput:
+    let (lhs, rhs, result) = (operands.lhs, operands.rhs, operands.result)
+    for index in 0 ..< count {
+      let slot = index & (Operands<T>.count - 1)
+      result[slot] = operation(lhs[slot], rhs[slot])
+    }
+    blackHole(result.baseAddress)
+  case .latency:
+    var value = operands.lhs[0]
+    let step = operands.step
+    for _ in 0 ..< count {
+      value = operation(value, step)
+    }
+    blackHole(value)
+  }
+}
+
+@inline(__always)
+func measure<T>(_ metric: Metric, _ count: Int, _ operands: Operands<T>, _ operation: (T) -> T) {
+  switch metric {
+  case .throughput:
+    let (lhs, result) = (operands.lhs, operands.result)
+    for index in 0 ..< count {
+      let slot = index & (Operands<T>.count - 1)
+      result[slot] = operation(lhs[slot])
+    }
+    blackHole(result.baseAddress)
+  case .latency:
+    var value = operands.lhs[0]
+    for _ in 0 ..< count {
+      value = operation(value)
+    }
+    blackHole(value)
+  }
+}
+
+/// Operations of a different result type, e.g. reductions and conversions,
+/// can only be chained through a round trip and are measured for throughput.
+@inline(__always)
+func measure<T, R>(_ count: Int, _ operands: Operands<T>, _ operation: (T, T) -> R) {
+  let (lhs, rhs) = (operands.lhs, operands.rhs)
+  let result = UnsafeMutableBufferPointer<R>.allocate(capacity: Operands<T>.count)
+  defer { result.deallocate() }
+  for index in 0 ..< count {
+    let slot = index & (Operands<T>.count - 1)
+    (result.baseAddress! + slot).initialize(to: operation(lhs[slot], rhs[slot]))
+  }
+  blackHole(result.baseAddress)
+}
+
+@inline(__always)
+func measure<T, R>(_ count: Int, _ operands: Operands<T>, _ operation: (T) -> R) {
+  let lhs = operands.lhs
+  let result = UnsafeMutableBufferPointer<R>.allocate(capacity: Operands<T>.count)
+  defer { result.deallocate() }
+  for index in 0 ..< count {
+    let slot = index & (Operands<T>.count - 1)
+    (result.baseAddress! + slot).initialize(to: operation(lhs[slot]))
+  }
+  blackHole(result.baseAddress)
+}
+
+/// Measures an element-wise loop over `lanes` scalars per operation.
+@inline(__always)
+func measureScalar<E>(_ metric: Metric, _ count: Int, lanes: Int, _ operands: Operands<E>, _ operation: (E, E) -> E) {
+  switch metric {
+  case .throughput:
+    let (lhs, rhs, result) = (operands.lhs, operands.rhs, operands.result)
+    let vectors = Operands<E>.count / 4
+    for index in 0 ..< count {
+      let base = (index & (vectors - 1)) * 4
+      for lane in 0 ..< lanes {
+        result[base + lane] = operation(lhs[base + lane], rhs[base + lane])
+      }
+    }
+    blackHole(result.baseAddress)
+  case .latency:
+    measure(.latency, count, operands, operation)
+  }
+}
+
+@inline(__always)
+func measureScalar<E>(_ metric: Metric, _ count: Int, lanes: Int, _ operands: Operands<E>, _ operation: (E) -> E) {
+  switch metric {
+  case .throughput:
+    let (lhs, result) = (operands.lhs, operands.result)
+    let vectors = Operands<E>.count / 4
+    for index in 0 ..< count {
+      let base = (index & (vectors - 1)) * 4
+      for lane in 0 ..< lanes {
+        result[base + lane] = operation(lhs[base + lane])
+      }
+    }
+    blackHole(result.baseAddress)
+  case .latency:
+    measure(.latency, count, operands, operation)
+  }
+}
+
+// MARK: - Timing
+
+/// The timing of one benchmark, in nanoseconds per operation.
+struct BenchmarkResult: Codable {
+  let name: String
+  let type: String
+  let operation: String
+  let variant: Variant
+  let metric: Metric
+  /// Operations per sample
+  let iterations: Int
+  let samples: Int
+  let median: Double
+  let minimum: Double
+  let maximum: Double
+}
+
+@inline(__always)
+private func nanoseconds(_ body: () -> Void) -> UInt64 {
+  let start = DispatchTime.now().uptimeNanoseconds
+  body()
+  return DispatchTime.now().uptimeNanoseconds - start
+}
+
+/// Runs `benchmark` with as many operations as fit into `minimumTime`
+/// nanoseconds per sample, after a warm-up run.
+func run(_ benchmark: Benchmark, samples: Int, minimumTime: UInt64) -> BenchmarkResult {
+  var iterations = 1 << 10
+  while iterations < 1 << 28, nanoseconds({ benchmark.run(iterations) }) < minimumTime {
+    iterations <<= 1
+  }
+  let timings = (0 ..< max(1, samples)).map { _ in
+    Double(nanoseconds { benchmark.run(iterations) }) / Double(iterations)
+  }.sorted()
+  return BenchmarkResult(
+    name: benchmark.name,
+    type: benchmark.type,
+    operation: benchmark.operation,
+    variant: benchmark.variant,
+    metric: benchmark.metric,
+    iterations: iterations,
+    samples: timings.count,
+    median: timings[timings.count / 2],
+    minimum: timings.first!,
+    maximum: timings.last!
+  )
+}
@@ -0,0 +1,232 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import SIMDX
+
+/// Registers the benchmarks of the SIMDX wrappers, next to element-wise loops
+/// over Swift scalars and the standard library SIMD types of equal length.
+/// Each shares the storage type name of its CSIMDX counterpart, so results
+/// compare by `type` and `operation` across variants.
+func registerWrapperBenchmarks(_ registry: inout BenchmarkRegistry) {
+  registerSIMDXBenchmarks(&registry)
+  registerScalarBenchmarks(&registry)
+  registerStandardLibraryBenchmarks(&registry)
+}
+
+// MARK: - SIMDX
+
+private func registerSIMDXBenchmarks(_ registry: inout BenchmarkRegistry) {
+  let simdxFloat32x2 = Operands(step: SIMDX2<Float32>(rawValue: Float32x2(repeating: 1 + .ulpOfOne))) {
+    SIMDX2<Float32>(Float32(operandValue($0)), Float32(operandValue($0 + 1)))
+  }
+  registry.add("Float32x2", "Add", .simdx) { measure($0, $1, simdxFloat32x2) { $0 + $1 } }
+  registry.add("Float32x2", "Subtract", .simdx) { measure($0, $1, simdxFloat32x2) { $0 - $1 } }
+  registry.add("Float32x2", "Multiply", .simdx) { measure($0, $1, simdxFloat32x2) { $0 * $1 } }
+  registry.add("Float32x2", "Divide", .simdx) { measure($0, $1, simdxFloat32x2) { $0 / $1 } }
+  registry.add("Float32x2", "Negate", .simdx) { measure($0, $1, simdxFloat32x2) { -$0 } }
+
+  let simdxFloat32x3 = Operands(step: SIMDX3<Float32>(rawValue: Float32x3(repeating: 1 + .ulpOfOne))) {
+    SIMDX3<Float32>(Float32(operandValue($0)), Float32(operandValue($0 + 1)), Float32(operandValue($0 + 2)))
+  }
+  registry.add("Float32x3", "Add", .simdx) { measure($0, $1, simdxFloat32x3) { $0 + $1 } }
+  registry.add("Float32x3", "Subtract", .simdx) { measure($0, $1, simdxFloat32x3) { $0 - $1 } }
+  registry.add("Float32x3", "Multiply", .simdx) { measure($0, $1, simdxFloat32x3) { $0 * $1 } }
+  registry.add("Float32x3", "Divide", .simdx) { measure($0, $1, simdxFloat32x3) { $0 / $1 } }
+  registry.add("Float32x3", "Negate", .simdx) { measure($0, $1, simdxFloat32x3) { -$0 } }
+  registry.add("Float32x3", "Normalize", .simdx) { measure($0, $1, simdxFloat32x3) { $0.normalized() } }
+  registry.add("Float32x3", "FastNormalize", .simdx) { measure($0, $1, simdxFloat32x3) { $0.fastNormalized() } }
+  registry.add("Float32x3", "Cross", .simdx, metrics: [.throughput]) { measure($1, simdxFloat32x3) { SIMDX3<Float32>.cross($0, $1) } }
+  registry.add("Float32x3", "Dot", .simdx, metrics: [.throughput]) { measure($1, simdxFloat32x3) { SIMDX3<Float32>.dot($0, $1) } }
+  registry.add("Float32x3", "Length", .simdx, metrics: [.throughput]) { measure($1, simdxFloat32x3) { $0.length } }
+
+  let simdxFloat32x4 = Operands(step: SIMDX4<Float32>(rawValue: Float32x4(repeating: 1 + .ulpOfOne))) {
+    SIMDX4<Float32>(Float32(operandValue($0)), Float32(operandValue($0 + 1)), Float32(operandValue($0 + 2)), Float32(operandValue($0 + 3)))
+  }
+  registry.add("Float32x4", "Add", .simdx) { measure($0, $1, simdxFloat32x4) { $0 + $1 } }
+  registry.add("Float32x4", "Subtract", .simdx) { measure($0, $1, simdxFloat32x4) { $0 - $1 } }
+  registry.add("Float32x4", "Multiply", .simdx) { measure($0, $1, simdxFloat32x4) { $0 * $1 } }
+  registry.add("Float32x4", "Divide", .simdx) { measure($0, $1, simdxFloat32x4) { $0 / $1 } }
+  registry.add("Float32x4", "Negate", .simdx) { measure($0, $1, simdxFloat32x4) { -$0 } }
+
+  let simdxFloat64x2 = Operands(step: SIMDX2<Float64>(rawValue: Float64x2(repeating: 1 + .ulpOfOne))) {
+    SIMDX2<Float64>(Float64(operandValue($0)), Float64(operandValue($0 + 1)))
+  }
+  registry.add("Float64x2", "Add", .simdx) { measure($0, $1, simdxFloat64x2) { $0 + $1 } }
+  registry.add("Float64x2", "Subtract", .simdx) { measure($0, $1, simdxFloat64x2) { $0 - $1 } }
+  registry.add("Float64x2", "Multiply", .simdx) { measure($0, $1, simdxFloat64x2) { $0 * $1 } }
+  registry.add("Float64x2", "Divide", .simdx) { measure($0, $1, simdxFloat64x2) { $0 / $1 } }
+  registry.add("Float64x2", "Negate", .simdx) { measure($0, $1, simdxFloat64x2) { -$0 } }
+
+  let simdxFloat64x3 = Operands(step: SIMDX3<Float64>(rawValue: Float64x3(repeating: 1 + .ulpOfOne))) {
+    SIMDX3<Float64>(Float64(operandValue($0)), Float64(operandValue($0 + 1)), Float64(operandValue($0 + 2)))
+  }
+  registry.add("Float64x3", "Add", .simdx) { measure($0, $1, simdxFloat64x3) { $0 + $1 } }
+  registry.add("Float64x3", "Subtract", .simdx) { measure($0, $1, simdxFloat64x3) { $0 - $1 } }
+  registry.add("Float64x3", "Multiply", .simdx) { measure($0, $1, simdxFloat64x3) { $0 * $1 } }
+  registry.add("Float64x3", "Divide", .simdx) { measure($0, $1, simdxFloat64x3) { $0 / $1 } }
+  registry.add("Float64x3", "Negate", .simdx) { measure($0, $1, simdxFloat64x3) { -$0 } }
+  registry.add("Float64x3", "Normalize", .simdx) { measure($0, $1, simdxFloat64x3) { $0.normalized() } }
+  registry.add("Float64x3", "FastNormalize", .simdx) { measure($0, $1, simdxFloat64x3) { $0.fastNormalized() } }
+  registry.add("Float64x3", "Cross", .simdx, metrics: [.throughput]) { measure($1, simdxFloat64x3) { SIMDX3<Float64>.cross($0, $1) } }
+  registry.add("Float64x3", "Dot", .simdx, metrics: [.throughput]) { measure($1, simdxFloat64x3) { SIMDX3<Float64>.dot($0, $1) } }
+  registry.add("Float64x3", "Length", .simdx, metrics: [.throughput]) { measure($1, simdxFloat64x3) { $0.length } }
+
+  let simdxFloat64x4 = Operands(step: SIMDX4<Float64>(rawValue: Float64x4(repeating: 1 + .ulpOfOne))) {
+    SIMDX4<Float64>(Float64(operandValue($0)), Float64(operandValue($0 + 1)), Float64(operandValue($0 + 2)), Float64(operandValue($0 + 3)))
+  }
+  registry.add("Float64x4", "Add", .simdx) { measure($0, $1, simdxFloat64x4) { $0 + $1 } }
+  registry.add("Float64x4", "Subtract", .simdx) { measure($0, $1, simdxFloat64x4) { $0 - $1 } }
+  registry.add("Float64x4", "Multiply", .simdx) { measure($0, $1, simdxFloat64x4) { $0 * $1 } }
+  registry.add("Float64x4", "Divide", .simdx) { measure($0, $1, simdxFloat64x4) { $0 / $1 } }
+  registry.add("Float64x4", "Negate", .simdx) { measure($0, $1, simdxFloat64x4) { -$0 } }
+}
+
+// MARK: - Scalar
+
+private func registerScalarBenchmarks(_ registry: inout BenchmarkRegistry) {
+  let float32 = Operands(step: 1 + .ulpOfOne) { Float32(operandValue($0)) }
+  let float64 = Operands(step: 1 + .ulpOfOne) { operandValue($0) }
+  registry.add("Float32x2", "Add", .scalar) { measureScalar($0, $1, lanes: 2, float32) { $0 + $1 } }
+  registry.add("Float32x2", "Subtract", .scalar) { measureScalar($0, $1, lanes: 2, float32) { $0 - $1 } }
+  registry.add("Float32x2", "Multiply", .scalar) { measureScalar($0, $1, lanes: 2, float32) { $0 * $1 } }
+  registry.add("Float32x2", "Divide", .scalar) { measureScalar($0, $1, lanes: 2, float32) { $0 / $1 } }
+  registry.add("Float32x2", "Minimum", .scalar) { measureScalar($0, $1, lanes: 2, float32) { min($0, $1) } }
+  registry.add("Float32x2", "Maximum", .scalar) { measureScalar($0, $1, lanes: 2, float32) { max($0, $1) } }
+  registry.add("Float32x2", "SquareRoot", .scalar) { measureScalar($0, $1, lanes: 2, float32) { $0.squareRoot() } }
+  registry.add("Float32x2", "Negate", .scalar) { measureScalar($0, $1, lanes: 2, float32) { -$0 } }
+  registry.add("Float32x2", "Magnitude", .scalar) { measureScalar($0, $1, lanes: 2, float32) { abs($0) } }
+  registry.add("Float32x3", "Add", .scalar) { measureScalar($0, $1, lanes: 3, float32) { $0 + $1 } }
+  registry.add("Float32x3", "Subtract", .scalar) { measureScalar($0, $1, lanes: 3, float32) { $0 - $1 } }
+  registry.add("Float32x3", "Multiply", .scalar) { measureScalar($0, $1, lanes: 3, float32) { $0 * $1 } }
+  registry.add("Float32x3", "Divide", .scalar) { measureScalar($0, $1, lanes: 3, float32) { $0 / $1 } }
+  registry.add("Float32x3", "Minimum", .scalar) { measureScalar($0, $1, lanes: 3, float32) { min($0, $1) } }
+  registry.add("Float32x3", "Maximum", .scalar) { measureScalar($0, $1, lanes: 3, float32) { max($0, $1) } }
+  registry.add("Float32x3", "SquareRoot", .scalar) { measureScalar($0, $1, lanes: 3, float32) { $0.squareRoot() } }
+  registry.add("Float32x3", "Negate", .scalar) { measureScalar($0, $1, lanes: 3, float32) { -$0 } }
+  registry.add("Float32x3", "Magnitude", .scalar) { measureScalar($0, $1, lanes: 3, float32) { abs($0) } }
+  registry.add("Float32x4", "Add", .scalar) { measureScalar($0, $1, lanes: 4, float32) { $0 + $1 } }
+  registry.add("Float32x4", "Subtract", .scalar) { measureScalar($0, $1, lanes: 4, float32) { $0 - $1 } }
+  registry.add("Float32x4", "Multiply", .scalar) { measureScalar($0, $1, lanes: 4, float32) { $0 * $1 } }
+  registry.add("Float32x4", "Divide", .scalar) { measureScalar($0, $1, lanes: 4, float32) { $0 / $1 } }
+  registry.add("Float32x4", "Minimum", .scalar) { measureScalar($0, $1, lanes: 4, float32) { min($0, $1) } }
+  registry.add("Float32x4", "Maximum", .scalar) { measureScalar($0, $1, lanes: 4, float32) { max($0, $1) } }
+  registry.add("Float32x4", "SquareRoot", .scalar) { measureScalar($0, $1, lanes: 4, float32) { $0.squareRoot() } }
+  registry.add("Float32x4", "Negate", .scalar) { measureScalar($0, $1, lanes: 4, float32) { -$0 } }
+  registry.add("Float32x4", "Magnitude", .scalar) { measureScalar($0, $1, lanes: 4, float32) { abs($0) } }
+  registry.add("Float64x2", "Add", .scalar) { measureScalar($0, $1, lanes: 2, float64) { $0 + $1 } }
+  registry.add("Float64x2", "Subtract", .scalar) { measureScalar($0, $1, lanes: 2, float64) { $0 - $1 } }
+  registry.add("Float64x2", "Multiply", .scalar) { measureScalar($0, $1, lanes: 2, float64) { $0 * $1 } }
+  registry.add("Float64x2", "Divide", .scalar) { measureScalar($0, $1, lanes: 2, float64) { $0 / $1 } }
+  registry.add("Float64x2", "Minimum", .scalar) { measureScalar($0, $1, lanes: 2, float64) { min($0, $1) } }
+  registry.add("Float64x2", "Maximum", .scalar) { measureScalar($0, $1, lanes: 2, float64) { max($0, $1) } }
+  registry.add("Float64x2", "SquareRoot", .scalar) { measureScalar($0, $1, lanes: 2, float64) { $0.squareRoot() } }
+  registry.add("Float64x2", "Negate", .scalar) { measureScalar($0, $1, lanes: 2, float64) { -$0 } }
+  registry.add("Float64x2", "Magnitude", .scalar) { measureScalar($0, $1, lanes: 2, float64) { abs($0) } }
+  registry.add("Float64x3", "Add", .scalar) { measureScalar($0, $1, lanes: 3, float64) { $0 + $1 } }
+  registry.add("Float64x3", "Subtract", .scalar) { measureScalar($0, $1, lanes: 3, float64) { $0 - $1 } }
+  registry.add("Float64x3", "Multiply", .scalar) { measureScalar($0, $1, lanes: 3, float64) { $0 * $1 } }
+  registry.add("Float64x3", "Divide", .scalar) { measureScalar($0, $1, lanes: 3, float64) { $0 / $1 } }
+  registry.add("Float64x3", "Minimum", .scalar) { measureScalar($0, $1, lanes: 3, float64) { min($0, $1) } }
+  registry.add("Float64x3", "Maximum", .scalar) { measureScalar($0, $1, lanes: 3, float64) { max($0, $1) } }
+  registry.add("Float64x3", "SquareRoot", .scalar) { measureScalar($0, $1, lanes: 3, float64) { $0.squareRoot() } }
+  registry.add("Float64x3", "Negate", .scalar) { measureScalar($0, $1, lanes: 3, float64) { -$0 } }
+  registry.add("Float64x3", "Magnitude", .scalar) { measureScalar($0, $1, lanes: 3, float64) { abs($0) } }
+  registry.add("Float64x4", "Add", .scalar) { measureScalar($0, $1, lanes: 4, float64) { $0 + $1 } }
+  registry.add("Float64x4", "Subtract", .scalar) { measureScalar($0, $1, lanes: 4, float64) { $0 - $1 } }
+  registry.add("Float64x4", "Multiply", .scalar) { measureScalar($0, $1, lanes: 4, float64) { $0 * $1 } }
+  registry.add("Float64x4", "Divide", .scalar) { measureScalar($0, $1, lanes: 4, float64) { $0 / $1 } }
+  registry.add("Float64x4", "Minimum", .scalar) { measureScalar($0, $1, lanes: 4, float64) { min($0, $1) } }
+  registry.add("Float64x4", "Maximum", .scalar) { measureScalar($0, $1, lanes: 4, float64) { max($0, $1) } }
+  registry.add("Float64x4", "SquareRoot", .scalar) { measureScalar($0, $1, lanes: 4, float64) { $0.squareRoot() } }
+  registry.add("Float64x4", "Negate", .scalar) { measureScalar($0, $1, lanes: 4, float64) { -$0 } }
+  registry.add("Float64x4", "Magnitude", .scalar) { measureScalar($0, $1, lanes: 4, float64) { abs($0) } }
+}
+
+// MARK: - Standard Library
+
+private func registerStandardLibraryBenchmarks(_ registry: inout BenchmarkRegistry) {
+  let stdlibFloat32x2 = Operands(step: SIMD2<Float32>(repeating: 1 + .ulpOfOne)) {
+    SIMD2<Float32>(Float32(operandValue($0)), Float32(operandValue($0 + 1)))
+  }
+  registry.add("Float32x2", "Add", .stdlib) { measure($0, $1, stdlibFloat32x2) { $0 + $1 } }
+  registry.add("Float32x2", "Subtract", .stdlib) { measure($0, $1, stdlibFloat32x2) { $0 - $1 } }
+  registry.add("Float32x2", "Multiply", .stdlib) { measure($0, $1, stdlibFloat32x2) { $0 * $1 } }
+  registry.add("Float32x2", "Divide", .stdlib) { measure($0, $1, stdlibFloat32x2) { $0 / $1 } }
+  registry.add("Float32x2", "Minimum", .stdlib) { measure($0, $1, stdlibFloat32x2) { pointwiseMin($0, $1) } }
+  registry.add("Float32x2", "Maximum", .stdlib) { measure($0, $1, stdlibFloat32x2) { pointwiseMax($0, $1) } }
+  registry.add("Float32x2", "SquareRoot", .stdlib) { measure($0, $1, stdlibFloat32x2) { $0.squareRoot() } }
+  registry.add("Float32x2", "Negate", .stdlib) { measure($0, $1, stdlibFloat32x2) { -$0 } }
+
+  let stdlibFloat32x3 = Operands(step: SIMD3<Float32>(repeating: 1 + .ulpOfOne)) {
+    SIMD3<Float32>(Float32(operandValue($0)), Float32(operandValue($0 + 1)), Float32(operandValue($0 + 2)))
+  }
+  registry.add("Float32x3", "Add", .stdlib) { measure($0, $1, stdlibFloat32x3) { $0 + $1 } }
+  registry.add("Float32x3", "Subtract", .stdlib) { measure($0, $1, stdlibFloat32x3) { $0 - $1 } }
+  registry.add("Float32x3", "Multiply", .stdlib) { measure($0, $1, stdlibFloat32x3) { $0 * $1 } }
+  registry.add("Float32x3", "Divide", .stdlib) { measure($0, $1, stdlibFloat32x3) { $0 / $1 } }
+  registry.add("Float32x3", "Minimum", .stdlib) { measure($0, $1, stdlibFloat32x3) { pointwiseMin($0, $1) } }
+  registry.add("Float32x3", "Maximum", .stdlib) { measure($0, $1, stdlibFloat32x3) { pointwiseMax($0, $1) } }
+  registry.add("Float32x3", "SquareRoot", .stdlib) { measure($0, $1, stdlibFloat32x3) { $0.squareRoot() } }
+  registry.add("Float32x3", "Negate", .stdlib) { measure($0, $1, stdlibFloat32x3) { -$0 } }
+  registry.add("Float32x3", "Dot", .stdlib, metrics: [.throughput]) { measure($1, stdlibFloat32x3) { ($0 * $1).sum() } }
+
+  let stdlibFloat32x4 = Operands(step: SIMD4<Float32>(repeating: 1 + .ulpOfOne)) {
+    SIMD4<Float32>(Float32(operandValue($0)), Float32(operandValue($0 + 1)), Float32(operandValue($0 + 2)), Float32(operandValue($0 + 3)))
+  }
+  registry.add("Float32x4", "Add", .stdlib) { measure($0, $1, stdlibFloat32x4) { $0 + $1 } }
+  registry.add("Float32x4", "Subtract", .stdlib) { measure($0, $1, stdlibFloat32x4) { $0 - $1 } }
+  registry.add("Float32x4", "Multiply", .stdlib) { measure($0, $1, stdlibFloat32x4) { $0 * $1 } }
+  registry.add("Float32x4", "Divide", .stdlib) { measure($0, $1, stdlibFloat32x4) { $0 / $1 } }
+  registry.add("Float32x4", "Minimum", .stdlib) { measure($0, $1, stdlibFloat32x4) { pointwiseMin($0, $1) } }
+  registry.add("Float32x4", "Maximum", .stdlib) { measure($0, $1, stdlibFloat32x4) { pointwiseMax($0, $1) } }
+  registry.add("Float32x4", "SquareRoot", .stdlib) { measure($0, $1, stdlibFloat32x4) { $0.squareRoot() } }
+  registry.add("Float32x4", "Negate", .stdlib) { measure($0, $1, stdlibFloat32x4) { -$0 } }
+
+  let stdlibFloat64x2 = Operands(step: SIMD2<Float64>(repeating: 1 + .ulpOfOne)) {
+    SIMD2<Float64>(Float64(operandValue($0)), Float64(operandValue($0 + 1)))
+  }
+  registry.add("Float64x2", "Add", .stdlib) { measure($0, $1, stdlibFloat64x2) { $0 + $1 } }
+  registry.add("Float64x2", "Subtract", .stdlib) { measure($0, $1, stdlibFloat64x2) { $0 - $1 } }
+  registry.add("Float64x2", "Multiply", .stdlib) { measure($0, $1, stdlibFloat64x2) { $0 * $1 } }
+  registry.add("Float64x2", "Divide", .stdlib) { measure($0, $1, stdlibFloat64x2) { $0 / $1 } }
+  registry.add("Float64x2", "Minimum", .stdlib) { measure($0, $1, stdlibFloat64x2) { pointwiseMin($0, $1) } }
+  registry.add("Float64x2", "Maximum", .stdlib) { measure($0, $1, stdlibFloat64x2) { pointwiseMax($0, $1) } }
+  registry.add("Float64x2", "SquareRoot", .stdlib) { measure($0, $1, stdlibFloat64x2) { $0.squareRoot() } }
+  registry.add("Float64x2", "Negate", .stdlib) { measure($0, $1, stdlibFloat64x2) { -$0 } }
+
+  let stdlibFloat64x3 = Operands(step: SIMD3<Float64>(repeating: 1 + .ulpOfOne)) {
+    SIMD3<Float64>(Float64(operandValue($0)), Float64(operandValue($0 + 1)), Float64(operandValue($0 + 2)))
+  }
+  registry.add("Float64x3", "Add", .stdlib) { measure($0, $1, stdlibFloat64x3) { $0 + $1 } }
+  registry.add("Float64x3", "Subtract", .stdlib) { measure($0, $1, stdlibFloat64x3) { $0 - $1 } }
+  registry.add("Float64x3", "Multiply", .stdlib) { measure($0, $1, stdlibFloat64x3) { $0 * $1 } }
+  registry.add("Float64x3", "Divide", .stdlib) { measure($0, $1, stdlibFloat64x3) { $0 / $1 } }
+  registry.add("Float64x3", "Minimum", .stdlib) { measure($0, $1, stdlibFloat64x3) { pointwiseMin($0, $1) } }
+  registry.add("Float64x3", "Maximum", .stdlib) { measure($0, $1, stdlibFloat64x3) { pointwiseMax($0, $1) } }
+  registry.add("Float64x3", "SquareRoot", .stdlib) { measure($0, $1, stdlibFloat64x3) { $0.squareRoot() } }
+  registry.add("Float64x3", "Negate", .stdlib) { measure($0, $1, stdlibFloat64x3) { -$0 } }
+  registry.add("Float64x3", "Dot", .stdlib, metrics: [.throughput]) { measure($1, stdlibFloat64x3) { ($0 * $1).sum() } }
+
+  let stdlibFloat64x4 = Operands(step: SIMD4<Float64>(repeating: 1 + .ulpOfOne)) {
+    SIMD4<Float64>(Float64(operandValue($0)), Float64(operandValue($0 + 1)), Float64(operandValue($0 + 2)), Float64(operandValue($0 + 3)))
+  }
+  registry.add("Float64x4", "Add", .stdlib) { measure($0, $1, stdlibFloat64x4) { $0 + $1 } }
+  registry.add("Float64x4", "Subtract", .stdlib) { measure($0, $1, stdlibFloat64x4) { $0 - $1 } }
+  registry.add("Float64x4", "Multiply", .stdlib) { measure($0, $1, stdlibFloat64x4) { $0 * $1 } }
+  registry.add("Float64x4", "Divide", .stdlib) { measure($0, $1, stdlibFloat64x4) { $0 / $1 } }
+  registry.add("Float64x4", "Minimum", .stdlib) { measure($0, $1, stdlibFloat64x4) { pointwiseMin($0, $1) } }
+  registry.add("Float64x4", "Maximum", .stdlib) { measure($0, $1, stdlibFloat64x4) { pointwiseMax($0, $1) } }
+  registry.add("Float64x4", "SquareRoot", .stdlib) { measure($0, $1, stdlibFloat64x4) { $0.squareRoot() } }
+  registry.add("Float64x4", "Negate", .stdlib) { measure($0, $1, stdlibFloat64x4) { -$0 } }
+}
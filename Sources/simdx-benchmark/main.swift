@@ -0,0 +1,180 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the throughput and latency of the CSIMDX functions, the SIMDX
+// wrappers, scalar loops and the standard library SIMD types.
+//
+//     swift run -c release simdx-benchmark [options]
+//
+//     --filter <text>     Run only benchmarks whose name contains <text>
+//     --samples <n>       Samples per benchmark, the median is reported (7)
+//     --min-time <ms>     Minimum duration of a sample in milliseconds (10)
+//     --format text|json  Output format (text)
+//     --output <path>     Write to <path> instead of the standard output
+//     --list              List the benchmark names and exit
+//     --compare <json>... Print a table of previous `--format json` results,
+//                         e.g. of each tier of Scripts/benchmark-matrix.sh
+
+import Foundation
+import SIMDX
+
+/// The JSON document written with `--format json`.
+struct Report: Codable {
+  struct Backend: Codable {
+    let isaLevel: String?
+    let activeFeatures: [String]
+    let cpuFeatures: [String]
+    let storages: [String: String]
+  }
+  let backend: Backend
+  let samples: Int
+  let minimumTimeNanoseconds: UInt64
+  let results: [BenchmarkResult]
+}
+
+func fail(_ message: String) -> Never {
+  FileHandle.standardError.write("error: \(message)\n".data(using: .utf8)!)
+  exit(2)
+}
+
+// MARK: - Arguments
+
+var filter: String?
+var samples = 7
+var minimumTime: UInt64 = 10_000_000
+var json = false
+var outputPath: String?
+var listOnly = false
+var comparePaths: [String]?
+
+var arguments = CommandLine.arguments.dropFirst()
+while let argument = arguments.popFirst() {
+  func value() -> String {
+    guard let value = arguments.popFirst() else { fail("missing value for \(argument)") }
+    return value
+  }
+  func number() -> UInt64 {
+    guard let number = UInt64(value()) else { fail("\(argument) expects a positive integer") }
+    return number
+  }
+  switch argument {
+  case "--filter": filter = value()
+  case "--samples": samples = Int(number())
+  case "--min-time": minimumTime = number() * 1_000_000
+  case "--format":
+    switch value() {
+    case "json": json = true
+    case "text": json = false
+    case let format: fail("unknown format '\(format)'")
+    }
+  case "--output": outputPath = value()
+  case "--list": listOnly = true
+  case "--compare": comparePaths = []
+  default:
+    guard comparePaths != nil, !argument.hasPrefix("--") else { fail("unknown argument '\(argument)'") }
+    comparePaths?.append(argument)
+  }
+}
+
+// MARK: - Compare
+
+if let comparePaths = comparePaths {
+  guard !comparePaths.isEmpty else { fail("--compare expects at least one report") }
+  let reports = comparePaths.map { path -> LabeledReport in
+    do {
+      return try LabeledReport(contentsOf: path)
+    } catch {
+      fail("could not read '\(path)': \(error)")
+    }
+  }
+  let table = comparisonTable(reports, filter: filter)
+  if let outputPath = outputPath {
+    do {
+      try table.write(toFile: outputPath, atomically: true, encoding: .utf8)
+    } catch {
+      fail("could not write '\(outputPath)': \(error)")
+    }
+  } else {
+    print(table, terminator: "")
+  }
+  exit(0)
+}
+
+// MARK: - Run
+
+var registry = BenchmarkRegistry()
+registerCSIMDXBenchmarks(&registry)
+registerWrapperBenchmarks(&registry)
+
+let benchmarks = registry.benchmarks.filter { benchmark in
+  filter.map { benchmark.name.contains($0) } ?? true
+}
+
+if listOnly {
+  benchmarks.forEach { print($0.name) }
+  exit(0)
+}
+
+var results: [BenchmarkResult] = []
+for benchmark in benchmarks {
+  let result = run(benchmark, samples: samples, minimumTime: minimumTime)
+  if !json, outputPath == nil {
+    print(result.name.padding(toLength: 56, withPad: " ", startingAt: 0), String(format: "%10.3f ns", result.median))
+  }
+  results.append(result)
+}
+
+// MARK: - Output
+
+let output: Data
+if json {
+  let backend = SIMDXBackend.current
+  func names(_ features: SIMDXBackend.Features) -> [String] {
+    SIMDXBackend.Features.names.filter { features.contains($0.feature) }.map { $0.name }
+  }
+  let report = Report(
+    backend: Report.Backend(
+      isaLevel: backend.isaLevel,
+      activeFeatures: names(backend.activeFeatures),
+      cpuFeatures: names(backend.cpuFeatures),
+      storages: Dictionary(uniqueKeysWithValues: backend.storages.map { ($0.name, $0.kind.rawValue) })
+    ),
+    samples: samples,
+    minimumTimeNanoseconds: minimumTime,
+    results: results
+  )
+  let encoder = JSONEncoder()
+  encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+  do {
+    output = try encoder.encode(report)
+  } catch {
+    fail("could not encode the results: \(error)")
+  }
+} else {
+  output = results
+    .map { "\($0.name) " + String(format: "%.3f %.3f %.3f\n", $0.median, $0.minimum, $0.maximum) }
+    .joined()
+    .data(using: .utf8)!
+}
+
+if let outputPath = outputPath {
+  do {
+    try output.write(to: URL(fileURLWithPath: outputPath))
+  } catch {
+    fail("could not write '\(outputPath)': \(error)")
+  }
+} else if json {
+  FileHandle.standardOutput.write(output)
+  print()
+}
@@ -0,0 +1,168 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define _GNU_SOURCE
+#include "Counters.h"
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+  #include <linux/perf_event.h>
+  #include <sched.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+  #include <cpuid.h>
+  #include <x86intrin.h>
+#endif
+
+#pragma mark - perf_event_open
+
+#if defined(__linux__)
+static int CyclesPerfOpen(uint32_t type, uint64_t config)
+{
+  struct perf_event_attr attributes;
+  memset(&attributes, 0, sizeof(attributes));
+  attributes.size = sizeof(attributes);
+  attributes.type = type;
+  attributes.config = config;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  int descriptor = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+  if (descriptor >= 0) ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+  return descriptor;
+}
+
+/// Returns the raw event of the micro-ops of the CPU vendor, or 0 if unknown.
+static uint64_t CyclesUopsEvent(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx)) return 0;
+  if (ebx == 0x756e6547 && edx == 0x49656e69 && ecx == 0x6c65746e) {
+    return 0x010e; // GenuineIntel: UOPS_ISSUED.ANY
+  }
+  if (ebx == 0x68747541 && edx == 0x69746e65 && ecx == 0x444d4163) {
+    return 0x00c1; // AuthenticAMD: retired ops
+  }
+#endif
+  return 0;
+}
+#endif
+
+static uint64_t CyclesPerfRead(int descriptor)
+{
+  uint64_t value = 0;
+  if (descriptor < 0 || read(descriptor, &value, sizeof(value)) != sizeof(value)) return 0;
+  return value;
+}
+
+#pragma mark - Counters
+
+CyclesCounters CyclesCountersOpen(int timestampOnly)
+{
+  CyclesCounters counters = { CyclesSourceClock, -1, -1 };
+#if defined(__linux__)
+  if (!timestampOnly) {
+    counters.cyclesDescriptor = CyclesPerfOpen(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    if (counters.cyclesDescriptor >= 0) {
+      counters.source = CyclesSourcePerf;
+      uint64_t event = CyclesUopsEvent();
+      if (event) counters.uopsDescriptor = CyclesPerfOpen(PERF_TYPE_RAW, event);
+      return counters;
+    }
+  }
+#else
+  (void)timestampOnly;
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+  counters.source = CyclesSourceTSC;
+#elif defined(__aarch64__)
+  counters.source = CyclesSourceCNTVCT;
+#endif
+  return counters;
+}
+
+CyclesSample CyclesCountersRead(const CyclesCounters* counters)
+{
+  CyclesSample sample = { 0, 0 };
+  switch (counters->source) {
+    case CyclesSourcePerf:
+      sample.cycles = CyclesPerfRead(counters->cyclesDescriptor);
+      sample.uops = CyclesPerfRead(counters->uopsDescriptor);
+      break;
+    case CyclesSourceTSC:
+#if defined(__x86_64__) || defined(__i386__)
+      _mm_lfence();
+      sample.cycles = __rdtsc();
+      _mm_lfence();
+#endif
+      break;
+    case CyclesSourceCNTVCT:
+#if defined(__aarch64__)
+      __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(sample.cycles));
+#endif
+      break;
+    case CyclesSourceClock: {
+      struct timespec time;
+      clock_gettime(CLOCK_MONOTONIC, &time);
+      sample.cycles = (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+      break;
+    }
+  }
+  return sample;
+}
+
+void CyclesCountersClose(CyclesCounters* counters)
+{
+  if (counters->cyclesDescriptor >= 0) close(counters->cyclesDescriptor);
+  if (counters->uopsDescriptor >= 0) close(counters->uopsDescriptor);
+  counters->cyclesDescriptor = -1;
+  counters->uopsDescriptor = -1;
+}
+
+const char* CyclesSourceUnit(CyclesSource source)
+{
+  switch (source) {
+    case CyclesSourcePerf: return "cycles";
+    case CyclesSourceTSC: return "ref-cycles";
+    case CyclesSourceCNTVCT: return "ticks";
+    case CyclesSourceClock: return "ns";
+  }
+  return "?";
+}
+
+int CyclesCountersHaveUops(const CyclesCounters* counters)
+{
+  return counters->uopsDescriptor >= 0;
+}
+
+#pragma mark - Affinity
+
+int CyclesPinToCore(int core)
+{
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+  return sched_setaffinity(0, sizeof(set), &set) == 0 ? 0 : -1;
+#else
+  // macOS offers affinity tags only, which are hints rather than bindings
+  (void)core;
+  return -1;
+#endif
+}
@@ -0,0 +1,71 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#pragma mark - Type def
+
+/// Where the cycle counts of `CyclesCounters` come from, best first.
+typedef enum CyclesSource_t {
+  /// Core clock cycles of the calling thread, from `perf_event_open` on Linux
+  CyclesSourcePerf    = 0,
+  /// The time stamp counter of x86, ticking at a constant reference frequency
+  CyclesSourceTSC     = 1,
+  /// The virtual counter `cntvct_el0` of AArch64, ticking at `cntfrq_el0`
+  CyclesSourceCNTVCT  = 2,
+  /// The monotonic clock, in nanoseconds
+  CyclesSourceClock   = 3,
+} CyclesSource;
+
+/// The counters a measurement reads.
+typedef struct CyclesCounters_t {
+  CyclesSource source;
+  /// The `perf_event_open` descriptor of the core cycles, or -1
+  int cyclesDescriptor;
+  /// The `perf_event_open` descriptor of the issued or retired micro-ops, or -1
+  int uopsDescriptor;
+} CyclesCounters;
+
+/// A reading of all counters.
+typedef struct CyclesSample_t {
+  uint64_t cycles;
+  /// Zero if the micro-ops are not counted
+  uint64_t uops;
+} CyclesSample;
+
+#pragma mark - Counters
+
+/// Opens the best counters available to the process. Passing a non-zero
+/// `timestampOnly` skips `perf_event_open`, e.g. to compare with the TSC.
+CyclesCounters CyclesCountersOpen(int timestampOnly);
+
+/// Reads the current value of all counters.
+CyclesSample CyclesCountersRead(const CyclesCounters* counters);
+
+/// Closes the descriptors of `counters`.
+void CyclesCountersClose(CyclesCounters* counters);
+
+/// Returns the unit of the cycle counts, e.g. `"cycles"` or `"ref-cycles"`.
+const char* CyclesSourceUnit(CyclesSource source);
+
+/// Returns whether `counters` count micro-ops.
+int CyclesCountersHaveUops(const CyclesCounters* counters);
+
+#pragma mark - Affinity
+
+/// Binds the calling thread to logical CPU `core`.
+/// @return 0 on success, -1 if not supported or permitted
+int CyclesPinToCore(int core);
@@ -0,0 +1,191 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Kernels.h"
+#include "CSIMDX.h"
+
+/// Makes the compiler forget what it knows about `value`, without emitting
+/// any instruction. Register storages stay in their register; storages
+/// emulated by structs are spilled, which is why the kernels hide the second
+/// operand, off the dependency chain, rather than the result. This keeps
+/// chains such as `x + y + y` from being folded into `x + 2 * y`.
+#if defined(__x86_64__) || defined(__i386__)
+  #define CYCLES_OPAQUE(value) __asm__ volatile("" : "+xm"(value))
+#elif defined(__aarch64__) || defined(__arm__)
+  #define CYCLES_OPAQUE(value) __asm__ volatile("" : "+wm"(value))
+#else
+  #define CYCLES_OPAQUE(value) __asm__ volatile("" : "+m"(value))
+#endif
+
+#define CYCLES_REPEAT(statement) \
+  statement statement statement statement statement statement statement statement
+
+#pragma mark - Chains
+
+/// `x = operation(x, y)`
+#define CYCLES_BINARY(Type, Operation, lhs, rhs)                                       \
+  static void Type##Operation##Latency(uint64_t iterations)                            \
+  {                                                                                    \
+    Type x = Type##MakeRepeatingElement(lhs);                                          \
+    Type y = Type##MakeRepeatingElement(rhs);                                          \
+    for (uint64_t index = 0; index < iterations; index++) {                            \
+      CYCLES_REPEAT(CYCLES_OPAQUE(y); x = Type##Operation(x, y);)                      \
+    }                                                                                  \
+    CYCLES_OPAQUE(x);                                                                  \
+  }                                                                                    \
+  static void Type##Operation##Throughput(uint64_t iterations)                         \
+  {                                                                                    \
+    Type x0 = Type##MakeRepeatingElement(lhs), x1 = x0, x2 = x0, x3 = x0;              \
+    Type x4 = x0, x5 = x0, x6 = x0, x7 = x0;                                           \
+    Type y = Type##MakeRepeatingElement(rhs);                                          \
+    for (uint64_t index = 0; index < iterations; index++) {                            \
+      CYCLES_OPAQUE(y); x0 = Type##Operation(x0, y);                                   \
+      CYCLES_OPAQUE(y); x1 = Type##Operation(x1, y);                                   \
+      CYCLES_OPAQUE(y); x2 = Type##Operation(x2, y);                                   \
+      CYCLES_OPAQUE(y); x3 = Type##Operation(x3, y);                                   \
+      CYCLES_OPAQUE(y); x4 = Type##Operation(x4, y);                                   \
+      CYCLES_OPAQUE(y); x5 = Type##Operation(x5, y);                                   \
+      CYCLES_OPAQUE(y); x6 = Type##Operation(x6, y);                                   \
+      CYCLES_OPAQUE(y); x7 = Type##Operation(x7, y);                                   \
+    }                                                                                  \
+    CYCLES_OPAQUE(x0); CYCLES_OPAQUE(x1); CYCLES_OPAQUE(x2); CYCLES_OPAQUE(x3);        \
+    CYCLES_OPAQUE(x4); CYCLES_OPAQUE(x5); CYCLES_OPAQUE(x6); CYCLES_OPAQUE(x7);        \
+  }
+
+/// `x = operation(x, y, z)`
+#define CYCLES_TERNARY(Type, Operation, lhs, rhs, addend)                              \
+  static void Type##Operation##Latency(uint64_t iterations)                            \
+  {                                                                                    \
+    Type x = Type##MakeRepeatingElement(lhs);                                          \
+    Type y = Type##MakeRepeatingElement(rhs);                                          \
+    Type z = Type##MakeRepeatingElement(addend);                                       \
+    for (uint64_t index = 0; index < iterations; index++) {                            \
+      CYCLES_REPEAT(CYCLES_OPAQUE(y); x = Type##Operation(x, y, z);)                   \
+    }                                                                                  \
+    CYCLES_OPAQUE(x);                                                                  \
+  }                                                                                    \
+  static void Type##Operation##Throughput(uint64_t iterations)                         \
+  {                                                                                    \
+    Type x0 = Type##MakeRepeatingElement(lhs), x1 = x0, x2 = x0, x3 = x0;              \
+    Type x4 = x0, x5 = x0, x6 = x0, x7 = x0;                                           \
+    Type y = Type##MakeRepeatingElement(rhs);                                          \
+    Type z = Type##MakeRepeatingElement(addend);                                       \
+    for (uint64_t index = 0; index < iterations; index++) {                            \
+      CYCLES_OPAQUE(y); x0 = Type##Operation(x0, y, z);                                \
+      CYCLES_OPAQUE(y); x1 = Type##Operation(x1, y, z);                                \
+      CYCLES_OPAQUE(y); x2 = Type##Operation(x2, y, z);                                \
+      CYCLES_OPAQUE(y); x3 = Type##Operation(x3, y, z);                                \
+      CYCLES_OPAQUE(y); x4 = Type##Operation(x4, y, z);                                \
+      CYCLES_OPAQUE(y); x5 = Type##Operation(x5, y, z);                                \
+      CYCLES_OPAQUE(y); x6 = Type##Operation(x6, y, z);                                \
+      CYCLES_OPAQUE(y); x7 = Type##Operation(x7, y, z);                                \
+    }                                                                                  \
+    CYCLES_OPAQUE(x0); CYCLES_OPAQUE(x1); CYCLES_OPAQUE(x2); CYCLES_OPAQUE(x3);        \
+    CYCLES_OPAQUE(x4); CYCLES_OPAQUE(x5); CYCLES_OPAQUE(x6); CYCLES_OPAQUE(x7);        \
+  }
+
+/// `x = operation(x)`; the result itself has to be hidden, as e.g. a negation
+/// of a negation would fold, which spills storages emulated by structs.
+#define CYCLES_UNARY(Type, Operation, operand)                                         \
+  static void Type##Operation##Latency(uint64_t iterations)                            \
+  {                                                                                    \
+    Type x = Type##MakeRepeatingElement(operand);                                      \
+    for (uint64_t index = 0; index < iterations; index++) {                            \
+      CYCLES_REPEAT(x = Type##Operation(x); CYCLES_OPAQUE(x);)                         \
+    }                                                                                  \
+  }                                                                                    \
+  static void Type##Operation##Throughput(uint64_t iterations)                         \
+  {                                                                                    \
+    Type x0 = Type##MakeRepeatingElement(operand), x1 = x0, x2 = x0, x3 = x0;          \
+    Type x4 = x0, x5 = x0, x6 = x0, x7 = x0;                                           \
+    for (uint64_t index = 0; index < iterations; index++) {                            \
+      x0 = Type##Operation(x0); CYCLES_OPAQUE(x0);                                     \
+      x1 = Type##Operation(x1); CYCLES_OPAQUE(x1);                                     \
+      x2 = Type##Operation(x2); CYCLES_OPAQUE(x2);                                     \
+      x3 = Type##Operation(x3); CYCLES_OPAQUE(x3);                                     \
+      x4 = Type##Operation(x4); CYCLES_OPAQUE(x4);                                     \
+      x5 = Type##Operation(x5); CYCLES_OPAQUE(x5);                                     \
+      x6 = Type##Operation(x6); CYCLES_OPAQUE(x6);                                     \
+      x7 = Type##Operation(x7); CYCLES_OPAQUE(x7);                                     \
+    }                                                                                  \
+  }
+
+// The operands keep the chains finite and normal over any number of
+// iterations, so that no subnormal penalty distorts the results.
+
+CYCLES_BINARY(CFloat32x3, Add, 1.5f, 1.0f)
+CYCLES_BINARY(CFloat32x3, Divide, 1.5f, 1.0000001f)
+CYCLES_BINARY(CFloat32x4, Add, 1.5f, 1.0f)
+CYCLES_BINARY(CFloat32x4, Multiply, 1.5f, 1.0000001f)
+CYCLES_BINARY(CFloat32x4, Divide, 1.5f, 1.0000001f)
+CYCLES_BINARY(CFloat32x4, Minimum, 1.5f, 1.0f)
+CYCLES_TERNARY(CFloat32x4, MultiplyAdd, 1.5f, 0.5f, 1.0f)
+CYCLES_UNARY(CFloat32x4, SquareRoot, 2.0f)
+CYCLES_UNARY(CFloat32x4, Negate, 2.0f)
+CYCLES_BINARY(CFloat64x2, Add, 1.5, 1.0)
+CYCLES_BINARY(CFloat64x2, Multiply, 1.5, 1.0000001)
+CYCLES_BINARY(CFloat64x2, Divide, 1.5, 1.0000001)
+CYCLES_BINARY(CFloat64x2, Minimum, 1.5, 1.0)
+CYCLES_UNARY(CFloat64x2, SquareRoot, 2.0)
+CYCLES_BINARY(CFloat64x4, Add, 1.5, 1.0)
+CYCLES_BINARY(CFloat64x4, Multiply, 1.5, 1.0000001)
+CYCLES_BINARY(CFloat64x4, Divide, 1.5, 1.0000001)
+CYCLES_UNARY(CFloat64x4, SquareRoot, 2.0)
+CYCLES_BINARY(CInt32x3, Multiply, 3, 3)
+CYCLES_BINARY(CInt32x3, Minimum, 3, -3)
+CYCLES_UNARY(CInt32x3, Negate, -3)
+CYCLES_BINARY(CInt32x4, Multiply, 3, 3)
+CYCLES_BINARY(CInt32x4, Minimum, 3, -3)
+CYCLES_BINARY(CUInt32x4, Add, 3, 3)
+CYCLES_BINARY(CUInt32x4, Multiply, 3, 3)
+CYCLES_BINARY(CUInt32x4, Minimum, 3, 5)
+CYCLES_BINARY(CUInt32x4, Maximum, 3, 5)
+
+#pragma mark - Table
+
+/// Names the kernel after the storage type without its leading `C`.
+#define CYCLES_KERNEL(Type, Operation) \
+  { #Type + 1, #Operation, Type##Operation##Latency, Type##Operation##Throughput }
+
+const CyclesKernel CyclesKernels[] = {
+  CYCLES_KERNEL(CFloat32x3, Add),
+  CYCLES_KERNEL(CFloat32x3, Divide),
+  CYCLES_KERNEL(CFloat32x4, Add),
+  CYCLES_KERNEL(CFloat32x4, Multiply),
+  CYCLES_KERNEL(CFloat32x4, Divide),
+  CYCLES_KERNEL(CFloat32x4, Minimum),
+  CYCLES_KERNEL(CFloat32x4, MultiplyAdd),
+  CYCLES_KERNEL(CFloat32x4, SquareRoot),
+  CYCLES_KERNEL(CFloat32x4, Negate),
+  CYCLES_KERNEL(CFloat64x2, Add),
+  CYCLES_KERNEL(CFloat64x2, Multiply),
+  CYCLES_KERNEL(CFloat64x2, Divide),
+  CYCLES_KERNEL(CFloat64x2, Minimum),
+  CYCLES_KERNEL(CFloat64x2, SquareRoot),
+  CYCLES_KERNEL(CFloat64x4, Add),
+  CYCLES_KERNEL(CFloat64x4, Multiply),
+  CYCLES_KERNEL(CFloat64x4, Divide),
+  CYCLES_KERNEL(CFloat64x4, SquareRoot),
+  CYCLES_KERNEL(CInt32x3, Multiply),
+  CYCLES_KERNEL(CInt32x3, Minimum),
+  CYCLES_KERNEL(CInt32x3, Negate),
+  CYCLES_KERNEL(CInt32x4, Multiply),
+  CYCLES_KERNEL(CInt32x4, Minimum),
+  CYCLES_KERNEL(CUInt32x4, Add),
+  CYCLES_KERNEL(CUInt32x4, Multiply),
+  CYCLES_KERNEL(CUInt32x4, Minimum),
+  CYCLES_KERNEL(CUInt32x4, Maximum),
+};
+
+const size_t CyclesKernelCount = sizeof(CyclesKernels) / sizeof(CyclesKernels[0]);
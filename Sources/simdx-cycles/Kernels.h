@@ -0,0 +1,41 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// The operations each iteration of a kernel performs.
+#define CYCLES_OPERATIONS_PER_ITERATION 8
+
+/// An operation, measured as a chain of dependent and of independent calls.
+typedef struct CyclesKernel_t {
+  /// The storage type, e.g. `"Float32x4"`
+  const char* type;
+  /// The operation, e.g. `"Divide"`
+  const char* operation;
+  /// Performs `iterations` times a chain of operations, each consuming the
+  /// result of the previous one, which is bound by the latency.
+  void (*latency)(uint64_t iterations);
+  /// Performs `iterations` times as many operations on independent values,
+  /// which is bound by the reciprocal throughput.
+  void (*throughput)(uint64_t iterations);
+} CyclesKernel;
+
+/// All kernels, in the order of the report.
+extern const CyclesKernel CyclesKernels[];
+
+/// The number of `CyclesKernels`.
+extern const size_t CyclesKernelCount;
@@ -0,0 +1,157 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the latency and reciprocal throughput of CSIMDX functions as
+// compiled, in cycles per operation, and their micro-ops where counted.
+//
+//     swift run -c release simdx-cycles [options]
+//
+//     --filter <text>     Run only kernels whose name contains <text>
+//     --core <n>          Pin to logical CPU <n> (0)
+//     --samples <n>       Samples per kernel, the minimum is reported (9)
+//     --tsc               Read the time stamp counter even if perf is available
+//     --format text|json  Output format (text)
+//
+// Core cycles and micro-ops come from perf_event_open on Linux, which may
+// require lowering /proc/sys/kernel/perf_event_paranoid. Otherwise the
+// time stamp counter (x86) or the virtual counter (AArch64) is read, which
+// tick at a constant rate independent of the core clock.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Counters.h"
+#include "Kernels.h"
+#include "CSIMDX.h"
+
+/// The least count of a sample, in the unit of the counters, to make the
+/// overhead of reading them negligible.
+#define CYCLES_MINIMUM_SAMPLE (1u << 22)
+
+typedef struct CyclesResult_t {
+  double perOperation;
+  /// Negative if the micro-ops are not counted. Includes the loop overhead,
+  /// about two micro-ops per `CYCLES_OPERATIONS_PER_ITERATION` operations.
+  double uopsPerOperation;
+} CyclesResult;
+
+static CyclesSample CyclesMeasure(const CyclesCounters* counters,
+                                  void (*kernel)(uint64_t),
+                                  uint64_t iterations)
+{
+  CyclesSample start = CyclesCountersRead(counters);
+  kernel(iterations);
+  CyclesSample end = CyclesCountersRead(counters);
+  return (CyclesSample){ end.cycles - start.cycles, end.uops - start.uops };
+}
+
+/// Runs `kernel` with as many iterations as exceed the minimum sample, and
+/// returns the least count per operation of all `samples`.
+static CyclesResult CyclesRun(const CyclesCounters* counters,
+                              void (*kernel)(uint64_t),
+                              int samples)
+{
+  uint64_t iterations = 1u << 8;
+  while (iterations < (1ull << 32) && CyclesMeasure(counters, kernel, iterations).cycles < CYCLES_MINIMUM_SAMPLE) {
+    iterations <<= 1;
+  }
+  double operations = (double)iterations * CYCLES_OPERATIONS_PER_ITERATION;
+  CyclesResult result = { -1, -1 };
+  for (int index = 0; index < samples; index++) {
+    CyclesSample sample = CyclesMeasure(counters, kernel, iterations);
+    double perOperation = (double)sample.cycles / operations;
+    if (result.perOperation < 0 || perOperation < result.perOperation) {
+      result.perOperation = perOperation;
+      result.uopsPerOperation = CyclesCountersHaveUops(counters) ? (double)sample.uops / operations : -1;
+    }
+  }
+  return result;
+}
+
+static void CyclesUsage(const char* message)
+{
+  fprintf(stderr, "error: %s\n", message);
+  exit(2);
+}
+
+int main(int argc, const char* argv[])
+{
+  const char* filter = NULL;
+  int core = 0;
+  int samples = 9;
+  int timestampOnly = 0;
+  int json = 0;
+
+  for (int index = 1; index < argc; index++) {
+    const char* argument = argv[index];
+    const char* value = index + 1 < argc ? argv[index + 1] : NULL;
+    if (strcmp(argument, "--tsc") == 0) {
+      timestampOnly = 1;
+      continue;
+    }
+    if (!value) CyclesUsage("missing value or unknown argument");
+    if (strcmp(argument, "--filter") == 0) filter = value;
+    else if (strcmp(argument, "--core") == 0) core = atoi(value);
+    else if (strcmp(argument, "--samples") == 0) samples = atoi(value) > 0 ? atoi(value) : 1;
+    else if (strcmp(argument, "--format") == 0) {
+      if (strcmp(value, "json") == 0) json = 1;
+      else if (strcmp(value, "text") == 0) json = 0;
+      else CyclesUsage("unknown format");
+    }
+    else CyclesUsage("unknown argument");
+    index++;
+  }
+
+  int pinned = CyclesPinToCore(core) == 0;
+  CyclesCounters counters = CyclesCountersOpen(timestampOnly);
+  const char* unit = CyclesSourceUnit(counters.source);
+  const char* level = CSIMDXActiveISALevel();
+
+  if (json) {
+    printf("{\n  \"isaLevel\": ");
+    if (level) printf("\"%s\",\n", level); else printf("null,\n");
+    printf("  \"features\": %u,\n  \"unit\": \"%s\",\n  \"pinnedCore\": ", CSIMDXActiveFeatures(), unit);
+    if (pinned) printf("%d,\n", core); else printf("null,\n");
+    printf("  \"results\": [");
+  } else {
+    fprintf(stderr, "unit: %s per operation, %s\n", unit, pinned ? "pinned" : "not pinned");
+    printf("%-28s %10s %11s %10s\n", "kernel", "latency", "rthroughput", "uops");
+  }
+
+  int first = 1;
+  for (size_t index = 0; index < CyclesKernelCount; index++) {
+    const CyclesKernel* kernel = &CyclesKernels[index];
+    char name[64];
+    snprintf(name, sizeof(name), "%s.%s", kernel->type, kernel->operation);
+    if (filter && !strstr(name, filter)) continue;
+
+    CyclesResult latency = CyclesRun(&counters, kernel->latency, samples);
+    CyclesResult throughput = CyclesRun(&counters, kernel->throughput, samples);
+    if (json) {
+      printf("%s\n    { \"name\": \"%s\", \"latency\": %.3f, \"reciprocalThroughput\": %.3f, \"uops\": ",
+             first ? "" : ",", name, latency.perOperation, throughput.perOperation);
+      if (throughput.uopsPerOperation >= 0) printf("%.3f }", throughput.uopsPerOperation); else printf("null }");
+    } else {
+      printf("%-28s %10.3f %11.3f ", name, latency.perOperation, throughput.perOperation);
+      if (throughput.uopsPerOperation >= 0) printf("%10.3f\n", throughput.uopsPerOperation); else printf("%10s\n", "-");
+    }
+    fflush(stdout);
+    first = 0;
+  }
+
+  if (json) printf("\n  ]\n}\n");
+  CyclesCountersClose(&counters);
+  return 0;
+}
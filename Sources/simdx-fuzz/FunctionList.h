@@ -0,0 +1,802 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Every function under test, as
+//
+//     FUZZ(Shape, Type, Operation, Result, Domain, Tolerance)
+//
+// where `Shape` is the signature of `<Type><Operation>`, see `Functions.h`,
+// `Result` the storage it returns, or `Bool` for a predicate, `Domain` the
+// `FuzzDomain` of its operands and `Tolerance` how a backend has to match the
+// reference:
+//
+//  - `FUZZ_EXACT` for integer, bitwise and lane operations, and for the IEEE
+//    operations that are correctly rounded on every backend, i.e. addition,
+//    subtraction, multiplication, division, square root and conversions.
+//    The minimum and maximum of the hardware and their reductions are not exact
+//    across backends, as Arm returns NaN and orders -0.0 before +0.0 where x86
+//    returns the second operand, and accept either with `FUZZ_EITHER` instead,
+//    see the `MinMax` shape.
+//  - `FUZZ_EITHER` for multiply-adds, which are fused where the target has an
+//    instruction for it, and rounded twice otherwise.
+//  - `FUZZ_ULPS(ulps, degree)` where the backends sum up, approximate or
+//    reorder, see `FuzzTolerance`. The degree is the one of the polynomial in
+//    the operands, e.g. 2 for a dot product. Estimates of reciprocal square
+//    roots are refined to about 2^-22 (32-bit) or 2^-40 (64-bit).
+//
+// Included twice by `Functions.h`, hence without include guard.
+
+#pragma mark Float32x2
+
+FUZZ(Make, CFloat32x2, Make, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat32x2, MakeLoad, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat32x2, MakeRepeatingElement, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Nullary, CFloat32x2, MakeZero, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x2, GetElement, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Set, CFloat32x2, SetElement, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x2, ExtractLane, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Insert, CFloat32x2, InsertLane, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Predicate, CFloat32x2, Equal, Bool, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x2, CompareEqual, CInt32x2, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x2, CompareLessThan, CInt32x2, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x2, CompareLessThanOrEqual, CInt32x2, Float32, FUZZ_EXACT)
+FUZZ(Select, CFloat32x2, Select, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x2, Canonicalize, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(MinMax, CFloat32x2, Minimum, CFloat32x2, Float32, FUZZ_EITHER)
+FUZZ(MinMax, CFloat32x2, Maximum, CFloat32x2, Float32, FUZZ_EITHER)
+FUZZ(Binary, CFloat32x2, IEEEMinimum, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x2, IEEEMaximum, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x2, Negate, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x2, Magnitude, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x2, Add, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x2, Subtract, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x2, Multiply, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x2, Divide, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x2, SquareRoot, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x2, AddElement, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x2, SubtractElement, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x2, MultiplyElement, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x2, DivideElement, CFloat32x2, Float32, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat32x2, MultiplyElementAdd, CFloat32x2, Float32, FUZZ_EITHER)
+FUZZ(Fused, CFloat32x2, MultiplyAdd, CFloat32x2, Float32, FUZZ_EITHER)
+FUZZ(Custom, CFloat32x2, FromCFloat64x2, CFloat32x2, Float64, FUZZ_EXACT)
+
+#pragma mark Float32x3
+
+FUZZ(Make, CFloat32x3, Make, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat32x3, MakeLoad, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat32x3, MakeRepeatingElement, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Nullary, CFloat32x3, MakeZero, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x3, GetElement, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Set, CFloat32x3, SetElement, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x3, ExtractLane, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Insert, CFloat32x3, InsertLane, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Predicate, CFloat32x3, Equal, Bool, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x3, CompareEqual, CInt32x3, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x3, CompareLessThan, CInt32x3, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x3, CompareLessThanOrEqual, CInt32x3, Float32, FUZZ_EXACT)
+FUZZ(Select, CFloat32x3, Select, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x3, Canonicalize, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(MinMax, CFloat32x3, Minimum, CFloat32x3, Float32, FUZZ_EITHER)
+FUZZ(MinMax, CFloat32x3, Maximum, CFloat32x3, Float32, FUZZ_EITHER)
+FUZZ(Binary, CFloat32x3, IEEEMinimum, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x3, IEEEMaximum, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x3, Negate, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x3, Magnitude, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x3, Add, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x3, Subtract, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x3, Multiply, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x3, Divide, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x3, SquareRoot, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x3, AddElement, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x3, SubtractElement, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x3, MultiplyElement, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x3, DivideElement, CFloat32x3, Float32, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat32x3, MultiplyElementAdd, CFloat32x3, Float32, FUZZ_EITHER)
+FUZZ(Fused, CFloat32x3, MultiplyAdd, CFloat32x3, Float32, FUZZ_EITHER)
+FUZZ(BinaryReduce, CFloat32x3, Dot, CFloat32x3, Float32Finite, FUZZ_ULPS(4, 2))
+FUZZ(Binary, CFloat32x3, Cross, CFloat32x3, Float32Finite, FUZZ_ULPS(4, 2))
+FUZZ(UnaryReduce, CFloat32x3, LengthSquared, CFloat32x3, Float32Finite, FUZZ_ULPS(4, 2))
+FUZZ(UnaryReduce, CFloat32x3, Length, CFloat32x3, Float32Finite, FUZZ_ULPS(4, 1))
+FUZZ(BinaryReduce, CFloat32x3, Distance, CFloat32x3, Float32Finite, FUZZ_ULPS(4, 1))
+FUZZ(Unary, CFloat32x3, Normalize, CFloat32x3, Float32Finite, FUZZ_ULPS(4, 0))
+FUZZ(Unary, CFloat32x3, FastNormalize, CFloat32x3, Float32Finite, FUZZ_ULPS(4096, 0))
+FUZZ(Binary, CFloat32x3, Reflect, CFloat32x3, Float32Finite, FUZZ_ULPS(8, 3))
+FUZZ(Binary, CFloat32x3, Project, CFloat32x3, Float32Finite, FUZZ_ULPS(8, 1))
+
+#pragma mark Float32x4
+
+FUZZ(Make, CFloat32x4, Make, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat32x4, MakeLoad, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat32x4, MakeRepeatingElement, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Nullary, CFloat32x4, MakeZero, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x4, GetElement, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Set, CFloat32x4, SetElement, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x4, ExtractLane, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Insert, CFloat32x4, InsertLane, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Predicate, CFloat32x4, Equal, Bool, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x4, CompareEqual, CInt32x4, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x4, CompareLessThan, CInt32x4, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x4, CompareLessThanOrEqual, CInt32x4, Float32, FUZZ_EXACT)
+FUZZ(Select, CFloat32x4, Select, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x4, Canonicalize, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(MinMax, CFloat32x4, Minimum, CFloat32x4, Float32, FUZZ_EITHER)
+FUZZ(MinMax, CFloat32x4, Maximum, CFloat32x4, Float32, FUZZ_EITHER)
+FUZZ(Binary, CFloat32x4, IEEEMinimum, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x4, IEEEMaximum, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x4, Negate, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x4, Magnitude, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x4, Add, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x4, Subtract, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x4, Multiply, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x4, Divide, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x4, SquareRoot, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Custom, CFloat32x4, MultiplyAdd, CFloat32x4, Float32, FUZZ_EITHER)
+FUZZ(BinaryScalar, CFloat32x4, AddElement, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x4, SubtractElement, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x4, MultiplyElement, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x4, DivideElement, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat32x4, MultiplyElementAdd, CFloat32x4, Float32, FUZZ_EITHER)
+
+#pragma mark Float64x2
+
+FUZZ(Make, CFloat64x2, Make, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat64x2, MakeLoad, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat64x2, MakeRepeatingElement, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Nullary, CFloat64x2, MakeZero, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x2, GetElement, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Set, CFloat64x2, SetElement, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x2, ExtractLane, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Insert, CFloat64x2, InsertLane, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Predicate, CFloat64x2, Equal, Bool, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x2, Canonicalize, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(MinMax, CFloat64x2, Minimum, CFloat64x2, Float64, FUZZ_EITHER)
+FUZZ(MinMax, CFloat64x2, Maximum, CFloat64x2, Float64, FUZZ_EITHER)
+FUZZ(Binary, CFloat64x2, IEEEMinimum, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x2, IEEEMaximum, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x2, Negate, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x2, Magnitude, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x2, Add, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x2, Subtract, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x2, Multiply, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x2, Divide, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x2, SquareRoot, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x2, AddElement, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x2, SubtractElement, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x2, MultiplyElement, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x2, DivideElement, CFloat64x2, Float64, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat64x2, MultiplyElementAdd, CFloat64x2, Float64, FUZZ_EITHER)
+FUZZ(Fused, CFloat64x2, MultiplyAdd, CFloat64x2, Float64, FUZZ_EITHER)
+FUZZ(Custom, CFloat64x2, FromCFloat32x2, CFloat64x2, Float32, FUZZ_EXACT)
+
+#pragma mark Float64x3
+
+FUZZ(Make, CFloat64x3, Make, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat64x3, MakeLoad, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat64x3, MakeRepeatingElement, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Nullary, CFloat64x3, MakeZero, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x3, GetElement, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Set, CFloat64x3, SetElement, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x3, ExtractLane, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Insert, CFloat64x3, InsertLane, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Predicate, CFloat64x3, Equal, Bool, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x3, Canonicalize, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(MinMax, CFloat64x3, Minimum, CFloat64x3, Float64, FUZZ_EITHER)
+FUZZ(MinMax, CFloat64x3, Maximum, CFloat64x3, Float64, FUZZ_EITHER)
+FUZZ(Binary, CFloat64x3, IEEEMinimum, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x3, IEEEMaximum, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x3, Negate, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x3, Magnitude, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x3, Add, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x3, Subtract, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x3, Multiply, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x3, Divide, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x3, SquareRoot, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x3, AddElement, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x3, SubtractElement, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x3, MultiplyElement, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x3, DivideElement, CFloat64x3, Float64, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat64x3, MultiplyElementAdd, CFloat64x3, Float64, FUZZ_EITHER)
+FUZZ(Fused, CFloat64x3, MultiplyAdd, CFloat64x3, Float64, FUZZ_EITHER)
+FUZZ(BinaryReduce, CFloat64x3, Dot, CFloat64x3, Float64Finite, FUZZ_ULPS(4, 2))
+FUZZ(Binary, CFloat64x3, Cross, CFloat64x3, Float64Finite, FUZZ_ULPS(4, 2))
+FUZZ(UnaryReduce, CFloat64x3, LengthSquared, CFloat64x3, Float64Finite, FUZZ_ULPS(4, 2))
+FUZZ(UnaryReduce, CFloat64x3, Length, CFloat64x3, Float64Finite, FUZZ_ULPS(4, 1))
+FUZZ(BinaryReduce, CFloat64x3, Distance, CFloat64x3, Float64Finite, FUZZ_ULPS(4, 1))
+FUZZ(Unary, CFloat64x3, Normalize, CFloat64x3, Float64Finite, FUZZ_ULPS(4, 0))
+FUZZ(Unary, CFloat64x3, FastNormalize, CFloat64x3, Float64Finite, FUZZ_ULPS(4096, 0))
+FUZZ(Binary, CFloat64x3, Reflect, CFloat64x3, Float64Finite, FUZZ_ULPS(8, 3))
+FUZZ(Binary, CFloat64x3, Project, CFloat64x3, Float64Finite, FUZZ_ULPS(8, 1))
+
+#pragma mark Float64x4
+
+FUZZ(Make, CFloat64x4, Make, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat64x4, MakeLoad, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat64x4, MakeRepeatingElement, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Nullary, CFloat64x4, MakeZero, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x4, GetElement, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Set, CFloat64x4, SetElement, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x4, ExtractLane, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Insert, CFloat64x4, InsertLane, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Predicate, CFloat64x4, Equal, Bool, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x4, Canonicalize, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(MinMax, CFloat64x4, Minimum, CFloat64x4, Float64, FUZZ_EITHER)
+FUZZ(MinMax, CFloat64x4, Maximum, CFloat64x4, Float64, FUZZ_EITHER)
+FUZZ(Binary, CFloat64x4, IEEEMinimum, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x4, IEEEMaximum, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x4, Negate, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x4, Magnitude, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x4, Add, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x4, Subtract, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x4, Multiply, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x4, Divide, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x4, SquareRoot, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x4, AddElement, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x4, SubtractElement, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x4, MultiplyElement, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x4, DivideElement, CFloat64x4, Float64, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat64x4, MultiplyElementAdd, CFloat64x4, Float64, FUZZ_EITHER)
+FUZZ(Fused, CFloat64x4, MultiplyAdd, CFloat64x4, Float64, FUZZ_EITHER)
+
+#pragma mark Float32x8
+
+FUZZ(Make, CFloat32x8, Make, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat32x8, MakeLoad, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat32x8, MakeRepeatingElement, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Nullary, CFloat32x8, MakeZero, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x8, GetElement, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Set, CFloat32x8, SetElement, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x8, ExtractLane, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Insert, CFloat32x8, InsertLane, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Predicate, CFloat32x8, Equal, Bool, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x8, CompareEqual, CInt32x8, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x8, CompareLessThan, CInt32x8, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x8, CompareLessThanOrEqual, CInt32x8, Float32, FUZZ_EXACT)
+FUZZ(Select, CFloat32x8, Select, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x8, Canonicalize, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(MinMax, CFloat32x8, Minimum, CFloat32x8, Float32, FUZZ_EITHER)
+FUZZ(MinMax, CFloat32x8, Maximum, CFloat32x8, Float32, FUZZ_EITHER)
+FUZZ(Binary, CFloat32x8, IEEEMinimum, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x8, IEEEMaximum, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x8, Negate, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x8, Magnitude, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x8, Add, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x8, Subtract, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x8, Multiply, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x8, Divide, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x8, SquareRoot, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x8, AddElement, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x8, SubtractElement, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x8, MultiplyElement, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x8, DivideElement, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat32x8, MultiplyElementAdd, CFloat32x8, Float32, FUZZ_EITHER)
+FUZZ(Fused, CFloat32x8, MultiplyAdd, CFloat32x8, Float32, FUZZ_EITHER)
+FUZZ(UnaryReduce, CFloat32x8, ReduceAdd, CFloat32x8, Float32, FUZZ_EXACT)
+FUZZ(MinMaxReduce, CFloat32x8, ReduceMinimum, CFloat32x8, Float32, FUZZ_EITHER)
+FUZZ(MinMaxReduce, CFloat32x8, ReduceMaximum, CFloat32x8, Float32, FUZZ_EITHER)
+
+#pragma mark Float32x16
+
+FUZZ(MakeLoad, CFloat32x16, MakeLoad, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat32x16, MakeRepeatingElement, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Nullary, CFloat32x16, MakeZero, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x16, GetElement, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Set, CFloat32x16, SetElement, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Get, CFloat32x16, ExtractLane, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Insert, CFloat32x16, InsertLane, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Predicate, CFloat32x16, Equal, Bool, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x16, CompareEqual, CInt32x16, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x16, CompareLessThan, CInt32x16, Float32, FUZZ_EXACT)
+FUZZ(Compare, CFloat32x16, CompareLessThanOrEqual, CInt32x16, Float32, FUZZ_EXACT)
+FUZZ(Select, CFloat32x16, Select, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x16, Canonicalize, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(MinMax, CFloat32x16, Minimum, CFloat32x16, Float32, FUZZ_EITHER)
+FUZZ(MinMax, CFloat32x16, Maximum, CFloat32x16, Float32, FUZZ_EITHER)
+FUZZ(Binary, CFloat32x16, IEEEMinimum, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x16, IEEEMaximum, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x16, Negate, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x16, Magnitude, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x16, Add, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x16, Subtract, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x16, Multiply, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Binary, CFloat32x16, Divide, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x16, SquareRoot, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x16, AddElement, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x16, SubtractElement, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x16, MultiplyElement, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat32x16, DivideElement, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat32x16, MultiplyElementAdd, CFloat32x16, Float32, FUZZ_EITHER)
+FUZZ(Fused, CFloat32x16, MultiplyAdd, CFloat32x16, Float32, FUZZ_EITHER)
+FUZZ(UnaryReduce, CFloat32x16, ReduceAdd, CFloat32x16, Float32, FUZZ_EXACT)
+FUZZ(MinMaxReduce, CFloat32x16, ReduceMinimum, CFloat32x16, Float32, FUZZ_EITHER)
+FUZZ(MinMaxReduce, CFloat32x16, ReduceMaximum, CFloat32x16, Float32, FUZZ_EITHER)
+
+#pragma mark Float64x8
+
+FUZZ(Make, CFloat64x8, Make, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(MakeLoad, CFloat64x8, MakeLoad, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(MakeRepeating, CFloat64x8, MakeRepeatingElement, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Nullary, CFloat64x8, MakeZero, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x8, GetElement, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Set, CFloat64x8, SetElement, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Get, CFloat64x8, ExtractLane, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Insert, CFloat64x8, InsertLane, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Predicate, CFloat64x8, Equal, Bool, Float64, FUZZ_EXACT)
+FUZZ(Compare, CFloat64x8, CompareEqual, CInt32x8, Float64, FUZZ_EXACT)
+FUZZ(Compare, CFloat64x8, CompareLessThan, CInt32x8, Float64, FUZZ_EXACT)
+FUZZ(Compare, CFloat64x8, CompareLessThanOrEqual, CInt32x8, Float64, FUZZ_EXACT)
+FUZZ(Select, CFloat64x8, Select, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x8, Canonicalize, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(MinMax, CFloat64x8, Minimum, CFloat64x8, Float64, FUZZ_EITHER)
+FUZZ(MinMax, CFloat64x8, Maximum, CFloat64x8, Float64, FUZZ_EITHER)
+FUZZ(Binary, CFloat64x8, IEEEMinimum, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x8, IEEEMaximum, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x8, Negate, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x8, Magnitude, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x8, Add, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x8, Subtract, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x8, Multiply, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Binary, CFloat64x8, Divide, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x8, SquareRoot, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x8, AddElement, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x8, SubtractElement, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x8, MultiplyElement, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(BinaryScalar, CFloat64x8, DivideElement, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(FusedScalar, CFloat64x8, MultiplyElementAdd, CFloat64x8, Float64, FUZZ_EITHER)
+FUZZ(Fused, CFloat64x8, MultiplyAdd, CFloat64x8, Float64, FUZZ_EITHER)
+FUZZ(UnaryReduce, CFloat64x8, ReduceAdd, CFloat64x8, Float64, FUZZ_EXACT)
+FUZZ(MinMaxReduce, CFloat64x8, ReduceMinimum, CFloat64x8, Float64, FUZZ_EITHER)
+FUZZ(MinMaxReduce, CFloat64x8, ReduceMaximum, CFloat64x8, Float64, FUZZ_EITHER)
+
+#pragma mark UInt32x2
+
+FUZZ(Make, CUInt32x2, Make, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CUInt32x2, MakeLoad, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CUInt32x2, MakeRepeatingElement, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CUInt32x2, MakeZero, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Get, CUInt32x2, GetElement, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Set, CUInt32x2, SetElement, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, Minimum, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, Maximum, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, CompareElementWise, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CUInt32x2, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x2, CompareEqual, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x2, CompareLessThan, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x2, CompareLessThanOrEqual, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Select, CUInt32x2, Select, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, Add, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, Subtract, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, Multiply, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, BitwiseNot, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, BitwiseAnd, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, BitwiseAndNot, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, BitwiseOr, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, BitwiseExclusiveOr, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, ShiftLeftElementWise, CUInt32x2, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x2, ShiftLeft, CUInt32x2, Shift, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x2, ShiftRightElementWise, CUInt32x2, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x2, ShiftRight, CUInt32x2, Shift, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, PopulationCount, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, LeadingZeroBitCount, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, TrailingZeroBitCount, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, ByteSwap, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, BitReverse, CUInt32x2, Integer, FUZZ_EXACT)
+
+#pragma mark UInt32x3
+
+FUZZ(Make, CUInt32x3, Make, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CUInt32x3, MakeLoad, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CUInt32x3, MakeRepeatingElement, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CUInt32x3, MakeZero, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Get, CUInt32x3, GetElement, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Set, CUInt32x3, SetElement, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, Minimum, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, Maximum, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, CompareElementWise, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CUInt32x3, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x3, CompareEqual, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x3, CompareLessThan, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x3, CompareLessThanOrEqual, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Select, CUInt32x3, Select, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, Add, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, Subtract, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, Multiply, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, BitwiseNot, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, BitwiseAnd, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, BitwiseAndNot, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, BitwiseOr, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, BitwiseExclusiveOr, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, ShiftLeftElementWise, CUInt32x3, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x3, ShiftLeft, CUInt32x3, Shift, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x3, ShiftRightElementWise, CUInt32x3, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x3, ShiftRight, CUInt32x3, Shift, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, PopulationCount, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, LeadingZeroBitCount, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, TrailingZeroBitCount, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, ByteSwap, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, BitReverse, CUInt32x3, Integer, FUZZ_EXACT)
+
+#pragma mark UInt32x4
+
+FUZZ(Make, CUInt32x4, Make, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CUInt32x4, MakeLoad, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CUInt32x4, MakeRepeatingElement, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CUInt32x4, MakeZero, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Get, CUInt32x4, GetElement, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Set, CUInt32x4, SetElement, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, Minimum, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, Maximum, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, CompareElementWise, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CUInt32x4, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x4, CompareEqual, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x4, CompareLessThan, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x4, CompareLessThanOrEqual, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Select, CUInt32x4, Select, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, Add, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, Subtract, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, Multiply, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, BitwiseNot, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, BitwiseAnd, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, BitwiseAndNot, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, BitwiseOr, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, BitwiseExclusiveOr, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, ShiftLeftElementWise, CUInt32x4, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x4, ShiftLeft, CUInt32x4, Shift, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x4, ShiftRightElementWise, CUInt32x4, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x4, ShiftRight, CUInt32x4, Shift, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, PopulationCount, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, LeadingZeroBitCount, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, TrailingZeroBitCount, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, ByteSwap, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, BitReverse, CUInt32x4, Integer, FUZZ_EXACT)
+
+#pragma mark UInt32x8
+
+FUZZ(Make, CUInt32x8, Make, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CUInt32x8, MakeLoad, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CUInt32x8, MakeRepeatingElement, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CUInt32x8, MakeZero, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Get, CUInt32x8, GetElement, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Set, CUInt32x8, SetElement, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, Minimum, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, Maximum, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, CompareElementWise, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CUInt32x8, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x8, CompareEqual, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x8, CompareLessThan, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x8, CompareLessThanOrEqual, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Select, CUInt32x8, Select, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, Add, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, Subtract, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, Multiply, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, BitwiseNot, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, BitwiseAnd, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, BitwiseAndNot, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, BitwiseOr, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, BitwiseExclusiveOr, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, ShiftLeftElementWise, CUInt32x8, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x8, ShiftLeft, CUInt32x8, Shift, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x8, ShiftRightElementWise, CUInt32x8, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x8, ShiftRight, CUInt32x8, Shift, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, PopulationCount, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, LeadingZeroBitCount, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, TrailingZeroBitCount, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, ByteSwap, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, BitReverse, CUInt32x8, Integer, FUZZ_EXACT)
+
+#pragma mark UInt32x16
+
+FUZZ(MakeLoad, CUInt32x16, MakeLoad, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CUInt32x16, MakeRepeatingElement, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CUInt32x16, MakeZero, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Get, CUInt32x16, GetElement, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Set, CUInt32x16, SetElement, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, Minimum, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, Maximum, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, CompareElementWise, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CUInt32x16, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x16, CompareEqual, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x16, CompareLessThan, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Compare, CUInt32x16, CompareLessThanOrEqual, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Select, CUInt32x16, Select, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, Add, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, Subtract, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, Multiply, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, BitwiseNot, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, BitwiseAnd, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, BitwiseAndNot, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, BitwiseOr, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, BitwiseExclusiveOr, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, ShiftLeftElementWise, CUInt32x16, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x16, ShiftLeft, CUInt32x16, Shift, FUZZ_EXACT)
+FUZZ(Binary, CUInt32x16, ShiftRightElementWise, CUInt32x16, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CUInt32x16, ShiftRight, CUInt32x16, Shift, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, PopulationCount, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, LeadingZeroBitCount, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, TrailingZeroBitCount, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, ByteSwap, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, BitReverse, CUInt32x16, Integer, FUZZ_EXACT)
+
+#pragma mark Int32x2
+
+FUZZ(Make, CInt32x2, Make, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CInt32x2, MakeLoad, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CInt32x2, MakeRepeatingElement, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CInt32x2, MakeZero, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Get, CInt32x2, GetElement, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Set, CInt32x2, SetElement, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, Minimum, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, Maximum, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, CompareElementWise, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CInt32x2, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x2, CompareEqual, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x2, CompareLessThan, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x2, CompareLessThanOrEqual, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Select, CInt32x2, Select, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x2, MaskAny, Bool, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x2, MaskAll, Bool, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, Negate, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, Magnitude, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, Add, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, Subtract, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, Multiply, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, BitwiseNot, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, BitwiseAnd, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, BitwiseAndNot, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, BitwiseOr, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, BitwiseExclusiveOr, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, ShiftLeftElementWise, CInt32x2, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x2, ShiftLeft, CInt32x2, Shift, FUZZ_EXACT)
+FUZZ(Binary, CInt32x2, ShiftRightElementWise, CInt32x2, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x2, ShiftRight, CInt32x2, Shift, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, PopulationCount, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, LeadingZeroBitCount, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, TrailingZeroBitCount, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, ByteSwap, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, BitReverse, CInt32x2, Integer, FUZZ_EXACT)
+
+#pragma mark Int32x3
+
+FUZZ(Make, CInt32x3, Make, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CInt32x3, MakeLoad, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CInt32x3, MakeRepeatingElement, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CInt32x3, MakeZero, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Get, CInt32x3, GetElement, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Set, CInt32x3, SetElement, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, Minimum, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, Maximum, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, CompareElementWise, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CInt32x3, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x3, CompareEqual, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x3, CompareLessThan, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x3, CompareLessThanOrEqual, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Select, CInt32x3, Select, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x3, MaskAny, Bool, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x3, MaskAll, Bool, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, Negate, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, Magnitude, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, Add, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, Subtract, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, Multiply, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, BitwiseNot, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, BitwiseAnd, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, BitwiseAndNot, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, BitwiseOr, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, BitwiseExclusiveOr, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, ShiftLeftElementWise, CInt32x3, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x3, ShiftLeft, CInt32x3, Shift, FUZZ_EXACT)
+FUZZ(Binary, CInt32x3, ShiftRightElementWise, CInt32x3, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x3, ShiftRight, CInt32x3, Shift, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, PopulationCount, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, LeadingZeroBitCount, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, TrailingZeroBitCount, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, ByteSwap, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, BitReverse, CInt32x3, Integer, FUZZ_EXACT)
+
+#pragma mark Int32x4
+
+FUZZ(Make, CInt32x4, Make, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CInt32x4, MakeLoad, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CInt32x4, MakeRepeatingElement, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CInt32x4, MakeZero, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Get, CInt32x4, GetElement, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Set, CInt32x4, SetElement, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, Minimum, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, Maximum, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, CompareElementWise, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CInt32x4, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x4, CompareEqual, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x4, CompareLessThan, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x4, CompareLessThanOrEqual, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Select, CInt32x4, Select, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x4, MaskAny, Bool, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x4, MaskAll, Bool, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, Negate, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, Magnitude, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, Add, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, Subtract, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, Multiply, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, BitwiseNot, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, BitwiseAnd, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, BitwiseAndNot, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, BitwiseOr, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, BitwiseExclusiveOr, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, ShiftLeftElementWise, CInt32x4, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x4, ShiftLeft, CInt32x4, Shift, FUZZ_EXACT)
+FUZZ(Binary, CInt32x4, ShiftRightElementWise, CInt32x4, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x4, ShiftRight, CInt32x4, Shift, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, PopulationCount, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, LeadingZeroBitCount, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, TrailingZeroBitCount, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, ByteSwap, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, BitReverse, CInt32x4, Integer, FUZZ_EXACT)
+
+#pragma mark Int32x8
+
+FUZZ(Make, CInt32x8, Make, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(MakeLoad, CInt32x8, MakeLoad, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CInt32x8, MakeRepeatingElement, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CInt32x8, MakeZero, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Get, CInt32x8, GetElement, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Set, CInt32x8, SetElement, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, Minimum, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, Maximum, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, CompareElementWise, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CInt32x8, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x8, CompareEqual, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x8, CompareLessThan, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x8, CompareLessThanOrEqual, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Select, CInt32x8, Select, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x8, MaskAny, Bool, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x8, MaskAll, Bool, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, Negate, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, Magnitude, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, Add, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, Subtract, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, Multiply, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, BitwiseNot, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, BitwiseAnd, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, BitwiseAndNot, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, BitwiseOr, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, BitwiseExclusiveOr, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, ShiftLeftElementWise, CInt32x8, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x8, ShiftLeft, CInt32x8, Shift, FUZZ_EXACT)
+FUZZ(Binary, CInt32x8, ShiftRightElementWise, CInt32x8, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x8, ShiftRight, CInt32x8, Shift, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, PopulationCount, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, LeadingZeroBitCount, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, TrailingZeroBitCount, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, ByteSwap, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, BitReverse, CInt32x8, Integer, FUZZ_EXACT)
+
+#pragma mark Int32x16
+
+FUZZ(MakeLoad, CInt32x16, MakeLoad, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(MakeRepeating, CInt32x16, MakeRepeatingElement, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Nullary, CInt32x16, MakeZero, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Get, CInt32x16, GetElement, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Set, CInt32x16, SetElement, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, Minimum, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, Maximum, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, CompareElementWise, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Predicate, CInt32x16, Equal, Bool, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x16, CompareEqual, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x16, CompareLessThan, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Compare, CInt32x16, CompareLessThanOrEqual, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Select, CInt32x16, Select, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x16, MaskAny, Bool, Integer, FUZZ_EXACT)
+FUZZ(MaskReduce, CInt32x16, MaskAll, Bool, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, Negate, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, Magnitude, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, Add, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, Subtract, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, Multiply, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, BitwiseNot, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, BitwiseAnd, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, BitwiseAndNot, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, BitwiseOr, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, BitwiseExclusiveOr, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, ShiftLeftElementWise, CInt32x16, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x16, ShiftLeft, CInt32x16, Shift, FUZZ_EXACT)
+FUZZ(Binary, CInt32x16, ShiftRightElementWise, CInt32x16, Shift, FUZZ_EXACT)
+FUZZ(BinaryScalar, CInt32x16, ShiftRight, CInt32x16, Shift, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, PopulationCount, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, LeadingZeroBitCount, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, TrailingZeroBitCount, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, ByteSwap, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, BitReverse, CInt32x16, Integer, FUZZ_EXACT)
+
+#pragma mark Reinterpret
+
+FUZZ(Unary, CFloat32x2, ReinterpretAsCInt32x2, CInt32x2, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x2, ReinterpretAsCUInt32x2, CUInt32x2, Float32, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, ReinterpretAsCFloat32x2, CFloat32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x2, ReinterpretAsCUInt32x2, CUInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, ReinterpretAsCFloat32x2, CFloat32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x2, ReinterpretAsCInt32x2, CInt32x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x3, ReinterpretAsCInt32x3, CInt32x3, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x3, ReinterpretAsCUInt32x3, CUInt32x3, Float32, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, ReinterpretAsCFloat32x3, CFloat32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x3, ReinterpretAsCUInt32x3, CUInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, ReinterpretAsCFloat32x3, CFloat32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x3, ReinterpretAsCInt32x3, CInt32x3, Integer, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x4, ReinterpretAsCInt32x4, CInt32x4, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x4, ReinterpretAsCUInt32x4, CUInt32x4, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x4, ReinterpretAsCFloat64x2, CFloat64x2, Float32, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, ReinterpretAsCFloat32x4, CFloat32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, ReinterpretAsCUInt32x4, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x4, ReinterpretAsCFloat64x2, CFloat64x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, ReinterpretAsCFloat32x4, CFloat32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, ReinterpretAsCInt32x4, CInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x4, ReinterpretAsCFloat64x2, CFloat64x2, Integer, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x2, ReinterpretAsCFloat32x4, CFloat32x4, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x2, ReinterpretAsCInt32x4, CInt32x4, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x2, ReinterpretAsCUInt32x4, CUInt32x4, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x8, ReinterpretAsCInt32x8, CInt32x8, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x8, ReinterpretAsCUInt32x8, CUInt32x8, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x8, ReinterpretAsCFloat64x4, CFloat64x4, Float32, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, ReinterpretAsCFloat32x8, CFloat32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, ReinterpretAsCUInt32x8, CUInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x8, ReinterpretAsCFloat64x4, CFloat64x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, ReinterpretAsCFloat32x8, CFloat32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, ReinterpretAsCInt32x8, CInt32x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x8, ReinterpretAsCFloat64x4, CFloat64x4, Integer, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x4, ReinterpretAsCFloat32x8, CFloat32x8, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x4, ReinterpretAsCInt32x8, CInt32x8, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x4, ReinterpretAsCUInt32x8, CUInt32x8, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x16, ReinterpretAsCInt32x16, CInt32x16, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x16, ReinterpretAsCUInt32x16, CUInt32x16, Float32, FUZZ_EXACT)
+FUZZ(Unary, CFloat32x16, ReinterpretAsCFloat64x8, CFloat64x8, Float32, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, ReinterpretAsCFloat32x16, CFloat32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, ReinterpretAsCUInt32x16, CUInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CInt32x16, ReinterpretAsCFloat64x8, CFloat64x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, ReinterpretAsCFloat32x16, CFloat32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, ReinterpretAsCInt32x16, CInt32x16, Integer, FUZZ_EXACT)
+FUZZ(Unary, CUInt32x16, ReinterpretAsCFloat64x8, CFloat64x8, Integer, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x8, ReinterpretAsCFloat32x16, CFloat32x16, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x8, ReinterpretAsCInt32x16, CInt32x16, Float64, FUZZ_EXACT)
+FUZZ(Unary, CFloat64x8, ReinterpretAsCUInt32x16, CUInt32x16, Float64, FUZZ_EXACT)
+
+#pragma mark QuaternionF32
+
+FUZZ(Make, CQuaternionF32, Make, CQuaternionF32, Float32, FUZZ_EXACT)
+FUZZ(Nullary, CQuaternionF32, MakeIdentity, CQuaternionF32, Float32, FUZZ_EXACT)
+FUZZ(BinaryReduce, CQuaternionF32, Dot, CQuaternionF32, Float32Finite, FUZZ_ULPS(4, 2))
+FUZZ(Binary, CQuaternionF32, Multiply, CQuaternionF32, Float32Finite, FUZZ_ULPS(4, 2))
+FUZZ(Unary, CQuaternionF32, Conjugate, CQuaternionF32, Float32, FUZZ_EXACT)
+FUZZ(Unary, CQuaternionF32, Normalize, CQuaternionF32, Float32Finite, FUZZ_ULPS(4, 0))
+FUZZ(Custom, CQuaternionF32, RotateVector, CFloat32x3, Quaternion, FUZZ_ULPS(8, 0))
+FUZZ(Custom, CQuaternionF32, NLerp, CQuaternionF32, Quaternion, FUZZ_ULPS(8, 0))
+FUZZ(Custom, CQuaternionF32, Slerp, CQuaternionF32, Quaternion, FUZZ_ULPS(64, 0))
+FUZZ(Custom, CQuaternionF32, NLerpBatch, CQuaternionF32, Quaternion, FUZZ_ULPS(8, 0))
+FUZZ(Custom, CQuaternionF32, SlerpBatch, CQuaternionF32, Quaternion, FUZZ_ULPS(64, 0))
+
+#pragma mark Xoshiro128x4
+
+FUZZ(Custom, CXoshiro128x4, SplitMix64, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Custom, CXoshiro128x4, Make, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Custom, CXoshiro128x4, Jump, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Custom, CXoshiro128x4, NextUInt32x4, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Custom, CXoshiro128x4, NextFloat32x4, CFloat32x4, Integer, FUZZ_EXACT)
+FUZZ(Custom, CXoshiro128x4, NextNormalFloat32x4, CFloat32x4, Integer, FUZZ_ULPS(64, 0))
+FUZZ(Custom, CXoshiro128x4, FillUInt32, CUInt32x4, Integer, FUZZ_EXACT)
+FUZZ(Custom, CXoshiro128x4, FillFloat32, CFloat32x4, Integer, FUZZ_EXACT)
+FUZZ(Custom, CXoshiro128x4, FillNormalFloat32, CFloat32x4, Integer, FUZZ_ULPS(64, 0))
+
+#pragma mark Bulk Kernels
+
+FUZZ(Dispatched, CSIMDXBuffer, AddFloat32, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Dispatched, CSIMDXBuffer, MultiplyFloat32, CFloat32x4, Float32, FUZZ_EXACT)
+FUZZ(Dispatched, CSIMDXBuffer, MultiplyAddFloat32, CFloat32x4, Float32, FUZZ_EITHER)
+FUZZ(Dispatched, CSIMDXBuffer, SumFloat32, CFloat32x4, Float32Finite, FUZZ_ULPS(256, 1))
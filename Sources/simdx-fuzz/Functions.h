@@ -0,0 +1,794 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Wraps every function of `FunctionList.h` to take and return raw lanes, and
+// defines the table `FUZZ_TABLE` of them. Included once by `Reference.c` and
+// once by `Backend.c`, after `CSIMDX.h`, so that both tables share the order
+// and the metadata but not the instruction set.
+
+#pragma once
+
+#include "Fuzz.h"
+
+#ifndef FUZZ_TABLE
+  #error "Define FUZZ_TABLE to the name of the table before including Functions.h"
+#endif
+
+#define FUZZ_CAT_(lhs, rhs) lhs##rhs
+#define FUZZ_CAT(lhs, rhs) FUZZ_CAT_(lhs, rhs)
+
+#pragma mark - Storages
+
+// The element count, the `FuzzLanes` member and the element type of each storage,
+// and the storage whose accessors apply, which differs for the quaternion only.
+
+#define FUZZ_COUNT_CFloat32x2 2
+#define FUZZ_COUNT_CFloat32x3 3
+#define FUZZ_COUNT_CFloat32x4 4
+#define FUZZ_COUNT_CFloat32x8 8
+#define FUZZ_COUNT_CFloat32x16 16
+#define FUZZ_COUNT_CFloat64x2 2
+#define FUZZ_COUNT_CFloat64x3 3
+#define FUZZ_COUNT_CFloat64x4 4
+#define FUZZ_COUNT_CFloat64x8 8
+#define FUZZ_COUNT_CUInt32x2 2
+#define FUZZ_COUNT_CUInt32x3 3
+#define FUZZ_COUNT_CUInt32x4 4
+#define FUZZ_COUNT_CUInt32x8 8
+#define FUZZ_COUNT_CUInt32x16 16
+#define FUZZ_COUNT_CInt32x2 2
+#define FUZZ_COUNT_CInt32x3 3
+#define FUZZ_COUNT_CInt32x4 4
+#define FUZZ_COUNT_CInt32x8 8
+#define FUZZ_COUNT_CInt32x16 16
+#define FUZZ_COUNT_CQuaternionF32 4
+
+#define FUZZ_FIELD_CFloat32x2 f32
+#define FUZZ_FIELD_CFloat32x3 f32
+#define FUZZ_FIELD_CFloat32x4 f32
+#define FUZZ_FIELD_CFloat32x8 f32
+#define FUZZ_FIELD_CFloat32x16 f32
+#define FUZZ_FIELD_CFloat64x2 f64
+#define FUZZ_FIELD_CFloat64x3 f64
+#define FUZZ_FIELD_CFloat64x4 f64
+#define FUZZ_FIELD_CFloat64x8 f64
+#define FUZZ_FIELD_CUInt32x2 u32
+#define FUZZ_FIELD_CUInt32x3 u32
+#define FUZZ_FIELD_CUInt32x4 u32
+#define FUZZ_FIELD_CUInt32x8 u32
+#define FUZZ_FIELD_CUInt32x16 u32
+#define FUZZ_FIELD_CInt32x2 i32
+#define FUZZ_FIELD_CInt32x3 i32
+#define FUZZ_FIELD_CInt32x4 i32
+#define FUZZ_FIELD_CInt32x8 i32
+#define FUZZ_FIELD_CInt32x16 i32
+#define FUZZ_FIELD_CQuaternionF32 f32
+
+#define FUZZ_ELEMENT_CFloat32x2 FuzzElementFloat32
+#define FUZZ_ELEMENT_CFloat32x3 FuzzElementFloat32
+#define FUZZ_ELEMENT_CFloat32x4 FuzzElementFloat32
+#define FUZZ_ELEMENT_CFloat32x8 FuzzElementFloat32
+#define FUZZ_ELEMENT_CFloat32x16 FuzzElementFloat32
+#define FUZZ_ELEMENT_CFloat64x2 FuzzElementFloat64
+#define FUZZ_ELEMENT_CFloat64x3 FuzzElementFloat64
+#define FUZZ_ELEMENT_CFloat64x4 FuzzElementFloat64
+#define FUZZ_ELEMENT_CFloat64x8 FuzzElementFloat64
+#define FUZZ_ELEMENT_CUInt32x2 FuzzElementInteger
+#define FUZZ_ELEMENT_CUInt32x3 FuzzElementInteger
+#define FUZZ_ELEMENT_CUInt32x4 FuzzElementInteger
+#define FUZZ_ELEMENT_CUInt32x8 FuzzElementInteger
+#define FUZZ_ELEMENT_CUInt32x16 FuzzElementInteger
+#define FUZZ_ELEMENT_CInt32x2 FuzzElementInteger
+#define FUZZ_ELEMENT_CInt32x3 FuzzElementInteger
+#define FUZZ_ELEMENT_CInt32x4 FuzzElementInteger
+#define FUZZ_ELEMENT_CInt32x8 FuzzElementInteger
+#define FUZZ_ELEMENT_CInt32x16 FuzzElementInteger
+#define FUZZ_ELEMENT_CQuaternionF32 FuzzElementFloat32
+#define FUZZ_ELEMENT_CXoshiro128x4 FuzzElementInteger
+#define FUZZ_ELEMENT_CSIMDXBuffer FuzzElementFloat32
+#define FUZZ_ELEMENT_Bool FuzzElementInteger
+
+#define FUZZ_STORAGE_CFloat32x2 CFloat32x2
+#define FUZZ_STORAGE_CFloat32x3 CFloat32x3
+#define FUZZ_STORAGE_CFloat32x4 CFloat32x4
+#define FUZZ_STORAGE_CFloat32x8 CFloat32x8
+#define FUZZ_STORAGE_CFloat32x16 CFloat32x16
+#define FUZZ_STORAGE_CFloat64x2 CFloat64x2
+#define FUZZ_STORAGE_CFloat64x3 CFloat64x3
+#define FUZZ_STORAGE_CFloat64x4 CFloat64x4
+#define FUZZ_STORAGE_CFloat64x8 CFloat64x8
+#define FUZZ_STORAGE_CUInt32x2 CUInt32x2
+#define FUZZ_STORAGE_CUInt32x3 CUInt32x3
+#define FUZZ_STORAGE_CUInt32x4 CUInt32x4
+#define FUZZ_STORAGE_CUInt32x8 CUInt32x8
+#define FUZZ_STORAGE_CUInt32x16 CUInt32x16
+#define FUZZ_STORAGE_CInt32x2 CInt32x2
+#define FUZZ_STORAGE_CInt32x3 CInt32x3
+#define FUZZ_STORAGE_CInt32x4 CInt32x4
+#define FUZZ_STORAGE_CInt32x8 CInt32x8
+#define FUZZ_STORAGE_CInt32x16 CInt32x16
+#define FUZZ_STORAGE_CQuaternionF32 CFloat32x4
+
+#define FUZZ_MAKE_2(Type, elements) Type##Make((elements)[0], (elements)[1])
+#define FUZZ_MAKE_3(Type, elements) Type##Make((elements)[0], (elements)[1], (elements)[2])
+#define FUZZ_MAKE_4(Type, elements) Type##Make((elements)[0], (elements)[1], (elements)[2], (elements)[3])
+#define FUZZ_MAKE_8(Type, elements)                                                    \
+  Type##Make((elements)[0], (elements)[1], (elements)[2], (elements)[3],               \
+             (elements)[4], (elements)[5], (elements)[6], (elements)[7])
+// There is no `Make` of 16 elements, these are loaded instead, which only reads.
+#define FUZZ_MAKE_16(Type, elements) Type##MakeLoad((__typeof__((elements)[0])*)(elements))
+
+/// Makes a `Type` of the leading elements of `lanes`.
+#define FUZZ_MAKE(Type, lanes) \
+  FUZZ_CAT(FUZZ_MAKE_, FUZZ_COUNT_##Type)(Type, (lanes).FUZZ_FIELD_##Type)
+
+/// Stores each element of `value` into `lanes`, and returns their count.
+#define FUZZ_RETURN(Type, value, lanes)                                                \
+  for (int lane = 0; lane < FUZZ_COUNT_##Type; lane++) {                               \
+    (lanes).FUZZ_FIELD_##Type[lane] = FUZZ_CAT(FUZZ_STORAGE_##Type, GetElement)(value, lane); \
+  }                                                                                    \
+  return FUZZ_COUNT_##Type
+
+/// Hides the value of `lane` from the compiler, to take the path of lanes that
+/// are not known at compile time.
+#define FUZZ_OPAQUE_LANE(lane) __asm__ volatile("" : "+r"(lane))
+
+// Expands `call(Type, Operation, lane)` with `lane` as a constant, to take the
+// path of lanes known at compile time, which is how most subscripts end up.
+#define FUZZ_CONSTANT_LANE_2(Type, Operation, lane, call)                              \
+  switch (lane) {                                                                      \
+    case 0: call(Type, Operation, 0); break;                                           \
+    default: call(Type, Operation, 1); break;                                          \
+  }
+#define FUZZ_CONSTANT_LANE_3(Type, Operation, lane, call)                              \
+  switch (lane) {                                                                      \
+    case 0: call(Type, Operation, 0); break;                                           \
+    case 1: call(Type, Operation, 1); break;                                           \
+    default: call(Type, Operation, 2); break;                                          \
+  }
+#define FUZZ_CONSTANT_LANE_4(Type, Operation, lane, call)                              \
+  switch (lane) {                                                                      \
+    case 0: call(Type, Operation, 0); break;                                           \
+    case 1: call(Type, Operation, 1); break;                                           \
+    case 2: call(Type, Operation, 2); break;                                           \
+    default: call(Type, Operation, 3); break;                                          \
+  }
+#define FUZZ_CONSTANT_LANE_8(Type, Operation, lane, call)                              \
+  switch (lane) {                                                                      \
+    case 0: call(Type, Operation, 0); break;                                           \
+    case 1: call(Type, Operation, 1); break;                                           \
+    case 2: call(Type, Operation, 2); break;                                           \
+    case 3: call(Type, Operation, 3); break;                                           \
+    case 4: call(Type, Operation, 4); break;                                           \
+    case 5: call(Type, Operation, 5); break;                                           \
+    case 6: call(Type, Operation, 6); break;                                           \
+    default: call(Type, Operation, 7); break;                                          \
+  }
+#define FUZZ_CONSTANT_LANE_16(Type, Operation, lane, call)                             \
+  switch (lane) {                                                                      \
+    case 0: call(Type, Operation, 0); break;                                           \
+    case 1: call(Type, Operation, 1); break;                                           \
+    case 2: call(Type, Operation, 2); break;                                           \
+    case 3: call(Type, Operation, 3); break;                                           \
+    case 4: call(Type, Operation, 4); break;                                           \
+    case 5: call(Type, Operation, 5); break;                                           \
+    case 6: call(Type, Operation, 6); break;                                           \
+    case 7: call(Type, Operation, 7); break;                                           \
+    case 8: call(Type, Operation, 8); break;                                           \
+    case 9: call(Type, Operation, 9); break;                                           \
+    case 10: call(Type, Operation, 10); break;                                         \
+    case 11: call(Type, Operation, 11); break;                                         \
+    case 12: call(Type, Operation, 12); break;                                         \
+    case 13: call(Type, Operation, 13); break;                                         \
+    case 14: call(Type, Operation, 14); break;                                         \
+    default: call(Type, Operation, 15); break;                                         \
+  }
+
+/// Expands `call(Type, Operation, lane)` with the lane of `selector`, as a
+/// constant or hidden from the compiler, depending on another bit of `selector`.
+#define FUZZ_LANE(Type, Operation, selector, call)                                     \
+  do {                                                                                 \
+    int lane = (int)((selector) % FUZZ_COUNT_##Type);                                  \
+    if ((selector) & 0x100) {                                                          \
+      FUZZ_OPAQUE_LANE(lane);                                                          \
+      call(Type, Operation, lane);                                                     \
+    } else {                                                                           \
+      FUZZ_CAT(FUZZ_CONSTANT_LANE_, FUZZ_COUNT_##Type)(Type, Operation, lane, call)    \
+    }                                                                                  \
+  } while (0)
+
+#pragma mark - Shapes
+
+// Each shape defines the wrapper `<Type><Operation>Fuzz` of a function of that
+// signature, which returns a `Result` storage.
+
+/// `Make(operands[0]...)`
+#define FUZZ_DEFINE_Make(Type, Operation, Result)                                      \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Type value = FUZZ_MAKE(Type, input->operands[0]);                                  \
+    FUZZ_RETURN(Type, value, output->values);                                          \
+  }
+
+/// `MakeLoad(&operands[0])`
+#define FUZZ_DEFINE_MakeLoad(Type, Operation, Result)                                  \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    FuzzLanes lanes = input->operands[0];                                              \
+    Type value = Type##MakeLoad(lanes.FUZZ_FIELD_##Type);                              \
+    FUZZ_RETURN(Type, value, output->values);                                          \
+  }
+
+/// `MakeRepeatingElement(operands[0][0])`
+#define FUZZ_DEFINE_MakeRepeating(Type, Operation, Result)                             \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Type value = Type##MakeRepeatingElement(input->operands[0].FUZZ_FIELD_##Type[0]);  \
+    FUZZ_RETURN(Type, value, output->values);                                          \
+  }
+
+/// `Operation()`, e.g. `MakeZero()`
+#define FUZZ_DEFINE_Nullary(Type, Operation, Result)                                   \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    (void)input;                                                                       \
+    Type value = Type##Operation();                                                    \
+    FUZZ_RETURN(Type, value, output->values);                                          \
+  }
+
+/// `operation(operands[0], lane)`, e.g. `GetElement`
+#define FUZZ_DEFINE_Get(Type, Operation, Result)                                       \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Type storage = FUZZ_MAKE(Type, input->operands[0]);                                \
+    FUZZ_LANE(Type, Operation, input->selector, FUZZ_CALL_Get);                        \
+    return 1;                                                                          \
+  }
+#define FUZZ_CALL_Get(Type, Operation, lane) \
+  output->values.FUZZ_FIELD_##Type[0] = Type##Operation(storage, lane)
+
+/// `operation(&operands[0], lane, operands[1][0])`, e.g. `SetElement`
+#define FUZZ_DEFINE_Set(Type, Operation, Result)                                       \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Type storage = FUZZ_MAKE(Type, input->operands[0]);                                \
+    FUZZ_LANE(Type, Operation, input->selector, FUZZ_CALL_Set);                        \
+    FUZZ_RETURN(Type, storage, output->values);                                        \
+  }
+#define FUZZ_CALL_Set(Type, Operation, lane) \
+  Type##Operation(&storage, lane, input->operands[1].FUZZ_FIELD_##Type[0])
+
+/// `operation(operands[0], lane, operands[1][0])`, e.g. `InsertLane`
+#define FUZZ_DEFINE_Insert(Type, Operation, Result)                                    \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Type storage = FUZZ_MAKE(Type, input->operands[0]);                                \
+    FUZZ_LANE(Type, Operation, input->selector, FUZZ_CALL_Insert);                     \
+    FUZZ_RETURN(Type, storage, output->values);                                        \
+  }
+#define FUZZ_CALL_Insert(Type, Operation, lane) \
+  storage = Type##Operation(storage, lane, input->operands[1].FUZZ_FIELD_##Type[0])
+
+/// `operation(operands[0])`
+#define FUZZ_DEFINE_Unary(Type, Operation, Result)                                     \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Result value = Type##Operation(FUZZ_MAKE(Type, input->operands[0]));               \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+
+/// `operation(operands[0], operands[1])`
+#define FUZZ_DEFINE_Binary(Type, Operation, Result)                                    \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Result value = Type##Operation(FUZZ_MAKE(Type, input->operands[0]),                \
+                                   FUZZ_MAKE(Type, input->operands[1]));               \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+
+/// `operation(operands[0], operands[1][0])`, e.g. a shift by a scalar count
+#define FUZZ_DEFINE_BinaryScalar(Type, Operation, Result)                              \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Result value = Type##Operation(FUZZ_MAKE(Type, input->operands[0]),                \
+                                   input->operands[1].FUZZ_FIELD_##Type[0]);           \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+
+/// `operation(operands[0], operands[1][0], operands[2])`, a multiply-add by a
+/// scalar. Accepts the fused as well as the separately rounded result, which
+/// both are computed explicitly by the reference, regardless of contraction.
+#if FUZZ_REFERENCE
+#define FUZZ_DEFINE_FusedScalar(Type, Operation, Result)                               \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    const FuzzLanes* lhs = &input->operands[0];                                        \
+    const FuzzLanes* addend = &input->operands[2];                                     \
+    __typeof__(lhs->FUZZ_FIELD_##Type[0]) rhs = input->operands[1].FUZZ_FIELD_##Type[0]; \
+    for (int lane = 0; lane < FUZZ_COUNT_##Type; lane++) {                             \
+      volatile __typeof__(rhs) product = lhs->FUZZ_FIELD_##Type[lane] * rhs;           \
+      output->values.FUZZ_FIELD_##Type[lane] = product + addend->FUZZ_FIELD_##Type[lane]; \
+      output->alternative.FUZZ_FIELD_##Type[lane] = FUZZ_CAT(FUZZ_FMA_, FUZZ_FIELD_##Type)( \
+        lhs->FUZZ_FIELD_##Type[lane], rhs, addend->FUZZ_FIELD_##Type[lane]);           \
+    }                                                                                  \
+    output->hasAlternative = 1;                                                        \
+    return FUZZ_COUNT_##Type;                                                          \
+  }
+#else
+#define FUZZ_DEFINE_FusedScalar(Type, Operation, Result)                               \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Result value = Type##Operation(FUZZ_MAKE(Type, input->operands[0]),                \
+                                   input->operands[1].FUZZ_FIELD_##Type[0],            \
+                                   FUZZ_MAKE(Type, input->operands[2]));               \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+#endif
+#define FUZZ_FMA_f32 __builtin_fmaf
+#define FUZZ_FMA_f64 __builtin_fma
+
+/// `operation(operands[0], operands[1], operands[2])`, a lane-wise multiply-add,
+/// that accepts either result just like `FusedScalar`.
+#if FUZZ_REFERENCE
+#define FUZZ_DEFINE_Fused(Type, Operation, Result)                                     \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    const FuzzLanes* lhs = &input->operands[0];                                        \
+    const FuzzLanes* rhs = &input->operands[1];                                        \
+    const FuzzLanes* addend = &input->operands[2];                                     \
+    for (int lane = 0; lane < FUZZ_COUNT_##Type; lane++) {                             \
+      volatile __typeof__(lhs->FUZZ_FIELD_##Type[0]) product =                         \
+        lhs->FUZZ_FIELD_##Type[lane] * rhs->FUZZ_FIELD_##Type[lane];                   \
+      output->values.FUZZ_FIELD_##Type[lane] = product + addend->FUZZ_FIELD_##Type[lane]; \
+      output->alternative.FUZZ_FIELD_##Type[lane] = FUZZ_CAT(FUZZ_FMA_, FUZZ_FIELD_##Type)( \
+        lhs->FUZZ_FIELD_##Type[lane], rhs->FUZZ_FIELD_##Type[lane], addend->FUZZ_FIELD_##Type[lane]); \
+    }                                                                                  \
+    output->hasAlternative = 1;                                                        \
+    return FUZZ_COUNT_##Type;                                                          \
+  }
+#else
+#define FUZZ_DEFINE_Fused(Type, Operation, Result)                                     \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Result value = Type##Operation(FUZZ_MAKE(Type, input->operands[0]),                \
+                                   FUZZ_MAKE(Type, input->operands[1]),                \
+                                   FUZZ_MAKE(Type, input->operands[2]));               \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+#endif
+
+/// `operation(operands[0], operands[1])`, the minimum or maximum of the hardware.
+/// The reference returns the second operand if either is NaN or both are zero,
+/// like x86, whereas Arm returns NaN and orders -0.0 before +0.0, which is the
+/// result of `IEEE<Operation>`. Accepts either one.
+#if FUZZ_REFERENCE
+#define FUZZ_DEFINE_MinMax(Type, Operation, Result)                                    \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    Type lhs = FUZZ_MAKE(Type, input->operands[0]);                                    \
+    Type rhs = FUZZ_MAKE(Type, input->operands[1]);                                    \
+    Result alternative = Type##IEEE##Operation(lhs, rhs);                              \
+    for (int lane = 0; lane < FUZZ_COUNT_##Result; lane++) {                           \
+      output->alternative.FUZZ_FIELD_##Result[lane] =                                  \
+        FUZZ_CAT(FUZZ_STORAGE_##Result, GetElement)(alternative, lane);                \
+    }                                                                                  \
+    output->hasAlternative = 1;                                                        \
+    Result value = Type##Operation(lhs, rhs);                                          \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+#else
+#define FUZZ_DEFINE_MinMax(Type, Operation, Result) FUZZ_DEFINE_Binary(Type, Operation, Result)
+#endif
+
+/// `operation(operands[0])`, the minimum or maximum element of the hardware,
+/// that accepts the x86 as well as the Arm result just like `MinMax`.
+#if FUZZ_REFERENCE
+#define FUZZ_DEFINE_MinMaxReduce(Type, Operation, Result)                              \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    const FuzzLanes* lanes = &input->operands[0];                                      \
+    __typeof__(output->alternative.FUZZ_FIELD_##Result[0]) alternative = lanes->FUZZ_FIELD_##Type[0]; \
+    for (int lane = 1; lane < FUZZ_COUNT_##Type; lane++) {                             \
+      alternative = FUZZ_IEEE_##Operation(alternative, lanes->FUZZ_FIELD_##Type[lane]); \
+    }                                                                                  \
+    output->alternative.FUZZ_FIELD_##Result[0] = alternative;                          \
+    output->hasAlternative = 1;                                                        \
+    output->values.FUZZ_FIELD_##Result[0] = Type##Operation(FUZZ_MAKE(Type, *lanes));  \
+    return 1;                                                                          \
+  }
+#else
+#define FUZZ_DEFINE_MinMaxReduce(Type, Operation, Result) FUZZ_DEFINE_UnaryReduce(Type, Operation, Result)
+#endif
+#define FUZZ_IEEE_ReduceMinimum(lhs, rhs)                                              \
+  ((lhs) != (lhs) || (rhs) != (rhs) ? (lhs) + (rhs)                                    \
+   : (lhs) == (rhs) ? (__builtin_signbit(lhs) ? (lhs) : (rhs))                         \
+   : (lhs) < (rhs) ? (lhs) : (rhs))
+#define FUZZ_IEEE_ReduceMaximum(lhs, rhs)                                              \
+  ((lhs) != (lhs) || (rhs) != (rhs) ? (lhs) + (rhs)                                    \
+   : (lhs) == (rhs) ? (__builtin_signbit(lhs) ? (rhs) : (lhs))                         \
+   : (lhs) > (rhs) ? (lhs) : (rhs))
+
+/// `operation(operands[0])`, which returns an element of `Result`
+#define FUZZ_DEFINE_UnaryReduce(Type, Operation, Result)                               \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    output->values.FUZZ_FIELD_##Result[0] = Type##Operation(FUZZ_MAKE(Type, input->operands[0])); \
+    return 1;                                                                          \
+  }
+
+/// `operation(operands[0], operands[1])`, which returns an element of `Result`
+#define FUZZ_DEFINE_BinaryReduce(Type, Operation, Result)                              \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    output->values.FUZZ_FIELD_##Result[0] = Type##Operation(FUZZ_MAKE(Type, input->operands[0]), \
+                                                            FUZZ_MAKE(Type, input->operands[1])); \
+    return 1;                                                                          \
+  }
+
+/// `operation(operands[0], operands[1])`, which returns a `bool`. The lanes of
+/// the first operand selected by the low bits of `selector` are copied into the
+/// second, so that all lanes are equal in some of the calls.
+#define FUZZ_DEFINE_Predicate(Type, Operation, Result)                                 \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    FuzzLanes rhs = input->operands[1];                                                \
+    for (int lane = 0; lane < FUZZ_COUNT_##Type; lane++) {                             \
+      if (input->selector >> lane & 1) {                                               \
+        rhs.FUZZ_FIELD_##Type[lane] = input->operands[0].FUZZ_FIELD_##Type[lane];      \
+      }                                                                                \
+    }                                                                                  \
+    output->values.u32[0] = Type##Operation(FUZZ_MAKE(Type, input->operands[0]),       \
+                                            FUZZ_MAKE(Type, rhs));                     \
+    return 1;                                                                          \
+  }
+
+/// Copies the lanes of `operands[0]` selected by the low bits of `selector`
+/// into `operands[1]`, so that some lanes of both are equal.
+#define FUZZ_EQUAL_LANES(Type, input, rhs)                                             \
+  FuzzLanes rhs = (input)->operands[1];                                                \
+  for (int lane = 0; lane < FUZZ_COUNT_##Type; lane++) {                               \
+    if ((input)->selector >> lane & 1) {                                               \
+      rhs.FUZZ_FIELD_##Type[lane] = (input)->operands[0].FUZZ_FIELD_##Type[lane];      \
+    }                                                                                  \
+  }
+
+#define FUZZ_MASK_2(elements) FUZZ_MAKE_2(CInt32x2, elements)
+#define FUZZ_MASK_3(elements) FUZZ_MAKE_3(CInt32x3, elements)
+#define FUZZ_MASK_4(elements) FUZZ_MAKE_4(CInt32x4, elements)
+#define FUZZ_MASK_8(elements) FUZZ_MAKE_8(CInt32x8, elements)
+#define FUZZ_MASK_16(elements) FUZZ_MAKE_16(CInt32x16, elements)
+
+/// Makes a mask of as many lanes as `Type`, with all bits set in the lanes
+/// selected by the low bits of `selector`, and none in the others.
+#define FUZZ_MAKE_MASK(Type, input, mask)                                              \
+  FuzzLanes mask##Lanes;                                                               \
+  for (int lane = 0; lane < FUZZ_COUNT_##Type; lane++) {                               \
+    mask##Lanes.i32[lane] = -(int32_t)((input)->selector >> lane & 1);                 \
+  }                                                                                    \
+  const __typeof__(FUZZ_CAT(FUZZ_MASK_, FUZZ_COUNT_##Type)(mask##Lanes.i32)) mask =    \
+    FUZZ_CAT(FUZZ_MASK_, FUZZ_COUNT_##Type)(mask##Lanes.i32)
+
+/// `operation(operands[0], operands[1])`, which returns a mask `Result`. The
+/// lanes are made equal as for `Predicate`.
+#define FUZZ_DEFINE_Compare(Type, Operation, Result)                                   \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    FUZZ_EQUAL_LANES(Type, input, rhs);                                                \
+    Result value = Type##Operation(FUZZ_MAKE(Type, input->operands[0]), FUZZ_MAKE(Type, rhs)); \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+
+/// `operation(mask, operands[0], operands[1])`, where the lanes of `mask` are
+/// selected by the low bits of `selector`.
+#define FUZZ_DEFINE_Select(Type, Operation, Result)                                    \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    FUZZ_MAKE_MASK(Type, input, mask);                                                 \
+    Result value = Type##Operation(mask, FUZZ_MAKE(Type, input->operands[0]),          \
+                                   FUZZ_MAKE(Type, input->operands[1]));               \
+    FUZZ_RETURN(Result, value, output->values);                                        \
+  }
+
+/// `operation(mask)`, which returns a `bool`, with the lanes of `mask` selected
+/// by the low bits of `selector`.
+#define FUZZ_DEFINE_MaskReduce(Type, Operation, Result)                                \
+  static int Type##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output)         \
+  {                                                                                    \
+    FUZZ_MAKE_MASK(Type, input, mask);                                                 \
+    output->values.u32[0] = Type##Operation(mask);                                     \
+    return 1;                                                                          \
+  }
+
+/// Wrappers of any other signature are written out below.
+#define FUZZ_DEFINE_Custom(Type, Operation, Result)
+
+/// A bulk kernel, also written out below.
+#define FUZZ_DEFINE_Dispatched(Type, Operation, Result)
+
+#define FUZZ_DISPATCHED_Make 0
+#define FUZZ_DISPATCHED_MakeLoad 0
+#define FUZZ_DISPATCHED_MakeRepeating 0
+#define FUZZ_DISPATCHED_Nullary 0
+#define FUZZ_DISPATCHED_Get 0
+#define FUZZ_DISPATCHED_Set 0
+#define FUZZ_DISPATCHED_Insert 0
+#define FUZZ_DISPATCHED_Unary 0
+#define FUZZ_DISPATCHED_Binary 0
+#define FUZZ_DISPATCHED_BinaryScalar 0
+#define FUZZ_DISPATCHED_FusedScalar 0
+#define FUZZ_DISPATCHED_Fused 0
+#define FUZZ_DISPATCHED_MinMax 0
+#define FUZZ_DISPATCHED_MinMaxReduce 0
+#define FUZZ_DISPATCHED_UnaryReduce 0
+#define FUZZ_DISPATCHED_BinaryReduce 0
+#define FUZZ_DISPATCHED_Predicate 0
+#define FUZZ_DISPATCHED_Compare 0
+#define FUZZ_DISPATCHED_Select 0
+#define FUZZ_DISPATCHED_MaskReduce 0
+#define FUZZ_DISPATCHED_Custom 0
+#define FUZZ_DISPATCHED_Dispatched 1
+
+#pragma mark - Tolerances
+
+#define FUZZ_EXACT { FuzzCompareExact, 0, 0 }
+#define FUZZ_ULPS(ulps, degree) { FuzzCompareUlps, ulps, degree }
+#define FUZZ_EITHER { FuzzCompareEither, 0, 0 }
+
+#pragma mark - Wrappers
+
+static int CFloat32x2FromCFloat64x2Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CFloat32x2 value = CFloat32x2FromCFloat64x2(FUZZ_MAKE(CFloat64x2, input->operands[0]));
+  FUZZ_RETURN(CFloat32x2, value, output->values);
+}
+
+static int CFloat64x2FromCFloat32x2Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CFloat64x2 value = CFloat64x2FromCFloat32x2(FUZZ_MAKE(CFloat32x2, input->operands[0]));
+  FUZZ_RETURN(CFloat64x2, value, output->values);
+}
+
+/// Accepts the fused as well as the separately rounded result, which both are
+/// computed explicitly by the reference, regardless of contraction.
+static int CFloat32x4MultiplyAddFuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  const float* lhs = input->operands[0].f32;
+  const float* rhs = input->operands[1].f32;
+  const float* addend = input->operands[2].f32;
+#if FUZZ_REFERENCE
+  for (int lane = 0; lane < 4; lane++) {
+    volatile float product = lhs[lane] * rhs[lane];
+    output->values.f32[lane] = product + addend[lane];
+    output->alternative.f32[lane] = __builtin_fmaf(lhs[lane], rhs[lane], addend[lane]);
+  }
+  output->hasAlternative = 1;
+  return 4;
+#else
+  CFloat32x4 value = CFloat32x4MultiplyAdd(FUZZ_MAKE(CFloat32x4, input->operands[0]),
+                                           FUZZ_MAKE(CFloat32x4, input->operands[1]),
+                                           FUZZ_MAKE(CFloat32x4, input->operands[2]));
+  (void)lhs; (void)rhs; (void)addend;
+  FUZZ_RETURN(CFloat32x4, value, output->values);
+#endif
+}
+
+static int CQuaternionF32RotateVectorFuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CFloat32x3 value = CQuaternionF32RotateVector(FUZZ_MAKE(CQuaternionF32, input->operands[0]),
+                                                FUZZ_MAKE(CFloat32x3, input->operands[1]));
+  FUZZ_RETURN(CFloat32x3, value, output->values);
+}
+
+static int CQuaternionF32NLerpFuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CQuaternionF32 value = CQuaternionF32NLerp(FUZZ_MAKE(CQuaternionF32, input->operands[0]),
+                                             FUZZ_MAKE(CQuaternionF32, input->operands[1]),
+                                             input->operands[2].f32[0]);
+  FUZZ_RETURN(CQuaternionF32, value, output->values);
+}
+
+static int CQuaternionF32SlerpFuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CQuaternionF32 value = CQuaternionF32Slerp(FUZZ_MAKE(CQuaternionF32, input->operands[0]),
+                                             FUZZ_MAKE(CQuaternionF32, input->operands[1]),
+                                             input->operands[2].f32[0]);
+  FUZZ_RETURN(CQuaternionF32, value, output->values);
+}
+
+/// The quaternions of a batch, of which the first 4 are interpolated lane-parallel
+/// and the last one takes the remainder path.
+#define FUZZ_BATCH 5
+
+#define FUZZ_DEFINE_BATCH(Operation)                                                   \
+  static int CQuaternionF32##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output) \
+  {                                                                                    \
+    CQuaternionF32 from[FUZZ_BATCH], to[FUZZ_BATCH], result[FUZZ_BATCH];               \
+    for (int index = 0; index < FUZZ_BATCH; index++) {                                 \
+      from[index] = FUZZ_MAKE_4(CQuaternionF32, &input->operands[0].f32[4 * index]);   \
+      to[index] = FUZZ_MAKE_4(CQuaternionF32, &input->operands[1].f32[4 * index]);     \
+    }                                                                                  \
+    CQuaternionF32##Operation(from, to, input->operands[2].f32, result, FUZZ_BATCH);   \
+    for (int index = 0; index < FUZZ_BATCH; index++) {                                 \
+      for (int lane = 0; lane < 4; lane++) {                                           \
+        output->values.f32[4 * index + lane] = CFloat32x4GetElement(result[index], lane); \
+      }                                                                                \
+    }                                                                                  \
+    return 4 * FUZZ_BATCH;                                                             \
+  }
+
+FUZZ_DEFINE_BATCH(NLerpBatch)
+FUZZ_DEFINE_BATCH(SlerpBatch)
+
+static int CXoshiro128x4SplitMix64Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  uint64_t state = input->operands[0].u64[0];
+  output->values.u64[0] = CXoshiro128x4SplitMix64(&state);
+  output->values.u64[1] = state;
+  return 4;
+}
+
+/// Seeds the generators with the first two 64-bit elements of `operands[0]`.
+static CXoshiro128x4 FuzzXoshiro(const FuzzInput* input)
+{
+  return CXoshiro128x4Make(input->operands[0].u64[0], input->operands[0].u64[1]);
+}
+
+static int FuzzXoshiroState(const CXoshiro128x4* state, FuzzOutput* output)
+{
+  const CUInt32x4 words[4] = { state->s0, state->s1, state->s2, state->s3 };
+  for (int index = 0; index < 4; index++) {
+    for (int lane = 0; lane < 4; lane++) {
+      output->values.u32[4 * index + lane] = CUInt32x4GetElement(words[index], lane);
+    }
+  }
+  return 16;
+}
+
+static int CXoshiro128x4MakeFuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CXoshiro128x4 state = FuzzXoshiro(input);
+  return FuzzXoshiroState(&state, output);
+}
+
+static int CXoshiro128x4JumpFuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CXoshiro128x4 state = FuzzXoshiro(input);
+  CXoshiro128x4Jump(&state);
+  return FuzzXoshiroState(&state, output);
+}
+
+static int CXoshiro128x4NextUInt32x4Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CXoshiro128x4 state = FuzzXoshiro(input);
+  CUInt32x4 value = CXoshiro128x4NextUInt32x4(&state);
+  value = CUInt32x4BitwiseExclusiveOr(value, CXoshiro128x4NextUInt32x4(&state));
+  FUZZ_RETURN(CUInt32x4, value, output->values);
+}
+
+static int CXoshiro128x4NextFloat32x4Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CXoshiro128x4 state = FuzzXoshiro(input);
+  CFloat32x4 value = CXoshiro128x4NextFloat32x4(&state);
+  FUZZ_RETURN(CFloat32x4, value, output->values);
+}
+
+static int CXoshiro128x4NextNormalFloat32x4Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  CXoshiro128x4 state = FuzzXoshiro(input);
+  CFloat32x4 second;
+  CFloat32x4 value = CXoshiro128x4NextNormalFloat32x4(&state, &second);
+  for (int lane = 0; lane < 4; lane++) {
+    output->values.f32[lane] = CFloat32x4GetElement(value, lane);
+    output->values.f32[4 + lane] = CFloat32x4GetElement(second, lane);
+  }
+  return 8;
+}
+
+/// Fills as many elements as `selector` says, to cover the remainder paths.
+#define FUZZ_DEFINE_FILL(Operation, field)                                             \
+  static int CXoshiro128x4##Operation##Fuzz(const FuzzInput* input, FuzzOutput* output) \
+  {                                                                                    \
+    CXoshiro128x4 state = FuzzXoshiro(input);                                          \
+    long count = 1 + (long)(input->selector % FUZZ_LANES);                             \
+    CXoshiro128x4##Operation(&state, output->values.field, count);                     \
+    return (int)count;                                                                 \
+  }
+
+FUZZ_DEFINE_FILL(FillUInt32, u32)
+FUZZ_DEFINE_FILL(FillFloat32, f32)
+FUZZ_DEFINE_FILL(FillNormalFloat32, f32)
+
+#pragma mark Bulk Kernels
+
+// The reference of a bulk kernel is a plain loop. Products and sums go through
+// `volatile` so that the compiler neither contracts nor reassociates them.
+
+#define FUZZ_BUFFER_COUNT(input) (1 + (long)((input)->selector % FUZZ_LANES))
+
+static int CSIMDXBufferAddFloat32Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  long count = FUZZ_BUFFER_COUNT(input);
+#if FUZZ_REFERENCE
+  for (long index = 0; index < count; index++) {
+    output->values.f32[index] = input->operands[0].f32[index] + input->operands[1].f32[index];
+  }
+#else
+  CSIMDXBufferAddFloat32(input->operands[0].f32, input->operands[1].f32, output->values.f32, count);
+#endif
+  return (int)count;
+}
+
+static int CSIMDXBufferMultiplyFloat32Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  long count = FUZZ_BUFFER_COUNT(input);
+#if FUZZ_REFERENCE
+  for (long index = 0; index < count; index++) {
+    output->values.f32[index] = input->operands[0].f32[index] * input->operands[1].f32[index];
+  }
+#else
+  CSIMDXBufferMultiplyFloat32(input->operands[0].f32, input->operands[1].f32, output->values.f32, count);
+#endif
+  return (int)count;
+}
+
+static int CSIMDXBufferMultiplyAddFloat32Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  long count = FUZZ_BUFFER_COUNT(input);
+  const float* lhs = input->operands[0].f32;
+  const float* rhs = input->operands[1].f32;
+  const float* addend = input->operands[2].f32;
+#if FUZZ_REFERENCE
+  for (long index = 0; index < count; index++) {
+    volatile float product = lhs[index] * rhs[index];
+    output->values.f32[index] = product + addend[index];
+    output->alternative.f32[index] = __builtin_fmaf(lhs[index], rhs[index], addend[index]);
+  }
+  output->hasAlternative = 1;
+#else
+  CSIMDXBufferMultiplyAddFloat32(lhs, rhs, addend, output->values.f32, count);
+#endif
+  return (int)count;
+}
+
+static int CSIMDXBufferSumFloat32Fuzz(const FuzzInput* input, FuzzOutput* output)
+{
+  long count = FUZZ_BUFFER_COUNT(input);
+#if FUZZ_REFERENCE
+  volatile float sum = 0.f;
+  for (long index = 0; index < count; index++) {
+    sum += input->operands[0].f32[index];
+  }
+  output->values.f32[0] = sum;
+#else
+  output->values.f32[0] = CSIMDXBufferSumFloat32(input->operands[0].f32, count);
+#endif
+  return 1;
+}
+
+#pragma mark - Table
+
+#define FUZZ(Shape, Type, Operation, Result, Domain, Tolerance) \
+  FUZZ_DEFINE_##Shape(Type, Operation, Result)
+#include "FunctionList.h"
+#undef FUZZ
+
+/// Names the function after the storage type without its leading `C`.
+#define FUZZ(Shape, Type, Operation, Result, Domain, Tolerance) \
+  { #Type + 1, #Operation, FUZZ_ELEMENT_##Result, FuzzDomain##Domain, Tolerance, \
+    FUZZ_DISPATCHED_##Shape, Type##Operation##Fuzz },
+
+const FuzzFunction FUZZ_TABLE[] = {
+#include "FunctionList.h"
+};
+#undef FUZZ
@@ -0,0 +1,127 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#pragma mark - Type def
+
+/// The most elements an operand or a result of a function holds, e.g. five
+/// quaternions of a batch or the buffer of a bulk kernel.
+#define FUZZ_LANES 20
+
+/// The raw elements of an operand or a result, of any element type.
+typedef union FuzzLanes_t {
+  float f32[FUZZ_LANES];
+  double f64[FUZZ_LANES / 2];
+  uint32_t u32[FUZZ_LANES];
+  int32_t i32[FUZZ_LANES];
+  uint64_t u64[FUZZ_LANES / 2];
+} FuzzLanes;
+
+/// The arguments of a call, in the order of the parameters of the function.
+typedef struct FuzzInput_t {
+  FuzzLanes operands[3];
+  /// An arbitrary non-negative number, reduced to the lane index, the element
+  /// count of a buffer, or whether a lane is passed as a constant.
+  uint32_t selector;
+} FuzzInput;
+
+/// The result of a call.
+typedef struct FuzzOutput_t {
+  FuzzLanes values;
+  /// Another result to accept, such as the fused multiply-add where `values`
+  /// holds the separately rounded product and sum. Written by the reference only.
+  FuzzLanes alternative;
+  int hasAlternative;
+} FuzzOutput;
+
+/// The element type of a result, which decides how its lanes are compared.
+typedef enum FuzzElement_t {
+  FuzzElementFloat32  = 0,
+  FuzzElementFloat64  = 1,
+  /// Any 32-bit integer, or the bits of a 64-bit one split in two lanes
+  FuzzElementInteger  = 2,
+} FuzzElement;
+
+/// The values the operands of a function are drawn from.
+typedef enum FuzzDomain_t {
+  /// Any 32-bit float, biased towards NaN, infinities, zeros and subnormals
+  FuzzDomainFloat32         = 0,
+  /// Finite 32-bit floats of magnitudes between 2^-8 and 2^8, and zero
+  FuzzDomainFloat32Finite   = 1,
+  /// Any 64-bit float, biased like `FuzzDomainFloat32`
+  FuzzDomainFloat64         = 2,
+  /// Finite 64-bit floats, like `FuzzDomainFloat32Finite`
+  FuzzDomainFloat64Finite   = 3,
+  /// Unit quaternions in the first two operands, parameters in [0, 1] in the third
+  FuzzDomainQuaternion      = 4,
+  /// Any 32-bit integer, biased towards the boundaries of both signednesses
+  FuzzDomainInteger         = 5,
+  /// Integers in the first operand and shift counts in the second, mostly below 32
+  FuzzDomainShift           = 6,
+} FuzzDomain;
+
+/// How a result of a backend has to match the reference.
+typedef enum FuzzCompare_t {
+  /// Equal in every bit, except that any NaN matches any other NaN
+  FuzzCompareExact  = 0,
+  /// Within `ulps` units in the last place, see `FuzzTolerance`
+  FuzzCompareUlps   = 1,
+  /// Equal in every bit to either the reference or its alternative
+  FuzzCompareEither = 2,
+} FuzzCompare;
+
+/// The tolerance of a function, documented per function in `FunctionList.h`.
+///
+/// A finite result `b` matches the reference `r` if
+/// `|b - r| <= ulps * epsilon * max(1, |r|, m^degree)`, where `epsilon` is
+/// the machine epsilon of the element type and `m` the largest magnitude of
+/// all operand elements. The `degree` thus scales the tolerance to the error
+/// of e.g. a dot product, which is relative to the products rather than to
+/// their possibly cancelling sum. Non-finite results have to match exactly.
+typedef struct FuzzTolerance_t {
+  FuzzCompare compare;
+  double ulps;
+  int degree;
+} FuzzTolerance;
+
+/// A function under test, wrapped to take and return raw lanes.
+typedef struct FuzzFunction_t {
+  /// The storage type, e.g. `"Float32x4"`
+  const char* type;
+  /// The operation, e.g. `"Minimum"`
+  const char* operation;
+  FuzzElement element;
+  FuzzDomain domain;
+  FuzzTolerance tolerance;
+  /// Whether the function is one of the bulk kernels bound at runtime, which
+  /// is compared at every dispatch level the executing CPU supports.
+  int dispatched;
+  /// Calls the function and returns the number of lanes written to `output`.
+  int (*call)(const FuzzInput* input, FuzzOutput* output);
+} FuzzFunction;
+
+#pragma mark - Tables
+
+/// The functions compiled with `CSIMDX_FORCE_SCALAR`, i.e. the plain C fallback.
+extern const FuzzFunction ReferenceFunctions[];
+
+/// The same functions, compiled for the instruction set of the build.
+extern const FuzzFunction BackendFunctions[];
+
+/// The number of functions in both tables.
+extern const size_t FuzzFunctionCount;
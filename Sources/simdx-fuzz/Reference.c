@@ -0,0 +1,28 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The plain C fallback of every function, which the backends are compared to.
+// Contracting a multiplication and an addition into a fused multiply-add
+// would round differently than the fallback is written, so it is disabled.
+
+#define CSIMDX_FORCE_SCALAR 1
+#define FUZZ_REFERENCE 1
+#pragma STDC FP_CONTRACT OFF
+
+#include "CSIMDX.h"
+
+#define FUZZ_TABLE ReferenceFunctions
+#include "Functions.h"
+
+const size_t FuzzFunctionCount = sizeof(ReferenceFunctions) / sizeof(ReferenceFunctions[0]);
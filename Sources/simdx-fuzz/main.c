@@ -0,0 +1,513 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares every CSIMDX function as compiled for the instruction set of the
+// build against the plain C fallback, on random and boundary operands, and
+// every bulk kernel at each dispatch level the executing CPU supports.
+//
+//     swift run -c release simdx-fuzz [options]
+//
+//     --iterations <n>    Calls per function and dispatch level (20000)
+//     --seed <n>          Seed of the operands, printed to reproduce a run
+//     --filter <text>     Test only functions whose name contains <text>
+//     --verbose           Print every function, not only the mismatching ones
+//
+// Exits with 1 if any result does not match the reference within the tolerance
+// documented in `FunctionList.h`, after printing the first mismatches of each.
+//
+// Building with -DSIMDX_FUZZ_LIBFUZZER -fsanitize=fuzzer replaces `main` by
+// the entry point of libFuzzer, which aborts on the first mismatch.
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Fuzz.h"
+#include "CSIMDX.h"
+
+/// The mismatches printed per function, the rest is counted only.
+#define FUZZ_REPORTED_MISMATCHES 3
+
+#pragma mark - Operands
+
+/// Advances a splitmix64 state and returns its next output.
+static uint64_t FuzzRandom(uint64_t* state)
+{
+  uint64_t value = (*state += 0x9E3779B97F4A7C15ull);
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
+
+/// Returns a uniformly distributed value in [0, 1).
+static double FuzzUniform(uint64_t* state)
+{
+  return (double)(FuzzRandom(state) >> 11) * 0x1.0p-53;
+}
+
+/// Returns a finite value of a magnitude between 2^-8 and 2^8, or zero.
+static double FuzzFinite(uint64_t* state)
+{
+  uint64_t bits = FuzzRandom(state);
+  if ((bits & 31) == 0) return 0.0;
+  double magnitude = ldexp(1.0 + FuzzUniform(state), (int)((bits >> 8) % 17) - 8);
+  return bits & 32 ? -magnitude : magnitude;
+}
+
+static float FuzzFloat32(uint64_t* state, int finite)
+{
+  static const uint32_t specials[] = {
+    0x00000000, 0x80000000, 0x3F800000, 0xBF800000, 0x3F000000, 0x7F800000, 0xFF800000,
+    0x7FC00000, 0xFFC00000, 0x7FA00000, 0x00800000, 0x80800000, 0x00000001, 0x807FFFFF,
+    0x7F7FFFFF, 0xFF7FFFFF, 0x4B800001, 0xCF000000,
+  };
+  uint64_t choice = FuzzRandom(state);
+  uint32_t bits = (uint32_t)(choice >> 32);
+  float value;
+  switch (finite ? 2 : choice & 3) {
+    case 0: bits = specials[bits % (sizeof(specials) / sizeof(specials[0]))]; break;
+    case 1: break;
+    default: value = (float)FuzzFinite(state); memcpy(&bits, &value, sizeof(bits)); break;
+  }
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static double FuzzFloat64(uint64_t* state, int finite)
+{
+  static const uint64_t specials[] = {
+    0x0000000000000000, 0x8000000000000000, 0x3FF0000000000000, 0xBFF0000000000000,
+    0x3FE0000000000000, 0x7FF0000000000000, 0xFFF0000000000000, 0x7FF8000000000000,
+    0xFFF8000000000000, 0x7FF4000000000000, 0x0010000000000000, 0x8010000000000000,
+    0x0000000000000001, 0x800FFFFFFFFFFFFF, 0x7FEFFFFFFFFFFFFF, 0xFFEFFFFFFFFFFFFF,
+    0x47EFFFFFE0000000, 0x36A0000000000000, 0x4340000000000001,
+  };
+  uint64_t choice = FuzzRandom(state);
+  uint64_t bits = FuzzRandom(state);
+  double value;
+  switch (finite ? 2 : choice & 3) {
+    case 0: bits = specials[bits % (sizeof(specials) / sizeof(specials[0]))]; break;
+    case 1: break;
+    default: value = FuzzFinite(state); memcpy(&bits, &value, sizeof(bits)); break;
+  }
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static uint32_t FuzzInteger(uint64_t* state)
+{
+  static const uint32_t specials[] = {
+    0, 1, 2, 3, 31, 32, 33, 0xFF, 0x100, 0xFFFF, 0x10000, 0x00FF00FF, 0x7FFFFFFF, 0x80000000,
+    0x80000001, 0xFFFFFFFE, 0xFFFFFFFF,
+  };
+  uint64_t choice = FuzzRandom(state);
+  uint32_t bits = (uint32_t)(choice >> 32);
+  switch (choice & 3) {
+    case 0: return specials[bits % (sizeof(specials) / sizeof(specials[0]))];
+    case 1: return (uint32_t)1 << (bits & 31);
+    default: return bits;
+  }
+}
+
+/// Returns a shift count, mostly below the width of an element.
+static uint32_t FuzzShiftCount(uint64_t* state)
+{
+  uint64_t choice = FuzzRandom(state);
+  switch (choice & 7) {
+    case 0: return 32 + (uint32_t)((choice >> 8) % 32);
+    case 1: return (uint32_t)(choice >> 32);
+    default: return (uint32_t)((choice >> 8) % 32);
+  }
+}
+
+/// Writes a unit quaternion to `components`, close to or opposite of `nearby` at times.
+static void FuzzQuaternion(uint64_t* state, float* components, const float* nearby)
+{
+  double values[4], length = 0.0;
+  uint64_t choice = nearby ? FuzzRandom(state) & 7 : 7;
+  for (int index = 0; index < 4; index++) {
+    switch (choice) {
+      case 0: values[index] = nearby[index] + 1e-3 * (FuzzUniform(state) - 0.5); break;
+      case 1: values[index] = -nearby[index]; break;
+      default: values[index] = 2.0 * FuzzUniform(state) - 1.0; break;
+    }
+    length += values[index] * values[index];
+  }
+  length = sqrt(length > 0.0 ? length : 1.0);
+  for (int index = 0; index < 4; index++) {
+    components[index] = (float)(values[index] / length);
+  }
+}
+
+/// Fills all operands of `input` with values of `domain`. The operands after
+/// the first repeat its elements at times, to cover equal and opposite values.
+static void FuzzGenerate(FuzzDomain domain, uint64_t* state, FuzzInput* input)
+{
+  memset(input, 0, sizeof(*input));
+  input->selector = (uint32_t)FuzzRandom(state);
+  for (int operand = 0; operand < 3; operand++) {
+    FuzzLanes* lanes = &input->operands[operand];
+    const FuzzLanes* first = &input->operands[0];
+    for (int lane = 0; lane < FUZZ_LANES; lane++) {
+      uint64_t repeat = operand > 0 ? FuzzRandom(state) & 15 : 15;
+      switch (domain) {
+        case FuzzDomainFloat32:
+        case FuzzDomainFloat32Finite:
+          lanes->f32[lane] = repeat == 0 ? first->f32[lane]
+                           : repeat == 1 ? -first->f32[lane]
+                           : FuzzFloat32(state, domain == FuzzDomainFloat32Finite);
+          break;
+        case FuzzDomainFloat64:
+        case FuzzDomainFloat64Finite:
+          if (lane >= FUZZ_LANES / 2) break;
+          lanes->f64[lane] = repeat == 0 ? first->f64[lane]
+                           : repeat == 1 ? -first->f64[lane]
+                           : FuzzFloat64(state, domain == FuzzDomainFloat64Finite);
+          break;
+        case FuzzDomainQuaternion:
+          if (operand == 2) lanes->f32[lane] = repeat < 2 ? (float)repeat : (float)FuzzUniform(state);
+          else if (lane % 4 == 0) FuzzQuaternion(state, &lanes->f32[lane], operand ? &first->f32[lane] : NULL);
+          break;
+        case FuzzDomainInteger:
+          lanes->u32[lane] = repeat == 0 ? first->u32[lane]
+                           : repeat == 1 ? 0u - first->u32[lane]
+                           : FuzzInteger(state);
+          break;
+        case FuzzDomainShift:
+          lanes->u32[lane] = operand == 1 ? FuzzShiftCount(state) : FuzzInteger(state);
+          break;
+      }
+    }
+  }
+}
+
+/// Returns the largest magnitude of all finite operand elements of `domain`.
+static double FuzzMagnitude(FuzzDomain domain, const FuzzInput* input)
+{
+  double magnitude = 0.0;
+  for (int operand = 0; operand < 3; operand++) {
+    for (int lane = 0; lane < FUZZ_LANES; lane++) {
+      double value = 0.0;
+      switch (domain) {
+        case FuzzDomainFloat32:
+        case FuzzDomainFloat32Finite:
+          value = input->operands[operand].f32[lane];
+          break;
+        case FuzzDomainFloat64:
+        case FuzzDomainFloat64Finite:
+          if (lane < FUZZ_LANES / 2) value = input->operands[operand].f64[lane];
+          break;
+        default:
+          return 1.0;
+      }
+      if (isfinite(value) && fabs(value) > magnitude) magnitude = fabs(value);
+    }
+  }
+  return magnitude;
+}
+
+#pragma mark - Comparison
+
+/// Returns the value of `lane` of `lanes` as a double, if of a floating-point `element`.
+static double FuzzValue(FuzzElement element, const FuzzLanes* lanes, int lane)
+{
+  return element == FuzzElementFloat64 ? lanes->f64[lane] : lanes->f32[lane];
+}
+
+/// Returns whether `lane` of both is equal in every bit, or NaN in both.
+static int FuzzIdentical(FuzzElement element, const FuzzLanes* lhs, const FuzzLanes* rhs, int lane)
+{
+  switch (element) {
+    case FuzzElementFloat32:
+      if (isnan(lhs->f32[lane]) && isnan(rhs->f32[lane])) return 1;
+      return lhs->u32[lane] == rhs->u32[lane];
+    case FuzzElementFloat64:
+      if (isnan(lhs->f64[lane]) && isnan(rhs->f64[lane])) return 1;
+      return lhs->u64[lane] == rhs->u64[lane];
+    case FuzzElementInteger:
+      return lhs->u32[lane] == rhs->u32[lane];
+  }
+  return 0;
+}
+
+/// Returns the error of `lane` of `backend` in units of the tolerance, i.e.
+/// above `tolerance.ulps` if it does not match, or `INFINITY` if not comparable.
+static double FuzzError(const FuzzFunction* function,
+                        double magnitude,
+                        const FuzzOutput* reference,
+                        const FuzzOutput* backend,
+                        int lane)
+{
+  const FuzzTolerance* tolerance = &function->tolerance;
+  switch (tolerance->compare) {
+    case FuzzCompareExact:
+      return FuzzIdentical(function->element, &reference->values, &backend->values, lane) ? 0 : INFINITY;
+    case FuzzCompareEither:
+      if (FuzzIdentical(function->element, &reference->values, &backend->values, lane)) return 0;
+      if (!reference->hasAlternative) return INFINITY;
+      return FuzzIdentical(function->element, &reference->alternative, &backend->values, lane) ? 0 : INFINITY;
+    case FuzzCompareUlps:
+      break;
+  }
+  if (function->element == FuzzElementInteger) {
+    return FuzzIdentical(function->element, &reference->values, &backend->values, lane) ? 0 : INFINITY;
+  }
+  double expected = FuzzValue(function->element, &reference->values, lane);
+  double actual = FuzzValue(function->element, &backend->values, lane);
+  if (!isfinite(expected) || !isfinite(actual)) {
+    return (isnan(expected) && isnan(actual)) || expected == actual ? 0 : INFINITY;
+  }
+  double epsilon = function->element == FuzzElementFloat64 ? DBL_EPSILON : FLT_EPSILON;
+  double scale = fmax(1.0, fmax(fabs(expected), pow(magnitude, tolerance->degree)));
+  return fabs(actual - expected) / (epsilon * scale);
+}
+
+#pragma mark - Report
+
+static void FuzzPrintLanes(const char* label, FuzzElement element, const FuzzLanes* lanes, int count)
+{
+  printf("    %-11s", label);
+  for (int lane = 0; lane < count; lane++) {
+    if (element == FuzzElementFloat64) {
+      printf(" %a (%016llx)", lanes->f64[lane], (unsigned long long)lanes->u64[lane]);
+    } else if (element == FuzzElementFloat32) {
+      printf(" %a (%08x)", lanes->f32[lane], lanes->u32[lane]);
+    } else {
+      printf(" %08x", lanes->u32[lane]);
+    }
+  }
+  printf("\n");
+}
+
+static FuzzElement FuzzDomainElement(FuzzDomain domain)
+{
+  switch (domain) {
+    case FuzzDomainFloat32:
+    case FuzzDomainFloat32Finite:
+    case FuzzDomainQuaternion:
+      return FuzzElementFloat32;
+    case FuzzDomainFloat64:
+    case FuzzDomainFloat64Finite:
+      return FuzzElementFloat64;
+    default:
+      return FuzzElementInteger;
+  }
+}
+
+static void FuzzPrintMismatch(const FuzzFunction* function,
+                              const FuzzInput* input,
+                              const FuzzOutput* reference,
+                              const FuzzOutput* backend,
+                              int count,
+                              int lane)
+{
+  FuzzElement element = FuzzDomainElement(function->domain);
+  int operandLanes = element == FuzzElementFloat64 ? FUZZ_LANES / 2 : FUZZ_LANES;
+  printf("  lane %d, selector %u\n", lane, input->selector);
+  FuzzPrintLanes("operand 0:", element, &input->operands[0], operandLanes);
+  FuzzPrintLanes("operand 1:", element, &input->operands[1], operandLanes);
+  FuzzPrintLanes("operand 2:", element, &input->operands[2], operandLanes);
+  FuzzPrintLanes("reference:", function->element, &reference->values, count);
+  if (reference->hasAlternative) FuzzPrintLanes("or:", function->element, &reference->alternative, count);
+  FuzzPrintLanes("backend:", function->element, &backend->values, count);
+}
+
+static void FuzzDescribeTolerance(const FuzzTolerance* tolerance, char* buffer, size_t size)
+{
+  switch (tolerance->compare) {
+    case FuzzCompareExact: snprintf(buffer, size, "exact"); break;
+    case FuzzCompareEither: snprintf(buffer, size, "either"); break;
+    case FuzzCompareUlps: snprintf(buffer, size, "%g ulp, m^%d", tolerance->ulps, tolerance->degree); break;
+  }
+}
+
+#pragma mark - Run
+
+/// Calls both `reference` and `backend` with `input`, and returns the largest
+/// error of all lanes, or a negative value if the lane counts differ.
+static double FuzzCall(const FuzzFunction* reference,
+                       const FuzzFunction* backend,
+                       const FuzzInput* input,
+                       FuzzOutput* referenceOutput,
+                       FuzzOutput* backendOutput,
+                       int* count,
+                       int* worstLane)
+{
+  memset(referenceOutput, 0, sizeof(*referenceOutput));
+  memset(backendOutput, 0, sizeof(*backendOutput));
+  *worstLane = 0;
+  *count = reference->call(input, referenceOutput);
+  if (backend->call(input, backendOutput) != *count) return -1;
+  double magnitude = FuzzMagnitude(reference->domain, input);
+  double worst = 0;
+  for (int lane = 0; lane < *count; lane++) {
+    double error = FuzzError(reference, magnitude, referenceOutput, backendOutput, lane);
+    if (error > worst || isnan(error)) {
+      worst = isnan(error) ? INFINITY : error;
+      *worstLane = lane;
+    }
+  }
+  return worst;
+}
+
+/// Returns whether the error of a call exceeds the tolerance of `function`.
+static int FuzzExceeds(const FuzzFunction* function, double error)
+{
+  return error < 0 || error > function->tolerance.ulps;
+}
+
+#if !defined(SIMDX_FUZZ_LIBFUZZER)
+
+typedef struct FuzzLevel_t {
+  CSIMDXDispatchLevel level;
+  const char* name;
+} FuzzLevel;
+
+static const FuzzLevel FuzzLevels[] = {
+  { CSIMDXDispatchLevelGeneric, "generic" },
+  { CSIMDXDispatchLevelSSE2, "sse2" },
+  { CSIMDXDispatchLevelSSE4_1, "sse4.1" },
+  { CSIMDXDispatchLevelAVX2, "avx2" },
+  { CSIMDXDispatchLevelAVX512, "avx512" },
+  { CSIMDXDispatchLevelNEON, "neon" },
+};
+
+/// Runs `iterations` calls of function `index`, prints its line if it
+/// mismatches or if `verbose`, and returns the number of mismatches.
+static long FuzzRun(size_t index, const char* level, long iterations, uint64_t seed, int verbose)
+{
+  const FuzzFunction* reference = &ReferenceFunctions[index];
+  const FuzzFunction* backend = &BackendFunctions[index];
+  uint64_t state = seed ^ (0xD1B54A32D192ED03ull * (index + 1));
+  long mismatches = 0;
+  double worst = 0;
+  char name[64], tolerance[32];
+  snprintf(name, sizeof(name), "%s.%s%s%s", reference->type, reference->operation, level ? "@" : "", level ? level : "");
+  FuzzDescribeTolerance(&reference->tolerance, tolerance, sizeof(tolerance));
+
+  for (long iteration = 0; iteration < iterations; iteration++) {
+    FuzzInput input;
+    FuzzOutput referenceOutput, backendOutput;
+    int count, lane;
+    FuzzGenerate(reference->domain, &state, &input);
+    double error = FuzzCall(reference, backend, &input, &referenceOutput, &backendOutput, &count, &lane);
+    if (!FuzzExceeds(reference, error)) {
+      if (error > worst) worst = error;
+      continue;
+    }
+    if (mismatches++ < FUZZ_REPORTED_MISMATCHES) {
+      printf("%s: mismatch at iteration %ld (%s)\n", name, iteration, tolerance);
+      FuzzPrintMismatch(reference, &input, &referenceOutput, &backendOutput, count, lane);
+    }
+  }
+
+  if (mismatches || verbose) {
+    printf("%-40s %-14s %10.3g %10ld/%ld\n", name, tolerance, worst, mismatches, iterations);
+  }
+  fflush(stdout);
+  return mismatches;
+}
+
+static void FuzzUsage(const char* message)
+{
+  fprintf(stderr, "error: %s\n", message);
+  exit(2);
+}
+
+int main(int argc, const char* argv[])
+{
+  long iterations = 20000;
+  uint64_t seed = (uint64_t)time(NULL);
+  const char* filter = NULL;
+  int verbose = 0;
+
+  for (int index = 1; index < argc; index++) {
+    const char* argument = argv[index];
+    const char* value = index + 1 < argc ? argv[index + 1] : NULL;
+    if (strcmp(argument, "--verbose") == 0) {
+      verbose = 1;
+      continue;
+    }
+    if (!value) FuzzUsage("missing value or unknown argument");
+    if (strcmp(argument, "--iterations") == 0) iterations = atol(value) > 0 ? atol(value) : 1;
+    else if (strcmp(argument, "--seed") == 0) seed = strtoull(value, NULL, 0);
+    else if (strcmp(argument, "--filter") == 0) filter = value;
+    else FuzzUsage("unknown argument");
+    index++;
+  }
+
+  const char* isaLevel = CSIMDXActiveISALevel();
+  printf("backend: %s (features 0x%x), seed: %llu, iterations: %ld\n",
+         isaLevel ? isaLevel : "default", CSIMDXActiveFeatures(), (unsigned long long)seed, iterations);
+  if (verbose) printf("%-40s %-14s %10s %17s\n", "function", "tolerance", "max error", "mismatches");
+
+  long mismatches = 0;
+  size_t functions = 0;
+  CSIMDXDispatchLevel supported = CSIMDXDispatchLevelSupported();
+  for (size_t index = 0; index < FuzzFunctionCount; index++) {
+    const FuzzFunction* function = &ReferenceFunctions[index];
+    char name[64];
+    snprintf(name, sizeof(name), "%s.%s", function->type, function->operation);
+    if (filter && !strstr(name, filter)) continue;
+    functions++;
+    if (!function->dispatched) {
+      mismatches += FuzzRun(index, NULL, iterations, seed, verbose);
+      continue;
+    }
+    for (size_t level = 0; level < sizeof(FuzzLevels) / sizeof(FuzzLevels[0]); level++) {
+      if (CSIMDXDispatchLevelSet(FuzzLevels[level].level) != FuzzLevels[level].level) continue;
+      mismatches += FuzzRun(index, FuzzLevels[level].name, iterations, seed, verbose);
+    }
+    CSIMDXDispatchLevelSet(supported);
+  }
+
+  printf("%zu functions, %ld mismatches\n", functions, mismatches);
+  return mismatches ? 1 : 0;
+}
+
+#else
+
+/// Takes the function from the first two bytes. Exact functions take their
+/// operands as they are, the others from the generator seeded with the rest,
+/// as their tolerance holds for the operands of their domain only.
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+  if (size < 2) return 0;
+  size_t index = ((size_t)data[0] | (size_t)data[1] << 8) % FuzzFunctionCount;
+  const FuzzFunction* reference = &ReferenceFunctions[index];
+  FuzzInput input;
+  memset(&input, 0, sizeof(input));
+  if (reference->tolerance.compare == FuzzCompareUlps || reference->domain == FuzzDomainQuaternion) {
+    uint64_t state = 0;
+    memcpy(&state, data + 2, size - 2 < sizeof(state) ? size - 2 : sizeof(state));
+    FuzzGenerate(reference->domain, &state, &input);
+  } else {
+    memcpy(&input, data + 2, size - 2 < sizeof(input) ? size - 2 : sizeof(input));
+  }
+
+  FuzzOutput referenceOutput, backendOutput;
+  int count, lane;
+  double error = FuzzCall(reference, &BackendFunctions[index], &input, &referenceOutput, &backendOutput, &count, &lane);
+  if (FuzzExceeds(reference, error)) {
+    printf("%s.%s: mismatch\n", reference->type, reference->operation);
+    FuzzPrintMismatch(reference, &input, &referenceOutput, &backendOutput, count, lane);
+    abort();
+  }
+  return 0;
+}
+
+#endif
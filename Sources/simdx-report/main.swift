@@ -0,0 +1,30 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Prints the code path SIMDX has been compiled to on the executing host.
+//
+//     swift run simdx-report [--strict]
+//
+// With `--strict`, exits with status 1 if any storage uses the scalar fallback.
+
+import Foundation
+import SIMDX
+
+let backend = SIMDXBackend.current
+print(backend)
+
+if CommandLine.arguments.dropFirst().contains("--strict"), backend.usesScalarFallback {
+  print("error: storages use the scalar fallback")
+  exit(1)
+}
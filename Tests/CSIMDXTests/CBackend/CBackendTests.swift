@@ -0,0 +1,71 @@
+import XCTest
+import CSIMDX
+
+final class CBackendTests: XCTestCase {
+
+  private let types: [CSIMDXStorageType] = [
+    CSIMDXStorageTypeFloat32x2, CSIMDXStorageTypeFloat32x3, CSIMDXStorageTypeFloat32x4,
+    CSIMDXStorageTypeFloat32x8, CSIMDXStorageTypeFloat32x16,
+    CSIMDXStorageTypeFloat64x2, CSIMDXStorageTypeFloat64x3, CSIMDXStorageTypeFloat64x4,
+    CSIMDXStorageTypeFloat64x8,
+    CSIMDXStorageTypeInt32x2, CSIMDXStorageTypeInt32x3, CSIMDXStorageTypeInt32x4,
+    CSIMDXStorageTypeInt32x8, CSIMDXStorageTypeInt32x16,
+    CSIMDXStorageTypeUInt32x2, CSIMDXStorageTypeUInt32x3, CSIMDXStorageTypeUInt32x4,
+    CSIMDXStorageTypeUInt32x8, CSIMDXStorageTypeUInt32x16,
+  ]
+
+  // MARK: Features
+
+  func testActiveFeaturesAreSupportedByCPU() {
+    // Running at all implies the CPU supports what the tests were compiled for
+    let active = CSIMDXActiveFeatures()
+    XCTAssertEqual(active & CSIMDXCPUFeatures(), active)
+  }
+
+  func testActiveFeaturesOfArchitecture() {
+    #if arch(x86_64)
+    XCTAssertNotEqual(CSIMDXActiveFeatures() & UInt32(CSIMDXCPUFeatureSSE2.rawValue), 0)
+    #elseif arch(arm64)
+    XCTAssertNotEqual(CSIMDXActiveFeatures() & UInt32(CSIMDXCPUFeatureNEON.rawValue), 0)
+    #endif
+  }
+
+  // MARK: Storages
+
+  func testStorageKinds() {
+    for type in types {
+      let kind = CSIMDXStorageKindOf(type)
+      #if arch(x86_64) || arch(arm64)
+      XCTAssertTrue(kind == CSIMDXStorageKindNativeRegister || kind == CSIMDXStorageKindEmulatedPair,
+                    "Storage \(type) uses \(kind) on a SIMD architecture")
+      #else
+      XCTAssertNotEqual(kind, CSIMDXStorageKindEmulatedPair)
+      #endif
+    }
+  }
+
+  func testFloat64x4IsPairOfFloat64x2WithoutAVX() {
+    let avx = UInt32(CSIMDXCPUFeatureAVX.rawValue)
+    guard CSIMDXActiveFeatures() & avx == 0,
+          CSIMDXStorageKindOf(CSIMDXStorageTypeFloat64x2) == CSIMDXStorageKindNativeRegister else { return }
+    XCTAssertEqual(CSIMDXStorageKindOf(CSIMDXStorageTypeFloat64x3), CSIMDXStorageKindEmulatedPair)
+    XCTAssertEqual(CSIMDXStorageKindOf(CSIMDXStorageTypeFloat64x4), CSIMDXStorageKindEmulatedPair)
+  }
+
+  func testWideStoragesArePairsWithoutAVX512() {
+    let avx512f = UInt32(CSIMDXCPUFeatureAVX512F.rawValue)
+    guard CSIMDXActiveFeatures() & avx512f == 0,
+          CSIMDXStorageKindOf(CSIMDXStorageTypeFloat32x4) == CSIMDXStorageKindNativeRegister else { return }
+    XCTAssertEqual(CSIMDXStorageKindOf(CSIMDXStorageTypeFloat32x16), CSIMDXStorageKindEmulatedPair)
+    XCTAssertEqual(CSIMDXStorageKindOf(CSIMDXStorageTypeFloat64x8), CSIMDXStorageKindEmulatedPair)
+    XCTAssertEqual(CSIMDXStorageKindOf(CSIMDXStorageTypeInt32x16), CSIMDXStorageKindEmulatedPair)
+    XCTAssertEqual(CSIMDXStorageKindOf(CSIMDXStorageTypeUInt32x16), CSIMDXStorageKindEmulatedPair)
+  }
+
+  // MARK: ISA Level
+
+  func testISALevel() {
+    guard let level = CSIMDXActiveISALevel() else { return }
+    XCTAssertFalse(String(cString: level).isEmpty)
+  }
+}
@@ -0,0 +1,83 @@
+import XCTest
+import CSIMDX
+
+final class CDispatchTests: XCTestCase {
+
+  private let levels: [CSIMDXDispatchLevel] = [
+    CSIMDXDispatchLevelGeneric,
+    CSIMDXDispatchLevelSSE2,
+    CSIMDXDispatchLevelSSE4_1,
+    CSIMDXDispatchLevelAVX2,
+    CSIMDXDispatchLevelAVX512,
+    CSIMDXDispatchLevelNEON,
+  ]
+
+  /// Counts covering empty buffers, tails only and tails after full vectors
+  private let counts = [0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 1_037]
+
+  override func tearDown() {
+    _ = CSIMDXDispatchLevelSet(CSIMDXDispatchLevelSupported())
+    super.tearDown()
+  }
+
+  // MARK: Detection
+
+  func testSupportedLevelIsCurrentAtStartup() {
+    XCTAssertEqual(CSIMDXDispatchLevelCurrent(), CSIMDXDispatchLevelSupported())
+  }
+
+  func testSetLevelDoesNotExceedSupported() {
+    let supported = CSIMDXDispatchLevelSupported()
+    for level in levels {
+      let bound = CSIMDXDispatchLevelSet(level)
+      XCTAssertLessThanOrEqual(bound.rawValue, level.rawValue)
+      XCTAssertLessThanOrEqual(bound.rawValue, supported.rawValue)
+      XCTAssertEqual(CSIMDXDispatchLevelCurrent(), bound)
+    }
+  }
+
+  // MARK: Bulk Kernels
+
+  func testFloat32KernelsOnAllLevels() {
+    let lhs = (0 ..< 1_037).map { Float32($0 % 17) * 0.25 - 2 }
+    let rhs = (0 ..< 1_037).map { Float32($0 % 13) * 0.5 + 1 }
+    let addend = (0 ..< 1_037).map { Float32($0) * 0.125 }
+
+    for level in levels {
+      _ = CSIMDXDispatchLevelSet(level)
+      for count in counts {
+        var result = [Float32](repeating: .nan, count: count + 1)
+        result[count] = 99
+
+        CSIMDXBufferAddFloat32(lhs, rhs, &result, count)
+        XCTAssertEqual(result[..<count], zip(lhs, rhs).prefix(count).map(+)[...])
+        CSIMDXBufferMultiplyFloat32(lhs, rhs, &result, count)
+        XCTAssertEqual(result[..<count], zip(lhs, rhs).prefix(count).map(*)[...])
+        CSIMDXBufferMultiplyAddFloat32(lhs, rhs, addend, &result, count)
+        XCTAssertEqual(result[..<count], (0 ..< count).map { lhs[$0] * rhs[$0] + addend[$0] }[...])
+        XCTAssertEqual(result[count], 99, "Kernel wrote past the end at level \(level)")
+
+        XCTAssertEqual(CSIMDXBufferSumFloat32(lhs, count), lhs.prefix(count).reduce(0, +))
+        let dot = (0 ..< count).reduce(Float32(0)) { $0 + lhs[$1] * rhs[$1] }
+        XCTAssertEqual(CSIMDXBufferDotFloat32(lhs, rhs, count), dot)
+      }
+    }
+  }
+
+  func testUInt32KernelsOnAllLevels() {
+    let lhs = (0 ..< 1_037).map { UInt32($0) &* 2_654_435_761 }
+    let rhs = (0 ..< 1_037).map { UInt32($0) &* 40_503 &+ 7 }
+
+    for level in levels {
+      _ = CSIMDXDispatchLevelSet(level)
+      for count in counts {
+        var result = [UInt32](repeating: 0, count: count + 1)
+        result[count] = 5
+
+        CSIMDXBufferMultiplyUInt32(lhs, rhs, &result, count)
+        XCTAssertEqual(result[..<count], zip(lhs, rhs).prefix(count).map(&*)[...])
+        XCTAssertEqual(result[count], 5, "Kernel wrote past the end at level \(level)")
+      }
+    }
+  }
+}
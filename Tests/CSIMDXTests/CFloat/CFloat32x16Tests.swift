@@ -0,0 +1,283 @@
+import XCTest
+import CSIMDX
+
+final class CFloat32x16Tests: XCTestCase {
+
+  /// There is no `CFloat32x16Make` of 16 elements, so the tests load them instead.
+  private func make(_ elements: [Float32]) -> CFloat32x16 {
+    var elements = elements
+    return CFloat32x16MakeLoad(&elements)
+  }
+
+  private func elements(of storage: CFloat32x16) -> [Float32] {
+    (0 ..< CInt(16)).map { CFloat32x16GetElement(storage, $0) }
+  }
+
+  private func lanes(of mask: CInt32x16) -> [Int32] {
+    (0 ..< CInt(16)).map { CInt32x16GetElement(mask, $0) }
+  }
+
+  // MARK: Make
+
+  func testMakeLoad() {
+    var array: [Float32] = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]
+    let collection = CFloat32x16MakeLoad(&array)
+
+    XCTAssertEqual(elements(of: collection), array)
+  }
+
+  func testMakeRepeatingElement() {
+    let collection = CFloat32x16MakeRepeatingElement(3)
+
+    XCTAssertEqual(elements(of: collection), [Float32](repeating: 3, count: 16))
+  }
+
+  func testMakeZero() {
+    let collection = CFloat32x16MakeZero()
+
+    XCTAssertEqual(elements(of: collection), [Float32](repeating: 0, count: 16))
+  }
+
+  // MARK: Access
+
+  func testGetLowAndHigh() {
+    let collection = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let low = CFloat32x16GetLow(collection)
+    let high = CFloat32x16GetHigh(collection)
+
+    XCTAssertEqual(CFloat32x8GetElement(low, 0), 1)
+    XCTAssertEqual(CFloat32x8GetElement(low, 1), 2)
+    XCTAssertEqual(CFloat32x8GetElement(low, 2), 3)
+    XCTAssertEqual(CFloat32x8GetElement(low, 3), 4)
+    XCTAssertEqual(CFloat32x8GetElement(low, 4), 5)
+    XCTAssertEqual(CFloat32x8GetElement(low, 5), 6)
+    XCTAssertEqual(CFloat32x8GetElement(low, 6), 7)
+    XCTAssertEqual(CFloat32x8GetElement(low, 7), 8)
+    XCTAssertEqual(CFloat32x8GetElement(high, 0), 9)
+    XCTAssertEqual(CFloat32x8GetElement(high, 1), 10)
+    XCTAssertEqual(CFloat32x8GetElement(high, 2), 11)
+    XCTAssertEqual(CFloat32x8GetElement(high, 3), 12)
+    XCTAssertEqual(CFloat32x8GetElement(high, 4), 13)
+    XCTAssertEqual(CFloat32x8GetElement(high, 5), 14)
+    XCTAssertEqual(CFloat32x8GetElement(high, 6), 15)
+    XCTAssertEqual(CFloat32x8GetElement(high, 7), 16)
+  }
+
+  func testSetElement() {
+    var collection = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    for lane in 0 ..< CInt(16) {
+      CFloat32x16SetElement(&collection, lane, Float32(lane) + 17)
+    }
+
+    XCTAssertEqual(elements(of: collection), [17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32])
+  }
+
+  func testExtractLane() {
+    let collection = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 1), 2)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 2), 3)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 3), 4)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 4), 5)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 5), 6)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 6), 7)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 7), 8)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 8), 9)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 9), 10)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 10), 11)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 11), 12)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 12), 13)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 13), 14)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 14), 15)
+    XCTAssertEqual(CFloat32x16ExtractLane(collection, 15), 16)
+  }
+
+  func testInsertLane() {
+    var collection = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    collection = CFloat32x16InsertLane(collection, 0, 17)
+    collection = CFloat32x16InsertLane(collection, 1, 18)
+    collection = CFloat32x16InsertLane(collection, 2, 19)
+    collection = CFloat32x16InsertLane(collection, 3, 20)
+    collection = CFloat32x16InsertLane(collection, 4, 21)
+    collection = CFloat32x16InsertLane(collection, 5, 22)
+    collection = CFloat32x16InsertLane(collection, 6, 23)
+    collection = CFloat32x16InsertLane(collection, 7, 24)
+    collection = CFloat32x16InsertLane(collection, 8, 25)
+    collection = CFloat32x16InsertLane(collection, 9, 26)
+    collection = CFloat32x16InsertLane(collection, 10, 27)
+    collection = CFloat32x16InsertLane(collection, 11, 28)
+    collection = CFloat32x16InsertLane(collection, 12, 29)
+    collection = CFloat32x16InsertLane(collection, 13, 30)
+    collection = CFloat32x16InsertLane(collection, 14, 31)
+    collection = CFloat32x16InsertLane(collection, 15, 32)
+
+    XCTAssertEqual(elements(of: collection), [17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32])
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = make([0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    XCTAssertTrue(CFloat32x16Equal(storage, make([-0.0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])))
+    XCTAssertFalse(CFloat32x16Equal(storage, make([0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17])))
+    XCTAssertFalse(CFloat32x16Equal(make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, .nan]), make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, .nan])))
+  }
+
+  func testCompare() {
+    let lhs = make([0, 1, .nan, 3, -1, 5, 6, .infinity, 8, 9, 10, 11, 12, 13, 14, 15])
+    let rhs = make([-0.0, 2, .nan, 2, -1, 4, 7, .infinity, 15, 14, 13, 12, 11, 10, 9, 8])
+
+    XCTAssertEqual(lanes(of: CFloat32x16CompareEqual(lhs, rhs)), [-1, 0, 0, 0,
+                                                                  -1, 0, 0, -1,
+                                                                  0, 0, 0, 0,
+                                                                  0, 0, 0, 0])
+    XCTAssertEqual(lanes(of: CFloat32x16CompareLessThan(lhs, rhs)), [0, -1, 0, 0,
+                                                                     0, 0, -1, 0,
+                                                                     -1, -1, -1, -1,
+                                                                     0, 0, 0, 0])
+    XCTAssertEqual(lanes(of: CFloat32x16CompareLessThanOrEqual(lhs, rhs)), [-1, -1, 0, 0,
+                                                                            -1, 0, -1, -1,
+                                                                            -1, -1, -1, -1,
+                                                                            0, 0, 0, 0])
+  }
+
+  func testSelect() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+    // The lesser elements, selected by the mask of their comparison
+    let storage = CFloat32x16Select(CFloat32x16CompareLessThan(lhs, rhs), lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [1, 2, 3, 4,
+                                           5, 6, 7, 8,
+                                           8, 7, 6, 5,
+                                           4, 3, 2, 1])
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat32x16Canonicalize(make([-0.0, -.nan, .signalingNaN, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]))
+    let elements = self.elements(of: storage)
+
+    XCTAssertEqual(elements[0].bitPattern, Float32(0).bitPattern)
+    XCTAssertEqual(elements[1].bitPattern, Float32.nan.bitPattern)
+    XCTAssertEqual(elements[2].bitPattern, Float32.nan.bitPattern)
+    XCTAssertEqual(Array(elements[3...]), [4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+  }
+
+  func testMinimum() {
+    let lhs = make([34, 12, 0, 23.0, 34, 12, 0, 23.0, 34, 12, 0, 23.0, 34, 12, 0, 23.0])
+    let rhs = make([-34, 24, -0, 23.5, -34, 24, -0, 23.5, -34, 24, -0, 23.5, -34, 24, -0, 23.5])
+    let storage = CFloat32x16Minimum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [-34, 12, 0, 23.0, -34, 12, 0, 23.0, -34, 12, 0, 23.0, -34, 12, 0, 23.0])
+  }
+
+  func testMaximum() {
+    let lhs = make([34, 12, 0, 23.0, 34, 12, 0, 23.0, 34, 12, 0, 23.0, 34, 12, 0, 23.0])
+    let rhs = make([-34, 24, -0, 23.5, -34, 24, -0, 23.5, -34, 24, -0, 23.5, -34, 24, -0, 23.5])
+    let storage = CFloat32x16Maximum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [34, 24, 0, 23.5, 34, 24, 0, 23.5, 34, 24, 0, 23.5, 34, 24, 0, 23.5])
+  }
+
+  // MARK: Arithmetic
+
+  func testMagnitude() {
+    let normal = make([-1, 0, 3, -4, -1, 0, 3, -4, -1, 0, 3, -4, -1, 0, 3, -4])
+
+    XCTAssertEqual(elements(of: CFloat32x16Magnitude(normal)), [1, 0, 3, 4, 1, 0, 3, 4, 1, 0, 3, 4, 1, 0, 3, 4])
+  }
+
+  func testNegate() {
+    let normal = make([-1, 0, 3, -4, -1, 0, 3, -4, -1, 0, 3, -4, -1, 0, 3, -4])
+
+    XCTAssertEqual(elements(of: CFloat32x16Negate(normal)), [1, 0, -3, 4, 1, 0, -3, 4, 1, 0, -3, 4, 1, 0, -3, 4])
+  }
+
+  func testAdd() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+
+    XCTAssertEqual(elements(of: CFloat32x16Add(lhs, rhs)), [Float32](repeating: 17, count: 16))
+  }
+
+  func testSubtract() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+
+    XCTAssertEqual(elements(of: CFloat32x16Subtract(lhs, rhs)), [-15, -13, -11, -9, -7, -5, -3, -1, 1, 3, 5, 7, 9, 11, 13, 15])
+  }
+
+  func testMultiply() {
+    let lhs = make([1, -2, -3, 4, 1, -2, -3, 4, 1, -2, -3, 4, 1, -2, -3, 4])
+    let rhs = make([4, -3, 2, -1, 4, -3, 2, -1, 4, -3, 2, -1, 4, -3, 2, -1])
+
+    XCTAssertEqual(elements(of: CFloat32x16Multiply(lhs, rhs)), [4, 6, -6, -4, 4, 6, -6, -4, 4, 6, -6, -4, 4, 6, -6, -4])
+  }
+
+  func testDivide() {
+    let lhs = make([1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4])
+    let rhs = make([-4, -3, 3, 2, -4, -3, 3, 2, -4, -3, 3, 2, -4, -3, 3, 2])
+
+    XCTAssertEqual(elements(of: CFloat32x16Divide(lhs, rhs)), [-0.25, 2, -1, 2, -0.25, 2, -1, 2, -0.25, 2, -1, 2, -0.25, 2, -1, 2])
+  }
+
+  func testSquareRoot() {
+    let storage = CFloat32x16SquareRoot(make([25, 144, 64, 256, 25, 144, 64, 256, 25, 144, 64, 256, 25, 144, 64, 256]))
+
+    XCTAssertEqual(elements(of: storage), [5, 12, 8, 16, 5, 12, 8, 16, 5, 12, 8, 16, 5, 12, 8, 16])
+  }
+
+  func testArithmeticWithElement() {
+    let lhs = make([1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4])
+
+    XCTAssertEqual(elements(of: CFloat32x16AddElement(lhs, 2)), [3, -4, -1, 6, 3, -4, -1, 6, 3, -4, -1, 6, 3, -4, -1, 6])
+    XCTAssertEqual(elements(of: CFloat32x16SubtractElement(lhs, 2)), [-1, -8, -5, 2, -1, -8, -5, 2, -1, -8, -5, 2, -1, -8, -5, 2])
+    XCTAssertEqual(elements(of: CFloat32x16MultiplyElement(lhs, 2)), [2, -12, -6, 8, 2, -12, -6, 8, 2, -12, -6, 8, 2, -12, -6, 8])
+    XCTAssertEqual(elements(of: CFloat32x16DivideElement(lhs, 2)), [0.5, -3, -1.5, 2, 0.5, -3, -1.5, 2, 0.5, -3, -1.5, 2, 0.5, -3, -1.5, 2])
+  }
+
+  func testMultiplyAdd() {
+    let lhs = make([1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4])
+    let rhs = make([2, 2, -1, 0.5, 2, 2, -1, 0.5, 2, 2, -1, 0.5, 2, 2, -1, 0.5])
+    let addend = make([0.5, 1, -2, 3, 0.5, 1, -2, 3, 0.5, 1, -2, 3, 0.5, 1, -2, 3])
+
+    XCTAssertEqual(elements(of: CFloat32x16MultiplyAdd(lhs, rhs, addend)), [2.5, -11, 1, 5, 2.5, -11, 1, 5, 2.5, -11, 1, 5, 2.5, -11, 1, 5])
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = make([1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4, 1, -6, -3, 4])
+    let addend = make([0.5, 1, -2, 3, 0.5, 1, -2, 3, 0.5, 1, -2, 3, 0.5, 1, -2, 3])
+
+    XCTAssertEqual(elements(of: CFloat32x16MultiplyElementAdd(lhs, 2, addend)), [2.5, -11, -8, 11, 2.5, -11, -8, 11, 2.5, -11, -8, 11, 2.5, -11, -8, 11])
+  }
+
+  // MARK: Reduction
+
+  func testReduceAdd() {
+    XCTAssertEqual(CFloat32x16ReduceAdd(make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])), 136)
+    XCTAssertEqual(CFloat32x16ReduceAdd(CFloat32x16MakeRepeatingElement(0.5)), 8.0)
+  }
+
+  func testReduceMinimum() {
+    XCTAssertEqual(CFloat32x16ReduceMinimum(make([4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, -2, 1, 2])), -2)
+    XCTAssertEqual(CFloat32x16ReduceMinimum(CFloat32x16MakeRepeatingElement(3)), 3)
+  }
+
+  func testReduceMaximum() {
+    XCTAssertEqual(CFloat32x16ReduceMaximum(make([4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 48, 1, 2])), 48)
+    XCTAssertEqual(CFloat32x16ReduceMaximum(CFloat32x16MakeRepeatingElement(-3)), -3)
+  }
+
+  func testReduceIgnoresLaneOrder() {
+    let ascending = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let descending = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+
+    XCTAssertEqual(CFloat32x16ReduceAdd(ascending), CFloat32x16ReduceAdd(descending))
+    XCTAssertEqual(CFloat32x16ReduceMinimum(ascending), CFloat32x16ReduceMinimum(descending))
+    XCTAssertEqual(CFloat32x16ReduceMaximum(ascending), CFloat32x16ReduceMaximum(descending))
+  }
+}
@@ -56,8 +56,40 @@ final class CFloat32x2Tests: XCTestCase {
     XCTAssertEqual(CFloat32x2GetElement(storage, 1), 6)
   }
 
+  func testExtractLane() {
+    let collection = CFloat32x2Make(1, 2)
+
+    XCTAssertEqual(CFloat32x2ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat32x2ExtractLane(collection, 1), 2)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat32x2Make(1, 2)
+
+    collection = CFloat32x2InsertLane(collection, 0, 5)
+    collection = CFloat32x2InsertLane(collection, 1, 6)
+
+    XCTAssertEqual(CFloat32x2GetElement(collection, 0), 5)
+    XCTAssertEqual(CFloat32x2GetElement(collection, 1), 6)
+  }
+
   // MARK: Comparison
 
+  func testEqual() {
+    let storage = CFloat32x2Make(0, 1)
+
+    XCTAssertTrue(CFloat32x2Equal(storage, CFloat32x2Make(-0.0, 1)))
+    XCTAssertFalse(CFloat32x2Equal(storage, CFloat32x2Make(0, 4)))
+    XCTAssertFalse(CFloat32x2Equal(CFloat32x2Make(.nan, 1), CFloat32x2Make(.nan, 1)))
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat32x2Canonicalize(CFloat32x2Make(-0.0, -.nan))
+
+    XCTAssertEqual(CFloat32x2GetElement(storage, 0).bitPattern, Float(0).bitPattern)
+    XCTAssertEqual(CFloat32x2GetElement(storage, 1).bitPattern, Float.nan.bitPattern)
+  }
+
   func testMinimum() {
     let lhs = CFloat32x2Make(34, 12)
     let rhs = CFloat32x2Make(-34, 24)
@@ -138,6 +170,45 @@ final class CFloat32x2Tests: XCTestCase {
     XCTAssertEqual(CFloat32x2GetElement(storage, 1), 12)
   }
 
+  func testArithmeticWithElement() {
+    let lhs = CFloat32x2Make(1, -6)
+
+    let sum = CFloat32x2AddElement(lhs, 2)
+    XCTAssertEqual(CFloat32x2GetElement(sum, 0), 3)
+    XCTAssertEqual(CFloat32x2GetElement(sum, 1), -4)
+
+    let difference = CFloat32x2SubtractElement(lhs, 2)
+    XCTAssertEqual(CFloat32x2GetElement(difference, 0), -1)
+    XCTAssertEqual(CFloat32x2GetElement(difference, 1), -8)
+
+    let product = CFloat32x2MultiplyElement(lhs, 2)
+    XCTAssertEqual(CFloat32x2GetElement(product, 0), 2)
+    XCTAssertEqual(CFloat32x2GetElement(product, 1), -12)
+
+    let quotient = CFloat32x2DivideElement(lhs, 2)
+    XCTAssertEqual(CFloat32x2GetElement(quotient, 0), 0.5)
+    XCTAssertEqual(CFloat32x2GetElement(quotient, 1), -3)
+  }
+
+  func testMultiplyAdd() {
+    let lhs = CFloat32x2Make(1, -6)
+    let rhs = CFloat32x2Make(2, 2)
+    let addend = CFloat32x2Make(0.5, 1)
+    let storage = CFloat32x2MultiplyAdd(lhs, rhs, addend)
+
+    XCTAssertEqual(CFloat32x2GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat32x2GetElement(storage, 1), -11)
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat32x2Make(1, -6)
+    let addend = CFloat32x2Make(0.5, 1)
+    let storage = CFloat32x2MultiplyElementAdd(lhs, 2, addend)
+
+    XCTAssertEqual(CFloat32x2GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat32x2GetElement(storage, 1), -11)
+  }
+
   // MARK: Conversion
 
   func testConvertFromFloat64x2() {
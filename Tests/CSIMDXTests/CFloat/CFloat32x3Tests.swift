@@ -63,6 +63,27 @@ final class CFloat32x3Tests: XCTestCase {
     XCTAssertEqual(CFloat32x3GetElement(collection, 1), 6)
     XCTAssertEqual(CFloat32x3GetElement(collection, 2), 7)
   }
+
+  func testExtractLane() {
+    let collection = CFloat32x3Make(1, 2, 3)
+
+    XCTAssertEqual(CFloat32x3ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat32x3ExtractLane(collection, 1), 2)
+    XCTAssertEqual(CFloat32x3ExtractLane(collection, 2), 3)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat32x3Make(1, 2, 3)
+
+    collection = CFloat32x3InsertLane(collection, 0, 5)
+    collection = CFloat32x3InsertLane(collection, 1, 6)
+    collection = CFloat32x3InsertLane(collection, 2, 7)
+
+    XCTAssertEqual(CFloat32x3GetElement(collection, 0), 5)
+    XCTAssertEqual(CFloat32x3GetElement(collection, 1), 6)
+    XCTAssertEqual(CFloat32x3GetElement(collection, 2), 7)
+    XCTAssertEqual(CFloat32x3GetElement(collection, 3), 0)
+  }
   
   // MARK: Conversion
   
@@ -86,6 +107,22 @@ final class CFloat32x3Tests: XCTestCase {
   
   // MARK: Comparison
   
+  func testEqual() {
+    let storage = CFloat32x3Make(0, 1, 2)
+
+    XCTAssertTrue(CFloat32x3Equal(storage, CFloat32x3Make(-0.0, 1, 2)))
+    XCTAssertFalse(CFloat32x3Equal(storage, CFloat32x3Make(0, 1, 4)))
+    XCTAssertFalse(CFloat32x3Equal(CFloat32x3Make(0, 1, .nan), CFloat32x3Make(0, 1, .nan)))
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat32x3Canonicalize(CFloat32x3Make(-0.0, -.nan, .signalingNaN))
+
+    XCTAssertEqual(CFloat32x3GetElement(storage, 0).bitPattern, Float(0).bitPattern)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 1).bitPattern, Float.nan.bitPattern)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 2).bitPattern, Float.nan.bitPattern)
+  }
+
   func testMinimum() {
     let lhs = CFloat32x3Make(34, 12, 0)
     let rhs = CFloat32x3Make(-34, 24, -0)
@@ -173,4 +210,111 @@ final class CFloat32x3Tests: XCTestCase {
     XCTAssertEqual(CFloat32x3GetElement(storage, 1), 12)
     XCTAssertEqual(CFloat32x3GetElement(storage, 2), 8)
   }
+
+  func testArithmeticWithElement() {
+    let lhs = CFloat32x3Make(1, -6, -3)
+
+    let sum = CFloat32x3AddElement(lhs, 2)
+    XCTAssertEqual(CFloat32x3GetElement(sum, 0), 3)
+    XCTAssertEqual(CFloat32x3GetElement(sum, 1), -4)
+    XCTAssertEqual(CFloat32x3GetElement(sum, 2), -1)
+
+    let difference = CFloat32x3SubtractElement(lhs, 2)
+    XCTAssertEqual(CFloat32x3GetElement(difference, 0), -1)
+    XCTAssertEqual(CFloat32x3GetElement(difference, 1), -8)
+    XCTAssertEqual(CFloat32x3GetElement(difference, 2), -5)
+
+    let product = CFloat32x3MultiplyElement(lhs, 2)
+    XCTAssertEqual(CFloat32x3GetElement(product, 0), 2)
+    XCTAssertEqual(CFloat32x3GetElement(product, 1), -12)
+    XCTAssertEqual(CFloat32x3GetElement(product, 2), -6)
+
+    let quotient = CFloat32x3DivideElement(lhs, 2)
+    XCTAssertEqual(CFloat32x3GetElement(quotient, 0), 0.5)
+    XCTAssertEqual(CFloat32x3GetElement(quotient, 1), -3)
+    XCTAssertEqual(CFloat32x3GetElement(quotient, 2), -1.5)
+  }
+
+  func testMultiplyAdd() {
+    let lhs = CFloat32x3Make(1, -6, -3)
+    let rhs = CFloat32x3Make(2, 2, -1)
+    let addend = CFloat32x3Make(0.5, 1, -2)
+    let storage = CFloat32x3MultiplyAdd(lhs, rhs, addend)
+
+    XCTAssertEqual(CFloat32x3GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 1), -11)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 2), 1)
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat32x3Make(1, -6, -3)
+    let addend = CFloat32x3Make(0.5, 1, -2)
+    let storage = CFloat32x3MultiplyElementAdd(lhs, 2, addend)
+
+    XCTAssertEqual(CFloat32x3GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 1), -11)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 2), -8)
+  }
+  
+  // MARK: Geometry
+  
+  func testDot() {
+    let lhs = CFloat32x3Make(1, 2, 3)
+    let rhs = CFloat32x3Make(4, 5, 6)
+    
+    XCTAssertEqual(CFloat32x3Dot(lhs, rhs), 32)
+  }
+  
+  func testCross() {
+    let lhs = CFloat32x3Make(1, 2, 3)
+    let rhs = CFloat32x3Make(4, 5, 6)
+    let cross = CFloat32x3Cross(lhs, rhs)
+    
+    XCTAssertEqual(CFloat32x3GetElement(cross, 0), -3)
+    XCTAssertEqual(CFloat32x3GetElement(cross, 1), 6)
+    XCTAssertEqual(CFloat32x3GetElement(cross, 2), -3)
+    XCTAssertEqual(CFloat32x3GetElement(cross, 3), 0)
+  }
+  
+  func testLength() {
+    let storage = CFloat32x3Make(2, 3, 6)
+    
+    XCTAssertEqual(CFloat32x3LengthSquared(storage), 49)
+    XCTAssertEqual(CFloat32x3Length(storage), 7)
+    XCTAssertEqual(CFloat32x3Distance(storage, CFloat32x3Make(2, 3, 0)), 6)
+  }
+  
+  func testNormalize() {
+    let storage = CFloat32x3Normalize(CFloat32x3Make(2, 3, 6))
+    
+    XCTAssertEqual(CFloat32x3GetElement(storage, 0), 2 / 7, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 1), 3 / 7, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 2), 6 / 7, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 3), 0)
+  }
+  
+  func testFastNormalize() {
+    let storage = CFloat32x3FastNormalize(CFloat32x3Make(2, 3, 6))
+    
+    XCTAssertEqual(CFloat32x3GetElement(storage, 0), 2 / 7, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 1), 3 / 7, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 2), 6 / 7, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 3), 0)
+  }
+  
+  func testReflect() {
+    let storage = CFloat32x3Reflect(CFloat32x3Make(1, -1, 0), CFloat32x3Make(0, 1, 0))
+    
+    XCTAssertEqual(CFloat32x3GetElement(storage, 0), 1)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 1), 1)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 2), 0)
+  }
+  
+  func testProject() {
+    let storage = CFloat32x3Project(CFloat32x3Make(3, 4, 5), CFloat32x3Make(0, 2, 0))
+    
+    XCTAssertEqual(CFloat32x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 1), 4)
+    XCTAssertEqual(CFloat32x3GetElement(storage, 2), 0)
+  }
 }
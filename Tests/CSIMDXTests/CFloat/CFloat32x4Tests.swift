@@ -72,6 +72,29 @@ final class CFloat32x4Tests: XCTestCase {
     XCTAssertEqual(CFloat32x4GetElement(collection, 3), 8)
   }
 
+  func testExtractLane() {
+    let collection = CFloat32x4Make(1, 2, 3, 4)
+
+    XCTAssertEqual(CFloat32x4ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat32x4ExtractLane(collection, 1), 2)
+    XCTAssertEqual(CFloat32x4ExtractLane(collection, 2), 3)
+    XCTAssertEqual(CFloat32x4ExtractLane(collection, 3), 4)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat32x4Make(1, 2, 3, 4)
+
+    collection = CFloat32x4InsertLane(collection, 0, 5)
+    collection = CFloat32x4InsertLane(collection, 1, 6)
+    collection = CFloat32x4InsertLane(collection, 2, 7)
+    collection = CFloat32x4InsertLane(collection, 3, 8)
+
+    XCTAssertEqual(CFloat32x4GetElement(collection, 0), 5)
+    XCTAssertEqual(CFloat32x4GetElement(collection, 1), 6)
+    XCTAssertEqual(CFloat32x4GetElement(collection, 2), 7)
+    XCTAssertEqual(CFloat32x4GetElement(collection, 3), 8)
+  }
+
   // MARK: Conversion
 
   //    func testConvertFromInt32x4() {
@@ -96,6 +119,56 @@ final class CFloat32x4Tests: XCTestCase {
 
   // MARK: Comparison
 
+  func testEqual() {
+    let storage = CFloat32x4Make(0, 1, 2, 3)
+
+    XCTAssertTrue(CFloat32x4Equal(storage, CFloat32x4Make(-0.0, 1, 2, 3)))
+    XCTAssertFalse(CFloat32x4Equal(storage, CFloat32x4Make(0, 1, 2, 4)))
+    XCTAssertFalse(CFloat32x4Equal(CFloat32x4Make(0, 1, .nan, 3), CFloat32x4Make(0, 1, .nan, 3)))
+  }
+
+  func testCompare() {
+    let lhs = CFloat32x4Make(0, 1, .nan, 3)
+    let rhs = CFloat32x4Make(-0.0, 2, .nan, 2)
+
+    let equal = CFloat32x4CompareEqual(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(equal, 0), -1)
+    XCTAssertEqual(CInt32x4GetElement(equal, 1), 0)
+    XCTAssertEqual(CInt32x4GetElement(equal, 2), 0)
+    XCTAssertEqual(CInt32x4GetElement(equal, 3), 0)
+
+    let lessThan = CFloat32x4CompareLessThan(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 0), 0)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 1), -1)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 2), 0)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 3), 0)
+
+    let lessThanOrEqual = CFloat32x4CompareLessThanOrEqual(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 0), -1)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 1), -1)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 2), 0)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 3), 0)
+  }
+
+  func testSelect() {
+    let mask = CInt32x4Make(-1, 0, 0, -1)
+    let storage = CFloat32x4Select(mask, CFloat32x4Make(1, 2, 3, 4), CFloat32x4Make(5, 6, 7, 8))
+
+    XCTAssertEqual(CFloat32x4GetElement(storage, 0), 1)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 1), 6)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 2), 7)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 3), 4)
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat32x4Canonicalize(CFloat32x4Make(-0.0, -.nan, .signalingNaN, 3))
+
+    XCTAssertEqual(CFloat32x4GetElement(storage, 0).bitPattern, Float(0).bitPattern)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 1).bitPattern, Float.nan.bitPattern)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 2).bitPattern, Float.nan.bitPattern)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 3), 3)
+  }
+
   func testMinimum() {
     let lhs = CFloat32x4Make(34, 12, 0, 23.0)
     let rhs = CFloat32x4Make(-34, 24, -0, 23.1)
@@ -118,6 +191,28 @@ final class CFloat32x4Tests: XCTestCase {
     XCTAssertEqual(CFloat32x4GetElement(storage, 3), 23.1)
   }
 
+  func testIEEEMinimum() {
+    let lhs = CFloat32x4Make(.nan, 12, 0, -0)
+    let rhs = CFloat32x4Make(-34, .nan, -0, 0)
+    let storage = CFloat32x4IEEEMinimum(lhs, rhs)
+
+    XCTAssertTrue(CFloat32x4GetElement(storage, 0).isNaN)
+    XCTAssertTrue(CFloat32x4GetElement(storage, 1).isNaN)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 2).bitPattern, Float(-0.0).bitPattern)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 3).bitPattern, Float(-0.0).bitPattern)
+  }
+
+  func testIEEEMaximum() {
+    let lhs = CFloat32x4Make(.nan, 12, 0, -0)
+    let rhs = CFloat32x4Make(-34, .nan, -0, 0)
+    let storage = CFloat32x4IEEEMaximum(lhs, rhs)
+
+    XCTAssertTrue(CFloat32x4GetElement(storage, 0).isNaN)
+    XCTAssertTrue(CFloat32x4GetElement(storage, 1).isNaN)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 2).bitPattern, Float(0.0).bitPattern)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 3).bitPattern, Float(0.0).bitPattern)
+  }
+
   // MARK: Arithmetic
 
   func testMagnitude() {
@@ -138,6 +233,7 @@ final class CFloat32x4Tests: XCTestCase {
     XCTAssertEqual(CFloat32x4GetElement(negate, 1), 0)
     XCTAssertEqual(CFloat32x4GetElement(negate, 2), -3)
     XCTAssertEqual(CFloat32x4GetElement(negate, 3), 4)
+    XCTAssertEqual(CFloat32x4GetElement(negate, 1).sign, .minus)
   }
 
   func testAdd() {
@@ -193,4 +289,60 @@ final class CFloat32x4Tests: XCTestCase {
     XCTAssertEqual(CFloat32x4GetElement(storage, 2), 8)
     XCTAssertEqual(CFloat32x4GetElement(storage, 3), 16)
   }
+
+  func testArithmeticWithElement() {
+    let lhs = CFloat32x4Make(1, -6, -3, 4)
+
+    let sum = CFloat32x4AddElement(lhs, 2)
+    XCTAssertEqual(CFloat32x4GetElement(sum, 0), 3)
+    XCTAssertEqual(CFloat32x4GetElement(sum, 1), -4)
+    XCTAssertEqual(CFloat32x4GetElement(sum, 2), -1)
+    XCTAssertEqual(CFloat32x4GetElement(sum, 3), 6)
+
+    let difference = CFloat32x4SubtractElement(lhs, 2)
+    XCTAssertEqual(CFloat32x4GetElement(difference, 0), -1)
+    XCTAssertEqual(CFloat32x4GetElement(difference, 1), -8)
+    XCTAssertEqual(CFloat32x4GetElement(difference, 2), -5)
+    XCTAssertEqual(CFloat32x4GetElement(difference, 3), 2)
+
+    let product = CFloat32x4MultiplyElement(lhs, 2)
+    XCTAssertEqual(CFloat32x4GetElement(product, 0), 2)
+    XCTAssertEqual(CFloat32x4GetElement(product, 1), -12)
+    XCTAssertEqual(CFloat32x4GetElement(product, 2), -6)
+    XCTAssertEqual(CFloat32x4GetElement(product, 3), 8)
+
+    let quotient = CFloat32x4DivideElement(lhs, 2)
+    XCTAssertEqual(CFloat32x4GetElement(quotient, 0), 0.5)
+    XCTAssertEqual(CFloat32x4GetElement(quotient, 1), -3)
+    XCTAssertEqual(CFloat32x4GetElement(quotient, 2), -1.5)
+    XCTAssertEqual(CFloat32x4GetElement(quotient, 3), 2)
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat32x4Make(1, -6, -3, 4)
+    let addend = CFloat32x4Make(0.5, 1, -2, 3)
+    let storage = CFloat32x4MultiplyElementAdd(lhs, 2, addend)
+
+    XCTAssertEqual(CFloat32x4GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 1), -11)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 2), -8)
+    XCTAssertEqual(CFloat32x4GetElement(storage, 3), 11)
+  }
+
+  func testReinterpret() {
+    let storage = CFloat32x4Make(1, -2, 0, -.infinity)
+    let bits = CFloat32x4ReinterpretAsCUInt32x4(storage)
+    XCTAssertEqual(CUInt32x4GetElement(bits, 0), 0x3F80_0000)
+    XCTAssertEqual(CUInt32x4GetElement(bits, 1), 0xC000_0000)
+    XCTAssertEqual(CUInt32x4GetElement(bits, 2), 0)
+    XCTAssertEqual(CUInt32x4GetElement(bits, 3), 0xFF80_0000)
+
+    let roundTrip = CInt32x4ReinterpretAsCFloat32x4(CFloat32x4ReinterpretAsCInt32x4(storage))
+    XCTAssertEqual(CFloat32x4GetElement(roundTrip, 1), -2)
+    XCTAssertEqual(CFloat32x4GetElement(roundTrip, 3), -.infinity)
+
+    let float64Storage = CFloat32x4ReinterpretAsCFloat64x2(CFloat32x4Make(0, 1.875, 0, -2))
+    XCTAssertEqual(CFloat64x2GetElement(float64Storage, 0), 1)
+    XCTAssertEqual(CFloat64x2GetElement(float64Storage, 1), -2)
+  }
 }
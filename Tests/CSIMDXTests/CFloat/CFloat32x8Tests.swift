@@ -0,0 +1,245 @@
+import XCTest
+import CSIMDX
+
+final class CFloat32x8Tests: XCTestCase {
+
+  private func elements(of storage: CFloat32x8) -> [Float32] {
+    (0 ..< CInt(8)).map { CFloat32x8GetElement(storage, $0) }
+  }
+
+  private func lanes(of mask: CInt32x8) -> [Int32] {
+    (0 ..< CInt(8)).map { CInt32x8GetElement(mask, $0) }
+  }
+
+  // MARK: Make
+
+  func testMake() {
+    let collection = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertEqual(elements(of: collection), [1, 2, 3, 4, 5, 6, 7, 8])
+  }
+
+  func testMakeLoad() {
+    var array: [Float32] = [1, 2, 3, 4, 5, 6, 7, 8]
+    let collection = CFloat32x8MakeLoad(&array)
+
+    XCTAssertEqual(elements(of: collection), array)
+  }
+
+  func testMakeRepeatingElement() {
+    let collection = CFloat32x8MakeRepeatingElement(3)
+
+    XCTAssertEqual(elements(of: collection), [Float32](repeating: 3, count: 8))
+  }
+
+  func testMakeZero() {
+    let collection = CFloat32x8MakeZero()
+
+    XCTAssertEqual(elements(of: collection), [Float32](repeating: 0, count: 8))
+  }
+
+  // MARK: Access
+
+  func testGetLowAndHigh() {
+    let collection = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let low = CFloat32x8GetLow(collection)
+    let high = CFloat32x8GetHigh(collection)
+
+    XCTAssertEqual(CFloat32x4GetElement(low, 0), 1)
+    XCTAssertEqual(CFloat32x4GetElement(low, 1), 2)
+    XCTAssertEqual(CFloat32x4GetElement(low, 2), 3)
+    XCTAssertEqual(CFloat32x4GetElement(low, 3), 4)
+    XCTAssertEqual(CFloat32x4GetElement(high, 0), 5)
+    XCTAssertEqual(CFloat32x4GetElement(high, 1), 6)
+    XCTAssertEqual(CFloat32x4GetElement(high, 2), 7)
+    XCTAssertEqual(CFloat32x4GetElement(high, 3), 8)
+  }
+
+  func testSetElement() {
+    var collection = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    for lane in 0 ..< CInt(8) {
+      CFloat32x8SetElement(&collection, lane, Float32(lane) + 9)
+    }
+
+    XCTAssertEqual(elements(of: collection), [9, 10, 11, 12, 13, 14, 15, 16])
+  }
+
+  func testExtractLane() {
+    let collection = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 1), 2)
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 2), 3)
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 3), 4)
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 4), 5)
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 5), 6)
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 6), 7)
+    XCTAssertEqual(CFloat32x8ExtractLane(collection, 7), 8)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    collection = CFloat32x8InsertLane(collection, 0, 9)
+    collection = CFloat32x8InsertLane(collection, 1, 10)
+    collection = CFloat32x8InsertLane(collection, 2, 11)
+    collection = CFloat32x8InsertLane(collection, 3, 12)
+    collection = CFloat32x8InsertLane(collection, 4, 13)
+    collection = CFloat32x8InsertLane(collection, 5, 14)
+    collection = CFloat32x8InsertLane(collection, 6, 15)
+    collection = CFloat32x8InsertLane(collection, 7, 16)
+
+    XCTAssertEqual(elements(of: collection), [9, 10, 11, 12, 13, 14, 15, 16])
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = CFloat32x8Make(0, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertTrue(CFloat32x8Equal(storage, CFloat32x8Make(-0.0, 2, 3, 4, 5, 6, 7, 8)))
+    XCTAssertFalse(CFloat32x8Equal(storage, CFloat32x8Make(0, 2, 3, 4, 5, 6, 7, 9)))
+    XCTAssertFalse(CFloat32x8Equal(CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, .nan), CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, .nan)))
+  }
+
+  func testCompare() {
+    let lhs = CFloat32x8Make(0, 1, .nan, 3, -1, 5, 6, .infinity)
+    let rhs = CFloat32x8Make(-0.0, 2, .nan, 2, -1, 4, 7, .infinity)
+
+    XCTAssertEqual(lanes(of: CFloat32x8CompareEqual(lhs, rhs)), [-1, 0, 0, 0, -1, 0, 0, -1])
+    XCTAssertEqual(lanes(of: CFloat32x8CompareLessThan(lhs, rhs)), [0, -1, 0, 0, 0, 0, -1, 0])
+    XCTAssertEqual(lanes(of: CFloat32x8CompareLessThanOrEqual(lhs, rhs)), [-1, -1, 0, 0, -1, 0, -1, -1])
+  }
+
+  func testSelect() {
+    let mask = CInt32x8Make(-1, 0, 0, -1, 0, -1, -1, 0)
+    let storage = CFloat32x8Select(mask, CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8), CFloat32x8Make(9, 10, 11, 12, 13, 14, 15, 16))
+
+    XCTAssertEqual(elements(of: storage), [1, 10, 11, 4, 13, 6, 7, 16])
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat32x8Canonicalize(CFloat32x8Make(-0.0, -.nan, .signalingNaN, 4, 5, 6, 7, 8))
+    let elements = self.elements(of: storage)
+
+    XCTAssertEqual(elements[0].bitPattern, Float32(0).bitPattern)
+    XCTAssertEqual(elements[1].bitPattern, Float32.nan.bitPattern)
+    XCTAssertEqual(elements[2].bitPattern, Float32.nan.bitPattern)
+    XCTAssertEqual(Array(elements[3...]), [4, 5, 6, 7, 8])
+  }
+
+  func testMinimum() {
+    let lhs = CFloat32x8Make(34, 12, 0, 23.0, 34, 12, 0, 23.0)
+    let rhs = CFloat32x8Make(-34, 24, -0, 23.5, -34, 24, -0, 23.5)
+    let storage = CFloat32x8Minimum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [-34, 12, 0, 23.0, -34, 12, 0, 23.0])
+  }
+
+  func testMaximum() {
+    let lhs = CFloat32x8Make(34, 12, 0, 23.0, 34, 12, 0, 23.0)
+    let rhs = CFloat32x8Make(-34, 24, -0, 23.5, -34, 24, -0, 23.5)
+    let storage = CFloat32x8Maximum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [34, 24, 0, 23.5, 34, 24, 0, 23.5])
+  }
+
+  // MARK: Arithmetic
+
+  func testMagnitude() {
+    let normal = CFloat32x8Make(-1, 0, 3, -4, -1, 0, 3, -4)
+
+    XCTAssertEqual(elements(of: CFloat32x8Magnitude(normal)), [1, 0, 3, 4, 1, 0, 3, 4])
+  }
+
+  func testNegate() {
+    let normal = CFloat32x8Make(-1, 0, 3, -4, -1, 0, 3, -4)
+
+    XCTAssertEqual(elements(of: CFloat32x8Negate(normal)), [1, 0, -3, 4, 1, 0, -3, 4])
+  }
+
+  func testAdd() {
+    let lhs = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CFloat32x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+
+    XCTAssertEqual(elements(of: CFloat32x8Add(lhs, rhs)), [Float32](repeating: 9, count: 8))
+  }
+
+  func testSubtract() {
+    let lhs = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CFloat32x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+
+    XCTAssertEqual(elements(of: CFloat32x8Subtract(lhs, rhs)), [-7, -5, -3, -1, 1, 3, 5, 7])
+  }
+
+  func testMultiply() {
+    let lhs = CFloat32x8Make(1, -2, -3, 4, 1, -2, -3, 4)
+    let rhs = CFloat32x8Make(4, -3, 2, -1, 4, -3, 2, -1)
+
+    XCTAssertEqual(elements(of: CFloat32x8Multiply(lhs, rhs)), [4, 6, -6, -4, 4, 6, -6, -4])
+  }
+
+  func testDivide() {
+    let lhs = CFloat32x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+    let rhs = CFloat32x8Make(-4, -3, 3, 2, -4, -3, 3, 2)
+
+    XCTAssertEqual(elements(of: CFloat32x8Divide(lhs, rhs)), [-0.25, 2, -1, 2, -0.25, 2, -1, 2])
+  }
+
+  func testSquareRoot() {
+    let storage = CFloat32x8SquareRoot(CFloat32x8Make(25, 144, 64, 256, 25, 144, 64, 256))
+
+    XCTAssertEqual(elements(of: storage), [5, 12, 8, 16, 5, 12, 8, 16])
+  }
+
+  func testArithmeticWithElement() {
+    let lhs = CFloat32x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+
+    XCTAssertEqual(elements(of: CFloat32x8AddElement(lhs, 2)), [3, -4, -1, 6, 3, -4, -1, 6])
+    XCTAssertEqual(elements(of: CFloat32x8SubtractElement(lhs, 2)), [-1, -8, -5, 2, -1, -8, -5, 2])
+    XCTAssertEqual(elements(of: CFloat32x8MultiplyElement(lhs, 2)), [2, -12, -6, 8, 2, -12, -6, 8])
+    XCTAssertEqual(elements(of: CFloat32x8DivideElement(lhs, 2)), [0.5, -3, -1.5, 2, 0.5, -3, -1.5, 2])
+  }
+
+  func testMultiplyAdd() {
+    let lhs = CFloat32x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+    let rhs = CFloat32x8Make(2, 2, -1, 0.5, 2, 2, -1, 0.5)
+    let addend = CFloat32x8Make(0.5, 1, -2, 3, 0.5, 1, -2, 3)
+
+    XCTAssertEqual(elements(of: CFloat32x8MultiplyAdd(lhs, rhs, addend)), [2.5, -11, 1, 5, 2.5, -11, 1, 5])
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat32x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+    let addend = CFloat32x8Make(0.5, 1, -2, 3, 0.5, 1, -2, 3)
+
+    XCTAssertEqual(elements(of: CFloat32x8MultiplyElementAdd(lhs, 2, addend)), [2.5, -11, -8, 11, 2.5, -11, -8, 11])
+  }
+
+  // MARK: Reduction
+
+  func testReduceAdd() {
+    XCTAssertEqual(CFloat32x8ReduceAdd(CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)), 36)
+    XCTAssertEqual(CFloat32x8ReduceAdd(CFloat32x8MakeRepeatingElement(0.5)), 4.0)
+  }
+
+  func testReduceMinimum() {
+    XCTAssertEqual(CFloat32x8ReduceMinimum(CFloat32x8Make(4, 5, 6, 7, 8, -2, 1, 2)), -2)
+    XCTAssertEqual(CFloat32x8ReduceMinimum(CFloat32x8MakeRepeatingElement(3)), 3)
+  }
+
+  func testReduceMaximum() {
+    XCTAssertEqual(CFloat32x8ReduceMaximum(CFloat32x8Make(4, 5, 6, 7, 8, 24, 1, 2)), 24)
+    XCTAssertEqual(CFloat32x8ReduceMaximum(CFloat32x8MakeRepeatingElement(-3)), -3)
+  }
+
+  func testReduceIgnoresLaneOrder() {
+    let ascending = CFloat32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let descending = CFloat32x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+
+    XCTAssertEqual(CFloat32x8ReduceAdd(ascending), CFloat32x8ReduceAdd(descending))
+    XCTAssertEqual(CFloat32x8ReduceMinimum(ascending), CFloat32x8ReduceMinimum(descending))
+    XCTAssertEqual(CFloat32x8ReduceMaximum(ascending), CFloat32x8ReduceMaximum(descending))
+  }
+}
@@ -56,8 +56,40 @@ final class CFloat64x2Tests: XCTestCase {
     XCTAssertEqual(CFloat64x2GetElement(collection, 1), 6)
   }
 
+  func testExtractLane() {
+    let collection = CFloat64x2Make(1, 2)
+
+    XCTAssertEqual(CFloat64x2ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat64x2ExtractLane(collection, 1), 2)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat64x2Make(1, 2)
+
+    collection = CFloat64x2InsertLane(collection, 0, 5)
+    collection = CFloat64x2InsertLane(collection, 1, 6)
+
+    XCTAssertEqual(CFloat64x2GetElement(collection, 0), 5)
+    XCTAssertEqual(CFloat64x2GetElement(collection, 1), 6)
+  }
+
   // MARK: Comparison
 
+  func testEqual() {
+    let storage = CFloat64x2Make(0, 1)
+
+    XCTAssertTrue(CFloat64x2Equal(storage, CFloat64x2Make(-0.0, 1)))
+    XCTAssertFalse(CFloat64x2Equal(storage, CFloat64x2Make(0, 4)))
+    XCTAssertFalse(CFloat64x2Equal(CFloat64x2Make(.nan, 1), CFloat64x2Make(.nan, 1)))
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat64x2Canonicalize(CFloat64x2Make(-0.0, -.nan))
+
+    XCTAssertEqual(CFloat64x2GetElement(storage, 0).bitPattern, Double(0).bitPattern)
+    XCTAssertEqual(CFloat64x2GetElement(storage, 1).bitPattern, Double.nan.bitPattern)
+  }
+
   func testMinimum() {
     let lhs = CFloat64x2Make(34, 12)
     let rhs = CFloat64x2Make(-34, 24)
@@ -76,6 +108,20 @@ final class CFloat64x2Tests: XCTestCase {
     XCTAssertEqual(CFloat64x2GetElement(storage, 1), 24)
   }
 
+  func testIEEEMinimum() {
+    let storage = CFloat64x2IEEEMinimum(CFloat64x2Make(.nan, 0), CFloat64x2Make(-34, -0))
+
+    XCTAssertTrue(CFloat64x2GetElement(storage, 0).isNaN)
+    XCTAssertEqual(CFloat64x2GetElement(storage, 1).bitPattern, Double(-0.0).bitPattern)
+  }
+
+  func testIEEEMaximum() {
+    let storage = CFloat64x2IEEEMaximum(CFloat64x2Make(34, -0), CFloat64x2Make(.nan, 0))
+
+    XCTAssertTrue(CFloat64x2GetElement(storage, 0).isNaN)
+    XCTAssertEqual(CFloat64x2GetElement(storage, 1).bitPattern, Double(0.0).bitPattern)
+  }
+
   // MARK: Arithmetic
 
   func testMagnitude() {
@@ -138,6 +184,45 @@ final class CFloat64x2Tests: XCTestCase {
     XCTAssertEqual(CFloat64x2GetElement(storage, 1), 12)
   }
 
+  func testArithmeticWithElement() {
+    let lhs = CFloat64x2Make(1, -6)
+
+    let sum = CFloat64x2AddElement(lhs, 2)
+    XCTAssertEqual(CFloat64x2GetElement(sum, 0), 3)
+    XCTAssertEqual(CFloat64x2GetElement(sum, 1), -4)
+
+    let difference = CFloat64x2SubtractElement(lhs, 2)
+    XCTAssertEqual(CFloat64x2GetElement(difference, 0), -1)
+    XCTAssertEqual(CFloat64x2GetElement(difference, 1), -8)
+
+    let product = CFloat64x2MultiplyElement(lhs, 2)
+    XCTAssertEqual(CFloat64x2GetElement(product, 0), 2)
+    XCTAssertEqual(CFloat64x2GetElement(product, 1), -12)
+
+    let quotient = CFloat64x2DivideElement(lhs, 2)
+    XCTAssertEqual(CFloat64x2GetElement(quotient, 0), 0.5)
+    XCTAssertEqual(CFloat64x2GetElement(quotient, 1), -3)
+  }
+
+  func testMultiplyAdd() {
+    let lhs = CFloat64x2Make(1, -6)
+    let rhs = CFloat64x2Make(2, 2)
+    let addend = CFloat64x2Make(0.5, 1)
+    let storage = CFloat64x2MultiplyAdd(lhs, rhs, addend)
+
+    XCTAssertEqual(CFloat64x2GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat64x2GetElement(storage, 1), -11)
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat64x2Make(1, -6)
+    let addend = CFloat64x2Make(0.5, 1)
+    let storage = CFloat64x2MultiplyElementAdd(lhs, 2, addend)
+
+    XCTAssertEqual(CFloat64x2GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat64x2GetElement(storage, 1), -11)
+  }
+
   // MARK: Conversion
 
   func testConvertFromFloat32x2() {
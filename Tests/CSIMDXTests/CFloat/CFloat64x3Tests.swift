@@ -63,9 +63,46 @@ final class CFloat64x3Tests: XCTestCase {
     XCTAssertEqual(CFloat64x3GetElement(collection, 1), 6)
     XCTAssertEqual(CFloat64x3GetElement(collection, 2), 7)
   }
+
+  func testExtractLane() {
+    let collection = CFloat64x3Make(1, 2, 3)
+
+    XCTAssertEqual(CFloat64x3ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat64x3ExtractLane(collection, 1), 2)
+    XCTAssertEqual(CFloat64x3ExtractLane(collection, 2), 3)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat64x3Make(1, 2, 3)
+
+    collection = CFloat64x3InsertLane(collection, 0, 5)
+    collection = CFloat64x3InsertLane(collection, 1, 6)
+    collection = CFloat64x3InsertLane(collection, 2, 7)
+
+    XCTAssertEqual(CFloat64x3GetElement(collection, 0), 5)
+    XCTAssertEqual(CFloat64x3GetElement(collection, 1), 6)
+    XCTAssertEqual(CFloat64x3GetElement(collection, 2), 7)
+    XCTAssertEqual(CFloat64x3GetElement(collection, 3), 0)
+  }
   
   // MARK: Comparison
   
+  func testEqual() {
+    let storage = CFloat64x3Make(0, 1, 2)
+
+    XCTAssertTrue(CFloat64x3Equal(storage, CFloat64x3Make(-0.0, 1, 2)))
+    XCTAssertFalse(CFloat64x3Equal(storage, CFloat64x3Make(0, 1, 4)))
+    XCTAssertFalse(CFloat64x3Equal(CFloat64x3Make(0, 1, .nan), CFloat64x3Make(0, 1, .nan)))
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat64x3Canonicalize(CFloat64x3Make(-0.0, -.nan, .signalingNaN))
+
+    XCTAssertEqual(CFloat64x3GetElement(storage, 0).bitPattern, Double(0).bitPattern)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 1).bitPattern, Double.nan.bitPattern)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 2).bitPattern, Double.nan.bitPattern)
+  }
+
   func testMinimum() {
     let lhs = CFloat64x3Make(34, 12, 0)
     let rhs = CFloat64x3Make(-34, 24, -0)
@@ -153,4 +190,111 @@ final class CFloat64x3Tests: XCTestCase {
     XCTAssertEqual(CFloat64x3GetElement(storage, 1), 12)
     XCTAssertEqual(CFloat64x3GetElement(storage, 2), 8)
   }
+
+  func testArithmeticWithElement() {
+    let lhs = CFloat64x3Make(1, -6, -3)
+
+    let sum = CFloat64x3AddElement(lhs, 2)
+    XCTAssertEqual(CFloat64x3GetElement(sum, 0), 3)
+    XCTAssertEqual(CFloat64x3GetElement(sum, 1), -4)
+    XCTAssertEqual(CFloat64x3GetElement(sum, 2), -1)
+
+    let difference = CFloat64x3SubtractElement(lhs, 2)
+    XCTAssertEqual(CFloat64x3GetElement(difference, 0), -1)
+    XCTAssertEqual(CFloat64x3GetElement(difference, 1), -8)
+    XCTAssertEqual(CFloat64x3GetElement(difference, 2), -5)
+
+    let product = CFloat64x3MultiplyElement(lhs, 2)
+    XCTAssertEqual(CFloat64x3GetElement(product, 0), 2)
+    XCTAssertEqual(CFloat64x3GetElement(product, 1), -12)
+    XCTAssertEqual(CFloat64x3GetElement(product, 2), -6)
+
+    let quotient = CFloat64x3DivideElement(lhs, 2)
+    XCTAssertEqual(CFloat64x3GetElement(quotient, 0), 0.5)
+    XCTAssertEqual(CFloat64x3GetElement(quotient, 1), -3)
+    XCTAssertEqual(CFloat64x3GetElement(quotient, 2), -1.5)
+  }
+
+  func testMultiplyAdd() {
+    let lhs = CFloat64x3Make(1, -6, -3)
+    let rhs = CFloat64x3Make(2, 2, -1)
+    let addend = CFloat64x3Make(0.5, 1, -2)
+    let storage = CFloat64x3MultiplyAdd(lhs, rhs, addend)
+
+    XCTAssertEqual(CFloat64x3GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 1), -11)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 2), 1)
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat64x3Make(1, -6, -3)
+    let addend = CFloat64x3Make(0.5, 1, -2)
+    let storage = CFloat64x3MultiplyElementAdd(lhs, 2, addend)
+
+    XCTAssertEqual(CFloat64x3GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 1), -11)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 2), -8)
+  }
+  
+  // MARK: Geometry
+  
+  func testDot() {
+    let lhs = CFloat64x3Make(1, 2, 3)
+    let rhs = CFloat64x3Make(4, 5, 6)
+    
+    XCTAssertEqual(CFloat64x3Dot(lhs, rhs), 32)
+  }
+  
+  func testCross() {
+    let lhs = CFloat64x3Make(1, 2, 3)
+    let rhs = CFloat64x3Make(4, 5, 6)
+    let cross = CFloat64x3Cross(lhs, rhs)
+    
+    XCTAssertEqual(CFloat64x3GetElement(cross, 0), -3)
+    XCTAssertEqual(CFloat64x3GetElement(cross, 1), 6)
+    XCTAssertEqual(CFloat64x3GetElement(cross, 2), -3)
+    XCTAssertEqual(CFloat64x3GetElement(cross, 3), 0)
+  }
+  
+  func testLength() {
+    let storage = CFloat64x3Make(2, 3, 6)
+    
+    XCTAssertEqual(CFloat64x3LengthSquared(storage), 49)
+    XCTAssertEqual(CFloat64x3Length(storage), 7)
+    XCTAssertEqual(CFloat64x3Distance(storage, CFloat64x3Make(2, 3, 0)), 6)
+  }
+  
+  func testNormalize() {
+    let storage = CFloat64x3Normalize(CFloat64x3Make(2, 3, 6))
+    
+    XCTAssertEqual(CFloat64x3GetElement(storage, 0), 2 / 7, accuracy: 1e-12)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 1), 3 / 7, accuracy: 1e-12)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 2), 6 / 7, accuracy: 1e-12)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 3), 0)
+  }
+  
+  func testFastNormalize() {
+    let storage = CFloat64x3FastNormalize(CFloat64x3Make(2, 3, 6))
+    
+    XCTAssertEqual(CFloat64x3GetElement(storage, 0), 2 / 7, accuracy: 1e-12)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 1), 3 / 7, accuracy: 1e-12)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 2), 6 / 7, accuracy: 1e-12)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 3), 0)
+  }
+  
+  func testReflect() {
+    let storage = CFloat64x3Reflect(CFloat64x3Make(1, -1, 0), CFloat64x3Make(0, 1, 0))
+    
+    XCTAssertEqual(CFloat64x3GetElement(storage, 0), 1)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 1), 1)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 2), 0)
+  }
+  
+  func testProject() {
+    let storage = CFloat64x3Project(CFloat64x3Make(3, 4, 5), CFloat64x3Make(0, 2, 0))
+    
+    XCTAssertEqual(CFloat64x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 1), 4)
+    XCTAssertEqual(CFloat64x3GetElement(storage, 2), 0)
+  }
 }
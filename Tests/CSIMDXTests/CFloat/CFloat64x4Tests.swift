@@ -71,9 +71,49 @@ final class CFloat64x4Tests: XCTestCase {
     XCTAssertEqual(CFloat64x4GetElement(collection, 2), 7)
     XCTAssertEqual(CFloat64x4GetElement(collection, 3), 8)
   }
+
+  func testExtractLane() {
+    let collection = CFloat64x4Make(1, 2, 3, 4)
+
+    XCTAssertEqual(CFloat64x4ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat64x4ExtractLane(collection, 1), 2)
+    XCTAssertEqual(CFloat64x4ExtractLane(collection, 2), 3)
+    XCTAssertEqual(CFloat64x4ExtractLane(collection, 3), 4)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat64x4Make(1, 2, 3, 4)
+
+    collection = CFloat64x4InsertLane(collection, 0, 5)
+    collection = CFloat64x4InsertLane(collection, 1, 6)
+    collection = CFloat64x4InsertLane(collection, 2, 7)
+    collection = CFloat64x4InsertLane(collection, 3, 8)
+
+    XCTAssertEqual(CFloat64x4GetElement(collection, 0), 5)
+    XCTAssertEqual(CFloat64x4GetElement(collection, 1), 6)
+    XCTAssertEqual(CFloat64x4GetElement(collection, 2), 7)
+    XCTAssertEqual(CFloat64x4GetElement(collection, 3), 8)
+  }
   
   // MARK: Comparison
   
+  func testEqual() {
+    let storage = CFloat64x4Make(0, 1, 2, 3)
+
+    XCTAssertTrue(CFloat64x4Equal(storage, CFloat64x4Make(-0.0, 1, 2, 3)))
+    XCTAssertFalse(CFloat64x4Equal(storage, CFloat64x4Make(0, 1, 2, 4)))
+    XCTAssertFalse(CFloat64x4Equal(CFloat64x4Make(0, 1, .nan, 3), CFloat64x4Make(0, 1, .nan, 3)))
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat64x4Canonicalize(CFloat64x4Make(-0.0, -.nan, .signalingNaN, 3))
+
+    XCTAssertEqual(CFloat64x4GetElement(storage, 0).bitPattern, Double(0).bitPattern)
+    XCTAssertEqual(CFloat64x4GetElement(storage, 1).bitPattern, Double.nan.bitPattern)
+    XCTAssertEqual(CFloat64x4GetElement(storage, 2).bitPattern, Double.nan.bitPattern)
+    XCTAssertEqual(CFloat64x4GetElement(storage, 3), 3)
+  }
+
   func testMinimum() {
     let lhs = CFloat64x4Make(34, 12, 0, 23.0)
     let rhs = CFloat64x4Make(-34, 24, -0, 23.1)
@@ -171,4 +211,43 @@ final class CFloat64x4Tests: XCTestCase {
     XCTAssertEqual(CFloat64x4GetElement(storage, 2), 8)
     XCTAssertEqual(CFloat64x4GetElement(storage, 3), 16)
   }
+
+  func testArithmeticWithElement() {
+    let lhs = CFloat64x4Make(1, -6, -3, 4)
+
+    let sum = CFloat64x4AddElement(lhs, 2)
+    XCTAssertEqual(CFloat64x4GetElement(sum, 0), 3)
+    XCTAssertEqual(CFloat64x4GetElement(sum, 1), -4)
+    XCTAssertEqual(CFloat64x4GetElement(sum, 2), -1)
+    XCTAssertEqual(CFloat64x4GetElement(sum, 3), 6)
+
+    let difference = CFloat64x4SubtractElement(lhs, 2)
+    XCTAssertEqual(CFloat64x4GetElement(difference, 0), -1)
+    XCTAssertEqual(CFloat64x4GetElement(difference, 1), -8)
+    XCTAssertEqual(CFloat64x4GetElement(difference, 2), -5)
+    XCTAssertEqual(CFloat64x4GetElement(difference, 3), 2)
+
+    let product = CFloat64x4MultiplyElement(lhs, 2)
+    XCTAssertEqual(CFloat64x4GetElement(product, 0), 2)
+    XCTAssertEqual(CFloat64x4GetElement(product, 1), -12)
+    XCTAssertEqual(CFloat64x4GetElement(product, 2), -6)
+    XCTAssertEqual(CFloat64x4GetElement(product, 3), 8)
+
+    let quotient = CFloat64x4DivideElement(lhs, 2)
+    XCTAssertEqual(CFloat64x4GetElement(quotient, 0), 0.5)
+    XCTAssertEqual(CFloat64x4GetElement(quotient, 1), -3)
+    XCTAssertEqual(CFloat64x4GetElement(quotient, 2), -1.5)
+    XCTAssertEqual(CFloat64x4GetElement(quotient, 3), 2)
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat64x4Make(1, -6, -3, 4)
+    let addend = CFloat64x4Make(0.5, 1, -2, 3)
+    let storage = CFloat64x4MultiplyElementAdd(lhs, 2, addend)
+
+    XCTAssertEqual(CFloat64x4GetElement(storage, 0), 2.5)
+    XCTAssertEqual(CFloat64x4GetElement(storage, 1), -11)
+    XCTAssertEqual(CFloat64x4GetElement(storage, 2), -8)
+    XCTAssertEqual(CFloat64x4GetElement(storage, 3), 11)
+  }
 }
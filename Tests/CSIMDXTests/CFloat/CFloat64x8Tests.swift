@@ -0,0 +1,245 @@
+import XCTest
+import CSIMDX
+
+final class CFloat64x8Tests: XCTestCase {
+
+  private func elements(of storage: CFloat64x8) -> [Float64] {
+    (0 ..< CInt(8)).map { CFloat64x8GetElement(storage, $0) }
+  }
+
+  private func lanes(of mask: CInt32x8) -> [Int32] {
+    (0 ..< CInt(8)).map { CInt32x8GetElement(mask, $0) }
+  }
+
+  // MARK: Make
+
+  func testMake() {
+    let collection = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertEqual(elements(of: collection), [1, 2, 3, 4, 5, 6, 7, 8])
+  }
+
+  func testMakeLoad() {
+    var array: [Float64] = [1, 2, 3, 4, 5, 6, 7, 8]
+    let collection = CFloat64x8MakeLoad(&array)
+
+    XCTAssertEqual(elements(of: collection), array)
+  }
+
+  func testMakeRepeatingElement() {
+    let collection = CFloat64x8MakeRepeatingElement(3)
+
+    XCTAssertEqual(elements(of: collection), [Float64](repeating: 3, count: 8))
+  }
+
+  func testMakeZero() {
+    let collection = CFloat64x8MakeZero()
+
+    XCTAssertEqual(elements(of: collection), [Float64](repeating: 0, count: 8))
+  }
+
+  // MARK: Access
+
+  func testGetLowAndHigh() {
+    let collection = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let low = CFloat64x8GetLow(collection)
+    let high = CFloat64x8GetHigh(collection)
+
+    XCTAssertEqual(CFloat64x4GetElement(low, 0), 1)
+    XCTAssertEqual(CFloat64x4GetElement(low, 1), 2)
+    XCTAssertEqual(CFloat64x4GetElement(low, 2), 3)
+    XCTAssertEqual(CFloat64x4GetElement(low, 3), 4)
+    XCTAssertEqual(CFloat64x4GetElement(high, 0), 5)
+    XCTAssertEqual(CFloat64x4GetElement(high, 1), 6)
+    XCTAssertEqual(CFloat64x4GetElement(high, 2), 7)
+    XCTAssertEqual(CFloat64x4GetElement(high, 3), 8)
+  }
+
+  func testSetElement() {
+    var collection = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    for lane in 0 ..< CInt(8) {
+      CFloat64x8SetElement(&collection, lane, Float64(lane) + 9)
+    }
+
+    XCTAssertEqual(elements(of: collection), [9, 10, 11, 12, 13, 14, 15, 16])
+  }
+
+  func testExtractLane() {
+    let collection = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 0), 1)
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 1), 2)
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 2), 3)
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 3), 4)
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 4), 5)
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 5), 6)
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 6), 7)
+    XCTAssertEqual(CFloat64x8ExtractLane(collection, 7), 8)
+  }
+
+  func testInsertLane() {
+    var collection = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    collection = CFloat64x8InsertLane(collection, 0, 9)
+    collection = CFloat64x8InsertLane(collection, 1, 10)
+    collection = CFloat64x8InsertLane(collection, 2, 11)
+    collection = CFloat64x8InsertLane(collection, 3, 12)
+    collection = CFloat64x8InsertLane(collection, 4, 13)
+    collection = CFloat64x8InsertLane(collection, 5, 14)
+    collection = CFloat64x8InsertLane(collection, 6, 15)
+    collection = CFloat64x8InsertLane(collection, 7, 16)
+
+    XCTAssertEqual(elements(of: collection), [9, 10, 11, 12, 13, 14, 15, 16])
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = CFloat64x8Make(0, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertTrue(CFloat64x8Equal(storage, CFloat64x8Make(-0.0, 2, 3, 4, 5, 6, 7, 8)))
+    XCTAssertFalse(CFloat64x8Equal(storage, CFloat64x8Make(0, 2, 3, 4, 5, 6, 7, 9)))
+    XCTAssertFalse(CFloat64x8Equal(CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, .nan), CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, .nan)))
+  }
+
+  func testCompare() {
+    let lhs = CFloat64x8Make(0, 1, .nan, 3, -1, 5, 6, .infinity)
+    let rhs = CFloat64x8Make(-0.0, 2, .nan, 2, -1, 4, 7, .infinity)
+
+    XCTAssertEqual(lanes(of: CFloat64x8CompareEqual(lhs, rhs)), [-1, 0, 0, 0, -1, 0, 0, -1])
+    XCTAssertEqual(lanes(of: CFloat64x8CompareLessThan(lhs, rhs)), [0, -1, 0, 0, 0, 0, -1, 0])
+    XCTAssertEqual(lanes(of: CFloat64x8CompareLessThanOrEqual(lhs, rhs)), [-1, -1, 0, 0, -1, 0, -1, -1])
+  }
+
+  func testSelect() {
+    let mask = CInt32x8Make(-1, 0, 0, -1, 0, -1, -1, 0)
+    let storage = CFloat64x8Select(mask, CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8), CFloat64x8Make(9, 10, 11, 12, 13, 14, 15, 16))
+
+    XCTAssertEqual(elements(of: storage), [1, 10, 11, 4, 13, 6, 7, 16])
+  }
+
+  func testCanonicalize() {
+    let storage = CFloat64x8Canonicalize(CFloat64x8Make(-0.0, -.nan, .signalingNaN, 4, 5, 6, 7, 8))
+    let elements = self.elements(of: storage)
+
+    XCTAssertEqual(elements[0].bitPattern, Float64(0).bitPattern)
+    XCTAssertEqual(elements[1].bitPattern, Float64.nan.bitPattern)
+    XCTAssertEqual(elements[2].bitPattern, Float64.nan.bitPattern)
+    XCTAssertEqual(Array(elements[3...]), [4, 5, 6, 7, 8])
+  }
+
+  func testMinimum() {
+    let lhs = CFloat64x8Make(34, 12, 0, 23.0, 34, 12, 0, 23.0)
+    let rhs = CFloat64x8Make(-34, 24, -0, 23.5, -34, 24, -0, 23.5)
+    let storage = CFloat64x8Minimum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [-34, 12, 0, 23.0, -34, 12, 0, 23.0])
+  }
+
+  func testMaximum() {
+    let lhs = CFloat64x8Make(34, 12, 0, 23.0, 34, 12, 0, 23.0)
+    let rhs = CFloat64x8Make(-34, 24, -0, 23.5, -34, 24, -0, 23.5)
+    let storage = CFloat64x8Maximum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [34, 24, 0, 23.5, 34, 24, 0, 23.5])
+  }
+
+  // MARK: Arithmetic
+
+  func testMagnitude() {
+    let normal = CFloat64x8Make(-1, 0, 3, -4, -1, 0, 3, -4)
+
+    XCTAssertEqual(elements(of: CFloat64x8Magnitude(normal)), [1, 0, 3, 4, 1, 0, 3, 4])
+  }
+
+  func testNegate() {
+    let normal = CFloat64x8Make(-1, 0, 3, -4, -1, 0, 3, -4)
+
+    XCTAssertEqual(elements(of: CFloat64x8Negate(normal)), [1, 0, -3, 4, 1, 0, -3, 4])
+  }
+
+  func testAdd() {
+    let lhs = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CFloat64x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+
+    XCTAssertEqual(elements(of: CFloat64x8Add(lhs, rhs)), [Float64](repeating: 9, count: 8))
+  }
+
+  func testSubtract() {
+    let lhs = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CFloat64x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+
+    XCTAssertEqual(elements(of: CFloat64x8Subtract(lhs, rhs)), [-7, -5, -3, -1, 1, 3, 5, 7])
+  }
+
+  func testMultiply() {
+    let lhs = CFloat64x8Make(1, -2, -3, 4, 1, -2, -3, 4)
+    let rhs = CFloat64x8Make(4, -3, 2, -1, 4, -3, 2, -1)
+
+    XCTAssertEqual(elements(of: CFloat64x8Multiply(lhs, rhs)), [4, 6, -6, -4, 4, 6, -6, -4])
+  }
+
+  func testDivide() {
+    let lhs = CFloat64x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+    let rhs = CFloat64x8Make(-4, -3, 3, 2, -4, -3, 3, 2)
+
+    XCTAssertEqual(elements(of: CFloat64x8Divide(lhs, rhs)), [-0.25, 2, -1, 2, -0.25, 2, -1, 2])
+  }
+
+  func testSquareRoot() {
+    let storage = CFloat64x8SquareRoot(CFloat64x8Make(25, 144, 64, 256, 25, 144, 64, 256))
+
+    XCTAssertEqual(elements(of: storage), [5, 12, 8, 16, 5, 12, 8, 16])
+  }
+
+  func testArithmeticWithElement() {
+    let lhs = CFloat64x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+
+    XCTAssertEqual(elements(of: CFloat64x8AddElement(lhs, 2)), [3, -4, -1, 6, 3, -4, -1, 6])
+    XCTAssertEqual(elements(of: CFloat64x8SubtractElement(lhs, 2)), [-1, -8, -5, 2, -1, -8, -5, 2])
+    XCTAssertEqual(elements(of: CFloat64x8MultiplyElement(lhs, 2)), [2, -12, -6, 8, 2, -12, -6, 8])
+    XCTAssertEqual(elements(of: CFloat64x8DivideElement(lhs, 2)), [0.5, -3, -1.5, 2, 0.5, -3, -1.5, 2])
+  }
+
+  func testMultiplyAdd() {
+    let lhs = CFloat64x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+    let rhs = CFloat64x8Make(2, 2, -1, 0.5, 2, 2, -1, 0.5)
+    let addend = CFloat64x8Make(0.5, 1, -2, 3, 0.5, 1, -2, 3)
+
+    XCTAssertEqual(elements(of: CFloat64x8MultiplyAdd(lhs, rhs, addend)), [2.5, -11, 1, 5, 2.5, -11, 1, 5])
+  }
+
+  func testMultiplyElementAdd() {
+    let lhs = CFloat64x8Make(1, -6, -3, 4, 1, -6, -3, 4)
+    let addend = CFloat64x8Make(0.5, 1, -2, 3, 0.5, 1, -2, 3)
+
+    XCTAssertEqual(elements(of: CFloat64x8MultiplyElementAdd(lhs, 2, addend)), [2.5, -11, -8, 11, 2.5, -11, -8, 11])
+  }
+
+  // MARK: Reduction
+
+  func testReduceAdd() {
+    XCTAssertEqual(CFloat64x8ReduceAdd(CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)), 36)
+    XCTAssertEqual(CFloat64x8ReduceAdd(CFloat64x8MakeRepeatingElement(0.5)), 4.0)
+  }
+
+  func testReduceMinimum() {
+    XCTAssertEqual(CFloat64x8ReduceMinimum(CFloat64x8Make(4, 5, 6, 7, 8, -2, 1, 2)), -2)
+    XCTAssertEqual(CFloat64x8ReduceMinimum(CFloat64x8MakeRepeatingElement(3)), 3)
+  }
+
+  func testReduceMaximum() {
+    XCTAssertEqual(CFloat64x8ReduceMaximum(CFloat64x8Make(4, 5, 6, 7, 8, 24, 1, 2)), 24)
+    XCTAssertEqual(CFloat64x8ReduceMaximum(CFloat64x8MakeRepeatingElement(-3)), -3)
+  }
+
+  func testReduceIgnoresLaneOrder() {
+    let ascending = CFloat64x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let descending = CFloat64x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+
+    XCTAssertEqual(CFloat64x8ReduceAdd(ascending), CFloat64x8ReduceAdd(descending))
+    XCTAssertEqual(CFloat64x8ReduceMinimum(ascending), CFloat64x8ReduceMinimum(descending))
+    XCTAssertEqual(CFloat64x8ReduceMaximum(ascending), CFloat64x8ReduceMaximum(descending))
+  }
+}
@@ -0,0 +1,353 @@
+import XCTest
+import CSIMDX
+
+final class CInt32x16Tests: XCTestCase {
+
+  /// There is no `CInt32x16Make` of 16 elements, so the tests load them instead.
+  private func make(_ elements: [Int32]) -> CInt32x16 {
+    var elements = elements
+    return CInt32x16MakeLoad(&elements)
+  }
+
+  private func elements(of storage: CInt32x16) -> [Int32] {
+    (0 ..< CInt(16)).map { CInt32x16GetElement(storage, $0) }
+  }
+
+  // MARK: Make
+
+  func testMakeLoad() {
+    var array: [Int32] = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]
+    let storage = CInt32x16MakeLoad(&array)
+
+    XCTAssertEqual(elements(of: storage), array)
+  }
+
+  func testMakeRepeatingElement() {
+    let storage = CInt32x16MakeRepeatingElement(3)
+
+    XCTAssertEqual(elements(of: storage), [Int32](repeating: 3, count: 16))
+  }
+
+  func testMakeZero() {
+    let storage = CInt32x16MakeZero()
+
+    XCTAssertEqual(elements(of: storage), [Int32](repeating: 0, count: 16))
+  }
+
+  // MARK: Access
+
+  func testGetLowAndHigh() {
+    let storage = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let low = CInt32x16GetLow(storage)
+    let high = CInt32x16GetHigh(storage)
+
+    XCTAssertEqual((0 ..< CInt(8)).map { CInt32x8GetElement(low, $0) }, [1, 2, 3, 4, 5, 6, 7, 8])
+    XCTAssertEqual((0 ..< CInt(8)).map { CInt32x8GetElement(high, $0) }, [9, 10, 11, 12,
+                                                                          13, 14, 15, 16])
+  }
+
+  func testSetElement() {
+    var storage = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    for lane in 0 ..< CInt(16) {
+      CInt32x16SetElement(&storage, lane, Int32(lane) + 17)
+    }
+
+    XCTAssertEqual(elements(of: storage), [17, 18, 19, 20,
+                                           21, 22, 23, 24,
+                                           25, 26, 27, 28,
+                                           29, 30, 31, 32])
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    XCTAssertTrue(CInt32x16Equal(storage, make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])))
+    XCTAssertFalse(CInt32x16Equal(storage, make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0])))
+    XCTAssertFalse(CInt32x16Equal(storage, make([0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])))
+  }
+
+  func testCompare() {
+    let lhs = make([1, 2, .min, 0, 5, 6, -1, .max, 8, 9, 10, 11, 12, 13, 14, 15])
+    let rhs = make([1, 3, .max, -1, 4, 6, 0, .min, 15, 14, 13, 12, 11, 10, 9, 8])
+
+    XCTAssertEqual(elements(of: CInt32x16CompareEqual(lhs, rhs)), [-1, 0, 0, 0,
+                                                                   0, -1, 0, 0,
+                                                                   0, 0, 0, 0,
+                                                                   0, 0, 0, 0])
+    XCTAssertEqual(elements(of: CInt32x16CompareLessThan(lhs, rhs)), [0, -1, -1, 0,
+                                                                      0, 0, -1, 0,
+                                                                      -1, -1, -1, -1,
+                                                                      0, 0, 0, 0])
+    XCTAssertEqual(elements(of: CInt32x16CompareLessThanOrEqual(lhs, rhs)), [-1, -1, -1, 0,
+                                                                             0, -1, -1, 0,
+                                                                             -1, -1, -1, -1,
+                                                                             0, 0, 0, 0])
+  }
+
+  func testSelect() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+    // The lesser elements, selected by the mask of their comparison
+    let storage = CInt32x16Select(CInt32x16CompareLessThan(lhs, rhs), lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [1, 2, 3, 4,
+                                           5, 6, 7, 8,
+                                           8, 7, 6, 5,
+                                           4, 3, 2, 1])
+  }
+
+  func testMaskAnyAll() {
+    XCTAssertTrue(CInt32x16MaskAny(make([0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1])))
+    XCTAssertFalse(CInt32x16MaskAny(CInt32x16MakeZero()))
+    XCTAssertTrue(CInt32x16MaskAll(CInt32x16MakeRepeatingElement(-1)))
+    XCTAssertFalse(CInt32x16MaskAll(make([-1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1])))
+  }
+
+  func testMinimum() {
+    let lhs = make([34, 12, .max, -1, 34, 12, .max, -1, 34, 12, .max, -1, 34, 12, .max, -1])
+    let rhs = make([-34, 24, .min, 1, -34, 24, .min, 1, -34, 24, .min, 1, -34, 24, .min, 1])
+    let storage = CInt32x16Minimum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [-34, 12, .min, -1,
+                                           -34, 12, .min, -1,
+                                           -34, 12, .min, -1,
+                                           -34, 12, .min, -1])
+  }
+
+  func testMaximum() {
+    let lhs = make([34, 12, .max, -1, 34, 12, .max, -1, 34, 12, .max, -1, 34, 12, .max, -1])
+    let rhs = make([-34, 24, .min, 1, -34, 24, .min, 1, -34, 24, .min, 1, -34, 24, .min, 1])
+    let storage = CInt32x16Maximum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [34, 24, .max, 1,
+                                           34, 24, .max, 1,
+                                           34, 24, .max, 1,
+                                           34, 24, .max, 1])
+  }
+
+  // MARK: Arithmetic
+
+  func testMagnitude() {
+    let normal = make([-1, 0, 3, .min, -1, 0, 3, .min, -1, 0, 3, .min, -1, 0, 3, .min])
+    let magnitude = CInt32x16Magnitude(normal)
+    let lanes = (0 ..< CInt(16)).map { CUInt32x16GetElement(magnitude, $0) }
+
+    XCTAssertEqual(lanes, [1, 0, 3, 0x8000_0000,
+                           1, 0, 3, 0x8000_0000,
+                           1, 0, 3, 0x8000_0000,
+                           1, 0, 3, 0x8000_0000])
+  }
+
+  func testNegate() {
+    let normal = make([-1, 0, 3, .max, -1, 0, 3, .max, -1, 0, 3, .max, -1, 0, 3, .max])
+    let negate = CInt32x16Negate(normal)
+
+    XCTAssertEqual(elements(of: negate), [1, 0, -3, -.max,
+                                          1, 0, -3, -.max,
+                                          1, 0, -3, -.max,
+                                          1, 0, -3, -.max])
+  }
+
+  func testAdd() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+    let sum = CInt32x16Add(lhs, rhs)
+
+    XCTAssertEqual(elements(of: sum), [Int32](repeating: 17, count: 16))
+  }
+
+  func testSubtract() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+    let difference = CInt32x16Subtract(lhs, rhs)
+
+    XCTAssertEqual(elements(of: difference), [-15, -13, -11, -9,
+                                              -7, -5, -3, -1,
+                                              1, 3, 5, 7,
+                                              9, 11, 13, 15])
+  }
+
+  func testMultiply() {
+    let lhs = make([1, -2, -3, .max, 1, -2, -3, .max, 1, -2, -3, .max, 1, -2, -3, .max])
+    let rhs = make([4, -3, 2, 2, 4, -3, 2, 2, 4, -3, 2, 2, 4, -3, 2, 2])
+    let product = CInt32x16Multiply(lhs, rhs)
+
+    XCTAssertEqual(elements(of: product), [4, 6, -6, -2, 4, 6, -6, -2, 4, 6, -6, -2, 4, 6, -6, -2])
+  }
+
+  // MARK: Binary
+
+  func testBitwiseNot() {
+    let operand = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let storage = CInt32x16BitwiseNot(operand)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { ~$0 })
+  }
+
+  func testBitwiseAnd() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CInt32x16BitwiseAnd(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 & $1 })
+  }
+
+  func testBitwiseAndNot() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CInt32x16BitwiseAndNot(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { ~$0 & $1 })
+  }
+
+  func testBitwiseOr() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CInt32x16BitwiseOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 | $1 })
+  }
+
+  func testBitwiseExclusiveOr() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CInt32x16BitwiseExclusiveOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 ^ $1 })
+  }
+
+  func testShiftLeft() {
+    let operand = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let storage = CInt32x16ShiftLeft(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 << 2 })
+  }
+
+  func testShiftRight() {
+    let operand = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, -8])
+    let storage = CInt32x16ShiftRight(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 >> 2 })
+  }
+
+  func testShiftLeftElementWise() {
+    let lhs = make([-1, 0b1111_0000, .min, 1,
+                    -1, 0b1111_0000, .min, 1,
+                    -1, 0b1111_0000, .min, 1,
+                    -1, 0b1111_0000, .min, 1])
+    let rhs = make([31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32])
+    let storage = CInt32x16ShiftLeftElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [.min, 0b1111_0000_0000, 0, 0,
+                                           .min, 0b1111_0000_0000, 0, 0,
+                                           .min, 0b1111_0000_0000, 0, 0,
+                                           .min, 0b1111_0000_0000, 0, 0])
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = make([-1, 0b1111_0000, .min, .min,
+                    -1, 0b1111_0000, .min, .min,
+                    -1, 0b1111_0000, .min, .min,
+                    -1, 0b1111_0000, .min, .min])
+    let rhs = make([31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32])
+    let storage = CInt32x16ShiftRightElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [-1, 0b1111, -0x8000, -1,
+                                           -1, 0b1111, -0x8000, -1,
+                                           -1, 0b1111, -0x8000, -1,
+                                           -1, 0b1111, -0x8000, -1])
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let operand = make([0, 1, .min, -1, 0, 1, .min, -1, 0, 1, .min, -1, 0, 1, .min, -1])
+    let storage = CInt32x16PopulationCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 1, 1, 32, 0, 1, 1, 32, 0, 1, 1, 32, 0, 1, 1, 32])
+  }
+
+  func testLeadingZeroBitCount() {
+    let operand = make([0, 1, .min, 0xFFFF, 0, 1, .min, 0xFFFF, 0, 1, .min, 0xFFFF, 0, 1, .min, 0xFFFF])
+    let storage = CInt32x16LeadingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 31, 0, 16,
+                                           32, 31, 0, 16,
+                                           32, 31, 0, 16,
+                                           32, 31, 0, 16])
+  }
+
+  func testTrailingZeroBitCount() {
+    let operand = make([0, 1, .min, 0x10000, 0, 1, .min, 0x10000, 0, 1, .min, 0x10000, 0, 1, .min, 0x10000])
+    let storage = CInt32x16TrailingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 0, 31, 16,
+                                           32, 0, 31, 16,
+                                           32, 0, 31, 16,
+                                           32, 0, 31, 16])
+  }
+
+  // MARK: Reordering
+
+  func testByteSwap() {
+    let operand = make([0, 1, .min, 0x1234_5678,
+                        0, 1, .min, 0x1234_5678,
+                        0, 1, .min, 0x1234_5678,
+                        0, 1, .min, 0x1234_5678])
+    let storage = CInt32x16ByteSwap(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412])
+  }
+
+  func testBitReverse() {
+    let operand = make([0, 1, .min, 0x0000_FFFF,
+                        0, 1, .min, 0x0000_FFFF,
+                        0, 1, .min, 0x0000_FFFF,
+                        0, 1, .min, 0x0000_FFFF])
+    let storage = CInt32x16BitReverse(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, .min, 1, -0x10000,
+                                           0, .min, 1, -0x10000,
+                                           0, .min, 1, -0x10000,
+                                           0, .min, 1, -0x10000])
+  }
+}
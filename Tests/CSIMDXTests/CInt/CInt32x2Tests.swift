@@ -58,6 +58,14 @@ final class CInt32x2Tests: XCTestCase {
 
   // MARK: Comparison
 
+  func testEqual() {
+    let storage = CInt32x2Make(1, .max)
+
+    XCTAssertTrue(CInt32x2Equal(storage, CInt32x2Make(1, .max)))
+    XCTAssertFalse(CInt32x2Equal(storage, CInt32x2Make(1, 0)))
+    XCTAssertFalse(CInt32x2Equal(storage, CInt32x2Make(0, .max)))
+  }
+
   func testMinimum() {
     let lhs = CInt32x2Make(34, 12)
     let rhs = CInt32x2Make(-34, 24)
@@ -190,6 +198,45 @@ final class CInt32x2Tests: XCTestCase {
     XCTAssertEqual(CInt32x2GetElement(storage, 0), 0b1111_1111 >> 2)
     XCTAssertEqual(CInt32x2GetElement(storage, 1), 0b0000_1111 >> 4)
   }
+
+  func testShiftRightElementWiseNegative() {
+    let lhs = CInt32x2Make(-1, .min)
+    let storage = CInt32x2ShiftRightElementWise(lhs, CInt32x2Make(31, 16))
+    XCTAssertEqual(CInt32x2GetElement(storage, 0), -1)
+    XCTAssertEqual(CInt32x2GetElement(storage, 1), -0x8000)
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let storage = CInt32x2PopulationCount(CInt32x2Make(0, -1))
+    XCTAssertEqual(CInt32x2GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x2GetElement(storage, 1), 32)
+  }
+
+  func testLeadingZeroBitCount() {
+    let storage = CInt32x2LeadingZeroBitCount(CInt32x2Make(0, -1))
+    XCTAssertEqual(CInt32x2GetElement(storage, 0), 32)
+    XCTAssertEqual(CInt32x2GetElement(storage, 1), 0)
+  }
+
+  func testTrailingZeroBitCount() {
+    let storage = CInt32x2TrailingZeroBitCount(CInt32x2Make(0, -1))
+    XCTAssertEqual(CInt32x2GetElement(storage, 0), 32)
+    XCTAssertEqual(CInt32x2GetElement(storage, 1), 0)
+  }
+
+  func testByteSwap() {
+    let storage = CInt32x2ByteSwap(CInt32x2Make(0, -1))
+    XCTAssertEqual(CInt32x2GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x2GetElement(storage, 1), -1)
+  }
+
+  func testBitReverse() {
+    let storage = CInt32x2BitReverse(CInt32x2Make(0, -1))
+    XCTAssertEqual(CInt32x2GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x2GetElement(storage, 1), -1)
+  }
   //    // MARK: Conversion
   //
   //    func testConvertFromFloat32x2() {
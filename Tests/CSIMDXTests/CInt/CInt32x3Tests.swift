@@ -66,6 +66,53 @@ final class CInt32x3Tests: XCTestCase {
 
   // MARK: Comparison
 
+  func testEqual() {
+    let storage = CInt32x3Make(1, .max, .min)
+
+    XCTAssertTrue(CInt32x3Equal(storage, CInt32x3Make(1, .max, .min)))
+    XCTAssertFalse(CInt32x3Equal(storage, CInt32x3Make(1, .max, 0)))
+    XCTAssertFalse(CInt32x3Equal(storage, CInt32x3Make(0, .max, .min)))
+  }
+
+  func testCompare() {
+    let lhs = CInt32x3Make(1, .min, 3)
+    let rhs = CInt32x3Make(1, .max, -3)
+
+    let equal = CInt32x3CompareEqual(lhs, rhs)
+    XCTAssertEqual(CInt32x3GetElement(equal, 0), -1)
+    XCTAssertEqual(CInt32x3GetElement(equal, 1), 0)
+    XCTAssertEqual(CInt32x3GetElement(equal, 2), 0)
+
+    let lessThan = CInt32x3CompareLessThan(lhs, rhs)
+    XCTAssertEqual(CInt32x3GetElement(lessThan, 0), 0)
+    XCTAssertEqual(CInt32x3GetElement(lessThan, 1), -1)
+    XCTAssertEqual(CInt32x3GetElement(lessThan, 2), 0)
+
+    let lessThanOrEqual = CInt32x3CompareLessThanOrEqual(lhs, rhs)
+    XCTAssertEqual(CInt32x3GetElement(lessThanOrEqual, 0), -1)
+    XCTAssertEqual(CInt32x3GetElement(lessThanOrEqual, 1), -1)
+    XCTAssertEqual(CInt32x3GetElement(lessThanOrEqual, 2), 0)
+  }
+
+  func testSelect() {
+    let mask = CInt32x3Make(-1, 0, -1)
+    let storage = CInt32x3Select(mask, CInt32x3Make(1, 2, 3), CInt32x3Make(4, 5, 6))
+
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), 1)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), 5)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), 3)
+  }
+
+  func testMaskAnyAll() {
+    XCTAssertTrue(CInt32x3MaskAny(CInt32x3Make(0, 0, -1)))
+    XCTAssertFalse(CInt32x3MaskAny(CInt32x3MakeZero()))
+    XCTAssertTrue(CInt32x3MaskAll(CInt32x3Make(-1, -1, -1)))
+    XCTAssertFalse(CInt32x3MaskAll(CInt32x3Make(-1, 0, -1)))
+    // The negation may set the unused lane, which is ignored
+    XCTAssertTrue(CInt32x3MaskAll(CInt32x3BitwiseNot(CInt32x3MakeZero())))
+    XCTAssertFalse(CInt32x3MaskAny(CInt32x3BitwiseNot(CInt32x3MakeRepeatingElement(-1))))
+  }
+
   func testMinimum() {
     let lhs = CInt32x3Make(34, 12, .max)
     let rhs = CInt32x3Make(-34, 24, .min)
@@ -198,6 +245,59 @@ final class CInt32x3Tests: XCTestCase {
     XCTAssertEqual(CInt32x3GetElement(storage, 2), 0b0011_1100 >> 2)
   }
 
+  func testShiftLeftElementWise() {
+    let lhs = CInt32x3Make(-1, 0b1111_0000, .min)
+    let storage = CInt32x3ShiftLeftElementWise(lhs, CInt32x3Make(31, 4, 16))
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), .min)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), 0b1111_0000_0000)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), 0)
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = CInt32x3Make(-1, 0b1111_0000, .min)
+    let storage = CInt32x3ShiftRightElementWise(lhs, CInt32x3Make(31, 4, 16))
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), -1)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), 0b1111)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), -0x8000)
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let storage = CInt32x3PopulationCount(CInt32x3Make(0, 1, .min))
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), 1)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), 1)
+  }
+
+  func testLeadingZeroBitCount() {
+    let storage = CInt32x3LeadingZeroBitCount(CInt32x3Make(0, 1, .min))
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), 32)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), 31)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), 0)
+  }
+
+  func testTrailingZeroBitCount() {
+    let storage = CInt32x3TrailingZeroBitCount(CInt32x3Make(0, 1, .min))
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), 32)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), 0)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), 31)
+  }
+
+  func testByteSwap() {
+    let storage = CInt32x3ByteSwap(CInt32x3Make(0, 1, .min))
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), 0x0100_0000)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), 128)
+  }
+
+  func testBitReverse() {
+    let storage = CInt32x3BitReverse(CInt32x3Make(0, 1, .min))
+    XCTAssertEqual(CInt32x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x3GetElement(storage, 1), .min)
+    XCTAssertEqual(CInt32x3GetElement(storage, 2), 1)
+  }
+
 //  // MARK: Conversion
 //
 //  func testConvertFromFloat32x3() {
@@ -0,0 +1,290 @@
+import XCTest
+import CSIMDX
+
+final class CInt32x4Tests: XCTestCase {
+
+  // MARK: Make
+
+  func testMake() {
+    let collection = CInt32x4Make(1, 2, 3, 4)
+
+    XCTAssertEqual(CInt32x4GetElement(collection, 0), 1)
+    XCTAssertEqual(CInt32x4GetElement(collection, 1), 2)
+    XCTAssertEqual(CInt32x4GetElement(collection, 2), 3)
+    XCTAssertEqual(CInt32x4GetElement(collection, 3), 4)
+  }
+
+  func testMakeLoad() {
+    var array: [Int32] = [1, -2, 3, -4]
+    let collection = CInt32x4MakeLoad(&array)
+
+    XCTAssertEqual(CInt32x4GetElement(collection, 0),  1)
+    XCTAssertEqual(CInt32x4GetElement(collection, 1), -2)
+    XCTAssertEqual(CInt32x4GetElement(collection, 2),  3)
+    XCTAssertEqual(CInt32x4GetElement(collection, 3), -4)
+  }
+
+  func testMakeRepeatingElement() {
+    let collection = CInt32x4MakeRepeatingElement(3)
+
+    XCTAssertEqual(CInt32x4GetElement(collection, 0), 3)
+    XCTAssertEqual(CInt32x4GetElement(collection, 1), 3)
+    XCTAssertEqual(CInt32x4GetElement(collection, 2), 3)
+    XCTAssertEqual(CInt32x4GetElement(collection, 3), 3)
+  }
+
+  func testMakeZero() {
+    let collection = CInt32x4MakeZero()
+
+    XCTAssertEqual(CInt32x4GetElement(collection, 0), 0)
+    XCTAssertEqual(CInt32x4GetElement(collection, 1), 0)
+    XCTAssertEqual(CInt32x4GetElement(collection, 2), 0)
+    XCTAssertEqual(CInt32x4GetElement(collection, 3), 0)
+  }
+
+  // MARK: Access
+
+  func testGetElement() {
+    let collection = CInt32x4Make(1, 2, 3, 4)
+
+    XCTAssertEqual(CInt32x4GetElement(collection, 0), 1)
+    XCTAssertEqual(CInt32x4GetElement(collection, 1), 2)
+    XCTAssertEqual(CInt32x4GetElement(collection, 2), 3)
+    XCTAssertEqual(CInt32x4GetElement(collection, 3), 4)
+  }
+
+  func testSetElement() {
+    var collection = CInt32x4Make(1, 2, 3, 4)
+
+    XCTAssertEqual(CInt32x4GetElement(collection, 0), 1)
+    XCTAssertEqual(CInt32x4GetElement(collection, 1), 2)
+    XCTAssertEqual(CInt32x4GetElement(collection, 2), 3)
+    XCTAssertEqual(CInt32x4GetElement(collection, 3), 4)
+
+    CInt32x4SetElement(&collection, 0, 5)
+    CInt32x4SetElement(&collection, 1, 6)
+    CInt32x4SetElement(&collection, 2, 7)
+    CInt32x4SetElement(&collection, 3, 8)
+
+    XCTAssertEqual(CInt32x4GetElement(collection, 0), 5)
+    XCTAssertEqual(CInt32x4GetElement(collection, 1), 6)
+    XCTAssertEqual(CInt32x4GetElement(collection, 2), 7)
+    XCTAssertEqual(CInt32x4GetElement(collection, 3), 8)
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = CInt32x4Make(1, .max, .min, -1)
+
+    XCTAssertTrue(CInt32x4Equal(storage, CInt32x4Make(1, .max, .min, -1)))
+    XCTAssertFalse(CInt32x4Equal(storage, CInt32x4Make(1, .max, .min, 1)))
+    XCTAssertFalse(CInt32x4Equal(storage, CInt32x4Make(0, .max, .min, -1)))
+  }
+
+  func testMinimum() {
+    let lhs = CInt32x4Make(34, 12, .max, -1)
+    let rhs = CInt32x4Make(-34, 24, .min, 1)
+    let storage = CInt32x4Minimum(lhs, rhs)
+
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), -34)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 12)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), .min)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), -1)
+  }
+
+  func testMaximum() {
+    let lhs = CInt32x4Make(34, 12, .max, -1)
+    let rhs = CInt32x4Make(-34, 24, .min, 1)
+    let storage = CInt32x4Maximum(lhs, rhs)
+
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 34)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 24)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), .max)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 1)
+  }
+
+  // MARK: Arithmetic
+
+  func testMagnitude() {
+    let normal = CInt32x4Make(-1, 0, 3, .min)
+    let absolute = CInt32x4Magnitude(normal)
+
+    XCTAssertEqual(CUInt32x4GetElement(absolute, 0), 1)
+    XCTAssertEqual(CUInt32x4GetElement(absolute, 1), 0)
+    XCTAssertEqual(CUInt32x4GetElement(absolute, 2), 3)
+    XCTAssertEqual(CUInt32x4GetElement(absolute, 3), 0x8000_0000)
+  }
+
+  func testNegate() {
+    let normal = CInt32x4Make(-1, 0, 3, .max)
+    let negate = CInt32x4Negate(normal)
+
+    XCTAssertEqual(CInt32x4GetElement(negate, 0), 1)
+    XCTAssertEqual(CInt32x4GetElement(negate, 1), 0)
+    XCTAssertEqual(CInt32x4GetElement(negate, 2), -3)
+    XCTAssertEqual(CInt32x4GetElement(negate, 3), -.max)
+  }
+
+  func testAdd() {
+    let lhs = CInt32x4Make(1, 2, 3, 4)
+    let rhs = CInt32x4Make(4, 3, 2, 1)
+    let sum = CInt32x4Add(lhs, rhs)
+
+    XCTAssertEqual(CInt32x4GetElement(sum, 0), 5)
+    XCTAssertEqual(CInt32x4GetElement(sum, 1), 5)
+    XCTAssertEqual(CInt32x4GetElement(sum, 2), 5)
+    XCTAssertEqual(CInt32x4GetElement(sum, 3), 5)
+  }
+
+  func testSubtract() {
+    let lhs = CInt32x4Make(1, 2, 3, 4)
+    let rhs = CInt32x4Make(4, 3, 2, 1)
+    let sum = CInt32x4Subtract(lhs, rhs)
+
+    XCTAssertEqual(CInt32x4GetElement(sum, 0), -3)
+    XCTAssertEqual(CInt32x4GetElement(sum, 1), -1)
+    XCTAssertEqual(CInt32x4GetElement(sum, 2), 1)
+    XCTAssertEqual(CInt32x4GetElement(sum, 3), 3)
+  }
+
+  func testMultiply() {
+    let lhs = CInt32x4Make(1, -2, -3, .max)
+    let rhs = CInt32x4Make(4, -3, 2, 2)
+    let product = CInt32x4Multiply(lhs, rhs)
+
+    XCTAssertEqual(CInt32x4GetElement(product, 0), 4)
+    XCTAssertEqual(CInt32x4GetElement(product, 1), 6)
+    XCTAssertEqual(CInt32x4GetElement(product, 2), -6)
+    XCTAssertEqual(CInt32x4GetElement(product, 3), -2)
+  }
+
+  // MARK: Binary
+
+  func testBitwiseNot() {
+    let operand = CInt32x4Make(0b0000_1111, 0b1111_0000, 0b0011_1100, 0)
+    let storage = CInt32x4BitwiseNot(operand)
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), ~(0b0000_1111))
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), ~(0b1111_0000))
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), ~(0b0011_1100))
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), -1)
+  }
+
+  func testBitwiseAnd() {
+    let lhs = CInt32x4Make(0b0000_1111, 0b1111_0000, 0b0011_1100, -1)
+    let rhs = CInt32x4Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x4BitwiseAnd(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0b0000_1111 & 0b1111_1111)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0b1111_0000 & 0b0000_0000)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 0b0011_1100 & 0b1100_0011)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 0b1010)
+  }
+
+  func testBitwiseAndNot() {
+    let lhs = CInt32x4Make(0b0000_1111, 0b1111_0000, 0b0011_1100, -1)
+    let rhs = CInt32x4Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x4BitwiseAndNot(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), (~0b0000_1111) & 0b1111_1111)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), (~0b1111_0000) & 0b0000_0000)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), (~0b0011_1100) & 0b1100_0011)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 0)
+  }
+
+  func testBitwiseOr() {
+    let lhs = CInt32x4Make(0b0000_1111, 0b1111_0000, 0b0011_1100, -1)
+    let rhs = CInt32x4Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x4BitwiseOr(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0b0000_1111 | 0b1111_1111)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0b1111_0000 | 0b0000_0000)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 0b0011_1100 | 0b1100_0011)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), -1)
+  }
+
+  func testBitwiseExclusiveOr() {
+    let lhs = CInt32x4Make(0b0000_1111, 0b1111_0000, 0b0011_1100, -1)
+    let rhs = CInt32x4Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x4BitwiseExclusiveOr(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0b0000_1111 ^ 0b1111_1111)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0b1111_0000 ^ 0b0000_0000)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 0b0011_1100 ^ 0b1100_0011)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), ~0b1010)
+  }
+
+  func testShiftLeft() {
+    let lhs = CInt32x4Make(0b1111_1111, 0b0000_1111, 0b0011_1100, -1)
+    let storage = CInt32x4ShiftLeft(lhs, 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0b1111_1111 << 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0b0000_1111 << 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 0b0011_1100 << 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), -4)
+  }
+
+  func testShiftRight() {
+    let lhs = CInt32x4Make(0b1111_1111, 0b0000_1111, 0b0011_1100, -8)
+    let storage = CInt32x4ShiftRight(lhs, 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0b1111_1111 >> 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0b0000_1111 >> 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 0b0011_1100 >> 2)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), -2)
+  }
+
+  func testShiftLeftElementWise() {
+    let lhs = CInt32x4Make(-1, 0b1111_0000, .min, 1)
+    let storage = CInt32x4ShiftLeftElementWise(lhs, CInt32x4Make(31, 4, 16, 32))
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), .min)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0b1111_0000_0000)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 0)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 0)
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = CInt32x4Make(-1, 0b1111_0000, .min, .min)
+    let storage = CInt32x4ShiftRightElementWise(lhs, CInt32x4Make(31, 4, 16, 32))
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), -1)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0b1111)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), -0x8000)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), -1)
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let storage = CInt32x4PopulationCount(CInt32x4Make(0, 1, .min, -1))
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 1)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 1)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 32)
+  }
+
+  func testLeadingZeroBitCount() {
+    let storage = CInt32x4LeadingZeroBitCount(CInt32x4Make(0, 1, .min, 0xFFFF))
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 32)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 31)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 0)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 16)
+  }
+
+  func testTrailingZeroBitCount() {
+    let storage = CInt32x4TrailingZeroBitCount(CInt32x4Make(0, 1, .min, 0x10000))
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 32)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 31)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 16)
+  }
+
+  func testByteSwap() {
+    let storage = CInt32x4ByteSwap(CInt32x4Make(0, 1, .min, 0x1234_5678))
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), 0x0100_0000)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 128)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), 0x7856_3412)
+  }
+
+  func testBitReverse() {
+    let storage = CInt32x4BitReverse(CInt32x4Make(0, 1, .min, 0x0000_FFFF))
+    XCTAssertEqual(CInt32x4GetElement(storage, 0), 0)
+    XCTAssertEqual(CInt32x4GetElement(storage, 1), .min)
+    XCTAssertEqual(CInt32x4GetElement(storage, 2), 1)
+    XCTAssertEqual(CInt32x4GetElement(storage, 3), -0x10000)
+  }
+}
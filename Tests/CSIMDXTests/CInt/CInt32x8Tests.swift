@@ -0,0 +1,270 @@
+import XCTest
+import CSIMDX
+
+final class CInt32x8Tests: XCTestCase {
+
+  private func elements(of storage: CInt32x8) -> [Int32] {
+    (0 ..< CInt(8)).map { CInt32x8GetElement(storage, $0) }
+  }
+
+  // MARK: Make
+
+  func testMake() {
+    let storage = CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertEqual(elements(of: storage), [1, 2, 3, 4, 5, 6, 7, 8])
+  }
+
+  func testMakeLoad() {
+    var array: [Int32] = [1, 2, 3, 4, 5, 6, 7, 8]
+    let storage = CInt32x8MakeLoad(&array)
+
+    XCTAssertEqual(elements(of: storage), array)
+  }
+
+  func testMakeRepeatingElement() {
+    let storage = CInt32x8MakeRepeatingElement(3)
+
+    XCTAssertEqual(elements(of: storage), [Int32](repeating: 3, count: 8))
+  }
+
+  func testMakeZero() {
+    let storage = CInt32x8MakeZero()
+
+    XCTAssertEqual(elements(of: storage), [Int32](repeating: 0, count: 8))
+  }
+
+  // MARK: Access
+
+  func testGetLowAndHigh() {
+    let storage = CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let low = CInt32x8GetLow(storage)
+    let high = CInt32x8GetHigh(storage)
+
+    XCTAssertEqual((0 ..< CInt(4)).map { CInt32x4GetElement(low, $0) }, [1, 2, 3, 4])
+    XCTAssertEqual((0 ..< CInt(4)).map { CInt32x4GetElement(high, $0) }, [5, 6, 7, 8])
+  }
+
+  func testSetElement() {
+    var storage = CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    for lane in 0 ..< CInt(8) {
+      CInt32x8SetElement(&storage, lane, Int32(lane) + 9)
+    }
+
+    XCTAssertEqual(elements(of: storage), [9, 10, 11, 12, 13, 14, 15, 16])
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertTrue(CInt32x8Equal(storage, CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)))
+    XCTAssertFalse(CInt32x8Equal(storage, CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 0)))
+    XCTAssertFalse(CInt32x8Equal(storage, CInt32x8Make(0, 2, 3, 4, 5, 6, 7, 8)))
+  }
+
+  func testCompare() {
+    let lhs = CInt32x8Make(1, 2, .min, 0, 5, 6, -1, .max)
+    let rhs = CInt32x8Make(1, 3, .max, -1, 4, 6, 0, .min)
+
+    XCTAssertEqual(elements(of: CInt32x8CompareEqual(lhs, rhs)), [-1, 0, 0, 0, 0, -1, 0, 0])
+    XCTAssertEqual(elements(of: CInt32x8CompareLessThan(lhs, rhs)), [0, -1, -1, 0, 0, 0, -1, 0])
+    XCTAssertEqual(elements(of: CInt32x8CompareLessThanOrEqual(lhs, rhs)), [-1, -1, -1, 0, 0, -1, -1, 0])
+  }
+
+  func testSelect() {
+    let mask = CInt32x8Make(-1, 0, 0, -1, 0, -1, -1, 0)
+    let storage = CInt32x8Select(mask, CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8), CInt32x8Make(9, 10, 11, 12, 13, 14, 15, 16))
+
+    XCTAssertEqual(elements(of: storage), [1, 10, 11, 4, 13, 6, 7, 16])
+  }
+
+  func testMaskAnyAll() {
+    XCTAssertTrue(CInt32x8MaskAny(CInt32x8Make(0, 0, 0, 0, 0, 0, 0, -1)))
+    XCTAssertFalse(CInt32x8MaskAny(CInt32x8MakeZero()))
+    XCTAssertTrue(CInt32x8MaskAll(CInt32x8MakeRepeatingElement(-1)))
+    XCTAssertFalse(CInt32x8MaskAll(CInt32x8Make(-1, -1, -1, -1, 0, -1, -1, -1)))
+  }
+
+  func testMinimum() {
+    let lhs = CInt32x8Make(34, 12, .max, -1, 34, 12, .max, -1)
+    let rhs = CInt32x8Make(-34, 24, .min, 1, -34, 24, .min, 1)
+    let storage = CInt32x8Minimum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [-34, 12, .min, -1, -34, 12, .min, -1])
+  }
+
+  func testMaximum() {
+    let lhs = CInt32x8Make(34, 12, .max, -1, 34, 12, .max, -1)
+    let rhs = CInt32x8Make(-34, 24, .min, 1, -34, 24, .min, 1)
+    let storage = CInt32x8Maximum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [34, 24, .max, 1, 34, 24, .max, 1])
+  }
+
+  // MARK: Arithmetic
+
+  func testMagnitude() {
+    let normal = CInt32x8Make(-1, 0, 3, .min, -1, 0, 3, .min)
+    let magnitude = CInt32x8Magnitude(normal)
+    let lanes = (0 ..< CInt(8)).map { CUInt32x8GetElement(magnitude, $0) }
+
+    XCTAssertEqual(lanes, [1, 0, 3, 0x8000_0000, 1, 0, 3, 0x8000_0000])
+  }
+
+  func testNegate() {
+    let normal = CInt32x8Make(-1, 0, 3, .max, -1, 0, 3, .max)
+    let negate = CInt32x8Negate(normal)
+
+    XCTAssertEqual(elements(of: negate), [1, 0, -3, -.max, 1, 0, -3, -.max])
+  }
+
+  func testAdd() {
+    let lhs = CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CInt32x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+    let sum = CInt32x8Add(lhs, rhs)
+
+    XCTAssertEqual(elements(of: sum), [Int32](repeating: 9, count: 8))
+  }
+
+  func testSubtract() {
+    let lhs = CInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CInt32x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+    let difference = CInt32x8Subtract(lhs, rhs)
+
+    XCTAssertEqual(elements(of: difference), [-7, -5, -3, -1, 1, 3, 5, 7])
+  }
+
+  func testMultiply() {
+    let lhs = CInt32x8Make(1, -2, -3, .max, 1, -2, -3, .max)
+    let rhs = CInt32x8Make(4, -3, 2, 2, 4, -3, 2, 2)
+    let product = CInt32x8Multiply(lhs, rhs)
+
+    XCTAssertEqual(elements(of: product), [4, 6, -6, -2, 4, 6, -6, -2])
+  }
+
+  // MARK: Binary
+
+  func testBitwiseNot() {
+    let operand = CInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                               0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let storage = CInt32x8BitwiseNot(operand)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { ~$0 })
+  }
+
+  func testBitwiseAnd() {
+    let lhs = CInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                           0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                           0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x8BitwiseAnd(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 & $1 })
+  }
+
+  func testBitwiseAndNot() {
+    let lhs = CInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                           0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                           0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x8BitwiseAndNot(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { ~$0 & $1 })
+  }
+
+  func testBitwiseOr() {
+    let lhs = CInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                           0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                           0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x8BitwiseOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 | $1 })
+  }
+
+  func testBitwiseExclusiveOr() {
+    let lhs = CInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                           0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                           0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CInt32x8BitwiseExclusiveOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 ^ $1 })
+  }
+
+  func testShiftLeft() {
+    let operand = CInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                               0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let storage = CInt32x8ShiftLeft(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 << 2 })
+  }
+
+  func testShiftRight() {
+    let operand = CInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                               0b0000_1111, 0b1111_0000, 0b0011_1100, -8)
+    let storage = CInt32x8ShiftRight(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 >> 2 })
+  }
+
+  func testShiftLeftElementWise() {
+    let lhs = CInt32x8Make(-1, 0b1111_0000, .min, 1, -1, 0b1111_0000, .min, 1)
+    let rhs = CInt32x8Make(31, 4, 16, 32, 31, 4, 16, 32)
+    let storage = CInt32x8ShiftLeftElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [.min, 0b1111_0000_0000, 0, 0,
+                                           .min, 0b1111_0000_0000, 0, 0])
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = CInt32x8Make(-1, 0b1111_0000, .min, .min, -1, 0b1111_0000, .min, .min)
+    let rhs = CInt32x8Make(31, 4, 16, 32, 31, 4, 16, 32)
+    let storage = CInt32x8ShiftRightElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [-1, 0b1111, -0x8000, -1, -1, 0b1111, -0x8000, -1])
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let operand = CInt32x8Make(0, 1, .min, -1, 0, 1, .min, -1)
+    let storage = CInt32x8PopulationCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 1, 1, 32, 0, 1, 1, 32])
+  }
+
+  func testLeadingZeroBitCount() {
+    let operand = CInt32x8Make(0, 1, .min, 0xFFFF, 0, 1, .min, 0xFFFF)
+    let storage = CInt32x8LeadingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 31, 0, 16, 32, 31, 0, 16])
+  }
+
+  func testTrailingZeroBitCount() {
+    let operand = CInt32x8Make(0, 1, .min, 0x10000, 0, 1, .min, 0x10000)
+    let storage = CInt32x8TrailingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 0, 31, 16, 32, 0, 31, 16])
+  }
+
+  // MARK: Reordering
+
+  func testByteSwap() {
+    let operand = CInt32x8Make(0, 1, .min, 0x1234_5678, 0, 1, .min, 0x1234_5678)
+    let storage = CInt32x8ByteSwap(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412])
+  }
+
+  func testBitReverse() {
+    let operand = CInt32x8Make(0, 1, .min, 0x0000_FFFF, 0, 1, .min, 0x0000_FFFF)
+    let storage = CInt32x8BitReverse(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, .min, 1, -0x10000, 0, .min, 1, -0x10000])
+  }
+}
@@ -0,0 +1,162 @@
+import XCTest
+import CSIMDX
+
+final class CQuaternionF32Tests: XCTestCase {
+
+  // MARK: Make
+
+  func testMake() {
+    let quaternion = CQuaternionF32Make(1, 2, 3, 4)
+
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 0), 1)
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 1), 2)
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 2), 3)
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 3), 4)
+  }
+
+  func testMakeWithImaginary() {
+    let quaternion = CQuaternionF32MakeWithImaginary(CFloat32x3Make(1, 2, 3), 4)
+
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 2), 3)
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 3), 4)
+    XCTAssertEqual(CQuaternionF32GetReal(quaternion), 4)
+    XCTAssertEqual(CFloat32x3GetElement(CQuaternionF32GetImaginary(quaternion), 0), 1)
+    XCTAssertEqual(CFloat32x3GetElement(CQuaternionF32GetImaginary(quaternion), 2), 3)
+  }
+
+  func testMakeIdentity() {
+    let quaternion = CQuaternionF32MakeIdentity()
+
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 0), 0)
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 1), 0)
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 2), 0)
+    XCTAssertEqual(CFloat32x4GetElement(quaternion, 3), 1)
+  }
+
+  // MARK: Products
+
+  func testDot() {
+    let lhs = CQuaternionF32Make(1, 2, 3, 4)
+    let rhs = CQuaternionF32Make(5, 6, 7, 8)
+
+    XCTAssertEqual(CQuaternionF32Dot(lhs, rhs), 70)
+  }
+
+  func testMultiply() {
+    let lhs = CQuaternionF32Make(1, 2, 3, 4)
+    let rhs = CQuaternionF32Make(5, 6, 7, 8)
+    let product = CQuaternionF32Multiply(lhs, rhs)
+
+    XCTAssertEqual(CFloat32x4GetElement(product, 0), 24)
+    XCTAssertEqual(CFloat32x4GetElement(product, 1), 48)
+    XCTAssertEqual(CFloat32x4GetElement(product, 2), 48)
+    XCTAssertEqual(CFloat32x4GetElement(product, 3), -6)
+  }
+
+  // MARK: Arithmetic
+
+  func testConjugate() {
+    let conjugate = CQuaternionF32Conjugate(CQuaternionF32Make(1, -2, 3, 4))
+
+    XCTAssertEqual(CFloat32x4GetElement(conjugate, 0), -1)
+    XCTAssertEqual(CFloat32x4GetElement(conjugate, 1), 2)
+    XCTAssertEqual(CFloat32x4GetElement(conjugate, 2), -3)
+    XCTAssertEqual(CFloat32x4GetElement(conjugate, 3), 4)
+  }
+
+  func testNormalize() {
+    let normalized = CQuaternionF32Normalize(CQuaternionF32Make(1, 2, 3, 4))
+    let length = Float32(30).squareRoot()
+
+    XCTAssertEqual(CFloat32x4GetElement(normalized, 0), 1 / length, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(normalized, 1), 2 / length, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(normalized, 2), 3 / length, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(normalized, 3), 4 / length, accuracy: 1e-6)
+  }
+
+  // MARK: Rotation
+
+  func testRotateVector() {
+    // A rotation of 90 degrees around the z-axis
+    let quaternion = CQuaternionF32Make(0, 0, 0.5.squareRoot(), 0.5.squareRoot())
+    let rotated = CQuaternionF32RotateVector(quaternion, CFloat32x3Make(1, 0, 0))
+
+    XCTAssertEqual(CFloat32x3GetElement(rotated, 0), 0, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(rotated, 1), 1, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(rotated, 2), 0, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x3GetElement(rotated, 3), 0)
+  }
+
+  // MARK: Interpolation
+
+  func testNLerp() {
+    let to = CQuaternionF32Make(0, 0, 0.5.squareRoot(), 0.5.squareRoot())
+    let halfway = CQuaternionF32NLerp(CQuaternionF32MakeIdentity(), to, 0.5)
+
+    XCTAssertEqual(CFloat32x4GetElement(halfway, 0), 0)
+    XCTAssertEqual(CFloat32x4GetElement(halfway, 1), 0)
+    XCTAssertEqual(CFloat32x4GetElement(halfway, 2), 0.38268343, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(halfway, 3), 0.92387953, accuracy: 1e-6)
+  }
+
+  func testSlerp() {
+    let to = CQuaternionF32Make(0, 0, 0.5.squareRoot(), 0.5.squareRoot())
+    let quarter = CQuaternionF32Slerp(CQuaternionF32MakeIdentity(), to, 0.25)
+
+    XCTAssertEqual(CFloat32x4GetElement(quarter, 0), 0)
+    XCTAssertEqual(CFloat32x4GetElement(quarter, 1), 0)
+    XCTAssertEqual(CFloat32x4GetElement(quarter, 2), 0.19509032, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(quarter, 3), 0.98078528, accuracy: 1e-6)
+  }
+
+  func testSlerpBatch() {
+    let identity = CQuaternionF32MakeIdentity()
+    let to = CQuaternionF32Make(0, 0, 0.5.squareRoot(), 0.5.squareRoot())
+    let from = [identity, identity]
+    let target = [to, to]
+    let t: [Float32] = [0, 1]
+    var result = [identity, identity]
+    CQuaternionF32SlerpBatch(from, target, t, &result, 2)
+
+    XCTAssertEqual(CFloat32x4GetElement(result[0], 2), 0, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(result[0], 3), 1, accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(result[1], 2), 0.5.squareRoot(), accuracy: 1e-6)
+    XCTAssertEqual(CFloat32x4GetElement(result[1], 3), 0.5.squareRoot(), accuracy: 1e-6)
+  }
+
+  func testBatchMatchesSingle() {
+    // 5 pairs, of which the first 4 are interpolated lane-parallel
+    let from = (0 ..< 5).map { CQuaternionF32Normalize(CQuaternionF32Make(1, Float32($0), 2, 3)) }
+    let to = (0 ..< 5).map { CQuaternionF32Normalize(CQuaternionF32Make(-Float32($0), 1, 0, -2)) }
+    let t: [Float32] = [0, 0.25, 0.5, 0.75, 1]
+    var slerped = from
+    var nlerped = from
+    CQuaternionF32SlerpBatch(from, to, t, &slerped, 5)
+    CQuaternionF32NLerpBatch(from, to, t, &nlerped, 5)
+
+    for index in 0 ..< 5 {
+      let slerp = CQuaternionF32Slerp(from[index], to[index], t[index])
+      let nlerp = CQuaternionF32NLerp(from[index], to[index], t[index])
+      for lane in 0 ..< CInt(4) {
+        XCTAssertEqual(CFloat32x4GetElement(slerped[index], lane), CFloat32x4GetElement(slerp, lane), accuracy: 1e-5)
+        XCTAssertEqual(CFloat32x4GetElement(nlerped[index], lane), CFloat32x4GetElement(nlerp, lane), accuracy: 1e-5)
+      }
+    }
+  }
+
+  func testSlerpBatchExtrapolates() {
+    // A half turn about the z axis, of which t beyond [0, 1] extrapolates
+    let from = [CQuaternionF32](repeating: CQuaternionF32MakeIdentity(), count: 5)
+    let to = [CQuaternionF32](repeating: CQuaternionF32Make(0, 0, 1, 0), count: 5)
+    let t: [Float32] = [-1.5, 0.5, 2.5, 3, 0.25]
+    var result = from
+    CQuaternionF32SlerpBatch(from, to, t, &result, 5)
+
+    for index in 0 ..< 5 {
+      let slerp = CQuaternionF32Slerp(from[index], to[index], t[index])
+      for lane in 0 ..< CInt(4) {
+        XCTAssertEqual(CFloat32x4GetElement(result[index], lane), CFloat32x4GetElement(slerp, lane), accuracy: 1e-5)
+      }
+    }
+  }
+}
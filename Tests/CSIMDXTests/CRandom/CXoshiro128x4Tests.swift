@@ -0,0 +1,136 @@
+import XCTest
+import CSIMDX
+
+final class CXoshiro128x4Tests: XCTestCase {
+
+  /// Scalar reference implementation of a single xoshiro128+ generator
+  private struct Reference {
+    var s: (UInt32, UInt32, UInt32, UInt32)
+
+    mutating func next() -> UInt32 {
+      let result = s.0 &+ s.3
+      let t = s.1 << 9
+      s.2 ^= s.0
+      s.3 ^= s.1
+      s.1 ^= s.2
+      s.0 ^= s.3
+      s.2 ^= t
+      s.3 = s.3 << 11 | s.3 >> 21
+      return result
+    }
+  }
+
+  private func lanes(of state: CXoshiro128x4) -> [Reference] {
+    (Int32(0) ..< 4).map { lane in
+      Reference(s: (
+        CUInt32x4GetElement(state.s0, lane),
+        CUInt32x4GetElement(state.s1, lane),
+        CUInt32x4GetElement(state.s2, lane),
+        CUInt32x4GetElement(state.s3, lane)
+      ))
+    }
+  }
+
+  // MARK: Make
+
+  func testMakeStreams() {
+    let state = CXoshiro128x4Make(42, 0)
+    let other = CXoshiro128x4Make(42, 1)
+
+    XCTAssertNotEqual(CUInt32x4GetElement(state.s0, 0), CUInt32x4GetElement(other.s0, 0))
+    XCTAssertNotEqual(CUInt32x4GetElement(state.s0, 0), CUInt32x4GetElement(state.s0, 1))
+    XCTAssertEqual(CUInt32x4GetElement(state.s3, 3), CUInt32x4GetElement(CXoshiro128x4Make(42, 0).s3, 3))
+  }
+
+  // MARK: Generation
+
+  func testNextUInt32x4() {
+    var state = CXoshiro128x4Make(42, 0)
+    var references = lanes(of: state)
+
+    for _ in 0 ..< 100 {
+      let next = CXoshiro128x4NextUInt32x4(&state)
+      for lane in 0 ..< 4 {
+        XCTAssertEqual(CUInt32x4GetElement(next, Int32(lane)), references[lane].next())
+      }
+    }
+  }
+
+  func testJump() {
+    var state = CXoshiro128x4Make(7, 0)
+    var jumped = state
+    CXoshiro128x4Jump(&jumped)
+
+    // The jumped state must not collide with the near sequence of the original
+    let jumpedFirst = CUInt32x4GetElement(jumped.s0, 0)
+    for _ in 0 ..< 1000 {
+      _ = CXoshiro128x4NextUInt32x4(&state)
+      XCTAssertNotEqual(CUInt32x4GetElement(state.s0, 0), jumpedFirst)
+    }
+  }
+
+  func testNextFloat32x4() {
+    var state = CXoshiro128x4Make(1, 0)
+    var sum: Double = 0
+
+    for _ in 0 ..< 10_000 {
+      let next = CXoshiro128x4NextFloat32x4(&state)
+      for lane in Int32(0) ..< 4 {
+        let value = CFloat32x4GetElement(next, lane)
+        XCTAssertGreaterThanOrEqual(value, 0)
+        XCTAssertLessThan(value, 1)
+        sum += Double(value)
+      }
+    }
+    XCTAssertEqual(sum / 40_000, 0.5, accuracy: 0.01)
+  }
+
+  func testNextNormalFloat32x4() {
+    var state = CXoshiro128x4Make(2, 0)
+    var sum: Double = 0, sumOfSquares: Double = 0
+
+    for _ in 0 ..< 10_000 {
+      var second = CFloat32x4MakeZero()
+      let first = CXoshiro128x4NextNormalFloat32x4(&state, &second)
+      for lane in Int32(0) ..< 4 {
+        for value in [CFloat32x4GetElement(first, lane), CFloat32x4GetElement(second, lane)] {
+          XCTAssertTrue(value.isFinite)
+          sum += Double(value)
+          sumOfSquares += Double(value * value)
+        }
+      }
+    }
+    let mean = sum / 80_000
+    XCTAssertEqual(mean, 0, accuracy: 0.02)
+    XCTAssertEqual(sumOfSquares / 80_000 - mean * mean, 1, accuracy: 0.03)
+  }
+
+  // MARK: Bulk Generation
+
+  func testFillUInt32() {
+    var state = CXoshiro128x4Make(3, 0)
+    var expected = state
+    var buffer = [UInt32](repeating: 0, count: 7)
+    CXoshiro128x4FillUInt32(&state, &buffer, 7)
+
+    let first = CXoshiro128x4NextUInt32x4(&expected)
+    let second = CXoshiro128x4NextUInt32x4(&expected)
+    XCTAssertEqual(buffer[0], CUInt32x4GetElement(first, 0))
+    XCTAssertEqual(buffer[3], CUInt32x4GetElement(first, 3))
+    XCTAssertEqual(buffer[4], CUInt32x4GetElement(second, 0))
+    XCTAssertEqual(buffer[6], CUInt32x4GetElement(second, 2))
+  }
+
+  func testFillNormalFloat32() {
+    var state = CXoshiro128x4Make(4, 0)
+    var expected = state
+    var buffer = [Float32](repeating: .nan, count: 11)
+    CXoshiro128x4FillNormalFloat32(&state, &buffer, 11)
+
+    var second = CFloat32x4MakeZero()
+    let first = CXoshiro128x4NextNormalFloat32x4(&expected, &second)
+    XCTAssertEqual(buffer[0], CFloat32x4GetElement(first, 0))
+    XCTAssertEqual(buffer[7], CFloat32x4GetElement(second, 3))
+    XCTAssertTrue(buffer.allSatisfy { $0.isFinite })
+  }
+}
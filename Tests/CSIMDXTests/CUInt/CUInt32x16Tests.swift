@@ -0,0 +1,341 @@
+import XCTest
+import CSIMDX
+
+final class CUInt32x16Tests: XCTestCase {
+
+  /// There is no `CUInt32x16Make` of 16 elements, so the tests load them instead.
+  private func make(_ elements: [UInt32]) -> CUInt32x16 {
+    var elements = elements
+    return CUInt32x16MakeLoad(&elements)
+  }
+
+  private func elements(of storage: CUInt32x16) -> [UInt32] {
+    (0 ..< CInt(16)).map { CUInt32x16GetElement(storage, $0) }
+  }
+
+  private func lanes(of mask: CInt32x16) -> [Int32] {
+    (0 ..< CInt(16)).map { CInt32x16GetElement(mask, $0) }
+  }
+
+  // MARK: Make
+
+  func testMakeLoad() {
+    var array: [UInt32] = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]
+    let storage = CUInt32x16MakeLoad(&array)
+
+    XCTAssertEqual(elements(of: storage), array)
+  }
+
+  func testMakeRepeatingElement() {
+    let storage = CUInt32x16MakeRepeatingElement(3)
+
+    XCTAssertEqual(elements(of: storage), [UInt32](repeating: 3, count: 16))
+  }
+
+  func testMakeZero() {
+    let storage = CUInt32x16MakeZero()
+
+    XCTAssertEqual(elements(of: storage), [UInt32](repeating: 0, count: 16))
+  }
+
+  // MARK: Access
+
+  func testGetLowAndHigh() {
+    let storage = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let low = CUInt32x16GetLow(storage)
+    let high = CUInt32x16GetHigh(storage)
+
+    XCTAssertEqual((0 ..< CInt(8)).map { CUInt32x8GetElement(low, $0) }, [1, 2, 3, 4, 5, 6, 7, 8])
+    XCTAssertEqual((0 ..< CInt(8)).map { CUInt32x8GetElement(high, $0) }, [9, 10, 11, 12,
+                                                                           13, 14, 15, 16])
+  }
+
+  func testSetElement() {
+    var storage = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    for lane in 0 ..< CInt(16) {
+      CUInt32x16SetElement(&storage, lane, UInt32(lane) + 17)
+    }
+
+    XCTAssertEqual(elements(of: storage), [17, 18, 19, 20,
+                                           21, 22, 23, 24,
+                                           25, 26, 27, 28,
+                                           29, 30, 31, 32])
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+
+    XCTAssertTrue(CUInt32x16Equal(storage, make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])))
+    XCTAssertFalse(CUInt32x16Equal(storage, make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0])))
+    XCTAssertFalse(CUInt32x16Equal(storage, make([0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])))
+  }
+
+  func testCompare() {
+    let lhs = make([1, 2, .max, 0, 5, 6, 0x8000_0000, 7, 8, 9, 10, 11, 12, 13, 14, 15])
+    let rhs = make([1, 3, 0, .max, 4, 6, 0x7FFF_FFFF, 8, 15, 14, 13, 12, 11, 10, 9, 8])
+
+    XCTAssertEqual(lanes(of: CUInt32x16CompareEqual(lhs, rhs)), [-1, 0, 0, 0,
+                                                                 0, -1, 0, 0,
+                                                                 0, 0, 0, 0,
+                                                                 0, 0, 0, 0])
+    XCTAssertEqual(lanes(of: CUInt32x16CompareLessThan(lhs, rhs)), [0, -1, 0, -1,
+                                                                    0, 0, 0, -1,
+                                                                    -1, -1, -1, -1,
+                                                                    0, 0, 0, 0])
+    XCTAssertEqual(lanes(of: CUInt32x16CompareLessThanOrEqual(lhs, rhs)), [-1, -1, 0, -1,
+                                                                           0, -1, 0, -1,
+                                                                           -1, -1, -1, -1,
+                                                                           0, 0, 0, 0])
+  }
+
+  func testSelect() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+    // The lesser elements, selected by the mask of their comparison
+    let storage = CUInt32x16Select(CUInt32x16CompareLessThan(lhs, rhs), lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [1, 2, 3, 4,
+                                           5, 6, 7, 8,
+                                           8, 7, 6, 5,
+                                           4, 3, 2, 1])
+  }
+
+  func testMinimum() {
+    let lhs = make([34, 12, .max, 0, 34, 12, .max, 0, 34, 12, .max, 0, 34, 12, .max, 0])
+    let rhs = make([0, 24, .min, 1, 0, 24, .min, 1, 0, 24, .min, 1, 0, 24, .min, 1])
+    let storage = CUInt32x16Minimum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [0, 12, .min, 0,
+                                           0, 12, .min, 0,
+                                           0, 12, .min, 0,
+                                           0, 12, .min, 0])
+  }
+
+  func testMaximum() {
+    let lhs = make([34, 12, .max, 0, 34, 12, .max, 0, 34, 12, .max, 0, 34, 12, .max, 0])
+    let rhs = make([0, 24, .min, 1, 0, 24, .min, 1, 0, 24, .min, 1, 0, 24, .min, 1])
+    let storage = CUInt32x16Maximum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [34, 24, .max, 1,
+                                           34, 24, .max, 1,
+                                           34, 24, .max, 1,
+                                           34, 24, .max, 1])
+  }
+
+  // MARK: Arithmetic
+
+  func testAdd() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+    let sum = CUInt32x16Add(lhs, rhs)
+
+    XCTAssertEqual(elements(of: sum), [UInt32](repeating: 17, count: 16))
+  }
+
+  func testSubtract() {
+    let lhs = make([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
+    let rhs = make([16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1])
+    let difference = CUInt32x16Subtract(lhs, rhs)
+
+    XCTAssertEqual(elements(of: difference), [.max - 14, .max - 12, .max - 10, .max - 8,
+                                              .max - 6, .max - 4, .max - 2, .max,
+                                              1, 3, 5, 7,
+                                              9, 11, 13, 15])
+  }
+
+  func testMultiply() {
+    let lhs = make([1, 2, 3, .max, 1, 2, 3, .max, 1, 2, 3, .max, 1, 2, 3, .max])
+    let rhs = make([4, 3, 2, 2, 4, 3, 2, 2, 4, 3, 2, 2, 4, 3, 2, 2])
+    let product = CUInt32x16Multiply(lhs, rhs)
+
+    XCTAssertEqual(elements(of: product), [4, 6, 6, .max - 1,
+                                           4, 6, 6, .max - 1,
+                                           4, 6, 6, .max - 1,
+                                           4, 6, 6, .max - 1])
+  }
+
+  // MARK: Binary
+
+  func testBitwiseNot() {
+    let operand = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let storage = CUInt32x16BitwiseNot(operand)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { ~$0 })
+  }
+
+  func testBitwiseAnd() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CUInt32x16BitwiseAnd(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 & $1 })
+  }
+
+  func testBitwiseAndNot() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CUInt32x16BitwiseAndNot(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { ~$0 & $1 })
+  }
+
+  func testBitwiseOr() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CUInt32x16BitwiseOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 | $1 })
+  }
+
+  func testBitwiseExclusiveOr() {
+    let lhs = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                    0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let rhs = make([0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                    0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010])
+    let storage = CUInt32x16BitwiseExclusiveOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 ^ $1 })
+  }
+
+  func testShiftLeft() {
+    let operand = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max])
+    let storage = CUInt32x16ShiftLeft(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 << 2 })
+  }
+
+  func testShiftRight() {
+    let operand = make([0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                        0b0000_1111, 0b1111_0000, 0b0011_1100, 0x8000_0000])
+    let storage = CUInt32x16ShiftRight(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 >> 2 })
+  }
+
+  func testShiftLeftElementWise() {
+    let lhs = make([.max, 0b1111_0000, 0x8000_0000, 1,
+                    .max, 0b1111_0000, 0x8000_0000, 1,
+                    .max, 0b1111_0000, 0x8000_0000, 1,
+                    .max, 0b1111_0000, 0x8000_0000, 1])
+    let rhs = make([31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32])
+    let storage = CUInt32x16ShiftLeftElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [0x8000_0000, 0b1111_0000_0000, 0, 0,
+                                           0x8000_0000, 0b1111_0000_0000, 0, 0,
+                                           0x8000_0000, 0b1111_0000_0000, 0, 0,
+                                           0x8000_0000, 0b1111_0000_0000, 0, 0])
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = make([.max, 0b1111_0000, 0x8000_0000, 0x8000_0000,
+                    .max, 0b1111_0000, 0x8000_0000, 0x8000_0000,
+                    .max, 0b1111_0000, 0x8000_0000, 0x8000_0000,
+                    .max, 0b1111_0000, 0x8000_0000, 0x8000_0000])
+    let rhs = make([31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32, 31, 4, 16, 32])
+    let storage = CUInt32x16ShiftRightElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [1, 0b1111, 0x8000, 0,
+                                           1, 0b1111, 0x8000, 0,
+                                           1, 0b1111, 0x8000, 0,
+                                           1, 0b1111, 0x8000, 0])
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let operand = make([0, 1, 0x8000_0000, .max,
+                        0, 1, 0x8000_0000, .max,
+                        0, 1, 0x8000_0000, .max,
+                        0, 1, 0x8000_0000, .max])
+    let storage = CUInt32x16PopulationCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 1, 1, 32, 0, 1, 1, 32, 0, 1, 1, 32, 0, 1, 1, 32])
+  }
+
+  func testLeadingZeroBitCount() {
+    let operand = make([0, 1, 0x8000_0000, 0xFFFF,
+                        0, 1, 0x8000_0000, 0xFFFF,
+                        0, 1, 0x8000_0000, 0xFFFF,
+                        0, 1, 0x8000_0000, 0xFFFF])
+    let storage = CUInt32x16LeadingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 31, 0, 16,
+                                           32, 31, 0, 16,
+                                           32, 31, 0, 16,
+                                           32, 31, 0, 16])
+  }
+
+  func testTrailingZeroBitCount() {
+    let operand = make([0, 1, 0x8000_0000, 0x10000,
+                        0, 1, 0x8000_0000, 0x10000,
+                        0, 1, 0x8000_0000, 0x10000,
+                        0, 1, 0x8000_0000, 0x10000])
+    let storage = CUInt32x16TrailingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 0, 31, 16,
+                                           32, 0, 31, 16,
+                                           32, 0, 31, 16,
+                                           32, 0, 31, 16])
+  }
+
+  // MARK: Reordering
+
+  func testByteSwap() {
+    let operand = make([0, 1, 0x8000_0000, 0x1234_5678,
+                        0, 1, 0x8000_0000, 0x1234_5678,
+                        0, 1, 0x8000_0000, 0x1234_5678,
+                        0, 1, 0x8000_0000, 0x1234_5678])
+    let storage = CUInt32x16ByteSwap(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412])
+  }
+
+  func testBitReverse() {
+    let operand = make([0, 1, 0x8000_0000, 0x0000_FFFF,
+                        0, 1, 0x8000_0000, 0x0000_FFFF,
+                        0, 1, 0x8000_0000, 0x0000_FFFF,
+                        0, 1, 0x8000_0000, 0x0000_FFFF])
+    let storage = CUInt32x16BitReverse(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 0x8000_0000, 1, 0xFFFF_0000,
+                                           0, 0x8000_0000, 1, 0xFFFF_0000,
+                                           0, 0x8000_0000, 1, 0xFFFF_0000,
+                                           0, 0x8000_0000, 1, 0xFFFF_0000])
+  }
+}
@@ -58,6 +58,14 @@ final class CUInt32x2Tests: XCTestCase {
 
   // MARK: Comparison
 
+  func testEqual() {
+    let storage = CUInt32x2Make(1, .max)
+
+    XCTAssertTrue(CUInt32x2Equal(storage, CUInt32x2Make(1, .max)))
+    XCTAssertFalse(CUInt32x2Equal(storage, CUInt32x2Make(1, 0)))
+    XCTAssertFalse(CUInt32x2Equal(storage, CUInt32x2Make(0, .max)))
+  }
+
   func testMinimum() {
     let lhs = CUInt32x2Make(34, 12)
     let rhs = CUInt32x2Make(34, 24)
@@ -67,6 +75,13 @@ final class CUInt32x2Tests: XCTestCase {
     XCTAssertEqual(CUInt32x2GetElement(storage, 1), 12)
   }
 
+  func testMinimumAboveSignedRange() {
+    let storage = CUInt32x2Minimum(CUInt32x2Make(.max, 1), CUInt32x2Make(1, 0x8000_0000))
+
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 1)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 1)
+  }
+
   func testMaximum() {
     let lhs = CUInt32x2Make(34, 12)
     let rhs = CUInt32x2Make(34, 24)
@@ -76,6 +91,13 @@ final class CUInt32x2Tests: XCTestCase {
     XCTAssertEqual(CUInt32x2GetElement(storage, 1), 24)
   }
 
+  func testMaximumAboveSignedRange() {
+    let storage = CUInt32x2Maximum(CUInt32x2Make(.max, 1), CUInt32x2Make(1, 0x8000_0000))
+
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), .max)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0x8000_0000)
+  }
+
   // MARK: Arithmetic
 
   func testAdd() {
@@ -161,6 +183,64 @@ final class CUInt32x2Tests: XCTestCase {
     XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0b0000_1111 >> 2)
   }
 
+  func testShiftLeftElementWise() {
+    let lhs = CUInt32x2Make(0xFFFF_FFFF, 0b1111_0000)
+    let storage = CUInt32x2ShiftLeftElementWise(lhs, CUInt32x2Make(31, 4))
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 0x8000_0000)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0b1111_0000_0000)
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = CUInt32x2Make(0xFFFF_FFFF, 0b1111_0000)
+    let storage = CUInt32x2ShiftRightElementWise(lhs, CUInt32x2Make(31, 4))
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 1)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0b1111)
+  }
+
+  func testShiftElementWiseByElementWidth() {
+    let lhs = CUInt32x2Make(0xFFFF_FFFF, 0xFFFF_FFFF)
+    let count = CUInt32x2Make(32, 0x8000_0001)
+    let left = CUInt32x2ShiftLeftElementWise(lhs, count)
+    let right = CUInt32x2ShiftRightElementWise(lhs, count)
+
+    XCTAssertEqual(CUInt32x2GetElement(left, 0), 0)
+    XCTAssertEqual(CUInt32x2GetElement(left, 1), 0)
+    XCTAssertEqual(CUInt32x2GetElement(right, 0), 0)
+    XCTAssertEqual(CUInt32x2GetElement(right, 1), 0)
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let storage = CUInt32x2PopulationCount(CUInt32x2Make(0, 0x8000_0001))
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 2)
+  }
+
+  func testLeadingZeroBitCount() {
+    let storage = CUInt32x2LeadingZeroBitCount(CUInt32x2Make(0, 0x8000_0001))
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 32)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0)
+  }
+
+  func testTrailingZeroBitCount() {
+    let storage = CUInt32x2TrailingZeroBitCount(CUInt32x2Make(0, 0x8000_0001))
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 32)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0)
+  }
+
+  func testByteSwap() {
+    let storage = CUInt32x2ByteSwap(CUInt32x2Make(0, 0x8000_0001))
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0x0100_0080)
+  }
+
+  func testBitReverse() {
+    let storage = CUInt32x2BitReverse(CUInt32x2Make(0, 0x8000_0001))
+    XCTAssertEqual(CUInt32x2GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x2GetElement(storage, 1), 0x8000_0001)
+  }
+
 //  // MARK: Conversion
 //
 //  func testConvertFromFloat32x2() {
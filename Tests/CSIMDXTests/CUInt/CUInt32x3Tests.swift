@@ -65,6 +65,14 @@ final class CUInt32x3Tests: XCTestCase {
   
   // MARK: Comparison
   
+  func testEqual() {
+    let storage = CUInt32x3Make(1, .max, .min)
+
+    XCTAssertTrue(CUInt32x3Equal(storage, CUInt32x3Make(1, .max, .min)))
+    XCTAssertFalse(CUInt32x3Equal(storage, CUInt32x3Make(1, .max, 0)))
+    XCTAssertFalse(CUInt32x3Equal(storage, CUInt32x3Make(0, .max, .min)))
+  }
+
   func testMinimum() {
     let lhs = CUInt32x3Make(34, 12, .max)
     let rhs = CUInt32x3Make(34, 24, .min)
@@ -178,6 +186,59 @@ final class CUInt32x3Tests: XCTestCase {
     XCTAssertEqual(CUInt32x3GetElement(storage, 1), 0b0000_1111 >> 2)
     XCTAssertEqual(CUInt32x3GetElement(storage, 2), 0b0011_1100 >> 2)
   }
+
+  func testShiftLeftElementWise() {
+    let lhs = CUInt32x3Make(0xFFFF_FFFF, 0b1111_0000, 1)
+    let storage = CUInt32x3ShiftLeftElementWise(lhs, CUInt32x3Make(31, 4, 0))
+    XCTAssertEqual(CUInt32x3GetElement(storage, 0), 0x8000_0000)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 1), 0b1111_0000_0000)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 2), 1)
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = CUInt32x3Make(0xFFFF_FFFF, 0b1111_0000, 1)
+    let storage = CUInt32x3ShiftRightElementWise(lhs, CUInt32x3Make(31, 4, 0))
+    XCTAssertEqual(CUInt32x3GetElement(storage, 0), 1)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 1), 0b1111)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 2), 1)
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let storage = CUInt32x3PopulationCount(CUInt32x3Make(0, 1, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 1), 1)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 2), 13)
+  }
+
+  func testLeadingZeroBitCount() {
+    let storage = CUInt32x3LeadingZeroBitCount(CUInt32x3Make(0, 1, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x3GetElement(storage, 0), 32)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 1), 31)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 2), 0)
+  }
+
+  func testTrailingZeroBitCount() {
+    let storage = CUInt32x3TrailingZeroBitCount(CUInt32x3Make(0, 1, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x3GetElement(storage, 0), 32)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 1), 0)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 2), 2)
+  }
+
+  func testByteSwap() {
+    let storage = CUInt32x3ByteSwap(CUInt32x3Make(0, 1, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 1), 0x0100_0000)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 2), 0x3412_F0F0)
+  }
+
+  func testBitReverse() {
+    let storage = CUInt32x3BitReverse(CUInt32x3Make(0, 1, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x3GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 1), 0x8000_0000)
+    XCTAssertEqual(CUInt32x3GetElement(storage, 2), 0x2C48_0F0F)
+  }
   
   //  // MARK: Conversion
   //
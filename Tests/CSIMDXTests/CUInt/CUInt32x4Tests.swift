@@ -74,6 +74,47 @@ final class CUInt32x4Tests: XCTestCase {
 
   // MARK: Comparison
 
+  func testEqual() {
+    let storage = CUInt32x4Make(1, .max, .min, 4)
+
+    XCTAssertTrue(CUInt32x4Equal(storage, CUInt32x4Make(1, .max, .min, 4)))
+    XCTAssertFalse(CUInt32x4Equal(storage, CUInt32x4Make(1, .max, .min, 0)))
+    XCTAssertFalse(CUInt32x4Equal(storage, CUInt32x4Make(0, .max, .min, 4)))
+  }
+
+  func testCompare() {
+    let lhs = CUInt32x4Make(1, .max, 3, 4)
+    let rhs = CUInt32x4Make(1, 2, .max, 3)
+
+    let equal = CUInt32x4CompareEqual(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(equal, 0), -1)
+    XCTAssertEqual(CInt32x4GetElement(equal, 1), 0)
+    XCTAssertEqual(CInt32x4GetElement(equal, 2), 0)
+    XCTAssertEqual(CInt32x4GetElement(equal, 3), 0)
+
+    let lessThan = CUInt32x4CompareLessThan(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 0), 0)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 1), 0)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 2), -1)
+    XCTAssertEqual(CInt32x4GetElement(lessThan, 3), 0)
+
+    let lessThanOrEqual = CUInt32x4CompareLessThanOrEqual(lhs, rhs)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 0), -1)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 1), 0)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 2), -1)
+    XCTAssertEqual(CInt32x4GetElement(lessThanOrEqual, 3), 0)
+  }
+
+  func testSelect() {
+    let mask = CInt32x4Make(0, -1, -1, 0)
+    let storage = CUInt32x4Select(mask, CUInt32x4Make(1, 2, 3, 4), CUInt32x4Make(5, 6, 7, .max))
+
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 5)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 2)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 3)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), .max)
+  }
+
   func testMinimum() {
     let lhs = CUInt32x4Make(34, 12, .max, .min)
     let rhs = CUInt32x4Make(34, 24, .min, .max)
@@ -201,6 +242,66 @@ final class CUInt32x4Tests: XCTestCase {
     XCTAssertEqual(CUInt32x4GetElement(storage, 3), 0b1010_1010 >> 2)
   }
 
+  func testShiftLeftElementWise() {
+    let lhs = CUInt32x4Make(0xFFFF_FFFF, 0b1111_0000, 1, 0x8000_0000)
+    let storage = CUInt32x4ShiftLeftElementWise(lhs, CUInt32x4Make(31, 4, 0, 16))
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 0x8000_0000)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 0b1111_0000_0000)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 1)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), 0)
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = CUInt32x4Make(0xFFFF_FFFF, 0b1111_0000, 1, 0x8000_0000)
+    let storage = CUInt32x4ShiftRightElementWise(lhs, CUInt32x4Make(31, 4, 0, 16))
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 1)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 0b1111)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 1)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), 0x8000)
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let storage = CUInt32x4PopulationCount(CUInt32x4Make(0, 1, 0x8000_0000, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 1)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 1)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), 13)
+  }
+
+  func testLeadingZeroBitCount() {
+    let storage = CUInt32x4LeadingZeroBitCount(CUInt32x4Make(0, 1, 0x8000_0000, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 32)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 31)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 0)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), 0)
+  }
+
+  func testTrailingZeroBitCount() {
+    let storage = CUInt32x4TrailingZeroBitCount(CUInt32x4Make(0, 1, 0x8000_0000, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 32)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 0)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 31)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), 2)
+  }
+
+  func testByteSwap() {
+    let storage = CUInt32x4ByteSwap(CUInt32x4Make(0, 1, 0x8000_0000, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 0x0100_0000)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 128)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), 0x3412_F0F0)
+  }
+
+  func testBitReverse() {
+    let storage = CUInt32x4BitReverse(CUInt32x4Make(0, 1, 0x8000_0000, 0xF0F0_1234))
+    XCTAssertEqual(CUInt32x4GetElement(storage, 0), 0)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 1), 0x8000_0000)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 2), 1)
+    XCTAssertEqual(CUInt32x4GetElement(storage, 3), 0x2C48_0F0F)
+  }
+
 //  // MARK: Conversion
 //
 //  func testConvertFromFloat32x4() {
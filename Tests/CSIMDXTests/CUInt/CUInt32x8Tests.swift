@@ -0,0 +1,254 @@
+import XCTest
+import CSIMDX
+
+final class CUInt32x8Tests: XCTestCase {
+
+  private func elements(of storage: CUInt32x8) -> [UInt32] {
+    (0 ..< CInt(8)).map { CUInt32x8GetElement(storage, $0) }
+  }
+
+  private func lanes(of mask: CInt32x8) -> [Int32] {
+    (0 ..< CInt(8)).map { CInt32x8GetElement(mask, $0) }
+  }
+
+  // MARK: Make
+
+  func testMake() {
+    let storage = CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertEqual(elements(of: storage), [1, 2, 3, 4, 5, 6, 7, 8])
+  }
+
+  func testMakeLoad() {
+    var array: [UInt32] = [1, 2, 3, 4, 5, 6, 7, 8]
+    let storage = CUInt32x8MakeLoad(&array)
+
+    XCTAssertEqual(elements(of: storage), array)
+  }
+
+  func testMakeRepeatingElement() {
+    let storage = CUInt32x8MakeRepeatingElement(3)
+
+    XCTAssertEqual(elements(of: storage), [UInt32](repeating: 3, count: 8))
+  }
+
+  func testMakeZero() {
+    let storage = CUInt32x8MakeZero()
+
+    XCTAssertEqual(elements(of: storage), [UInt32](repeating: 0, count: 8))
+  }
+
+  // MARK: Access
+
+  func testGetLowAndHigh() {
+    let storage = CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let low = CUInt32x8GetLow(storage)
+    let high = CUInt32x8GetHigh(storage)
+
+    XCTAssertEqual((0 ..< CInt(4)).map { CUInt32x4GetElement(low, $0) }, [1, 2, 3, 4])
+    XCTAssertEqual((0 ..< CInt(4)).map { CUInt32x4GetElement(high, $0) }, [5, 6, 7, 8])
+  }
+
+  func testSetElement() {
+    var storage = CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    for lane in 0 ..< CInt(8) {
+      CUInt32x8SetElement(&storage, lane, UInt32(lane) + 9)
+    }
+
+    XCTAssertEqual(elements(of: storage), [9, 10, 11, 12, 13, 14, 15, 16])
+  }
+
+  // MARK: Comparison
+
+  func testEqual() {
+    let storage = CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+
+    XCTAssertTrue(CUInt32x8Equal(storage, CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)))
+    XCTAssertFalse(CUInt32x8Equal(storage, CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 0)))
+    XCTAssertFalse(CUInt32x8Equal(storage, CUInt32x8Make(0, 2, 3, 4, 5, 6, 7, 8)))
+  }
+
+  func testCompare() {
+    let lhs = CUInt32x8Make(1, 2, .max, 0, 5, 6, 0x8000_0000, 7)
+    let rhs = CUInt32x8Make(1, 3, 0, .max, 4, 6, 0x7FFF_FFFF, 8)
+
+    XCTAssertEqual(lanes(of: CUInt32x8CompareEqual(lhs, rhs)), [-1, 0, 0, 0, 0, -1, 0, 0])
+    XCTAssertEqual(lanes(of: CUInt32x8CompareLessThan(lhs, rhs)), [0, -1, 0, -1, 0, 0, 0, -1])
+    XCTAssertEqual(lanes(of: CUInt32x8CompareLessThanOrEqual(lhs, rhs)), [-1, -1, 0, -1, 0, -1, 0, -1])
+  }
+
+  func testSelect() {
+    let mask = CInt32x8Make(-1, 0, 0, -1, 0, -1, -1, 0)
+    let storage = CUInt32x8Select(mask, CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8), CUInt32x8Make(9, 10, 11, 12, 13, 14, 15, 16))
+
+    XCTAssertEqual(elements(of: storage), [1, 10, 11, 4, 13, 6, 7, 16])
+  }
+
+  func testMinimum() {
+    let lhs = CUInt32x8Make(34, 12, .max, 0, 34, 12, .max, 0)
+    let rhs = CUInt32x8Make(0, 24, .min, 1, 0, 24, .min, 1)
+    let storage = CUInt32x8Minimum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [0, 12, .min, 0, 0, 12, .min, 0])
+  }
+
+  func testMaximum() {
+    let lhs = CUInt32x8Make(34, 12, .max, 0, 34, 12, .max, 0)
+    let rhs = CUInt32x8Make(0, 24, .min, 1, 0, 24, .min, 1)
+    let storage = CUInt32x8Maximum(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [34, 24, .max, 1, 34, 24, .max, 1])
+  }
+
+  // MARK: Arithmetic
+
+  func testAdd() {
+    let lhs = CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CUInt32x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+    let sum = CUInt32x8Add(lhs, rhs)
+
+    XCTAssertEqual(elements(of: sum), [UInt32](repeating: 9, count: 8))
+  }
+
+  func testSubtract() {
+    let lhs = CUInt32x8Make(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = CUInt32x8Make(8, 7, 6, 5, 4, 3, 2, 1)
+    let difference = CUInt32x8Subtract(lhs, rhs)
+
+    XCTAssertEqual(elements(of: difference), [.max - 6, .max - 4, .max - 2, .max, 1, 3, 5, 7])
+  }
+
+  func testMultiply() {
+    let lhs = CUInt32x8Make(1, 2, 3, .max, 1, 2, 3, .max)
+    let rhs = CUInt32x8Make(4, 3, 2, 2, 4, 3, 2, 2)
+    let product = CUInt32x8Multiply(lhs, rhs)
+
+    XCTAssertEqual(elements(of: product), [4, 6, 6, .max - 1, 4, 6, 6, .max - 1])
+  }
+
+  // MARK: Binary
+
+  func testBitwiseNot() {
+    let operand = CUInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                                0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let storage = CUInt32x8BitwiseNot(operand)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { ~$0 })
+  }
+
+  func testBitwiseAnd() {
+    let lhs = CUInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                            0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CUInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                            0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CUInt32x8BitwiseAnd(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 & $1 })
+  }
+
+  func testBitwiseAndNot() {
+    let lhs = CUInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                            0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CUInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                            0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CUInt32x8BitwiseAndNot(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { ~$0 & $1 })
+  }
+
+  func testBitwiseOr() {
+    let lhs = CUInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                            0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CUInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                            0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CUInt32x8BitwiseOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 | $1 })
+  }
+
+  func testBitwiseExclusiveOr() {
+    let lhs = CUInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                            0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let rhs = CUInt32x8Make(0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010,
+                            0b1111_1111, 0b0000_0000, 0b1100_0011, 0b1010)
+    let storage = CUInt32x8BitwiseExclusiveOr(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), zip(elements(of: lhs), elements(of: rhs)).map { $0 ^ $1 })
+  }
+
+  func testShiftLeft() {
+    let operand = CUInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                                0b0000_1111, 0b1111_0000, 0b0011_1100, .max)
+    let storage = CUInt32x8ShiftLeft(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 << 2 })
+  }
+
+  func testShiftRight() {
+    let operand = CUInt32x8Make(0b0000_1111, 0b1111_0000, 0b0011_1100, .max,
+                                0b0000_1111, 0b1111_0000, 0b0011_1100, 0x8000_0000)
+    let storage = CUInt32x8ShiftRight(operand, 2)
+
+    XCTAssertEqual(elements(of: storage), elements(of: operand).map { $0 >> 2 })
+  }
+
+  func testShiftLeftElementWise() {
+    let lhs = CUInt32x8Make(.max, 0b1111_0000, 0x8000_0000, 1, .max, 0b1111_0000, 0x8000_0000, 1)
+    let rhs = CUInt32x8Make(31, 4, 16, 32, 31, 4, 16, 32)
+    let storage = CUInt32x8ShiftLeftElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [0x8000_0000, 0b1111_0000_0000, 0, 0,
+                                           0x8000_0000, 0b1111_0000_0000, 0, 0])
+  }
+
+  func testShiftRightElementWise() {
+    let lhs = CUInt32x8Make(.max, 0b1111_0000, 0x8000_0000, 0x8000_0000,
+                            .max, 0b1111_0000, 0x8000_0000, 0x8000_0000)
+    let rhs = CUInt32x8Make(31, 4, 16, 32, 31, 4, 16, 32)
+    let storage = CUInt32x8ShiftRightElementWise(lhs, rhs)
+
+    XCTAssertEqual(elements(of: storage), [1, 0b1111, 0x8000, 0, 1, 0b1111, 0x8000, 0])
+  }
+
+  // MARK: Counting
+
+  func testPopulationCount() {
+    let operand = CUInt32x8Make(0, 1, 0x8000_0000, .max, 0, 1, 0x8000_0000, .max)
+    let storage = CUInt32x8PopulationCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 1, 1, 32, 0, 1, 1, 32])
+  }
+
+  func testLeadingZeroBitCount() {
+    let operand = CUInt32x8Make(0, 1, 0x8000_0000, 0xFFFF, 0, 1, 0x8000_0000, 0xFFFF)
+    let storage = CUInt32x8LeadingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 31, 0, 16, 32, 31, 0, 16])
+  }
+
+  func testTrailingZeroBitCount() {
+    let operand = CUInt32x8Make(0, 1, 0x8000_0000, 0x10000, 0, 1, 0x8000_0000, 0x10000)
+    let storage = CUInt32x8TrailingZeroBitCount(operand)
+
+    XCTAssertEqual(elements(of: storage), [32, 0, 31, 16, 32, 0, 31, 16])
+  }
+
+  // MARK: Reordering
+
+  func testByteSwap() {
+    let operand = CUInt32x8Make(0, 1, 0x8000_0000, 0x1234_5678, 0, 1, 0x8000_0000, 0x1234_5678)
+    let storage = CUInt32x8ByteSwap(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 0x0100_0000, 128, 0x7856_3412,
+                                           0, 0x0100_0000, 128, 0x7856_3412])
+  }
+
+  func testBitReverse() {
+    let operand = CUInt32x8Make(0, 1, 0x8000_0000, 0x0000_FFFF, 0, 1, 0x8000_0000, 0x0000_FFFF)
+    let storage = CUInt32x8BitReverse(operand)
+
+    XCTAssertEqual(elements(of: storage), [0, 0x8000_0000, 1, 0xFFFF_0000,
+                                           0, 0x8000_0000, 1, 0xFFFF_0000])
+  }
+}
@@ -0,0 +1,44 @@
+import XCTest
+import Foundation
+
+/// Runs `Scripts/codegen-check.py` on each input in `Inputs`, which compiles
+/// representative SIMDX and CSIMDX operations with optimizations and matches
+/// the assembly against the patterns in their comments.
+final class CodegenTests: XCTestCase {
+
+  private let root = URL(fileURLWithPath: #filePath)
+    .deletingLastPathComponent()
+    .deletingLastPathComponent()
+    .deletingLastPathComponent()
+
+  private var inputs: [URL] {
+    let directory = root.appendingPathComponent("Tests/CodegenTests/Inputs")
+    let names = (try? FileManager.default.contentsOfDirectory(atPath: directory.path)) ?? []
+    return names.sorted()
+      .filter { $0.hasSuffix(".c") || $0.hasSuffix(".swift") }
+      .map { directory.appendingPathComponent($0) }
+  }
+
+  func testCodegen() throws {
+    #if os(macOS) || os(Linux)
+    XCTAssertFalse(inputs.isEmpty)
+    for input in inputs {
+      let process = Process()
+      let pipe = Pipe()
+      process.executableURL = URL(fileURLWithPath: "/usr/bin/env")
+      process.arguments = ["python3", root.appendingPathComponent("Scripts/codegen-check.py").path, input.path]
+      process.standardOutput = pipe
+      process.standardError = pipe
+      try process.run()
+      let output = String(decoding: pipe.fileHandleForReading.readDataToEndOfFile(), as: UTF8.self)
+      process.waitUntilExit()
+      if process.terminationStatus == 127 {
+        throw XCTSkip("python3 is not available")
+      }
+      XCTAssertEqual(process.terminationStatus, 0, "\(input.lastPathComponent):\n\(output)")
+    }
+    #else
+    throw XCTSkip("The codegen checks run on the build host only")
+    #endif
+  }
+}
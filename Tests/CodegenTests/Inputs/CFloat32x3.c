@@ -0,0 +1,70 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// RUN: x86_64: -msse2 | CHECK,X86,SSE2
+// RUN: x86_64: -msse4.1 | CHECK,X86,SSE41
+// RUN: arm64: | CHECK,ARM64
+
+#include <CSIMDX.h>
+
+// CHECK-LABEL: codegen_float32x3_dot:
+// SSE2: mulps
+// SSE41: dpps
+// ARM64: fmul v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+float codegen_float32x3_dot(CFloat32x3 lhs, CFloat32x3 rhs)
+{
+  return CFloat32x3Dot(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x3_cross:
+// X86: shufps
+// X86: mulps
+// X86: subps
+// ARM64: fmul v{{[0-9]+}}.4s
+// ARM64: fsub v{{[0-9]+}}.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x3 codegen_float32x3_cross(CFloat32x3 lhs, CFloat32x3 rhs)
+{
+  return CFloat32x3Cross(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x3_fast_normalize:
+// X86: rsqrt
+// ARM64: frsqrte
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x3 codegen_float32x3_fast_normalize(CFloat32x3 operand)
+{
+  return CFloat32x3FastNormalize(operand);
+}
+
+// A load of 3 elements must not read the 4th, which may be on an unmapped page.
+// CHECK-LABEL: codegen_float32x3_make_load:
+// X86: movq{{\s+}}(%rdi)
+// X86: movss{{\s+}}8(%rdi)
+// ARM64: ldr{{\s+}}d{{[0-9]+}}, [x0]
+// CHECK-NOT: {{movups|movaps|ldr q}}
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK: ret
+CFloat32x3 codegen_float32x3_make_load(const float* pointer)
+{
+  return CFloat32x3MakeLoad(pointer);
+}
@@ -0,0 +1,210 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: x86_64: -msse2 | CHECK,X86,SSE2
+// RUN: x86_64: -msse4.1 | CHECK,X86,SSE41
+// RUN: x86_64: -mavx2 -mfma | CHECK,X86,FMA
+// RUN: arm64: | CHECK,ARM64
+
+#include <CSIMDX.h>
+
+// CHECK-LABEL: codegen_float32x4_add:
+// X86: addps
+// ARM64: fadd v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_add(CFloat32x4 lhs, CFloat32x4 rhs)
+{
+  return CFloat32x4Add(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x4_multiply:
+// X86: mulps
+// ARM64: fmul v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_multiply(CFloat32x4 lhs, CFloat32x4 rhs)
+{
+  return CFloat32x4Multiply(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x4_divide:
+// X86: divps
+// ARM64: fdiv v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_divide(CFloat32x4 lhs, CFloat32x4 rhs)
+{
+  return CFloat32x4Divide(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x4_minimum:
+// X86: minps
+// ARM64: fmin v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_minimum(CFloat32x4 lhs, CFloat32x4 rhs)
+{
+  return CFloat32x4Minimum(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x4_ieee_maximum:
+// X86: maxps
+// X86: andps
+// X86: orps
+// ARM64: fmax v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_ieee_maximum(CFloat32x4 lhs, CFloat32x4 rhs)
+{
+  return CFloat32x4IEEEMaximum(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x4_square_root:
+// X86: sqrtps
+// ARM64: fsqrt v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_square_root(CFloat32x4 operand)
+{
+  return CFloat32x4SquareRoot(operand);
+}
+
+// CHECK-LABEL: codegen_float32x4_multiply_add:
+// SSE2: mulps
+// SSE2-NEXT: addps
+// SSE41: mulps
+// SSE41-NEXT: addps
+// FMA: vfmadd
+// ARM64: fmla v{{[0-9]+}}.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_multiply_add(CFloat32x4 lhs, CFloat32x4 rhs, CFloat32x4 addend)
+{
+  return CFloat32x4MultiplyAdd(lhs, rhs, addend);
+}
+
+// The element is broadcast within the register, or used as a lane operand.
+// CHECK-LABEL: codegen_float32x4_multiply_element:
+// SSE2: shufps
+// SSE2-NEXT: mulps
+// SSE41: shufps
+// SSE41-NEXT: mulps
+// FMA: {{vbroadcastss|vshufps}}
+// FMA-NEXT: vmulps
+// ARM64: fmul v0.4s, v0.4s, v1.s[0]
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_multiply_element(CFloat32x4 lhs, float rhs)
+{
+  return CFloat32x4MultiplyElement(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x4_multiply_element_add:
+// SSE2: mulps
+// SSE2: addps
+// SSE41: mulps
+// SSE41: addps
+// FMA: {{vbroadcastss|vshufps}}
+// FMA-NEXT: vfmadd
+// ARM64: fmla v{{[0-9]+}}.4s, v{{[0-9]+}}.4s, v1.s[0]
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_multiply_element_add(CFloat32x4 lhs, float rhs, CFloat32x4 addend)
+{
+  return CFloat32x4MultiplyElementAdd(lhs, rhs, addend);
+}
+
+// A constant lane stays within the register, without a round trip through memory.
+// CHECK-LABEL: codegen_float32x4_extract_lane:
+// X86: {{movhlps|shufps|unpckhps}}
+// ARM64: mov s0, v0.s[2]
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+float codegen_float32x4_extract_lane(CFloat32x4 storage)
+{
+  return CFloat32x4ExtractLane(storage, 2);
+}
+
+// CHECK-LABEL: codegen_float32x4_insert_lane:
+// SSE2: shufps
+// SSE41: insertps
+// FMA: vinsertps
+// ARM64: mov v0.s[2], v1.s[0]
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_insert_lane(CFloat32x4 storage, float value)
+{
+  return CFloat32x4InsertLane(storage, 2, value);
+}
+
+// CHECK-LABEL: codegen_float32x4_equal:
+// X86: cmpeqps
+// X86: movmskps
+// ARM64: fcmeq v0.4s
+// ARM64: uminv
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+bool codegen_float32x4_equal(CFloat32x4 lhs, CFloat32x4 rhs)
+{
+  return CFloat32x4Equal(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_float32x4_masked_add:
+// X86: cmpltps
+// SSE2: andps
+// SSE41: blendvps
+// FMA: vblendvps
+// ARM64: {{bsl|bit|bif}}
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CFloat32x4 codegen_float32x4_masked_add(CFloat32x4 lhs, CFloat32x4 rhs)
+{
+  CInt32x4 mask = CFloat32x4CompareLessThan(lhs, rhs);
+  return CFloat32x4Select(mask, CFloat32x4Add(lhs, rhs), lhs);
+}
+
+// A reinterpretation keeps the register as is, so it must not emit any move.
+// CHECK-LABEL: codegen_float32x4_reinterpret_as_uint32x4:
+// CHECK-NOT: {{mov|cvt|call|jmp|\sbl?\s}}
+// CHECK: ret
+CUInt32x4 codegen_float32x4_reinterpret_as_uint32x4(CFloat32x4 operand)
+{
+  return CFloat32x4ReinterpretAsCUInt32x4(operand);
+}
+
+// CHECK-LABEL: codegen_float32x4_biased_exponent:
+// X86: psrld
+// ARM64: ushr
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CUInt32x4 codegen_float32x4_biased_exponent(CFloat32x4 operand)
+{
+  CUInt32x4 bits = CFloat32x4ReinterpretAsCUInt32x4(operand);
+  return CUInt32x4BitwiseAnd(CUInt32x4ShiftRight(bits, 23), CUInt32x4MakeRepeatingElement(0xFF));
+}
@@ -0,0 +1,78 @@
+// Copyright 2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// RUN: x86_64: -msse2 | CHECK,X86,SSE2
+// RUN: x86_64: -msse4.1 | CHECK,X86,SSE41
+// RUN: arm64: | CHECK,ARM64
+
+#include <CSIMDX.h>
+
+// CHECK-LABEL: codegen_uint32x4_add:
+// X86: paddd
+// ARM64: add v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CUInt32x4 codegen_uint32x4_add(CUInt32x4 lhs, CUInt32x4 rhs)
+{
+  return CUInt32x4Add(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_uint32x4_multiply:
+// SSE2: pmuludq
+// SSE41: pmulld
+// ARM64: mul v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CUInt32x4 codegen_uint32x4_multiply(CUInt32x4 lhs, CUInt32x4 rhs)
+{
+  return CUInt32x4Multiply(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_uint32x4_minimum:
+// SSE41: pminud
+// ARM64: umin v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CUInt32x4 codegen_uint32x4_minimum(CUInt32x4 lhs, CUInt32x4 rhs)
+{
+  return CUInt32x4Minimum(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_uint32x4_compare:
+// X86: pcmpeqd
+// ARM64: cmeq v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+CUInt32x4 codegen_uint32x4_compare(CUInt32x4 lhs, CUInt32x4 rhs)
+{
+  return CUInt32x4CompareElementWise(lhs, rhs);
+}
+
+// CHECK-LABEL: codegen_uint32x4_equal:
+// X86: pcmpeqd
+// X86: pmovmskb
+// ARM64: cmeq v0.4s
+// ARM64: uminv
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+bool codegen_uint32x4_equal(CUInt32x4 lhs, CUInt32x4 rhs)
+{
+  return CUInt32x4Equal(lhs, rhs);
+}
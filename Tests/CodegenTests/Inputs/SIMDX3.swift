@@ -0,0 +1,52 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: x86_64: | CHECK,X86
+// RUN: arm64: | CHECK,ARM64
+
+import SIMDX
+
+// CHECK-LABEL: codegen_simdx3_float_dot:
+// X86: mulps
+// ARM64: fmul v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx3_float_dot")
+public func dot(_ lhs: SIMDX3<Float>, _ rhs: SIMDX3<Float>) -> Float {
+  SIMDX3.dot(lhs, rhs)
+}
+
+// CHECK-LABEL: codegen_simdx3_float_cross:
+// X86: mulps
+// X86: subps
+// ARM64: fsub v{{[0-9]+}}.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx3_float_cross")
+public func cross(_ lhs: SIMDX3<Float>, _ rhs: SIMDX3<Float>) -> SIMDX3<Float> {
+  SIMDX3.cross(lhs, rhs)
+}
+
+// CHECK-LABEL: codegen_simdx3_float_add:
+// X86: addps
+// ARM64: fadd v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx3_float_add")
+public func add(_ lhs: SIMDX3<Float>, _ rhs: SIMDX3<Float>) -> SIMDX3<Float> {
+  lhs + rhs
+}
@@ -0,0 +1,131 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: x86_64: | CHECK,X86
+// RUN: arm64: | CHECK,ARM64
+
+import SIMDX
+
+// The operators of SIMDX and its storages are transparent, so each of these
+// functions is expected to lower to the single instruction of the operation.
+
+// CHECK-LABEL: codegen_simdx4_float_add:
+// X86: addps
+// ARM64: fadd v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_add")
+public func add(_ lhs: SIMDX4<Float>, _ rhs: SIMDX4<Float>) -> SIMDX4<Float> {
+  lhs + rhs
+}
+
+// CHECK-LABEL: codegen_simdx4_float_subtract:
+// X86: subps
+// ARM64: fsub v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_subtract")
+public func subtract(_ lhs: SIMDX4<Float>, _ rhs: SIMDX4<Float>) -> SIMDX4<Float> {
+  lhs - rhs
+}
+
+// CHECK-LABEL: codegen_simdx4_float_multiply:
+// X86: mulps
+// ARM64: fmul v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_multiply")
+public func multiply(_ lhs: SIMDX4<Float>, _ rhs: SIMDX4<Float>) -> SIMDX4<Float> {
+  lhs * rhs
+}
+
+// CHECK-LABEL: codegen_simdx4_float_divide:
+// X86: divps
+// ARM64: fdiv v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_divide")
+public func divide(_ lhs: SIMDX4<Float>, _ rhs: SIMDX4<Float>) -> SIMDX4<Float> {
+  lhs / rhs
+}
+
+// CHECK-LABEL: codegen_simdx4_float_multiply_element:
+// X86: mulps
+// ARM64: fmul v0.4s, v0.4s, v1.s[0]
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_multiply_element")
+public func multiply(_ lhs: SIMDX4<Float>, _ rhs: Float) -> SIMDX4<Float> {
+  lhs * rhs
+}
+
+// CHECK-LABEL: codegen_simdx4_float_negate:
+// X86: xorps
+// ARM64: fneg v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_negate")
+public func negate(_ operand: SIMDX4<Float>) -> SIMDX4<Float> {
+  -operand
+}
+
+// CHECK-LABEL: codegen_simdx4_float_subscript:
+// X86: {{movhlps|shufps|unpckhps}}
+// ARM64: mov s0, v0.s[2]
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_subscript")
+public func element(_ operand: SIMDX4<Float>) -> Float {
+  operand[2]
+}
+
+// CHECK-LABEL: codegen_simdx4_int32_add:
+// X86: paddd
+// ARM64: add v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_int32_add")
+public func add(_ lhs: SIMDX4<Int32>, _ rhs: SIMDX4<Int32>) -> SIMDX4<Int32> {
+  lhs + rhs
+}
+
+// CHECK-LABEL: codegen_simdx4_int32_bitwise_and:
+// X86: {{pand|andps}}
+// ARM64: and v0.16b
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_int32_bitwise_and")
+public func bitwiseAnd(_ lhs: SIMDX4<Int32>, _ rhs: SIMDX4<Int32>) -> SIMDX4<Int32> {
+  lhs & rhs
+}
+
+// CHECK-LABEL: codegen_simdx4_int32_shift_right:
+// X86: psrad
+// ARM64: sshl v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_int32_shift_right")
+public func shiftRight(_ lhs: SIMDX4<Int32>, _ rhs: Int32) -> SIMDX4<Int32> {
+  lhs >> rhs
+}
@@ -0,0 +1,33 @@
+// Copyright 2019-2022 Markus Winter
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: x86_64: | CHECK,X86
+// RUN: arm64: | CHECK,ARM64
+
+// `SIMDX4<Float>.==` compares the vectors at once and tests the resulting mask,
+// rather than comparing the elements one by one.
+
+import SIMDX
+
+// CHECK-LABEL: codegen_simdx4_float_equal:
+// X86: cmpeqps
+// X86: movmskps
+// ARM64: fcmeq v0.4s
+// CHECK-NOT: {{call|jmp|\sbl?\s}}
+// CHECK-NOT: {{\(%rsp\)|\[sp}}
+// CHECK: ret
+@_silgen_name("codegen_simdx4_float_equal")
+public func equal(_ lhs: SIMDX4<Float>, _ rhs: SIMDX4<Float>) -> Bool {
+  lhs == rhs
+}
@@ -0,0 +1,76 @@
+import XCTest
+import SIMDX
+
+final class QuaternionF32Tests: XCTestCase {
+
+  func testComponents() {
+    let quaternion = QuaternionF32(imaginary: SIMDX3(1, 2, 3), real: 4)
+    XCTAssertEqual(quaternion, QuaternionF32(1, 2, 3, 4))
+    XCTAssertEqual(quaternion.imaginary, SIMDX3(1, 2, 3))
+    XCTAssertEqual(quaternion.real, 4)
+    XCTAssertEqual(quaternion.conjugate, QuaternionF32(-1, -2, -3, 4))
+    XCTAssertEqual(QuaternionF32.identity, QuaternionF32(0, 0, 0, 1))
+  }
+
+  func testProducts() {
+    let quaternion = QuaternionF32(1, 2, 3, 4)
+    XCTAssertEqual(QuaternionF32.dot(quaternion, quaternion), 30)
+    XCTAssertEqual(quaternion * .identity, quaternion)
+    XCTAssertEqual(QuaternionF32(1, 0, 0, 0) * QuaternionF32(0, 1, 0, 0), QuaternionF32(0, 0, 1, 0))
+
+    var product = QuaternionF32(0, 1, 0, 0)
+    product *= QuaternionF32(1, 0, 0, 0)
+    XCTAssertEqual(product, QuaternionF32(0, 0, -1, 0))
+
+    let normalized = QuaternionF32(0, 0, 3, 4).normalized()
+    XCTAssertEqual(normalized.imaginary[2], 0.6, accuracy: 1e-6)
+    XCTAssertEqual(normalized.real, 0.8, accuracy: 1e-6)
+  }
+
+  func testRotate() {
+    // A quarter turn about the z axis
+    let rotation = QuaternionF32(imaginary: SIMDX3(0, 0, 0.5.squareRoot()), real: 0.5.squareRoot())
+    let rotated = rotation.rotate(SIMDX3(1, 0, 0))
+    XCTAssertEqual(rotated[0], 0, accuracy: 1e-6)
+    XCTAssertEqual(rotated[1], 1, accuracy: 1e-6)
+    XCTAssertEqual(rotated[2], 0, accuracy: 1e-6)
+  }
+
+  func testInterpolation() {
+    let to = QuaternionF32(0, 0, 0.5.squareRoot(), 0.5.squareRoot())
+    let quarter = QuaternionF32.slerp(from: .identity, to: to, t: 0.25)
+    XCTAssertEqual(quarter.imaginary[2], 0.19509032, accuracy: 1e-6)
+    XCTAssertEqual(quarter.real, 0.98078528, accuracy: 1e-6)
+
+    let halfway = QuaternionF32.nlerp(from: .identity, to: to, t: 0.5)
+    XCTAssertEqual(halfway.imaginary[2], 0.38268343, accuracy: 1e-6)
+    XCTAssertEqual(halfway.real, 0.92387953, accuracy: 1e-6)
+  }
+
+  func testBatchInterpolation() {
+    let to = QuaternionF32(0, 0, 0.5.squareRoot(), 0.5.squareRoot())
+    let from = [QuaternionF32](repeating: .identity, count: 5)
+    let target = [QuaternionF32](repeating: to, count: 5)
+    let t: [Float32] = [0, 0.25, 0.5, 0.75, 1]
+    var slerped = from
+    var nlerped = from
+
+    from.withUnsafeBufferPointer { from in
+      target.withUnsafeBufferPointer { target in
+        t.withUnsafeBufferPointer { t in
+          slerped.withUnsafeMutableBufferPointer { QuaternionF32.slerp(from: from, to: target, t: t, into: $0) }
+          nlerped.withUnsafeMutableBufferPointer { QuaternionF32.nlerp(from: from, to: target, t: t, into: $0) }
+        }
+      }
+    }
+
+    for index in 0 ..< 5 {
+      let slerp = QuaternionF32.slerp(from: .identity, to: to, t: t[index])
+      let nlerp = QuaternionF32.nlerp(from: .identity, to: to, t: t[index])
+      XCTAssertEqual(slerped[index].imaginary[2], slerp.imaginary[2], accuracy: 1e-5)
+      XCTAssertEqual(slerped[index].real, slerp.real, accuracy: 1e-5)
+      XCTAssertEqual(nlerped[index].imaginary[2], nlerp.imaginary[2], accuracy: 1e-5)
+      XCTAssertEqual(nlerped[index].real, nlerp.real, accuracy: 1e-5)
+    }
+  }
+}
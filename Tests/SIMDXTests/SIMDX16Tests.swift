@@ -0,0 +1,69 @@
+import XCTest
+import SIMDX
+
+final class SIMDX16Tests: XCTestCase {
+
+  func testArithmetic() {
+    let lhs: SIMDX16<Float32> = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]
+    let rhs: SIMDX16<Float32> = [16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1]
+    XCTAssertEqual(lhs + rhs, 17)
+    XCTAssertEqual((lhs * 2)[15], 32)
+    XCTAssertEqual(lhs.addingProduct(rhs, 1), 17)
+
+    let float64Storage: SIMDX16<Float64> = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]
+    XCTAssertEqual(float64Storage - float64Storage, .zero)
+    XCTAssertEqual(float64Storage[8], 9)
+  }
+
+  func testReduction() {
+    let float32Storage: SIMDX16<Float32> = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, -14, 15, 16]
+    XCTAssertEqual(float32Storage.sum(), 108)
+    XCTAssertEqual(float32Storage.minimum(), -14)
+    XCTAssertEqual(float32Storage.maximum(), 16)
+
+    let float64Storage: SIMDX16<Float64> = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, -14, 15, 16]
+    XCTAssertEqual(float64Storage.sum(), 108)
+    XCTAssertEqual(float64Storage.minimum(), -14)
+    XCTAssertEqual(float64Storage.maximum(), 16)
+  }
+
+  func testIntegerArithmetic() {
+    let int32Storage: SIMDX16<Int32> = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, .max]
+    XCTAssertEqual((int32Storage + 1)[15], .min)
+    XCTAssertEqual((int32Storage << 1)[8], 18)
+    XCTAssertEqual((int32Storage * -2)[15], 2)
+    XCTAssertEqual(SIMDX16.max(int32Storage, 8)[0], 8)
+    XCTAssertEqual(SIMDX16.min(int32Storage, 8)[15], 8)
+
+    let uint32Storage = SIMDX16<UInt32>(bitPattern: -int32Storage)
+    XCTAssertEqual(uint32Storage[0], .max)
+    XCTAssertEqual(uint32Storage.leadingZeroBitCount[15], 0)
+    XCTAssertEqual(uint32Storage.byteSwapped[0], .max)
+    XCTAssertEqual(uint32Storage.bitReversed[1], 0x7FFF_FFFF)
+  }
+
+  func testCompare() {
+    let float32Storage = SIMDX16<Float32>(rawValue: .init((1 ... 16).map { Float32($0) }))
+    let lessThan = float32Storage .< 9
+    XCTAssertEqual((0 ..< CInt(16)).map { lessThan[$0] }, (1 ... 16).map { $0 < 9 })
+    XCTAssertEqual(float32Storage.replacing(with: 0, where: lessThan), SIMDX16(rawValue: .init((1 ... 16).map { $0 < 9 ? 0 : Float32($0) })))
+
+    // 16 x Float64 are held in a pair of storages, and so is their mask
+    let float64Storage = SIMDX16<Float64>(rawValue: .init((1 ... 16).map { Float64($0) }))
+    XCTAssertTrue((float64Storage .>= 1).all())
+    XCTAssertTrue((float64Storage .== 16).any())
+    XCTAssertFalse((float64Storage .== 16).all())
+
+    let int32Storage = SIMDX16<Int32>(rawValue: .init((0 ..< 16).map { Int32($0) - 8 }))
+    XCTAssertEqual(int32Storage.replacing(with: -int32Storage, where: int32Storage .< 0), SIMDX16(rawValue: .init((0 ..< 16).map { abs(Int32($0) - 8) })))
+  }
+
+  func testBridgingToSIMD() {
+    let vector = SIMD16<Float32>((1 ... 16).map { Float32($0) })
+    XCTAssertEqual(SIMDX16(vector).sum(), 136)
+    XCTAssertEqual(SIMD16(SIMDX16(vector)), vector)
+
+    let int32Vector = SIMD16<Int32>((1 ... 16).map { Int32($0) })
+    XCTAssertEqual(SIMD16(SIMDX16(int32Vector) + 1), int32Vector &+ 1)
+  }
+}
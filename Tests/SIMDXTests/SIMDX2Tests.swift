@@ -36,4 +36,16 @@ final class SIMDX2Tests: XCTestCase {
     XCTAssertEqual(float64Storage[0], 1.5)
     XCTAssertEqual(float64Storage[1], 4.0)
   }
+
+  func testBridgingToSIMD() {
+    let float32Storage = SIMDX2<Float32>(SIMD2(3, -8))
+    XCTAssertEqual(float32Storage, SIMDX2(3, -8))
+    XCTAssertEqual(SIMD2(float32Storage), SIMD2<Float32>(3, -8))
+
+    let float64Storage = SIMDX2<Float64>(SIMD2(3, -8))
+    XCTAssertEqual(SIMD2(float64Storage * 2), SIMD2<Float64>(6, -16))
+
+    let int32Storage = SIMDX2<Int32>(SIMD2(.max, .min))
+    XCTAssertEqual(SIMD2(int32Storage), SIMD2<Int32>(.max, .min))
+  }
 }
@@ -0,0 +1,82 @@
+import XCTest
+import SIMDX
+
+final class SIMDX32Tests: XCTestCase {
+
+  func testArithmetic() {
+    let float32Storage = SIMDX32<Float32>(rawValue: .init((1 ... 32).map { Float32($0) }))
+    XCTAssertEqual(float32Storage.count, 32)
+    XCTAssertEqual(float32Storage + float32Storage, SIMDX32(rawValue: .init((1 ... 32).map { 2 * Float32($0) })))
+    XCTAssertEqual((float32Storage / 2)[31], 16)
+
+    let float64Storage = SIMDX32<Float64>(rawValue: .init((1 ... 32).map { Float64($0) }))
+    XCTAssertEqual((float64Storage * float64Storage)[16], 289)
+  }
+
+  func testReduction() {
+    let float32Storage = SIMDX32<Float32>(rawValue: .init((1 ... 32).map { Float32($0) }))
+    XCTAssertEqual(float32Storage.sum(), 528)
+    XCTAssertEqual(float32Storage.minimum(), 1)
+    XCTAssertEqual(float32Storage.maximum(), 32)
+
+    let float64Storage = SIMDX32<Float64>(rawValue: .init((1 ... 32).map { -Float64($0) }))
+    XCTAssertEqual(float64Storage.sum(), -528)
+    XCTAssertEqual(float64Storage.minimum(), -32)
+    XCTAssertEqual(float64Storage.maximum(), -1)
+  }
+
+  func testIntegerArithmetic() {
+    let uint32Storage = SIMDX32<UInt32>(rawValue: .init((0 ..< 32).map { UInt32(1) << $0 }))
+    XCTAssertEqual(uint32Storage.trailingZeroBitCount, SIMDX32(rawValue: .init((0 ..< 32).map { UInt32($0) })))
+    XCTAssertEqual(uint32Storage.leadingZeroBitCount, SIMDX32(rawValue: .init((0 ..< 32).map { 31 - UInt32($0) })))
+    XCTAssertEqual((uint32Storage >> 1)[31], 1 << 30)
+
+    let int32Storage = SIMDX32<Int32>(bitPattern: uint32Storage)
+    XCTAssertEqual(int32Storage[31], .min)
+    XCTAssertEqual((int32Storage >> 1)[31], .min >> 1)
+  }
+
+  func testCompare() {
+    // 32 elements are held in a pair of storages, and so is their mask
+    let float32Storage = SIMDX32<Float32>(rawValue: .init((1 ... 32).map { Float32($0) }))
+    let greaterThan = float32Storage .> 20
+    XCTAssertEqual((0 ..< CInt(32)).map { greaterThan[$0] }, (1 ... 32).map { $0 > 20 })
+    XCTAssertEqual(float32Storage.replacing(with: 20, where: greaterThan), SIMDX32(rawValue: .init((1 ... 32).map { Float32(Swift.min($0, 20)) })))
+    XCTAssertTrue(greaterThan.any())
+    XCTAssertFalse(greaterThan.all())
+    XCTAssertFalse((float32Storage .> 32).any())
+
+    let float64Storage = SIMDX32<Float64>(rawValue: .init((1 ... 32).map { Float64($0) }))
+    XCTAssertTrue((float64Storage .<= 32).all())
+    XCTAssertFalse((float64Storage .!= 1).all())
+
+    let uint32Storage = SIMDX32<UInt32>(rawValue: .init((0 ..< 32).map { UInt32(1) << $0 }))
+    XCTAssertEqual((0 ..< CInt(32)).map { (uint32Storage .>= UInt32(1) << 31)[$0] }, (0 ..< 32).map { $0 == 31 })
+  }
+
+  func testBridgingToSIMD() {
+    let vector = SIMD32<Float64>((1 ... 32).map { Float64($0) })
+    XCTAssertEqual(SIMDX32(vector).sum(), 528)
+    XCTAssertEqual(SIMD32(SIMDX32(vector)), vector)
+  }
+
+  func testLoading() {
+    let elements = (0 ..< 40).map { Float32($0) }
+    XCTAssertEqual(SIMDX32<Float32>(elements[8 ..< 40]).sum(), 752)
+    elements.withUnsafeBufferPointer { buffer in
+      XCTAssertEqual(SIMDX32<Float32>(loadingFrom: buffer.baseAddress!).maximum(), 31)
+    }
+  }
+
+  func testMinMax() {
+    let float32Storage = SIMDX32<Float32>(rawValue: .init((0 ..< 32).map { Float32($0) - 16 }))
+    XCTAssertEqual(SIMDX32.abs(float32Storage).sum(), 256)
+    XCTAssertEqual(SIMDX32.max(float32Storage, .zero).sum(), 120)
+    XCTAssertEqual(float32Storage.clamped(lowerBound: -1, upperBound: 1, semantics: .ieee754).sum(), -1)
+
+    let int32Storage = SIMDX32<Int32>(rawValue: .init((0 ..< 32).map { Int32($0) - 16 }))
+    XCTAssertEqual(SIMDX32.min(int32Storage, .zero)[0], -16)
+    XCTAssertEqual(SIMDX32.min(int32Storage, .zero)[31], 0)
+    XCTAssertEqual(SIMDX32.abs(int32Storage)[0], 16)
+  }
+}
@@ -30,4 +30,66 @@ final class SIMDX3Tests: XCTestCase {
     XCTAssertEqual(float64Storage[1], 4.0)
     XCTAssertEqual(float64Storage[2], -16.0)
   }
+
+  func testGeometry() {
+    let lhs = SIMDX3<Float32>(1, 2, 3)
+    let rhs = SIMDX3<Float32>(4, 5, 6)
+    XCTAssertEqual(SIMDX3.dot(lhs, rhs), 32)
+    XCTAssertEqual(SIMDX3.cross(lhs, rhs), SIMDX3<Float32>(-3, 6, -3))
+    XCTAssertEqual(SIMDX3<Float32>(2, 3, 6).length, 7)
+    XCTAssertEqual(SIMDX3<Float32>(2, 3, 6).lengthSquared, 49)
+    XCTAssertEqual(SIMDX3.distance(lhs, rhs), Float32(27).squareRoot())
+    XCTAssertEqual(SIMDX3<Float32>(0, 0, 5).normalized(), SIMDX3<Float32>(0, 0, 1))
+    XCTAssertEqual(SIMDX3<Float32>(2, 3, 6).fastNormalized().length, 1, accuracy: 1e-6)
+    XCTAssertEqual(SIMDX3<Float32>(1, -1, 0).reflected(off: SIMDX3(0, 1, 0)), SIMDX3(1, 1, 0))
+    XCTAssertEqual(SIMDX3<Float32>(3, 4, 5).projected(onto: SIMDX3(0, 2, 0)), SIMDX3(0, 4, 0))
+
+    let float64Storage = SIMDX3<Float64>(2, 3, 6)
+    XCTAssertEqual(SIMDX3.cross(float64Storage, float64Storage), .zero)
+    XCTAssertEqual(float64Storage.length, 7)
+    XCTAssertEqual(float64Storage.normalized()[2], 6 / 7, accuracy: 1e-15)
+    XCTAssertEqual(float64Storage.fastNormalized()[2], 6 / 7, accuracy: 1e-12)
+  }
+
+  func testEquatableAndHashable() {
+    let float32Storage = SIMDX3<Float32>(0, 1, 2)
+    XCTAssertEqual(float32Storage, SIMDX3(-0.0, 1, 2))
+    XCTAssertNotEqual(float32Storage, SIMDX3(0, 1, 3))
+    XCTAssertNotEqual(SIMDX3<Float32>(.nan, 1, 2), SIMDX3(.nan, 1, 2))
+    XCTAssertEqual(float32Storage.hashValue, SIMDX3<Float32>(-0.0, 1, 2).hashValue)
+    XCTAssertEqual(SIMDX3<Float32>(.nan, 1, 2).hashValue, SIMDX3<Float32>(-.nan, 1, 2).hashValue)
+
+    let float64Storage = SIMDX3<Float64>(0, 1, 2)
+    XCTAssertEqual(float64Storage, SIMDX3(-0.0, 1, 2))
+    XCTAssertEqual(float64Storage.hashValue, SIMDX3<Float64>(-0.0, 1, 2).hashValue)
+    XCTAssertEqual(Set([float64Storage, SIMDX3(-0.0, 1, 2), SIMDX3(0, 1, 3)]).count, 2)
+  }
+
+  func testBridgingToSIMD() {
+    let float32Storage = SIMDX3<Float32>(SIMD3(3, -8, 0.5))
+    XCTAssertEqual(float32Storage, SIMDX3(3, -8, 0.5))
+    XCTAssertEqual(SIMD3(float32Storage), SIMD3<Float32>(3, -8, 0.5))
+    XCTAssertEqual(float32Storage.hashValue, SIMDX3<Float32>(3, -8, 0.5).hashValue)
+
+    let float64Storage = SIMDX3<Float64>(SIMD3(3, -8, 0.5))
+    XCTAssertEqual(SIMD3(float64Storage * 2), SIMD3<Float64>(6, -16, 1))
+
+    let uint32Storage = SIMDX3<UInt32>(SIMD3(1, 2, .max))
+    XCTAssertEqual(SIMD3(uint32Storage), SIMD3<UInt32>(1, 2, .max))
+  }
+
+  func testLoading() {
+    // The last 3 elements of a buffer are loaded without reading beyond them
+    let elements: [Float32] = [1, 2, 3, 4, 5]
+    elements.withUnsafeBufferPointer { buffer in
+      let storage = SIMDX3<Float32>(UnsafeBufferPointer(rebasing: buffer[2...]))
+      XCTAssertEqual(storage, SIMDX3(3, 4, 5))
+      XCTAssertEqual(storage.hashValue, SIMDX3<Float32>(3, 4, 5).hashValue)
+      XCTAssertEqual(SIMDX3.dot(storage, storage), 50)
+    }
+    XCTAssertEqual(SIMDX3<Float64>(elements[1 ..< 4].map(Float64.init)), SIMDX3(2, 3, 4))
+
+    let uint32Elements: ContiguousArray<UInt32> = [1, 2, .max]
+    XCTAssertEqual(SIMDX3<UInt32>(uint32Elements), SIMDX3(1, 2, .max))
+  }
 }
@@ -1,37 +1,192 @@
-//import XCTest
-//import SIMDX
-//
-//final class SIMDX4Tests: XCTestCase {
-//
-//  func testMultiplyByElement() {
-//    var float32Storage = SIMDX4<Float32>(3, 8, -32, 32.5)
-//    float32Storage = float32Storage * 4 // Scale by 4
-//    XCTAssertEqual(float32Storage[0], 12)
-//    XCTAssertEqual(float32Storage[1], 32)
-//    XCTAssertEqual(float32Storage[2], -128)
-//    XCTAssertEqual(float32Storage[3], 130)
-//
-//    var float64Storage = SIMDX4<Float64>(3, 8, -32, 32.5)
-//    float64Storage = float64Storage * 4 // Scale by 4
-//    XCTAssertEqual(float64Storage[0], 12)
-//    XCTAssertEqual(float64Storage[1], 32)
-//    XCTAssertEqual(float64Storage[2], -128)
-//    XCTAssertEqual(float64Storage[3], 130)
-//  }
-//
-//  func testDivideByElement() {
-//    var float32Storage = SIMDX4<Float32>(3, 8, -32, 32.5)
-//    float32Storage = float32Storage / 2 // Scale by 0.5
-//    XCTAssertEqual(float32Storage[0], 1.5)
-//    XCTAssertEqual(float32Storage[1], 4.0)
-//    XCTAssertEqual(float32Storage[2], -16.0)
-//    XCTAssertEqual(float32Storage[3], 16.25)
-//
-//    var float64Storage = SIMDX4<Float64>(3, 8, -32, 32.5)
-//    float64Storage = float64Storage / 2 // Scale by 0.5
-//    XCTAssertEqual(float64Storage[0], 1.5)
-//    XCTAssertEqual(float64Storage[1], 4.0)
-//    XCTAssertEqual(float64Storage[2], -16.0)
-//    XCTAssertEqual(float64Storage[3], 16.25)
-//  }
-//}
+import XCTest
+import SIMDX
+
+final class SIMDX4Tests: XCTestCase {
+
+  func testMultiplyByElement() {
+    var float32Storage = SIMDX4<Float32>(3, 8, -32, 32.5)
+    float32Storage = float32Storage * 4 // Scale by 4
+    XCTAssertEqual(float32Storage[0], 12)
+    XCTAssertEqual(float32Storage[1], 32)
+    XCTAssertEqual(float32Storage[2], -128)
+    XCTAssertEqual(float32Storage[3], 130)
+
+    var float64Storage = SIMDX4<Float64>(3, 8, -32, 32.5)
+    float64Storage = float64Storage * 4 // Scale by 4
+    XCTAssertEqual(float64Storage[0], 12)
+    XCTAssertEqual(float64Storage[1], 32)
+    XCTAssertEqual(float64Storage[2], -128)
+    XCTAssertEqual(float64Storage[3], 130)
+  }
+
+  func testDivideByElement() {
+    var float32Storage = SIMDX4<Float32>(3, 8, -32, 32.5)
+    float32Storage = float32Storage / 2 // Scale by 0.5
+    XCTAssertEqual(float32Storage[0], 1.5)
+    XCTAssertEqual(float32Storage[1], 4.0)
+    XCTAssertEqual(float32Storage[2], -16.0)
+    XCTAssertEqual(float32Storage[3], 16.25)
+
+    var float64Storage = SIMDX4<Float64>(3, 8, -32, 32.5)
+    float64Storage = float64Storage / 2 // Scale by 0.5
+    XCTAssertEqual(float64Storage[0], 1.5)
+    XCTAssertEqual(float64Storage[1], 4.0)
+    XCTAssertEqual(float64Storage[2], -16.0)
+    XCTAssertEqual(float64Storage[3], 16.25)
+  }
+
+  func testArithmeticWithElement() {
+    let float32Storage = SIMDX4<Float32>(3, 8, -32, 32.5)
+    let element: Float32 = 2
+    XCTAssertEqual(float32Storage + element, SIMDX4(5, 10, -30, 34.5))
+    XCTAssertEqual(element + float32Storage, SIMDX4(5, 10, -30, 34.5))
+    XCTAssertEqual(float32Storage - element, SIMDX4(1, 6, -34, 30.5))
+    XCTAssertEqual(element - float32Storage, SIMDX4(-1, -6, 34, -30.5))
+    XCTAssertEqual(float32Storage * element, SIMDX4(6, 16, -64, 65))
+    XCTAssertEqual(element * float32Storage, SIMDX4(6, 16, -64, 65))
+    XCTAssertEqual(float32Storage / element, SIMDX4(1.5, 4, -16, 16.25))
+    XCTAssertEqual(element / SIMDX4<Float32>(1, 2, -4, 8), SIMDX4(2, 1, -0.5, 0.25))
+
+    var float64Storage = SIMDX4<Float64>(3, 8, -32, 32.5)
+    float64Storage += Float64(1)
+    XCTAssertEqual(float64Storage, SIMDX4(4, 9, -31, 33.5))
+    float64Storage -= Float64(2)
+    XCTAssertEqual(float64Storage, SIMDX4(2, 7, -33, 31.5))
+    float64Storage *= Float64(2)
+    XCTAssertEqual(float64Storage, SIMDX4(4, 14, -66, 63))
+    float64Storage /= Float64(4)
+    XCTAssertEqual(float64Storage, SIMDX4(1, 3.5, -16.5, 15.75))
+  }
+
+  func testAddingProduct() {
+    let float32Storage = SIMDX4<Float32>(1, 2, 3, 4)
+    let scaled = float32Storage.addingProduct(SIMDX4(3, 8, -32, 32.5), 2)
+    XCTAssertEqual(scaled, SIMDX4(7, 18, -61, 69))
+
+    var float64Storage = SIMDX4<Float64>(1, 2, 3, 4)
+    float64Storage.addProduct(SIMDX4(3, 8, -32, 32.5), 0.5)
+    XCTAssertEqual(float64Storage, SIMDX4(2.5, 6, -13, 20.25))
+  }
+
+  func testIntegerArithmetic() {
+    let int32Storage = SIMDX4<Int32>(3, -8, .max, .min)
+    XCTAssertEqual(int32Storage + SIMDX4(1, 1, 1, 1), SIMDX4(4, -7, .min, .min + 1))
+    XCTAssertEqual(int32Storage * SIMDX4(2, 2, 2, 2), SIMDX4(6, -16, -2, 0))
+    XCTAssertEqual(-int32Storage, SIMDX4(-3, 8, .min + 1, .min))
+    XCTAssertEqual(SIMDX4<Int32>.max, SIMDX4(.max, .max, .max, .max))
+    XCTAssertTrue(SIMDX4<Int32>.isSigned)
+
+    let uint32Storage = SIMDX4<UInt32>(3, 8, .max, 0)
+    XCTAssertEqual(uint32Storage - SIMDX4(1, 1, 1, 1), SIMDX4(2, 7, .max - 1, .max))
+    XCTAssertEqual(SIMDX4<UInt32>.min, .zero)
+    XCTAssertFalse(SIMDX4<UInt32>.isSigned)
+  }
+
+  func testBitwiseAndShifts() {
+    var int32Storage = SIMDX4<Int32>(0b1100, -1, .min, 0)
+    XCTAssertEqual(~int32Storage, SIMDX4(~0b1100, 0, .max, -1))
+    XCTAssertEqual(int32Storage & SIMDX4(0b1010, 0b1010, 0b1010, 0b1010), SIMDX4(0b1000, 0b1010, 0, 0))
+    XCTAssertEqual(int32Storage | SIMDX4(0b1010, 0b1010, 0b1010, 0b1010), SIMDX4(0b1110, -1, .min | 0b1010, 0b1010))
+    XCTAssertEqual(int32Storage ^ SIMDX4(0b1010, 0b1010, 0b1010, 0b1010), SIMDX4(0b0110, ~0b1010, .min | 0b1010, 0b1010))
+    XCTAssertEqual(int32Storage >> 2, SIMDX4(0b11, -1, .min >> 2, 0))
+    XCTAssertEqual(int32Storage << SIMDX4(1, 4, 1, 31), SIMDX4(0b11000, -16, 0, 0))
+    int32Storage <<= 1
+    XCTAssertEqual(int32Storage, SIMDX4(0b11000, -2, 0, 0))
+
+    var uint32Storage = SIMDX4<UInt32>(0b1100, .max, 1 << 31, 0)
+    uint32Storage >>= SIMDX4(2, 28, 31, 0)
+    XCTAssertEqual(uint32Storage, SIMDX4(0b11, 0b1111, 1, 0))
+    XCTAssertEqual(uint32Storage.nonzeroBitCount, SIMDX4(2, 4, 1, 0))
+    XCTAssertEqual(uint32Storage.leadingZeroBitCount, SIMDX4(30, 28, 31, 32))
+    XCTAssertEqual(uint32Storage.trailingZeroBitCount, SIMDX4(0, 0, 0, 32))
+    XCTAssertEqual(uint32Storage.byteSwapped, SIMDX4(0x0300_0000, 0x0F00_0000, 0x0100_0000, 0))
+    XCTAssertEqual(uint32Storage.bitReversed, SIMDX4(0xC000_0000, 0xF000_0000, 0x8000_0000, 0))
+  }
+
+  func testBridgingToSIMD() {
+    let float32Storage = SIMDX4<Float32>(SIMD4(3, 8, -32, 32.5))
+    XCTAssertEqual(float32Storage, SIMDX4(3, 8, -32, 32.5))
+    XCTAssertEqual(SIMD4(float32Storage), SIMD4<Float32>(3, 8, -32, 32.5))
+
+    let float64Storage = SIMDX4<Float64>(SIMD4(3, 8, -32, 32.5))
+    XCTAssertEqual(SIMD4(float64Storage + 1), SIMD4<Float64>(4, 9, -31, 33.5))
+
+    let int32Storage = SIMDX4<Int32>(SIMD4(3, -8, .max, .min))
+    XCTAssertEqual(SIMD4(-int32Storage), SIMD4<Int32>(-3, 8, .min + 1, .min))
+  }
+
+  func testLoading() {
+    let elements: [Float32] = [1, 2, 3, 4, 5, 6, 7, 8]
+    XCTAssertEqual(SIMDX4<Float32>(elements[2 ..< 6]), SIMDX4(3, 4, 5, 6))
+    XCTAssertEqual(SIMDX4<Float32>(ContiguousArray(elements[4...])), SIMDX4(5, 6, 7, 8))
+    XCTAssertEqual(SIMDX4<Float32>(elements.lazy.map { $0 * 2 }.prefix(4)), SIMDX4(2, 4, 6, 8))
+
+    elements.withUnsafeBufferPointer { buffer in
+      XCTAssertEqual(SIMDX4<Float32>(UnsafeBufferPointer(rebasing: buffer[4...])), SIMDX4(5, 6, 7, 8))
+      XCTAssertEqual(SIMDX4<Float32>(buffer[1 ..< 5]), SIMDX4(2, 3, 4, 5))
+      XCTAssertEqual(SIMDX4<Float32>(loadingFrom: buffer.baseAddress! + 3), SIMDX4(4, 5, 6, 7))
+    }
+
+    let int32Elements: ContiguousArray<Int32> = [.min, -1, 0, .max]
+    XCTAssertEqual(SIMDX4<Int32>(int32Elements), SIMDX4(.min, -1, 0, .max))
+  }
+
+  func testMinMax() {
+    let lhs = SIMDX4<Float32>(1, -2, 3, -4)
+    let rhs = SIMDX4<Float32>(-1, 2, 3, 4)
+    XCTAssertEqual(SIMDX4.min(lhs, rhs), SIMDX4(-1, -2, 3, -4))
+    XCTAssertEqual(SIMDX4.max(lhs, rhs), SIMDX4(1, 2, 3, 4))
+    XCTAssertEqual(SIMDX4.abs(lhs), SIMDX4(1, 2, 3, 4))
+
+    let int32Storage = SIMDX4<Int32>(.min, -2, 3, .max)
+    XCTAssertEqual(SIMDX4.min(int32Storage, 0), SIMDX4(.min, -2, 0, 0))
+    XCTAssertEqual(SIMDX4.max(int32Storage, 0), SIMDX4(0, 0, 3, .max))
+    XCTAssertEqual(SIMDX4.abs(int32Storage), SIMDX4(.min, 2, 3, .max))
+
+    let uint32Storage = SIMDX4<UInt32>(0, 2, 3, .max)
+    XCTAssertEqual(SIMDX4.max(uint32Storage, 2), SIMDX4(2, 2, 3, .max))
+    XCTAssertEqual(SIMDX4.abs(uint32Storage), uint32Storage)
+  }
+
+  func testIEEEMinMax() {
+    let lhs = SIMDX4<Float32>(.nan, 1, 0, -0)
+    let rhs = SIMDX4<Float32>(1, .nan, -0, 0)
+
+    let minimum = SIMDX4.min(lhs, rhs, semantics: .ieee754)
+    XCTAssertTrue(minimum[0].isNaN && minimum[1].isNaN)
+    XCTAssertEqual(minimum[2].sign, .minus)
+    XCTAssertEqual(minimum[3].sign, .minus)
+
+    let maximum = SIMDX4.max(lhs, rhs, semantics: .ieee754)
+    XCTAssertTrue(maximum[0].isNaN && maximum[1].isNaN)
+    XCTAssertEqual(maximum[2].sign, .plus)
+    XCTAssertEqual(maximum[3].sign, .plus)
+
+    XCTAssertEqual(SIMDX4.min(lhs, rhs, semantics: .hardware)[2], 0)
+  }
+
+  func testClamp() {
+    let value = SIMDX4<Float32>(-2, 0.5, 3, .nan)
+    let clamped = value.clamped(lowerBound: 0, upperBound: 1)
+    XCTAssertEqual(Array(clamped[0 ..< 3]), [0, 0.5, 1])
+    XCTAssertTrue(clamped[3].isNaN)
+    XCTAssertTrue(value.clamped(lowerBound: 0, upperBound: 1, semantics: .ieee754)[3].isNaN)
+    XCTAssertTrue(SIMDX4<Float32>(2, 2, 2, 2).clamped(lowerBound: .nan, upperBound: 1, semantics: .ieee754).allSatisfy(\.isNaN))
+
+    var int32Storage = SIMDX4<Int32>(-5, 5, 50, .min)
+    int32Storage.clamp(lowerBound: SIMDX4(0, 0, 0, -1), upperBound: SIMDX4(10, 1, 10, 10))
+    XCTAssertEqual(int32Storage, SIMDX4(0, 1, 10, -1))
+  }
+
+  func testBitPattern() {
+    let float32Storage = SIMDX4<Float32>(1, -2, -0, .infinity)
+    let bits = SIMDX4<UInt32>(bitPattern: float32Storage)
+    XCTAssertEqual(bits, SIMDX4(0x3F80_0000, 0xC000_0000, 0x8000_0000, 0x7F80_0000))
+    XCTAssertEqual(SIMDX4<Float32>(bitPattern: bits & 0x7FFF_FFFF), SIMDX4(1, 2, 0, .infinity))
+    XCTAssertEqual((bits >> 23) & 0xFF, SIMDX4(127, 128, 0, 255))
+
+    let int32Storage = SIMDX4<Int32>(bitPattern: float32Storage)
+    XCTAssertEqual(int32Storage, SIMDX4(0x3F80_0000, -0x4000_0000, .min, 0x7F80_0000))
+    XCTAssertEqual(SIMDX4<Float32>(bitPattern: int32Storage), float32Storage)
+  }
+}
@@ -0,0 +1,99 @@
+import XCTest
+import SIMDX
+
+final class SIMDX8Tests: XCTestCase {
+
+  func testArithmetic() {
+    let lhs = SIMDX8<Float32>(1, 2, 3, 4, 5, 6, 7, 8)
+    let rhs = SIMDX8<Float32>(8, 7, 6, 5, 4, 3, 2, 1)
+    XCTAssertEqual(lhs + rhs, SIMDX8(9, 9, 9, 9, 9, 9, 9, 9))
+    XCTAssertEqual(lhs - rhs, SIMDX8(-7, -5, -3, -1, 1, 3, 5, 7))
+    XCTAssertEqual(lhs * rhs, SIMDX8(8, 14, 18, 20, 20, 18, 14, 8))
+    XCTAssertEqual(lhs / SIMDX8(2, 2, 2, 2, 4, 4, 4, 4), SIMDX8(0.5, 1, 1.5, 2, 1.25, 1.5, 1.75, 2))
+    XCTAssertEqual(-lhs, SIMDX8(-1, -2, -3, -4, -5, -6, -7, -8))
+
+    let float64Storage = SIMDX8<Float64>(1, 2, 3, 4, 5, 6, 7, 8)
+    XCTAssertEqual(float64Storage + float64Storage, SIMDX8(2, 4, 6, 8, 10, 12, 14, 16))
+    XCTAssertEqual(float64Storage[7], 8)
+  }
+
+  func testArithmeticWithElement() {
+    let float32Storage = SIMDX8<Float32>(3, 8, -32, 32.5, 1, 2, 3, 4)
+    XCTAssertEqual(float32Storage * 2, SIMDX8(6, 16, -64, 65, 2, 4, 6, 8))
+    XCTAssertEqual(float32Storage - 1, SIMDX8(2, 7, -33, 31.5, 0, 1, 2, 3))
+
+    var float64Storage = SIMDX8<Float64>(1, 2, 3, 4, 5, 6, 7, 8)
+    float64Storage.addProduct(SIMDX8(2, 2, 2, 2, 2, 2, 2, 2), 0.5)
+    XCTAssertEqual(float64Storage, SIMDX8(2, 3, 4, 5, 6, 7, 8, 9))
+  }
+
+  func testReduction() {
+    let float32Storage = SIMDX8<Float32>(3, 8, -32, 32.5, 1, 2, 3, 4)
+    XCTAssertEqual(float32Storage.sum(), 21.5)
+    XCTAssertEqual(float32Storage.minimum(), -32)
+    XCTAssertEqual(float32Storage.maximum(), 32.5)
+
+    let float64Storage = SIMDX8<Float64>(3, 8, -32, 32.5, 1, 2, 3, 4)
+    XCTAssertEqual(float64Storage.sum(), 21.5)
+    XCTAssertEqual(float64Storage.minimum(), -32)
+    XCTAssertEqual(float64Storage.maximum(), 32.5)
+  }
+
+  func testIntegerArithmetic() {
+    let int32Storage = SIMDX8<Int32>(3, -8, .max, .min, 1, 2, 3, 4)
+    XCTAssertEqual(int32Storage + 1, SIMDX8(4, -7, .min, .min + 1, 2, 3, 4, 5))
+    XCTAssertEqual(-int32Storage, SIMDX8(-3, 8, .min + 1, .min, -1, -2, -3, -4))
+    XCTAssertEqual(int32Storage >> 1, SIMDX8(1, -4, .max >> 1, .min >> 1, 0, 1, 1, 2))
+
+    let uint32Storage = SIMDX8<UInt32>(0b1100, .max, 1 << 31, 0, 1, 2, 3, 4)
+    XCTAssertEqual(uint32Storage & 0b0110, SIMDX8(0b0100, 0b0110, 0, 0, 0, 2, 2, 4))
+    XCTAssertEqual(uint32Storage.nonzeroBitCount, SIMDX8(2, 32, 1, 0, 1, 1, 2, 1))
+    XCTAssertEqual(uint32Storage.leadingZeroBitCount, SIMDX8(28, 0, 0, 32, 31, 30, 30, 29))
+    XCTAssertEqual(uint32Storage << SIMDX8(1, 31, 1, 3, 0, 1, 2, 32), SIMDX8(0b1_1000, 1 << 31, 0, 0, 1, 4, 12, 0))
+    XCTAssertEqual(uint32Storage * 3, SIMDX8(36, .max - 2, 1 << 31, 0, 3, 6, 9, 12))
+  }
+
+  func testIntegerMinMax() {
+    let int32Storage = SIMDX8<Int32>(3, -8, .max, .min, 1, 2, 3, 4)
+    XCTAssertEqual(SIMDX8.min(int32Storage, .zero), SIMDX8(0, -8, 0, .min, 0, 0, 0, 0))
+    XCTAssertEqual(SIMDX8.max(int32Storage, .zero), SIMDX8(3, 0, .max, 0, 1, 2, 3, 4))
+    XCTAssertEqual(SIMDX8.abs(int32Storage), SIMDX8(3, 8, .max, .min, 1, 2, 3, 4))
+
+    let uint32Storage = SIMDX8<UInt32>(0b1100, .max, 1 << 31, 0, 1, 2, 3, 4)
+    XCTAssertEqual(uint32Storage.clamped(lowerBound: 1, upperBound: 3), SIMDX8(3, 3, 3, 1, 1, 2, 3, 3))
+  }
+
+  func testCompare() {
+    let float32Storage = SIMDX8<Float32>(1, 2, 3, 4, 5, 6, 7, .nan)
+    XCTAssertEqual(float32Storage .< 5, [true, true, true, true, false, false, false, false])
+    XCTAssertEqual(float32Storage .!= float32Storage, [false, false, false, false, false, false, false, true])
+
+    let float64Storage = SIMDX8<Float64>(1, -2, 3, -4, 5, -6, 7, -8)
+    XCTAssertEqual(float64Storage.replacing(with: 0, where: float64Storage .< 0), [1, 0, 3, 0, 5, 0, 7, 0])
+
+    let uint32Storage = SIMDX8<UInt32>(1, .max, 3, 4, 5, 6, 7, 8)
+    XCTAssertEqual(uint32Storage .> 4, [false, true, false, false, true, true, true, true])
+    XCTAssertTrue((uint32Storage .> 0).all())
+    XCTAssertFalse((uint32Storage .== 0).any())
+  }
+
+  func testBridgingToSIMD() {
+    let vector = SIMD8<Float32>(3, 8, -32, 32.5, 1, 2, 3, 4)
+    XCTAssertEqual(SIMDX8(vector), SIMDX8(3, 8, -32, 32.5, 1, 2, 3, 4))
+    XCTAssertEqual(SIMD8(SIMDX8(vector) * 2), vector * 2)
+
+    let float64Vector = SIMD8<Float64>(3, 8, -32, 32.5, 1, 2, 3, 4)
+    XCTAssertEqual(SIMD8(SIMDX8(float64Vector)), float64Vector)
+
+    let uint32Vector = SIMD8<UInt32>(0b1100, .max, 1 << 31, 0, 1, 2, 3, 4)
+    XCTAssertEqual(SIMD8(SIMDX8(uint32Vector)), uint32Vector)
+  }
+
+  func testBitPattern() {
+    let int32Storage = SIMDX8<Int32>(-1, 0, 1, .min, .max, -2, 2, 3)
+    let uint32Storage = SIMDX8<UInt32>(bitPattern: int32Storage)
+    XCTAssertEqual(uint32Storage[0], .max)
+    XCTAssertEqual(uint32Storage[3], 1 << 31)
+    XCTAssertEqual(SIMDX8<Int32>(bitPattern: uint32Storage), int32Storage)
+  }
+}
@@ -0,0 +1,60 @@
+import XCTest
+import SIMDX
+
+final class SIMDXExpressionTests: XCTestCase {
+
+  func testMultiplyAdd() {
+    let lhs: [SIMDX4<Float32>] = [[1, -6, -3, 4], [2, 3, 4, 5]]
+    let rhs: [SIMDX4<Float32>] = [[2, 2, -1, 2], [0.5, 0.5, 0.5, 0.5]]
+    let addend: [SIMDX4<Float32>] = [[0.5, 1, -2, 3], [1, 1, 1, 1]]
+
+    let expression = lhs.expression * rhs.expression + addend.expression
+    XCTAssertTrue(type(of: expression) == SIMDXMultiplyAdd<
+      SIMDXBufferExpression<SIMDX4<Float32>>,
+      SIMDXBufferExpression<SIMDX4<Float32>>,
+      SIMDXBufferExpression<SIMDX4<Float32>>
+    >.self)
+    XCTAssertEqual(expression.evaluated(), [[2.5, -11, 1, 11], [2, 2.5, 3, 3.5]])
+    XCTAssertEqual((addend.expression - lhs.expression * rhs.expression).evaluated(), [[-1.5, 13, -5, -5], [0, -0.5, -1, -1.5]])
+    XCTAssertEqual((lhs.expression * rhs.expression - addend.expression).evaluated(), [[1.5, -13, 5, 5], [0, 0.5, 1, 1.5]])
+  }
+
+  func testScaledSum() {
+    let colors: [SIMDX4<Float32>] = [[0.25, 0.5, 0.75, 1], [0, 0.125, 0.25, 1]]
+    let brightness = SIMDXRepeatedExpression(SIMDX4<Float32>(0.25, 0.25, 0.25, 0))
+    let result = ((colors.expression + brightness) * 2).evaluated()
+    XCTAssertEqual(result, [[1, 1.5, 2, 2], [0.5, 0.75, 1, 2]])
+  }
+
+  func testArithmeticWithElement() {
+    let operand: [SIMDX2<Float64>] = [[1, 2], [3, 4], [5, 6]]
+    XCTAssertEqual((operand.expression * 2 + 1).evaluated(), [[3, 5], [7, 9], [11, 13]])
+    XCTAssertEqual((1 - operand.expression * 2).evaluated(), [[-1, -3], [-5, -7], [-9, -11]])
+    XCTAssertEqual((operand.expression / 2 - 1).evaluated(), [[-0.5, 0], [0.5, 1], [1.5, 2]])
+    XCTAssertEqual((-operand.expression).evaluated(), [[-1, -2], [-3, -4], [-5, -6]])
+  }
+
+  func testCountOfShortestBuffer() {
+    let lhs: [SIMDX8<Float32>] = [1, 2, 3]
+    let rhs: [SIMDX8<Float32>] = [4, 5]
+    let expression = lhs.expression * rhs.expression + lhs.expression
+    XCTAssertEqual(expression.count, 2)
+    XCTAssertEqual(expression.evaluated(), [5, 12])
+  }
+
+  func testEvaluateIntoBuffer() {
+    let operand: [SIMDX3<Float32>] = [[1, 2, 3], [4, 5, 6]]
+    var result = [SIMDX3<Float32>](repeating: 0, count: 2)
+    result.withUnsafeMutableBufferPointer { buffer in
+      (operand.expression * operand.expression + operand.expression).evaluate(into: buffer)
+    }
+    XCTAssertEqual(result, [[2, 6, 12], [20, 30, 42]])
+  }
+
+  func testIntegerMultiplyAdd() {
+    let lhs: [SIMDX4<Int32>] = [[1, -6, -3, 4]]
+    let rhs: [SIMDX4<Int32>] = [[2, 2, -1, 2]]
+    let addend: [SIMDX4<Int32>] = [[5, 1, -2, 3]]
+    XCTAssertEqual((lhs.expression * rhs.expression + addend.expression).evaluated(), [[7, -11, 1, 11]])
+  }
+}
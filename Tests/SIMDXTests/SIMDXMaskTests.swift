@@ -0,0 +1,80 @@
+import XCTest
+import SIMDX
+
+final class SIMDXMaskTests: XCTestCase {
+
+  func testCompare() {
+    let lhs = SIMDX4<Float32>(1, 2, .nan, 4)
+    let rhs = SIMDX4<Float32>(1, 3, .nan, 2)
+
+    XCTAssertEqual(lhs .== rhs, [true, false, false, false])
+    XCTAssertEqual(lhs .!= rhs, [false, true, true, true])
+    XCTAssertEqual(lhs .< rhs, [false, true, false, false])
+    XCTAssertEqual(lhs .<= rhs, [true, true, false, false])
+    XCTAssertEqual(lhs .> rhs, [false, false, false, true])
+    XCTAssertEqual(lhs .>= rhs, [true, false, false, true])
+  }
+
+  func testCompareWithElement() {
+    let value = SIMDX3<UInt32>(1, .max, 3)
+
+    XCTAssertEqual(value .< 3, [true, false, false])
+    XCTAssertEqual(value .>= 3, [false, true, true])
+    XCTAssertEqual(3 .== value, [false, false, true])
+    XCTAssertEqual(2 .> value, [true, false, false])
+  }
+
+  func testLanes() {
+    var mask = SIMDXMask3<Int32>(repeating: false)
+    XCTAssertEqual(mask.count, 3)
+    XCTAssertFalse(mask[1])
+
+    mask[1] = true
+    XCTAssertEqual(mask, [false, true, false])
+    XCTAssertEqual(mask.rawValue, Int32x3(0, -1, 0))
+  }
+
+  func testAnyAll() {
+    let value = SIMDX2<Int32>(-1, 1)
+
+    XCTAssertTrue((value .< 0).any())
+    XCTAssertFalse((value .< 0).all())
+    XCTAssertTrue((value .!= 0).all())
+    XCTAssertFalse((value .> 1).any())
+    // The unused lane of the negation does not count
+    XCTAssertFalse((.!SIMDXMask3<Float32>(repeating: true)).any())
+    XCTAssertTrue((.!SIMDXMask3<Float32>(repeating: false)).all())
+  }
+
+  func testLogicalOperators() {
+    let lhs: SIMDXMask4<Int32> = [true, true, false, false]
+    let rhs: SIMDXMask4<Int32> = [true, false, true, false]
+
+    XCTAssertEqual(lhs .& rhs, [true, false, false, false])
+    XCTAssertEqual(lhs .| rhs, [true, true, true, false])
+    XCTAssertEqual(lhs .^ rhs, [false, true, true, false])
+    XCTAssertEqual(.!lhs, [false, false, true, true])
+  }
+
+  func testReplacing() {
+    let value = SIMDX4<Float32>(-1, 2, -3, 4)
+
+    XCTAssertEqual(value.replacing(with: 0, where: value .< 0), [0, 2, 0, 4])
+    XCTAssertEqual(value.replacing(with: -value, where: value .< 0), [1, 2, 3, 4])
+
+    var clamped = SIMDX3<Int32>(1, 20, -5)
+    clamped.replace(with: 10, where: clamped .> 10)
+    XCTAssertEqual(clamped, [1, 10, -5])
+  }
+
+  func testMaskedArithmetic() {
+    let value = SIMDX4<Int32>(1, 2, 3, 4)
+    let mask: SIMDXMask4<Int32> = [true, false, true, false]
+
+    XCTAssertEqual(value.adding(10, where: mask), [11, 2, 13, 4])
+    XCTAssertEqual(value.multiplied(by: 3, where: mask), [3, 2, 9, 4])
+
+    let scale = SIMDX2<Float32>(0.5, 2)
+    XCTAssertEqual(scale.multiplied(by: scale, where: scale .> 1), [0.5, 4])
+  }
+}
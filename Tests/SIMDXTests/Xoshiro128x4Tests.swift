@@ -0,0 +1,82 @@
+import XCTest
+import SIMDX
+
+final class Xoshiro128x4Tests: XCTestCase {
+
+  func testNext() {
+    var generator = Xoshiro128x4(seed: 42)
+    var copy = generator
+    let values = (0 ..< 4).map { _ in generator.next() }
+    XCTAssertEqual(values, (0 ..< 4).map { _ in copy.next() })
+    XCTAssertEqual(Set(values).count, 4)
+
+    var otherStream = Xoshiro128x4(seed: 42, stream: 1)
+    XCTAssertNotEqual(otherStream.next(), values[0])
+
+    var jumped = Xoshiro128x4(seed: 42)
+    jumped.jump()
+    XCTAssertNotEqual(jumped.next(), values[0])
+
+    // Conformance to RandomNumberGenerator
+    XCTAssertTrue((0 ..< 100).map { _ in Int.random(in: 0 ..< 10, using: &generator) }.allSatisfy { (0 ..< 10).contains($0) })
+  }
+
+  func testNextUniform() {
+    var generator = Xoshiro128x4(seed: 7)
+    var sum: Float32 = 0
+    for _ in 0 ..< 1000 {
+      let values = generator.nextUniform()
+      XCTAssertTrue(values.allSatisfy { (0 ..< 1).contains($0) })
+      sum += values.sum()
+    }
+    XCTAssertEqual(sum / 4000, 0.5, accuracy: 0.02)
+  }
+
+  func testNextNormal() {
+    var generator = Xoshiro128x4(seed: 7)
+    var values: [Float32] = []
+    for _ in 0 ..< 500 {
+      values += generator.nextNormal()
+      let (first, second) = generator.nextNormalPair()
+      values += first
+      values += second
+    }
+    let mean = values.reduce(0, +) / Float32(values.count)
+    let variance = values.reduce(0) { $0 + ($1 - mean) * ($1 - mean) } / Float32(values.count)
+    XCTAssertEqual(mean, 0, accuracy: 0.05)
+    XCTAssertEqual(variance, 1, accuracy: 0.05)
+  }
+
+  func testFill() {
+    var generator = Xoshiro128x4(seed: 3)
+    var integers = [UInt32](repeating: 0, count: 37)
+    integers.withUnsafeMutableBufferPointer { generator.fill($0) }
+    XCTAssertGreaterThan(Set(integers).count, 30)
+
+    var uniform = [Float32](repeating: -1, count: 37)
+    uniform.withUnsafeMutableBufferPointer { generator.fillUniform($0) }
+    XCTAssertTrue(uniform.allSatisfy { (0 ..< 1).contains($0) })
+
+    var normal = [Float32](repeating: .nan, count: 37)
+    normal.withUnsafeMutableBufferPointer { generator.fillNormal($0) }
+    XCTAssertTrue(normal.allSatisfy { $0.isFinite })
+
+    var empty: [Float32] = []
+    empty.withUnsafeMutableBufferPointer { generator.fillUniform($0) }
+  }
+
+  func testRandomInRange() {
+    var generator = Xoshiro128x4(seed: 11)
+    for _ in 0 ..< 100 {
+      XCTAssertTrue(SIMDX4<Float32>.random(in: -2 ..< 3, using: &generator).allSatisfy { (-2 ..< 3).contains($0) })
+    }
+
+    var system = SystemRandomNumberGenerator()
+    XCTAssertTrue(SIMDX4<Float32>.random(in: 1 ..< 2, using: &system).allSatisfy { (1 ..< 2).contains($0) })
+    XCTAssertTrue(SIMDX4<Float32>.random(in: 0 ..< 1).allSatisfy { (0 ..< 1).contains($0) })
+
+    // Seeded generators passed as generic parameter produce the same values
+    var lhs = Xoshiro128x4(seed: 5), rhs = Xoshiro128x4(seed: 5)
+    XCTAssertEqual(SIMDX4<Float32>.random(in: 0 ..< 1, using: &lhs), SIMDX4<Float32>.random(in: 0 ..< 1, using: &rhs))
+  }
+}